@@ -0,0 +1,136 @@
+#include <atomic>
+#include <exception>
+#include <memory>
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/executor.h"
+
+namespace safeheron{
+namespace mpc_flow{
+namespace mpc_parallel_v2{
+
+ThreadPoolExecutor::ThreadPoolExecutor(size_t thread_count): stop_(false) {
+    if (thread_count == 0) thread_count = 1;
+    for (size_t i = 0; i < thread_count; ++i) {
+        worker_arr_.emplace_back(&ThreadPoolExecutor::WorkerLoop, this);
+    }
+}
+
+ThreadPoolExecutor::~ThreadPoolExecutor() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    cond_.notify_all();
+    for (auto &worker : worker_arr_) {
+        worker.join();
+    }
+}
+
+void ThreadPoolExecutor::Execute(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        task_queue_.push(std::move(task));
+    }
+    cond_.notify_one();
+}
+
+void ThreadPoolExecutor::WorkerLoop() {
+    while (true) {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cond_.wait(lock, [this] { return stop_ || !task_queue_.empty(); });
+            // Drain the queue before stopping, every submitted task runs once
+            if (task_queue_.empty()) return;
+            task = std::move(task_queue_.front());
+            task_queue_.pop();
+        }
+        task();
+    }
+}
+
+void TaskGroup::Run(Executor *executor, std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_++;
+    }
+    executor->Execute([this, task]() {
+        std::exception_ptr error;
+        try {
+            task();
+        } catch (...) {
+            error = std::current_exception();
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (error && !error_) error_ = error;
+        pending_--;
+        if (pending_ == 0) cond_.notify_all();
+    });
+}
+
+void TaskGroup::Wait() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cond_.wait(lock, [this] { return pending_ == 0; });
+}
+
+std::exception_ptr TaskGroup::TakeError() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::exception_ptr error = error_;
+    error_ = nullptr;
+    return error;
+}
+
+namespace {
+
+// Shared by the caller of ParallelFor() and its helper tasks. A helper may only start after the call returned, so it
+// keeps the state alive and touches body only once it has claimed an index, which the caller is still waiting for.
+struct ParallelForState {
+    std::atomic<size_t> next;
+    size_t count;
+    const std::function<void(size_t)> *body;
+    std::mutex mutex;
+    std::condition_variable cond;
+    size_t done;
+    std::exception_ptr error;
+};
+
+void DrainParallelFor(ParallelForState &state) {
+    for (size_t i = state.next++; i < state.count; i = state.next++) {
+        std::exception_ptr error;
+        try {
+            (*state.body)(i);
+        } catch (...) {
+            error = std::current_exception();
+        }
+        std::lock_guard<std::mutex> lock(state.mutex);
+        if (error && !state.error) state.error = error;
+        state.done++;
+        if (state.done == state.count) state.cond.notify_all();
+    }
+}
+
+}
+
+void ParallelFor(Executor *executor, size_t count, const std::function<void(size_t)> &body) {
+    if (executor == nullptr || count < 2) {
+        for (size_t i = 0; i < count; ++i) body(i);
+        return;
+    }
+
+    std::shared_ptr<ParallelForState> state = std::make_shared<ParallelForState>();
+    state->next = 0;
+    state->count = count;
+    state->body = &body;
+    state->done = 0;
+    for (size_t k = 1; k < count; ++k) {
+        executor->Execute([state]() { DrainParallelFor(*state); });
+    }
+    DrainParallelFor(*state);
+
+    // Wait for the indices claimed by helpers only, the helpers which have not started yet find nothing left
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->cond.wait(lock, [&state] { return state->done == state->count; });
+    if (state->error) std::rethrow_exception(state->error);
+}
+}
+}
+}
@@ -0,0 +1,102 @@
+#ifndef SAFEHERON_MPC_FLOW_MPC_PARALLEL_V2_EXECUTOR_H
+#define SAFEHERON_MPC_FLOW_MPC_PARALLEL_V2_EXECUTOR_H
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace safeheron{
+namespace mpc_flow{
+namespace mpc_parallel_v2{
+
+/**
+ * Runs tasks on behalf of an MPCContext. Implement it to plug in the thread pool of the application.
+ */
+class Executor {
+public:
+    virtual ~Executor() = default;
+
+    /**
+     * Run the task asynchronously. The task must be run exactly once.
+     */
+    virtual void Execute(std::function<void()> task) = 0;
+};
+
+/**
+ * Executor backed by a fixed number of worker threads.
+ */
+class ThreadPoolExecutor : public Executor {
+public:
+    explicit ThreadPoolExecutor(size_t thread_count);
+
+    ~ThreadPoolExecutor() override;
+
+    ThreadPoolExecutor(const ThreadPoolExecutor &) = delete;
+
+    ThreadPoolExecutor &operator=(const ThreadPoolExecutor &) = delete;
+
+    void Execute(std::function<void()> task) override;
+
+    size_t thread_count() const { return worker_arr_.size(); }
+
+private:
+    void WorkerLoop();
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cond_;
+    std::queue<std::function<void()>> task_queue_;
+    std::vector<std::thread> worker_arr_;
+    bool stop_;
+};
+
+/**
+ * Tracks the tasks submitted through an executor so that the submitter can wait for all of them.
+ * A task which throws is still counted as done: the first exception is kept for TakeError() instead of ending the
+ * worker thread. Tasks that must report a failure catch it themselves.
+ * Copies start empty: the pending tasks belong to the original object.
+ */
+class TaskGroup {
+public:
+    TaskGroup(): pending_(0) {}
+
+    TaskGroup(const TaskGroup &): pending_(0) {}
+
+    TaskGroup &operator=(const TaskGroup &) { return *this; }
+
+    ~TaskGroup() { Wait(); }
+
+    void Run(Executor *executor, std::function<void()> task);
+
+    void Wait();
+
+    /**
+     * The first exception thrown by a task since the last call, or null.
+     */
+    std::exception_ptr TakeError();
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cond_;
+    int pending_;
+    std::exception_ptr error_;
+};
+
+/**
+ * Calls body(i) for every i in [0, count) and returns once all the calls are done. The calling thread takes part in
+ * the work, and with a null executor the loop runs inline. Each call should only write to its own slot so that the
+ * result does not depend on scheduling. The first exception thrown by body is rethrown to the caller.
+ * It may be called from a task running on the same executor: the caller only waits for the calls other threads have
+ * started, and a helper task which starts after that finds nothing left to do.
+ */
+void ParallelFor(Executor *executor, size_t count, const std::function<void(size_t)> &body);
+
+}
+}
+}
+
+#endif //SAFEHERON_MPC_FLOW_MPC_PARALLEL_V2_EXECUTOR_H
@@ -0,0 +1,190 @@
+#include <cstdio>
+#include <tuple>
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/instrumentation.h"
+
+using std::chrono::nanoseconds;
+using std::chrono::steady_clock;
+
+namespace safeheron{
+namespace mpc_flow{
+namespace mpc_parallel_v2{
+
+namespace {
+
+// Upper bounds of the histogram buckets, in seconds
+const double BUCKET_BOUND_ARR[] = {0.00001, 0.0001, 0.0005, 0.001, 0.005, 0.01, 0.05, 0.1, 0.5, 1, 5};
+const size_t BUCKET_COUNT = sizeof(BUCKET_BOUND_ARR) / sizeof(BUCKET_BOUND_ARR[0]);
+
+thread_local const StageTimer *current_timer = nullptr;
+
+const std::string EMPTY_PARTY_ID;
+
+std::string EscapeLabel(const std::string &value) {
+    std::string out;
+    out.reserve(value.size());
+    for (char ch : value) {
+        if (ch == '\\' || ch == '"') out.push_back('\\');
+        if (ch == '\n') {
+            out.append("\\n");
+            continue;
+        }
+        out.push_back(ch);
+    }
+    return out;
+}
+
+std::string FormatDouble(double value) {
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%.9g", value);
+    return buf;
+}
+
+}
+
+const char *StageName(Stage stage) {
+    switch (stage) {
+        case Stage::ParseMsg: return "parse_msg";
+        case Stage::ReceiveVerify: return "receive_verify";
+        case Stage::ComputeVerify: return "compute_verify";
+        case Stage::MakeMessage: return "make_message";
+        case Stage::Serialization: return "serialization";
+    }
+    return "unknown";
+}
+
+StageTimer::StageTimer(InstrumentationSink *sink, int round, Stage stage, const std::string &party_id)
+        : sink_(sink), round_(round), stage_(stage), party_id_(&party_id), prev_(nullptr) {
+    if (!sink_) return;
+    prev_ = current_timer;
+    current_timer = this;
+    begin_ = steady_clock::now();
+}
+
+StageTimer::~StageTimer() {
+    if (!sink_) return;
+    nanoseconds elapsed = std::chrono::duration_cast<nanoseconds>(steady_clock::now() - begin_);
+    current_timer = prev_;
+    sink_->OnStage(round_, stage_, *party_id_, elapsed);
+}
+
+const StageTimer *StageTimer::current() {
+    return current_timer;
+}
+
+SerializationTimer::SerializationTimer(InstrumentationSink *sink): sink_(sink) {
+    if (sink_) begin_ = steady_clock::now();
+}
+
+SerializationTimer::~SerializationTimer() {
+    if (!sink_) return;
+    nanoseconds elapsed = std::chrono::duration_cast<nanoseconds>(steady_clock::now() - begin_);
+    const StageTimer *timer = StageTimer::current();
+    if (timer) {
+        sink_->OnStage(timer->round(), Stage::Serialization, timer->party_id(), elapsed);
+    } else {
+        sink_->OnStage(-1, Stage::Serialization, EMPTY_PARTY_ID, elapsed);
+    }
+}
+
+bool MetricsSink::StageKey::operator<(const StageKey &other) const {
+    return std::tie(round_, stage_, party_id_) < std::tie(other.round_, other.stage_, other.party_id_);
+}
+
+bool MetricsSink::BytesKey::operator<(const BytesKey &other) const {
+    return std::tie(round_, party_id_, inbound_) < std::tie(other.round_, other.party_id_, other.inbound_);
+}
+
+MetricsSink::MetricsSink(const std::string &protocol): protocol_(protocol) {
+}
+
+void MetricsSink::OnStage(int round, Stage stage, const std::string &party_id, nanoseconds elapsed) {
+    double seconds = std::chrono::duration<double>(elapsed).count();
+    size_t bucket = 0;
+    while (bucket < BUCKET_COUNT && seconds > BUCKET_BOUND_ARR[bucket]) ++bucket;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    Histogram &histogram = histogram_map_[StageKey{round, stage, party_id}];
+    if (histogram.bucket_arr_.empty()) {
+        histogram.bucket_arr_.resize(BUCKET_COUNT + 1, 0);
+        histogram.count_ = 0;
+        histogram.sum_ = nanoseconds(0);
+    }
+    histogram.bucket_arr_[bucket]++;
+    histogram.count_++;
+    histogram.sum_ += elapsed;
+}
+
+void MetricsSink::OnBytesIn(int round, const std::string &party_id, size_t bytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    bytes_map_[BytesKey{round, party_id, true}] += bytes;
+}
+
+void MetricsSink::OnBytesOut(int round, const std::string &party_id, size_t bytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    bytes_map_[BytesKey{round, party_id, false}] += bytes;
+}
+
+std::string MetricsSink::ToPrometheusText() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::string out;
+    std::string protocol = EscapeLabel(protocol_);
+
+    out.append("# HELP mpc_stage_duration_seconds Time spent in a stage of a round.\n");
+    out.append("# TYPE mpc_stage_duration_seconds histogram\n");
+    for (const auto &item : histogram_map_) {
+        std::string labels = "protocol=\"" + protocol + "\",round=\"" + std::to_string(item.first.round_) +
+                             "\",stage=\"" + StageName(item.first.stage_) +
+                             "\",peer=\"" + EscapeLabel(item.first.party_id_) + "\"";
+        const Histogram &histogram = item.second;
+        uint64_t cumulative = 0;
+        for (size_t i = 0; i <= BUCKET_COUNT; ++i) {
+            cumulative += histogram.bucket_arr_[i];
+            std::string le = i < BUCKET_COUNT ? FormatDouble(BUCKET_BOUND_ARR[i]) : "+Inf";
+            out.append("mpc_stage_duration_seconds_bucket{" + labels + ",le=\"" + le + "\"} " +
+                       std::to_string(cumulative) + "\n");
+        }
+        out.append("mpc_stage_duration_seconds_sum{" + labels + "} " +
+                   FormatDouble(std::chrono::duration<double>(histogram.sum_).count()) + "\n");
+        out.append("mpc_stage_duration_seconds_count{" + labels + "} " + std::to_string(histogram.count_) + "\n");
+    }
+
+    out.append("# HELP mpc_message_bytes_total Size of the messages exchanged, by the round they were sent in.\n");
+    out.append("# TYPE mpc_message_bytes_total counter\n");
+    for (const auto &item : bytes_map_) {
+        out.append("mpc_message_bytes_total{protocol=\"" + protocol + "\",round=\"" + std::to_string(item.first.round_) +
+                   "\",peer=\"" + EscapeLabel(item.first.party_id_) +
+                   "\",direction=\"" + (item.first.inbound_ ? "in" : "out") + "\"} " +
+                   std::to_string(item.second) + "\n");
+    }
+    return out;
+}
+
+void MetricsSink::GetStage(int round, Stage stage, uint64_t &out_count, nanoseconds &out_total) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    out_count = 0;
+    out_total = nanoseconds(0);
+    for (const auto &item : histogram_map_) {
+        if (item.first.round_ != round || item.first.stage_ != stage) continue;
+        out_count += item.second.count_;
+        out_total += item.second.sum_;
+    }
+}
+
+uint64_t MetricsSink::GetBytes(int round, bool inbound) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    uint64_t total = 0;
+    for (const auto &item : bytes_map_) {
+        if (item.first.round_ == round && item.first.inbound_ == inbound) total += item.second;
+    }
+    return total;
+}
+
+void MetricsSink::Reset() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    histogram_map_.clear();
+    bytes_map_.clear();
+}
+
+}
+}
+}
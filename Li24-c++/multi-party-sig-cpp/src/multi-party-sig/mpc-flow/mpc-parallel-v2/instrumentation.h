@@ -0,0 +1,168 @@
+#ifndef SAFEHERON_MPC_FLOW_MPC_PARALLEL_V2_INSTRUMENTATION_H
+#define SAFEHERON_MPC_FLOW_MPC_PARALLEL_V2_INSTRUMENTATION_H
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace safeheron{
+namespace mpc_flow{
+namespace mpc_parallel_v2{
+
+/**
+ * Steps of a round which are timed. Serialization is the encoding and decoding of the messages, which happens
+ * inside ParseMsg and MakeMessage, so its time is counted in those stages as well.
+ */
+enum class Stage : std::uint8_t {
+    ParseMsg = 0,
+    ReceiveVerify = 1,
+    ComputeVerify = 2,
+    MakeMessage = 3,
+    Serialization = 4,
+};
+
+const char *StageName(Stage stage);
+
+/**
+ * Receives the measurements of the contexts it is set on. Implement it to plug in the metrics of the application.
+ *
+ * ReceiveVerify may run on the executor of the context, so the methods may be called from several threads at the
+ * same time.
+ */
+class InstrumentationSink {
+public:
+    virtual ~InstrumentationSink() = default;
+
+    /**
+     * @param party_id the peer whose message the stage worked on, empty for ComputeVerify and MakeMessage.
+     */
+    virtual void OnStage(int round, Stage stage, const std::string &party_id, std::chrono::nanoseconds elapsed) = 0;
+
+    /**
+     * Size of a message received from party_id, sent by it in round 'round'.
+     */
+    virtual void OnBytesIn(int round, const std::string &party_id, size_t bytes) = 0;
+
+    /**
+     * Size of a message sent to party_id in round 'round'.
+     */
+    virtual void OnBytesOut(int round, const std::string &party_id, size_t bytes) = 0;
+};
+
+/**
+ * Times a stage of a round for the sink, does nothing without a sink. While it is alive, the serialization done
+ * by the same thread is reported with its round and peer.
+ */
+class StageTimer {
+public:
+    StageTimer(InstrumentationSink *sink, int round, Stage stage, const std::string &party_id);
+
+    ~StageTimer();
+
+    StageTimer(const StageTimer &) = delete;
+
+    StageTimer &operator=(const StageTimer &) = delete;
+
+    /**
+     * Innermost timer alive in the calling thread, nullptr if none.
+     */
+    static const StageTimer *current();
+
+    int round() const { return round_; }
+
+    const std::string &party_id() const { return *party_id_; }
+
+private:
+    InstrumentationSink *sink_;
+    int round_;
+    Stage stage_;
+    const std::string *party_id_;
+    std::chrono::steady_clock::time_point begin_;
+    const StageTimer *prev_;
+};
+
+/**
+ * Times the encoding or decoding of a message, reported under the stage the calling thread is in.
+ */
+class SerializationTimer {
+public:
+    explicit SerializationTimer(InstrumentationSink *sink);
+
+    ~SerializationTimer();
+
+    SerializationTimer(const SerializationTimer &) = delete;
+
+    SerializationTimer &operator=(const SerializationTimer &) = delete;
+
+private:
+    InstrumentationSink *sink_;
+    std::chrono::steady_clock::time_point begin_;
+};
+
+/**
+ * Sink which aggregates the measurements into histograms and counters, dumped in the Prometheus text format:
+ *  - mpc_stage_duration_seconds{protocol, round, stage, peer}, a histogram
+ *  - mpc_message_bytes_total{protocol, round, peer, direction}, a counter
+ *
+ * Round indexes only make sense within a protocol, so use one sink per protocol. Thread safe.
+ */
+class MetricsSink : public InstrumentationSink {
+public:
+    explicit MetricsSink(const std::string &protocol);
+
+    void OnStage(int round, Stage stage, const std::string &party_id, std::chrono::nanoseconds elapsed) override;
+
+    void OnBytesIn(int round, const std::string &party_id, size_t bytes) override;
+
+    void OnBytesOut(int round, const std::string &party_id, size_t bytes) override;
+
+    std::string ToPrometheusText() const;
+
+    /**
+     * Number of samples and total time of a stage, summed over the peers.
+     */
+    void GetStage(int round, Stage stage, uint64_t &out_count, std::chrono::nanoseconds &out_total) const;
+
+    uint64_t GetBytes(int round, bool inbound) const;
+
+    void Reset();
+
+private:
+    struct StageKey {
+        int round_;
+        Stage stage_;
+        std::string party_id_;
+
+        bool operator<(const StageKey &other) const;
+    };
+
+    struct Histogram {
+        // One counter per bucket of BUCKET_BOUND_ARR, plus +Inf
+        std::vector<uint64_t> bucket_arr_;
+        uint64_t count_;
+        std::chrono::nanoseconds sum_;
+    };
+
+    struct BytesKey {
+        int round_;
+        std::string party_id_;
+        bool inbound_;
+
+        bool operator<(const BytesKey &other) const;
+    };
+
+private:
+    std::string protocol_;
+    mutable std::mutex mutex_;
+    std::map<StageKey, Histogram> histogram_map_;
+    std::map<BytesKey, uint64_t> bytes_map_;
+};
+
+}
+}
+}
+
+#endif //SAFEHERON_MPC_FLOW_MPC_PARALLEL_V2_INSTRUMENTATION_H
@@ -0,0 +1,80 @@
+#include <thread>
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/local_transport.h"
+
+namespace safeheron{
+namespace mpc_flow{
+namespace mpc_parallel_v2{
+
+// Number of failed attempts before the waiting thread starts yielding its time slice
+static const int SPIN_LIMIT = 64;
+
+static void Backoff(int &attempt) {
+    if (attempt < SPIN_LIMIT) {
+        ++attempt;
+    } else {
+        std::this_thread::yield();
+    }
+}
+
+LocalTransport::LocalTransport(const std::vector<std::string> &party_id_arr, size_t inbox_capacity)
+        : party_id_arr_(party_id_arr), closed_(false) {
+    for (size_t i = 0; i < party_id_arr_.size(); ++i) {
+        party_index_map_[party_id_arr_[i]] = i;
+        endpoint_arr_.emplace_back(new Endpoint(inbox_capacity));
+    }
+}
+
+bool LocalTransport::IndexOf(const std::string &party_id, size_t &index) const {
+    auto iter = party_index_map_.find(party_id);
+    if (iter == party_index_map_.end()) return false;
+    index = iter->second;
+    return true;
+}
+
+bool LocalTransport::Send(size_t dst, LocalMessage &&msg) {
+    if (dst >= endpoint_arr_.size()) return false;
+    MpscRing<LocalMessage> &inbox = endpoint_arr_[dst]->inbox_;
+    int attempt = 0;
+    while (!inbox.TryPush(std::move(msg))) {
+        if (closed()) return false;
+        Backoff(attempt);
+    }
+    return true;
+}
+
+bool LocalTransport::Receive(size_t dst, int round, LocalMessage &msg) {
+    if (dst >= endpoint_arr_.size() || round < 0) return false;
+    Endpoint &endpoint = *endpoint_arr_[dst];
+
+    auto iter = endpoint.stash_map_.find(round);
+    if (iter != endpoint.stash_map_.end()) {
+        msg = std::move(iter->second.front());
+        iter->second.pop_front();
+        if (iter->second.empty()) endpoint.stash_map_.erase(iter);
+        return true;
+    }
+
+    int attempt = 0;
+    LocalMessage popped;
+    for (;;) {
+        if (endpoint.inbox_.TryPop(popped)) {
+            if (popped.round_ == round) {
+                msg = std::move(popped);
+                return true;
+            }
+            // Early message of a later round (a message of an earlier round is a bug of the caller: drop it)
+            if (popped.round_ > round) {
+                int popped_round = popped.round_;
+                endpoint.stash_map_[popped_round].push_back(std::move(popped));
+            }
+            attempt = 0;
+            continue;
+        }
+        if (closed()) return false;
+        Backoff(attempt);
+    }
+}
+
+}
+}
+}
@@ -0,0 +1,109 @@
+#ifndef SAFEHERON_MPC_FLOW_MPC_PARALLEL_V2_LOCAL_TRANSPORT_H
+#define SAFEHERON_MPC_FLOW_MPC_PARALLEL_V2_LOCAL_TRANSPORT_H
+
+#include <atomic>
+#include <deque>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/lockfree_ring.h"
+
+namespace safeheron{
+namespace mpc_flow{
+namespace mpc_parallel_v2{
+
+/**
+ * A message of one round, as popped from an MPCContext. Move-only, so that the payloads are never copied on the way.
+ */
+class LocalMessage {
+public:
+    LocalMessage(): src_(0), round_(0) {}
+
+    LocalMessage(size_t src, int round, std::string p2p_msg, std::string bc_msg)
+            : src_(src), round_(round), p2p_msg_(std::move(p2p_msg)), bc_msg_(std::move(bc_msg)) {}
+
+    LocalMessage(LocalMessage &&) = default;
+
+    LocalMessage &operator=(LocalMessage &&) = default;
+
+    LocalMessage(const LocalMessage &) = delete;
+
+    LocalMessage &operator=(const LocalMessage &) = delete;
+
+public:
+    // Index of the sending party in the transport
+    size_t src_;
+    int round_;
+    std::string p2p_msg_;
+    std::string bc_msg_;
+};
+
+/**
+ * In-process transport between parties hosted by the same process, e.g. all the co-signers of an HSM.
+ *
+ * Parties are addressed by their index in the party id array given to the constructor. Every party owns a bounded
+ * lock-free inbox that all the other parties push into. Messages of a later round may overtake the ones of the
+ * current round, so Receive() keeps them aside, in a per-round stash which only the receiving thread touches.
+ *
+ * Send() and Receive() never take a lock: they spin, then yield, while the inbox is full or empty.
+ * Close() releases all the waiting threads, e.g. once a party has failed.
+ */
+class LocalTransport {
+public:
+    /**
+     * @param party_id_arr ids of all the parties, the index of an id is the address of the party.
+     * @param inbox_capacity maximum number of messages waiting in the inbox of a party.
+     */
+    LocalTransport(const std::vector<std::string> &party_id_arr, size_t inbox_capacity);
+
+    LocalTransport(const LocalTransport &) = delete;
+
+    LocalTransport &operator=(const LocalTransport &) = delete;
+
+    size_t n_parties() const { return party_id_arr_.size(); }
+
+    const std::string &party_id(size_t index) const { return party_id_arr_[index]; }
+
+    /**
+     * Look up the index of a party. Resolve the ids once and keep the indexes: the lookup is not free.
+     */
+    bool IndexOf(const std::string &party_id, size_t &index) const;
+
+    /**
+     * Push a message into the inbox of party 'dst', waiting while it is full.
+     * @return false if the transport is closed, or if 'dst' is out of range.
+     */
+    bool Send(size_t dst, LocalMessage &&msg);
+
+    /**
+     * Pop the next message of round 'round' addressed to party 'dst', waiting until there is one.
+     * Must only be called by the thread of party 'dst'.
+     * @return false if the transport was closed before such a message arrived.
+     */
+    bool Receive(size_t dst, int round, LocalMessage &msg);
+
+    void Close() { closed_.store(true, std::memory_order_release); }
+
+    bool closed() const { return closed_.load(std::memory_order_acquire); }
+
+private:
+    struct Endpoint {
+        explicit Endpoint(size_t inbox_capacity): inbox_(inbox_capacity) {}
+
+        MpscRing<LocalMessage> inbox_;
+        // Messages popped ahead of their round, keyed by round
+        std::map<int, std::deque<LocalMessage>> stash_map_;
+    };
+
+    std::vector<std::string> party_id_arr_;
+    std::map<std::string, size_t> party_index_map_;
+    std::vector<std::unique_ptr<Endpoint>> endpoint_arr_;
+    std::atomic<bool> closed_;
+};
+
+}
+}
+}
+
+#endif //SAFEHERON_MPC_FLOW_MPC_PARALLEL_V2_LOCAL_TRANSPORT_H
@@ -0,0 +1,162 @@
+#ifndef SAFEHERON_MPC_FLOW_MPC_PARALLEL_V2_LOCKFREE_RING_H
+#define SAFEHERON_MPC_FLOW_MPC_PARALLEL_V2_LOCKFREE_RING_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace safeheron{
+namespace mpc_flow{
+namespace mpc_parallel_v2{
+
+// Keeps the indexes written by different threads on different cache lines
+#define SAFEHERON_CACHE_LINE_SIZE 64
+
+inline size_t RoundUpToPowerOfTwo(size_t n) {
+    size_t power = 1;
+    while (power < n) power <<= 1;
+    return power;
+}
+
+/**
+ * Bounded lock-free ring for exactly one producer thread and one consumer thread.
+ * T must be default constructible and movable. The capacity is rounded up to a power of two.
+ */
+template <typename T>
+class SpscRing {
+public:
+    explicit SpscRing(size_t capacity)
+            : slot_arr_(RoundUpToPowerOfTwo(capacity == 0 ? 1 : capacity)),
+              mask_(slot_arr_.size() - 1),
+              head_(0), tail_cache_(0), tail_(0), head_cache_(0) {}
+
+    SpscRing(const SpscRing &) = delete;
+
+    SpscRing &operator=(const SpscRing &) = delete;
+
+    /**
+     * Producer side. On failure (the ring is full) the value is left untouched.
+     */
+    bool TryPush(T &&value) {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_cache_ == slot_arr_.size()) {
+            head_cache_ = head_.load(std::memory_order_acquire);
+            if (tail - head_cache_ == slot_arr_.size()) return false;
+        }
+        slot_arr_[tail & mask_] = std::move(value);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Consumer side. Returns false if the ring is empty.
+     */
+    bool TryPop(T &value) {
+        size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_cache_) {
+            tail_cache_ = tail_.load(std::memory_order_acquire);
+            if (head == tail_cache_) return false;
+        }
+        value = std::move(slot_arr_[head & mask_]);
+        // Release the memory held by the slot now rather than when it is overwritten
+        slot_arr_[head & mask_] = T();
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    size_t capacity() const { return slot_arr_.size(); }
+
+private:
+    std::vector<T> slot_arr_;
+    const size_t mask_;
+    // Written by the consumer
+    alignas(SAFEHERON_CACHE_LINE_SIZE) std::atomic<size_t> head_;
+    size_t tail_cache_;
+    // Written by the producer
+    alignas(SAFEHERON_CACHE_LINE_SIZE) std::atomic<size_t> tail_;
+    size_t head_cache_;
+};
+
+/**
+ * Bounded lock-free ring for any number of producer threads and one consumer thread.
+ * Every slot carries a sequence number telling whose turn it is, so producers only contend on the tail index.
+ * T must be default constructible and movable. The capacity is rounded up to a power of two.
+ */
+template <typename T>
+class MpscRing {
+public:
+    explicit MpscRing(size_t capacity)
+            : capacity_(RoundUpToPowerOfTwo(capacity < 2 ? 2 : capacity)),
+              mask_(capacity_ - 1),
+              cell_arr_(new Cell[capacity_]),
+              head_(0), tail_(0) {
+        for (size_t i = 0; i < capacity_; ++i) {
+            cell_arr_[i].seq_.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpscRing(const MpscRing &) = delete;
+
+    MpscRing &operator=(const MpscRing &) = delete;
+
+    /**
+     * Producer side, may be called from any thread. On failure (the ring is full) the value is left untouched.
+     */
+    bool TryPush(T &&value) {
+        Cell *cell;
+        size_t pos = tail_.load(std::memory_order_relaxed);
+        for (;;) {
+            cell = &cell_arr_[pos & mask_];
+            size_t seq = cell->seq_.load(std::memory_order_acquire);
+            intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+            if (diff == 0) {
+                if (tail_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = tail_.load(std::memory_order_relaxed);
+            }
+        }
+        cell->value_ = std::move(value);
+        cell->seq_.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Consumer side. Returns false if the ring is empty, or if the next producer has not finished writing yet.
+     */
+    bool TryPop(T &value) {
+        Cell *cell = &cell_arr_[head_ & mask_];
+        size_t seq = cell->seq_.load(std::memory_order_acquire);
+        if (seq != head_ + 1) return false;
+        value = std::move(cell->value_);
+        cell->value_ = T();
+        cell->seq_.store(head_ + capacity_, std::memory_order_release);
+        ++head_;
+        return true;
+    }
+
+    size_t capacity() const { return capacity_; }
+
+private:
+    struct Cell {
+        std::atomic<size_t> seq_;
+        T value_;
+    };
+
+    const size_t capacity_;
+    const size_t mask_;
+    std::unique_ptr<Cell[]> cell_arr_;
+    // Only touched by the consumer
+    alignas(SAFEHERON_CACHE_LINE_SIZE) size_t head_;
+    alignas(SAFEHERON_CACHE_LINE_SIZE) std::atomic<size_t> tail_;
+};
+
+}
+}
+}
+
+#endif //SAFEHERON_MPC_FLOW_MPC_PARALLEL_V2_LOCKFREE_RING_H
@@ -16,6 +16,20 @@ enum MessageType : std::uint8_t {
     P2P = 1,
     BROADCAST = 2,
     P2P_BROADCAST = 3,
+    // Flag on top of P2P: a P2P message may be empty when the sender has no payload for the destination.
+    SPARSE = 4,
+    SPARSE_P2P = 5,
+    SPARSE_P2P_BROADCAST = 7,
+};
+
+/**
+ * Encoding of the messages passed to PushMessage and returned by PopMessages.
+ * - Base64: base64 of the serialized protobuf object, the default.
+ * - Binary: the serialized protobuf object itself, without the base64 overhead and copies.
+ */
+enum class MessageEncoding : std::uint8_t {
+    Base64 = 0,
+    Binary = 1,
 };
 
 }
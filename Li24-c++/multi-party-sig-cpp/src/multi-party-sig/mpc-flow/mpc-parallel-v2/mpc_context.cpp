@@ -12,6 +12,34 @@ namespace safeheron{
 namespace mpc_flow{
 namespace mpc_parallel_v2{
 
+MPCContext::MPCContext(const MPCContext &ctx) {
+    error_info_stack_ = ctx.error_info_stack_;
+    total_parties_ = ctx.total_parties_;
+    current_round_ = ctx.current_round_;
+    round_arr_ = ctx.round_arr_;
+    executor_ = ctx.executor_;
+    message_encoding_ = ctx.message_encoding_;
+    parked_msg_map_ = ctx.parked_msg_map_;
+    parked_bytes_ = ctx.parked_bytes_;
+    instrumentation_sink_ = ctx.instrumentation_sink_;
+}
+
+MPCContext &MPCContext::operator=(const MPCContext &ctx) {
+    if (this == &ctx) {
+        return *this;
+    }
+    error_info_stack_ = ctx.error_info_stack_;
+    total_parties_ = ctx.total_parties_;
+    current_round_ = ctx.current_round_;
+    round_arr_ = ctx.round_arr_;
+    executor_ = ctx.executor_;
+    message_encoding_ = ctx.message_encoding_;
+    parked_msg_map_ = ctx.parked_msg_map_;
+    parked_bytes_ = ctx.parked_bytes_;
+    instrumentation_sink_ = ctx.instrumentation_sink_;
+    return *this;
+}
+
 void MPCContext::RemoveAllRounds() {
     round_arr_.clear();
 }
@@ -29,7 +57,42 @@ void MPCContext::AddRound(MPCRound *round) {
 
 bool MPCContext::PushMessage(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id, int round_index_of_message) {
     assert(IsOK() && !IsFinished());
-    if (IsCurRoundFinished()) current_round_++;
+    // A message is tagged with the round which sent it. The last round sends nothing, so only rounds before it are
+    // parked; any other round index goes through to InternalPushMessage, which rejects it
+    if (round_index_of_message > get_inbound_round() && round_index_of_message < get_total_rounds() - 1) {
+        if (!IsRemoteParty(party_id)) {
+            PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Message from unknown party " + party_id + "!");
+            return false;
+        }
+        auto iter = parked_msg_map_.find(round_index_of_message);
+        if (iter != parked_msg_map_.end()) {
+            for (const auto &parked : iter->second) {
+                if (parked.party_id_ == party_id) {
+                    PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Duplicate message from party " + party_id + "!");
+                    return false;
+                }
+            }
+            if (iter->second.size() >= (size_t)(total_parties_ - 1)) {
+                PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Too many messages parked for round " + std::to_string(round_index_of_message) + "!");
+                return false;
+            }
+        }
+        parked_bytes_ += p2p_msg.size() + bc_msg.size();
+        parked_msg_map_[round_index_of_message].push_back(ParkedMessage{p2p_msg, bc_msg, party_id});
+        return true;
+    }
+    if (IsCurRoundFinished()) {
+        if (!AdvanceRound()) return false;
+        if (IsCurRoundFinished()) {
+            // The parked messages completed the round already
+            PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Message from party " + party_id + " to a round which is over!");
+            return false;
+        }
+    }
+    return InternalPushMessage(p2p_msg, bc_msg, party_id, round_index_of_message);
+}
+
+bool MPCContext::InternalPushMessage(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id, int round_index_of_message) {
     int error_code;
     std::string error_msg;
     bool ok = round_arr_[current_round_]->InternalPushMessage(p2p_msg, bc_msg, round_index_of_message, party_id, error_code, error_msg);
@@ -42,6 +105,26 @@ bool MPCContext::PushMessage(const std::string &p2p_msg, const std::string &bc_m
     return ok;
 }
 
+bool MPCContext::AdvanceRound() {
+    current_round_++;
+    auto iter = parked_msg_map_.find(current_round_ - 1);
+    if (iter == parked_msg_map_.end()) return true;
+    std::vector<ParkedMessage> parked_arr;
+    parked_arr.swap(iter->second);
+    parked_msg_map_.erase(iter);
+    for (const auto &parked : parked_arr) {
+        parked_bytes_ -= parked.p2p_msg_.size() + parked.bc_msg_.size();
+    }
+    for (const auto &parked : parked_arr) {
+        if (IsCurRoundFinished()) {
+            PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Message from party " + parked.party_id_ + " to a round which is over!");
+            return false;
+        }
+        if (!InternalPushMessage(parked.p2p_msg_, parked.bc_msg_, parked.party_id_, current_round_ - 1)) return false;
+    }
+    return true;
+}
+
 bool MPCContext::PushMessage() {
     assert(current_round_ == 0);
     int error_code;
@@ -66,23 +149,31 @@ bool MPCContext::PopMessages(std::vector<std::string> &out_msg_arr, std::string
         PushErrorCode(error_code, error_msg);
         // Error information from current context
         PushErrorCode(error_code, __FILE__, __LINE__, __FUNCTION__, "InternalPopMessages failed!");
+        return false;
+    }
+    // Messages parked for the next round are replayed right away, nothing else would push them
+    if (current_round_ < get_total_rounds() - 1 && parked_msg_map_.count(current_round_)) {
+        ok = AdvanceRound();
     }
     return ok;
 }
 
 int MPCContext::get_last_error_code() const {
+    std::lock_guard<std::mutex> lock(error_mutex_);
     if (error_info_stack_.empty()) return 0;
     size_t last = error_info_stack_.size() - 1;
     return error_info_stack_[last].code_;
 }
 
 const char * MPCContext::get_last_error_info() const {
+    std::lock_guard<std::mutex> lock(error_mutex_);
     if (error_info_stack_.empty()) return "";
     size_t last = error_info_stack_.size() - 1;
     return error_info_stack_[last].info_.c_str();
 }
 
 void MPCContext::get_error_stack(std::vector<ErrorInfo> &error_stack) const {
+    std::lock_guard<std::mutex> lock(error_mutex_);
     for(const auto &err:  error_info_stack_){
         error_stack.push_back(err);
     }
@@ -93,6 +184,7 @@ void MPCContext::PushErrorCode(int error_code, std::string error_info) {
     ErrorInfo error;
     error.code_ = error_code;
     error.info_ = std::move(error_info);
+    std::lock_guard<std::mutex> lock(error_mutex_);
     error_info_stack_.push_back(error);
 }
 
@@ -111,6 +203,7 @@ void MPCContext::PushErrorCode(int error_code, const std::string &file_name, int
     str.append(":");
     str.append(error_info);
     error.info_ = std::move(str);
+    std::lock_guard<std::mutex> lock(error_mutex_);
     error_info_stack_.push_back(error);
 }
 
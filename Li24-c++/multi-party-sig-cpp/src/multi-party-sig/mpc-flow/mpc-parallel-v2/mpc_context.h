@@ -5,12 +5,17 @@
 #ifndef SAFEHERON_MPC_FLOW_MPC_PARALLEL_V2_MPC_CONTEXT_H
 #define SAFEHERON_MPC_FLOW_MPC_PARALLEL_V2_MPC_CONTEXT_H
 
+#include <map>
 #include <string>
 #include <utility>
 #include <vector>
 #include <cassert>
 #include <iostream>
+#include <mutex>
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/message_type.h"
 #include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_round.h"
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/executor.h"
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/instrumentation.h"
 
 namespace safeheron{
 namespace mpc_flow{
@@ -29,10 +34,26 @@ enum class Role : uint32_t {
 };
 
 class MPCContext {
+private:
+    // Protobuf type of a message class, deduced from its ToProtoObject(Proto &) const
+    template<class C, class P>
+    static P ProtoObjectOfMethod(bool (C::*)(P &) const);
+
+    template<class T>
+    struct ProtoObjectOf {
+        typedef decltype(ProtoObjectOfMethod(&T::ToProtoObject)) type;
+    };
+
 public:
-    MPCContext(int total_parties): total_parties_(total_parties), current_round_(0) {};
+    MPCContext(int total_parties): total_parties_(total_parties), current_round_(0), executor_(nullptr),
+                                   message_encoding_(MessageEncoding::Base64), parked_bytes_(0),
+                                   instrumentation_sink_(nullptr) {};
     virtual ~MPCContext() = default;;
 
+    MPCContext(const MPCContext &ctx);
+
+    MPCContext &operator=(const MPCContext &ctx);
+
 private:
     void set_total_parties(int total) { total_parties_ = total; }
 
@@ -41,10 +62,20 @@ public:
 
     void AddRound(MPCRound *round);
 
+    /**
+     * Push a message sent in round round_index_of_message. A message of a later round than the one accepted now
+     * is parked in the context and replayed once the context gets there, so the transport may deliver messages
+     * as soon as they arrive. Only one message per remote party and round is parked, see IsRemoteParty().
+     */
     bool PushMessage(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id, int round_index_of_message);
 
     bool PushMessage();
 
+    /**
+     * Pop the outgoing messages of the current round. If messages of the next round were parked, the context then
+     * moves on to the next round and replays them, which may finish it as well: check IsCurRoundFinished() again
+     * after PopMessages.
+     */
     bool PopMessages(std::vector<std::string> &out_p2p_msg_arr, std::string &out_broadcast_msg, std::vector<std::string> &out_des_arr);
 
     int get_total_parties() const { return total_parties_; }
@@ -53,18 +84,87 @@ public:
 
     int get_total_rounds() const { return round_arr_.size(); }
 
+    /**
+     * Round of the messages the context accepts now, -1 before round 0 is over.
+     */
+    int get_inbound_round() const { return IsCurRoundFinished() ? current_round_ : current_round_ - 1; }
+
+    /**
+     * Size of the messages parked for a later round.
+     */
+    size_t get_parked_bytes() const { return parked_bytes_; }
+
     int IsOK() const { return get_last_error_code() == 0; }
 
     int IsCurRoundFinished() const { return round_arr_[current_round_]->IsOver(); }
 
     int IsFinished() const { return (current_round_ == get_total_rounds() - 1) && IsCurRoundFinished(); }
 
+    /**
+     * Set an executor to run ReceiveVerify of the messages of a round concurrently, nullptr to run them in
+     * the calling thread. The executor is not owned and must outlive the context.
+     *
+     * With an executor, PushMessage returns once ParseMsg is done; ReceiveVerify runs in the background and
+     * the push of the last message of the round waits for all of them before ComputeVerify. ReceiveVerify
+     * may then only write the state of the sending party.
+     */
+    void set_executor(Executor *executor) { executor_ = executor; }
+
+    Executor *get_executor() const { return executor_; }
+
+    /**
+     * Set the encoding of the messages exchanged through PushMessage and PopMessages. All the parties of a session
+     * must use the same encoding.
+     */
+    void set_message_encoding(MessageEncoding encoding) { message_encoding_ = encoding; }
+
+    MessageEncoding get_message_encoding() const { return message_encoding_; }
+
+    /**
+     * Set a sink to receive the time spent in each stage of every round and the size of the messages, nullptr
+     * (the default) to measure nothing. The sink is not owned and must outlive the context.
+     */
+    void set_instrumentation_sink(InstrumentationSink *sink) { instrumentation_sink_ = sink; }
+
+    InstrumentationSink *get_instrumentation_sink() const { return instrumentation_sink_; }
+
+    /**
+     * Encode a round message according to the message encoding of the context.
+     */
+    template<class T>
+    bool EncodeMessage(const T &message, std::string &out) const {
+        SerializationTimer timer(instrumentation_sink_);
+        if (message_encoding_ == MessageEncoding::Base64) return message.ToBase64(out);
+        typename ProtoObjectOf<T>::type proto_object;
+        if (!message.ToProtoObject(proto_object)) return false;
+        out.clear();
+        return proto_object.SerializeToString(&out);
+    }
+
+    /**
+     * Decode a round message according to the message encoding of the context.
+     */
+    template<class T>
+    bool DecodeMessage(const std::string &in, T &message) const {
+        SerializationTimer timer(instrumentation_sink_);
+        if (message_encoding_ == MessageEncoding::Base64) return message.FromBase64(in);
+        typename ProtoObjectOf<T>::type proto_object;
+        if (!proto_object.ParseFromString(in)) return false;
+        return message.FromProtoObject(proto_object);
+    }
+
     int get_last_error_code() const;
 
     const char *get_last_error_info() const;
 
     void get_error_stack(std::vector<ErrorInfo> &error_stack) const;
 
+    /**
+     * Whether party_id is a remote party of the context. A message parked for a later round must come from one of
+     * them. Contexts which know their remote parties override it, the default accepts any party.
+     */
+    virtual bool IsRemoteParty(const std::string &party_id) const { return true; }
+
     // Add virtual for embedded context
     virtual void PushErrorCode(int error_code, std::string error_info);
 
@@ -73,6 +173,18 @@ public:
                        const std::string &error_info);
 
 
+private:
+    struct ParkedMessage {
+        std::string p2p_msg_;
+        std::string bc_msg_;
+        std::string party_id_;
+    };
+
+    // Move on to the next round and replay the messages parked for it
+    bool AdvanceRound();
+
+    bool InternalPushMessage(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id, int round_index_of_message);
+
 private:
     // If there is some thing wrong in the round, information of the error will be show by '_error'
     std::vector<ErrorInfo> error_info_stack_;
@@ -80,6 +192,16 @@ private:
     int total_parties_;
     int current_round_;
     std::vector<MPCRound *> round_arr_;
+    // Optional executor for ReceiveVerify
+    Executor *executor_;
+    MessageEncoding message_encoding_;
+    // Messages ahead of the inbound round, keyed by the round they were sent in, at most one per remote party
+    std::map<int, std::vector<ParkedMessage>> parked_msg_map_;
+    size_t parked_bytes_;
+    // Optional sink of the measurements
+    InstrumentationSink *instrumentation_sink_;
+    // Guards error_info_stack_, which concurrent ReceiveVerify calls may write
+    mutable std::mutex error_mutex_;
 };
 
 }
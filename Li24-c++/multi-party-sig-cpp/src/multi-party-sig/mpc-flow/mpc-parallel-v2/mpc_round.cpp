@@ -3,6 +3,7 @@
 //
 
 #include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_round.h"
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_context.h"
 #include <string>
 #include <vector>
 #include <cassert>
@@ -11,6 +12,11 @@
 #include "mutex"
 std::mutex mtx;
 
+namespace {
+// Peer of the stages which do not work on a message
+const std::string NO_PARTY_ID;
+}
+
 namespace safeheron{
 namespace mpc_flow{
 namespace mpc_parallel_v2{
@@ -32,13 +38,20 @@ std::string MPCRound::make_error_msg(int error_code_, const std::string &file_na
 bool MPCRound::InternalPushMessage(int &error_code, std::string &error_msg) {
     assert(round_index_ == 0);
     bool ok = true;
-    ok = ComputeVerify();
+    InstrumentationSink *sink = ctx_ ? ctx_->get_instrumentation_sink() : nullptr;
+    {
+        StageTimer timer(sink, round_index_, Stage::ComputeVerify, NO_PARTY_ID);
+        ok = ComputeVerify();
+    }
     if (!ok) {
         error_code = 1;
         error_msg = make_error_msg(1, __FILE__, __LINE__, __FUNCTION__, "ComputeVerify failed!");
         return false;
     }
-    ok = MakeMessage(out_p2p_message_arr_, out_broadcast_message_, out_des_arr_);
+    {
+        StageTimer timer(sink, round_index_, Stage::MakeMessage, NO_PARTY_ID);
+        ok = MakeMessage(out_p2p_message_arr_, out_broadcast_message_, out_des_arr_);
+    }
     if (!ok) {
         error_code = 1;
         error_msg = make_error_msg(1, __FILE__, __LINE__, __FUNCTION__, "MakeMessage failed!");
@@ -59,8 +72,11 @@ bool MPCRound::InternalPushMessage(const std::string &p2p_msg, const std::string
         return false;
     }
 
+    InstrumentationSink *sink = ctx_ ? ctx_->get_instrumentation_sink() : nullptr;
+    if (sink) sink->OnBytesIn(round_index, party_id, p2p_msg.size() + bc_msg.size());
+
     // Receive message
-    ok = !( (in_message_type_ & MessageType::P2P) &&  p2p_msg.empty() );
+    ok = !( (in_message_type_ & MessageType::P2P) && !(in_message_type_ & MessageType::SPARSE) && p2p_msg.empty() );
     if (!ok) {
         error_code = 1;
         error_msg = make_error_msg(1, __FILE__, __LINE__, __FUNCTION__, "Failed to check in_message_type_!: ok = (in_message_type_ & MessageType::P2P) && ( p2p_msg.size() != (size_t)(total_parties_ - 1) )");
@@ -72,29 +88,75 @@ bool MPCRound::InternalPushMessage(const std::string &p2p_msg, const std::string
         error_msg = make_error_msg(1, __FILE__, __LINE__, __FUNCTION__, "Failed to check in_message_type_!: ok = (in_message_type_ & MessageType::BROADCAST) &&  bc_msg.empty()");
         return false;
     }
-    ok = ParseMsg(p2p_msg, bc_msg, party_id);
+    // A duplicate would be parsed into the slot of its sender while a pending ReceiveVerify may still read it
+    ok = received_party_id_set_.insert(party_id).second;
     if (!ok) {
+        // Pending verifications may still read the round
+        receive_group_.Wait();
         error_code = 1;
-        error_msg = make_error_msg(1, __FILE__, __LINE__, __FUNCTION__, "ParseMsg failed!");
+        error_msg = make_error_msg(1, __FILE__, __LINE__, __FUNCTION__, "Duplicate message from party " + party_id + "!");
         return false;
     }
-    ok = ReceiveVerify(party_id);
+    {
+        StageTimer timer(sink, round_index_, Stage::ParseMsg, party_id);
+        ok = ParseMsg(p2p_msg, bc_msg, party_id);
+    }
     if (!ok) {
+        // Pending verifications may still read the round
+        receive_group_.Wait();
         error_code = 1;
-        error_msg = make_error_msg(1, __FILE__, __LINE__, __FUNCTION__, "ReceiveVerify failed!");
+        error_msg = make_error_msg(1, __FILE__, __LINE__, __FUNCTION__, "ParseMsg failed!");
         return false;
     }
+    Executor *executor = ctx_ ? ctx_->get_executor() : nullptr;
+    if (executor) {
+        // Each message gets its own slot, so the tasks never write the same memory
+        if (receive_ok_arr_.size() != (size_t)(total_parties_ - 1)) {
+            receive_party_id_arr_.resize(total_parties_ - 1);
+            receive_ok_arr_.resize(total_parties_ - 1);
+        }
+        size_t slot = msg_count_;
+        receive_party_id_arr_[slot] = party_id;
+        receive_ok_arr_[slot] = 0;
+        receive_group_.Run(executor, [this, slot, sink]() {
+            StageTimer timer(sink, round_index_, Stage::ReceiveVerify, receive_party_id_arr_[slot]);
+            // An exception fails the message, as the inline path would fail the call
+            try {
+                receive_ok_arr_[slot] = ReceiveVerify(receive_party_id_arr_[slot]) ? 1 : 0;
+            } catch (...) {
+                receive_ok_arr_[slot] = 0;
+            }
+        });
+    } else {
+        StageTimer timer(sink, round_index_, Stage::ReceiveVerify, party_id);
+        ok = ReceiveVerify(party_id);
+        if (!ok) {
+            error_code = 1;
+            error_msg = make_error_msg(1, __FILE__, __LINE__, __FUNCTION__, "ReceiveVerify failed!");
+            return false;
+        }
+    }
     msg_count_++;
 
     // If all messages were received.
     if (msg_count_ == total_parties_ - 1) {
-        ok = ComputeVerify();
+        if (executor) {
+            ok = WaitReceiveVerify(error_code, error_msg);
+            if (!ok) return false;
+        }
+        {
+            StageTimer timer(sink, round_index_, Stage::ComputeVerify, NO_PARTY_ID);
+            ok = ComputeVerify();
+        }
         if (!ok) {
             error_code = 1;
             error_msg = make_error_msg(1, __FILE__, __LINE__, __FUNCTION__, "ComputeVerify failed!");
             return false;
         }
-        ok = MakeMessage(out_p2p_message_arr_, out_broadcast_message_, out_des_arr_);
+        {
+            StageTimer timer(sink, round_index_, Stage::MakeMessage, NO_PARTY_ID);
+            ok = MakeMessage(out_p2p_message_arr_, out_broadcast_message_, out_des_arr_);
+        }
         if (!ok) {
             error_code = 1;
             error_msg = make_error_msg(1, __FILE__, __LINE__, __FUNCTION__, "MakeMessage failed!");
@@ -105,6 +167,18 @@ bool MPCRound::InternalPushMessage(const std::string &p2p_msg, const std::string
     return true;
 }
 
+bool MPCRound::WaitReceiveVerify(int &error_code, std::string &error_msg) {
+    receive_group_.Wait();
+    for (size_t i = 0; i < receive_ok_arr_.size(); ++i) {
+        if (!receive_ok_arr_[i]) {
+            error_code = 1;
+            error_msg = make_error_msg(1, __FILE__, __LINE__, __FUNCTION__, "ReceiveVerify failed for party " + receive_party_id_arr_[i] + "!");
+            return false;
+        }
+    }
+    return true;
+}
+
 bool MPCRound::InternalPopMessages(std::vector<std::string> &out_p2p_msg_arr, std::string &out_broadcast_msg, std::vector<std::string> &out_des_arr, int &error_code, std::string &error_msg) {
     bool ok = true;
     ok = !( (out_message_type_ & MessageType::P2P) && out_p2p_message_arr_.size() != (size_t)(total_parties_ - 1) );
@@ -119,6 +193,13 @@ bool MPCRound::InternalPopMessages(std::vector<std::string> &out_p2p_msg_arr, st
         error_msg = make_error_msg(1, __FILE__, __LINE__, __FUNCTION__, "Failed to check out_message_type_!: ok = (out_message_type_ & MessageType::BROADCAST) && out_broadcast_msg.empty()");
         return false;
     }
+    InstrumentationSink *sink = ctx_ ? ctx_->get_instrumentation_sink() : nullptr;
+    if (sink) {
+        for (size_t i = 0; i < out_des_arr_.size(); ++i) {
+            size_t bytes = out_broadcast_message_.size() + (i < out_p2p_message_arr_.size() ? out_p2p_message_arr_[i].size() : 0);
+            sink->OnBytesOut(round_index_, out_des_arr_[i], bytes);
+        }
+    }
     out_p2p_msg_arr.insert(out_p2p_msg_arr.begin(), out_p2p_message_arr_.begin(), out_p2p_message_arr_.end());
     out_broadcast_msg = out_broadcast_message_;
     out_des_arr.insert(out_des_arr.begin(), out_des_arr_.begin(), out_des_arr_.end());
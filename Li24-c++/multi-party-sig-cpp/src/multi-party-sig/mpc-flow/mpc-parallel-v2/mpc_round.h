@@ -7,10 +7,12 @@
 
 #include <string>
 #include <vector>
+#include <set>
 #include <cassert>
 
 #include "multi-party-sig/mpc-flow/mpc-parallel-v2/message_type.h"
 #include "multi-party-sig/mpc-flow/mpc-parallel-v2/error_info.h"
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/executor.h"
 
 namespace safeheron {
 namespace mpc_flow {
@@ -80,6 +82,9 @@ public:
     bool InternalPopMessages(std::vector<std::string> &out_p2p_msg_arr, std::string &out_broadcast_msg,
                              std::vector<std::string> &out_des_arr, int &error_code, std::string &error_msg);
 
+private:
+    bool WaitReceiveVerify(int &error_code, std::string &error_msg);
+
 private:
     MessageType in_message_type_;
     MessageType out_message_type_;
@@ -91,6 +96,8 @@ private:
     int round_index_;
     // Count the messages received
     int msg_count_;
+    // Parties whose message of this round was received, a second message of the same party is rejected
+    std::set<std::string> received_party_id_set_;
     // Current round was finished
     bool is_finished_;
 
@@ -101,11 +108,28 @@ private:
     std::string out_broadcast_message_;
     std::vector<std::string> out_des_arr_;
 
+    // ReceiveVerify running on the executor of the context, one slot per received message
+    TaskGroup receive_group_;
+    std::vector<std::string> receive_party_id_arr_;
+    std::vector<char> receive_ok_arr_;
+
     // Cache all messages received in the round
     // You should define inMessageCache for your own "Round"
     // std::vector<CustomObject> _inMessageCache;
 };
 
+/**
+ * Round of a protocol whose context type is Ctx. The rounds are bound to their context by Ctx::BindAllRounds(), so
+ * get_context() can return the typed context with a static_cast instead of a dynamic_cast on every call.
+ */
+template<class Ctx>
+class MPCRoundT : public MPCRound {
+public:
+    MPCRoundT(MessageType in_message_type, MessageType out_message_type): MPCRound(in_message_type, out_message_type) {}
+
+    Ctx *get_context() const { return static_cast<Ctx *>(get_mpc_context()); }
+};
+
 }
 }
 }
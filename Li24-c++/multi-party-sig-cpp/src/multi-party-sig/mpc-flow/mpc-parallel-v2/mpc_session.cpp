@@ -0,0 +1,58 @@
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_session.h"
+
+namespace safeheron{
+namespace mpc_flow{
+namespace mpc_parallel_v2{
+
+MPCSession::MPCSession(const std::string &session_id, std::unique_ptr<MPCContext> ctx)
+        : session_id_(session_id), ctx_(std::move(ctx)), status_(Status::Running) {
+}
+
+MPCSession::Status MPCSession::Start(const OutboundCallback &on_outbound) {
+    if (!ctx_->PushMessage()) {
+        status_ = Status::Failed;
+        return status_;
+    }
+    CompleteRounds(on_outbound);
+    return status_;
+}
+
+MPCSession::Status MPCSession::Deliver(Message msg, const OutboundCallback &on_outbound) {
+    if (status_ != Status::Running) return status_;
+    // A round that is over already, or no round at all (the last round has no incoming messages)
+    if (msg.round_ < ctx_->get_inbound_round() || msg.round_ > ctx_->get_total_rounds() - 2) return status_;
+    if (!ctx_->PushMessage(msg.p2p_msg_, msg.bc_msg_, msg.party_id_, msg.round_)) {
+        status_ = Status::Failed;
+        return status_;
+    }
+    CompleteRounds(on_outbound);
+    return status_;
+}
+
+void MPCSession::CompleteRounds(const OutboundCallback &on_outbound) {
+    // Popping a round replays the messages parked for the next one, which may finish it too
+    while (status_ == Status::Running && ctx_->IsCurRoundFinished()) {
+        std::vector<std::string> out_p2p_msg_arr;
+        std::string out_bc_msg;
+        std::vector<std::string> out_des_arr;
+        int round = ctx_->get_cur_round();
+        bool last_round = ctx_->IsFinished();
+        if (!ctx_->PopMessages(out_p2p_msg_arr, out_bc_msg, out_des_arr)) {
+            status_ = Status::Failed;
+            return;
+        }
+        if (!out_des_arr.empty() && on_outbound) {
+            on_outbound(session_id_, round, out_p2p_msg_arr, out_bc_msg, out_des_arr);
+        }
+        if (last_round) {
+            status_ = Status::Finished;
+            return;
+        }
+        // Nothing was parked for the next round, it starts with the next message
+        if (ctx_->get_cur_round() == round) return;
+    }
+}
+
+}
+}
+}
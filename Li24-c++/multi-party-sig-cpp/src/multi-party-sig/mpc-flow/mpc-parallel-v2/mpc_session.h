@@ -0,0 +1,84 @@
+#ifndef SAFEHERON_MPC_FLOW_MPC_PARALLEL_V2_MPC_SESSION_H
+#define SAFEHERON_MPC_FLOW_MPC_PARALLEL_V2_MPC_SESSION_H
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_context.h"
+
+namespace safeheron{
+namespace mpc_flow{
+namespace mpc_parallel_v2{
+
+/**
+ * Runs one MPCContext from messages which may come in any order: messages of a later round are parked in the
+ * context until it gets there, messages of a round that is over are dropped. Not thread safe, the owner serializes the calls.
+ */
+class MPCSession {
+public:
+    typedef std::function<void(const std::string &session_id,
+                               int round,
+                               const std::vector<std::string> &out_p2p_msg_arr,
+                               const std::string &out_bc_msg,
+                               const std::vector<std::string> &out_des_arr)> OutboundCallback;
+
+    enum class Status {
+        Running,
+        Finished,
+        Failed,
+    };
+
+    struct Message {
+        std::string party_id_;
+        int round_;
+        std::string p2p_msg_;
+        std::string bc_msg_;
+    };
+
+    MPCSession(const std::string &session_id, std::unique_ptr<MPCContext> ctx);
+
+    MPCSession(const MPCSession &) = delete;
+
+    MPCSession &operator=(const MPCSession &) = delete;
+
+    /**
+     * Run round 0. The outgoing messages of every round that is over are handed to on_outbound.
+     */
+    Status Start(const OutboundCallback &on_outbound);
+
+    Status Deliver(Message msg, const OutboundCallback &on_outbound);
+
+    Status status() const { return status_; }
+
+    const std::string &session_id() const { return session_id_; }
+
+    /**
+     * Round of the messages the context accepts now.
+     */
+    int inbound_round() const { return ctx_->get_inbound_round(); }
+
+    /**
+     * Size of the messages kept for a later round.
+     */
+    size_t pending_bytes() const { return ctx_->get_parked_bytes(); }
+
+    MPCContext *ctx() const { return ctx_.get(); }
+
+    std::unique_ptr<MPCContext> ReleaseContext() { return std::move(ctx_); }
+
+private:
+    // Pop the messages of the rounds which are over
+    void CompleteRounds(const OutboundCallback &on_outbound);
+
+private:
+    std::string session_id_;
+    std::unique_ptr<MPCContext> ctx_;
+    Status status_;
+};
+
+}
+}
+}
+
+#endif //SAFEHERON_MPC_FLOW_MPC_PARALLEL_V2_MPC_SESSION_H
@@ -0,0 +1,191 @@
+#include <algorithm>
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/session_driver.h"
+
+using std::chrono::steady_clock;
+
+namespace safeheron{
+namespace mpc_flow{
+namespace mpc_parallel_v2{
+
+// Messages kept for sessions which are not added yet, beyond that they are dropped
+static const size_t MAX_ORPHAN_MESSAGES = 1 << 16;
+
+SessionDriver::SessionDriver(OutboundCallback on_outbound, CompletionCallback on_completion,
+                             std::chrono::milliseconds retention)
+        : on_outbound_(std::move(on_outbound)),
+          on_completion_(std::move(on_completion)),
+          retention_(retention),
+          running_(false),
+          stop_(false),
+          orphan_count_(0) {
+}
+
+SessionDriver::~SessionDriver() {
+    Stop();
+}
+
+void SessionDriver::Start() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (running_) return;
+    stop_ = false;
+    running_ = true;
+    driver_ = std::thread(&SessionDriver::DriverLoop, this);
+}
+
+void SessionDriver::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) return;
+        stop_ = true;
+    }
+    cond_.notify_all();
+    driver_.join();
+    std::lock_guard<std::mutex> lock(mutex_);
+    running_ = false;
+}
+
+bool SessionDriver::AddSession(const std::string &session_id, std::unique_ptr<MPCContext> ctx) {
+    if (!ctx) return false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!session_id_set_.insert(session_id).second) return false;
+        Event event;
+        event.session_id_ = session_id;
+        event.ctx_ = std::move(ctx);
+        event_arr_.push_back(std::move(event));
+    }
+    cond_.notify_one();
+    return true;
+}
+
+void SessionDriver::PostMessage(const std::string &session_id, const std::string &party_id, int round,
+                                std::string p2p_msg, std::string bc_msg) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Event event;
+        event.session_id_ = session_id;
+        event.msg_.party_id_ = party_id;
+        event.msg_.round_ = round;
+        event.msg_.p2p_msg_ = std::move(p2p_msg);
+        event.msg_.bc_msg_ = std::move(bc_msg);
+        event_arr_.push_back(std::move(event));
+    }
+    cond_.notify_one();
+}
+
+size_t SessionDriver::session_count() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return session_id_set_.size();
+}
+
+void SessionDriver::DriverLoop() {
+    // Expire several times per retention period, so that nothing outlives it by much
+    std::chrono::milliseconds interval = std::max(retention_ / 4, std::chrono::milliseconds(1));
+    steady_clock::time_point next_expire = steady_clock::now() + interval;
+    std::vector<Event> batch;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            cond_.wait_until(lock, next_expire, [this] { return stop_ || !event_arr_.empty(); });
+            if (stop_) break;
+            // Take all the pending events at once, so that the producers are not held back while they are handled
+            batch.swap(event_arr_);
+        }
+
+        for (auto &event : batch) {
+            if (event.ctx_) {
+                StartSession(event.session_id_, std::move(event.ctx_));
+                continue;
+            }
+            auto iter = session_map_.find(event.session_id_);
+            if (iter != session_map_.end()) {
+                if (iter->second->Deliver(std::move(event.msg_), on_outbound_) != MPCSession::Status::Running) {
+                    FinishSession(event.session_id_);
+                }
+            } else if (finished_map_.count(event.session_id_) == 0 && orphan_count_ < MAX_ORPHAN_MESSAGES) {
+                // Late messages of a session which is over are dropped, they would never be taken
+                auto orphan_iter = orphan_map_.find(event.session_id_);
+                if (orphan_iter == orphan_map_.end()) {
+                    orphan_iter = orphan_map_.insert(std::make_pair(event.session_id_, Orphan())).first;
+                    orphan_iter->second.first_at_ = steady_clock::now();
+                }
+                orphan_iter->second.msg_arr_.push_back(std::move(event.msg_));
+                ++orphan_count_;
+            }
+        }
+        batch.clear();
+
+        steady_clock::time_point now = steady_clock::now();
+        if (now >= next_expire) {
+            ExpireSessions(now);
+            next_expire = now + interval;
+        }
+    }
+
+    session_map_.clear();
+    orphan_map_.clear();
+    finished_map_.clear();
+    orphan_count_ = 0;
+    std::lock_guard<std::mutex> lock(mutex_);
+    session_id_set_.clear();
+}
+
+void SessionDriver::StartSession(const std::string &session_id, std::unique_ptr<MPCContext> ctx) {
+    std::unique_ptr<MPCSession> owned_session(new MPCSession(session_id, std::move(ctx)));
+    MPCSession &session = *owned_session;
+    session_map_[session_id] = std::move(owned_session);
+    // The id may be used again once the previous session with it is over
+    finished_map_.erase(session_id);
+
+    MPCSession::Status status = session.Start(on_outbound_);
+
+    // The messages which came before the session
+    auto iter = orphan_map_.find(session_id);
+    if (iter != orphan_map_.end()) {
+        std::vector<MPCSession::Message> orphan_arr;
+        orphan_arr.swap(iter->second.msg_arr_);
+        orphan_map_.erase(iter);
+        orphan_count_ -= orphan_arr.size();
+        for (auto &msg : orphan_arr) {
+            if (status != MPCSession::Status::Running) break;
+            status = session.Deliver(std::move(msg), on_outbound_);
+        }
+    }
+
+    if (status != MPCSession::Status::Running) FinishSession(session_id);
+}
+
+void SessionDriver::FinishSession(const std::string &session_id) {
+    auto iter = session_map_.find(session_id);
+    bool ok = iter->second->status() == MPCSession::Status::Finished;
+    std::unique_ptr<MPCContext> ctx = iter->second->ReleaseContext();
+    session_map_.erase(iter);
+    finished_map_[session_id] = steady_clock::now();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        session_id_set_.erase(session_id);
+    }
+    if (on_completion_) on_completion_(session_id, std::move(ctx), ok);
+}
+
+void SessionDriver::ExpireSessions(steady_clock::time_point now) {
+    for (auto iter = finished_map_.begin(); iter != finished_map_.end();) {
+        if (now - iter->second > retention_) {
+            iter = finished_map_.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+    for (auto iter = orphan_map_.begin(); iter != orphan_map_.end();) {
+        if (now - iter->second.first_at_ > retention_) {
+            orphan_count_ -= iter->second.msg_arr_.size();
+            iter = orphan_map_.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+}
+
+}
+}
+}
@@ -0,0 +1,145 @@
+#ifndef SAFEHERON_MPC_FLOW_MPC_PARALLEL_V2_SESSION_DRIVER_H
+#define SAFEHERON_MPC_FLOW_MPC_PARALLEL_V2_SESSION_DRIVER_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_context.h"
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_session.h"
+
+namespace safeheron{
+namespace mpc_flow{
+namespace mpc_parallel_v2{
+
+/**
+ * Drives any number of MPC sessions from a single thread, so that the caller no longer pushes, polls and pops
+ * round by round.
+ *
+ * Messages may be posted for any round of any session in any order, from any thread, even before the session
+ * is added: messages of a later round are kept until the session gets there. As soon as a round is over its
+ * outgoing messages are handed to the outbound callback, and once the session is over (or has failed) the
+ * context is handed back to the completion callback.
+ *
+ * Messages of a session which is not added within the retention period are dropped. The id of a session which is
+ * over is remembered for the retention period as well, and the late messages posted for it are dropped.
+ *
+ * Both callbacks run on the driver thread: they should return quickly and must not wait for the driver.
+ * Posting messages from a callback is fine.
+ */
+class SessionDriver {
+public:
+    typedef MPCSession::OutboundCallback OutboundCallback;
+
+    /**
+     * @param ok false if the session has failed, the error stack of the context tells why.
+     */
+    typedef std::function<void(const std::string &session_id,
+                               std::unique_ptr<MPCContext> ctx,
+                               bool ok)> CompletionCallback;
+
+    /**
+     * @param retention how long the messages of a session which is not added yet are kept, and how long the id of
+     * a session which is over stays known.
+     */
+    SessionDriver(OutboundCallback on_outbound, CompletionCallback on_completion,
+                  std::chrono::milliseconds retention = std::chrono::seconds(60));
+
+    /**
+     * Stop the driver thread. The sessions which are not over are dropped without any callback.
+     */
+    ~SessionDriver();
+
+    SessionDriver(const SessionDriver &) = delete;
+
+    SessionDriver &operator=(const SessionDriver &) = delete;
+
+    /**
+     * Start the driver thread. Does nothing if it is running already.
+     */
+    void Start();
+
+    void Stop();
+
+    /**
+     * Hand a created context over to the driver, which starts round 0.
+     * @return false if the session id is already in use.
+     */
+    bool AddSession(const std::string &session_id, std::unique_ptr<MPCContext> ctx);
+
+    /**
+     * Post a message of round 'round' sent by 'party_id' to a session. Never blocks on the session.
+     * Messages of a round the session is done with, or beyond its last round, are dropped.
+     */
+    void PostMessage(const std::string &session_id, const std::string &party_id, int round,
+                     std::string p2p_msg, std::string bc_msg);
+
+    /**
+     * Number of sessions added and not over yet.
+     */
+    size_t session_count() const;
+
+    /**
+     * Number of messages kept for sessions which are not added yet.
+     */
+    size_t orphan_count() const { return orphan_count_; }
+
+private:
+    struct Event {
+        std::string session_id_;
+        // Set for an added session, null for a message
+        std::unique_ptr<MPCContext> ctx_;
+        MPCSession::Message msg_;
+    };
+
+    void DriverLoop();
+
+    void StartSession(const std::string &session_id, std::unique_ptr<MPCContext> ctx);
+
+    // Hand the context of a session which is over to the completion callback
+    void FinishSession(const std::string &session_id);
+
+    // Forget the finished sessions and drop the orphan messages past the retention period
+    void ExpireSessions(std::chrono::steady_clock::time_point now);
+
+private:
+    struct Orphan {
+        std::vector<MPCSession::Message> msg_arr_;
+        std::chrono::steady_clock::time_point first_at_;
+    };
+
+    OutboundCallback on_outbound_;
+    CompletionCallback on_completion_;
+    const std::chrono::milliseconds retention_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable cond_;
+    std::vector<Event> event_arr_;
+    // Ids of the sessions added and not over yet
+    std::unordered_set<std::string> session_id_set_;
+    std::thread driver_;
+    bool running_;
+    bool stop_;
+
+    // Only touched by the driver thread
+    std::unordered_map<std::string, std::unique_ptr<MPCSession>> session_map_;
+    // Messages of sessions which are not added yet
+    std::unordered_map<std::string, Orphan> orphan_map_;
+    // When the sessions which are over finished
+    std::unordered_map<std::string, std::chrono::steady_clock::time_point> finished_map_;
+    // Written by the driver thread only, read by orphan_count()
+    std::atomic<size_t> orphan_count_;
+};
+
+}
+}
+}
+
+#endif //SAFEHERON_MPC_FLOW_MPC_PARALLEL_V2_SESSION_DRIVER_H
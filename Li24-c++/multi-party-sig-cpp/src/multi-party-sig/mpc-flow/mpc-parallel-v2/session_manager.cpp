@@ -0,0 +1,267 @@
+#include <algorithm>
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/session_manager.h"
+
+using std::chrono::steady_clock;
+
+namespace safeheron{
+namespace mpc_flow{
+namespace mpc_parallel_v2{
+
+SessionManager::SessionManager(Executor *executor, const Options &options, OutboundCallback on_outbound,
+                               CompletionCallback on_completion)
+        : executor_(executor),
+          options_(options),
+          on_outbound_(std::move(on_outbound)),
+          on_completion_(std::move(on_completion)),
+          running_count_(0),
+          stop_(false) {
+    housekeeper_ = std::thread(&SessionManager::HousekeepingLoop, this);
+}
+
+SessionManager::~SessionManager() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    housekeeping_cond_.notify_all();
+    housekeeper_.join();
+    task_group_.Wait();
+}
+
+bool SessionManager::AddSession(const std::string &session_id, std::unique_ptr<MPCContext> ctx) {
+    if (!ctx) return false;
+    std::shared_ptr<Entry> entry = std::make_shared<Entry>();
+    entry->session_id_ = session_id;
+    entry->session_.reset(new MPCSession(session_id, std::move(ctx)));
+    entry->started_ = false;
+    entry->inbox_bytes_ = 0;
+    entry->scheduled_ = true;
+    entry->abort_state_ = SessionState::Running;
+    entry->state_ = SessionState::Running;
+    entry->round_ = 0;
+    entry->pending_bytes_ = 0;
+    entry->created_at_ = steady_clock::now();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (running_count_ >= options_.max_sessions_) return false;
+        if (!entry_map_.insert(std::make_pair(session_id, entry)).second) return false;
+        ++running_count_;
+        // The messages which came before the session
+        auto iter = orphan_map_.find(session_id);
+        if (iter != orphan_map_.end()) {
+            for (auto &msg : iter->second.msg_arr_) {
+                entry->inbox_.push_back(std::move(msg));
+            }
+            entry->inbox_bytes_ = iter->second.bytes_;
+            orphan_map_.erase(iter);
+        }
+    }
+    // Round 0
+    Schedule(entry);
+    return true;
+}
+
+bool SessionManager::PostMessage(const std::string &session_id, const std::string &party_id, int round,
+                                 std::string p2p_msg, std::string bc_msg) {
+    MPCSession::Message msg;
+    msg.party_id_ = party_id;
+    msg.round_ = round;
+    msg.p2p_msg_ = std::move(p2p_msg);
+    msg.bc_msg_ = std::move(bc_msg);
+    size_t bytes = msg.p2p_msg_.size() + msg.bc_msg_.size();
+
+    std::shared_ptr<Entry> entry;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = entry_map_.find(session_id);
+        if (iter == entry_map_.end()) {
+            // Keep it for the session, within the same limits
+            auto orphan_iter = orphan_map_.find(session_id);
+            if (orphan_iter == orphan_map_.end()) {
+                if (orphan_map_.size() >= options_.max_sessions_) return false;
+                orphan_iter = orphan_map_.insert(std::make_pair(session_id, Orphan())).first;
+                orphan_iter->second.bytes_ = 0;
+                orphan_iter->second.first_at_ = steady_clock::now();
+            }
+            Orphan &orphan = orphan_iter->second;
+            if (orphan.bytes_ + bytes > options_.max_pending_bytes_) return false;
+            orphan.msg_arr_.push_back(std::move(msg));
+            orphan.bytes_ += bytes;
+            return true;
+        }
+        entry = iter->second;
+    }
+
+    bool ok = true;
+    bool schedule = false;
+    {
+        std::lock_guard<std::mutex> lock(entry->mutex_);
+        if (entry->state_ != SessionState::Running || entry->abort_state_ != SessionState::Running) return false;
+        if (entry->inbox_bytes_ + entry->pending_bytes_ + bytes > options_.max_pending_bytes_) {
+            entry->abort_state_ = SessionState::Failed;
+            ok = false;
+        } else {
+            entry->inbox_.push_back(std::move(msg));
+            entry->inbox_bytes_ += bytes;
+        }
+        if (!entry->scheduled_) {
+            entry->scheduled_ = true;
+            schedule = true;
+        }
+    }
+    if (schedule) Schedule(entry);
+    return ok;
+}
+
+bool SessionManager::GetSessionInfo(const std::string &session_id, SessionInfo &info) const {
+    std::shared_ptr<Entry> entry;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = entry_map_.find(session_id);
+        if (iter == entry_map_.end()) return false;
+        entry = iter->second;
+    }
+    std::lock_guard<std::mutex> lock(entry->mutex_);
+    info.state_ = entry->state_;
+    info.round_ = entry->round_;
+    info.pending_bytes_ = entry->inbox_bytes_ + entry->pending_bytes_;
+    info.age_ = std::chrono::duration_cast<std::chrono::milliseconds>(steady_clock::now() - entry->created_at_);
+    return true;
+}
+
+size_t SessionManager::running_count() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return running_count_;
+}
+
+size_t SessionManager::ExpireSessions() {
+    steady_clock::time_point now = steady_clock::now();
+    std::vector<std::shared_ptr<Entry>> schedule_arr;
+    size_t expired = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto iter = entry_map_.begin(); iter != entry_map_.end();) {
+            Entry &entry = *iter->second;
+            std::lock_guard<std::mutex> entry_lock(entry.mutex_);
+            if (entry.state_ != SessionState::Running) {
+                if (now - entry.finished_at_ > options_.retention_) {
+                    iter = entry_map_.erase(iter);
+                    continue;
+                }
+            } else if (entry.abort_state_ == SessionState::Running && now - entry.created_at_ > options_.timeout_) {
+                entry.abort_state_ = SessionState::TimedOut;
+                ++expired;
+                if (!entry.scheduled_) {
+                    entry.scheduled_ = true;
+                    schedule_arr.push_back(iter->second);
+                }
+            }
+            ++iter;
+        }
+        for (auto iter = orphan_map_.begin(); iter != orphan_map_.end();) {
+            if (now - iter->second.first_at_ > options_.timeout_) {
+                iter = orphan_map_.erase(iter);
+            } else {
+                ++iter;
+            }
+        }
+    }
+    for (const auto &entry : schedule_arr) {
+        Schedule(entry);
+    }
+    return expired;
+}
+
+void SessionManager::Schedule(const std::shared_ptr<Entry> &entry) {
+    if (executor_ == nullptr) {
+        Drain(entry);
+        return;
+    }
+    task_group_.Run(executor_, [this, entry]() {
+        try {
+            Drain(entry);
+        } catch (...) {
+            // The session can not go on, unless the exception came from the completion callback
+            if (entry->session_) Finish(*entry, SessionState::Failed);
+        }
+    });
+}
+
+void SessionManager::Drain(const std::shared_ptr<Entry> &entry) {
+    std::deque<MPCSession::Message> batch;
+    for (;;) {
+        SessionState abort_state;
+        {
+            std::lock_guard<std::mutex> lock(entry->mutex_);
+            abort_state = entry->abort_state_;
+            if (entry->started_ && entry->inbox_.empty() && abort_state == SessionState::Running) {
+                entry->scheduled_ = false;
+                return;
+            }
+            batch.swap(entry->inbox_);
+            entry->inbox_bytes_ = 0;
+        }
+        if (abort_state != SessionState::Running) {
+            Finish(*entry, abort_state);
+            return;
+        }
+
+        MPCSession &session = *entry->session_;
+        MPCSession::Status status = MPCSession::Status::Running;
+        if (!entry->started_) {
+            entry->started_ = true;
+            status = session.Start(on_outbound_);
+        }
+        for (auto &msg : batch) {
+            if (status != MPCSession::Status::Running) break;
+            status = session.Deliver(std::move(msg), on_outbound_);
+        }
+        batch.clear();
+
+        if (status != MPCSession::Status::Running) {
+            Finish(*entry, status == MPCSession::Status::Finished ? SessionState::Finished : SessionState::Failed);
+            return;
+        }
+        std::lock_guard<std::mutex> lock(entry->mutex_);
+        entry->round_ = session.inbound_round();
+        entry->pending_bytes_ = session.pending_bytes();
+    }
+}
+
+void SessionManager::Finish(Entry &entry, SessionState state) {
+    std::unique_ptr<MPCContext> ctx = entry.session_->ReleaseContext();
+    entry.session_.reset();
+    {
+        std::lock_guard<std::mutex> lock(entry.mutex_);
+        // scheduled_ stays set: no task is ever run for the session again
+        entry.state_ = state;
+        entry.inbox_.clear();
+        entry.inbox_bytes_ = 0;
+        entry.pending_bytes_ = 0;
+        entry.finished_at_ = steady_clock::now();
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        --running_count_;
+    }
+    if (on_completion_) on_completion_(entry.session_id_, std::move(ctx), state);
+}
+
+void SessionManager::HousekeepingLoop() {
+    std::chrono::milliseconds interval = std::min(options_.timeout_, options_.retention_) / 4;
+    if (interval < std::chrono::milliseconds(10)) interval = std::chrono::milliseconds(10);
+    if (interval > std::chrono::milliseconds(1000)) interval = std::chrono::milliseconds(1000);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stop_) {
+        housekeeping_cond_.wait_for(lock, interval, [this] { return stop_; });
+        if (stop_) break;
+        lock.unlock();
+        ExpireSessions();
+        lock.lock();
+    }
+}
+
+}
+}
+}
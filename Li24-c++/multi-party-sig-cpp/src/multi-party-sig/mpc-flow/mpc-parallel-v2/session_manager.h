@@ -0,0 +1,176 @@
+#ifndef SAFEHERON_MPC_FLOW_MPC_PARALLEL_V2_SESSION_MANAGER_H
+#define SAFEHERON_MPC_FLOW_MPC_PARALLEL_V2_SESSION_MANAGER_H
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/executor.h"
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_context.h"
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_session.h"
+
+namespace safeheron{
+namespace mpc_flow{
+namespace mpc_parallel_v2{
+
+/**
+ * Holds many concurrent MPC sessions of any protocol (Li24, CMP, GG18, GG20, ...), keyed by a session id such as
+ * the ssid of CMP, and runs their rounds on a fixed executor instead of a thread per session.
+ *
+ * The messages of a session are handled by one task at a time, in the order they were posted; different sessions
+ * run in parallel. Messages may come before their session is added, they are kept until the timeout. A session fails once the messages waiting for it exceed the memory limit, and times out when it
+ * is not over within the timeout. Its state can be queried until the retention period after it is over.
+ *
+ * The callbacks run on the executor threads. The contexts must not use the executor of the manager themselves.
+ */
+class SessionManager {
+public:
+    enum class SessionState {
+        Running,
+        Finished,
+        Failed,
+        TimedOut,
+    };
+
+    class Options {
+    public:
+        Options(): max_sessions_(10000),
+                   max_pending_bytes_(1 << 20),
+                   timeout_(std::chrono::seconds(60)),
+                   retention_(std::chrono::seconds(60)) {}
+
+        // Maximum number of running sessions
+        size_t max_sessions_;
+        // Maximum size of the messages waiting for a session
+        size_t max_pending_bytes_;
+        // Maximum lifetime of a session, from AddSession
+        std::chrono::milliseconds timeout_;
+        // How long the state of a session stays known after it is over
+        std::chrono::milliseconds retention_;
+    };
+
+    class SessionInfo {
+    public:
+        SessionState state_;
+        // Round of the messages the session accepts now
+        int round_;
+        size_t pending_bytes_;
+        std::chrono::milliseconds age_;
+    };
+
+    typedef MPCSession::OutboundCallback OutboundCallback;
+
+    /**
+     * @param state Finished, Failed or TimedOut. The error stack of the context tells why a session has failed.
+     */
+    typedef std::function<void(const std::string &session_id,
+                               std::unique_ptr<MPCContext> ctx,
+                               SessionState state)> CompletionCallback;
+
+    /**
+     * @param executor runs the rounds, not owned. nullptr to run them in the thread which posts the message.
+     */
+    SessionManager(Executor *executor, const Options &options, OutboundCallback on_outbound,
+                   CompletionCallback on_completion);
+
+    /**
+     * Wait for the running tasks. The sessions which are not over are dropped without any callback.
+     */
+    ~SessionManager();
+
+    SessionManager(const SessionManager &) = delete;
+
+    SessionManager &operator=(const SessionManager &) = delete;
+
+    /**
+     * Add a created context, round 0 is run on the executor.
+     * @return false if the session id is known already, or if there are too many running sessions.
+     */
+    bool AddSession(const std::string &session_id, std::unique_ptr<MPCContext> ctx);
+
+    /**
+     * Post a message of round 'round' sent by 'party_id'. Messages may come in any order.
+     * @return false if the session is over, or if the message exceeds the memory limit (a running session then
+     *         fails).
+     */
+    bool PostMessage(const std::string &session_id, const std::string &party_id, int round,
+                     std::string p2p_msg, std::string bc_msg);
+
+    bool GetSessionInfo(const std::string &session_id, SessionInfo &info) const;
+
+    size_t running_count() const;
+
+    /**
+     * Time out the sessions past the timeout and forget the ones past the retention period, as well as the messages
+     * of sessions which were never added.
+     * Called periodically by a housekeeping thread, may also be called directly.
+     * @return number of sessions which timed out.
+     */
+    size_t ExpireSessions();
+
+private:
+    struct Entry {
+        std::string session_id_;
+        // Only touched by the task of the session. Null once the session is over.
+        std::unique_ptr<MPCSession> session_;
+        bool started_;
+
+        // Guards the members below
+        std::mutex mutex_;
+        std::deque<MPCSession::Message> inbox_;
+        size_t inbox_bytes_;
+        // Whether a task is queued or running for the session
+        bool scheduled_;
+        // Set to Failed or TimedOut to abort the session at its next task
+        SessionState abort_state_;
+        SessionState state_;
+        int round_;
+        size_t pending_bytes_;
+        std::chrono::steady_clock::time_point created_at_;
+        std::chrono::steady_clock::time_point finished_at_;
+    };
+
+    // Messages of a session which is not added yet
+    struct Orphan {
+        std::vector<MPCSession::Message> msg_arr_;
+        size_t bytes_;
+        std::chrono::steady_clock::time_point first_at_;
+    };
+
+    void Schedule(const std::shared_ptr<Entry> &entry);
+
+    void Drain(const std::shared_ptr<Entry> &entry);
+
+    void Finish(Entry &entry, SessionState state);
+
+    void HousekeepingLoop();
+
+private:
+    Executor *executor_;
+    const Options options_;
+    OutboundCallback on_outbound_;
+    CompletionCallback on_completion_;
+
+    // Guards entry_map_, orphan_map_ and running_count_. Taken before the mutex of an entry, never after.
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, std::shared_ptr<Entry>> entry_map_;
+    std::unordered_map<std::string, Orphan> orphan_map_;
+    size_t running_count_;
+
+    TaskGroup task_group_;
+    std::condition_variable housekeeping_cond_;
+    std::thread housekeeper_;
+    bool stop_;
+};
+
+}
+}
+}
+
+#endif //SAFEHERON_MPC_FLOW_MPC_PARALLEL_V2_SESSION_MANAGER_H
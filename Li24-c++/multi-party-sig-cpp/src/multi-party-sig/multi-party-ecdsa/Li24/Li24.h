@@ -5,8 +5,12 @@
 #ifndef SAFEHERON_MULTI_PARTY_ECDSA_Li24_H
 #define SAFEHERON_MULTI_PARTY_ECDSA_Li24_H
 #include "multi-party-sig/multi-party-ecdsa/Li24/key_gen/context.h"
-//#include "multi-party-sig/multi-party-ecdsa/Li24/key_refresh/context.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/key_refresh/context.h"
 #include "multi-party-sig/multi-party-ecdsa/Li24/sign/context.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/sign/pipelined_signer.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/batch_sign/context.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/presign/context.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/online_sign/context.h"
 #include "multi-party-sig/multi-party-ecdsa/Li24/util.h"
 
 #endif //SAFEHERON_MULTI_PARTY_ECDSA_Li24_H
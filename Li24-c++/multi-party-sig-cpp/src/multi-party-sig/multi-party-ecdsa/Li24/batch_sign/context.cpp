@@ -0,0 +1,117 @@
+#include "multi-party-sig/multi-party-ecdsa/Li24/batch_sign/context.h"
+
+using safeheron::bignum::BN;
+using safeheron::multi_party_ecdsa::Li24::SignKey;
+using safeheron::multi_party_ecdsa::Li24::SignKeyHandle;
+
+namespace safeheron {
+namespace multi_party_ecdsa{
+namespace Li24{
+namespace batch_sign{
+
+Context::Context(int total_parties): MPCContext(total_parties), local_party_index(0){
+    BindAllRounds();
+}
+
+Context::Context(const Context &ctx): MPCContext(ctx){
+    // Assign all the member variables.
+    sign_key_ = ctx.sign_key_;
+    quorum_ = ctx.quorum_;
+
+    m_arr_ = ctx.m_arr_;
+
+    local_party_ = ctx.local_party_;
+    round0_ = ctx.round0_;
+    round1_ = ctx.round1_;
+    round2_ = ctx.round2_;
+
+    remote_party_indexes = ctx.remote_party_indexes;
+    local_party_index = ctx.local_party_index;
+
+    R_arr_ = ctx.R_arr_;
+    r_arr_ = ctx.r_arr_;
+    sig_arr_ = ctx.sig_arr_;
+    failed_slot_arr_ = ctx.failed_slot_arr_;
+    // End Assignments.
+
+    BindAllRounds();
+}
+
+Context &Context::operator=(const Context &ctx){
+    if (this == &ctx) {
+        return *this;
+    }
+
+    MPCContext::operator=(ctx);
+
+    // Assign all the member variables.
+    sign_key_ = ctx.sign_key_;
+    quorum_ = ctx.quorum_;
+
+    m_arr_ = ctx.m_arr_;
+
+    local_party_ = ctx.local_party_;
+    round0_ = ctx.round0_;
+    round1_ = ctx.round1_;
+    round2_ = ctx.round2_;
+
+    remote_party_indexes = ctx.remote_party_indexes;
+    local_party_index = ctx.local_party_index;
+
+    R_arr_ = ctx.R_arr_;
+    r_arr_ = ctx.r_arr_;
+    sig_arr_ = ctx.sig_arr_;
+    failed_slot_arr_ = ctx.failed_slot_arr_;
+    // End Assignments.
+
+    BindAllRounds();
+
+    return *this;
+}
+
+bool Context::CreateContext(Context &ctx, const std::string &sign_key_base64, const std::vector<safeheron::bignum::BN> &m_arr) {
+    bool ok = true;
+    if (m_arr.empty()) return false;
+    ctx.m_arr_ = m_arr;
+    ctx.failed_slot_arr_.clear();
+
+    ok = ctx.sign_key_.FromBase64(sign_key_base64);
+    if (!ok) return false;
+    ok = ((int)ctx.sign_key_.n_parties_ == ctx.get_total_parties());
+    if (!ok) return false;
+
+    return true;
+}
+
+bool Context::CreateContext(Context &ctx, const SignKeyHandle &sign_key_handle,
+                            const std::vector<std::string> &participant_id_arr, const std::vector<safeheron::bignum::BN> &m_arr) {
+    bool ok = true;
+    if (m_arr.empty()) return false;
+    ctx.m_arr_ = m_arr;
+    ctx.failed_slot_arr_.clear();
+
+    ok = sign_key_handle.Trim(ctx.sign_key_, participant_id_arr, m_arr.size() * PRG_OUTPUTS_PER_SIGN);
+    if (!ok) return false;
+    ok = ((int)ctx.sign_key_.n_parties_ == ctx.get_total_parties());
+    if (!ok) return false;
+    ctx.quorum_ = sign_key_handle.GetQuorum(ctx.sign_key_);
+    if (!ctx.quorum_) return false;
+
+    return true;
+}
+
+bool Context::IsRemoteParty(const std::string &party_id) const {
+    return sign_key_.get_remote_party_pos(party_id) != -1;
+}
+
+void Context::BindAllRounds() {
+    RemoveAllRounds();
+    AddRound(&round0_);
+    AddRound(&round1_);
+    AddRound(&round2_);
+}
+
+}
+}
+}
+}
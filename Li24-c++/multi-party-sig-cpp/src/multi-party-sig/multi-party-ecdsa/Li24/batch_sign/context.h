@@ -0,0 +1,101 @@
+#ifndef SAFEHERON_MULTI_PARTY_ECDSA_Li24_BATCH_SIGN_CONTEXT_H
+#define SAFEHERON_MULTI_PARTY_ECDSA_Li24_BATCH_SIGN_CONTEXT_H
+
+#include <memory>
+#include <vector>
+#include "crypto-suites/crypto-curve/curve.h"
+#include "crypto-suites/crypto-bn/bn.h"
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_context.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/sign_key.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/sign_key_handle.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/batch_sign/t_party.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/batch_sign/round0.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/batch_sign/round1.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/batch_sign/round2.h"
+
+
+namespace safeheron {
+namespace multi_party_ecdsa{
+namespace Li24{
+namespace batch_sign{
+
+/**
+ * Signature (r, s, v) of one batch slot.
+ */
+class Signature {
+public:
+    safeheron::bignum::BN r_;
+    safeheron::bignum::BN s_;
+    uint32_t v_ = 0;
+};
+
+/**
+ * Signs K message digests in one run of the three-round Li24 protocol.
+ *
+ * Every slot is an independent instance (k_i, phi_i, w_i) that consumes the PRG in the same order as K
+ * consecutive runs of Li24::sign, but all slots travel in the same round messages.
+ */
+class Context : public safeheron::mpc_flow::mpc_parallel_v2::MPCContext {
+public:
+    /**
+     * Default constructor
+     */
+    Context(int total_parties);
+
+    /**
+     * A copy constructor
+     */
+    Context(const Context &ctx);
+
+    /**
+     * A copy assignment operator
+     */
+    Context &operator=(const Context &ctx);
+
+public:
+    void BindAllRounds();
+
+    bool IsRemoteParty(const std::string &party_id) const override;
+
+    static bool CreateContext(Context &ctx, const std::string &sign_key_base64, const std::vector<safeheron::bignum::BN> &m_arr);
+
+    /**
+     * Same as above, but take the sign key from a handle, so that it is neither decoded nor trimmed from base64 again.
+     * @param participant_id_arr all the parties that take part in the signature.
+     */
+    static bool CreateContext(Context &ctx, const safeheron::multi_party_ecdsa::Li24::SignKeyHandle &sign_key_handle,
+                              const std::vector<std::string> &participant_id_arr, const std::vector<safeheron::bignum::BN> &m_arr);
+
+    size_t batch_size() const { return m_arr_.size(); }
+
+public:
+    safeheron::multi_party_ecdsa::Li24::SignKey sign_key_;
+    // Set by the sign key handle, or computed in round 0
+    std::shared_ptr<const safeheron::multi_party_ecdsa::Li24::Quorum> quorum_;
+    std::vector<safeheron::bignum::BN> m_arr_;
+
+    LocalTParty local_party_;
+
+    std::vector<size_t> remote_party_indexes;
+    size_t local_party_index;
+
+    Round0 round0_;
+    Round1 round1_;
+    Round2 round2_;
+
+    std::vector<safeheron::curve::CurvePoint> R_arr_;
+    std::vector<safeheron::bignum::BN> r_arr_;
+
+    // Output: one signature per digest in m_arr_
+    std::vector<Signature> sig_arr_;
+    // Slots whose signature failed to verify in Round2, their entries in sig_arr_ are left empty (r = s = 0).
+    // Round2 fails if this is not empty, but the signatures of the other slots are still valid.
+    std::vector<size_t> failed_slot_arr_;
+};
+
+}
+}
+}
+}
+
+#endif //SAFEHERON_MULTI_PARTY_ECDSA_Li24_BATCH_SIGN_CONTEXT_H
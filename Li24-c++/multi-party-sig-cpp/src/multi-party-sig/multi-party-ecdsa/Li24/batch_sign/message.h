@@ -0,0 +1,80 @@
+#ifndef SAFEHERON_MULTI_PARTY_ECDSA_Li24_BATCH_SIGN_MESSAGE_H
+#define SAFEHERON_MULTI_PARTY_ECDSA_Li24_BATCH_SIGN_MESSAGE_H
+
+#include <vector>
+#include "crypto-suites/crypto-bn/bn.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/sign/proto_gen/sign.pb.switch.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/wire.h"
+#include "crypto-suites/crypto-curve/curve.h"
+namespace safeheron {
+namespace multi_party_ecdsa{
+namespace Li24{
+namespace batch_sign{
+
+class Round0BCMessage {
+public:
+    std::vector<safeheron::curve::CurvePoint> Gk_arr_;
+
+
+public:
+    bool ToProtoObject(safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0BCMessage &message) const;
+
+    bool FromProtoObject(const safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0BCMessage &message);
+
+    bool ToBase64(std::string &b64) const;
+
+    bool FromBase64(const std::string &b64);
+
+    bool ToJsonString(std::string &json_str)const ;
+
+    bool FromJsonString(const std::string &json_str);
+};
+
+class Round0P2PMessage {
+public:
+    std::vector<safeheron::bignum::BN> k_arr_;
+    std::vector<safeheron::bignum::BN> w_arr_;
+    std::vector<safeheron::bignum::BN> phi_arr_;
+    WireVersion wire_version_ = WireVersion::Hex;
+
+public:
+    bool ToProtoObject(safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0P2PMessage &message) const;
+
+    bool FromProtoObject(const safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0P2PMessage &message);
+
+    bool ToBase64(std::string &b64) const;
+
+    bool FromBase64(const std::string &b64);
+
+    bool ToJsonString(std::string &json_str)const ;
+
+    bool FromJsonString(const std::string &json_str);
+};
+
+class Round1BCMessage {
+public:
+    std::vector<safeheron::bignum::BN> delta_arr_;
+    std::vector<safeheron::bignum::BN> v_arr_;
+    WireVersion wire_version_ = WireVersion::Hex;
+
+public:
+    bool ToProtoObject(safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound1BCMessage &message) const;
+
+    bool FromProtoObject(const safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound1BCMessage &message);
+
+    bool ToBase64(std::string &b64) const;
+
+    bool FromBase64(const std::string &b64);
+
+    bool ToJsonString(std::string &json_str)const ;
+
+    bool FromJsonString(const std::string &json_str);
+};
+
+
+}
+}
+}
+}
+
+#endif //SAFEHERON_MULTI_PARTY_ECDSA_Li24_BATCH_SIGN_MESSAGE_H
@@ -1,6 +1,6 @@
 #include <google/protobuf/util/json_util.h>
 #include "crypto-suites/crypto-encode/base64.h"
-#include "multi-party-sig/multi-party-ecdsa/Li24/key_refresh/message.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/batch_sign/message.h"
 
 using std::string;
 using safeheron::bignum::BN;
@@ -14,47 +14,35 @@ using google::protobuf::util::JsonParseOptions;
 namespace safeheron {
 namespace multi_party_ecdsa{
 namespace Li24{
-namespace key_refresh {
+namespace batch_sign{
 
-bool Round2P2PMessage::ToProtoObject(safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round2P2PMessage &message) const {
+bool Round0P2PMessage::ToProtoObject(safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0P2PMessage &message) const {
     bool ok = true;
+    if (w_arr_.size() != k_arr_.size() || phi_arr_.size() != k_arr_.size()) return false;
 
-    safeheron::proto::DLogProof dlog_proof;
-    ok = dlog_proof_x_.ToProtoObject(dlog_proof);
+    ok = EncodeBNArr(w_arr_, wire_version_, message.mutable_w(), message.mutable_w_bin());
     if (!ok) return false;
-    message.mutable_dlog_proof_x()->CopyFrom(dlog_proof);
 
-    safeheron::proto::PailBlumModulusProof pail_proof;
-    ok = pail_proof_.ToProtoObject(pail_proof);
+    ok = EncodeBNArr(k_arr_, wire_version_, message.mutable_k(), message.mutable_k_bin());
     if (!ok) return false;
-    message.mutable_pail_proof()->CopyFrom(pail_proof);
 
-    safeheron::proto::NoSmallFactorProof no_small_factor_proof;
-    ok = nsf_proof_.ToProtoObject(no_small_factor_proof);
+    ok = EncodeBNArr(phi_arr_, wire_version_, message.mutable_phi(), message.mutable_phi_bin());
     if (!ok) return false;
-    message.mutable_nsf_proof()->CopyFrom(no_small_factor_proof);
 
     return true;
 }
 
-bool Round2P2PMessage::FromProtoObject(const safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round2P2PMessage &message) {
-    bool ok = true;
-
-    ok = dlog_proof_x_.FromProtoObject(message.dlog_proof_x());
-    if (!ok) return false;
-
-    ok = pail_proof_.FromProtoObject(message.pail_proof());
-    if (!ok) return false;
-
-    ok = nsf_proof_.FromProtoObject(message.nsf_proof());
-    if (!ok) return false;
+bool Round0P2PMessage::FromProtoObject(const safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0P2PMessage &message) {
+    DecodeBNArr(message.w(), message.w_bin(), w_arr_);
+    DecodeBNArr(message.k(), message.k_bin(), k_arr_);
+    DecodeBNArr(message.phi(), message.phi_bin(), phi_arr_);
+    if (w_arr_.size() != k_arr_.size() || phi_arr_.size() != k_arr_.size()) return false;
 
     return true;
 }
 
-
-typedef Round2P2PMessage TheClass;
-typedef safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round2P2PMessage ProtoObject;
+typedef Round0P2PMessage TheClass;
+typedef safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0P2PMessage ProtoObject;
 
 bool TheClass::ToBase64(string &b64) const {
     bool ok = true;
@@ -106,7 +94,6 @@ bool TheClass::FromJsonString(const string &json_str) {
     return FromProtoObject(proto_object);
 }
 
-
 }
 }
 }
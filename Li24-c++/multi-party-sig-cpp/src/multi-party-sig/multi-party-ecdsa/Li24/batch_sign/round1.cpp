@@ -0,0 +1,118 @@
+#include "crypto-suites/crypto-curve/curve.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/batch_sign/round1.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/batch_sign/context.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/batch_sign/slot.h"
+
+using std::string;
+using safeheron::bignum::BN;
+using safeheron::curve::CurvePoint;
+using safeheron::curve::Curve;
+using safeheron::multi_party_ecdsa::Li24::SignKey;
+
+namespace safeheron {
+namespace multi_party_ecdsa{
+namespace Li24{
+namespace batch_sign{
+
+void Round1::Init() {
+    Context *ctx = this->get_context();
+    for (int i = 0; i < ctx->get_total_parties() - 1; ++i) {
+        p2p_message_arr_.emplace_back();
+        bc_message_arr_.emplace_back();
+    }
+}
+
+bool Round1::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
+    Context *ctx = this->get_context();
+    const SignKey &sign_key = ctx->sign_key_;
+
+    int pos = sign_key.get_remote_party_pos(party_id);
+    if (pos == -1) {
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
+        return false;
+    }
+
+    bool ok = true;
+    if (p2p_msg.empty()) {
+        // Only a sender of a key with the bytes encoding leaves the shares out, and only for the parties outside
+        // its window
+        if (sign_key.wire_version_ != WireVersion::Bytes || !ctx->quorum_ || ctx->quorum_->InRemoteP2PWindow(pos)) {
+            ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Empty P2P message from party " + party_id + "!");
+            return false;
+        }
+        SetZeroShares(ctx->batch_size(), p2p_message_arr_[pos]);
+    } else {
+        ok = ctx->DecodeMessage(p2p_msg, p2p_message_arr_[pos]);
+        if (!ok) {
+            ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to deserialize the message!");
+            return false;
+        }
+    }
+
+    ok = ctx->DecodeMessage(bc_msg, bc_message_arr_[pos]);
+    if (!ok) {
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to deserialize the message!");
+        return false;
+    }
+
+    return true;
+}
+
+bool Round1::ReceiveVerify(const std::string &party_id) {
+    Context *ctx = this->get_context();
+    const SignKey &sign_key = ctx->sign_key_;
+
+    int pos = sign_key.get_remote_party_pos(party_id);
+    if (p2p_message_arr_[pos].k_arr_.size() != ctx->batch_size() ||
+        bc_message_arr_[pos].Gk_arr_.size() != ctx->batch_size()) {
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Batch size mismatch in message from " + party_id + "!");
+        return false;
+    }
+
+    return true;
+}
+
+bool Round1::ComputeVerify() {
+    Context *ctx = this->get_context();
+    const SignKey &sign_key = ctx->sign_key_;
+    const Curve * curv = GetCurveParam(sign_key.X_.GetCurveType());
+    LocalTParty &local = ctx->local_party_;
+
+    AggregateSlots(sign_key, bc_message_arr_, p2p_message_arr_, local, ctx->R_arr_, ctx->r_arr_);
+    for (size_t slot = 0; slot < ctx->batch_size(); ++slot) {
+        local.delta_arr_.push_back((ctx->m_arr_[slot] * local.phi_arr_[slot] + ctx->r_arr_[slot] * local.u_arr_[slot]) % curv->n);
+    }
+
+    return true;
+}
+
+bool Round1::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
+                         std::vector<std::string> &out_des_arr) const {
+    Context *ctx = this->get_context();
+    const SignKey &sign_key = ctx->sign_key_;
+    bool ok = true;
+    out_p2p_msg_arr.clear();
+    out_bc_msg.clear();
+    out_des_arr.clear();
+
+    for (size_t i = 0; i < sign_key.remote_parties_.size(); ++i) {
+        out_des_arr.push_back(sign_key.remote_parties_[i].party_id_);
+    }
+
+    Round1BCMessage bc_message;
+    bc_message.wire_version_ = sign_key.wire_version_;
+    bc_message.v_arr_ = ctx->local_party_.v_arr_;
+    bc_message.delta_arr_ = ctx->local_party_.delta_arr_;
+    ok = ctx->EncodeMessage(bc_message, out_bc_msg);
+    if (!ok) {
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed in ctx->EncodeMessage(bc_message, out_bc_msg)!");
+        return false;
+    }
+
+    return true;
+}
+
+}
+}
+}
+}
@@ -0,0 +1,101 @@
+#include <google/protobuf/util/json_util.h>
+#include "crypto-suites/crypto-encode/base64.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/batch_sign/message.h"
+
+using std::string;
+using safeheron::bignum::BN;
+using google::protobuf::util::Status;
+using google::protobuf::util::MessageToJsonString;
+using google::protobuf::util::JsonStringToMessage;
+using google::protobuf::util::JsonPrintOptions;
+using google::protobuf::util::JsonParseOptions;
+
+
+namespace safeheron {
+namespace multi_party_ecdsa{
+namespace Li24{
+namespace batch_sign{
+
+bool Round1BCMessage::ToProtoObject(safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound1BCMessage &message) const {
+    bool ok = true;
+    if (delta_arr_.size() != v_arr_.size()) return false;
+
+    ok = EncodeBNArr(delta_arr_, wire_version_, message.mutable_delta(), message.mutable_delta_bin());
+    if (!ok) return false;
+
+    ok = EncodeBNArr(v_arr_, wire_version_, message.mutable_v(), message.mutable_v_bin());
+    if (!ok) return false;
+
+    return true;
+}
+
+bool Round1BCMessage::FromProtoObject(const safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound1BCMessage &message) {
+    DecodeBNArr(message.delta(), message.delta_bin(), delta_arr_);
+    DecodeBNArr(message.v(), message.v_bin(), v_arr_);
+    if (delta_arr_.size() != v_arr_.size()) return false;
+
+    for (size_t i = 0; i < delta_arr_.size(); ++i) {
+        if (delta_arr_[i] == 0 || v_arr_[i] == 0) return false;
+    }
+
+    return true;
+}
+
+
+typedef Round1BCMessage TheClass;
+typedef safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound1BCMessage ProtoObject;
+
+bool TheClass::ToBase64(string &b64) const {
+    bool ok = true;
+    b64.clear();
+    ProtoObject proto_object;
+    ok = ToProtoObject(proto_object);
+    if (!ok) return false;
+
+    string proto_bin = proto_object.SerializeAsString();
+    b64 = safeheron::encode::base64::EncodeToBase64(proto_bin, true);
+    return true;
+}
+
+bool TheClass::FromBase64(const string &b64) {
+    bool ok = true;
+
+    string data = safeheron::encode::base64::DecodeFromBase64(b64);
+
+    ProtoObject proto_object;
+    ok = proto_object.ParseFromString(data);
+    if (!ok) return false;
+
+    return FromProtoObject(proto_object);
+}
+
+bool TheClass::ToJsonString(string &json_str) const {
+    bool ok = true;
+    json_str.clear();
+    ProtoObject proto_object;
+    ok = ToProtoObject(proto_object);
+    if (!ok) return false;
+
+    JsonPrintOptions jp_option;
+    jp_option.add_whitespace = true;
+    Status stat = MessageToJsonString(proto_object, &json_str, jp_option);
+    if (!stat.ok()) return false;
+
+    return true;
+}
+
+
+bool TheClass::FromJsonString(const string &json_str) {
+    ProtoObject proto_object;
+    google::protobuf::util::JsonParseOptions jp_option;
+    jp_option.ignore_unknown_fields = true;
+    Status stat = JsonStringToMessage(json_str, &proto_object);
+    if (!stat.ok()) return false;
+
+    return FromProtoObject(proto_object);
+}
+
+}
+}
+}
+}
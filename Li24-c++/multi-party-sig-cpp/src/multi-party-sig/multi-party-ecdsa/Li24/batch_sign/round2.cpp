@@ -0,0 +1,111 @@
+#include "crypto-suites/crypto-curve/curve.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/batch_sign/round2.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/batch_sign/context.h"
+
+using std::string;
+using safeheron::bignum::BN;
+using safeheron::curve::Curve;
+using safeheron::multi_party_ecdsa::Li24::SignKey;
+
+namespace safeheron {
+namespace multi_party_ecdsa{
+namespace Li24{
+namespace batch_sign{
+
+void Round2::Init() {
+
+    Context *ctx = this->get_context();
+    for (int i = 0; i < ctx->get_total_parties() - 1; ++i) {
+        bc_message_arr_.emplace_back();
+    }
+
+}
+
+bool Round2::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
+
+    Context *ctx = this->get_context();
+    const SignKey &sign_key = ctx->sign_key_;
+
+    int pos = sign_key.get_remote_party_pos(party_id);
+    if (pos == -1) {
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
+        return false;
+    }
+
+    bool ok = ctx->DecodeMessage(bc_msg, bc_message_arr_[pos]);
+    if (!ok) {
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to deserialize the message!");
+        return false;
+    }
+
+    return true;
+}
+
+bool Round2::ReceiveVerify(const std::string &party_id) {
+    Context *ctx = this->get_context();
+    const SignKey &sign_key = ctx->sign_key_;
+
+    int pos = sign_key.get_remote_party_pos(party_id);
+    if (bc_message_arr_[pos].delta_arr_.size() != ctx->batch_size()) {
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Batch size mismatch in message from " + party_id + "!");
+        return false;
+    }
+
+    return true;
+}
+
+bool Round2::ComputeVerify() {
+    bool ok = true;
+    Context *ctx = this->get_context();
+    const SignKey &sign_key = ctx->sign_key_;
+
+    const Curve * curv = GetCurveParam(sign_key.X_.GetCurveType());
+    BN half_n = curv->n / 2;
+
+    // Every slot is checked, so that a bad slot does not hide the signatures of the others
+    ctx->sig_arr_.clear();
+    ctx->failed_slot_arr_.clear();
+    for (size_t slot = 0; slot < ctx->batch_size(); ++slot) {
+        BN delta = ctx->local_party_.delta_arr_[slot];
+        BN v = ctx->local_party_.v_arr_[slot];
+        for (size_t i = 0; i < bc_message_arr_.size(); ++i) {
+            v = (v + bc_message_arr_[i].v_arr_[slot]) % curv->n;
+            delta = (delta + bc_message_arr_[i].delta_arr_[slot]) % curv->n;
+        }
+        BN s = (delta * v.InvM(curv->n)) % curv->n;
+        // Recovery parameter
+        const safeheron::curve::CurvePoint &R = ctx->R_arr_[slot];
+        const BN &r = ctx->r_arr_[slot];
+        uint32_t recovery_param = (R.y().IsOdd() ? 1 : 0) |     // is_y_odd
+                                  ((R.x() != r) ? 2 : 0); // is_second_key
+        if (s > half_n){
+            s = curv->n - s;
+            recovery_param ^= 1;
+        }
+
+        Signature sig;
+        sig.r_ = r;
+        sig.s_ = s;
+        sig.v_ = recovery_param;
+        // Verify the signature of this slot
+        ok = safeheron::curve::ecdsa::VerifyPublicKey(sign_key.X_, sign_key.X_.GetCurveType(), ctx->m_arr_[slot], sig.r_, sig.s_, sig.v_);
+        if (!ok) {
+            ctx->failed_slot_arr_.push_back(slot);
+            ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to verify R,S,V with child public key in batch slot " + std::to_string(slot) + "!");
+            sig = Signature();
+        }
+        ctx->sig_arr_.push_back(sig);
+    }
+
+    return ctx->failed_slot_arr_.empty();
+}
+
+bool Round2::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
+                         std::vector<std::string> &out_des_arr) const {
+    return true;
+}
+
+}
+}
+}
+}
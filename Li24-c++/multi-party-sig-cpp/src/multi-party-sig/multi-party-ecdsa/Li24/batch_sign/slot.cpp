@@ -0,0 +1,85 @@
+#include "crypto-suites/crypto-bn/rand.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/batch_sign/slot.h"
+
+using std::vector;
+using safeheron::bignum::BN;
+using safeheron::curve::CurvePoint;
+using safeheron::curve::Curve;
+using safeheron::multi_party_ecdsa::Li24::SignKey;
+using safeheron::multi_party_ecdsa::Li24::Quorum;
+
+namespace safeheron {
+namespace multi_party_ecdsa{
+namespace Li24{
+namespace batch_sign{
+
+void SampleSlots(SignKey &sign_key, const Quorum &quorum, size_t slot_count, LocalTParty &local) {
+    const Curve * curv = GetCurveParam(sign_key.X_.GetCurveType());
+    BN w = (sign_key.local_party_.x_ * local.lambda_) % curv->n;
+
+    // The outputs of all the slots are drawn from every remote party's PRG at once
+    std::vector<PRG *> prg_arr;
+    for (size_t i = 0; i < quorum.remote_party_indexes_.size(); ++i) {
+        prg_arr.push_back(&sign_key.remote_parties_[i].prg);
+    }
+    const size_t outputs = slot_count * PRG_OUTPUTS_PER_SIGN;
+    std::vector<BN> rand_arr;
+    PRG::rand_lanes(prg_arr, outputs, rand_arr);
+    for (size_t slot = 0; slot < slot_count; ++slot) {
+        BN blind[3] = {safeheron::rand::RandomBNLt(curv->n), safeheron::rand::RandomBNLt(curv->n), w};
+        for (int j = 0; j < 3; ++j) {
+            BN temp(0);
+            for (size_t i = 0; i < quorum.remote_party_indexes_.size(); ++i) {
+                const BN &r = rand_arr[i * outputs + slot * PRG_OUTPUTS_PER_SIGN + j];
+                if (quorum.local_party_index_ > quorum.remote_party_indexes_[i]) {
+                    temp += r;
+                } else {
+                    temp -= r;
+                }
+            }
+            blind[j] = (blind[j] + temp) % curv->n;
+        }
+        local.k_arr_.push_back(blind[0]);
+        local.phi_arr_.push_back(blind[1]);
+        local.w_arr_.push_back(blind[2]);
+        local.Gk_arr_.push_back(curv->g * blind[0]);
+    }
+}
+
+void AggregateSlots(const SignKey &sign_key, const std::vector<Round0BCMessage> &bc_message_arr,
+                    const std::vector<Round0P2PMessage> &p2p_message_arr, LocalTParty &local,
+                    std::vector<CurvePoint> &R_arr, std::vector<BN> &r_arr) {
+    const Curve * curv = GetCurveParam(sign_key.X_.GetCurveType());
+    for (size_t slot = 0; slot < local.k_arr_.size(); ++slot) {
+        CurvePoint GK = local.Gk_arr_[slot];
+        for (size_t i = 0; i < bc_message_arr.size(); ++i) {
+            GK += bc_message_arr[i].Gk_arr_[slot];
+        }
+        R_arr.push_back(GK);
+        r_arr.push_back(GK.x());
+
+        const BN &wi = local.w_arr_[slot];
+        const BN &ki = local.k_arr_[slot];
+        const BN &phii = local.phi_arr_[slot];
+        BN ui = wi * phii;
+        BN vi = ki * phii;
+        for (size_t i = 0; i < p2p_message_arr.size(); ++i) {
+            const Round0P2PMessage &msg = p2p_message_arr[i];
+            ui += (wi * msg.phi_arr_[slot] + phii * msg.w_arr_[slot]) % curv->n;
+            vi += (ki * msg.phi_arr_[slot] + phii * msg.k_arr_[slot]) % curv->n;
+        }
+        local.u_arr_.push_back(ui % curv->n);
+        local.v_arr_.push_back(vi % curv->n);
+    }
+}
+
+void SetZeroShares(size_t slot_count, Round0P2PMessage &p2p_message) {
+    p2p_message.k_arr_.assign(slot_count, BN(0));
+    p2p_message.w_arr_.assign(slot_count, BN(0));
+    p2p_message.phi_arr_.assign(slot_count, BN(0));
+}
+
+}
+}
+}
+}
@@ -0,0 +1,45 @@
+#ifndef SAFEHERON_MULTI_PARTY_ECDSA_Li24_BATCH_SIGN_SLOT_H
+#define SAFEHERON_MULTI_PARTY_ECDSA_Li24_BATCH_SIGN_SLOT_H
+
+#include <vector>
+#include "crypto-suites/crypto-bn/bn.h"
+#include "crypto-suites/crypto-curve/curve.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/sign_key.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/quorum.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/batch_sign/message.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/batch_sign/t_party.h"
+
+namespace safeheron {
+namespace multi_party_ecdsa{
+namespace Li24{
+namespace batch_sign{
+
+/**
+ * Round 0 of slot_count slots, shared by Li24::batch_sign and Li24::presign.
+ *
+ * Samples k_i and phi_i of every slot, blinds k_i, phi_i and w_i with the outputs of the remote parties' PRGs in the
+ * same order as slot_count runs of Li24::sign, and appends them and G * k_i to local.
+ */
+void SampleSlots(SignKey &sign_key, const Quorum &quorum, size_t slot_count, LocalTParty &local);
+
+/**
+ * Round 1 of every slot, shared by Li24::batch_sign and Li24::presign.
+ *
+ * Appends R = sum(G * k_j) and r = R.x to R_arr and r_arr, and u_i, v_i (mod q) built from the shares of the
+ * remote parties to local.
+ */
+void AggregateSlots(const SignKey &sign_key, const std::vector<Round0BCMessage> &bc_message_arr,
+                    const std::vector<Round0P2PMessage> &p2p_message_arr, LocalTParty &local,
+                    std::vector<safeheron::curve::CurvePoint> &R_arr, std::vector<safeheron::bignum::BN> &r_arr);
+
+/**
+ * Zero shares of slot_count slots, which stand for the empty payload sent outside the P2P window.
+ */
+void SetZeroShares(size_t slot_count, Round0P2PMessage &p2p_message);
+
+}
+}
+}
+}
+
+#endif //SAFEHERON_MULTI_PARTY_ECDSA_Li24_BATCH_SIGN_SLOT_H
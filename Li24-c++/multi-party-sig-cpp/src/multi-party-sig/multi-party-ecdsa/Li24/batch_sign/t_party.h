@@ -0,0 +1,44 @@
+#ifndef SAFEHERON_MULTI_PARTY_ECDSA_Li24_BATCH_SIGN_T_PARTY_H
+#define SAFEHERON_MULTI_PARTY_ECDSA_Li24_BATCH_SIGN_T_PARTY_H
+
+
+#include <vector>
+#include "crypto-suites/crypto-sss/vsss.h"
+#include "crypto-suites/crypto-bn/bn.h"
+#include "crypto-suites/crypto-curve/curve.h"
+
+namespace safeheron {
+namespace multi_party_ecdsa{
+namespace Li24{
+namespace batch_sign{
+
+/**
+ * Per-slot values of the local party; every array holds one entry per slot.
+ */
+class LocalTParty {
+public:
+    // Phase 1
+    safeheron::bignum::BN lambda_;
+    std::vector<safeheron::bignum::BN> l_arr_;
+    // - Sample phi, k and blind w for every slot
+    std::vector<safeheron::bignum::BN> phi_arr_;
+    std::vector<safeheron::bignum::BN> k_arr_;
+    std::vector<safeheron::bignum::BN> w_arr_;
+    // - Gk
+    std::vector<safeheron::curve::CurvePoint> Gk_arr_;
+
+    //Phase2
+    std::vector<safeheron::bignum::BN> u_arr_;
+    std::vector<safeheron::bignum::BN> v_arr_;
+    std::vector<safeheron::bignum::BN> delta_arr_;
+
+};
+
+
+}
+}
+}
+}
+
+
+#endif //SAFEHERON_MULTI_PARTY_ECDSA_Li24_BATCH_SIGN_T_PARTY_H
@@ -62,7 +62,9 @@ bool Context::CreateContext(Context &ctx,
                             const std::string &party_id,
                             const safeheron::bignum::BN &index,
                             const std::vector<std::string> &remote_party_id_arr,
-                            const std::vector<safeheron::bignum::BN> &remote_party_index_arr) {
+                            const std::vector<safeheron::bignum::BN> &remote_party_index_arr,
+                            PRGType prg_type,
+                            WireVersion wire_version) {
     ctx.curve_type_ = curve_type;
 
     // Alias name of SignKey
@@ -78,6 +80,8 @@ bool Context::CreateContext(Context &ctx,
     sign_key.workspace_id_ = workspace_id;
     sign_key.threshold_ = threshold;
     sign_key.n_parties_ = n_parties;
+    sign_key.prg_type_ = prg_type;
+    sign_key.wire_version_ = wire_version;
 
     // Local party
     sign_key.local_party_.party_id_ = party_id;
@@ -88,6 +92,7 @@ bool Context::CreateContext(Context &ctx,
         sign_key.remote_parties_.emplace_back();
         sign_key.remote_parties_[i].party_id_ = remote_party_id_arr[i];
         sign_key.remote_parties_[i].index_ = remote_party_index_arr[i];
+        sign_key.remote_parties_[i].prg.set_type(prg_type);
     }
 
 
@@ -98,6 +103,10 @@ bool Context::CreateContext(Context &ctx,
     return true;
 }
 
+bool Context::IsRemoteParty(const std::string &party_id) const {
+    return sign_key_.get_remote_party_pos(party_id) != -1;
+}
+
 void Context::BindAllRounds() {
     RemoveAllRounds();
     AddRound(&round0_);
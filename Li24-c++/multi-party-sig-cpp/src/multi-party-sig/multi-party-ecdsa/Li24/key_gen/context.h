@@ -37,6 +37,8 @@ public:
 public:
     void BindAllRounds();
 
+    bool IsRemoteParty(const std::string &party_id) const override;
+
     static bool CreateContext(Context &ctx,
                               safeheron::curve::CurveType curve_type,
                               const std::string &workspace_id,
@@ -45,7 +47,9 @@ public:
                               const std::string &party_id,
                               const safeheron::bignum::BN &index,
                               const std::vector<std::string> &remote_party_id_arr,
-                              const std::vector<safeheron::bignum::BN> &remote_party_index_arr);
+                              const std::vector<safeheron::bignum::BN> &remote_party_index_arr,
+                              PRGType prg_type = PRGType::HashChain,
+                              WireVersion wire_version = WireVersion::Hex);
 
 public:
     safeheron::curve::CurveType curve_type_;
@@ -5,6 +5,7 @@
 #include "crypto-suites/crypto-commitment/commitment.h"
 #include "crypto-suites/crypto-zkp/zkp.h"
 #include "multi-party-sig/multi-party-ecdsa/Li24/key_gen/proto_gen/key_gen.pb.switch.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/wire.h"
 
 namespace safeheron {
 namespace multi_party_ecdsa{
@@ -15,6 +16,8 @@ namespace key_gen {
 class Round0BCMessage {
 public:
     std::vector<safeheron::curve::CurvePoint> vs_;
+    // Wire version of the key the sender generates, all parties must agree on it
+    WireVersion wire_version_ = WireVersion::Hex;
 
 public:
     bool ToProtoObject(safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round0BCMessage &message)const ;
@@ -34,6 +37,7 @@ class Round0P2PMessage {
 public:
     safeheron::bignum::BN x_ij_;
     safeheron::bignum::BN e_ij_;
+    WireVersion wire_version_ = WireVersion::Hex;
 
 public:
     bool ToProtoObject(safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round0P2PMessage &message) const;
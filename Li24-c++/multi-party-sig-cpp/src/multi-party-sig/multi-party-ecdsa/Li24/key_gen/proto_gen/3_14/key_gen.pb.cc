@@ -71,6 +71,7 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_Li24_2fkey_5fgen_2eproto::offs
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round0BCMessage, vs_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round0BCMessage, wire_version_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round0P2PMessage, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -78,10 +79,12 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_Li24_2fkey_5fgen_2eproto::offs
   ~0u,  // no _weak_field_map_
   PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round0P2PMessage, e_ij_),
   PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round0P2PMessage, x_ij_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round0P2PMessage, e_ij_bin_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round0P2PMessage, x_ij_bin_),
 };
 static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round0BCMessage)},
-  { 6, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round0P2PMessage)},
+  { 7, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round0P2PMessage)},
 };
 
 static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
@@ -93,10 +96,11 @@ const char descriptor_table_protodef_Li24_2fkey_5fgen_2eproto[] PROTOBUF_SECTION
   "\n\022Li24/key_gen.proto\022.safeheron.proto.mu"
   "lti_party_ecdsa.Li24.key_gen\032\020commitment"
   ".proto\032\021curve_point.proto\032\016paillier.prot"
-  "o\032\tzkp.proto\":\n\017Round0BCMessage\022\'\n\002vs\030\001 "
-  "\003(\0132\033.safeheron.proto.CurvePoint\".\n\020Roun"
-  "d0P2PMessage\022\014\n\004e_ij\030\001 \001(\t\022\014\n\004x_ij\030\002 \001(\t"
-  "b\006proto3"
+  "o\032\tzkp.proto\"P\n\017Round0BCMessage\022\'\n\002vs\030\001 "
+  "\003(\0132\033.safeheron.proto.CurvePoint\022\024\n\014wire"
+  "_version\030\002 \001(\005\"R\n\020Round0P2PMessage\022\014\n\004e_"
+  "ij\030\001 \001(\t\022\014\n\004x_ij\030\002 \001(\t\022\020\n\010e_ij_bin\030\003 \001(\014"
+  "\022\020\n\010x_ij_bin\030\004 \001(\014b\006proto3"
   ;
 static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_Li24_2fkey_5fgen_2eproto_deps[4] = {
   &::descriptor_table_commitment_2eproto,
@@ -110,7 +114,7 @@ static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_Li2
 };
 static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_Li24_2fkey_5fgen_2eproto_once;
 const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_Li24_2fkey_5fgen_2eproto = {
-  false, false, descriptor_table_protodef_Li24_2fkey_5fgen_2eproto, "Li24/key_gen.proto", 248,
+  false, false, descriptor_table_protodef_Li24_2fkey_5fgen_2eproto, "Li24/key_gen.proto", 306,
   &descriptor_table_Li24_2fkey_5fgen_2eproto_once, descriptor_table_Li24_2fkey_5fgen_2eproto_sccs, descriptor_table_Li24_2fkey_5fgen_2eproto_deps, 2, 4,
   schemas, file_default_instances, TableStruct_Li24_2fkey_5fgen_2eproto::offsets,
   file_level_metadata_Li24_2fkey_5fgen_2eproto, 2, file_level_enum_descriptors_Li24_2fkey_5fgen_2eproto, file_level_service_descriptors_Li24_2fkey_5fgen_2eproto,
@@ -144,11 +148,13 @@ Round0BCMessage::Round0BCMessage(const Round0BCMessage& from)
   : ::PROTOBUF_NAMESPACE_ID::Message(),
       vs_(from.vs_) {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  wire_version_ = from.wire_version_;
   // @@protoc_insertion_point(copy_constructor:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage)
 }
 
 void Round0BCMessage::SharedCtor() {
   ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Round0BCMessage_Li24_2fkey_5fgen_2eproto.base);
+  wire_version_ = 0;
 }
 
 Round0BCMessage::~Round0BCMessage() {
@@ -183,6 +189,7 @@ void Round0BCMessage::Clear() {
   (void) cached_has_bits;
 
   vs_.Clear();
+  wire_version_ = 0;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -205,6 +212,13 @@ const char* Round0BCMessage::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPAC
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
         } else goto handle_unusual;
         continue;
+      // int32 wire_version = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
+          wire_version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
       default: {
       handle_unusual:
         if ((tag & 7) == 4 || tag == 0) {
@@ -241,6 +255,12 @@ failure:
       InternalWriteMessage(1, this->_internal_vs(i), target, stream);
   }
 
+  // int32 wire_version = 2;
+  if (this->wire_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(2, this->_internal_wire_version(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -264,6 +284,13 @@ size_t Round0BCMessage::ByteSizeLong() const {
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
+  // int32 wire_version = 2;
+  if (this->wire_version() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_wire_version());
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
         _internal_metadata_, total_size, &_cached_size_);
@@ -296,6 +323,9 @@ void Round0BCMessage::MergeFrom(const Round0BCMessage& from) {
   (void) cached_has_bits;
 
   vs_.MergeFrom(from.vs_);
+  if (from.wire_version() != 0) {
+    _internal_set_wire_version(from._internal_wire_version());
+  }
 }
 
 void Round0BCMessage::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
@@ -320,6 +350,7 @@ void Round0BCMessage::InternalSwap(Round0BCMessage* other) {
   using std::swap;
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
   vs_.InternalSwap(&other->vs_);
+  swap(wire_version_, other->wire_version_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Round0BCMessage::GetMetadata() const {
@@ -352,6 +383,16 @@ Round0P2PMessage::Round0P2PMessage(const Round0P2PMessage& from)
     x_ij_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_x_ij(), 
       GetArena());
   }
+  e_ij_bin_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_e_ij_bin().empty()) {
+    e_ij_bin_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_e_ij_bin(), 
+      GetArena());
+  }
+  x_ij_bin_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_x_ij_bin().empty()) {
+    x_ij_bin_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_x_ij_bin(), 
+      GetArena());
+  }
   // @@protoc_insertion_point(copy_constructor:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage)
 }
 
@@ -359,6 +400,8 @@ void Round0P2PMessage::SharedCtor() {
   ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Round0P2PMessage_Li24_2fkey_5fgen_2eproto.base);
   e_ij_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
   x_ij_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  e_ij_bin_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  x_ij_bin_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
 
 Round0P2PMessage::~Round0P2PMessage() {
@@ -371,6 +414,8 @@ void Round0P2PMessage::SharedDtor() {
   GOOGLE_DCHECK(GetArena() == nullptr);
   e_ij_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
   x_ij_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  e_ij_bin_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  x_ij_bin_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
 
 void Round0P2PMessage::ArenaDtor(void* object) {
@@ -396,6 +441,8 @@ void Round0P2PMessage::Clear() {
 
   e_ij_.ClearToEmpty();
   x_ij_.ClearToEmpty();
+  e_ij_bin_.ClearToEmpty();
+  x_ij_bin_.ClearToEmpty();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -424,6 +471,22 @@ const char* Round0P2PMessage::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPA
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
+      // bytes e_ij_bin = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+          auto str = _internal_mutable_e_ij_bin();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // bytes x_ij_bin = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+          auto str = _internal_mutable_x_ij_bin();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
       default: {
       handle_unusual:
         if ((tag & 7) == 4 || tag == 0) {
@@ -472,6 +535,18 @@ failure:
         2, this->_internal_x_ij(), target);
   }
 
+  // bytes e_ij_bin = 3;
+  if (this->e_ij_bin().size() > 0) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_e_ij_bin(), target);
+  }
+
+  // bytes x_ij_bin = 4;
+  if (this->x_ij_bin().size() > 0) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_x_ij_bin(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -502,6 +577,20 @@ size_t Round0P2PMessage::ByteSizeLong() const {
         this->_internal_x_ij());
   }
 
+  // bytes e_ij_bin = 3;
+  if (this->e_ij_bin().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_e_ij_bin());
+  }
+
+  // bytes x_ij_bin = 4;
+  if (this->x_ij_bin().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_x_ij_bin());
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
         _internal_metadata_, total_size, &_cached_size_);
@@ -539,6 +628,12 @@ void Round0P2PMessage::MergeFrom(const Round0P2PMessage& from) {
   if (from.x_ij().size() > 0) {
     _internal_set_x_ij(from._internal_x_ij());
   }
+  if (from.e_ij_bin().size() > 0) {
+    _internal_set_e_ij_bin(from._internal_e_ij_bin());
+  }
+  if (from.x_ij_bin().size() > 0) {
+    _internal_set_x_ij_bin(from._internal_x_ij_bin());
+  }
 }
 
 void Round0P2PMessage::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
@@ -564,6 +659,8 @@ void Round0P2PMessage::InternalSwap(Round0P2PMessage* other) {
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
   e_ij_.Swap(&other->e_ij_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
   x_ij_.Swap(&other->x_ij_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  e_ij_bin_.Swap(&other->e_ij_bin_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  x_ij_bin_.Swap(&other->x_ij_bin_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Round0P2PMessage::GetMetadata() const {
@@ -198,6 +198,7 @@ class Round0BCMessage PROTOBUF_FINAL :
 
   enum : int {
     kVsFieldNumber = 1,
+    kWireVersionFieldNumber = 2,
   };
   // repeated .safeheron.proto.CurvePoint vs = 1;
   int vs_size() const;
@@ -217,6 +218,15 @@ class Round0BCMessage PROTOBUF_FINAL :
   const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::safeheron::proto::CurvePoint >&
       vs() const;
 
+  // int32 wire_version = 2;
+  void clear_wire_version();
+  ::PROTOBUF_NAMESPACE_ID::int32 wire_version() const;
+  void set_wire_version(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_wire_version() const;
+  void _internal_set_wire_version(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
   // @@protoc_insertion_point(class_scope:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage)
  private:
   class _Internal;
@@ -225,6 +235,7 @@ class Round0BCMessage PROTOBUF_FINAL :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::safeheron::proto::CurvePoint > vs_;
+  ::PROTOBUF_NAMESPACE_ID::int32 wire_version_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_Li24_2fkey_5fgen_2eproto;
 };
@@ -344,6 +355,8 @@ class Round0P2PMessage PROTOBUF_FINAL :
   enum : int {
     kEIjFieldNumber = 1,
     kXIjFieldNumber = 2,
+    kEIjBinFieldNumber = 3,
+    kXIjBinFieldNumber = 4,
   };
   // string e_ij = 1;
   void clear_e_ij();
@@ -377,6 +390,38 @@ class Round0P2PMessage PROTOBUF_FINAL :
   std::string* _internal_mutable_x_ij();
   public:
 
+  // bytes e_ij_bin = 3;
+  void clear_e_ij_bin();
+  const std::string& e_ij_bin() const;
+  void set_e_ij_bin(const std::string& value);
+  void set_e_ij_bin(std::string&& value);
+  void set_e_ij_bin(const char* value);
+  void set_e_ij_bin(const void* value, size_t size);
+  std::string* mutable_e_ij_bin();
+  std::string* release_e_ij_bin();
+  void set_allocated_e_ij_bin(std::string* e_ij_bin);
+  private:
+  const std::string& _internal_e_ij_bin() const;
+  void _internal_set_e_ij_bin(const std::string& value);
+  std::string* _internal_mutable_e_ij_bin();
+  public:
+
+  // bytes x_ij_bin = 4;
+  void clear_x_ij_bin();
+  const std::string& x_ij_bin() const;
+  void set_x_ij_bin(const std::string& value);
+  void set_x_ij_bin(std::string&& value);
+  void set_x_ij_bin(const char* value);
+  void set_x_ij_bin(const void* value, size_t size);
+  std::string* mutable_x_ij_bin();
+  std::string* release_x_ij_bin();
+  void set_allocated_x_ij_bin(std::string* x_ij_bin);
+  private:
+  const std::string& _internal_x_ij_bin() const;
+  void _internal_set_x_ij_bin(const std::string& value);
+  std::string* _internal_mutable_x_ij_bin();
+  public:
+
   // @@protoc_insertion_point(class_scope:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage)
  private:
   class _Internal;
@@ -386,6 +431,8 @@ class Round0P2PMessage PROTOBUF_FINAL :
   typedef void DestructorSkippable_;
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr e_ij_;
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr x_ij_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr e_ij_bin_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr x_ij_bin_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_Li24_2fkey_5fgen_2eproto;
 };
@@ -436,6 +483,26 @@ Round0BCMessage::vs() const {
   return vs_;
 }
 
+// int32 wire_version = 2;
+inline void Round0BCMessage::clear_wire_version() {
+  wire_version_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 Round0BCMessage::_internal_wire_version() const {
+  return wire_version_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 Round0BCMessage::wire_version() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.wire_version)
+  return _internal_wire_version();
+}
+inline void Round0BCMessage::_internal_set_wire_version(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  wire_version_ = value;
+}
+inline void Round0BCMessage::set_wire_version(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_wire_version(value);
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.wire_version)
+}
+
 // -------------------------------------------------------------------
 
 // Round0P2PMessage
@@ -562,6 +629,128 @@ inline void Round0P2PMessage::set_allocated_x_ij(std::string* x_ij) {
   // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage.x_ij)
 }
 
+// bytes e_ij_bin = 3;
+inline void Round0P2PMessage::clear_e_ij_bin() {
+  e_ij_bin_.ClearToEmpty();
+}
+inline const std::string& Round0P2PMessage::e_ij_bin() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage.e_ij_bin)
+  return _internal_e_ij_bin();
+}
+inline void Round0P2PMessage::set_e_ij_bin(const std::string& value) {
+  _internal_set_e_ij_bin(value);
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage.e_ij_bin)
+}
+inline std::string* Round0P2PMessage::mutable_e_ij_bin() {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage.e_ij_bin)
+  return _internal_mutable_e_ij_bin();
+}
+inline const std::string& Round0P2PMessage::_internal_e_ij_bin() const {
+  return e_ij_bin_.Get();
+}
+inline void Round0P2PMessage::_internal_set_e_ij_bin(const std::string& value) {
+  
+  e_ij_bin_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+}
+inline void Round0P2PMessage::set_e_ij_bin(std::string&& value) {
+  
+  e_ij_bin_.Set(
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage.e_ij_bin)
+}
+inline void Round0P2PMessage::set_e_ij_bin(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  e_ij_bin_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
+  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage.e_ij_bin)
+}
+inline void Round0P2PMessage::set_e_ij_bin(const void* value,
+    size_t size) {
+  
+  e_ij_bin_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage.e_ij_bin)
+}
+inline std::string* Round0P2PMessage::_internal_mutable_e_ij_bin() {
+  
+  return e_ij_bin_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+}
+inline std::string* Round0P2PMessage::release_e_ij_bin() {
+  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage.e_ij_bin)
+  return e_ij_bin_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void Round0P2PMessage::set_allocated_e_ij_bin(std::string* e_ij_bin) {
+  if (e_ij_bin != nullptr) {
+    
+  } else {
+    
+  }
+  e_ij_bin_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), e_ij_bin,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage.e_ij_bin)
+}
+
+// bytes x_ij_bin = 4;
+inline void Round0P2PMessage::clear_x_ij_bin() {
+  x_ij_bin_.ClearToEmpty();
+}
+inline const std::string& Round0P2PMessage::x_ij_bin() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage.x_ij_bin)
+  return _internal_x_ij_bin();
+}
+inline void Round0P2PMessage::set_x_ij_bin(const std::string& value) {
+  _internal_set_x_ij_bin(value);
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage.x_ij_bin)
+}
+inline std::string* Round0P2PMessage::mutable_x_ij_bin() {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage.x_ij_bin)
+  return _internal_mutable_x_ij_bin();
+}
+inline const std::string& Round0P2PMessage::_internal_x_ij_bin() const {
+  return x_ij_bin_.Get();
+}
+inline void Round0P2PMessage::_internal_set_x_ij_bin(const std::string& value) {
+  
+  x_ij_bin_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+}
+inline void Round0P2PMessage::set_x_ij_bin(std::string&& value) {
+  
+  x_ij_bin_.Set(
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage.x_ij_bin)
+}
+inline void Round0P2PMessage::set_x_ij_bin(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  x_ij_bin_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
+  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage.x_ij_bin)
+}
+inline void Round0P2PMessage::set_x_ij_bin(const void* value,
+    size_t size) {
+  
+  x_ij_bin_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage.x_ij_bin)
+}
+inline std::string* Round0P2PMessage::_internal_mutable_x_ij_bin() {
+  
+  return x_ij_bin_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+}
+inline std::string* Round0P2PMessage::release_x_ij_bin() {
+  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage.x_ij_bin)
+  return x_ij_bin_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void Round0P2PMessage::set_allocated_x_ij_bin(std::string* x_ij_bin) {
+  if (x_ij_bin != nullptr) {
+    
+  } else {
+    
+  }
+  x_ij_bin_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), x_ij_bin,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage.x_ij_bin)
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
@@ -27,14 +27,8 @@ namespace Li24 {
 namespace key_gen {
 PROTOBUF_CONSTEXPR Round0BCMessage::Round0BCMessage(
     ::_pbi::ConstantInitialized)
-  : index_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , kgc_y_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , n_tilde_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , h1_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , h2_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , pail_pub_(nullptr)
-  , dln_proof1_(nullptr)
-  , dln_proof2_(nullptr){}
+  : vs_()
+  , wire_version_(0){}
 struct Round0BCMessageDefaultTypeInternal {
   PROTOBUF_CONSTEXPR Round0BCMessageDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -44,974 +38,127 @@ struct Round0BCMessageDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Round0BCMessageDefaultTypeInternal _Round0BCMessage_default_instance_;
-PROTOBUF_CONSTEXPR Round1BCMessage::Round1BCMessage(
-    ::_pbi::ConstantInitialized)
-  : vs_()
-  , kgd_y_(nullptr){}
-struct Round1BCMessageDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR Round1BCMessageDefaultTypeInternal()
-      : _instance(::_pbi::ConstantInitialized{}) {}
-  ~Round1BCMessageDefaultTypeInternal() {}
-  union {
-    Round1BCMessage _instance;
-  };
-};
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Round1BCMessageDefaultTypeInternal _Round1BCMessage_default_instance_;
-PROTOBUF_CONSTEXPR Round1P2PMessage::Round1P2PMessage(
-    ::_pbi::ConstantInitialized)
-  : x_ij_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , nsf_proof_(nullptr){}
-struct Round1P2PMessageDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR Round1P2PMessageDefaultTypeInternal()
-      : _instance(::_pbi::ConstantInitialized{}) {}
-  ~Round1P2PMessageDefaultTypeInternal() {}
-  union {
-    Round1P2PMessage _instance;
-  };
-};
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Round1P2PMessageDefaultTypeInternal _Round1P2PMessage_default_instance_;
-PROTOBUF_CONSTEXPR Round2BCMessage::Round2BCMessage(
+PROTOBUF_CONSTEXPR Round0P2PMessage::Round0P2PMessage(
     ::_pbi::ConstantInitialized)
-  : pub_(nullptr)
-  , dlog_proof_x_(nullptr)
-  , pail_proof_(nullptr){}
-struct Round2BCMessageDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR Round2BCMessageDefaultTypeInternal()
+  : e_ij_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
+  , x_ij_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
+  , e_ij_bin_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
+  , x_ij_bin_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}){}
+struct Round0P2PMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR Round0P2PMessageDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
-  ~Round2BCMessageDefaultTypeInternal() {}
+  ~Round0P2PMessageDefaultTypeInternal() {}
   union {
-    Round2BCMessage _instance;
+    Round0P2PMessage _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Round2BCMessageDefaultTypeInternal _Round2BCMessage_default_instance_;
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Round0P2PMessageDefaultTypeInternal _Round0P2PMessage_default_instance_;
 }  // namespace key_gen
 }  // namespace Li24
 }  // namespace multi_party_ecdsa
 }  // namespace proto
-}  // namespace safeheron
-static ::_pb::Metadata file_level_metadata_Li24_2fkey_5fgen_2eproto[4];
-static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_Li24_2fkey_5fgen_2eproto = nullptr;
-static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_Li24_2fkey_5fgen_2eproto = nullptr;
-
-const uint32_t TableStruct_Li24_2fkey_5fgen_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round0BCMessage, _internal_metadata_),
-  ~0u,  // no _extensions_
-  ~0u,  // no _oneof_case_
-  ~0u,  // no _weak_field_map_
-  ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round0BCMessage, index_),
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round0BCMessage, kgc_y_),
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round0BCMessage, pail_pub_),
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round0BCMessage, dln_proof1_),
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round0BCMessage, dln_proof2_),
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round0BCMessage, n_tilde_),
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round0BCMessage, h1_),
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round0BCMessage, h2_),
-  ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round1BCMessage, _internal_metadata_),
-  ~0u,  // no _extensions_
-  ~0u,  // no _oneof_case_
-  ~0u,  // no _weak_field_map_
-  ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round1BCMessage, kgd_y_),
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round1BCMessage, vs_),
-  ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round1P2PMessage, _internal_metadata_),
-  ~0u,  // no _extensions_
-  ~0u,  // no _oneof_case_
-  ~0u,  // no _weak_field_map_
-  ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round1P2PMessage, x_ij_),
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round1P2PMessage, nsf_proof_),
-  ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round2BCMessage, _internal_metadata_),
-  ~0u,  // no _extensions_
-  ~0u,  // no _oneof_case_
-  ~0u,  // no _weak_field_map_
-  ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round2BCMessage, pub_),
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round2BCMessage, dlog_proof_x_),
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round2BCMessage, pail_proof_),
-};
-static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round0BCMessage)},
-  { 14, -1, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round1BCMessage)},
-  { 22, -1, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round1P2PMessage)},
-  { 30, -1, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round2BCMessage)},
-};
-
-static const ::_pb::Message* const file_default_instances[] = {
-  &::safeheron::proto::multi_party_ecdsa::Li24::key_gen::_Round0BCMessage_default_instance_._instance,
-  &::safeheron::proto::multi_party_ecdsa::Li24::key_gen::_Round1BCMessage_default_instance_._instance,
-  &::safeheron::proto::multi_party_ecdsa::Li24::key_gen::_Round1P2PMessage_default_instance_._instance,
-  &::safeheron::proto::multi_party_ecdsa::Li24::key_gen::_Round2BCMessage_default_instance_._instance,
-};
-
-const char descriptor_table_protodef_Li24_2fkey_5fgen_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
-  "\n\022Li24/key_gen.proto\022.safeheron.proto.mu"
-  "lti_party_ecdsa.Li24.key_gen\032\020commitment"
-  ".proto\032\021curve_point.proto\032\016paillier.prot"
-  "o\032\tzkp.proto\"\342\001\n\017Round0BCMessage\022\r\n\005inde"
-  "x\030\001 \001(\t\022\r\n\005kgc_Y\030\003 \001(\t\022*\n\010pail_pub\030\004 \001(\013"
-  "2\030.safeheron.proto.PailPub\022-\n\ndln_proof1"
-  "\030\005 \001(\0132\031.safeheron.proto.DLNProof\022-\n\ndln"
-  "_proof2\030\006 \001(\0132\031.safeheron.proto.DLNProof"
-  "\022\017\n\007N_tilde\030\007 \001(\t\022\n\n\002h1\030\010 \001(\t\022\n\n\002h2\030\t \001("
-  "\t\"_\n\017Round1BCMessage\022#\n\005kgd_y\030\002 \001(\0132\024.sa"
-  "feheron.proto.KGD\022\'\n\002vs\030\004 \003(\0132\033.safehero"
-  "n.proto.CurvePoint\"X\n\020Round1P2PMessage\022\014"
-  "\n\004x_ij\030\003 \001(\t\0226\n\tnsf_proof\030\004 \001(\0132#.safehe"
-  "ron.proto.NoSmallFactorProof\"\250\001\n\017Round2B"
-  "CMessage\022(\n\003pub\030\001 \001(\0132\033.safeheron.proto."
-  "CurvePoint\0220\n\014dlog_proof_x\030\002 \001(\0132\032.safeh"
-  "eron.proto.DLogProof\0229\n\npail_proof\030\003 \001(\013"
-  "2%.safeheron.proto.PailBlumModulusProofb"
-  "\006proto3"
-  ;
-static const ::_pbi::DescriptorTable* const descriptor_table_Li24_2fkey_5fgen_2eproto_deps[4] = {
-  &::descriptor_table_commitment_2eproto,
-  &::descriptor_table_curve_5fpoint_2eproto,
-  &::descriptor_table_paillier_2eproto,
-  &::descriptor_table_zkp_2eproto,
-};
-static ::_pbi::once_flag descriptor_table_Li24_2fkey_5fgen_2eproto_once;
-const ::_pbi::DescriptorTable descriptor_table_Li24_2fkey_5fgen_2eproto = {
-    false, false, 727, descriptor_table_protodef_Li24_2fkey_5fgen_2eproto,
-    "Li24/key_gen.proto",
-    &descriptor_table_Li24_2fkey_5fgen_2eproto_once, descriptor_table_Li24_2fkey_5fgen_2eproto_deps, 4, 4,
-    schemas, file_default_instances, TableStruct_Li24_2fkey_5fgen_2eproto::offsets,
-    file_level_metadata_Li24_2fkey_5fgen_2eproto, file_level_enum_descriptors_Li24_2fkey_5fgen_2eproto,
-    file_level_service_descriptors_Li24_2fkey_5fgen_2eproto,
-};
-PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_Li24_2fkey_5fgen_2eproto_getter() {
-  return &descriptor_table_Li24_2fkey_5fgen_2eproto;
-}
-
-// Force running AddDescriptors() at dynamic initialization time.
-PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_Li24_2fkey_5fgen_2eproto(&descriptor_table_Li24_2fkey_5fgen_2eproto);
-namespace safeheron {
-namespace proto {
-namespace multi_party_ecdsa {
-namespace Li24 {
-namespace key_gen {
-
-// ===================================================================
-
-class Round0BCMessage::_Internal {
- public:
-  static const ::safeheron::proto::PailPub& pail_pub(const Round0BCMessage* msg);
-  static const ::safeheron::proto::DLNProof& dln_proof1(const Round0BCMessage* msg);
-  static const ::safeheron::proto::DLNProof& dln_proof2(const Round0BCMessage* msg);
-};
-
-const ::safeheron::proto::PailPub&
-Round0BCMessage::_Internal::pail_pub(const Round0BCMessage* msg) {
-  return *msg->pail_pub_;
-}
-const ::safeheron::proto::DLNProof&
-Round0BCMessage::_Internal::dln_proof1(const Round0BCMessage* msg) {
-  return *msg->dln_proof1_;
-}
-const ::safeheron::proto::DLNProof&
-Round0BCMessage::_Internal::dln_proof2(const Round0BCMessage* msg) {
-  return *msg->dln_proof2_;
-}
-void Round0BCMessage::clear_pail_pub() {
-  if (GetArenaForAllocation() == nullptr && pail_pub_ != nullptr) {
-    delete pail_pub_;
-  }
-  pail_pub_ = nullptr;
-}
-void Round0BCMessage::clear_dln_proof1() {
-  if (GetArenaForAllocation() == nullptr && dln_proof1_ != nullptr) {
-    delete dln_proof1_;
-  }
-  dln_proof1_ = nullptr;
-}
-void Round0BCMessage::clear_dln_proof2() {
-  if (GetArenaForAllocation() == nullptr && dln_proof2_ != nullptr) {
-    delete dln_proof2_;
-  }
-  dln_proof2_ = nullptr;
-}
-Round0BCMessage::Round0BCMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-                         bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
-  // @@protoc_insertion_point(arena_constructor:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage)
-}
-Round0BCMessage::Round0BCMessage(const Round0BCMessage& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message() {
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  index_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    index_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_index().empty()) {
-    index_.Set(from._internal_index(), 
-      GetArenaForAllocation());
-  }
-  kgc_y_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    kgc_y_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_kgc_y().empty()) {
-    kgc_y_.Set(from._internal_kgc_y(), 
-      GetArenaForAllocation());
-  }
-  n_tilde_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    n_tilde_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_n_tilde().empty()) {
-    n_tilde_.Set(from._internal_n_tilde(), 
-      GetArenaForAllocation());
-  }
-  h1_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    h1_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_h1().empty()) {
-    h1_.Set(from._internal_h1(), 
-      GetArenaForAllocation());
-  }
-  h2_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    h2_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_h2().empty()) {
-    h2_.Set(from._internal_h2(), 
-      GetArenaForAllocation());
-  }
-  if (from._internal_has_pail_pub()) {
-    pail_pub_ = new ::safeheron::proto::PailPub(*from.pail_pub_);
-  } else {
-    pail_pub_ = nullptr;
-  }
-  if (from._internal_has_dln_proof1()) {
-    dln_proof1_ = new ::safeheron::proto::DLNProof(*from.dln_proof1_);
-  } else {
-    dln_proof1_ = nullptr;
-  }
-  if (from._internal_has_dln_proof2()) {
-    dln_proof2_ = new ::safeheron::proto::DLNProof(*from.dln_proof2_);
-  } else {
-    dln_proof2_ = nullptr;
-  }
-  // @@protoc_insertion_point(copy_constructor:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage)
-}
-
-inline void Round0BCMessage::SharedCtor() {
-index_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  index_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-kgc_y_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  kgc_y_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-n_tilde_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  n_tilde_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-h1_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  h1_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-h2_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  h2_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-    reinterpret_cast<char*>(&pail_pub_) - reinterpret_cast<char*>(this)),
-    0, static_cast<size_t>(reinterpret_cast<char*>(&dln_proof2_) -
-    reinterpret_cast<char*>(&pail_pub_)) + sizeof(dln_proof2_));
-}
-
-Round0BCMessage::~Round0BCMessage() {
-  // @@protoc_insertion_point(destructor:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage)
-  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
-  (void)arena;
-    return;
-  }
-  SharedDtor();
-}
-
-inline void Round0BCMessage::SharedDtor() {
-  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  index_.Destroy();
-  kgc_y_.Destroy();
-  n_tilde_.Destroy();
-  h1_.Destroy();
-  h2_.Destroy();
-  if (this != internal_default_instance()) delete pail_pub_;
-  if (this != internal_default_instance()) delete dln_proof1_;
-  if (this != internal_default_instance()) delete dln_proof2_;
-}
-
-void Round0BCMessage::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-
-void Round0BCMessage::Clear() {
-// @@protoc_insertion_point(message_clear_start:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage)
-  uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  index_.ClearToEmpty();
-  kgc_y_.ClearToEmpty();
-  n_tilde_.ClearToEmpty();
-  h1_.ClearToEmpty();
-  h2_.ClearToEmpty();
-  if (GetArenaForAllocation() == nullptr && pail_pub_ != nullptr) {
-    delete pail_pub_;
-  }
-  pail_pub_ = nullptr;
-  if (GetArenaForAllocation() == nullptr && dln_proof1_ != nullptr) {
-    delete dln_proof1_;
-  }
-  dln_proof1_ = nullptr;
-  if (GetArenaForAllocation() == nullptr && dln_proof2_ != nullptr) {
-    delete dln_proof2_;
-  }
-  dln_proof2_ = nullptr;
-  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-const char* Round0BCMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
-#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  while (!ctx->Done(&ptr)) {
-    uint32_t tag;
-    ptr = ::_pbi::ReadTag(ptr, &tag);
-    switch (tag >> 3) {
-      // string index = 1;
-      case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_index();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.index"));
-        } else
-          goto handle_unusual;
-        continue;
-      // string kgc_Y = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          auto str = _internal_mutable_kgc_y();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.kgc_Y"));
-        } else
-          goto handle_unusual;
-        continue;
-      // .safeheron.proto.PailPub pail_pub = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
-          ptr = ctx->ParseMessage(_internal_mutable_pail_pub(), ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // .safeheron.proto.DLNProof dln_proof1 = 5;
-      case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
-          ptr = ctx->ParseMessage(_internal_mutable_dln_proof1(), ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // .safeheron.proto.DLNProof dln_proof2 = 6;
-      case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
-          ptr = ctx->ParseMessage(_internal_mutable_dln_proof2(), ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // string N_tilde = 7;
-      case 7:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
-          auto str = _internal_mutable_n_tilde();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.N_tilde"));
-        } else
-          goto handle_unusual;
-        continue;
-      // string h1 = 8;
-      case 8:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
-          auto str = _internal_mutable_h1();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.h1"));
-        } else
-          goto handle_unusual;
-        continue;
-      // string h2 = 9;
-      case 9:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
-          auto str = _internal_mutable_h2();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.h2"));
-        } else
-          goto handle_unusual;
-        continue;
-      default:
-        goto handle_unusual;
-    }  // switch
-  handle_unusual:
-    if ((tag == 0) || ((tag & 7) == 4)) {
-      CHK_(ptr);
-      ctx->SetLastTag(tag);
-      goto message_done;
-    }
-    ptr = UnknownFieldParse(
-        tag,
-        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-        ptr, ctx);
-    CHK_(ptr != nullptr);
-  }  // while
-message_done:
-  return ptr;
-failure:
-  ptr = nullptr;
-  goto message_done;
-#undef CHK_
-}
-
-uint8_t* Round0BCMessage::_InternalSerialize(
-    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage)
-  uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // string index = 1;
-  if (!this->_internal_index().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_index().data(), static_cast<int>(this->_internal_index().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.index");
-    target = stream->WriteStringMaybeAliased(
-        1, this->_internal_index(), target);
-  }
-
-  // string kgc_Y = 3;
-  if (!this->_internal_kgc_y().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_kgc_y().data(), static_cast<int>(this->_internal_kgc_y().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.kgc_Y");
-    target = stream->WriteStringMaybeAliased(
-        3, this->_internal_kgc_y(), target);
-  }
-
-  // .safeheron.proto.PailPub pail_pub = 4;
-  if (this->_internal_has_pail_pub()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(4, _Internal::pail_pub(this),
-        _Internal::pail_pub(this).GetCachedSize(), target, stream);
-  }
-
-  // .safeheron.proto.DLNProof dln_proof1 = 5;
-  if (this->_internal_has_dln_proof1()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(5, _Internal::dln_proof1(this),
-        _Internal::dln_proof1(this).GetCachedSize(), target, stream);
-  }
-
-  // .safeheron.proto.DLNProof dln_proof2 = 6;
-  if (this->_internal_has_dln_proof2()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(6, _Internal::dln_proof2(this),
-        _Internal::dln_proof2(this).GetCachedSize(), target, stream);
-  }
-
-  // string N_tilde = 7;
-  if (!this->_internal_n_tilde().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_n_tilde().data(), static_cast<int>(this->_internal_n_tilde().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.N_tilde");
-    target = stream->WriteStringMaybeAliased(
-        7, this->_internal_n_tilde(), target);
-  }
-
-  // string h1 = 8;
-  if (!this->_internal_h1().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_h1().data(), static_cast<int>(this->_internal_h1().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.h1");
-    target = stream->WriteStringMaybeAliased(
-        8, this->_internal_h1(), target);
-  }
-
-  // string h2 = 9;
-  if (!this->_internal_h2().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_h2().data(), static_cast<int>(this->_internal_h2().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.h2");
-    target = stream->WriteStringMaybeAliased(
-        9, this->_internal_h2(), target);
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage)
-  return target;
-}
-
-size_t Round0BCMessage::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage)
-  size_t total_size = 0;
-
-  uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  // string index = 1;
-  if (!this->_internal_index().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_index());
-  }
-
-  // string kgc_Y = 3;
-  if (!this->_internal_kgc_y().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_kgc_y());
-  }
-
-  // string N_tilde = 7;
-  if (!this->_internal_n_tilde().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_n_tilde());
-  }
-
-  // string h1 = 8;
-  if (!this->_internal_h1().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_h1());
-  }
-
-  // string h2 = 9;
-  if (!this->_internal_h2().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_h2());
-  }
-
-  // .safeheron.proto.PailPub pail_pub = 4;
-  if (this->_internal_has_pail_pub()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *pail_pub_);
-  }
-
-  // .safeheron.proto.DLNProof dln_proof1 = 5;
-  if (this->_internal_has_dln_proof1()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *dln_proof1_);
-  }
-
-  // .safeheron.proto.DLNProof dln_proof2 = 6;
-  if (this->_internal_has_dln_proof2()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *dln_proof2_);
-  }
-
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
-}
-
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Round0BCMessage::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
-    Round0BCMessage::MergeImpl
-};
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Round0BCMessage::GetClassData() const { return &_class_data_; }
-
-void Round0BCMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<Round0BCMessage *>(to)->MergeFrom(
-      static_cast<const Round0BCMessage &>(from));
-}
-
-
-void Round0BCMessage::MergeFrom(const Round0BCMessage& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage)
-  GOOGLE_DCHECK_NE(&from, this);
-  uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_index().empty()) {
-    _internal_set_index(from._internal_index());
-  }
-  if (!from._internal_kgc_y().empty()) {
-    _internal_set_kgc_y(from._internal_kgc_y());
-  }
-  if (!from._internal_n_tilde().empty()) {
-    _internal_set_n_tilde(from._internal_n_tilde());
-  }
-  if (!from._internal_h1().empty()) {
-    _internal_set_h1(from._internal_h1());
-  }
-  if (!from._internal_h2().empty()) {
-    _internal_set_h2(from._internal_h2());
-  }
-  if (from._internal_has_pail_pub()) {
-    _internal_mutable_pail_pub()->::safeheron::proto::PailPub::MergeFrom(from._internal_pail_pub());
-  }
-  if (from._internal_has_dln_proof1()) {
-    _internal_mutable_dln_proof1()->::safeheron::proto::DLNProof::MergeFrom(from._internal_dln_proof1());
-  }
-  if (from._internal_has_dln_proof2()) {
-    _internal_mutable_dln_proof2()->::safeheron::proto::DLNProof::MergeFrom(from._internal_dln_proof2());
-  }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void Round0BCMessage::CopyFrom(const Round0BCMessage& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool Round0BCMessage::IsInitialized() const {
-  return true;
-}
-
-void Round0BCMessage::InternalSwap(Round0BCMessage* other) {
-  using std::swap;
-  auto* lhs_arena = GetArenaForAllocation();
-  auto* rhs_arena = other->GetArenaForAllocation();
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &index_, lhs_arena,
-      &other->index_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &kgc_y_, lhs_arena,
-      &other->kgc_y_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &n_tilde_, lhs_arena,
-      &other->n_tilde_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &h1_, lhs_arena,
-      &other->h1_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &h2_, lhs_arena,
-      &other->h2_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Round0BCMessage, dln_proof2_)
-      + sizeof(Round0BCMessage::dln_proof2_)
-      - PROTOBUF_FIELD_OFFSET(Round0BCMessage, pail_pub_)>(
-          reinterpret_cast<char*>(&pail_pub_),
-          reinterpret_cast<char*>(&other->pail_pub_));
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata Round0BCMessage::GetMetadata() const {
-  return ::_pbi::AssignDescriptors(
-      &descriptor_table_Li24_2fkey_5fgen_2eproto_getter, &descriptor_table_Li24_2fkey_5fgen_2eproto_once,
-      file_level_metadata_Li24_2fkey_5fgen_2eproto[0]);
-}
-
-// ===================================================================
-
-class Round1BCMessage::_Internal {
- public:
-  static const ::safeheron::proto::KGD& kgd_y(const Round1BCMessage* msg);
-};
-
-const ::safeheron::proto::KGD&
-Round1BCMessage::_Internal::kgd_y(const Round1BCMessage* msg) {
-  return *msg->kgd_y_;
-}
-void Round1BCMessage::clear_kgd_y() {
-  if (GetArenaForAllocation() == nullptr && kgd_y_ != nullptr) {
-    delete kgd_y_;
-  }
-  kgd_y_ = nullptr;
-}
-void Round1BCMessage::clear_vs() {
-  vs_.Clear();
-}
-Round1BCMessage::Round1BCMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-                         bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned),
-  vs_(arena) {
-  SharedCtor();
-  // @@protoc_insertion_point(arena_constructor:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round1BCMessage)
-}
-Round1BCMessage::Round1BCMessage(const Round1BCMessage& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      vs_(from.vs_) {
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  if (from._internal_has_kgd_y()) {
-    kgd_y_ = new ::safeheron::proto::KGD(*from.kgd_y_);
-  } else {
-    kgd_y_ = nullptr;
-  }
-  // @@protoc_insertion_point(copy_constructor:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round1BCMessage)
-}
-
-inline void Round1BCMessage::SharedCtor() {
-kgd_y_ = nullptr;
-}
-
-Round1BCMessage::~Round1BCMessage() {
-  // @@protoc_insertion_point(destructor:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round1BCMessage)
-  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
-  (void)arena;
-    return;
-  }
-  SharedDtor();
-}
-
-inline void Round1BCMessage::SharedDtor() {
-  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  if (this != internal_default_instance()) delete kgd_y_;
-}
-
-void Round1BCMessage::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-
-void Round1BCMessage::Clear() {
-// @@protoc_insertion_point(message_clear_start:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round1BCMessage)
-  uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  vs_.Clear();
-  if (GetArenaForAllocation() == nullptr && kgd_y_ != nullptr) {
-    delete kgd_y_;
-  }
-  kgd_y_ = nullptr;
-  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-const char* Round1BCMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
-#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  while (!ctx->Done(&ptr)) {
-    uint32_t tag;
-    ptr = ::_pbi::ReadTag(ptr, &tag);
-    switch (tag >> 3) {
-      // .safeheron.proto.KGD kgd_y = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          ptr = ctx->ParseMessage(_internal_mutable_kgd_y(), ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // repeated .safeheron.proto.CurvePoint vs = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_vs(), ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
-        } else
-          goto handle_unusual;
-        continue;
-      default:
-        goto handle_unusual;
-    }  // switch
-  handle_unusual:
-    if ((tag == 0) || ((tag & 7) == 4)) {
-      CHK_(ptr);
-      ctx->SetLastTag(tag);
-      goto message_done;
-    }
-    ptr = UnknownFieldParse(
-        tag,
-        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-        ptr, ctx);
-    CHK_(ptr != nullptr);
-  }  // while
-message_done:
-  return ptr;
-failure:
-  ptr = nullptr;
-  goto message_done;
-#undef CHK_
-}
-
-uint8_t* Round1BCMessage::_InternalSerialize(
-    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round1BCMessage)
-  uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // .safeheron.proto.KGD kgd_y = 2;
-  if (this->_internal_has_kgd_y()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(2, _Internal::kgd_y(this),
-        _Internal::kgd_y(this).GetCachedSize(), target, stream);
-  }
-
-  // repeated .safeheron.proto.CurvePoint vs = 4;
-  for (unsigned i = 0,
-      n = static_cast<unsigned>(this->_internal_vs_size()); i < n; i++) {
-    const auto& repfield = this->_internal_vs(i);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round1BCMessage)
-  return target;
-}
-
-size_t Round1BCMessage::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round1BCMessage)
-  size_t total_size = 0;
-
-  uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  // repeated .safeheron.proto.CurvePoint vs = 4;
-  total_size += 1UL * this->_internal_vs_size();
-  for (const auto& msg : this->vs_) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
-  }
-
-  // .safeheron.proto.KGD kgd_y = 2;
-  if (this->_internal_has_kgd_y()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *kgd_y_);
-  }
-
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
-}
-
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Round1BCMessage::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
-    Round1BCMessage::MergeImpl
-};
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Round1BCMessage::GetClassData() const { return &_class_data_; }
-
-void Round1BCMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<Round1BCMessage *>(to)->MergeFrom(
-      static_cast<const Round1BCMessage &>(from));
-}
-
-
-void Round1BCMessage::MergeFrom(const Round1BCMessage& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round1BCMessage)
-  GOOGLE_DCHECK_NE(&from, this);
-  uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  vs_.MergeFrom(from.vs_);
-  if (from._internal_has_kgd_y()) {
-    _internal_mutable_kgd_y()->::safeheron::proto::KGD::MergeFrom(from._internal_kgd_y());
-  }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-}
+}  // namespace safeheron
+static ::_pb::Metadata file_level_metadata_Li24_2fkey_5fgen_2eproto[2];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_Li24_2fkey_5fgen_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_Li24_2fkey_5fgen_2eproto = nullptr;
 
-void Round1BCMessage::CopyFrom(const Round1BCMessage& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round1BCMessage)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
+const uint32_t TableStruct_Li24_2fkey_5fgen_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round0BCMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round0BCMessage, vs_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round0BCMessage, wire_version_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round0P2PMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round0P2PMessage, e_ij_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round0P2PMessage, x_ij_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round0P2PMessage, e_ij_bin_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round0P2PMessage, x_ij_bin_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round0BCMessage)},
+  { 8, -1, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round0P2PMessage)},
+};
 
-bool Round1BCMessage::IsInitialized() const {
-  return true;
-}
+static const ::_pb::Message* const file_default_instances[] = {
+  &::safeheron::proto::multi_party_ecdsa::Li24::key_gen::_Round0BCMessage_default_instance_._instance,
+  &::safeheron::proto::multi_party_ecdsa::Li24::key_gen::_Round0P2PMessage_default_instance_._instance,
+};
 
-void Round1BCMessage::InternalSwap(Round1BCMessage* other) {
-  using std::swap;
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  vs_.InternalSwap(&other->vs_);
-  swap(kgd_y_, other->kgd_y_);
+const char descriptor_table_protodef_Li24_2fkey_5fgen_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\022Li24/key_gen.proto\022.safeheron.proto.mu"
+  "lti_party_ecdsa.Li24.key_gen\032\020commitment"
+  ".proto\032\021curve_point.proto\032\016paillier.prot"
+  "o\032\tzkp.proto\"P\n\017Round0BCMessage\022\'\n\002vs\030\001 "
+  "\003(\0132\033.safeheron.proto.CurvePoint\022\024\n\014wire"
+  "_version\030\002 \001(\005\"R\n\020Round0P2PMessage\022\014\n\004e_"
+  "ij\030\001 \001(\t\022\014\n\004x_ij\030\002 \001(\t\022\020\n\010e_ij_bin\030\003 \001(\014"
+  "\022\020\n\010x_ij_bin\030\004 \001(\014b\006proto3"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_Li24_2fkey_5fgen_2eproto_deps[4] = {
+  &::descriptor_table_commitment_2eproto,
+  &::descriptor_table_curve_5fpoint_2eproto,
+  &::descriptor_table_paillier_2eproto,
+  &::descriptor_table_zkp_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_Li24_2fkey_5fgen_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_Li24_2fkey_5fgen_2eproto = {
+    false, false, 306, descriptor_table_protodef_Li24_2fkey_5fgen_2eproto,
+    "Li24/key_gen.proto",
+    &descriptor_table_Li24_2fkey_5fgen_2eproto_once, descriptor_table_Li24_2fkey_5fgen_2eproto_deps, 4, 2,
+    schemas, file_default_instances, TableStruct_Li24_2fkey_5fgen_2eproto::offsets,
+    file_level_metadata_Li24_2fkey_5fgen_2eproto, file_level_enum_descriptors_Li24_2fkey_5fgen_2eproto,
+    file_level_service_descriptors_Li24_2fkey_5fgen_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_Li24_2fkey_5fgen_2eproto_getter() {
+  return &descriptor_table_Li24_2fkey_5fgen_2eproto;
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata Round1BCMessage::GetMetadata() const {
-  return ::_pbi::AssignDescriptors(
-      &descriptor_table_Li24_2fkey_5fgen_2eproto_getter, &descriptor_table_Li24_2fkey_5fgen_2eproto_once,
-      file_level_metadata_Li24_2fkey_5fgen_2eproto[1]);
-}
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_Li24_2fkey_5fgen_2eproto(&descriptor_table_Li24_2fkey_5fgen_2eproto);
+namespace safeheron {
+namespace proto {
+namespace multi_party_ecdsa {
+namespace Li24 {
+namespace key_gen {
 
 // ===================================================================
 
-class Round1P2PMessage::_Internal {
+class Round0BCMessage::_Internal {
  public:
-  static const ::safeheron::proto::NoSmallFactorProof& nsf_proof(const Round1P2PMessage* msg);
 };
 
-const ::safeheron::proto::NoSmallFactorProof&
-Round1P2PMessage::_Internal::nsf_proof(const Round1P2PMessage* msg) {
-  return *msg->nsf_proof_;
-}
-void Round1P2PMessage::clear_nsf_proof() {
-  if (GetArenaForAllocation() == nullptr && nsf_proof_ != nullptr) {
-    delete nsf_proof_;
-  }
-  nsf_proof_ = nullptr;
+void Round0BCMessage::clear_vs() {
+  vs_.Clear();
 }
-Round1P2PMessage::Round1P2PMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+Round0BCMessage::Round0BCMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned),
+  vs_(arena) {
   SharedCtor();
-  // @@protoc_insertion_point(arena_constructor:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round1P2PMessage)
+  // @@protoc_insertion_point(arena_constructor:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage)
 }
-Round1P2PMessage::Round1P2PMessage(const Round1P2PMessage& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message() {
+Round0BCMessage::Round0BCMessage(const Round0BCMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      vs_(from.vs_) {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  x_ij_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    x_ij_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_x_ij().empty()) {
-    x_ij_.Set(from._internal_x_ij(), 
-      GetArenaForAllocation());
-  }
-  if (from._internal_has_nsf_proof()) {
-    nsf_proof_ = new ::safeheron::proto::NoSmallFactorProof(*from.nsf_proof_);
-  } else {
-    nsf_proof_ = nullptr;
-  }
-  // @@protoc_insertion_point(copy_constructor:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round1P2PMessage)
+  wire_version_ = from.wire_version_;
+  // @@protoc_insertion_point(copy_constructor:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage)
 }
 
-inline void Round1P2PMessage::SharedCtor() {
-x_ij_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  x_ij_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-nsf_proof_ = nullptr;
+inline void Round0BCMessage::SharedCtor() {
+wire_version_ = 0;
 }
 
-Round1P2PMessage::~Round1P2PMessage() {
-  // @@protoc_insertion_point(destructor:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round1P2PMessage)
+Round0BCMessage::~Round0BCMessage() {
+  // @@protoc_insertion_point(destructor:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -1019,50 +166,48 @@ Round1P2PMessage::~Round1P2PMessage() {
   SharedDtor();
 }
 
-inline void Round1P2PMessage::SharedDtor() {
+inline void Round0BCMessage::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  x_ij_.Destroy();
-  if (this != internal_default_instance()) delete nsf_proof_;
 }
 
-void Round1P2PMessage::SetCachedSize(int size) const {
+void Round0BCMessage::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
 
-void Round1P2PMessage::Clear() {
-// @@protoc_insertion_point(message_clear_start:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round1P2PMessage)
+void Round0BCMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  x_ij_.ClearToEmpty();
-  if (GetArenaForAllocation() == nullptr && nsf_proof_ != nullptr) {
-    delete nsf_proof_;
-  }
-  nsf_proof_ = nullptr;
+  vs_.Clear();
+  wire_version_ = 0;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Round1P2PMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* Round0BCMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string x_ij = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          auto str = _internal_mutable_x_ij();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round1P2PMessage.x_ij"));
+      // repeated .safeheron.proto.CurvePoint vs = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_vs(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
         } else
           goto handle_unusual;
         continue;
-      // .safeheron.proto.NoSmallFactorProof nsf_proof = 4;
-      case 4:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
-          ptr = ctx->ParseMessage(_internal_mutable_nsf_proof(), ptr);
+      // int32 wire_version = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          wire_version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -1090,194 +235,178 @@ failure:
 #undef CHK_
 }
 
-uint8_t* Round1P2PMessage::_InternalSerialize(
+uint8_t* Round0BCMessage::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round1P2PMessage)
+  // @@protoc_insertion_point(serialize_to_array_start:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string x_ij = 3;
-  if (!this->_internal_x_ij().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_x_ij().data(), static_cast<int>(this->_internal_x_ij().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round1P2PMessage.x_ij");
-    target = stream->WriteStringMaybeAliased(
-        3, this->_internal_x_ij(), target);
+  // repeated .safeheron.proto.CurvePoint vs = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_vs_size()); i < n; i++) {
+    const auto& repfield = this->_internal_vs(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
-  // .safeheron.proto.NoSmallFactorProof nsf_proof = 4;
-  if (this->_internal_has_nsf_proof()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(4, _Internal::nsf_proof(this),
-        _Internal::nsf_proof(this).GetCachedSize(), target, stream);
+  // int32 wire_version = 2;
+  if (this->_internal_wire_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_wire_version(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round1P2PMessage)
+  // @@protoc_insertion_point(serialize_to_array_end:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage)
   return target;
 }
 
-size_t Round1P2PMessage::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round1P2PMessage)
+size_t Round0BCMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string x_ij = 3;
-  if (!this->_internal_x_ij().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_x_ij());
+  // repeated .safeheron.proto.CurvePoint vs = 1;
+  total_size += 1UL * this->_internal_vs_size();
+  for (const auto& msg : this->vs_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
-  // .safeheron.proto.NoSmallFactorProof nsf_proof = 4;
-  if (this->_internal_has_nsf_proof()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *nsf_proof_);
+  // int32 wire_version = 2;
+  if (this->_internal_wire_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_wire_version());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Round1P2PMessage::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Round0BCMessage::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
-    Round1P2PMessage::MergeImpl
+    Round0BCMessage::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Round1P2PMessage::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Round0BCMessage::GetClassData() const { return &_class_data_; }
 
-void Round1P2PMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
+void Round0BCMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
                       const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<Round1P2PMessage *>(to)->MergeFrom(
-      static_cast<const Round1P2PMessage &>(from));
+  static_cast<Round0BCMessage *>(to)->MergeFrom(
+      static_cast<const Round0BCMessage &>(from));
 }
 
 
-void Round1P2PMessage::MergeFrom(const Round1P2PMessage& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round1P2PMessage)
+void Round0BCMessage::MergeFrom(const Round0BCMessage& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage)
   GOOGLE_DCHECK_NE(&from, this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!from._internal_x_ij().empty()) {
-    _internal_set_x_ij(from._internal_x_ij());
-  }
-  if (from._internal_has_nsf_proof()) {
-    _internal_mutable_nsf_proof()->::safeheron::proto::NoSmallFactorProof::MergeFrom(from._internal_nsf_proof());
+  vs_.MergeFrom(from.vs_);
+  if (from._internal_wire_version() != 0) {
+    _internal_set_wire_version(from._internal_wire_version());
   }
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Round1P2PMessage::CopyFrom(const Round1P2PMessage& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round1P2PMessage)
+void Round0BCMessage::CopyFrom(const Round0BCMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Round1P2PMessage::IsInitialized() const {
+bool Round0BCMessage::IsInitialized() const {
   return true;
 }
 
-void Round1P2PMessage::InternalSwap(Round1P2PMessage* other) {
+void Round0BCMessage::InternalSwap(Round0BCMessage* other) {
   using std::swap;
-  auto* lhs_arena = GetArenaForAllocation();
-  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &x_ij_, lhs_arena,
-      &other->x_ij_, rhs_arena
-  );
-  swap(nsf_proof_, other->nsf_proof_);
+  vs_.InternalSwap(&other->vs_);
+  swap(wire_version_, other->wire_version_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata Round1P2PMessage::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata Round0BCMessage::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_Li24_2fkey_5fgen_2eproto_getter, &descriptor_table_Li24_2fkey_5fgen_2eproto_once,
-      file_level_metadata_Li24_2fkey_5fgen_2eproto[2]);
+      file_level_metadata_Li24_2fkey_5fgen_2eproto[0]);
 }
 
 // ===================================================================
 
-class Round2BCMessage::_Internal {
+class Round0P2PMessage::_Internal {
  public:
-  static const ::safeheron::proto::CurvePoint& pub(const Round2BCMessage* msg);
-  static const ::safeheron::proto::DLogProof& dlog_proof_x(const Round2BCMessage* msg);
-  static const ::safeheron::proto::PailBlumModulusProof& pail_proof(const Round2BCMessage* msg);
 };
 
-const ::safeheron::proto::CurvePoint&
-Round2BCMessage::_Internal::pub(const Round2BCMessage* msg) {
-  return *msg->pub_;
-}
-const ::safeheron::proto::DLogProof&
-Round2BCMessage::_Internal::dlog_proof_x(const Round2BCMessage* msg) {
-  return *msg->dlog_proof_x_;
-}
-const ::safeheron::proto::PailBlumModulusProof&
-Round2BCMessage::_Internal::pail_proof(const Round2BCMessage* msg) {
-  return *msg->pail_proof_;
-}
-void Round2BCMessage::clear_pub() {
-  if (GetArenaForAllocation() == nullptr && pub_ != nullptr) {
-    delete pub_;
-  }
-  pub_ = nullptr;
-}
-void Round2BCMessage::clear_dlog_proof_x() {
-  if (GetArenaForAllocation() == nullptr && dlog_proof_x_ != nullptr) {
-    delete dlog_proof_x_;
-  }
-  dlog_proof_x_ = nullptr;
-}
-void Round2BCMessage::clear_pail_proof() {
-  if (GetArenaForAllocation() == nullptr && pail_proof_ != nullptr) {
-    delete pail_proof_;
-  }
-  pail_proof_ = nullptr;
-}
-Round2BCMessage::Round2BCMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+Round0P2PMessage::Round0P2PMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor();
-  // @@protoc_insertion_point(arena_constructor:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round2BCMessage)
+  // @@protoc_insertion_point(arena_constructor:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage)
 }
-Round2BCMessage::Round2BCMessage(const Round2BCMessage& from)
+Round0P2PMessage::Round0P2PMessage(const Round0P2PMessage& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  if (from._internal_has_pub()) {
-    pub_ = new ::safeheron::proto::CurvePoint(*from.pub_);
-  } else {
-    pub_ = nullptr;
+  e_ij_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    e_ij_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_e_ij().empty()) {
+    e_ij_.Set(from._internal_e_ij(), 
+      GetArenaForAllocation());
+  }
+  x_ij_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    x_ij_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_x_ij().empty()) {
+    x_ij_.Set(from._internal_x_ij(), 
+      GetArenaForAllocation());
   }
-  if (from._internal_has_dlog_proof_x()) {
-    dlog_proof_x_ = new ::safeheron::proto::DLogProof(*from.dlog_proof_x_);
-  } else {
-    dlog_proof_x_ = nullptr;
+  e_ij_bin_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    e_ij_bin_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_e_ij_bin().empty()) {
+    e_ij_bin_.Set(from._internal_e_ij_bin(), 
+      GetArenaForAllocation());
   }
-  if (from._internal_has_pail_proof()) {
-    pail_proof_ = new ::safeheron::proto::PailBlumModulusProof(*from.pail_proof_);
-  } else {
-    pail_proof_ = nullptr;
+  x_ij_bin_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    x_ij_bin_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_x_ij_bin().empty()) {
+    x_ij_bin_.Set(from._internal_x_ij_bin(), 
+      GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(copy_constructor:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round2BCMessage)
+  // @@protoc_insertion_point(copy_constructor:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage)
 }
 
-inline void Round2BCMessage::SharedCtor() {
-::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-    reinterpret_cast<char*>(&pub_) - reinterpret_cast<char*>(this)),
-    0, static_cast<size_t>(reinterpret_cast<char*>(&pail_proof_) -
-    reinterpret_cast<char*>(&pub_)) + sizeof(pail_proof_));
+inline void Round0P2PMessage::SharedCtor() {
+e_ij_.InitDefault();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  e_ij_.Set("", GetArenaForAllocation());
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+x_ij_.InitDefault();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  x_ij_.Set("", GetArenaForAllocation());
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+e_ij_bin_.InitDefault();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  e_ij_bin_.Set("", GetArenaForAllocation());
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+x_ij_bin_.InitDefault();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  x_ij_bin_.Set("", GetArenaForAllocation());
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-Round2BCMessage::~Round2BCMessage() {
-  // @@protoc_insertion_point(destructor:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round2BCMessage)
+Round0P2PMessage::~Round0P2PMessage() {
+  // @@protoc_insertion_point(destructor:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -1285,64 +414,71 @@ Round2BCMessage::~Round2BCMessage() {
   SharedDtor();
 }
 
-inline void Round2BCMessage::SharedDtor() {
+inline void Round0P2PMessage::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  if (this != internal_default_instance()) delete pub_;
-  if (this != internal_default_instance()) delete dlog_proof_x_;
-  if (this != internal_default_instance()) delete pail_proof_;
+  e_ij_.Destroy();
+  x_ij_.Destroy();
+  e_ij_bin_.Destroy();
+  x_ij_bin_.Destroy();
 }
 
-void Round2BCMessage::SetCachedSize(int size) const {
+void Round0P2PMessage::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
 
-void Round2BCMessage::Clear() {
-// @@protoc_insertion_point(message_clear_start:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round2BCMessage)
+void Round0P2PMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaForAllocation() == nullptr && pub_ != nullptr) {
-    delete pub_;
-  }
-  pub_ = nullptr;
-  if (GetArenaForAllocation() == nullptr && dlog_proof_x_ != nullptr) {
-    delete dlog_proof_x_;
-  }
-  dlog_proof_x_ = nullptr;
-  if (GetArenaForAllocation() == nullptr && pail_proof_ != nullptr) {
-    delete pail_proof_;
-  }
-  pail_proof_ = nullptr;
+  e_ij_.ClearToEmpty();
+  x_ij_.ClearToEmpty();
+  e_ij_bin_.ClearToEmpty();
+  x_ij_bin_.ClearToEmpty();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Round2BCMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* Round0P2PMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .safeheron.proto.CurvePoint pub = 1;
+      // string e_ij = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          ptr = ctx->ParseMessage(_internal_mutable_pub(), ptr);
+          auto str = _internal_mutable_e_ij();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage.e_ij"));
         } else
           goto handle_unusual;
         continue;
-      // .safeheron.proto.DLogProof dlog_proof_x = 2;
+      // string x_ij = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          ptr = ctx->ParseMessage(_internal_mutable_dlog_proof_x(), ptr);
+          auto str = _internal_mutable_x_ij();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage.x_ij"));
         } else
           goto handle_unusual;
         continue;
-      // .safeheron.proto.PailBlumModulusProof pail_proof = 3;
+      // bytes e_ij_bin = 3;
       case 3:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          ptr = ctx->ParseMessage(_internal_mutable_pail_proof(), ptr);
+          auto str = _internal_mutable_e_ij_bin();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes x_ij_bin = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_x_ij_bin();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -1370,130 +506,163 @@ failure:
 #undef CHK_
 }
 
-uint8_t* Round2BCMessage::_InternalSerialize(
+uint8_t* Round0P2PMessage::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round2BCMessage)
+  // @@protoc_insertion_point(serialize_to_array_start:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .safeheron.proto.CurvePoint pub = 1;
-  if (this->_internal_has_pub()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, _Internal::pub(this),
-        _Internal::pub(this).GetCachedSize(), target, stream);
+  // string e_ij = 1;
+  if (!this->_internal_e_ij().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_e_ij().data(), static_cast<int>(this->_internal_e_ij().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage.e_ij");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_e_ij(), target);
   }
 
-  // .safeheron.proto.DLogProof dlog_proof_x = 2;
-  if (this->_internal_has_dlog_proof_x()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(2, _Internal::dlog_proof_x(this),
-        _Internal::dlog_proof_x(this).GetCachedSize(), target, stream);
+  // string x_ij = 2;
+  if (!this->_internal_x_ij().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_x_ij().data(), static_cast<int>(this->_internal_x_ij().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage.x_ij");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_x_ij(), target);
   }
 
-  // .safeheron.proto.PailBlumModulusProof pail_proof = 3;
-  if (this->_internal_has_pail_proof()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(3, _Internal::pail_proof(this),
-        _Internal::pail_proof(this).GetCachedSize(), target, stream);
+  // bytes e_ij_bin = 3;
+  if (!this->_internal_e_ij_bin().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_e_ij_bin(), target);
+  }
+
+  // bytes x_ij_bin = 4;
+  if (!this->_internal_x_ij_bin().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_x_ij_bin(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round2BCMessage)
+  // @@protoc_insertion_point(serialize_to_array_end:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage)
   return target;
 }
 
-size_t Round2BCMessage::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round2BCMessage)
+size_t Round0P2PMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .safeheron.proto.CurvePoint pub = 1;
-  if (this->_internal_has_pub()) {
+  // string e_ij = 1;
+  if (!this->_internal_e_ij().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_e_ij());
+  }
+
+  // string x_ij = 2;
+  if (!this->_internal_x_ij().empty()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *pub_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_x_ij());
   }
 
-  // .safeheron.proto.DLogProof dlog_proof_x = 2;
-  if (this->_internal_has_dlog_proof_x()) {
+  // bytes e_ij_bin = 3;
+  if (!this->_internal_e_ij_bin().empty()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *dlog_proof_x_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_e_ij_bin());
   }
 
-  // .safeheron.proto.PailBlumModulusProof pail_proof = 3;
-  if (this->_internal_has_pail_proof()) {
+  // bytes x_ij_bin = 4;
+  if (!this->_internal_x_ij_bin().empty()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *pail_proof_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_x_ij_bin());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Round2BCMessage::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Round0P2PMessage::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
-    Round2BCMessage::MergeImpl
+    Round0P2PMessage::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Round2BCMessage::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Round0P2PMessage::GetClassData() const { return &_class_data_; }
 
-void Round2BCMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
+void Round0P2PMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
                       const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<Round2BCMessage *>(to)->MergeFrom(
-      static_cast<const Round2BCMessage &>(from));
+  static_cast<Round0P2PMessage *>(to)->MergeFrom(
+      static_cast<const Round0P2PMessage &>(from));
 }
 
 
-void Round2BCMessage::MergeFrom(const Round2BCMessage& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round2BCMessage)
+void Round0P2PMessage::MergeFrom(const Round0P2PMessage& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage)
   GOOGLE_DCHECK_NE(&from, this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_has_pub()) {
-    _internal_mutable_pub()->::safeheron::proto::CurvePoint::MergeFrom(from._internal_pub());
+  if (!from._internal_e_ij().empty()) {
+    _internal_set_e_ij(from._internal_e_ij());
+  }
+  if (!from._internal_x_ij().empty()) {
+    _internal_set_x_ij(from._internal_x_ij());
   }
-  if (from._internal_has_dlog_proof_x()) {
-    _internal_mutable_dlog_proof_x()->::safeheron::proto::DLogProof::MergeFrom(from._internal_dlog_proof_x());
+  if (!from._internal_e_ij_bin().empty()) {
+    _internal_set_e_ij_bin(from._internal_e_ij_bin());
   }
-  if (from._internal_has_pail_proof()) {
-    _internal_mutable_pail_proof()->::safeheron::proto::PailBlumModulusProof::MergeFrom(from._internal_pail_proof());
+  if (!from._internal_x_ij_bin().empty()) {
+    _internal_set_x_ij_bin(from._internal_x_ij_bin());
   }
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Round2BCMessage::CopyFrom(const Round2BCMessage& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round2BCMessage)
+void Round0P2PMessage::CopyFrom(const Round0P2PMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Round2BCMessage::IsInitialized() const {
+bool Round0P2PMessage::IsInitialized() const {
   return true;
 }
 
-void Round2BCMessage::InternalSwap(Round2BCMessage* other) {
+void Round0P2PMessage::InternalSwap(Round0P2PMessage* other) {
   using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Round2BCMessage, pail_proof_)
-      + sizeof(Round2BCMessage::pail_proof_)
-      - PROTOBUF_FIELD_OFFSET(Round2BCMessage, pub_)>(
-          reinterpret_cast<char*>(&pub_),
-          reinterpret_cast<char*>(&other->pub_));
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &e_ij_, lhs_arena,
+      &other->e_ij_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &x_ij_, lhs_arena,
+      &other->x_ij_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &e_ij_bin_, lhs_arena,
+      &other->e_ij_bin_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &x_ij_bin_, lhs_arena,
+      &other->x_ij_bin_, rhs_arena
+  );
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata Round2BCMessage::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata Round0P2PMessage::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_Li24_2fkey_5fgen_2eproto_getter, &descriptor_table_Li24_2fkey_5fgen_2eproto_once,
-      file_level_metadata_Li24_2fkey_5fgen_2eproto[3]);
+      file_level_metadata_Li24_2fkey_5fgen_2eproto[1]);
 }
 
 // @@protoc_insertion_point(namespace_scope)
@@ -1507,17 +676,9 @@ template<> PROTOBUF_NOINLINE ::safeheron::proto::multi_party_ecdsa::Li24::key_ge
 Arena::CreateMaybeMessage< ::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round0BCMessage >(Arena* arena) {
   return Arena::CreateMessageInternal< ::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round0BCMessage >(arena);
 }
-template<> PROTOBUF_NOINLINE ::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round1BCMessage*
-Arena::CreateMaybeMessage< ::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round1BCMessage >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round1BCMessage >(arena);
-}
-template<> PROTOBUF_NOINLINE ::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round1P2PMessage*
-Arena::CreateMaybeMessage< ::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round1P2PMessage >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round1P2PMessage >(arena);
-}
-template<> PROTOBUF_NOINLINE ::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round2BCMessage*
-Arena::CreateMaybeMessage< ::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round2BCMessage >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round2BCMessage >(arena);
+template<> PROTOBUF_NOINLINE ::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round0P2PMessage*
+Arena::CreateMaybeMessage< ::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round0P2PMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round0P2PMessage >(arena);
 }
 PROTOBUF_NAMESPACE_CLOSE
 
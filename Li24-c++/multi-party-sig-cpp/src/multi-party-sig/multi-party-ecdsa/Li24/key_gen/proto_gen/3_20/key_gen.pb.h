@@ -56,15 +56,9 @@ namespace key_gen {
 class Round0BCMessage;
 struct Round0BCMessageDefaultTypeInternal;
 extern Round0BCMessageDefaultTypeInternal _Round0BCMessage_default_instance_;
-class Round1BCMessage;
-struct Round1BCMessageDefaultTypeInternal;
-extern Round1BCMessageDefaultTypeInternal _Round1BCMessage_default_instance_;
-class Round1P2PMessage;
-struct Round1P2PMessageDefaultTypeInternal;
-extern Round1P2PMessageDefaultTypeInternal _Round1P2PMessage_default_instance_;
-class Round2BCMessage;
-struct Round2BCMessageDefaultTypeInternal;
-extern Round2BCMessageDefaultTypeInternal _Round2BCMessage_default_instance_;
+class Round0P2PMessage;
+struct Round0P2PMessageDefaultTypeInternal;
+extern Round0P2PMessageDefaultTypeInternal _Round0P2PMessage_default_instance_;
 }  // namespace key_gen
 }  // namespace Li24
 }  // namespace multi_party_ecdsa
@@ -72,9 +66,7 @@ extern Round2BCMessageDefaultTypeInternal _Round2BCMessage_default_instance_;
 }  // namespace safeheron
 PROTOBUF_NAMESPACE_OPEN
 template<> ::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round0BCMessage* Arena::CreateMaybeMessage<::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round0BCMessage>(Arena*);
-template<> ::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round1BCMessage* Arena::CreateMaybeMessage<::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round1BCMessage>(Arena*);
-template<> ::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round1P2PMessage* Arena::CreateMaybeMessage<::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round1P2PMessage>(Arena*);
-template<> ::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round2BCMessage* Arena::CreateMaybeMessage<::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round2BCMessage>(Arena*);
+template<> ::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round0P2PMessage* Arena::CreateMaybeMessage<::safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round0P2PMessage>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace safeheron {
 namespace proto {
@@ -203,282 +195,10 @@ class Round0BCMessage final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kIndexFieldNumber = 1,
-    kKgcYFieldNumber = 3,
-    kNTildeFieldNumber = 7,
-    kH1FieldNumber = 8,
-    kH2FieldNumber = 9,
-    kPailPubFieldNumber = 4,
-    kDlnProof1FieldNumber = 5,
-    kDlnProof2FieldNumber = 6,
+    kVsFieldNumber = 1,
+    kWireVersionFieldNumber = 2,
   };
-  // string index = 1;
-  void clear_index();
-  const std::string& index() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_index(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_index();
-  PROTOBUF_NODISCARD std::string* release_index();
-  void set_allocated_index(std::string* index);
-  private:
-  const std::string& _internal_index() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_index(const std::string& value);
-  std::string* _internal_mutable_index();
-  public:
-
-  // string kgc_Y = 3;
-  void clear_kgc_y();
-  const std::string& kgc_y() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_kgc_y(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_kgc_y();
-  PROTOBUF_NODISCARD std::string* release_kgc_y();
-  void set_allocated_kgc_y(std::string* kgc_y);
-  private:
-  const std::string& _internal_kgc_y() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_kgc_y(const std::string& value);
-  std::string* _internal_mutable_kgc_y();
-  public:
-
-  // string N_tilde = 7;
-  void clear_n_tilde();
-  const std::string& n_tilde() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_n_tilde(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_n_tilde();
-  PROTOBUF_NODISCARD std::string* release_n_tilde();
-  void set_allocated_n_tilde(std::string* n_tilde);
-  private:
-  const std::string& _internal_n_tilde() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_n_tilde(const std::string& value);
-  std::string* _internal_mutable_n_tilde();
-  public:
-
-  // string h1 = 8;
-  void clear_h1();
-  const std::string& h1() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_h1(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_h1();
-  PROTOBUF_NODISCARD std::string* release_h1();
-  void set_allocated_h1(std::string* h1);
-  private:
-  const std::string& _internal_h1() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_h1(const std::string& value);
-  std::string* _internal_mutable_h1();
-  public:
-
-  // string h2 = 9;
-  void clear_h2();
-  const std::string& h2() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_h2(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_h2();
-  PROTOBUF_NODISCARD std::string* release_h2();
-  void set_allocated_h2(std::string* h2);
-  private:
-  const std::string& _internal_h2() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_h2(const std::string& value);
-  std::string* _internal_mutable_h2();
-  public:
-
-  // .safeheron.proto.PailPub pail_pub = 4;
-  bool has_pail_pub() const;
-  private:
-  bool _internal_has_pail_pub() const;
-  public:
-  void clear_pail_pub();
-  const ::safeheron::proto::PailPub& pail_pub() const;
-  PROTOBUF_NODISCARD ::safeheron::proto::PailPub* release_pail_pub();
-  ::safeheron::proto::PailPub* mutable_pail_pub();
-  void set_allocated_pail_pub(::safeheron::proto::PailPub* pail_pub);
-  private:
-  const ::safeheron::proto::PailPub& _internal_pail_pub() const;
-  ::safeheron::proto::PailPub* _internal_mutable_pail_pub();
-  public:
-  void unsafe_arena_set_allocated_pail_pub(
-      ::safeheron::proto::PailPub* pail_pub);
-  ::safeheron::proto::PailPub* unsafe_arena_release_pail_pub();
-
-  // .safeheron.proto.DLNProof dln_proof1 = 5;
-  bool has_dln_proof1() const;
-  private:
-  bool _internal_has_dln_proof1() const;
-  public:
-  void clear_dln_proof1();
-  const ::safeheron::proto::DLNProof& dln_proof1() const;
-  PROTOBUF_NODISCARD ::safeheron::proto::DLNProof* release_dln_proof1();
-  ::safeheron::proto::DLNProof* mutable_dln_proof1();
-  void set_allocated_dln_proof1(::safeheron::proto::DLNProof* dln_proof1);
-  private:
-  const ::safeheron::proto::DLNProof& _internal_dln_proof1() const;
-  ::safeheron::proto::DLNProof* _internal_mutable_dln_proof1();
-  public:
-  void unsafe_arena_set_allocated_dln_proof1(
-      ::safeheron::proto::DLNProof* dln_proof1);
-  ::safeheron::proto::DLNProof* unsafe_arena_release_dln_proof1();
-
-  // .safeheron.proto.DLNProof dln_proof2 = 6;
-  bool has_dln_proof2() const;
-  private:
-  bool _internal_has_dln_proof2() const;
-  public:
-  void clear_dln_proof2();
-  const ::safeheron::proto::DLNProof& dln_proof2() const;
-  PROTOBUF_NODISCARD ::safeheron::proto::DLNProof* release_dln_proof2();
-  ::safeheron::proto::DLNProof* mutable_dln_proof2();
-  void set_allocated_dln_proof2(::safeheron::proto::DLNProof* dln_proof2);
-  private:
-  const ::safeheron::proto::DLNProof& _internal_dln_proof2() const;
-  ::safeheron::proto::DLNProof* _internal_mutable_dln_proof2();
-  public:
-  void unsafe_arena_set_allocated_dln_proof2(
-      ::safeheron::proto::DLNProof* dln_proof2);
-  ::safeheron::proto::DLNProof* unsafe_arena_release_dln_proof2();
-
-  // @@protoc_insertion_point(class_scope:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage)
- private:
-  class _Internal;
-
-  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
-  typedef void InternalArenaConstructable_;
-  typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr index_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr kgc_y_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr n_tilde_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr h1_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr h2_;
-  ::safeheron::proto::PailPub* pail_pub_;
-  ::safeheron::proto::DLNProof* dln_proof1_;
-  ::safeheron::proto::DLNProof* dln_proof2_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_Li24_2fkey_5fgen_2eproto;
-};
-// -------------------------------------------------------------------
-
-class Round1BCMessage final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round1BCMessage) */ {
- public:
-  inline Round1BCMessage() : Round1BCMessage(nullptr) {}
-  ~Round1BCMessage() override;
-  explicit PROTOBUF_CONSTEXPR Round1BCMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
-
-  Round1BCMessage(const Round1BCMessage& from);
-  Round1BCMessage(Round1BCMessage&& from) noexcept
-    : Round1BCMessage() {
-    *this = ::std::move(from);
-  }
-
-  inline Round1BCMessage& operator=(const Round1BCMessage& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline Round1BCMessage& operator=(Round1BCMessage&& from) noexcept {
-    if (this == &from) return *this;
-    if (GetOwningArena() == from.GetOwningArena()
-  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
-        && GetOwningArena() != nullptr
-  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
-    ) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const Round1BCMessage& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const Round1BCMessage* internal_default_instance() {
-    return reinterpret_cast<const Round1BCMessage*>(
-               &_Round1BCMessage_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    1;
-
-  friend void swap(Round1BCMessage& a, Round1BCMessage& b) {
-    a.Swap(&b);
-  }
-  inline void Swap(Round1BCMessage* other) {
-    if (other == this) return;
-  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetOwningArena() != nullptr &&
-        GetOwningArena() == other->GetOwningArena()) {
-   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetOwningArena() == other->GetOwningArena()) {
-  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
-      InternalSwap(other);
-    } else {
-      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(Round1BCMessage* other) {
-    if (other == this) return;
-    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  Round1BCMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<Round1BCMessage>(arena);
-  }
-  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const Round1BCMessage& from);
-  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const Round1BCMessage& from);
-  private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
-  public:
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  uint8_t* _InternalSerialize(
-      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(Round1BCMessage* other);
-
-  private:
-  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
-  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round1BCMessage";
-  }
-  protected:
-  explicit Round1BCMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-                       bool is_message_owned = false);
-  public:
-
-  static const ClassData _class_data_;
-  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
-
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  enum : int {
-    kVsFieldNumber = 4,
-    kKgdYFieldNumber = 2,
-  };
-  // repeated .safeheron.proto.CurvePoint vs = 4;
+  // repeated .safeheron.proto.CurvePoint vs = 1;
   int vs_size() const;
   private:
   int _internal_vs_size() const;
@@ -496,25 +216,16 @@ class Round1BCMessage final :
   const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::safeheron::proto::CurvePoint >&
       vs() const;
 
-  // .safeheron.proto.KGD kgd_y = 2;
-  bool has_kgd_y() const;
-  private:
-  bool _internal_has_kgd_y() const;
-  public:
-  void clear_kgd_y();
-  const ::safeheron::proto::KGD& kgd_y() const;
-  PROTOBUF_NODISCARD ::safeheron::proto::KGD* release_kgd_y();
-  ::safeheron::proto::KGD* mutable_kgd_y();
-  void set_allocated_kgd_y(::safeheron::proto::KGD* kgd_y);
+  // int32 wire_version = 2;
+  void clear_wire_version();
+  int32_t wire_version() const;
+  void set_wire_version(int32_t value);
   private:
-  const ::safeheron::proto::KGD& _internal_kgd_y() const;
-  ::safeheron::proto::KGD* _internal_mutable_kgd_y();
+  int32_t _internal_wire_version() const;
+  void _internal_set_wire_version(int32_t value);
   public:
-  void unsafe_arena_set_allocated_kgd_y(
-      ::safeheron::proto::KGD* kgd_y);
-  ::safeheron::proto::KGD* unsafe_arena_release_kgd_y();
 
-  // @@protoc_insertion_point(class_scope:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round1BCMessage)
+  // @@protoc_insertion_point(class_scope:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage)
  private:
   class _Internal;
 
@@ -522,30 +233,30 @@ class Round1BCMessage final :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::safeheron::proto::CurvePoint > vs_;
-  ::safeheron::proto::KGD* kgd_y_;
+  int32_t wire_version_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_Li24_2fkey_5fgen_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Round1P2PMessage final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round1P2PMessage) */ {
+class Round0P2PMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage) */ {
  public:
-  inline Round1P2PMessage() : Round1P2PMessage(nullptr) {}
-  ~Round1P2PMessage() override;
-  explicit PROTOBUF_CONSTEXPR Round1P2PMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline Round0P2PMessage() : Round0P2PMessage(nullptr) {}
+  ~Round0P2PMessage() override;
+  explicit PROTOBUF_CONSTEXPR Round0P2PMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Round1P2PMessage(const Round1P2PMessage& from);
-  Round1P2PMessage(Round1P2PMessage&& from) noexcept
-    : Round1P2PMessage() {
+  Round0P2PMessage(const Round0P2PMessage& from);
+  Round0P2PMessage(Round0P2PMessage&& from) noexcept
+    : Round0P2PMessage() {
     *this = ::std::move(from);
   }
 
-  inline Round1P2PMessage& operator=(const Round1P2PMessage& from) {
+  inline Round0P2PMessage& operator=(const Round0P2PMessage& from) {
     CopyFrom(from);
     return *this;
   }
-  inline Round1P2PMessage& operator=(Round1P2PMessage&& from) noexcept {
+  inline Round0P2PMessage& operator=(Round0P2PMessage&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -568,20 +279,20 @@ class Round1P2PMessage final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const Round1P2PMessage& default_instance() {
+  static const Round0P2PMessage& default_instance() {
     return *internal_default_instance();
   }
-  static inline const Round1P2PMessage* internal_default_instance() {
-    return reinterpret_cast<const Round1P2PMessage*>(
-               &_Round1P2PMessage_default_instance_);
+  static inline const Round0P2PMessage* internal_default_instance() {
+    return reinterpret_cast<const Round0P2PMessage*>(
+               &_Round0P2PMessage_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    2;
+    1;
 
-  friend void swap(Round1P2PMessage& a, Round1P2PMessage& b) {
+  friend void swap(Round0P2PMessage& a, Round0P2PMessage& b) {
     a.Swap(&b);
   }
-  inline void Swap(Round1P2PMessage* other) {
+  inline void Swap(Round0P2PMessage* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -594,7 +305,7 @@ class Round1P2PMessage final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(Round1P2PMessage* other) {
+  void UnsafeArenaSwap(Round0P2PMessage* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -602,13 +313,13 @@ class Round1P2PMessage final :
 
   // implements Message ----------------------------------------------
 
-  Round1P2PMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<Round1P2PMessage>(arena);
+  Round0P2PMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Round0P2PMessage>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const Round1P2PMessage& from);
+  void CopyFrom(const Round0P2PMessage& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const Round1P2PMessage& from);
+  void MergeFrom(const Round0P2PMessage& from);
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
   public:
@@ -625,15 +336,15 @@ class Round1P2PMessage final :
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(Round1P2PMessage* other);
+  void InternalSwap(Round0P2PMessage* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round1P2PMessage";
+    return "safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage";
   }
   protected:
-  explicit Round1P2PMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit Round0P2PMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -647,10 +358,26 @@ class Round1P2PMessage final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kXIjFieldNumber = 3,
-    kNsfProofFieldNumber = 4,
+    kEIjFieldNumber = 1,
+    kXIjFieldNumber = 2,
+    kEIjBinFieldNumber = 3,
+    kXIjBinFieldNumber = 4,
   };
-  // string x_ij = 3;
+  // string e_ij = 1;
+  void clear_e_ij();
+  const std::string& e_ij() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_e_ij(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_e_ij();
+  PROTOBUF_NODISCARD std::string* release_e_ij();
+  void set_allocated_e_ij(std::string* e_ij);
+  private:
+  const std::string& _internal_e_ij() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_e_ij(const std::string& value);
+  std::string* _internal_mutable_e_ij();
+  public:
+
+  // string x_ij = 2;
   void clear_x_ij();
   const std::string& x_ij() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
@@ -664,910 +391,206 @@ class Round1P2PMessage final :
   std::string* _internal_mutable_x_ij();
   public:
 
-  // .safeheron.proto.NoSmallFactorProof nsf_proof = 4;
-  bool has_nsf_proof() const;
+  // bytes e_ij_bin = 3;
+  void clear_e_ij_bin();
+  const std::string& e_ij_bin() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_e_ij_bin(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_e_ij_bin();
+  PROTOBUF_NODISCARD std::string* release_e_ij_bin();
+  void set_allocated_e_ij_bin(std::string* e_ij_bin);
   private:
-  bool _internal_has_nsf_proof() const;
+  const std::string& _internal_e_ij_bin() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_e_ij_bin(const std::string& value);
+  std::string* _internal_mutable_e_ij_bin();
   public:
-  void clear_nsf_proof();
-  const ::safeheron::proto::NoSmallFactorProof& nsf_proof() const;
-  PROTOBUF_NODISCARD ::safeheron::proto::NoSmallFactorProof* release_nsf_proof();
-  ::safeheron::proto::NoSmallFactorProof* mutable_nsf_proof();
-  void set_allocated_nsf_proof(::safeheron::proto::NoSmallFactorProof* nsf_proof);
+
+  // bytes x_ij_bin = 4;
+  void clear_x_ij_bin();
+  const std::string& x_ij_bin() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_x_ij_bin(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_x_ij_bin();
+  PROTOBUF_NODISCARD std::string* release_x_ij_bin();
+  void set_allocated_x_ij_bin(std::string* x_ij_bin);
   private:
-  const ::safeheron::proto::NoSmallFactorProof& _internal_nsf_proof() const;
-  ::safeheron::proto::NoSmallFactorProof* _internal_mutable_nsf_proof();
+  const std::string& _internal_x_ij_bin() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_x_ij_bin(const std::string& value);
+  std::string* _internal_mutable_x_ij_bin();
   public:
-  void unsafe_arena_set_allocated_nsf_proof(
-      ::safeheron::proto::NoSmallFactorProof* nsf_proof);
-  ::safeheron::proto::NoSmallFactorProof* unsafe_arena_release_nsf_proof();
 
-  // @@protoc_insertion_point(class_scope:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round1P2PMessage)
+  // @@protoc_insertion_point(class_scope:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr e_ij_;
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr x_ij_;
-  ::safeheron::proto::NoSmallFactorProof* nsf_proof_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr e_ij_bin_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr x_ij_bin_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_Li24_2fkey_5fgen_2eproto;
 };
-// -------------------------------------------------------------------
-
-class Round2BCMessage final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round2BCMessage) */ {
- public:
-  inline Round2BCMessage() : Round2BCMessage(nullptr) {}
-  ~Round2BCMessage() override;
-  explicit PROTOBUF_CONSTEXPR Round2BCMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+// ===================================================================
 
-  Round2BCMessage(const Round2BCMessage& from);
-  Round2BCMessage(Round2BCMessage&& from) noexcept
-    : Round2BCMessage() {
-    *this = ::std::move(from);
-  }
 
-  inline Round2BCMessage& operator=(const Round2BCMessage& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline Round2BCMessage& operator=(Round2BCMessage&& from) noexcept {
-    if (this == &from) return *this;
-    if (GetOwningArena() == from.GetOwningArena()
-  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
-        && GetOwningArena() != nullptr
-  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
-    ) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
+// ===================================================================
 
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const Round2BCMessage& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const Round2BCMessage* internal_default_instance() {
-    return reinterpret_cast<const Round2BCMessage*>(
-               &_Round2BCMessage_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    3;
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Round0BCMessage
 
-  friend void swap(Round2BCMessage& a, Round2BCMessage& b) {
-    a.Swap(&b);
-  }
-  inline void Swap(Round2BCMessage* other) {
-    if (other == this) return;
-  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetOwningArena() != nullptr &&
-        GetOwningArena() == other->GetOwningArena()) {
-   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetOwningArena() == other->GetOwningArena()) {
-  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
-      InternalSwap(other);
-    } else {
-      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(Round2BCMessage* other) {
-    if (other == this) return;
-    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
-    InternalSwap(other);
-  }
+// repeated .safeheron.proto.CurvePoint vs = 1;
+inline int Round0BCMessage::_internal_vs_size() const {
+  return vs_.size();
+}
+inline int Round0BCMessage::vs_size() const {
+  return _internal_vs_size();
+}
+inline ::safeheron::proto::CurvePoint* Round0BCMessage::mutable_vs(int index) {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.vs)
+  return vs_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::safeheron::proto::CurvePoint >*
+Round0BCMessage::mutable_vs() {
+  // @@protoc_insertion_point(field_mutable_list:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.vs)
+  return &vs_;
+}
+inline const ::safeheron::proto::CurvePoint& Round0BCMessage::_internal_vs(int index) const {
+  return vs_.Get(index);
+}
+inline const ::safeheron::proto::CurvePoint& Round0BCMessage::vs(int index) const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.vs)
+  return _internal_vs(index);
+}
+inline ::safeheron::proto::CurvePoint* Round0BCMessage::_internal_add_vs() {
+  return vs_.Add();
+}
+inline ::safeheron::proto::CurvePoint* Round0BCMessage::add_vs() {
+  ::safeheron::proto::CurvePoint* _add = _internal_add_vs();
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.vs)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::safeheron::proto::CurvePoint >&
+Round0BCMessage::vs() const {
+  // @@protoc_insertion_point(field_list:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.vs)
+  return vs_;
+}
 
-  // implements Message ----------------------------------------------
+// int32 wire_version = 2;
+inline void Round0BCMessage::clear_wire_version() {
+  wire_version_ = 0;
+}
+inline int32_t Round0BCMessage::_internal_wire_version() const {
+  return wire_version_;
+}
+inline int32_t Round0BCMessage::wire_version() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.wire_version)
+  return _internal_wire_version();
+}
+inline void Round0BCMessage::_internal_set_wire_version(int32_t value) {
+  
+  wire_version_ = value;
+}
+inline void Round0BCMessage::set_wire_version(int32_t value) {
+  _internal_set_wire_version(value);
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.wire_version)
+}
 
-  Round2BCMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<Round2BCMessage>(arena);
-  }
-  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const Round2BCMessage& from);
-  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const Round2BCMessage& from);
-  private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
-  public:
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
+// -------------------------------------------------------------------
 
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  uint8_t* _InternalSerialize(
-      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
+// Round0P2PMessage
 
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(Round2BCMessage* other);
-
-  private:
-  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
-  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round2BCMessage";
-  }
-  protected:
-  explicit Round2BCMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-                       bool is_message_owned = false);
-  public:
-
-  static const ClassData _class_data_;
-  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
-
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  enum : int {
-    kPubFieldNumber = 1,
-    kDlogProofXFieldNumber = 2,
-    kPailProofFieldNumber = 3,
-  };
-  // .safeheron.proto.CurvePoint pub = 1;
-  bool has_pub() const;
-  private:
-  bool _internal_has_pub() const;
-  public:
-  void clear_pub();
-  const ::safeheron::proto::CurvePoint& pub() const;
-  PROTOBUF_NODISCARD ::safeheron::proto::CurvePoint* release_pub();
-  ::safeheron::proto::CurvePoint* mutable_pub();
-  void set_allocated_pub(::safeheron::proto::CurvePoint* pub);
-  private:
-  const ::safeheron::proto::CurvePoint& _internal_pub() const;
-  ::safeheron::proto::CurvePoint* _internal_mutable_pub();
-  public:
-  void unsafe_arena_set_allocated_pub(
-      ::safeheron::proto::CurvePoint* pub);
-  ::safeheron::proto::CurvePoint* unsafe_arena_release_pub();
-
-  // .safeheron.proto.DLogProof dlog_proof_x = 2;
-  bool has_dlog_proof_x() const;
-  private:
-  bool _internal_has_dlog_proof_x() const;
-  public:
-  void clear_dlog_proof_x();
-  const ::safeheron::proto::DLogProof& dlog_proof_x() const;
-  PROTOBUF_NODISCARD ::safeheron::proto::DLogProof* release_dlog_proof_x();
-  ::safeheron::proto::DLogProof* mutable_dlog_proof_x();
-  void set_allocated_dlog_proof_x(::safeheron::proto::DLogProof* dlog_proof_x);
-  private:
-  const ::safeheron::proto::DLogProof& _internal_dlog_proof_x() const;
-  ::safeheron::proto::DLogProof* _internal_mutable_dlog_proof_x();
-  public:
-  void unsafe_arena_set_allocated_dlog_proof_x(
-      ::safeheron::proto::DLogProof* dlog_proof_x);
-  ::safeheron::proto::DLogProof* unsafe_arena_release_dlog_proof_x();
-
-  // .safeheron.proto.PailBlumModulusProof pail_proof = 3;
-  bool has_pail_proof() const;
-  private:
-  bool _internal_has_pail_proof() const;
-  public:
-  void clear_pail_proof();
-  const ::safeheron::proto::PailBlumModulusProof& pail_proof() const;
-  PROTOBUF_NODISCARD ::safeheron::proto::PailBlumModulusProof* release_pail_proof();
-  ::safeheron::proto::PailBlumModulusProof* mutable_pail_proof();
-  void set_allocated_pail_proof(::safeheron::proto::PailBlumModulusProof* pail_proof);
-  private:
-  const ::safeheron::proto::PailBlumModulusProof& _internal_pail_proof() const;
-  ::safeheron::proto::PailBlumModulusProof* _internal_mutable_pail_proof();
-  public:
-  void unsafe_arena_set_allocated_pail_proof(
-      ::safeheron::proto::PailBlumModulusProof* pail_proof);
-  ::safeheron::proto::PailBlumModulusProof* unsafe_arena_release_pail_proof();
-
-  // @@protoc_insertion_point(class_scope:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round2BCMessage)
- private:
-  class _Internal;
-
-  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
-  typedef void InternalArenaConstructable_;
-  typedef void DestructorSkippable_;
-  ::safeheron::proto::CurvePoint* pub_;
-  ::safeheron::proto::DLogProof* dlog_proof_x_;
-  ::safeheron::proto::PailBlumModulusProof* pail_proof_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_Li24_2fkey_5fgen_2eproto;
-};
-// ===================================================================
-
-
-// ===================================================================
-
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// Round0BCMessage
-
-// string index = 1;
-inline void Round0BCMessage::clear_index() {
-  index_.ClearToEmpty();
-}
-inline const std::string& Round0BCMessage::index() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.index)
-  return _internal_index();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void Round0BCMessage::set_index(ArgT0&& arg0, ArgT... args) {
- 
- index_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.index)
-}
-inline std::string* Round0BCMessage::mutable_index() {
-  std::string* _s = _internal_mutable_index();
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.index)
-  return _s;
-}
-inline const std::string& Round0BCMessage::_internal_index() const {
-  return index_.Get();
-}
-inline void Round0BCMessage::_internal_set_index(const std::string& value) {
-  
-  index_.Set(value, GetArenaForAllocation());
-}
-inline std::string* Round0BCMessage::_internal_mutable_index() {
-  
-  return index_.Mutable(GetArenaForAllocation());
-}
-inline std::string* Round0BCMessage::release_index() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.index)
-  return index_.Release();
-}
-inline void Round0BCMessage::set_allocated_index(std::string* index) {
-  if (index != nullptr) {
-    
-  } else {
-    
-  }
-  index_.SetAllocated(index, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (index_.IsDefault()) {
-    index_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.index)
-}
-
-// string kgc_Y = 3;
-inline void Round0BCMessage::clear_kgc_y() {
-  kgc_y_.ClearToEmpty();
-}
-inline const std::string& Round0BCMessage::kgc_y() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.kgc_Y)
-  return _internal_kgc_y();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void Round0BCMessage::set_kgc_y(ArgT0&& arg0, ArgT... args) {
- 
- kgc_y_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.kgc_Y)
-}
-inline std::string* Round0BCMessage::mutable_kgc_y() {
-  std::string* _s = _internal_mutable_kgc_y();
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.kgc_Y)
-  return _s;
-}
-inline const std::string& Round0BCMessage::_internal_kgc_y() const {
-  return kgc_y_.Get();
-}
-inline void Round0BCMessage::_internal_set_kgc_y(const std::string& value) {
-  
-  kgc_y_.Set(value, GetArenaForAllocation());
-}
-inline std::string* Round0BCMessage::_internal_mutable_kgc_y() {
-  
-  return kgc_y_.Mutable(GetArenaForAllocation());
-}
-inline std::string* Round0BCMessage::release_kgc_y() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.kgc_Y)
-  return kgc_y_.Release();
-}
-inline void Round0BCMessage::set_allocated_kgc_y(std::string* kgc_y) {
-  if (kgc_y != nullptr) {
-    
-  } else {
-    
-  }
-  kgc_y_.SetAllocated(kgc_y, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (kgc_y_.IsDefault()) {
-    kgc_y_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.kgc_Y)
-}
-
-// .safeheron.proto.PailPub pail_pub = 4;
-inline bool Round0BCMessage::_internal_has_pail_pub() const {
-  return this != internal_default_instance() && pail_pub_ != nullptr;
-}
-inline bool Round0BCMessage::has_pail_pub() const {
-  return _internal_has_pail_pub();
-}
-inline const ::safeheron::proto::PailPub& Round0BCMessage::_internal_pail_pub() const {
-  const ::safeheron::proto::PailPub* p = pail_pub_;
-  return p != nullptr ? *p : reinterpret_cast<const ::safeheron::proto::PailPub&>(
-      ::safeheron::proto::_PailPub_default_instance_);
-}
-inline const ::safeheron::proto::PailPub& Round0BCMessage::pail_pub() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.pail_pub)
-  return _internal_pail_pub();
-}
-inline void Round0BCMessage::unsafe_arena_set_allocated_pail_pub(
-    ::safeheron::proto::PailPub* pail_pub) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(pail_pub_);
-  }
-  pail_pub_ = pail_pub;
-  if (pail_pub) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.pail_pub)
-}
-inline ::safeheron::proto::PailPub* Round0BCMessage::release_pail_pub() {
-  
-  ::safeheron::proto::PailPub* temp = pail_pub_;
-  pail_pub_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
-}
-inline ::safeheron::proto::PailPub* Round0BCMessage::unsafe_arena_release_pail_pub() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.pail_pub)
-  
-  ::safeheron::proto::PailPub* temp = pail_pub_;
-  pail_pub_ = nullptr;
-  return temp;
-}
-inline ::safeheron::proto::PailPub* Round0BCMessage::_internal_mutable_pail_pub() {
-  
-  if (pail_pub_ == nullptr) {
-    auto* p = CreateMaybeMessage<::safeheron::proto::PailPub>(GetArenaForAllocation());
-    pail_pub_ = p;
-  }
-  return pail_pub_;
-}
-inline ::safeheron::proto::PailPub* Round0BCMessage::mutable_pail_pub() {
-  ::safeheron::proto::PailPub* _msg = _internal_mutable_pail_pub();
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.pail_pub)
-  return _msg;
-}
-inline void Round0BCMessage::set_allocated_pail_pub(::safeheron::proto::PailPub* pail_pub) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(pail_pub_);
-  }
-  if (pail_pub) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(pail_pub));
-    if (message_arena != submessage_arena) {
-      pail_pub = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, pail_pub, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  pail_pub_ = pail_pub;
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.pail_pub)
-}
-
-// .safeheron.proto.DLNProof dln_proof1 = 5;
-inline bool Round0BCMessage::_internal_has_dln_proof1() const {
-  return this != internal_default_instance() && dln_proof1_ != nullptr;
-}
-inline bool Round0BCMessage::has_dln_proof1() const {
-  return _internal_has_dln_proof1();
-}
-inline const ::safeheron::proto::DLNProof& Round0BCMessage::_internal_dln_proof1() const {
-  const ::safeheron::proto::DLNProof* p = dln_proof1_;
-  return p != nullptr ? *p : reinterpret_cast<const ::safeheron::proto::DLNProof&>(
-      ::safeheron::proto::_DLNProof_default_instance_);
-}
-inline const ::safeheron::proto::DLNProof& Round0BCMessage::dln_proof1() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.dln_proof1)
-  return _internal_dln_proof1();
-}
-inline void Round0BCMessage::unsafe_arena_set_allocated_dln_proof1(
-    ::safeheron::proto::DLNProof* dln_proof1) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(dln_proof1_);
-  }
-  dln_proof1_ = dln_proof1;
-  if (dln_proof1) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.dln_proof1)
-}
-inline ::safeheron::proto::DLNProof* Round0BCMessage::release_dln_proof1() {
-  
-  ::safeheron::proto::DLNProof* temp = dln_proof1_;
-  dln_proof1_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
-}
-inline ::safeheron::proto::DLNProof* Round0BCMessage::unsafe_arena_release_dln_proof1() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.dln_proof1)
-  
-  ::safeheron::proto::DLNProof* temp = dln_proof1_;
-  dln_proof1_ = nullptr;
-  return temp;
-}
-inline ::safeheron::proto::DLNProof* Round0BCMessage::_internal_mutable_dln_proof1() {
-  
-  if (dln_proof1_ == nullptr) {
-    auto* p = CreateMaybeMessage<::safeheron::proto::DLNProof>(GetArenaForAllocation());
-    dln_proof1_ = p;
-  }
-  return dln_proof1_;
-}
-inline ::safeheron::proto::DLNProof* Round0BCMessage::mutable_dln_proof1() {
-  ::safeheron::proto::DLNProof* _msg = _internal_mutable_dln_proof1();
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.dln_proof1)
-  return _msg;
-}
-inline void Round0BCMessage::set_allocated_dln_proof1(::safeheron::proto::DLNProof* dln_proof1) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(dln_proof1_);
-  }
-  if (dln_proof1) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(dln_proof1));
-    if (message_arena != submessage_arena) {
-      dln_proof1 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, dln_proof1, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  dln_proof1_ = dln_proof1;
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.dln_proof1)
-}
-
-// .safeheron.proto.DLNProof dln_proof2 = 6;
-inline bool Round0BCMessage::_internal_has_dln_proof2() const {
-  return this != internal_default_instance() && dln_proof2_ != nullptr;
-}
-inline bool Round0BCMessage::has_dln_proof2() const {
-  return _internal_has_dln_proof2();
-}
-inline const ::safeheron::proto::DLNProof& Round0BCMessage::_internal_dln_proof2() const {
-  const ::safeheron::proto::DLNProof* p = dln_proof2_;
-  return p != nullptr ? *p : reinterpret_cast<const ::safeheron::proto::DLNProof&>(
-      ::safeheron::proto::_DLNProof_default_instance_);
-}
-inline const ::safeheron::proto::DLNProof& Round0BCMessage::dln_proof2() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.dln_proof2)
-  return _internal_dln_proof2();
-}
-inline void Round0BCMessage::unsafe_arena_set_allocated_dln_proof2(
-    ::safeheron::proto::DLNProof* dln_proof2) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(dln_proof2_);
-  }
-  dln_proof2_ = dln_proof2;
-  if (dln_proof2) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.dln_proof2)
-}
-inline ::safeheron::proto::DLNProof* Round0BCMessage::release_dln_proof2() {
-  
-  ::safeheron::proto::DLNProof* temp = dln_proof2_;
-  dln_proof2_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
-}
-inline ::safeheron::proto::DLNProof* Round0BCMessage::unsafe_arena_release_dln_proof2() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.dln_proof2)
-  
-  ::safeheron::proto::DLNProof* temp = dln_proof2_;
-  dln_proof2_ = nullptr;
-  return temp;
-}
-inline ::safeheron::proto::DLNProof* Round0BCMessage::_internal_mutable_dln_proof2() {
-  
-  if (dln_proof2_ == nullptr) {
-    auto* p = CreateMaybeMessage<::safeheron::proto::DLNProof>(GetArenaForAllocation());
-    dln_proof2_ = p;
-  }
-  return dln_proof2_;
-}
-inline ::safeheron::proto::DLNProof* Round0BCMessage::mutable_dln_proof2() {
-  ::safeheron::proto::DLNProof* _msg = _internal_mutable_dln_proof2();
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.dln_proof2)
-  return _msg;
-}
-inline void Round0BCMessage::set_allocated_dln_proof2(::safeheron::proto::DLNProof* dln_proof2) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(dln_proof2_);
-  }
-  if (dln_proof2) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(dln_proof2));
-    if (message_arena != submessage_arena) {
-      dln_proof2 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, dln_proof2, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  dln_proof2_ = dln_proof2;
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.dln_proof2)
-}
-
-// string N_tilde = 7;
-inline void Round0BCMessage::clear_n_tilde() {
-  n_tilde_.ClearToEmpty();
-}
-inline const std::string& Round0BCMessage::n_tilde() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.N_tilde)
-  return _internal_n_tilde();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void Round0BCMessage::set_n_tilde(ArgT0&& arg0, ArgT... args) {
- 
- n_tilde_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.N_tilde)
+// string e_ij = 1;
+inline void Round0P2PMessage::clear_e_ij() {
+  e_ij_.ClearToEmpty();
 }
-inline std::string* Round0BCMessage::mutable_n_tilde() {
-  std::string* _s = _internal_mutable_n_tilde();
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.N_tilde)
-  return _s;
-}
-inline const std::string& Round0BCMessage::_internal_n_tilde() const {
-  return n_tilde_.Get();
-}
-inline void Round0BCMessage::_internal_set_n_tilde(const std::string& value) {
-  
-  n_tilde_.Set(value, GetArenaForAllocation());
-}
-inline std::string* Round0BCMessage::_internal_mutable_n_tilde() {
-  
-  return n_tilde_.Mutable(GetArenaForAllocation());
-}
-inline std::string* Round0BCMessage::release_n_tilde() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.N_tilde)
-  return n_tilde_.Release();
-}
-inline void Round0BCMessage::set_allocated_n_tilde(std::string* n_tilde) {
-  if (n_tilde != nullptr) {
-    
-  } else {
-    
-  }
-  n_tilde_.SetAllocated(n_tilde, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (n_tilde_.IsDefault()) {
-    n_tilde_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.N_tilde)
-}
-
-// string h1 = 8;
-inline void Round0BCMessage::clear_h1() {
-  h1_.ClearToEmpty();
-}
-inline const std::string& Round0BCMessage::h1() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.h1)
-  return _internal_h1();
-}
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void Round0BCMessage::set_h1(ArgT0&& arg0, ArgT... args) {
- 
- h1_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.h1)
-}
-inline std::string* Round0BCMessage::mutable_h1() {
-  std::string* _s = _internal_mutable_h1();
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.h1)
-  return _s;
-}
-inline const std::string& Round0BCMessage::_internal_h1() const {
-  return h1_.Get();
-}
-inline void Round0BCMessage::_internal_set_h1(const std::string& value) {
-  
-  h1_.Set(value, GetArenaForAllocation());
-}
-inline std::string* Round0BCMessage::_internal_mutable_h1() {
-  
-  return h1_.Mutable(GetArenaForAllocation());
-}
-inline std::string* Round0BCMessage::release_h1() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.h1)
-  return h1_.Release();
-}
-inline void Round0BCMessage::set_allocated_h1(std::string* h1) {
-  if (h1 != nullptr) {
-    
-  } else {
-    
-  }
-  h1_.SetAllocated(h1, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (h1_.IsDefault()) {
-    h1_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.h1)
-}
-
-// string h2 = 9;
-inline void Round0BCMessage::clear_h2() {
-  h2_.ClearToEmpty();
-}
-inline const std::string& Round0BCMessage::h2() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.h2)
-  return _internal_h2();
+inline const std::string& Round0P2PMessage::e_ij() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage.e_ij)
+  return _internal_e_ij();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void Round0BCMessage::set_h2(ArgT0&& arg0, ArgT... args) {
+void Round0P2PMessage::set_e_ij(ArgT0&& arg0, ArgT... args) {
  
- h2_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.h2)
+ e_ij_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage.e_ij)
 }
-inline std::string* Round0BCMessage::mutable_h2() {
-  std::string* _s = _internal_mutable_h2();
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.h2)
+inline std::string* Round0P2PMessage::mutable_e_ij() {
+  std::string* _s = _internal_mutable_e_ij();
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage.e_ij)
   return _s;
 }
-inline const std::string& Round0BCMessage::_internal_h2() const {
-  return h2_.Get();
+inline const std::string& Round0P2PMessage::_internal_e_ij() const {
+  return e_ij_.Get();
 }
-inline void Round0BCMessage::_internal_set_h2(const std::string& value) {
+inline void Round0P2PMessage::_internal_set_e_ij(const std::string& value) {
   
-  h2_.Set(value, GetArenaForAllocation());
+  e_ij_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Round0BCMessage::_internal_mutable_h2() {
+inline std::string* Round0P2PMessage::_internal_mutable_e_ij() {
   
-  return h2_.Mutable(GetArenaForAllocation());
+  return e_ij_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Round0BCMessage::release_h2() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.h2)
-  return h2_.Release();
+inline std::string* Round0P2PMessage::release_e_ij() {
+  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage.e_ij)
+  return e_ij_.Release();
 }
-inline void Round0BCMessage::set_allocated_h2(std::string* h2) {
-  if (h2 != nullptr) {
+inline void Round0P2PMessage::set_allocated_e_ij(std::string* e_ij) {
+  if (e_ij != nullptr) {
     
   } else {
     
   }
-  h2_.SetAllocated(h2, GetArenaForAllocation());
+  e_ij_.SetAllocated(e_ij, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (h2_.IsDefault()) {
-    h2_.Set("", GetArenaForAllocation());
+  if (e_ij_.IsDefault()) {
+    e_ij_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0BCMessage.h2)
-}
-
-// -------------------------------------------------------------------
-
-// Round1BCMessage
-
-// .safeheron.proto.KGD kgd_y = 2;
-inline bool Round1BCMessage::_internal_has_kgd_y() const {
-  return this != internal_default_instance() && kgd_y_ != nullptr;
-}
-inline bool Round1BCMessage::has_kgd_y() const {
-  return _internal_has_kgd_y();
-}
-inline const ::safeheron::proto::KGD& Round1BCMessage::_internal_kgd_y() const {
-  const ::safeheron::proto::KGD* p = kgd_y_;
-  return p != nullptr ? *p : reinterpret_cast<const ::safeheron::proto::KGD&>(
-      ::safeheron::proto::_KGD_default_instance_);
+  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage.e_ij)
 }
-inline const ::safeheron::proto::KGD& Round1BCMessage::kgd_y() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round1BCMessage.kgd_y)
-  return _internal_kgd_y();
-}
-inline void Round1BCMessage::unsafe_arena_set_allocated_kgd_y(
-    ::safeheron::proto::KGD* kgd_y) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(kgd_y_);
-  }
-  kgd_y_ = kgd_y;
-  if (kgd_y) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round1BCMessage.kgd_y)
-}
-inline ::safeheron::proto::KGD* Round1BCMessage::release_kgd_y() {
-  
-  ::safeheron::proto::KGD* temp = kgd_y_;
-  kgd_y_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
-}
-inline ::safeheron::proto::KGD* Round1BCMessage::unsafe_arena_release_kgd_y() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round1BCMessage.kgd_y)
-  
-  ::safeheron::proto::KGD* temp = kgd_y_;
-  kgd_y_ = nullptr;
-  return temp;
-}
-inline ::safeheron::proto::KGD* Round1BCMessage::_internal_mutable_kgd_y() {
-  
-  if (kgd_y_ == nullptr) {
-    auto* p = CreateMaybeMessage<::safeheron::proto::KGD>(GetArenaForAllocation());
-    kgd_y_ = p;
-  }
-  return kgd_y_;
-}
-inline ::safeheron::proto::KGD* Round1BCMessage::mutable_kgd_y() {
-  ::safeheron::proto::KGD* _msg = _internal_mutable_kgd_y();
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round1BCMessage.kgd_y)
-  return _msg;
-}
-inline void Round1BCMessage::set_allocated_kgd_y(::safeheron::proto::KGD* kgd_y) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(kgd_y_);
-  }
-  if (kgd_y) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(kgd_y));
-    if (message_arena != submessage_arena) {
-      kgd_y = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, kgd_y, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  kgd_y_ = kgd_y;
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round1BCMessage.kgd_y)
-}
-
-// repeated .safeheron.proto.CurvePoint vs = 4;
-inline int Round1BCMessage::_internal_vs_size() const {
-  return vs_.size();
-}
-inline int Round1BCMessage::vs_size() const {
-  return _internal_vs_size();
-}
-inline ::safeheron::proto::CurvePoint* Round1BCMessage::mutable_vs(int index) {
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round1BCMessage.vs)
-  return vs_.Mutable(index);
-}
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::safeheron::proto::CurvePoint >*
-Round1BCMessage::mutable_vs() {
-  // @@protoc_insertion_point(field_mutable_list:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round1BCMessage.vs)
-  return &vs_;
-}
-inline const ::safeheron::proto::CurvePoint& Round1BCMessage::_internal_vs(int index) const {
-  return vs_.Get(index);
-}
-inline const ::safeheron::proto::CurvePoint& Round1BCMessage::vs(int index) const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round1BCMessage.vs)
-  return _internal_vs(index);
-}
-inline ::safeheron::proto::CurvePoint* Round1BCMessage::_internal_add_vs() {
-  return vs_.Add();
-}
-inline ::safeheron::proto::CurvePoint* Round1BCMessage::add_vs() {
-  ::safeheron::proto::CurvePoint* _add = _internal_add_vs();
-  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round1BCMessage.vs)
-  return _add;
-}
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::safeheron::proto::CurvePoint >&
-Round1BCMessage::vs() const {
-  // @@protoc_insertion_point(field_list:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round1BCMessage.vs)
-  return vs_;
-}
-
-// -------------------------------------------------------------------
 
-// Round1P2PMessage
-
-// string x_ij = 3;
-inline void Round1P2PMessage::clear_x_ij() {
+// string x_ij = 2;
+inline void Round0P2PMessage::clear_x_ij() {
   x_ij_.ClearToEmpty();
 }
-inline const std::string& Round1P2PMessage::x_ij() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round1P2PMessage.x_ij)
+inline const std::string& Round0P2PMessage::x_ij() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage.x_ij)
   return _internal_x_ij();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void Round1P2PMessage::set_x_ij(ArgT0&& arg0, ArgT... args) {
+void Round0P2PMessage::set_x_ij(ArgT0&& arg0, ArgT... args) {
  
  x_ij_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round1P2PMessage.x_ij)
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage.x_ij)
 }
-inline std::string* Round1P2PMessage::mutable_x_ij() {
+inline std::string* Round0P2PMessage::mutable_x_ij() {
   std::string* _s = _internal_mutable_x_ij();
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round1P2PMessage.x_ij)
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage.x_ij)
   return _s;
 }
-inline const std::string& Round1P2PMessage::_internal_x_ij() const {
+inline const std::string& Round0P2PMessage::_internal_x_ij() const {
   return x_ij_.Get();
 }
-inline void Round1P2PMessage::_internal_set_x_ij(const std::string& value) {
+inline void Round0P2PMessage::_internal_set_x_ij(const std::string& value) {
   
   x_ij_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Round1P2PMessage::_internal_mutable_x_ij() {
+inline std::string* Round0P2PMessage::_internal_mutable_x_ij() {
   
   return x_ij_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Round1P2PMessage::release_x_ij() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round1P2PMessage.x_ij)
+inline std::string* Round0P2PMessage::release_x_ij() {
+  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage.x_ij)
   return x_ij_.Release();
 }
-inline void Round1P2PMessage::set_allocated_x_ij(std::string* x_ij) {
+inline void Round0P2PMessage::set_allocated_x_ij(std::string* x_ij) {
   if (x_ij != nullptr) {
     
   } else {
@@ -1579,351 +602,107 @@ inline void Round1P2PMessage::set_allocated_x_ij(std::string* x_ij) {
     x_ij_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round1P2PMessage.x_ij)
+  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage.x_ij)
 }
 
-// .safeheron.proto.NoSmallFactorProof nsf_proof = 4;
-inline bool Round1P2PMessage::_internal_has_nsf_proof() const {
-  return this != internal_default_instance() && nsf_proof_ != nullptr;
-}
-inline bool Round1P2PMessage::has_nsf_proof() const {
-  return _internal_has_nsf_proof();
+// bytes e_ij_bin = 3;
+inline void Round0P2PMessage::clear_e_ij_bin() {
+  e_ij_bin_.ClearToEmpty();
 }
-inline const ::safeheron::proto::NoSmallFactorProof& Round1P2PMessage::_internal_nsf_proof() const {
-  const ::safeheron::proto::NoSmallFactorProof* p = nsf_proof_;
-  return p != nullptr ? *p : reinterpret_cast<const ::safeheron::proto::NoSmallFactorProof&>(
-      ::safeheron::proto::_NoSmallFactorProof_default_instance_);
+inline const std::string& Round0P2PMessage::e_ij_bin() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage.e_ij_bin)
+  return _internal_e_ij_bin();
 }
-inline const ::safeheron::proto::NoSmallFactorProof& Round1P2PMessage::nsf_proof() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round1P2PMessage.nsf_proof)
-  return _internal_nsf_proof();
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Round0P2PMessage::set_e_ij_bin(ArgT0&& arg0, ArgT... args) {
+ 
+ e_ij_bin_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage.e_ij_bin)
 }
-inline void Round1P2PMessage::unsafe_arena_set_allocated_nsf_proof(
-    ::safeheron::proto::NoSmallFactorProof* nsf_proof) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(nsf_proof_);
-  }
-  nsf_proof_ = nsf_proof;
-  if (nsf_proof) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round1P2PMessage.nsf_proof)
+inline std::string* Round0P2PMessage::mutable_e_ij_bin() {
+  std::string* _s = _internal_mutable_e_ij_bin();
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage.e_ij_bin)
+  return _s;
 }
-inline ::safeheron::proto::NoSmallFactorProof* Round1P2PMessage::release_nsf_proof() {
-  
-  ::safeheron::proto::NoSmallFactorProof* temp = nsf_proof_;
-  nsf_proof_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+inline const std::string& Round0P2PMessage::_internal_e_ij_bin() const {
+  return e_ij_bin_.Get();
 }
-inline ::safeheron::proto::NoSmallFactorProof* Round1P2PMessage::unsafe_arena_release_nsf_proof() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round1P2PMessage.nsf_proof)
+inline void Round0P2PMessage::_internal_set_e_ij_bin(const std::string& value) {
   
-  ::safeheron::proto::NoSmallFactorProof* temp = nsf_proof_;
-  nsf_proof_ = nullptr;
-  return temp;
+  e_ij_bin_.Set(value, GetArenaForAllocation());
 }
-inline ::safeheron::proto::NoSmallFactorProof* Round1P2PMessage::_internal_mutable_nsf_proof() {
+inline std::string* Round0P2PMessage::_internal_mutable_e_ij_bin() {
   
-  if (nsf_proof_ == nullptr) {
-    auto* p = CreateMaybeMessage<::safeheron::proto::NoSmallFactorProof>(GetArenaForAllocation());
-    nsf_proof_ = p;
-  }
-  return nsf_proof_;
+  return e_ij_bin_.Mutable(GetArenaForAllocation());
 }
-inline ::safeheron::proto::NoSmallFactorProof* Round1P2PMessage::mutable_nsf_proof() {
-  ::safeheron::proto::NoSmallFactorProof* _msg = _internal_mutable_nsf_proof();
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round1P2PMessage.nsf_proof)
-  return _msg;
+inline std::string* Round0P2PMessage::release_e_ij_bin() {
+  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage.e_ij_bin)
+  return e_ij_bin_.Release();
 }
-inline void Round1P2PMessage::set_allocated_nsf_proof(::safeheron::proto::NoSmallFactorProof* nsf_proof) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(nsf_proof_);
-  }
-  if (nsf_proof) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(nsf_proof));
-    if (message_arena != submessage_arena) {
-      nsf_proof = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, nsf_proof, submessage_arena);
-    }
+inline void Round0P2PMessage::set_allocated_e_ij_bin(std::string* e_ij_bin) {
+  if (e_ij_bin != nullptr) {
     
   } else {
     
   }
-  nsf_proof_ = nsf_proof;
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round1P2PMessage.nsf_proof)
-}
-
-// -------------------------------------------------------------------
-
-// Round2BCMessage
-
-// .safeheron.proto.CurvePoint pub = 1;
-inline bool Round2BCMessage::_internal_has_pub() const {
-  return this != internal_default_instance() && pub_ != nullptr;
-}
-inline bool Round2BCMessage::has_pub() const {
-  return _internal_has_pub();
-}
-inline const ::safeheron::proto::CurvePoint& Round2BCMessage::_internal_pub() const {
-  const ::safeheron::proto::CurvePoint* p = pub_;
-  return p != nullptr ? *p : reinterpret_cast<const ::safeheron::proto::CurvePoint&>(
-      ::safeheron::proto::_CurvePoint_default_instance_);
-}
-inline const ::safeheron::proto::CurvePoint& Round2BCMessage::pub() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round2BCMessage.pub)
-  return _internal_pub();
-}
-inline void Round2BCMessage::unsafe_arena_set_allocated_pub(
-    ::safeheron::proto::CurvePoint* pub) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(pub_);
-  }
-  pub_ = pub;
-  if (pub) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round2BCMessage.pub)
-}
-inline ::safeheron::proto::CurvePoint* Round2BCMessage::release_pub() {
-  
-  ::safeheron::proto::CurvePoint* temp = pub_;
-  pub_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
-}
-inline ::safeheron::proto::CurvePoint* Round2BCMessage::unsafe_arena_release_pub() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round2BCMessage.pub)
-  
-  ::safeheron::proto::CurvePoint* temp = pub_;
-  pub_ = nullptr;
-  return temp;
-}
-inline ::safeheron::proto::CurvePoint* Round2BCMessage::_internal_mutable_pub() {
-  
-  if (pub_ == nullptr) {
-    auto* p = CreateMaybeMessage<::safeheron::proto::CurvePoint>(GetArenaForAllocation());
-    pub_ = p;
-  }
-  return pub_;
-}
-inline ::safeheron::proto::CurvePoint* Round2BCMessage::mutable_pub() {
-  ::safeheron::proto::CurvePoint* _msg = _internal_mutable_pub();
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round2BCMessage.pub)
-  return _msg;
-}
-inline void Round2BCMessage::set_allocated_pub(::safeheron::proto::CurvePoint* pub) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(pub_);
-  }
-  if (pub) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(pub));
-    if (message_arena != submessage_arena) {
-      pub = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, pub, submessage_arena);
-    }
-    
-  } else {
-    
+  e_ij_bin_.SetAllocated(e_ij_bin, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (e_ij_bin_.IsDefault()) {
+    e_ij_bin_.Set("", GetArenaForAllocation());
   }
-  pub_ = pub;
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round2BCMessage.pub)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage.e_ij_bin)
 }
 
-// .safeheron.proto.DLogProof dlog_proof_x = 2;
-inline bool Round2BCMessage::_internal_has_dlog_proof_x() const {
-  return this != internal_default_instance() && dlog_proof_x_ != nullptr;
+// bytes x_ij_bin = 4;
+inline void Round0P2PMessage::clear_x_ij_bin() {
+  x_ij_bin_.ClearToEmpty();
 }
-inline bool Round2BCMessage::has_dlog_proof_x() const {
-  return _internal_has_dlog_proof_x();
+inline const std::string& Round0P2PMessage::x_ij_bin() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage.x_ij_bin)
+  return _internal_x_ij_bin();
 }
-inline const ::safeheron::proto::DLogProof& Round2BCMessage::_internal_dlog_proof_x() const {
-  const ::safeheron::proto::DLogProof* p = dlog_proof_x_;
-  return p != nullptr ? *p : reinterpret_cast<const ::safeheron::proto::DLogProof&>(
-      ::safeheron::proto::_DLogProof_default_instance_);
-}
-inline const ::safeheron::proto::DLogProof& Round2BCMessage::dlog_proof_x() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round2BCMessage.dlog_proof_x)
-  return _internal_dlog_proof_x();
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Round0P2PMessage::set_x_ij_bin(ArgT0&& arg0, ArgT... args) {
+ 
+ x_ij_bin_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage.x_ij_bin)
 }
-inline void Round2BCMessage::unsafe_arena_set_allocated_dlog_proof_x(
-    ::safeheron::proto::DLogProof* dlog_proof_x) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(dlog_proof_x_);
-  }
-  dlog_proof_x_ = dlog_proof_x;
-  if (dlog_proof_x) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round2BCMessage.dlog_proof_x)
+inline std::string* Round0P2PMessage::mutable_x_ij_bin() {
+  std::string* _s = _internal_mutable_x_ij_bin();
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage.x_ij_bin)
+  return _s;
 }
-inline ::safeheron::proto::DLogProof* Round2BCMessage::release_dlog_proof_x() {
-  
-  ::safeheron::proto::DLogProof* temp = dlog_proof_x_;
-  dlog_proof_x_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+inline const std::string& Round0P2PMessage::_internal_x_ij_bin() const {
+  return x_ij_bin_.Get();
 }
-inline ::safeheron::proto::DLogProof* Round2BCMessage::unsafe_arena_release_dlog_proof_x() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round2BCMessage.dlog_proof_x)
+inline void Round0P2PMessage::_internal_set_x_ij_bin(const std::string& value) {
   
-  ::safeheron::proto::DLogProof* temp = dlog_proof_x_;
-  dlog_proof_x_ = nullptr;
-  return temp;
+  x_ij_bin_.Set(value, GetArenaForAllocation());
 }
-inline ::safeheron::proto::DLogProof* Round2BCMessage::_internal_mutable_dlog_proof_x() {
+inline std::string* Round0P2PMessage::_internal_mutable_x_ij_bin() {
   
-  if (dlog_proof_x_ == nullptr) {
-    auto* p = CreateMaybeMessage<::safeheron::proto::DLogProof>(GetArenaForAllocation());
-    dlog_proof_x_ = p;
-  }
-  return dlog_proof_x_;
+  return x_ij_bin_.Mutable(GetArenaForAllocation());
 }
-inline ::safeheron::proto::DLogProof* Round2BCMessage::mutable_dlog_proof_x() {
-  ::safeheron::proto::DLogProof* _msg = _internal_mutable_dlog_proof_x();
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round2BCMessage.dlog_proof_x)
-  return _msg;
+inline std::string* Round0P2PMessage::release_x_ij_bin() {
+  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage.x_ij_bin)
+  return x_ij_bin_.Release();
 }
-inline void Round2BCMessage::set_allocated_dlog_proof_x(::safeheron::proto::DLogProof* dlog_proof_x) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(dlog_proof_x_);
-  }
-  if (dlog_proof_x) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(dlog_proof_x));
-    if (message_arena != submessage_arena) {
-      dlog_proof_x = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, dlog_proof_x, submessage_arena);
-    }
+inline void Round0P2PMessage::set_allocated_x_ij_bin(std::string* x_ij_bin) {
+  if (x_ij_bin != nullptr) {
     
   } else {
     
   }
-  dlog_proof_x_ = dlog_proof_x;
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round2BCMessage.dlog_proof_x)
-}
-
-// .safeheron.proto.PailBlumModulusProof pail_proof = 3;
-inline bool Round2BCMessage::_internal_has_pail_proof() const {
-  return this != internal_default_instance() && pail_proof_ != nullptr;
-}
-inline bool Round2BCMessage::has_pail_proof() const {
-  return _internal_has_pail_proof();
-}
-inline const ::safeheron::proto::PailBlumModulusProof& Round2BCMessage::_internal_pail_proof() const {
-  const ::safeheron::proto::PailBlumModulusProof* p = pail_proof_;
-  return p != nullptr ? *p : reinterpret_cast<const ::safeheron::proto::PailBlumModulusProof&>(
-      ::safeheron::proto::_PailBlumModulusProof_default_instance_);
-}
-inline const ::safeheron::proto::PailBlumModulusProof& Round2BCMessage::pail_proof() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round2BCMessage.pail_proof)
-  return _internal_pail_proof();
-}
-inline void Round2BCMessage::unsafe_arena_set_allocated_pail_proof(
-    ::safeheron::proto::PailBlumModulusProof* pail_proof) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(pail_proof_);
-  }
-  pail_proof_ = pail_proof;
-  if (pail_proof) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round2BCMessage.pail_proof)
-}
-inline ::safeheron::proto::PailBlumModulusProof* Round2BCMessage::release_pail_proof() {
-  
-  ::safeheron::proto::PailBlumModulusProof* temp = pail_proof_;
-  pail_proof_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
-}
-inline ::safeheron::proto::PailBlumModulusProof* Round2BCMessage::unsafe_arena_release_pail_proof() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round2BCMessage.pail_proof)
-  
-  ::safeheron::proto::PailBlumModulusProof* temp = pail_proof_;
-  pail_proof_ = nullptr;
-  return temp;
-}
-inline ::safeheron::proto::PailBlumModulusProof* Round2BCMessage::_internal_mutable_pail_proof() {
-  
-  if (pail_proof_ == nullptr) {
-    auto* p = CreateMaybeMessage<::safeheron::proto::PailBlumModulusProof>(GetArenaForAllocation());
-    pail_proof_ = p;
-  }
-  return pail_proof_;
-}
-inline ::safeheron::proto::PailBlumModulusProof* Round2BCMessage::mutable_pail_proof() {
-  ::safeheron::proto::PailBlumModulusProof* _msg = _internal_mutable_pail_proof();
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round2BCMessage.pail_proof)
-  return _msg;
-}
-inline void Round2BCMessage::set_allocated_pail_proof(::safeheron::proto::PailBlumModulusProof* pail_proof) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(pail_proof_);
-  }
-  if (pail_proof) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(pail_proof));
-    if (message_arena != submessage_arena) {
-      pail_proof = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, pail_proof, submessage_arena);
-    }
-    
-  } else {
-    
+  x_ij_bin_.SetAllocated(x_ij_bin, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (x_ij_bin_.IsDefault()) {
+    x_ij_bin_.Set("", GetArenaForAllocation());
   }
-  pail_proof_ = pail_proof;
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round2BCMessage.pail_proof)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.key_gen.Round0P2PMessage.x_ij_bin)
 }
 
 #ifdef __GNUC__
@@ -1931,10 +710,6 @@ inline void Round2BCMessage::set_allocated_pail_proof(::safeheron::proto::PailBl
 #endif  // __GNUC__
 // -------------------------------------------------------------------
 
-// -------------------------------------------------------------------
-
-// -------------------------------------------------------------------
-
 
 // @@protoc_insertion_point(namespace_scope)
 
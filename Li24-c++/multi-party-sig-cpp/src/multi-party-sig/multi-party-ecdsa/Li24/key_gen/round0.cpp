@@ -11,7 +11,7 @@ namespace Li24 {
 namespace key_gen {
 
 bool Round0::ComputeVerify() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     SignKey &sign_key = ctx->sign_key_;
     const curve::Curve *curv = curve::GetCurveParam(ctx->curve_type_);
 
@@ -60,7 +60,7 @@ bool Round0::ComputeVerify() {
 
 bool Round0::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                          std::vector<std::string> &out_des_arr) const {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     SignKey &sign_key = ctx->sign_key_;
 
     out_p2p_msg_arr.clear();
@@ -73,22 +73,24 @@ bool Round0::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string
     }
     for (size_t i = 0; i < ctx->remote_parties_.size(); ++i) {
         Round0P2PMessage p2p_message;
+        p2p_message.wire_version_ = sign_key.wire_version_;
         p2p_message.x_ij_ = ctx->local_party_.share_points_[i].y;
         p2p_message.e_ij_ = sign_key.local_party_.seed_[i];
         string base64;
-        bool ok = p2p_message.ToBase64(base64);
+        bool ok = ctx->EncodeMessage(p2p_message, base64);
         if (!ok) {
-            ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to encode to base64!");
+            ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to encode the message!");
             return false;
         }
         out_p2p_msg_arr.push_back(base64);
     }
 
     Round0BCMessage bc_message;
+    bc_message.wire_version_ = sign_key.wire_version_;
     bc_message.vs_ = ctx->local_party_.vs_;
-    bool ok = bc_message.ToBase64(out_bc_msg);
+    bool ok = ctx->EncodeMessage(bc_message, out_bc_msg);
     if (!ok) {
-        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed in bc_message.ToBase64(out_bc_msg)!");
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed in ctx->EncodeMessage(bc_message, out_bc_msg)!");
         return false;
     }
 
@@ -13,9 +13,11 @@ namespace Li24{
 namespace key_gen {
 
 
-class Round0 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRound {
+class Context;
+
+class Round0 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRoundT<Context> {
 public:
-    Round0(): MPCRound(safeheron::mpc_flow::mpc_parallel_v2::MessageType::None, safeheron::mpc_flow::mpc_parallel_v2::MessageType::P2P_BROADCAST){}
+    Round0(): MPCRoundT(safeheron::mpc_flow::mpc_parallel_v2::MessageType::None, safeheron::mpc_flow::mpc_parallel_v2::MessageType::P2P_BROADCAST){}
 
     bool ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) override { return true; }
 
@@ -25,6 +25,7 @@ bool Round0BCMessage::ToProtoObject(safeheron::proto::multi_party_ecdsa::Li24::k
         ok = vs_[i].ToProtoObject(*point_ptr);
         if (!ok) return false;
     }
+    message.set_wire_version(static_cast<int32_t>(wire_version_));
     return true;
 }
 
@@ -35,7 +36,7 @@ bool Round0BCMessage::FromProtoObject(const safeheron::proto::multi_party_ecdsa:
         if (!ok) return false;
         vs_.push_back(point);
     }
-    return true;
+    return WireVersionFromInt(message.wire_version(), wire_version_);
 }
 
 typedef Round0BCMessage TheClass;
@@ -22,13 +22,11 @@ namespace key_gen {
 bool Round0P2PMessage::ToProtoObject(safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round0P2PMessage &message) const {
     bool ok = true;
 
-    std::string str;
-    x_ij_.ToHexStr(str);
-    message.set_x_ij(str);
-
+    ok = EncodeBN(x_ij_, wire_version_, message.mutable_x_ij(), message.mutable_x_ij_bin());
+    if (!ok) return false;
 
-    e_ij_.ToHexStr(str);
-    message.set_e_ij(str);
+    ok = EncodeBN(e_ij_, wire_version_, message.mutable_e_ij(), message.mutable_e_ij_bin());
+    if (!ok) return false;
 
     return true;
 }
@@ -36,9 +34,9 @@ bool Round0P2PMessage::ToProtoObject(safeheron::proto::multi_party_ecdsa::Li24::
 bool Round0P2PMessage::FromProtoObject(const safeheron::proto::multi_party_ecdsa::Li24::key_gen::Round0P2PMessage &message) {
     bool ok = true;
 
-    x_ij_ = BN::FromHexStr(message.x_ij());
+    x_ij_ = DecodeBN(message.x_ij(), message.x_ij_bin());
     if (x_ij_ == 0) return false;
-    e_ij_ = BN::FromHexStr(message.e_ij());
+    e_ij_ = DecodeBN(message.e_ij(), message.e_ij_bin());
     if (e_ij_ == 0) return false;
 
     return true;
@@ -1,6 +1,7 @@
 #include <cstdio>
 #include "crypto-suites/crypto-sss/vsss.h"
 #include "crypto-suites/crypto-bn/rand.h"
+#include "multi-party-sig/multi-party-ecdsa/common/vss_batch_verifier.h"
 #include "multi-party-sig/multi-party-ecdsa/Li24/key_gen/context.h"
 #include "multi-party-sig/multi-party-ecdsa/Li24/key_gen/round1.h"
 
@@ -17,7 +18,7 @@ namespace Li24{
 namespace key_gen {
 
 void Round1::Init() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     for (int i = 0; i < ctx->get_total_parties() - 1; ++i) {
         bc_message_arr_.emplace_back();
         p2p_message_arr_.emplace_back();
@@ -25,7 +26,7 @@ void Round1::Init() {
 }
 
 bool Round1::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     SignKey &sign_key = ctx->sign_key_;
 
     int pos = sign_key.get_remote_party_pos(party_id);
@@ -34,13 +35,13 @@ bool Round1::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
         return false;
     }
 
-    bool ok = bc_message_arr_[pos].FromBase64(bc_msg);
+    bool ok = ctx->DecodeMessage(bc_msg, bc_message_arr_[pos]);
     if (!ok) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to deserialize bc_message from base64!");
         return false;
     }
 
-    ok = p2p_message_arr_[pos].FromBase64(p2p_msg);
+    ok = ctx->DecodeMessage(p2p_msg, p2p_message_arr_[pos]);
     if (!ok) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to deserialize from base64(p2p)!");
         return false;
@@ -50,10 +51,8 @@ bool Round1::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
 }
 
 bool Round1::ReceiveVerify(const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     SignKey &sign_key = ctx->sign_key_;
-    bool ok = true;
-    const curve::Curve *curv = curve::GetCurveParam(ctx->curve_type_);
 
     int pos = sign_key.get_remote_party_pos(party_id);
     if (pos == -1) {
@@ -61,21 +60,41 @@ bool Round1::ReceiveVerify(const std::string &party_id) {
         return false;
     }
 
-    if (!safeheron::sss::vsss::VerifyShare(bc_message_arr_[pos].vs_, sign_key.threshold_, sign_key.local_party_.index_, p2p_message_arr_[pos].x_ij_, curv->g, curv->n)) {
-        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to verify VsssSecp256k1::VerifyShare!");
+    // The parties of a key must agree on its encoding, a peer without the bytes encoding only reads hex
+    if (bc_message_arr_[pos].wire_version_ != sign_key.wire_version_) {
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Wire version mismatch with " + party_id + "!");
         return false;
     }
 
+    // The shares are verified together in ComputeVerify
+    if (bc_message_arr_[pos].vs_.size() != sign_key.threshold_) {
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid size of the commitment!");
+        return false;
+    }
 
     return true;
 }
 
 bool Round1::ComputeVerify() {
     bool ok = true;
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     SignKey &sign_key = ctx->sign_key_;
     const curve::Curve *curv = curve::GetCurveParam(ctx->curve_type_);
 
+    // Check the shares of all the peers with one multi-scalar multiplication
+    safeheron::multi_party_ecdsa::common::VssBatchVerifier vss_verifier(ctx->curve_type_, (int)sign_key.threshold_, sign_key.local_party_.index_);
+    for (size_t i = 0; i < bc_message_arr_.size(); ++i) {
+        vss_verifier.Add(bc_message_arr_[i].vs_, p2p_message_arr_[i].x_ij_);
+    }
+    std::vector<size_t> failed_arr;
+    if (!vss_verifier.Verify(failed_arr)) {
+        for (size_t pos : failed_arr) {
+            ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed in VerifyShare for party " + sign_key.remote_parties_[pos].party_id_ + "!");
+        }
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to verify the shares!");
+        return false;
+    }
+
     for (size_t i = 0; i < ctx->remote_parties_.size(); ++i) {
         sign_key.remote_parties_[i].seed_ = p2p_message_arr_[i].e_ij_ + sign_key.local_party_.seed_[i];
         ctx->remote_parties_[i].y_= bc_message_arr_[i].vs_[0];
@@ -13,13 +13,15 @@ namespace Li24{
 namespace key_gen {
 
 
-class Round1 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRound {
+class Context;
+
+class Round1 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRoundT<Context> {
 public:
     std::vector<Round0BCMessage> bc_message_arr_;
     std::vector<Round0P2PMessage> p2p_message_arr_;
 
 public:
-    Round1(): MPCRound(safeheron::mpc_flow::mpc_parallel_v2::MessageType::P2P_BROADCAST, safeheron::mpc_flow::mpc_parallel_v2::MessageType::None){}
+    Round1(): MPCRoundT(safeheron::mpc_flow::mpc_parallel_v2::MessageType::P2P_BROADCAST, safeheron::mpc_flow::mpc_parallel_v2::MessageType::None){}
 
     void Init() override;
 
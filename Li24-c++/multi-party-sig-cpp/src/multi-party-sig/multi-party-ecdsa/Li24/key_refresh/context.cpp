@@ -26,9 +26,6 @@ Context::Context(const Context &ctx): MPCContext(ctx){
     remote_parties_ = ctx.remote_parties_;
     round0_ = ctx.round0_;
     round1_ = ctx.round1_;
-    round2_ = ctx.round2_;
-    round3_ = ctx.round3_;
-    round4_ = ctx.round4_;
     // End Assignments.
 
     BindAllRounds();
@@ -47,9 +44,6 @@ Context &Context::operator=(const Context &ctx){
     remote_parties_ = ctx.remote_parties_;
     round0_ = ctx.round0_;
     round1_ = ctx.round1_;
-    round2_ = ctx.round2_;
-    round3_ = ctx.round3_;
-    round4_ = ctx.round4_;
     // End Assignments.
 
     BindAllRounds();
@@ -57,13 +51,17 @@ Context &Context::operator=(const Context &ctx){
     return *this;
 }
 
-bool Context::CreateContext(Context &ctx, std::string &sign_key_base64) {
+bool Context::CreateContext(Context &ctx, const std::string &sign_key_base64) {
     bool ok = true;
     ok = ctx.sign_key_.FromBase64(sign_key_base64);
     if (!ok) return false;
 
     SignKey &sign_key = ctx.sign_key_;
 
+    // All the parties of the key take part in the refresh
+    ok = ((int)sign_key.n_parties_ == ctx.get_total_parties());
+    if (!ok) return false;
+
     for (size_t i = 0; i < sign_key.n_parties_ - 1; ++i) {
         ctx.remote_parties_.emplace_back();
     }
@@ -71,13 +69,14 @@ bool Context::CreateContext(Context &ctx, std::string &sign_key_base64) {
     return true;
 }
 
+bool Context::IsRemoteParty(const std::string &party_id) const {
+    return sign_key_.get_remote_party_pos(party_id) != -1;
+}
+
 void Context::BindAllRounds() {
     RemoveAllRounds();
     AddRound(&round0_);
     AddRound(&round1_);
-    AddRound(&round2_);
-    AddRound(&round3_);
-    AddRound(&round4_);
 }
 
 }
@@ -9,15 +9,21 @@
 #include "multi-party-sig/multi-party-ecdsa/Li24/key_refresh/t_party.h"
 #include "multi-party-sig/multi-party-ecdsa/Li24/key_refresh/round0.h"
 #include "multi-party-sig/multi-party-ecdsa/Li24/key_refresh/round1.h"
-#include "multi-party-sig/multi-party-ecdsa/Li24/key_refresh/round2.h"
-#include "multi-party-sig/multi-party-ecdsa/Li24/key_refresh/round3.h"
-#include "multi-party-sig/multi-party-ecdsa/Li24/key_refresh/round4.h"
 
 namespace safeheron {
 namespace multi_party_ecdsa{
 namespace Li24{
 namespace key_refresh {
 
+/**
+ * Proactive refresh of a Li24 sign key, with all the parties of the key.
+ *
+ * Every party reshares x_i * lambda_i with Feldman's VSS, so the new shares still interpolate to the same private key,
+ * and derives a new PRG seed with every remote party. Li24 keys hold no Paillier key, so the refresh only takes curve
+ * operations and hashes.
+ *
+ * The PRGs of the new key start over at position 0.
+ */
 class Context : public safeheron::mpc_flow::mpc_parallel_v2::MPCContext {
 public:
     /**
@@ -39,7 +45,9 @@ public:
 
     void BindAllRounds();
 
-    static bool CreateContext(Context &ctx, std::string &sign_key_base64);
+    bool IsRemoteParty(const std::string &party_id) const override;
+
+    static bool CreateContext(Context &ctx, const std::string &sign_key_base64);
 
 public:
     safeheron::multi_party_ecdsa::Li24::SignKey sign_key_;
@@ -47,9 +55,6 @@ public:
     std::vector<RemoteTParty> remote_parties_;
     Round0 round0_;
     Round1 round1_;
-    Round2 round2_;
-    Round3 round3_;
-    Round4 round4_;
 };
 
 }
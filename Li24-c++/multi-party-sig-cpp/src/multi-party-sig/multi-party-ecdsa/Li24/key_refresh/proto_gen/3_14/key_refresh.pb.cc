@@ -15,11 +15,6 @@
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
 extern PROTOBUF_INTERNAL_EXPORT_curve_5fpoint_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_CurvePoint_curve_5fpoint_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_zkp_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_DLNProof_zkp_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_zkp_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_DLogProof_zkp_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_zkp_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_NoSmallFactorProof_zkp_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_zkp_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_PailBlumModulusProof_zkp_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_paillier_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_PailPub_paillier_2eproto;
 namespace safeheron {
 namespace proto {
 namespace multi_party_ecdsa {
@@ -29,22 +24,10 @@ class Round0BCMessageDefaultTypeInternal {
  public:
   ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Round0BCMessage> _instance;
 } _Round0BCMessage_default_instance_;
-class Round1BCMessageDefaultTypeInternal {
+class Round0P2PMessageDefaultTypeInternal {
  public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Round1BCMessage> _instance;
-} _Round1BCMessage_default_instance_;
-class Round1P2PMessageDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Round1P2PMessage> _instance;
-} _Round1P2PMessage_default_instance_;
-class Round2P2PMessageDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Round2P2PMessage> _instance;
-} _Round2P2PMessage_default_instance_;
-class Round3BCMessageDefaultTypeInternal {
- public:
-  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Round3BCMessage> _instance;
-} _Round3BCMessage_default_instance_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Round0P2PMessage> _instance;
+} _Round0P2PMessage_default_instance_;
 }  // namespace key_refresh
 }  // namespace Li24
 }  // namespace multi_party_ecdsa
@@ -60,68 +43,24 @@ static void InitDefaultsscc_info_Round0BCMessage_Li24_2fkey_5frefresh_2eproto()
   }
 }
 
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Round0BCMessage_Li24_2fkey_5frefresh_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_Round0BCMessage_Li24_2fkey_5frefresh_2eproto}, {}};
-
-static void InitDefaultsscc_info_Round1BCMessage_Li24_2fkey_5frefresh_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::_Round1BCMessage_default_instance_;
-    new (ptr) ::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round1BCMessage();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<3> scc_info_Round1BCMessage_Li24_2fkey_5frefresh_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 3, 0, InitDefaultsscc_info_Round1BCMessage_Li24_2fkey_5frefresh_2eproto}, {
-      &scc_info_CurvePoint_curve_5fpoint_2eproto.base,
-      &scc_info_DLNProof_zkp_2eproto.base,
-      &scc_info_PailPub_paillier_2eproto.base,}};
-
-static void InitDefaultsscc_info_Round1P2PMessage_Li24_2fkey_5frefresh_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::_Round1P2PMessage_default_instance_;
-    new (ptr) ::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round1P2PMessage();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Round1P2PMessage_Li24_2fkey_5frefresh_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_Round1P2PMessage_Li24_2fkey_5frefresh_2eproto}, {}};
-
-static void InitDefaultsscc_info_Round2P2PMessage_Li24_2fkey_5frefresh_2eproto() {
-  GOOGLE_PROTOBUF_VERIFY_VERSION;
-
-  {
-    void* ptr = &::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::_Round2P2PMessage_default_instance_;
-    new (ptr) ::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round2P2PMessage();
-    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
-  }
-}
-
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<3> scc_info_Round2P2PMessage_Li24_2fkey_5frefresh_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 3, 0, InitDefaultsscc_info_Round2P2PMessage_Li24_2fkey_5frefresh_2eproto}, {
-      &scc_info_DLogProof_zkp_2eproto.base,
-      &scc_info_PailBlumModulusProof_zkp_2eproto.base,
-      &scc_info_NoSmallFactorProof_zkp_2eproto.base,}};
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_Round0BCMessage_Li24_2fkey_5frefresh_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_Round0BCMessage_Li24_2fkey_5frefresh_2eproto}, {
+      &scc_info_CurvePoint_curve_5fpoint_2eproto.base,}};
 
-static void InitDefaultsscc_info_Round3BCMessage_Li24_2fkey_5frefresh_2eproto() {
+static void InitDefaultsscc_info_Round0P2PMessage_Li24_2fkey_5frefresh_2eproto() {
   GOOGLE_PROTOBUF_VERIFY_VERSION;
 
   {
-    void* ptr = &::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::_Round3BCMessage_default_instance_;
-    new (ptr) ::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round3BCMessage();
+    void* ptr = &::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::_Round0P2PMessage_default_instance_;
+    new (ptr) ::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round0P2PMessage();
     ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
   }
 }
 
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Round3BCMessage_Li24_2fkey_5frefresh_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_Round3BCMessage_Li24_2fkey_5frefresh_2eproto}, {}};
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Round0P2PMessage_Li24_2fkey_5frefresh_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_Round0P2PMessage_Li24_2fkey_5frefresh_2eproto}, {}};
 
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_Li24_2fkey_5frefresh_2eproto[5];
+static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_Li24_2fkey_5frefresh_2eproto[2];
 static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_Li24_2fkey_5frefresh_2eproto = nullptr;
 static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_Li24_2fkey_5frefresh_2eproto = nullptr;
 
@@ -131,95 +70,49 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_Li24_2fkey_5frefresh_2eproto::
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round0BCMessage, v_),
-  ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round1BCMessage, _internal_metadata_),
-  ~0u,  // no _extensions_
-  ~0u,  // no _oneof_case_
-  ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round1BCMessage, vs_),
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round1BCMessage, n_tilde_),
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round1BCMessage, h1_),
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round1BCMessage, h2_),
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round1BCMessage, dln_proof_1_),
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round1BCMessage, dln_proof_2_),
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round1BCMessage, pail_pub_),
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round1BCMessage, blind_factor_),
-  ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round1P2PMessage, _internal_metadata_),
-  ~0u,  // no _extensions_
-  ~0u,  // no _oneof_case_
-  ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round1P2PMessage, x_ij_),
-  ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round2P2PMessage, _internal_metadata_),
-  ~0u,  // no _extensions_
-  ~0u,  // no _oneof_case_
-  ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round2P2PMessage, dlog_proof_x_),
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round2P2PMessage, pail_proof_),
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round2P2PMessage, nsf_proof_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round0BCMessage, vs_),
   ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round3BCMessage, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round0P2PMessage, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round3BCMessage, ack_status_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round0P2PMessage, x_ij_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round0P2PMessage, e_ij_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round0P2PMessage, x_ij_bin_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round0P2PMessage, e_ij_bin_),
 };
 static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round0BCMessage)},
-  { 6, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round1BCMessage)},
-  { 19, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round1P2PMessage)},
-  { 25, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round2P2PMessage)},
-  { 33, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round3BCMessage)},
+  { 6, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round0P2PMessage)},
 };
 
 static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::_Round0BCMessage_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::_Round1BCMessage_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::_Round1P2PMessage_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::_Round2P2PMessage_default_instance_),
-  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::_Round3BCMessage_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::_Round0P2PMessage_default_instance_),
 };
 
 const char descriptor_table_protodef_Li24_2fkey_5frefresh_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
   "\n\026Li24/key_refresh.proto\0222safeheron.prot"
   "o.multi_party_ecdsa.Li24.key_refresh\032\021cu"
-  "rve_point.proto\032\016paillier.proto\032\tzkp.pro"
-  "to\"\034\n\017Round0BCMessage\022\t\n\001V\030\001 \001(\t\"\205\002\n\017Rou"
-  "nd1BCMessage\022\'\n\002vs\030\001 \003(\0132\033.safeheron.pro"
-  "to.CurvePoint\022\017\n\007N_tilde\030\002 \001(\t\022\n\n\002h1\030\003 \001"
-  "(\t\022\n\n\002h2\030\004 \001(\t\022.\n\013dln_proof_1\030\005 \001(\0132\031.sa"
-  "feheron.proto.DLNProof\022.\n\013dln_proof_2\030\006 "
-  "\001(\0132\031.safeheron.proto.DLNProof\022*\n\010pail_p"
-  "ub\030\007 \001(\0132\030.safeheron.proto.PailPub\022\024\n\014bl"
-  "ind_factor\030\010 \001(\t\" \n\020Round1P2PMessage\022\014\n\004"
-  "x_ij\030\010 \001(\t\"\267\001\n\020Round2P2PMessage\0220\n\014dlog_"
-  "proof_x\030\001 \001(\0132\032.safeheron.proto.DLogProo"
-  "f\0229\n\npail_proof\030\002 \001(\0132%.safeheron.proto."
-  "PailBlumModulusProof\0226\n\tnsf_proof\030\003 \001(\0132"
-  "#.safeheron.proto.NoSmallFactorProof\"%\n\017"
-  "Round3BCMessage\022\022\n\nack_status\030\001 \001(\005b\006pro"
-  "to3"
+  "rve_point.proto\":\n\017Round0BCMessage\022\'\n\002vs"
+  "\030\001 \003(\0132\033.safeheron.proto.CurvePoint\"R\n\020R"
+  "ound0P2PMessage\022\014\n\004x_ij\030\001 \001(\t\022\014\n\004e_ij\030\002 "
+  "\001(\t\022\020\n\010x_ij_bin\030\003 \001(\014\022\020\n\010e_ij_bin\030\004 \001(\014b"
+  "\006proto3"
   ;
-static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_Li24_2fkey_5frefresh_2eproto_deps[3] = {
+static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_Li24_2fkey_5frefresh_2eproto_deps[1] = {
   &::descriptor_table_curve_5fpoint_2eproto,
-  &::descriptor_table_paillier_2eproto,
-  &::descriptor_table_zkp_2eproto,
 };
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_Li24_2fkey_5frefresh_2eproto_sccs[5] = {
+static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_Li24_2fkey_5frefresh_2eproto_sccs[2] = {
   &scc_info_Round0BCMessage_Li24_2fkey_5frefresh_2eproto.base,
-  &scc_info_Round1BCMessage_Li24_2fkey_5frefresh_2eproto.base,
-  &scc_info_Round1P2PMessage_Li24_2fkey_5frefresh_2eproto.base,
-  &scc_info_Round2P2PMessage_Li24_2fkey_5frefresh_2eproto.base,
-  &scc_info_Round3BCMessage_Li24_2fkey_5frefresh_2eproto.base,
+  &scc_info_Round0P2PMessage_Li24_2fkey_5frefresh_2eproto.base,
 };
 static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_Li24_2fkey_5frefresh_2eproto_once;
 const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_Li24_2fkey_5frefresh_2eproto = {
-  false, false, descriptor_table_protodef_Li24_2fkey_5frefresh_2eproto, "Li24/key_refresh.proto", 683,
-  &descriptor_table_Li24_2fkey_5frefresh_2eproto_once, descriptor_table_Li24_2fkey_5frefresh_2eproto_sccs, descriptor_table_Li24_2fkey_5frefresh_2eproto_deps, 5, 3,
+  false, false, descriptor_table_protodef_Li24_2fkey_5frefresh_2eproto, "Li24/key_refresh.proto", 247,
+  &descriptor_table_Li24_2fkey_5frefresh_2eproto_once, descriptor_table_Li24_2fkey_5frefresh_2eproto_sccs, descriptor_table_Li24_2fkey_5frefresh_2eproto_deps, 2, 1,
   schemas, file_default_instances, TableStruct_Li24_2fkey_5frefresh_2eproto::offsets,
-  file_level_metadata_Li24_2fkey_5frefresh_2eproto, 5, file_level_enum_descriptors_Li24_2fkey_5frefresh_2eproto, file_level_service_descriptors_Li24_2fkey_5frefresh_2eproto,
+  file_level_metadata_Li24_2fkey_5frefresh_2eproto, 2, file_level_enum_descriptors_Li24_2fkey_5frefresh_2eproto, file_level_service_descriptors_Li24_2fkey_5frefresh_2eproto,
 };
 
 // Force running AddDescriptors() at dynamic initialization time.
@@ -236,26 +129,25 @@ class Round0BCMessage::_Internal {
  public:
 };
 
+void Round0BCMessage::clear_vs() {
+  vs_.Clear();
+}
 Round0BCMessage::Round0BCMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  vs_(arena) {
   SharedCtor();
   RegisterArenaDtor(arena);
   // @@protoc_insertion_point(arena_constructor:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round0BCMessage)
 }
 Round0BCMessage::Round0BCMessage(const Round0BCMessage& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      vs_(from.vs_) {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  v_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_v().empty()) {
-    v_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_v(), 
-      GetArena());
-  }
   // @@protoc_insertion_point(copy_constructor:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round0BCMessage)
 }
 
 void Round0BCMessage::SharedCtor() {
   ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Round0BCMessage_Li24_2fkey_5frefresh_2eproto.base);
-  v_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
 
 Round0BCMessage::~Round0BCMessage() {
@@ -266,7 +158,6 @@ Round0BCMessage::~Round0BCMessage() {
 
 void Round0BCMessage::SharedDtor() {
   GOOGLE_DCHECK(GetArena() == nullptr);
-  v_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
 
 void Round0BCMessage::ArenaDtor(void* object) {
@@ -290,7 +181,7 @@ void Round0BCMessage::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  v_.ClearToEmpty();
+  vs_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -301,13 +192,16 @@ const char* Round0BCMessage::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPAC
     ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
     CHK_(ptr);
     switch (tag >> 3) {
-      // string V = 1;
+      // repeated .safeheron.proto.CurvePoint vs = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          auto str = _internal_mutable_v();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round0BCMessage.V"));
-          CHK_(ptr);
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_vs(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
         } else goto handle_unusual;
         continue;
       default: {
@@ -338,14 +232,12 @@ failure:
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string V = 1;
-  if (this->v().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_v().data(), static_cast<int>(this->_internal_v().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round0BCMessage.V");
-    target = stream->WriteStringMaybeAliased(
-        1, this->_internal_v(), target);
+  // repeated .safeheron.proto.CurvePoint vs = 1;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_vs_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, this->_internal_vs(i), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -364,11 +256,11 @@ size_t Round0BCMessage::ByteSizeLong() const {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string V = 1;
-  if (this->v().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_v());
+  // repeated .safeheron.proto.CurvePoint vs = 1;
+  total_size += 1UL * this->_internal_vs_size();
+  for (const auto& msg : this->vs_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -402,9 +294,7 @@ void Round0BCMessage::MergeFrom(const Round0BCMessage& from) {
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from.v().size() > 0) {
-    _internal_set_v(from._internal_v());
-  }
+  vs_.MergeFrom(from.vs_);
 }
 
 void Round0BCMessage::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
@@ -428,7 +318,7 @@ bool Round0BCMessage::IsInitialized() const {
 void Round0BCMessage::InternalSwap(Round0BCMessage* other) {
   using std::swap;
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  v_.Swap(&other->v_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  vs_.InternalSwap(&other->vs_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Round0BCMessage::GetMetadata() const {
@@ -438,238 +328,130 @@ void Round0BCMessage::InternalSwap(Round0BCMessage* other) {
 
 // ===================================================================
 
-class Round1BCMessage::_Internal {
+class Round0P2PMessage::_Internal {
  public:
-  static const ::safeheron::proto::DLNProof& dln_proof_1(const Round1BCMessage* msg);
-  static const ::safeheron::proto::DLNProof& dln_proof_2(const Round1BCMessage* msg);
-  static const ::safeheron::proto::PailPub& pail_pub(const Round1BCMessage* msg);
 };
 
-const ::safeheron::proto::DLNProof&
-Round1BCMessage::_Internal::dln_proof_1(const Round1BCMessage* msg) {
-  return *msg->dln_proof_1_;
-}
-const ::safeheron::proto::DLNProof&
-Round1BCMessage::_Internal::dln_proof_2(const Round1BCMessage* msg) {
-  return *msg->dln_proof_2_;
-}
-const ::safeheron::proto::PailPub&
-Round1BCMessage::_Internal::pail_pub(const Round1BCMessage* msg) {
-  return *msg->pail_pub_;
-}
-void Round1BCMessage::clear_vs() {
-  vs_.Clear();
-}
-void Round1BCMessage::clear_dln_proof_1() {
-  if (GetArena() == nullptr && dln_proof_1_ != nullptr) {
-    delete dln_proof_1_;
-  }
-  dln_proof_1_ = nullptr;
-}
-void Round1BCMessage::clear_dln_proof_2() {
-  if (GetArena() == nullptr && dln_proof_2_ != nullptr) {
-    delete dln_proof_2_;
-  }
-  dln_proof_2_ = nullptr;
-}
-void Round1BCMessage::clear_pail_pub() {
-  if (GetArena() == nullptr && pail_pub_ != nullptr) {
-    delete pail_pub_;
-  }
-  pail_pub_ = nullptr;
-}
-Round1BCMessage::Round1BCMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  vs_(arena) {
+Round0P2PMessage::Round0P2PMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
   SharedCtor();
   RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round1BCMessage)
+  // @@protoc_insertion_point(arena_constructor:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round0P2PMessage)
 }
-Round1BCMessage::Round1BCMessage(const Round1BCMessage& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message(),
-      vs_(from.vs_) {
+Round0P2PMessage::Round0P2PMessage(const Round0P2PMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  n_tilde_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_n_tilde().empty()) {
-    n_tilde_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_n_tilde(), 
+  x_ij_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_x_ij().empty()) {
+    x_ij_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_x_ij(), 
       GetArena());
   }
-  h1_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_h1().empty()) {
-    h1_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_h1(), 
+  e_ij_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_e_ij().empty()) {
+    e_ij_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_e_ij(), 
       GetArena());
   }
-  h2_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_h2().empty()) {
-    h2_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_h2(), 
+  x_ij_bin_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_x_ij_bin().empty()) {
+    x_ij_bin_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_x_ij_bin(), 
       GetArena());
   }
-  blind_factor_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_blind_factor().empty()) {
-    blind_factor_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_blind_factor(), 
+  e_ij_bin_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_e_ij_bin().empty()) {
+    e_ij_bin_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_e_ij_bin(), 
       GetArena());
   }
-  if (from._internal_has_dln_proof_1()) {
-    dln_proof_1_ = new ::safeheron::proto::DLNProof(*from.dln_proof_1_);
-  } else {
-    dln_proof_1_ = nullptr;
-  }
-  if (from._internal_has_dln_proof_2()) {
-    dln_proof_2_ = new ::safeheron::proto::DLNProof(*from.dln_proof_2_);
-  } else {
-    dln_proof_2_ = nullptr;
-  }
-  if (from._internal_has_pail_pub()) {
-    pail_pub_ = new ::safeheron::proto::PailPub(*from.pail_pub_);
-  } else {
-    pail_pub_ = nullptr;
-  }
-  // @@protoc_insertion_point(copy_constructor:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round1BCMessage)
+  // @@protoc_insertion_point(copy_constructor:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round0P2PMessage)
 }
 
-void Round1BCMessage::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Round1BCMessage_Li24_2fkey_5frefresh_2eproto.base);
-  n_tilde_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  h1_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  h2_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  blind_factor_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  ::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-      reinterpret_cast<char*>(&dln_proof_1_) - reinterpret_cast<char*>(this)),
-      0, static_cast<size_t>(reinterpret_cast<char*>(&pail_pub_) -
-      reinterpret_cast<char*>(&dln_proof_1_)) + sizeof(pail_pub_));
+void Round0P2PMessage::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Round0P2PMessage_Li24_2fkey_5frefresh_2eproto.base);
+  x_ij_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  e_ij_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  x_ij_bin_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  e_ij_bin_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
 
-Round1BCMessage::~Round1BCMessage() {
-  // @@protoc_insertion_point(destructor:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round1BCMessage)
+Round0P2PMessage::~Round0P2PMessage() {
+  // @@protoc_insertion_point(destructor:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round0P2PMessage)
   SharedDtor();
   _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-void Round1BCMessage::SharedDtor() {
+void Round0P2PMessage::SharedDtor() {
   GOOGLE_DCHECK(GetArena() == nullptr);
-  n_tilde_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  h1_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  h2_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  blind_factor_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (this != internal_default_instance()) delete dln_proof_1_;
-  if (this != internal_default_instance()) delete dln_proof_2_;
-  if (this != internal_default_instance()) delete pail_pub_;
+  x_ij_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  e_ij_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  x_ij_bin_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  e_ij_bin_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
 
-void Round1BCMessage::ArenaDtor(void* object) {
-  Round1BCMessage* _this = reinterpret_cast< Round1BCMessage* >(object);
+void Round0P2PMessage::ArenaDtor(void* object) {
+  Round0P2PMessage* _this = reinterpret_cast< Round0P2PMessage* >(object);
   (void)_this;
 }
-void Round1BCMessage::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+void Round0P2PMessage::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
 }
-void Round1BCMessage::SetCachedSize(int size) const {
+void Round0P2PMessage::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
-const Round1BCMessage& Round1BCMessage::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Round1BCMessage_Li24_2fkey_5frefresh_2eproto.base);
+const Round0P2PMessage& Round0P2PMessage::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Round0P2PMessage_Li24_2fkey_5frefresh_2eproto.base);
   return *internal_default_instance();
 }
 
 
-void Round1BCMessage::Clear() {
-// @@protoc_insertion_point(message_clear_start:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round1BCMessage)
+void Round0P2PMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round0P2PMessage)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  vs_.Clear();
-  n_tilde_.ClearToEmpty();
-  h1_.ClearToEmpty();
-  h2_.ClearToEmpty();
-  blind_factor_.ClearToEmpty();
-  if (GetArena() == nullptr && dln_proof_1_ != nullptr) {
-    delete dln_proof_1_;
-  }
-  dln_proof_1_ = nullptr;
-  if (GetArena() == nullptr && dln_proof_2_ != nullptr) {
-    delete dln_proof_2_;
-  }
-  dln_proof_2_ = nullptr;
-  if (GetArena() == nullptr && pail_pub_ != nullptr) {
-    delete pail_pub_;
-  }
-  pail_pub_ = nullptr;
+  x_ij_.ClearToEmpty();
+  e_ij_.ClearToEmpty();
+  x_ij_bin_.ClearToEmpty();
+  e_ij_bin_.ClearToEmpty();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Round1BCMessage::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+const char* Round0P2PMessage::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     ::PROTOBUF_NAMESPACE_ID::uint32 tag;
     ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
     CHK_(ptr);
     switch (tag >> 3) {
-      // repeated .safeheron.proto.CurvePoint vs = 1;
+      // string x_ij = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr -= 1;
-          do {
-            ptr += 1;
-            ptr = ctx->ParseMessage(_internal_add_vs(), ptr);
-            CHK_(ptr);
-            if (!ctx->DataAvailable(ptr)) break;
-          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+          auto str = _internal_mutable_x_ij();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round0P2PMessage.x_ij"));
+          CHK_(ptr);
         } else goto handle_unusual;
         continue;
-      // string N_tilde = 2;
+      // string e_ij = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          auto str = _internal_mutable_n_tilde();
+          auto str = _internal_mutable_e_ij();
           ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round1BCMessage.N_tilde"));
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round0P2PMessage.e_ij"));
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
-      // string h1 = 3;
+      // bytes x_ij_bin = 3;
       case 3:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
-          auto str = _internal_mutable_h1();
+          auto str = _internal_mutable_x_ij_bin();
           ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round1BCMessage.h1"));
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
-      // string h2 = 4;
+      // bytes e_ij_bin = 4;
       case 4:
         if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
-          auto str = _internal_mutable_h2();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round1BCMessage.h2"));
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // .safeheron.proto.DLNProof dln_proof_1 = 5;
-      case 5:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
-          ptr = ctx->ParseMessage(_internal_mutable_dln_proof_1(), ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // .safeheron.proto.DLNProof dln_proof_2 = 6;
-      case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
-          ptr = ctx->ParseMessage(_internal_mutable_dln_proof_2(), ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // .safeheron.proto.PailPub pail_pub = 7;
-      case 7:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 58)) {
-          ptr = ctx->ParseMessage(_internal_mutable_pail_pub(), ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // string blind_factor = 8;
-      case 8:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 66)) {
-          auto str = _internal_mutable_blind_factor();
+          auto str = _internal_mutable_e_ij_bin();
           ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round1BCMessage.blind_factor"));
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
@@ -695,154 +477,86 @@ failure:
 #undef CHK_
 }
 
-::PROTOBUF_NAMESPACE_ID::uint8* Round1BCMessage::_InternalSerialize(
+::PROTOBUF_NAMESPACE_ID::uint8* Round0P2PMessage::_InternalSerialize(
     ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round1BCMessage)
+  // @@protoc_insertion_point(serialize_to_array_start:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round0P2PMessage)
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // repeated .safeheron.proto.CurvePoint vs = 1;
-  for (unsigned int i = 0,
-      n = static_cast<unsigned int>(this->_internal_vs_size()); i < n; i++) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, this->_internal_vs(i), target, stream);
-  }
-
-  // string N_tilde = 2;
-  if (this->n_tilde().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_n_tilde().data(), static_cast<int>(this->_internal_n_tilde().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round1BCMessage.N_tilde");
-    target = stream->WriteStringMaybeAliased(
-        2, this->_internal_n_tilde(), target);
-  }
-
-  // string h1 = 3;
-  if (this->h1().size() > 0) {
+  // string x_ij = 1;
+  if (this->x_ij().size() > 0) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_h1().data(), static_cast<int>(this->_internal_h1().length()),
+      this->_internal_x_ij().data(), static_cast<int>(this->_internal_x_ij().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round1BCMessage.h1");
+      "safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round0P2PMessage.x_ij");
     target = stream->WriteStringMaybeAliased(
-        3, this->_internal_h1(), target);
+        1, this->_internal_x_ij(), target);
   }
 
-  // string h2 = 4;
-  if (this->h2().size() > 0) {
+  // string e_ij = 2;
+  if (this->e_ij().size() > 0) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_h2().data(), static_cast<int>(this->_internal_h2().length()),
+      this->_internal_e_ij().data(), static_cast<int>(this->_internal_e_ij().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round1BCMessage.h2");
+      "safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round0P2PMessage.e_ij");
     target = stream->WriteStringMaybeAliased(
-        4, this->_internal_h2(), target);
-  }
-
-  // .safeheron.proto.DLNProof dln_proof_1 = 5;
-  if (this->has_dln_proof_1()) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        5, _Internal::dln_proof_1(this), target, stream);
-  }
-
-  // .safeheron.proto.DLNProof dln_proof_2 = 6;
-  if (this->has_dln_proof_2()) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        6, _Internal::dln_proof_2(this), target, stream);
+        2, this->_internal_e_ij(), target);
   }
 
-  // .safeheron.proto.PailPub pail_pub = 7;
-  if (this->has_pail_pub()) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        7, _Internal::pail_pub(this), target, stream);
+  // bytes x_ij_bin = 3;
+  if (this->x_ij_bin().size() > 0) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_x_ij_bin(), target);
   }
 
-  // string blind_factor = 8;
-  if (this->blind_factor().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_blind_factor().data(), static_cast<int>(this->_internal_blind_factor().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round1BCMessage.blind_factor");
-    target = stream->WriteStringMaybeAliased(
-        8, this->_internal_blind_factor(), target);
+  // bytes e_ij_bin = 4;
+  if (this->e_ij_bin().size() > 0) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_e_ij_bin(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round1BCMessage)
+  // @@protoc_insertion_point(serialize_to_array_end:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round0P2PMessage)
   return target;
 }
 
-size_t Round1BCMessage::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round1BCMessage)
+size_t Round0P2PMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round0P2PMessage)
   size_t total_size = 0;
 
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // repeated .safeheron.proto.CurvePoint vs = 1;
-  total_size += 1UL * this->_internal_vs_size();
-  for (const auto& msg : this->vs_) {
-    total_size +=
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
-  }
-
-  // string N_tilde = 2;
-  if (this->n_tilde().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_n_tilde());
-  }
-
-  // string h1 = 3;
-  if (this->h1().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_h1());
-  }
-
-  // string h2 = 4;
-  if (this->h2().size() > 0) {
+  // string x_ij = 1;
+  if (this->x_ij().size() > 0) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_h2());
+        this->_internal_x_ij());
   }
 
-  // string blind_factor = 8;
-  if (this->blind_factor().size() > 0) {
+  // string e_ij = 2;
+  if (this->e_ij().size() > 0) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_blind_factor());
-  }
-
-  // .safeheron.proto.DLNProof dln_proof_1 = 5;
-  if (this->has_dln_proof_1()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *dln_proof_1_);
+        this->_internal_e_ij());
   }
 
-  // .safeheron.proto.DLNProof dln_proof_2 = 6;
-  if (this->has_dln_proof_2()) {
+  // bytes x_ij_bin = 3;
+  if (this->x_ij_bin().size() > 0) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *dln_proof_2_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_x_ij_bin());
   }
 
-  // .safeheron.proto.PailPub pail_pub = 7;
-  if (this->has_pail_pub()) {
+  // bytes e_ij_bin = 4;
+  if (this->e_ij_bin().size() > 0) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *pail_pub_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_e_ij_bin());
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -854,803 +568,70 @@ size_t Round1BCMessage::ByteSizeLong() const {
   return total_size;
 }
 
-void Round1BCMessage::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round1BCMessage)
+void Round0P2PMessage::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round0P2PMessage)
   GOOGLE_DCHECK_NE(&from, this);
-  const Round1BCMessage* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Round1BCMessage>(
+  const Round0P2PMessage* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Round0P2PMessage>(
           &from);
   if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round1BCMessage)
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round0P2PMessage)
     ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
   } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round1BCMessage)
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round0P2PMessage)
     MergeFrom(*source);
   }
 }
 
-void Round1BCMessage::MergeFrom(const Round1BCMessage& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round1BCMessage)
+void Round0P2PMessage::MergeFrom(const Round0P2PMessage& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round0P2PMessage)
   GOOGLE_DCHECK_NE(&from, this);
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
   (void) cached_has_bits;
 
-  vs_.MergeFrom(from.vs_);
-  if (from.n_tilde().size() > 0) {
-    _internal_set_n_tilde(from._internal_n_tilde());
-  }
-  if (from.h1().size() > 0) {
-    _internal_set_h1(from._internal_h1());
-  }
-  if (from.h2().size() > 0) {
-    _internal_set_h2(from._internal_h2());
-  }
-  if (from.blind_factor().size() > 0) {
-    _internal_set_blind_factor(from._internal_blind_factor());
+  if (from.x_ij().size() > 0) {
+    _internal_set_x_ij(from._internal_x_ij());
   }
-  if (from.has_dln_proof_1()) {
-    _internal_mutable_dln_proof_1()->::safeheron::proto::DLNProof::MergeFrom(from._internal_dln_proof_1());
+  if (from.e_ij().size() > 0) {
+    _internal_set_e_ij(from._internal_e_ij());
   }
-  if (from.has_dln_proof_2()) {
-    _internal_mutable_dln_proof_2()->::safeheron::proto::DLNProof::MergeFrom(from._internal_dln_proof_2());
+  if (from.x_ij_bin().size() > 0) {
+    _internal_set_x_ij_bin(from._internal_x_ij_bin());
   }
-  if (from.has_pail_pub()) {
-    _internal_mutable_pail_pub()->::safeheron::proto::PailPub::MergeFrom(from._internal_pail_pub());
+  if (from.e_ij_bin().size() > 0) {
+    _internal_set_e_ij_bin(from._internal_e_ij_bin());
   }
 }
 
-void Round1BCMessage::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round1BCMessage)
+void Round0P2PMessage::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round0P2PMessage)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-void Round1BCMessage::CopyFrom(const Round1BCMessage& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round1BCMessage)
+void Round0P2PMessage::CopyFrom(const Round0P2PMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round0P2PMessage)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Round1BCMessage::IsInitialized() const {
+bool Round0P2PMessage::IsInitialized() const {
   return true;
 }
 
-void Round1BCMessage::InternalSwap(Round1BCMessage* other) {
+void Round0P2PMessage::InternalSwap(Round0P2PMessage* other) {
   using std::swap;
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  vs_.InternalSwap(&other->vs_);
-  n_tilde_.Swap(&other->n_tilde_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  h1_.Swap(&other->h1_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  h2_.Swap(&other->h2_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  blind_factor_.Swap(&other->blind_factor_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Round1BCMessage, pail_pub_)
-      + sizeof(Round1BCMessage::pail_pub_)
-      - PROTOBUF_FIELD_OFFSET(Round1BCMessage, dln_proof_1_)>(
-          reinterpret_cast<char*>(&dln_proof_1_),
-          reinterpret_cast<char*>(&other->dln_proof_1_));
+  x_ij_.Swap(&other->x_ij_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  e_ij_.Swap(&other->e_ij_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  x_ij_bin_.Swap(&other->x_ij_bin_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  e_ij_bin_.Swap(&other->e_ij_bin_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata Round1BCMessage::GetMetadata() const {
-  return GetMetadataStatic();
-}
-
-
-// ===================================================================
-
-class Round1P2PMessage::_Internal {
- public:
-};
-
-Round1P2PMessage::Round1P2PMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round1P2PMessage)
-}
-Round1P2PMessage::Round1P2PMessage(const Round1P2PMessage& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message() {
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  x_ij_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  if (!from._internal_x_ij().empty()) {
-    x_ij_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_x_ij(), 
-      GetArena());
-  }
-  // @@protoc_insertion_point(copy_constructor:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round1P2PMessage)
-}
-
-void Round1P2PMessage::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Round1P2PMessage_Li24_2fkey_5frefresh_2eproto.base);
-  x_ij_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-
-Round1P2PMessage::~Round1P2PMessage() {
-  // @@protoc_insertion_point(destructor:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round1P2PMessage)
-  SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-void Round1P2PMessage::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  x_ij_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-}
-
-void Round1P2PMessage::ArenaDtor(void* object) {
-  Round1P2PMessage* _this = reinterpret_cast< Round1P2PMessage* >(object);
-  (void)_this;
-}
-void Round1P2PMessage::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void Round1P2PMessage::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const Round1P2PMessage& Round1P2PMessage::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Round1P2PMessage_Li24_2fkey_5frefresh_2eproto.base);
-  return *internal_default_instance();
-}
-
-
-void Round1P2PMessage::Clear() {
-// @@protoc_insertion_point(message_clear_start:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round1P2PMessage)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  x_ij_.ClearToEmpty();
-  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-const char* Round1P2PMessage::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
-#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
-    switch (tag >> 3) {
-      // string x_ij = 8;
-      case 8:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 66)) {
-          auto str = _internal_mutable_x_ij();
-          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round1P2PMessage.x_ij"));
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
-    }  // switch
-  }  // while
-success:
-  return ptr;
-failure:
-  ptr = nullptr;
-  goto success;
-#undef CHK_
-}
-
-::PROTOBUF_NAMESPACE_ID::uint8* Round1P2PMessage::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round1P2PMessage)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // string x_ij = 8;
-  if (this->x_ij().size() > 0) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_x_ij().data(), static_cast<int>(this->_internal_x_ij().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round1P2PMessage.x_ij");
-    target = stream->WriteStringMaybeAliased(
-        8, this->_internal_x_ij(), target);
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round1P2PMessage)
-  return target;
-}
-
-size_t Round1P2PMessage::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round1P2PMessage)
-  size_t total_size = 0;
-
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  // string x_ij = 8;
-  if (this->x_ij().size() > 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_x_ij());
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void Round1P2PMessage::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round1P2PMessage)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Round1P2PMessage* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Round1P2PMessage>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round1P2PMessage)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round1P2PMessage)
-    MergeFrom(*source);
-  }
-}
-
-void Round1P2PMessage::MergeFrom(const Round1P2PMessage& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round1P2PMessage)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (from.x_ij().size() > 0) {
-    _internal_set_x_ij(from._internal_x_ij());
-  }
-}
-
-void Round1P2PMessage::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round1P2PMessage)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void Round1P2PMessage::CopyFrom(const Round1P2PMessage& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round1P2PMessage)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool Round1P2PMessage::IsInitialized() const {
-  return true;
-}
-
-void Round1P2PMessage::InternalSwap(Round1P2PMessage* other) {
-  using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  x_ij_.Swap(&other->x_ij_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata Round1P2PMessage::GetMetadata() const {
-  return GetMetadataStatic();
-}
-
-
-// ===================================================================
-
-class Round2P2PMessage::_Internal {
- public:
-  static const ::safeheron::proto::DLogProof& dlog_proof_x(const Round2P2PMessage* msg);
-  static const ::safeheron::proto::PailBlumModulusProof& pail_proof(const Round2P2PMessage* msg);
-  static const ::safeheron::proto::NoSmallFactorProof& nsf_proof(const Round2P2PMessage* msg);
-};
-
-const ::safeheron::proto::DLogProof&
-Round2P2PMessage::_Internal::dlog_proof_x(const Round2P2PMessage* msg) {
-  return *msg->dlog_proof_x_;
-}
-const ::safeheron::proto::PailBlumModulusProof&
-Round2P2PMessage::_Internal::pail_proof(const Round2P2PMessage* msg) {
-  return *msg->pail_proof_;
-}
-const ::safeheron::proto::NoSmallFactorProof&
-Round2P2PMessage::_Internal::nsf_proof(const Round2P2PMessage* msg) {
-  return *msg->nsf_proof_;
-}
-void Round2P2PMessage::clear_dlog_proof_x() {
-  if (GetArena() == nullptr && dlog_proof_x_ != nullptr) {
-    delete dlog_proof_x_;
-  }
-  dlog_proof_x_ = nullptr;
-}
-void Round2P2PMessage::clear_pail_proof() {
-  if (GetArena() == nullptr && pail_proof_ != nullptr) {
-    delete pail_proof_;
-  }
-  pail_proof_ = nullptr;
-}
-void Round2P2PMessage::clear_nsf_proof() {
-  if (GetArena() == nullptr && nsf_proof_ != nullptr) {
-    delete nsf_proof_;
-  }
-  nsf_proof_ = nullptr;
-}
-Round2P2PMessage::Round2P2PMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round2P2PMessage)
-}
-Round2P2PMessage::Round2P2PMessage(const Round2P2PMessage& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message() {
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  if (from._internal_has_dlog_proof_x()) {
-    dlog_proof_x_ = new ::safeheron::proto::DLogProof(*from.dlog_proof_x_);
-  } else {
-    dlog_proof_x_ = nullptr;
-  }
-  if (from._internal_has_pail_proof()) {
-    pail_proof_ = new ::safeheron::proto::PailBlumModulusProof(*from.pail_proof_);
-  } else {
-    pail_proof_ = nullptr;
-  }
-  if (from._internal_has_nsf_proof()) {
-    nsf_proof_ = new ::safeheron::proto::NoSmallFactorProof(*from.nsf_proof_);
-  } else {
-    nsf_proof_ = nullptr;
-  }
-  // @@protoc_insertion_point(copy_constructor:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round2P2PMessage)
-}
-
-void Round2P2PMessage::SharedCtor() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Round2P2PMessage_Li24_2fkey_5frefresh_2eproto.base);
-  ::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-      reinterpret_cast<char*>(&dlog_proof_x_) - reinterpret_cast<char*>(this)),
-      0, static_cast<size_t>(reinterpret_cast<char*>(&nsf_proof_) -
-      reinterpret_cast<char*>(&dlog_proof_x_)) + sizeof(nsf_proof_));
-}
-
-Round2P2PMessage::~Round2P2PMessage() {
-  // @@protoc_insertion_point(destructor:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round2P2PMessage)
-  SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-void Round2P2PMessage::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-  if (this != internal_default_instance()) delete dlog_proof_x_;
-  if (this != internal_default_instance()) delete pail_proof_;
-  if (this != internal_default_instance()) delete nsf_proof_;
-}
-
-void Round2P2PMessage::ArenaDtor(void* object) {
-  Round2P2PMessage* _this = reinterpret_cast< Round2P2PMessage* >(object);
-  (void)_this;
-}
-void Round2P2PMessage::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void Round2P2PMessage::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const Round2P2PMessage& Round2P2PMessage::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Round2P2PMessage_Li24_2fkey_5frefresh_2eproto.base);
-  return *internal_default_instance();
-}
-
-
-void Round2P2PMessage::Clear() {
-// @@protoc_insertion_point(message_clear_start:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round2P2PMessage)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  if (GetArena() == nullptr && dlog_proof_x_ != nullptr) {
-    delete dlog_proof_x_;
-  }
-  dlog_proof_x_ = nullptr;
-  if (GetArena() == nullptr && pail_proof_ != nullptr) {
-    delete pail_proof_;
-  }
-  pail_proof_ = nullptr;
-  if (GetArena() == nullptr && nsf_proof_ != nullptr) {
-    delete nsf_proof_;
-  }
-  nsf_proof_ = nullptr;
-  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-const char* Round2P2PMessage::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
-#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
-    switch (tag >> 3) {
-      // .safeheron.proto.DLogProof dlog_proof_x = 1;
-      case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
-          ptr = ctx->ParseMessage(_internal_mutable_dlog_proof_x(), ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // .safeheron.proto.PailBlumModulusProof pail_proof = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
-          ptr = ctx->ParseMessage(_internal_mutable_pail_proof(), ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      // .safeheron.proto.NoSmallFactorProof nsf_proof = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
-          ptr = ctx->ParseMessage(_internal_mutable_nsf_proof(), ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
-    }  // switch
-  }  // while
-success:
-  return ptr;
-failure:
-  ptr = nullptr;
-  goto success;
-#undef CHK_
-}
-
-::PROTOBUF_NAMESPACE_ID::uint8* Round2P2PMessage::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round2P2PMessage)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // .safeheron.proto.DLogProof dlog_proof_x = 1;
-  if (this->has_dlog_proof_x()) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        1, _Internal::dlog_proof_x(this), target, stream);
-  }
-
-  // .safeheron.proto.PailBlumModulusProof pail_proof = 2;
-  if (this->has_pail_proof()) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        2, _Internal::pail_proof(this), target, stream);
-  }
-
-  // .safeheron.proto.NoSmallFactorProof nsf_proof = 3;
-  if (this->has_nsf_proof()) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(
-        3, _Internal::nsf_proof(this), target, stream);
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round2P2PMessage)
-  return target;
-}
-
-size_t Round2P2PMessage::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round2P2PMessage)
-  size_t total_size = 0;
-
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  // .safeheron.proto.DLogProof dlog_proof_x = 1;
-  if (this->has_dlog_proof_x()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *dlog_proof_x_);
-  }
-
-  // .safeheron.proto.PailBlumModulusProof pail_proof = 2;
-  if (this->has_pail_proof()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *pail_proof_);
-  }
-
-  // .safeheron.proto.NoSmallFactorProof nsf_proof = 3;
-  if (this->has_nsf_proof()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *nsf_proof_);
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void Round2P2PMessage::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round2P2PMessage)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Round2P2PMessage* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Round2P2PMessage>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round2P2PMessage)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round2P2PMessage)
-    MergeFrom(*source);
-  }
-}
-
-void Round2P2PMessage::MergeFrom(const Round2P2PMessage& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round2P2PMessage)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (from.has_dlog_proof_x()) {
-    _internal_mutable_dlog_proof_x()->::safeheron::proto::DLogProof::MergeFrom(from._internal_dlog_proof_x());
-  }
-  if (from.has_pail_proof()) {
-    _internal_mutable_pail_proof()->::safeheron::proto::PailBlumModulusProof::MergeFrom(from._internal_pail_proof());
-  }
-  if (from.has_nsf_proof()) {
-    _internal_mutable_nsf_proof()->::safeheron::proto::NoSmallFactorProof::MergeFrom(from._internal_nsf_proof());
-  }
-}
-
-void Round2P2PMessage::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round2P2PMessage)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void Round2P2PMessage::CopyFrom(const Round2P2PMessage& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round2P2PMessage)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool Round2P2PMessage::IsInitialized() const {
-  return true;
-}
-
-void Round2P2PMessage::InternalSwap(Round2P2PMessage* other) {
-  using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Round2P2PMessage, nsf_proof_)
-      + sizeof(Round2P2PMessage::nsf_proof_)
-      - PROTOBUF_FIELD_OFFSET(Round2P2PMessage, dlog_proof_x_)>(
-          reinterpret_cast<char*>(&dlog_proof_x_),
-          reinterpret_cast<char*>(&other->dlog_proof_x_));
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata Round2P2PMessage::GetMetadata() const {
-  return GetMetadataStatic();
-}
-
-
-// ===================================================================
-
-class Round3BCMessage::_Internal {
- public:
-};
-
-Round3BCMessage::Round3BCMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
-  SharedCtor();
-  RegisterArenaDtor(arena);
-  // @@protoc_insertion_point(arena_constructor:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round3BCMessage)
-}
-Round3BCMessage::Round3BCMessage(const Round3BCMessage& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message() {
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ack_status_ = from.ack_status_;
-  // @@protoc_insertion_point(copy_constructor:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round3BCMessage)
-}
-
-void Round3BCMessage::SharedCtor() {
-  ack_status_ = 0;
-}
-
-Round3BCMessage::~Round3BCMessage() {
-  // @@protoc_insertion_point(destructor:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round3BCMessage)
-  SharedDtor();
-  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-void Round3BCMessage::SharedDtor() {
-  GOOGLE_DCHECK(GetArena() == nullptr);
-}
-
-void Round3BCMessage::ArenaDtor(void* object) {
-  Round3BCMessage* _this = reinterpret_cast< Round3BCMessage* >(object);
-  (void)_this;
-}
-void Round3BCMessage::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
-}
-void Round3BCMessage::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-const Round3BCMessage& Round3BCMessage::default_instance() {
-  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_Round3BCMessage_Li24_2fkey_5frefresh_2eproto.base);
-  return *internal_default_instance();
-}
-
-
-void Round3BCMessage::Clear() {
-// @@protoc_insertion_point(message_clear_start:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round3BCMessage)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  ack_status_ = 0;
-  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-const char* Round3BCMessage::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
-#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  while (!ctx->Done(&ptr)) {
-    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
-    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
-    CHK_(ptr);
-    switch (tag >> 3) {
-      // int32 ack_status = 1;
-      case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
-          ack_status_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
-          CHK_(ptr);
-        } else goto handle_unusual;
-        continue;
-      default: {
-      handle_unusual:
-        if ((tag & 7) == 4 || tag == 0) {
-          ctx->SetLastTag(tag);
-          goto success;
-        }
-        ptr = UnknownFieldParse(tag,
-            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-            ptr, ctx);
-        CHK_(ptr != nullptr);
-        continue;
-      }
-    }  // switch
-  }  // while
-success:
-  return ptr;
-failure:
-  ptr = nullptr;
-  goto success;
-#undef CHK_
-}
-
-::PROTOBUF_NAMESPACE_ID::uint8* Round3BCMessage::_InternalSerialize(
-    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round3BCMessage)
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // int32 ack_status = 1;
-  if (this->ack_status() != 0) {
-    target = stream->EnsureSpace(target);
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_ack_status(), target);
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round3BCMessage)
-  return target;
-}
-
-size_t Round3BCMessage::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round3BCMessage)
-  size_t total_size = 0;
-
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  // int32 ack_status = 1;
-  if (this->ack_status() != 0) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
-        this->_internal_ack_status());
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
-        _internal_metadata_, total_size, &_cached_size_);
-  }
-  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
-  SetCachedSize(cached_size);
-  return total_size;
-}
-
-void Round3BCMessage::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_merge_from_start:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round3BCMessage)
-  GOOGLE_DCHECK_NE(&from, this);
-  const Round3BCMessage* source =
-      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<Round3BCMessage>(
-          &from);
-  if (source == nullptr) {
-  // @@protoc_insertion_point(generalized_merge_from_cast_fail:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round3BCMessage)
-    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
-  } else {
-  // @@protoc_insertion_point(generalized_merge_from_cast_success:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round3BCMessage)
-    MergeFrom(*source);
-  }
-}
-
-void Round3BCMessage::MergeFrom(const Round3BCMessage& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round3BCMessage)
-  GOOGLE_DCHECK_NE(&from, this);
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (from.ack_status() != 0) {
-    _internal_set_ack_status(from._internal_ack_status());
-  }
-}
-
-void Round3BCMessage::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-// @@protoc_insertion_point(generalized_copy_from_start:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round3BCMessage)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-void Round3BCMessage::CopyFrom(const Round3BCMessage& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:safeheron.proto.multi_party_ecdsa.Li24.key_refresh.Round3BCMessage)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool Round3BCMessage::IsInitialized() const {
-  return true;
-}
-
-void Round3BCMessage::InternalSwap(Round3BCMessage* other) {
-  using std::swap;
-  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
-  swap(ack_status_, other->ack_status_);
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata Round3BCMessage::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata Round0P2PMessage::GetMetadata() const {
   return GetMetadataStatic();
 }
 
@@ -1665,17 +646,8 @@ PROTOBUF_NAMESPACE_OPEN
 template<> PROTOBUF_NOINLINE ::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round0BCMessage* Arena::CreateMaybeMessage< ::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round0BCMessage >(Arena* arena) {
   return Arena::CreateMessageInternal< ::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round0BCMessage >(arena);
 }
-template<> PROTOBUF_NOINLINE ::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round1BCMessage* Arena::CreateMaybeMessage< ::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round1BCMessage >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round1BCMessage >(arena);
-}
-template<> PROTOBUF_NOINLINE ::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round1P2PMessage* Arena::CreateMaybeMessage< ::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round1P2PMessage >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round1P2PMessage >(arena);
-}
-template<> PROTOBUF_NOINLINE ::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round2P2PMessage* Arena::CreateMaybeMessage< ::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round2P2PMessage >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round2P2PMessage >(arena);
-}
-template<> PROTOBUF_NOINLINE ::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round3BCMessage* Arena::CreateMaybeMessage< ::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round3BCMessage >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round3BCMessage >(arena);
+template<> PROTOBUF_NOINLINE ::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round0P2PMessage* Arena::CreateMaybeMessage< ::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round0P2PMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round0P2PMessage >(arena);
 }
 PROTOBUF_NAMESPACE_CLOSE
 
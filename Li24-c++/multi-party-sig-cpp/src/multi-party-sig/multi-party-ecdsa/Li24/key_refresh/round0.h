@@ -5,15 +5,19 @@
 #include <string>
 #include <vector>
 #include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_context.h"
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/message_type.h"
 
 namespace safeheron {
 namespace multi_party_ecdsa{
 namespace Li24{
 namespace key_refresh {
 
-class Round0 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRound {
+
+class Context;
+
+class Round0 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRoundT<Context> {
 public:
-    Round0(): MPCRound(safeheron::mpc_flow::mpc_parallel_v2::MessageType::None, safeheron::mpc_flow::mpc_parallel_v2::MessageType::BROADCAST){}
+    Round0(): MPCRoundT(safeheron::mpc_flow::mpc_parallel_v2::MessageType::None, safeheron::mpc_flow::mpc_parallel_v2::MessageType::P2P_BROADCAST){}
 
     bool ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) override { return true; }
 
@@ -25,7 +29,6 @@ public:
                      std::vector<std::string> &out_des_arr) const override;
 };
 
-
 }
 }
 }
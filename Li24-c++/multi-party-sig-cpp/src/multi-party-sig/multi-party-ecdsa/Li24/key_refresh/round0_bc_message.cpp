@@ -1,13 +1,9 @@
 #include <google/protobuf/util/json_util.h>
 #include "crypto-suites/crypto-encode/base64.h"
-#include "crypto-suites/crypto-encode/hex.h"
 #include "multi-party-sig/multi-party-ecdsa/Li24/key_refresh/message.h"
 
 using std::string;
 using safeheron::bignum::BN;
-using safeheron::curve::Curve;
-using safeheron::curve::CurveType;
-using safeheron::curve::CurvePoint;
 using google::protobuf::util::Status;
 using google::protobuf::util::MessageToJsonString;
 using google::protobuf::util::JsonStringToMessage;
@@ -21,22 +17,24 @@ namespace Li24{
 namespace key_refresh {
 
 
-
 bool Round0BCMessage::ToProtoObject(safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round0BCMessage &message) const {
     bool ok = true;
 
-    string str;
-    str = safeheron::encode::hex::EncodeToHex(V_);
-    message.set_v(str);
-
+    for(size_t i = 0; i < vs_.size(); ++i){
+        safeheron::proto::CurvePoint * point_ptr = message.mutable_vs()->Add();
+        ok = vs_[i].ToProtoObject(*point_ptr);
+        if (!ok) return false;
+    }
     return true;
 }
 
 bool Round0BCMessage::FromProtoObject(const safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round0BCMessage &message) {
-    bool ok = true;
-
-    V_ = safeheron::encode::hex::DecodeFromHex(message.v());
-
+    for(int i = 0; i < message.vs_size(); ++i){
+        safeheron::curve::CurvePoint point;
+        bool ok = point.FromProtoObject(message.vs(i));
+        if (!ok) return false;
+        vs_.push_back(point);
+    }
     return true;
 }
 
@@ -16,28 +16,32 @@ namespace safeheron {
 namespace multi_party_ecdsa{
 namespace Li24{
 namespace key_refresh {
-
-bool Round1P2PMessage::ToProtoObject(safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round1P2PMessage &message) const {
+bool Round0P2PMessage::ToProtoObject(safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round0P2PMessage &message) const {
     bool ok = true;
 
-    string str;
-    x_ij_.ToHexStr(str);
-    message.set_x_ij(str);
+    ok = EncodeBN(x_ij_, wire_version_, message.mutable_x_ij(), message.mutable_x_ij_bin());
+    if (!ok) return false;
+
+    ok = EncodeBN(e_ij_, wire_version_, message.mutable_e_ij(), message.mutable_e_ij_bin());
+    if (!ok) return false;
 
     return true;
 }
 
-bool Round1P2PMessage::FromProtoObject(const safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round1P2PMessage &message) {
+bool Round0P2PMessage::FromProtoObject(const safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round0P2PMessage &message) {
     bool ok = true;
 
-    x_ij_ = BN::FromHexStr(message.x_ij());
+    x_ij_ = DecodeBN(message.x_ij(), message.x_ij_bin());
+    if (x_ij_ == 0) return false;
+    e_ij_ = DecodeBN(message.e_ij(), message.e_ij_bin());
+    if (e_ij_ == 0) return false;
 
     return true;
 }
 
 
-typedef Round1P2PMessage TheClass;
-typedef safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round1P2PMessage ProtoObject;
+typedef Round0P2PMessage TheClass;
+typedef safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round0P2PMessage ProtoObject;
 
 bool TheClass::ToBase64(string &b64) const {
     bool ok = true;
@@ -78,6 +82,7 @@ bool TheClass::ToJsonString(string &json_str) const {
     return true;
 }
 
+
 bool TheClass::FromJsonString(const string &json_str) {
     ProtoObject proto_object;
     google::protobuf::util::JsonParseOptions jp_option;
@@ -91,4 +96,4 @@ bool TheClass::FromJsonString(const string &json_str) {
 }
 }
 }
-}
+}
\ No newline at end of file
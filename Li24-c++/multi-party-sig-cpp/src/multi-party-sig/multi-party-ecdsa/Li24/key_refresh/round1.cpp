@@ -1,13 +1,15 @@
-#include <cstdio>
-#include "crypto-suites/crypto-commitment/commitment.h"
-#include "multi-party-sig/multi-party-ecdsa/Li24/key_refresh/round1.h"
+#include "crypto-suites/crypto-sss/vsss.h"
+#include "crypto-suites/crypto-hash/sha256.h"
+#include "multi-party-sig/multi-party-ecdsa/common/vss_batch_verifier.h"
 #include "multi-party-sig/multi-party-ecdsa/Li24/key_refresh/context.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/key_refresh/round1.h"
 
 using std::string;
+using std::vector;
 using safeheron::bignum::BN;
+using safeheron::hash::CSHA256;
 using safeheron::curve::Curve;
 using safeheron::curve::CurvePoint;
-using safeheron::curve::CurveType;
 using safeheron::multi_party_ecdsa::Li24::SignKey;
 
 namespace safeheron {
@@ -15,16 +17,32 @@ namespace multi_party_ecdsa{
 namespace Li24{
 namespace key_refresh {
 
+// New seed = SHA256(old seed || contribution of the lower share index || contribution of the higher share index).
+// Both parties of the pair compute the same value, and neither of them can choose it.
+static BN DerivePairSeed(const BN &old_seed, const BN &low_contribution, const BN &high_contribution) {
+    uint8_t buf[32];
+    CSHA256 sha256;
+    old_seed.ToBytes32BE(buf);
+    sha256.Write(buf, sizeof buf);
+    low_contribution.ToBytes32BE(buf);
+    sha256.Write(buf, sizeof buf);
+    high_contribution.ToBytes32BE(buf);
+    sha256.Write(buf, sizeof buf);
+    uint8_t digest[CSHA256::OUTPUT_SIZE];
+    sha256.Finalize(digest);
+    return BN::FromBytesBE(digest, sizeof digest);
+}
 
 void Round1::Init() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     for (int i = 0; i < ctx->get_total_parties() - 1; ++i) {
         bc_message_arr_.emplace_back();
+        p2p_message_arr_.emplace_back();
     }
 }
 
 bool Round1::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     SignKey &sign_key = ctx->sign_key_;
 
     int pos = sign_key.get_remote_party_pos(party_id);
@@ -33,17 +51,23 @@ bool Round1::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
         return false;
     }
 
-    bool ok = bc_message_arr_[pos].FromBase64(bc_msg);
+    bool ok = ctx->DecodeMessage(bc_msg, bc_message_arr_[pos]);
     if (!ok) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to deserialize bc_message from base64!");
         return false;
     }
 
+    ok = ctx->DecodeMessage(p2p_msg, p2p_message_arr_[pos]);
+    if (!ok) {
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to deserialize from base64(p2p)!");
+        return false;
+    }
+
     return true;
 }
 
 bool Round1::ReceiveVerify(const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     SignKey &sign_key = ctx->sign_key_;
 
     int pos = sign_key.get_remote_party_pos(party_id);
@@ -52,73 +76,80 @@ bool Round1::ReceiveVerify(const std::string &party_id) {
         return false;
     }
 
-    ctx->remote_parties_[pos].V_ = bc_message_arr_[pos].V_;
+    if (bc_message_arr_[pos].vs_.size() != sign_key.threshold_) {
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid size of the commitment!");
+        return false;
+    }
 
-    return true;
-}
+    ctx->remote_parties_[pos].W_ = bc_message_arr_[pos].vs_[0];
 
-bool Round1::ComputeVerify() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
-    SignKey &sign_key = ctx->sign_key_;
-    // DLN Proof
-    ctx->local_party_.dln_proof_1_.Prove(sign_key.local_party_.N_tilde_,
-                                        sign_key.local_party_.h1_,
-                                        sign_key.local_party_.h2_,
-                                        sign_key.local_party_.p_,
-                                        sign_key.local_party_.q_,
-                                        sign_key.local_party_.alpha_);
-    ctx->local_party_.dln_proof_2_.Prove(sign_key.local_party_.N_tilde_,
-                                        sign_key.local_party_.h2_,
-                                        sign_key.local_party_.h1_,
-                                        sign_key.local_party_.p_,
-                                        sign_key.local_party_.q_,
-                                        sign_key.local_party_.beta_);
     return true;
 }
 
-bool Round1::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
-                         std::vector<std::string> &out_des_arr) const {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+bool Round1::ComputeVerify() {
+    Context *ctx = this->get_context();
     SignKey &sign_key = ctx->sign_key_;
+    const Curve *curv = GetCurveParam(sign_key.X_.GetCurveType());
 
-    out_p2p_msg_arr.clear();
-    out_bc_msg.clear();
-    out_des_arr.clear();
+    // Check the shares of all the peers with one multi-scalar multiplication
+    safeheron::multi_party_ecdsa::common::VssBatchVerifier vss_verifier(sign_key.X_.GetCurveType(), (int)sign_key.threshold_, sign_key.local_party_.index_);
+    for (size_t i = 0; i < bc_message_arr_.size(); ++i) {
+        vss_verifier.Add(bc_message_arr_[i].vs_, p2p_message_arr_[i].x_ij_);
+    }
+    std::vector<size_t> failed_arr;
+    if (!vss_verifier.Verify(failed_arr)) {
+        for (size_t pos : failed_arr) {
+            ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed in VerifyShare for party " + sign_key.remote_parties_[pos].party_id_ + "!");
+        }
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to verify the shares!");
+        return false;
+    }
 
+    // The reshared secrets must still add up to the private key
+    CurvePoint pub = ctx->local_party_.vs_[0];
     for (size_t i = 0; i < ctx->remote_parties_.size(); ++i) {
-        out_des_arr.push_back(sign_key.remote_parties_[i].party_id_);
+        pub += ctx->remote_parties_[i].W_;
+    }
+    if (pub != sign_key.X_) {
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "The new shares do not match the public key!");
+        return false;
     }
 
-    for (size_t i = 0; i < ctx->remote_parties_.size(); ++i) {
-        Round1P2PMessage message;
-        message.x_ij_ = ctx->remote_parties_[i].x_ij_;
-        string base64;
-        bool ok = message.ToBase64(base64);
-        if (!ok) {
-            ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to encode to base64!");
-            return false;
+    // Compute the new share, the last point belongs to the local party
+    BN x = ctx->local_party_.share_points_[ctx->local_party_.share_points_.size() - 1].y;
+    for (size_t i = 0; i < p2p_message_arr_.size(); ++i) {
+        x = (x + p2p_message_arr_[i].x_ij_) % curv->n;
+    }
+    sign_key.local_party_.x_ = x;
+    sign_key.local_party_.g_x_ = curv->g * x;
+
+    // New prg seeds, the prgs restart from position 0
+    sign_key.local_party_.seed_ = ctx->local_party_.seed_;
+    for (size_t i = 0; i < sign_key.remote_parties_.size(); ++i) {
+        RemoteParty &remote_party = sign_key.remote_parties_[i];
+        const BN &local_contribution = ctx->local_party_.seed_[i];
+        const BN &remote_contribution = p2p_message_arr_[i].e_ij_;
+        if (sign_key.local_party_.index_ < remote_party.index_) {
+            remote_party.seed_ = DerivePairSeed(remote_party.seed_, local_contribution, remote_contribution);
+        } else {
+            remote_party.seed_ = DerivePairSeed(remote_party.seed_, remote_contribution, local_contribution);
         }
-        out_p2p_msg_arr.push_back(base64);
+        remote_party.prg.reset();
+        remote_party.prg.init(remote_party.seed_);
     }
 
-    Round1BCMessage message;
-    message.vs_ = ctx->local_party_.vs_;
-    message.N_tilde_ = sign_key.local_party_.N_tilde_;
-    message.h1_ = sign_key.local_party_.h1_;
-    message.h2_ = sign_key.local_party_.h2_;
-    message.dln_proof_1_ = ctx->local_party_.dln_proof_1_;
-    message.dln_proof_2_ = ctx->local_party_.dln_proof_2_;
-    message.pail_pub_ = sign_key.local_party_.pail_pub_;
-    message.blind_factor_ = ctx->local_party_.blind_factor_;
-    bool ok = message.ToBase64(out_bc_msg);
-    if (!ok) {
-        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to encode to base64!");
+    if (!sign_key.ValidityTest()) {
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed in sign_key.ValidityTest()!");
         return false;
     }
 
     return true;
 }
 
+bool Round1::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
+                         std::vector<std::string> &out_des_arr) const {
+    return true;
+}
 
 }
 }
@@ -12,12 +12,16 @@ namespace multi_party_ecdsa{
 namespace Li24{
 namespace key_refresh {
 
-class Round1 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRound {
+
+class Context;
+
+class Round1 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRoundT<Context> {
 public:
     std::vector<Round0BCMessage> bc_message_arr_;
+    std::vector<Round0P2PMessage> p2p_message_arr_;
 
 public:
-    Round1(): MPCRound(safeheron::mpc_flow::mpc_parallel_v2::MessageType::BROADCAST, safeheron::mpc_flow::mpc_parallel_v2::MessageType::P2P_BROADCAST){}
+    Round1(): MPCRoundT(safeheron::mpc_flow::mpc_parallel_v2::MessageType::P2P_BROADCAST, safeheron::mpc_flow::mpc_parallel_v2::MessageType::None){}
 
     void Init() override;
 
@@ -32,7 +36,6 @@ public:
 
 };
 
-
 }
 }
 }
@@ -1,83 +0,0 @@
-#include "crypto-suites/crypto-commitment/commitment.h"
-#include "crypto-suites/crypto-curve/curve.h"
-#include "multi-party-sig/multi-party-ecdsa/Li24/key_refresh/round4.h"
-#include "multi-party-sig/multi-party-ecdsa/Li24/key_refresh/context.h"
-
-using std::string;
-using safeheron::bignum::BN;
-using safeheron::curve::CurveType;
-using safeheron::curve::CurvePoint;
-using safeheron::curve::Curve;
-using safeheron::sss::Polynomial;
-using safeheron::multi_party_ecdsa::Li24::SignKey;
-
-static BN POW2_256 = BN(1) << 256;
-
-namespace safeheron {
-namespace multi_party_ecdsa{
-namespace Li24{
-namespace key_refresh {
-
-
-void Round4::Init() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
-    for (int i = 0; i < ctx->get_total_parties() - 1; ++i) {
-        bc_message_arr_.emplace_back();
-    }
-}
-
-bool Round4::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
-    SignKey &sign_key = ctx->sign_key_;
-
-    int pos = sign_key.get_remote_party_pos(party_id);
-    if (pos == -1) {
-        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
-        return false;
-    }
-
-    bool ok = bc_message_arr_[pos].FromBase64(bc_msg);
-    if (!ok) {
-        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to deserialize from base64!");
-        return false;
-    }
-
-    return true;
-}
-
-bool Round4::ReceiveVerify(const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
-    SignKey &sign_key = ctx->sign_key_;
-
-    int pos = sign_key.get_remote_party_pos(party_id);
-    if (pos == -1) {
-        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
-        return false;
-    }
-
-    bool ok = bc_message_arr_[pos].ack_status_ == 1;
-    if (!ok) {
-        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, string("Ack 0"));
-        return false;
-    }
-
-    ctx->remote_parties_[pos].ack_status_ = bc_message_arr_[pos].ack_status_;
-
-    return true;
-}
-
-bool Round4::ComputeVerify() {
-    return true;
-}
-
-bool Round4::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
-                         std::vector<std::string> &out_des_arr) const {
-    // For final round, do nothing.
-    return true;
-}
-
-
-}
-}
-}
-}
@@ -6,9 +6,7 @@
 
 #include "crypto-suites/crypto-sss/vsss.h"
 #include "crypto-suites/crypto-bn/bn.h"
-#include "crypto-suites/crypto-paillier/pail.h"
 #include "crypto-suites/crypto-curve/curve.h"
-#include "crypto-suites/crypto-zkp/zkp.h"
 #include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_context.h"
 #include "multi-party-sig/multi-party-ecdsa/Li24/key_refresh/proto_gen/key_refresh.pb.switch.h"
 
@@ -19,41 +17,26 @@ namespace Li24{
 namespace key_refresh {
 
 
-
 class LocalTParty {
 public:
-    safeheron::bignum::BN x_ij_;
-    safeheron::bignum::BN new_x_;
-    safeheron::curve::CurvePoint new_X_;
-    std::string blind_factor_;
-    std::string V_;
-
-    // Paillier proof
-    zkp::pail::PailBlumModulusProof pail_proof_;
-    // DLN Proof
-    zkp::dln_proof::DLNProof dln_proof_1_;
-    zkp::dln_proof::DLNProof dln_proof_2_;
-    // Dlog Proof
-    safeheron::zkp::dlog::DLogProof dlog_proof_x_;
+    // Lagrange coefficients at 0 over all the parties, the local party is the last one
     std::vector<safeheron::bignum::BN> l_arr_;
 
-    // Random numbers for commitment, polynomial coefficients
-    safeheron::bignum::BN rand_num_for_schnorr_proof_;
-    std::vector<safeheron::bignum::BN> rand_num_arr_for_polynomial_coe_;
-
-    // Chain code share
+    // Shares of w = x * lambda, and the commitment of the polynomial
     std::vector<safeheron::sss::Point> share_points_;
     std::vector<safeheron::curve::CurvePoint> vs_;
-    int ack_status_;
+
+    // Random numbers for polynomial coefficients
+    std::vector<safeheron::bignum::BN> rand_polynomial_coe_arr_;
+
+    // Local contribution to the new PRG seed shared with each remote party
+    std::vector<safeheron::bignum::BN> seed_;
 };
 
 class RemoteTParty {
 public:
-    std::string V_;
-    safeheron::bignum::BN x_ij_;
-    // No small factor proof
-    safeheron::zkp::no_small_factor_proof::NoSmallFactorProof nsf_proof_;
-    int ack_status_;
+    // Commitment of w_j = x_j * lambda_j
+    safeheron::curve::CurvePoint W_;
 };
 
 }
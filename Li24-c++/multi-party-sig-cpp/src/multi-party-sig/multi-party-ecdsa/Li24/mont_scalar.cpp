@@ -0,0 +1,260 @@
+#include "multi-party-sig/multi-party-ecdsa/Li24/mont_scalar.h"
+#include <cstring>
+
+using safeheron::bignum::BN;
+using safeheron::curve::CurveType;
+
+namespace safeheron {
+namespace multi_party_ecdsa{
+namespace Li24{
+
+namespace {
+
+// hi:lo = a * b + c + d, which cannot overflow 128 bits
+inline uint64_t MulAdd(uint64_t a, uint64_t b, uint64_t c, uint64_t d, uint64_t &hi) {
+#if defined(__SIZEOF_INT128__)
+    unsigned __int128 t = (unsigned __int128)a * b + c + d;
+    hi = (uint64_t)(t >> 64);
+    return (uint64_t)t;
+#else
+    uint64_t a_lo = a & 0xFFFFFFFF, a_hi = a >> 32;
+    uint64_t b_lo = b & 0xFFFFFFFF, b_hi = b >> 32;
+    uint64_t p0 = a_lo * b_lo, p1 = a_lo * b_hi, p2 = a_hi * b_lo, p3 = a_hi * b_hi;
+    uint64_t mid = (p0 >> 32) + (p1 & 0xFFFFFFFF) + (p2 & 0xFFFFFFFF);
+    uint64_t lo = (p0 & 0xFFFFFFFF) | (mid << 32);
+    hi = p3 + (p1 >> 32) + (p2 >> 32) + (mid >> 32);
+    lo += c;
+    hi += lo < c;
+    lo += d;
+    hi += lo < d;
+    return lo;
+#endif
+}
+
+// out = a + b, returns the carry
+inline uint64_t Add4(const uint64_t a[4], const uint64_t b[4], uint64_t out[4]) {
+    uint64_t carry = 0;
+    for (int i = 0; i < 4; ++i) {
+        uint64_t s = a[i] + carry;
+        carry = s < carry;
+        out[i] = s + b[i];
+        carry |= out[i] < s;
+    }
+    return carry;
+}
+
+// out = a - b, returns the borrow
+inline uint64_t Sub4(const uint64_t a[4], const uint64_t b[4], uint64_t out[4]) {
+    uint64_t borrow = 0;
+    for (int i = 0; i < 4; ++i) {
+        uint64_t d = a[i] - borrow;
+        borrow = d > a[i];
+        out[i] = d - b[i];
+        borrow |= out[i] > d;
+    }
+    return borrow;
+}
+
+// out = mask ? a : b, mask being all ones or zero
+inline void Select4(uint64_t mask, const uint64_t a[4], const uint64_t b[4], uint64_t out[4]) {
+    for (int i = 0; i < 4; ++i) out[i] = (a[i] & mask) | (b[i] & ~mask);
+}
+
+bool IsOne(const uint64_t a[4]) {
+    return a[0] == 1 && (a[1] | a[2] | a[3]) == 0;
+}
+
+// a = (a | top << 256) / 2
+void Shr1(uint64_t a[4], uint64_t top) {
+    for (int i = 0; i < 3; ++i) a[i] = (a[i] >> 1) | (a[i + 1] << 63);
+    a[3] = (a[3] >> 1) | (top << 63);
+}
+
+// a = a / 2 mod n, n odd
+void HalfMod(uint64_t a[4], const uint64_t n[4]) {
+    uint64_t top = 0;
+    if (a[0] & 1) top = Add4(a, n, a);
+    Shr1(a, top);
+}
+
+// a = a - b mod n
+void SubMod(uint64_t a[4], const uint64_t b[4], const uint64_t n[4]) {
+    if (Sub4(a, b, a)) Add4(a, n, a);
+}
+
+void LimbsFromBytes32BE(const uint8_t buf[32], uint64_t out[4]) {
+    for (int i = 0; i < 4; ++i) {
+        uint64_t limb = 0;
+        for (int k = 0; k < 8; ++k) limb = (limb << 8) | buf[(3 - i) * 8 + k];
+        out[i] = limb;
+    }
+}
+
+void LimbsToBytes32BE(const uint64_t limb[4], uint8_t buf[32]) {
+    for (int i = 0; i < 4; ++i) {
+        for (int k = 0; k < 8; ++k) buf[(3 - i) * 8 + k] = (uint8_t)(limb[i] >> (56 - 8 * k));
+    }
+}
+
+void LimbsFromBN(const BN &value, uint64_t out[4]) {
+    uint8_t buf[32];
+    value.ToBytes32BE(buf);
+    LimbsFromBytes32BE(buf, out);
+}
+
+}
+
+const MontField *MontField::Get(CurveType curve_type) {
+    switch (curve_type) {
+        case CurveType::SECP256K1: {
+            static const MontField field(safeheron::curve::GetCurveParam(CurveType::SECP256K1)->n);
+            return &field;
+        }
+        case CurveType::P256: {
+            static const MontField field(safeheron::curve::GetCurveParam(CurveType::P256)->n);
+            return &field;
+        }
+        default:
+            return nullptr;
+    }
+}
+
+MontField::MontField(const BN &n): order_(n) {
+    LimbsFromBN(n, n_);
+    // n^-1 mod 2^64 by Newton's iteration, each step doubles the number of correct bits
+    uint64_t inv = 1;
+    for (int i = 0; i < 6; ++i) inv *= 2 - n_[0] * inv;
+    n0_inv_ = 0 - inv;
+    LimbsFromBN((BN(1) << 512) % n, r2_);
+    LimbsFromBN((BN(1) << 768) % n, r3_);
+}
+
+MontScalar MontField::FromBN(const BN &value) const {
+    MontScalar out(this);
+    uint64_t plain[4];
+    if (value.IsNeg() || value.BitLength() > 256) {
+        BN reduced = value % order_;
+        if (reduced.IsNeg()) reduced += order_;
+        LimbsFromBN(reduced, plain);
+    } else {
+        LimbsFromBN(value, plain);
+        // Below 2^256 < 2n, a single subtraction is enough
+        uint64_t reduced[4];
+        uint64_t borrow = Sub4(plain, n_, reduced);
+        Select4(0 - (borrow ^ 1), reduced, plain, plain);
+    }
+    MontScalar::MontMul(this, plain, r2_, out.limb_);
+    return out;
+}
+
+MontScalar MontField::Zero() const {
+    return MontScalar(this);
+}
+
+void MontScalar::MontMul(const MontField *field, const uint64_t a[4], const uint64_t b[4], uint64_t out[4]) {
+    // Coarsely integrated operand scanning: t = (t + a * b[i] + m * n) / 2^64, four times
+    const uint64_t *n = field->n_;
+    uint64_t t[6] = {0, 0, 0, 0, 0, 0};
+    for (int i = 0; i < 4; ++i) {
+        uint64_t carry = 0;
+        for (int j = 0; j < 4; ++j) {
+            t[j] = MulAdd(a[j], b[i], t[j], carry, carry);
+        }
+        t[4] += carry;
+        t[5] = t[4] < carry;
+
+        uint64_t m = t[0] * field->n0_inv_;
+        MulAdd(m, n[0], t[0], 0, carry);
+        for (int j = 1; j < 4; ++j) {
+            t[j - 1] = MulAdd(m, n[j], t[j], carry, carry);
+        }
+        t[3] = t[4] + carry;
+        t[4] = t[5] + (t[3] < carry);
+    }
+    // t < 2n
+    uint64_t reduced[4];
+    uint64_t borrow = Sub4(t, n, reduced);
+    Select4(0 - (t[4] | (borrow ^ 1)), reduced, t, out);
+}
+
+MontScalar MontScalar::operator+(const MontScalar &other) const {
+    MontScalar out(field_);
+    uint64_t sum[4];
+    uint64_t reduced[4];
+    uint64_t carry = Add4(limb_, other.limb_, sum);
+    uint64_t borrow = Sub4(sum, field_->n_, reduced);
+    Select4(0 - (carry | (borrow ^ 1)), reduced, sum, out.limb_);
+    return out;
+}
+
+MontScalar MontScalar::operator-(const MontScalar &other) const {
+    MontScalar out(field_);
+    uint64_t diff[4];
+    uint64_t n_masked[4];
+    uint64_t borrow = Sub4(limb_, other.limb_, diff);
+    for (int i = 0; i < 4; ++i) n_masked[i] = field_->n_[i] & (0 - borrow);
+    Add4(diff, n_masked, out.limb_);
+    return out;
+}
+
+MontScalar MontScalar::operator*(const MontScalar &other) const {
+    MontScalar out(field_);
+    MontMul(field_, limb_, other.limb_, out.limb_);
+    return out;
+}
+
+bool MontScalar::operator==(const MontScalar &other) const {
+    uint64_t diff = 0;
+    for (int i = 0; i < 4; ++i) diff |= limb_[i] ^ other.limb_[i];
+    return field_ == other.field_ && diff == 0;
+}
+
+bool MontScalar::IsZero() const {
+    return (limb_[0] | limb_[1] | limb_[2] | limb_[3]) == 0;
+}
+
+MontScalar MontScalar::Inv() const {
+    MontScalar out(field_);
+    if (IsZero()) return out;
+
+    // Invariants: x1 * a = u and x2 * a = v mod n, with a = this * 2^256 the stored value
+    const uint64_t *n = field_->n_;
+    uint64_t u[4] = {limb_[0], limb_[1], limb_[2], limb_[3]};
+    uint64_t v[4] = {n[0], n[1], n[2], n[3]};
+    uint64_t x1[4] = {1, 0, 0, 0};
+    uint64_t x2[4] = {0, 0, 0, 0};
+    while (!IsOne(u) && !IsOne(v)) {
+        while ((u[0] & 1) == 0) {
+            Shr1(u, 0);
+            HalfMod(x1, n);
+        }
+        while ((v[0] & 1) == 0) {
+            Shr1(v, 0);
+            HalfMod(x2, n);
+        }
+        uint64_t diff[4];
+        if (Sub4(u, v, diff) == 0) {
+            memcpy(u, diff, sizeof(u));
+            SubMod(x1, x2, n);
+        } else {
+            Sub4(v, u, v);
+            SubMod(x2, x1, n);
+        }
+    }
+    // (this * 2^256)^-1 * 2^768 / 2^256 = this^-1 * 2^256
+    MontMul(field_, IsOne(u) ? x1 : x2, field_->r3_, out.limb_);
+    return out;
+}
+
+BN MontScalar::ToBN() const {
+    const uint64_t one[4] = {1, 0, 0, 0};
+    uint64_t plain[4];
+    uint8_t buf[32];
+    MontMul(field_, limb_, one, plain);
+    LimbsToBytes32BE(plain, buf);
+    return BN::FromBytesBE(buf, 32);
+}
+
+}
+}
+}
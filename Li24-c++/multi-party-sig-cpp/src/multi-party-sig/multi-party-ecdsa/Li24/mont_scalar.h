@@ -0,0 +1,100 @@
+#ifndef SAFEHERON_MULTI_PARTY_ECDSA_Li24_MONT_SCALAR_H
+#define SAFEHERON_MULTI_PARTY_ECDSA_Li24_MONT_SCALAR_H
+
+#include <cstdint>
+#include "crypto-suites/crypto-bn/bn.h"
+#include "crypto-suites/crypto-curve/curve.h"
+
+namespace safeheron {
+namespace multi_party_ecdsa{
+namespace Li24{
+
+class MontScalar;
+
+/**
+ * Arithmetic modulo the order n of a curve on 4 x 64-bit limbs, in the Montgomery form a * 2^256 mod n.
+ * Only secp256k1 and P256 are set up, the other curves keep using BN.
+ */
+class MontField {
+public:
+    /**
+     * @return the field of the order of the curve, nullptr if the curve is not supported.
+     */
+    static const MontField *Get(safeheron::curve::CurveType curve_type);
+
+    /**
+     * Reduce the value modulo n, negative values included, and convert it.
+     */
+    MontScalar FromBN(const safeheron::bignum::BN &value) const;
+
+    MontScalar Zero() const;
+
+private:
+    explicit MontField(const safeheron::bignum::BN &n);
+
+private:
+    safeheron::bignum::BN order_;
+    uint64_t n_[4];
+    // -n^-1 mod 2^64
+    uint64_t n0_inv_;
+    // 2^512 mod n, to convert into the Montgomery form
+    uint64_t r2_[4];
+    // 2^768 mod n, to bring an inverse back into the Montgomery form
+    uint64_t r3_[4];
+
+    friend class MontScalar;
+};
+
+/**
+ * Element of a MontField, stored by value: no allocation and no reduction by division after a product.
+ * The operations take the same time whatever the values, except Inv().
+ */
+class MontScalar {
+public:
+    MontScalar operator+(const MontScalar &other) const;
+
+    MontScalar operator-(const MontScalar &other) const;
+
+    MontScalar operator*(const MontScalar &other) const;
+
+    MontScalar &operator+=(const MontScalar &other) { return *this = *this + other; }
+
+    MontScalar &operator-=(const MontScalar &other) { return *this = *this - other; }
+
+    MontScalar &operator*=(const MontScalar &other) { return *this = *this * other; }
+
+    bool operator==(const MontScalar &other) const;
+
+    bool operator!=(const MontScalar &other) const { return !(*this == other); }
+
+    /**
+     * Inverse modulo n by the binary extended Euclidean algorithm, 0 for 0. Its time depends on the value, so only
+     * use it on public values.
+     */
+    MontScalar Inv() const;
+
+    bool IsZero() const;
+
+    /**
+     * @return the value in [0, n).
+     */
+    safeheron::bignum::BN ToBN() const;
+
+private:
+    MontScalar(const MontField *field): field_(field), limb_{0, 0, 0, 0} {}
+
+    static void MontMul(const MontField *field, const uint64_t a[4], const uint64_t b[4], uint64_t out[4]);
+
+private:
+    const MontField *field_;
+    // Little endian limbs of the Montgomery form, always < n
+    uint64_t limb_[4];
+
+    friend class MontField;
+};
+
+}
+}
+}
+
+#endif //SAFEHERON_MULTI_PARTY_ECDSA_Li24_MONT_SCALAR_H
@@ -0,0 +1,110 @@
+#include "multi-party-sig/multi-party-ecdsa/Li24/online_sign/context.h"
+
+using safeheron::bignum::BN;
+using safeheron::multi_party_ecdsa::Li24::SignKey;
+using safeheron::multi_party_ecdsa::Li24::SignKeyHandle;
+
+namespace safeheron {
+namespace multi_party_ecdsa{
+namespace Li24{
+namespace online_sign{
+
+Context::Context(int total_parties): MPCContext(total_parties), v_(0){
+    BindAllRounds();
+}
+
+Context::Context(const Context &ctx): MPCContext(ctx){
+    // Assign all the member variables.
+    sign_key_ = ctx.sign_key_;
+    presig_ = ctx.presig_;
+    m_ = ctx.m_;
+
+    round0_ = ctx.round0_;
+    round1_ = ctx.round1_;
+
+    delta_ = ctx.delta_;
+
+    r_ = ctx.r_;
+    s_ = ctx.s_;
+    v_ = ctx.v_;
+    // End Assignments.
+
+    BindAllRounds();
+}
+
+Context &Context::operator=(const Context &ctx){
+    if (this == &ctx) {
+        return *this;
+    }
+
+    MPCContext::operator=(ctx);
+
+    // Assign all the member variables.
+    sign_key_ = ctx.sign_key_;
+    presig_ = ctx.presig_;
+    m_ = ctx.m_;
+
+    round0_ = ctx.round0_;
+    round1_ = ctx.round1_;
+
+    delta_ = ctx.delta_;
+
+    r_ = ctx.r_;
+    s_ = ctx.s_;
+    v_ = ctx.v_;
+    // End Assignments.
+
+    BindAllRounds();
+
+    return *this;
+}
+
+bool Context::CreateContext(Context &ctx, const std::string &sign_key_base64,
+                            presign::PresignaturePool &presig_pool, const safeheron::bignum::BN &m) {
+    bool ok = true;
+    ctx.m_ = m;
+
+    ok = ctx.sign_key_.FromBase64(sign_key_base64);
+    if (!ok) return false;
+    ok = ((int)ctx.sign_key_.n_parties_ == ctx.get_total_parties());
+    if (!ok) return false;
+
+    // Last step, so that a context which can not be created does not burn a presignature
+    ok = presig_pool.TakeFront(ctx.presig_);
+    if (!ok) return false;
+
+    return true;
+}
+
+bool Context::CreateContext(Context &ctx, const SignKeyHandle &sign_key_handle,
+                            const std::vector<std::string> &participant_id_arr, presign::PresignaturePool &presig_pool,
+                            const safeheron::bignum::BN &m) {
+    bool ok = true;
+    ctx.m_ = m;
+
+    // The presignature is blinded already, no PRG output is drawn
+    ok = sign_key_handle.Trim(ctx.sign_key_, participant_id_arr, 0);
+    if (!ok) return false;
+    ok = ((int)ctx.sign_key_.n_parties_ == ctx.get_total_parties());
+    if (!ok) return false;
+
+    ok = presig_pool.TakeFront(ctx.presig_);
+    if (!ok) return false;
+
+    return true;
+}
+
+bool Context::IsRemoteParty(const std::string &party_id) const {
+    return sign_key_.get_remote_party_pos(party_id) != -1;
+}
+
+void Context::BindAllRounds() {
+    RemoveAllRounds();
+    AddRound(&round0_);
+    AddRound(&round1_);
+}
+
+}
+}
+}
+}
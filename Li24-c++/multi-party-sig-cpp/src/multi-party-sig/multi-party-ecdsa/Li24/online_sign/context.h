@@ -0,0 +1,82 @@
+#ifndef SAFEHERON_MULTI_PARTY_ECDSA_Li24_ONLINE_SIGN_CONTEXT_H
+#define SAFEHERON_MULTI_PARTY_ECDSA_Li24_ONLINE_SIGN_CONTEXT_H
+
+#include "crypto-suites/crypto-curve/curve.h"
+#include "crypto-suites/crypto-bn/bn.h"
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_context.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/sign_key.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/sign_key_handle.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/presign/presignature.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/online_sign/round0.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/online_sign/round1.h"
+
+
+namespace safeheron {
+namespace multi_party_ecdsa{
+namespace Li24{
+namespace online_sign{
+
+/**
+ * Signs a digest with a presignature from Li24::presign in one broadcast of delta_i.
+ *
+ * The context takes the oldest presignature out of the pool of the caller, so it is never used again, even if this
+ * signing fails. All the parties must fill their pools from the same presign runs and sign in the same order.
+ */
+class Context : public safeheron::mpc_flow::mpc_parallel_v2::MPCContext {
+public:
+    /**
+     * Default constructor
+     */
+    Context(int total_parties);
+
+    /**
+     * A copy constructor
+     */
+    Context(const Context &ctx);
+
+    /**
+     * A copy assignment operator
+     */
+    Context &operator=(const Context &ctx);
+
+public:
+    void BindAllRounds();
+
+    bool IsRemoteParty(const std::string &party_id) const override;
+
+    /**
+     * @param presig_pool pool the presignature is taken from, see PresignaturePool::TakeFront().
+     * @return false if the key is invalid or the pool is empty.
+     */
+    static bool CreateContext(Context &ctx, const std::string &sign_key_base64,
+                              presign::PresignaturePool &presig_pool, const safeheron::bignum::BN &m);
+
+    /**
+     * Same as above, but take the sign key from a handle, so that it is neither decoded nor trimmed from base64 again.
+     * @param participant_id_arr all the parties that take part in the signature.
+     */
+    static bool CreateContext(Context &ctx, const safeheron::multi_party_ecdsa::Li24::SignKeyHandle &sign_key_handle,
+                              const std::vector<std::string> &participant_id_arr, presign::PresignaturePool &presig_pool,
+                              const safeheron::bignum::BN &m);
+
+public:
+    safeheron::multi_party_ecdsa::Li24::SignKey sign_key_;
+    presign::Presignature presig_;
+    safeheron::bignum::BN m_;
+
+    Round0 round0_;
+    Round1 round1_;
+
+    safeheron::bignum::BN delta_;
+
+    safeheron::bignum::BN r_;
+    safeheron::bignum::BN s_;
+    uint32_t v_;
+};
+
+}
+}
+}
+}
+
+#endif //SAFEHERON_MULTI_PARTY_ECDSA_Li24_ONLINE_SIGN_CONTEXT_H
@@ -0,0 +1,39 @@
+#ifndef SAFEHERON_MULTI_PARTY_ECDSA_Li24_ONLINE_SIGN_MESSAGE_H
+#define SAFEHERON_MULTI_PARTY_ECDSA_Li24_ONLINE_SIGN_MESSAGE_H
+
+#include "crypto-suites/crypto-bn/bn.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/sign/proto_gen/sign.pb.switch.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/wire.h"
+namespace safeheron {
+namespace multi_party_ecdsa{
+namespace Li24{
+namespace online_sign{
+
+class Round0BCMessage {
+public:
+    // r of the presignature, all parties must sign with the same one
+    safeheron::bignum::BN r_;
+    safeheron::bignum::BN delta_;
+    WireVersion wire_version_ = WireVersion::Hex;
+
+public:
+    bool ToProtoObject(safeheron::proto::multi_party_ecdsa::Li24::sign::OnlineRound0BCMessage &message) const;
+
+    bool FromProtoObject(const safeheron::proto::multi_party_ecdsa::Li24::sign::OnlineRound0BCMessage &message);
+
+    bool ToBase64(std::string &b64) const;
+
+    bool FromBase64(const std::string &b64);
+
+    bool ToJsonString(std::string &json_str)const ;
+
+    bool FromJsonString(const std::string &json_str);
+};
+
+
+}
+}
+}
+}
+
+#endif //SAFEHERON_MULTI_PARTY_ECDSA_Li24_ONLINE_SIGN_MESSAGE_H
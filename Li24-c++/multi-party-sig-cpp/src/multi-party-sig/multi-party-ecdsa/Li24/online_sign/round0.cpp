@@ -0,0 +1,56 @@
+#include "crypto-suites/crypto-curve/curve.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/online_sign/round0.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/online_sign/context.h"
+
+using std::string;
+using safeheron::bignum::BN;
+using safeheron::curve::Curve;
+using safeheron::multi_party_ecdsa::Li24::SignKey;
+
+namespace safeheron {
+namespace multi_party_ecdsa{
+namespace Li24{
+namespace online_sign{
+
+bool Round0::ComputeVerify() {
+    Context *ctx = this->get_context();
+    const SignKey &sign_key = ctx->sign_key_;
+
+    const Curve * curv = GetCurveParam(sign_key.X_.GetCurveType());
+
+    // delta_i = m * phi_i + r * u_i
+    ctx->delta_ = (ctx->m_ * ctx->presig_.phi_ + ctx->presig_.r_ * ctx->presig_.u_) % curv->n;
+
+    return true;
+}
+
+bool Round0::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
+                         std::vector<std::string> &out_des_arr) const {
+    Context *ctx = this->get_context();
+    const SignKey &sign_key = ctx->sign_key_;
+    bool ok = true;
+    out_p2p_msg_arr.clear();
+    out_bc_msg.clear();
+    out_des_arr.clear();
+
+    for (size_t i = 0; i < sign_key.remote_parties_.size(); ++i) {
+        out_des_arr.push_back(sign_key.remote_parties_[i].party_id_);
+    }
+
+    Round0BCMessage bc_message;
+    bc_message.wire_version_ = sign_key.wire_version_;
+    bc_message.r_ = ctx->presig_.r_;
+    bc_message.delta_ = ctx->delta_;
+    ok = ctx->EncodeMessage(bc_message, out_bc_msg);
+    if (!ok) {
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed in ctx->EncodeMessage(bc_message, out_bc_msg)!");
+        return false;
+    }
+
+    return true;
+}
+
+}
+}
+}
+}
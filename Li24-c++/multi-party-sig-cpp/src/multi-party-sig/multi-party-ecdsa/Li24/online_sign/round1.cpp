@@ -0,0 +1,99 @@
+#include "crypto-suites/crypto-curve/curve.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/online_sign/round1.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/online_sign/context.h"
+
+using std::string;
+using safeheron::bignum::BN;
+using safeheron::curve::Curve;
+using safeheron::multi_party_ecdsa::Li24::SignKey;
+
+namespace safeheron {
+namespace multi_party_ecdsa{
+namespace Li24{
+namespace online_sign{
+
+void Round1::Init() {
+
+    Context *ctx = this->get_context();
+    for (int i = 0; i < ctx->get_total_parties() - 1; ++i) {
+        bc_message_arr_.emplace_back();
+    }
+
+}
+
+bool Round1::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
+
+    Context *ctx = this->get_context();
+    const SignKey &sign_key = ctx->sign_key_;
+
+    int pos = sign_key.get_remote_party_pos(party_id);
+    if (pos == -1) {
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
+        return false;
+    }
+
+    bool ok = ctx->DecodeMessage(bc_msg, bc_message_arr_[pos]);
+    if (!ok) {
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to deserialize the message!");
+        return false;
+    }
+
+    return true;
+}
+
+bool Round1::ReceiveVerify(const std::string &party_id) {
+    Context *ctx = this->get_context();
+    const SignKey &sign_key = ctx->sign_key_;
+
+    int pos = sign_key.get_remote_party_pos(party_id);
+    if (bc_message_arr_[pos].r_ != ctx->presig_.r_) {
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Presignature mismatch with " + party_id + "!");
+        return false;
+    }
+
+    return true;
+}
+
+bool Round1::ComputeVerify() {
+    bool ok = true;
+    Context *ctx = this->get_context();
+    const SignKey &sign_key = ctx->sign_key_;
+
+    const Curve * curv = GetCurveParam(sign_key.X_.GetCurveType());
+
+    BN delta = ctx->delta_;
+    for (size_t i = 0; i < bc_message_arr_.size(); ++i) {
+        delta = (delta + bc_message_arr_[i].delta_) % curv->n;
+    }
+    BN s = (delta * ctx->presig_.v_inv_) % curv->n;
+    // Recovery parameter
+    const safeheron::curve::CurvePoint &R = ctx->presig_.R_;
+    uint32_t recovery_param = (R.y().IsOdd() ? 1 : 0) |     // is_y_odd
+                              ((R.x() != ctx->presig_.r_) ? 2 : 0); // is_second_key
+    BN half_n = curv->n / 2;
+    if (s > half_n){
+        s = curv->n - s;
+        recovery_param ^= 1;
+    }
+    ctx->r_ = ctx->presig_.r_;
+    ctx->s_ = s;
+    ctx->v_ = recovery_param;
+    // Verify the signature
+    ok = safeheron::curve::ecdsa::VerifyPublicKey(sign_key.X_, sign_key.X_.GetCurveType(), ctx->m_, ctx->r_, ctx->s_, ctx->v_);
+    if (!ok) {
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to verify R,S,V with child public key!");
+        return false;
+    }
+
+    return true;
+}
+
+bool Round1::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
+                         std::vector<std::string> &out_des_arr) const {
+    return true;
+}
+
+}
+}
+}
+}
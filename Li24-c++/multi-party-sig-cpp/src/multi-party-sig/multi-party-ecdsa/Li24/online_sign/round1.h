@@ -1,23 +1,26 @@
 
-#ifndef SAFEHERON_MULTI_PARTY_ECDSA_Li24_KEY_REFRESH_ROUND3_H
-#define SAFEHERON_MULTI_PARTY_ECDSA_Li24_KEY_REFRESH_ROUND3_H
+#ifndef SAFEHERON_MULTI_PARTY_ECDSA_Li24_ONLINE_SIGN_ROUND1_H
+#define SAFEHERON_MULTI_PARTY_ECDSA_Li24_ONLINE_SIGN_ROUND1_H
 
 #include <string>
 #include <vector>
 #include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_context.h"
-#include "multi-party-sig/multi-party-ecdsa/Li24/key_refresh/message.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/online_sign/message.h"
 
 namespace safeheron {
 namespace multi_party_ecdsa{
 namespace Li24{
-namespace key_refresh {
+namespace online_sign{
 
-class Round3 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRound {
+class Context;
+
+class Round1 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRoundT<Context> {
 public:
-    std::vector<Round2P2PMessage> p2p_message_arr_;
+    std::vector<Round0BCMessage> bc_message_arr_;
 
 public:
-    Round3(): MPCRound(safeheron::mpc_flow::mpc_parallel_v2::MessageType::P2P, safeheron::mpc_flow::mpc_parallel_v2::MessageType::BROADCAST){}
+    Round1(): MPCRoundT(safeheron::mpc_flow::mpc_parallel_v2::MessageType::BROADCAST,
+                       safeheron::mpc_flow::mpc_parallel_v2::MessageType::None){}
 
     void Init() override;
 
@@ -37,4 +40,4 @@ public:
 }
 
 
-#endif //SAFEHERON_MULTI_PARTY_ECDSA_Li24_KEY_REFRESH_ROUND3_H
+#endif //SAFEHERON_MULTI_PARTY_ECDSA_Li24_ONLINE_SIGN_ROUND1_H
@@ -9,6 +9,7 @@
 #include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_context.h"
 #include "multi-party-sig/multi-party-ecdsa/Li24/proto_gen/struct.pb.switch.h"
 #include "multi-party-sig/multi-party-ecdsa/Li24/prg/prg.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/wire.h"
 
 namespace safeheron {
 namespace multi_party_ecdsa{
@@ -29,7 +30,8 @@ public:
     std::vector<safeheron::bignum::BN> seed_;
 
 public:
-    bool ToProtoObject(safeheron::proto::multi_party_ecdsa::Li24::Party &party) const;
+    bool ToProtoObject(safeheron::proto::multi_party_ecdsa::Li24::Party &party,
+                       WireVersion wire_version = WireVersion::Hex) const;
 
     bool FromProtoObject(const safeheron::proto::multi_party_ecdsa::Li24::Party &party);
 
@@ -58,7 +60,8 @@ public:
     PRG prg;
 
 public:
-    bool ToProtoObject(safeheron::proto::multi_party_ecdsa::Li24::Party &party) const;
+    bool ToProtoObject(safeheron::proto::multi_party_ecdsa::Li24::Party &party,
+                       WireVersion wire_version = WireVersion::Hex) const;
 
     bool FromProtoObject(const safeheron::proto::multi_party_ecdsa::Li24::Party &party);
 
@@ -16,31 +16,28 @@ namespace multi_party_ecdsa{
 namespace Li24{
 
 
-bool LocalParty::ToProtoObject(safeheron::proto::multi_party_ecdsa::Li24::Party &party) const {
+bool LocalParty::ToProtoObject(safeheron::proto::multi_party_ecdsa::Li24::Party &party, WireVersion wire_version) const {
     bool ok = true;
-    string str;
 
     // reset
     party.clear_x();
+    party.clear_x_bin();
 
     party.set_party_id(party_id_);
 
-    index_.ToHexStr(str);
-    party.set_index(str);
-
+    ok = EncodeBN(index_, wire_version, party.mutable_index(), party.mutable_index_bin());
+    if (!ok) return false;
 
-    x_.ToHexStr(str);
-    party.set_x(str);
+    ok = EncodeBN(x_, wire_version, party.mutable_x(), party.mutable_x_bin());
+    if (!ok) return false;
 
     safeheron::proto::CurvePoint point;
     ok = g_x_.ToProtoObject(point);
     if (!ok) return false;
     party.mutable_g_x()->CopyFrom(point);
 
-    for(const auto & i : seed_){
-        i.ToHexStr(str);
-        party.add_seed(str);
-    }
+    ok = EncodeBNArr(seed_, wire_version, party.mutable_seed(), party.mutable_seed_bin());
+    if (!ok) return false;
 
     return true;
 }
@@ -52,12 +49,12 @@ bool LocalParty::FromProtoObject(const safeheron::proto::multi_party_ecdsa::Li24
     ok = !party_id_.empty();
     if (!ok) return false;
 
-    index_ = BN::FromHexStr(party.index());
+    index_ = DecodeBN(party.index(), party.index_bin());
     ok = (index_ != 0);
     if (!ok) return false;
 
 
-    x_ = BN::FromHexStr(party.x());
+    x_ = DecodeBN(party.x(), party.x_bin());
     ok = (x_ != 0);
     if (!ok) return false;
 
@@ -66,10 +63,7 @@ bool LocalParty::FromProtoObject(const safeheron::proto::multi_party_ecdsa::Li24
     ok = ok && !g_x_.IsInfinity() && (g_x_ == curv->g * x_);
     if (!ok) return false;
 
-    for(int i = 0; i < party.seed_size(); ++i){
-        safeheron::curve::CurvePoint point;
-        seed_.push_back(BN::FromHexStr(party.seed(i)));
-    }
+    DecodeBNArr(party.seed(), party.seed_bin(), seed_);
 
 
     return true;
@@ -17,13 +17,12 @@ namespace Li24{
 
 
 
-bool RemoteParty::ToProtoObject(safeheron::proto::multi_party_ecdsa::Li24::Party &party) const {
+bool RemoteParty::ToProtoObject(safeheron::proto::multi_party_ecdsa::Li24::Party &party, WireVersion wire_version) const {
     bool ok = true;
-    string str;
     party.set_party_id(party_id_);
 
-    index_.ToHexStr(str);
-    party.set_index(str);
+    ok = EncodeBN(index_, wire_version, party.mutable_index(), party.mutable_index_bin());
+    if (!ok) return false;
 
 
 /*    safeheron::proto::CurvePoint point;
@@ -31,8 +30,11 @@ bool RemoteParty::ToProtoObject(safeheron::proto::multi_party_ecdsa::Li24::Party
     if (!ok) return false;
     party.mutable_g_x()->CopyFrom(point);*/
 
-    seed_.ToHexStr(str);
-    party.add_seed(str);
+    ok = EncodeBNArr({seed_}, wire_version, party.mutable_seed(), party.mutable_seed_bin());
+    if (!ok) return false;
+
+    party.mutable_prg_cursor()->set_version(PRG_CURSOR_VERSION);
+    party.mutable_prg_cursor()->set_position(prg.position());
 
     return true;
 }
@@ -44,7 +46,7 @@ bool RemoteParty::FromProtoObject(const safeheron::proto::multi_party_ecdsa::Li2
     ok = !party_id_.empty();
     if (!ok) return false;
 
-    index_ = BN::FromHexStr(party.index());
+    index_ = DecodeBN(party.index(), party.index_bin());
     ok = (index_ != 0);
     if (!ok) return false;
 
@@ -53,7 +55,19 @@ bool RemoteParty::FromProtoObject(const safeheron::proto::multi_party_ecdsa::Li2
     ok = ok && !g_x_.IsInfinity();
     if (!ok) return false;*/
 
-    seed_ = BN::FromHexStr(party.seed(0));
+    std::vector<BN> seed_arr;
+    DecodeBNArr(party.seed(), party.seed_bin(), seed_arr);
+    ok = !seed_arr.empty();
+    if (!ok) return false;
+    seed_ = seed_arr[0];
+
+    // Keys saved before the cursor existed carry version 0 and position 0.
+    ok = party.prg_cursor().version() <= PRG_CURSOR_VERSION;
+    if (!ok) return false;
+
+    // The position is restored by SignKey, which knows the PRG type.
+    prg.reset();
+    prg.init(seed_);
 
     return true;
 }
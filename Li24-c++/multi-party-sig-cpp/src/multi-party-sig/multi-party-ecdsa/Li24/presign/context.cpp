@@ -0,0 +1,113 @@
+#include "multi-party-sig/multi-party-ecdsa/Li24/presign/context.h"
+
+using safeheron::bignum::BN;
+using safeheron::multi_party_ecdsa::Li24::SignKey;
+using safeheron::multi_party_ecdsa::Li24::SignKeyHandle;
+
+namespace safeheron {
+namespace multi_party_ecdsa{
+namespace Li24{
+namespace presign{
+
+Context::Context(int total_parties): MPCContext(total_parties), presig_count_(0), local_party_index(0){
+    BindAllRounds();
+}
+
+Context::Context(const Context &ctx): MPCContext(ctx){
+    // Assign all the member variables.
+    sign_key_ = ctx.sign_key_;
+    quorum_ = ctx.quorum_;
+
+    presig_count_ = ctx.presig_count_;
+
+    local_party_ = ctx.local_party_;
+    round0_ = ctx.round0_;
+    round1_ = ctx.round1_;
+    round2_ = ctx.round2_;
+
+    remote_party_indexes = ctx.remote_party_indexes;
+    local_party_index = ctx.local_party_index;
+
+    R_arr_ = ctx.R_arr_;
+    r_arr_ = ctx.r_arr_;
+    presig_arr_ = ctx.presig_arr_;
+    // End Assignments.
+
+    BindAllRounds();
+}
+
+Context &Context::operator=(const Context &ctx){
+    if (this == &ctx) {
+        return *this;
+    }
+
+    MPCContext::operator=(ctx);
+
+    // Assign all the member variables.
+    sign_key_ = ctx.sign_key_;
+    quorum_ = ctx.quorum_;
+
+    presig_count_ = ctx.presig_count_;
+
+    local_party_ = ctx.local_party_;
+    round0_ = ctx.round0_;
+    round1_ = ctx.round1_;
+    round2_ = ctx.round2_;
+
+    remote_party_indexes = ctx.remote_party_indexes;
+    local_party_index = ctx.local_party_index;
+
+    R_arr_ = ctx.R_arr_;
+    r_arr_ = ctx.r_arr_;
+    presig_arr_ = ctx.presig_arr_;
+    // End Assignments.
+
+    BindAllRounds();
+
+    return *this;
+}
+
+bool Context::CreateContext(Context &ctx, const std::string &sign_key_base64, size_t presig_count) {
+    bool ok = true;
+    if (presig_count == 0) return false;
+    ctx.presig_count_ = presig_count;
+
+    ok = ctx.sign_key_.FromBase64(sign_key_base64);
+    if (!ok) return false;
+    ok = ((int)ctx.sign_key_.n_parties_ == ctx.get_total_parties());
+    if (!ok) return false;
+
+    return true;
+}
+
+bool Context::CreateContext(Context &ctx, const SignKeyHandle &sign_key_handle,
+                            const std::vector<std::string> &participant_id_arr, size_t presig_count) {
+    bool ok = true;
+    if (presig_count == 0) return false;
+    ctx.presig_count_ = presig_count;
+
+    ok = sign_key_handle.Trim(ctx.sign_key_, participant_id_arr, presig_count * PRG_OUTPUTS_PER_SIGN);
+    if (!ok) return false;
+    ok = ((int)ctx.sign_key_.n_parties_ == ctx.get_total_parties());
+    if (!ok) return false;
+    ctx.quorum_ = sign_key_handle.GetQuorum(ctx.sign_key_);
+    if (!ctx.quorum_) return false;
+
+    return true;
+}
+
+bool Context::IsRemoteParty(const std::string &party_id) const {
+    return sign_key_.get_remote_party_pos(party_id) != -1;
+}
+
+void Context::BindAllRounds() {
+    RemoveAllRounds();
+    AddRound(&round0_);
+    AddRound(&round1_);
+    AddRound(&round2_);
+}
+
+}
+}
+}
+}
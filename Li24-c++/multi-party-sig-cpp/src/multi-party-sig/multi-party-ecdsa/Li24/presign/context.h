@@ -0,0 +1,89 @@
+#ifndef SAFEHERON_MULTI_PARTY_ECDSA_Li24_PRESIGN_CONTEXT_H
+#define SAFEHERON_MULTI_PARTY_ECDSA_Li24_PRESIGN_CONTEXT_H
+
+#include <memory>
+#include <vector>
+#include "crypto-suites/crypto-curve/curve.h"
+#include "crypto-suites/crypto-bn/bn.h"
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_context.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/sign_key.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/sign_key_handle.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/presign/presignature.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/presign/t_party.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/presign/round0.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/presign/round1.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/presign/round2.h"
+
+
+namespace safeheron {
+namespace multi_party_ecdsa{
+namespace Li24{
+namespace presign{
+
+/**
+ * Runs the message independent part of Li24::sign for K presignatures at once.
+ *
+ * Round0 and Round1 are those of Li24::batch_sign without delta; Round2 sums v and outputs presig_arr_,
+ * which the caller moves into a PresignaturePool. The PRG is consumed as by K runs of Li24::sign.
+ */
+class Context : public safeheron::mpc_flow::mpc_parallel_v2::MPCContext {
+public:
+    /**
+     * Default constructor
+     */
+    Context(int total_parties);
+
+    /**
+     * A copy constructor
+     */
+    Context(const Context &ctx);
+
+    /**
+     * A copy assignment operator
+     */
+    Context &operator=(const Context &ctx);
+
+public:
+    void BindAllRounds();
+
+    bool IsRemoteParty(const std::string &party_id) const override;
+
+    static bool CreateContext(Context &ctx, const std::string &sign_key_base64, size_t presig_count);
+
+    /**
+     * Same as above, but take the sign key from a handle, so that it is neither decoded nor trimmed from base64 again.
+     * @param participant_id_arr all the parties that take part in the signature.
+     */
+    static bool CreateContext(Context &ctx, const safeheron::multi_party_ecdsa::Li24::SignKeyHandle &sign_key_handle,
+                              const std::vector<std::string> &participant_id_arr, size_t presig_count);
+
+    size_t presig_count() const { return presig_count_; }
+
+public:
+    safeheron::multi_party_ecdsa::Li24::SignKey sign_key_;
+    // Set by the sign key handle, or computed in round 0
+    std::shared_ptr<const safeheron::multi_party_ecdsa::Li24::Quorum> quorum_;
+    size_t presig_count_;
+
+    LocalTParty local_party_;
+
+    std::vector<size_t> remote_party_indexes;
+    size_t local_party_index;
+
+    Round0 round0_;
+    Round1 round1_;
+    Round2 round2_;
+
+    std::vector<safeheron::curve::CurvePoint> R_arr_;
+    std::vector<safeheron::bignum::BN> r_arr_;
+
+    // Output
+    std::vector<Presignature> presig_arr_;
+};
+
+}
+}
+}
+}
+
+#endif //SAFEHERON_MULTI_PARTY_ECDSA_Li24_PRESIGN_CONTEXT_H
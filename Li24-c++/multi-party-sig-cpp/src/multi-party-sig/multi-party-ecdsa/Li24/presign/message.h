@@ -0,0 +1,43 @@
+#ifndef SAFEHERON_MULTI_PARTY_ECDSA_Li24_PRESIGN_MESSAGE_H
+#define SAFEHERON_MULTI_PARTY_ECDSA_Li24_PRESIGN_MESSAGE_H
+
+#include <vector>
+#include "crypto-suites/crypto-bn/bn.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/sign/proto_gen/sign.pb.switch.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/batch_sign/message.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/wire.h"
+namespace safeheron {
+namespace multi_party_ecdsa{
+namespace Li24{
+namespace presign{
+
+// Round 0 carries the same per-slot values as batch signing.
+typedef batch_sign::Round0BCMessage Round0BCMessage;
+typedef batch_sign::Round0P2PMessage Round0P2PMessage;
+
+class Round1BCMessage {
+public:
+    std::vector<safeheron::bignum::BN> v_arr_;
+    WireVersion wire_version_ = WireVersion::Hex;
+
+public:
+    bool ToProtoObject(safeheron::proto::multi_party_ecdsa::Li24::sign::PresignRound1BCMessage &message) const;
+
+    bool FromProtoObject(const safeheron::proto::multi_party_ecdsa::Li24::sign::PresignRound1BCMessage &message);
+
+    bool ToBase64(std::string &b64) const;
+
+    bool FromBase64(const std::string &b64);
+
+    bool ToJsonString(std::string &json_str)const ;
+
+    bool FromJsonString(const std::string &json_str);
+};
+
+
+}
+}
+}
+}
+
+#endif //SAFEHERON_MULTI_PARTY_ECDSA_Li24_PRESIGN_MESSAGE_H
@@ -0,0 +1,48 @@
+#include "multi-party-sig/multi-party-ecdsa/Li24/presign/presignature.h"
+
+using safeheron::bignum::BN;
+
+namespace safeheron {
+namespace multi_party_ecdsa{
+namespace Li24{
+namespace presign{
+
+PresignaturePool::PresignaturePool(size_t capacity): capacity_(capacity) {}
+
+bool PresignaturePool::Add(const Presignature &presig) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (presig_arr_.size() >= capacity_) return false;
+    if (!added_r_set_.insert(presig.r_).second) return false;
+    presig_arr_.push_back(presig);
+    return true;
+}
+
+bool PresignaturePool::Take(const BN &r, Presignature &presig) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto iter = presig_arr_.begin(); iter != presig_arr_.end(); ++iter) {
+        if (iter->r_ == r) {
+            presig = *iter;
+            presig_arr_.erase(iter);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool PresignaturePool::TakeFront(Presignature &presig) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (presig_arr_.empty()) return false;
+    presig = presig_arr_.front();
+    presig_arr_.pop_front();
+    return true;
+}
+
+size_t PresignaturePool::size() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return presig_arr_.size();
+}
+
+}
+}
+}
+}
@@ -0,0 +1,77 @@
+#ifndef SAFEHERON_MULTI_PARTY_ECDSA_Li24_PRESIGN_PRESIGNATURE_H
+#define SAFEHERON_MULTI_PARTY_ECDSA_Li24_PRESIGN_PRESIGNATURE_H
+
+#include <deque>
+#include <mutex>
+#include <set>
+#include "crypto-suites/crypto-bn/bn.h"
+#include "crypto-suites/crypto-curve/curve.h"
+
+namespace safeheron {
+namespace multi_party_ecdsa{
+namespace Li24{
+namespace presign{
+
+/**
+ * Message independent part of a Li24 signature, held by one party.
+ *
+ * The online phase only needs delta_i = m * phi_i + r * u_i, so a signature costs one broadcast.
+ * A presignature reveals the private key if it is used for two messages; it must be consumed at most once.
+ */
+class Presignature {
+public:
+    // R = sum(g^k_i), r = R.x
+    safeheron::curve::CurvePoint R_;
+    safeheron::bignum::BN r_;
+    // Local shares phi_i and u_i
+    safeheron::bignum::BN phi_;
+    safeheron::bignum::BN u_;
+    // (sum(v_i))^-1 mod n
+    safeheron::bignum::BN v_inv_;
+};
+
+/**
+ * Bounded, thread safe pool of presignatures.
+ *
+ * Every presignature leaves the pool when it is taken, so it can not be handed out twice. The pool remembers the r of
+ * every presignature it has accepted, so a presignature which was taken can not be added again either.
+ * The pool lives in memory only: persisting it would make reuse after a restart possible.
+ */
+class PresignaturePool {
+public:
+    explicit PresignaturePool(size_t capacity);
+
+    /**
+     * Add a presignature. Fails if the pool is full or a presignature with the same r has ever been added.
+     */
+    bool Add(const Presignature &presig);
+
+    /**
+     * Remove and return the presignature with the given r.
+     */
+    bool Take(const safeheron::bignum::BN &r, Presignature &presig);
+
+    /**
+     * Remove and return the oldest presignature.
+     * Parties that fill their pools from the same presign runs take matching presignatures.
+     */
+    bool TakeFront(Presignature &presig);
+
+    size_t size() const;
+
+    size_t capacity() const { return capacity_; }
+
+private:
+    size_t capacity_;
+    mutable std::mutex mutex_;
+    std::deque<Presignature> presig_arr_;
+    // r of every presignature added, pooled or taken
+    std::set<safeheron::bignum::BN> added_r_set_;
+};
+
+}
+}
+}
+}
+
+#endif //SAFEHERON_MULTI_PARTY_ECDSA_Li24_PRESIGN_PRESIGNATURE_H
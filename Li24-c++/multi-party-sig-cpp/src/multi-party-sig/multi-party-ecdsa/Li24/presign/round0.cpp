@@ -0,0 +1,115 @@
+
+#include "crypto-suites/crypto-curve/curve.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/presign/round0.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/presign/context.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/batch_sign/slot.h"
+
+using std::string;
+using std::vector;
+using safeheron::bignum::BN;
+using safeheron::curve::CurveType;
+using safeheron::curve::CurvePoint;
+using safeheron::curve::Curve;
+using safeheron::sss::Polynomial;
+using safeheron::multi_party_ecdsa::Li24::SignKey;
+using safeheron::multi_party_ecdsa::Li24::Quorum;
+
+namespace safeheron {
+namespace multi_party_ecdsa{
+namespace Li24{
+namespace presign{
+
+bool Round0::MakeP2PMessage(size_t start,size_t end,std::vector<std::string> &out_p2p_msg_arr)const {
+    Context *ctx = this->get_context();
+    const SignKey &sign_key = ctx->sign_key_;
+    // An empty payload stands for zeros, only sent to peers of a key with the bytes encoding
+    bool sparse = (sign_key.wire_version_ == WireVersion::Bytes);
+
+    for (size_t i = 0; i < sign_key.remote_parties_.size(); ++i) {
+        size_t index = ctx->remote_party_indexes[i];
+        // The window [start, end] wraps around when end < start
+        bool in_window = (start <= end) ? (index >= start && index <= end) : (index >= start || index <= end);
+        if (!in_window && sparse) {
+            out_p2p_msg_arr.emplace_back();
+            continue;
+        }
+
+        Round0P2PMessage p2p_message;
+        p2p_message.wire_version_ = sign_key.wire_version_;
+        if (in_window) {
+            p2p_message.k_arr_ = ctx->local_party_.k_arr_;
+            p2p_message.w_arr_ = ctx->local_party_.w_arr_;
+            p2p_message.phi_arr_ = ctx->local_party_.phi_arr_;
+        } else {
+            batch_sign::SetZeroShares(ctx->presig_count(), p2p_message);
+        }
+        string base64;
+        bool ok = ctx->EncodeMessage(p2p_message, base64);
+        if (!ok) {
+            ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to encode the message!");
+            return false;
+        }
+        out_p2p_msg_arr.push_back(base64);
+    }
+    return true;
+}
+
+bool Round0::ComputeVerify() {
+    Context *ctx = this->get_context();
+    const SignKey &sign_key = ctx->sign_key_;
+
+    // Compute lambda once, it is shared by all slots
+    // The quorum comes from the sign key handle, otherwise it is computed for this signature only
+    if (!ctx->quorum_) {
+        std::shared_ptr<Quorum> quorum = std::make_shared<Quorum>();
+        if (!quorum->Compute(sign_key)) {
+            ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed in quorum->Compute(sign_key)!");
+            return false;
+        }
+        ctx->quorum_ = quorum;
+    }
+    const Quorum &quorum = *ctx->quorum_;
+    ctx->local_party_.l_arr_ = quorum.l_arr_;
+    ctx->local_party_.lambda_ = quorum.l_arr_.back();
+    ctx->local_party_index = quorum.local_party_index_;
+    ctx->remote_party_indexes = quorum.remote_party_indexes_;
+
+    // For every slot: sample k_i, phi_i in Z_q, then blind k, phi and w
+    batch_sign::SampleSlots(ctx->sign_key_, quorum, ctx->presig_count(), ctx->local_party_);
+
+    return true;
+}
+
+bool Round0::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
+                         std::vector<std::string> &out_des_arr) const {
+    Context *ctx = this->get_context();
+    const SignKey &sign_key = ctx->sign_key_;
+
+    out_p2p_msg_arr.clear();
+    out_bc_msg.clear();
+    out_des_arr.clear();
+
+    for (size_t i = 0; i < sign_key.remote_parties_.size(); ++i) {
+        out_des_arr.push_back(sign_key.remote_parties_[i].party_id_);
+    }
+    bool ok = true;
+
+    // make message p2p
+    ok = MakeP2PMessage(ctx->quorum_->p2p_start_, ctx->quorum_->p2p_end_, out_p2p_msg_arr);
+    if (!ok) return false;
+
+    Round0BCMessage bc_message;
+    bc_message.Gk_arr_ = ctx->local_party_.Gk_arr_;
+    ok = ctx->EncodeMessage(bc_message, out_bc_msg);
+    if (!ok) {
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed in ctx->EncodeMessage(bc_message, out_bc_msg)!");
+        return false;
+    }
+
+    return true;
+}
+
+}
+}
+}
+}
@@ -0,0 +1,39 @@
+#ifndef SAFEHERON_MULTI_PARTY_ECDSA_Li24_PRESIGN_ROUND0_H
+#define SAFEHERON_MULTI_PARTY_ECDSA_Li24_PRESIGN_ROUND0_H
+
+#include <string>
+#include <vector>
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_context.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/presign/message.h"
+
+namespace safeheron {
+namespace multi_party_ecdsa {
+namespace Li24 {
+namespace presign {
+
+class Context;
+
+class Round0 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRoundT<Context> {
+public:
+    Round0() : MPCRoundT(safeheron::mpc_flow::mpc_parallel_v2::MessageType::None,
+                        safeheron::mpc_flow::mpc_parallel_v2::MessageType::SPARSE_P2P_BROADCAST) {}
+
+    bool ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) override { return true; }
+
+    bool ReceiveVerify(const std::string &party_id) override { return true; }
+
+    bool ComputeVerify() override;
+
+    bool MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
+                     std::vector<std::string> &out_des_arr) const override;
+private:
+    bool MakeP2PMessage(size_t start,size_t end,std::vector<std::string> &out_p2p_msg_arr)const;
+};
+
+}
+}
+}
+}
+
+
+#endif //SAFEHERON_MULTI_PARTY_ECDSA_Li24_PRESIGN_ROUND0_H
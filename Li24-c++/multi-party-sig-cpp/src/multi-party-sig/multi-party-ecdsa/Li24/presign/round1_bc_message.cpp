@@ -1,6 +1,6 @@
 #include <google/protobuf/util/json_util.h>
 #include "crypto-suites/crypto-encode/base64.h"
-#include "multi-party-sig/multi-party-ecdsa/Li24/key_refresh/message.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/presign/message.h"
 
 using std::string;
 using safeheron::bignum::BN;
@@ -14,29 +14,24 @@ using google::protobuf::util::JsonParseOptions;
 namespace safeheron {
 namespace multi_party_ecdsa{
 namespace Li24{
-namespace key_refresh {
+namespace presign{
 
-
-
-bool Round3BCMessage::ToProtoObject(safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round3BCMessage &message) const {
-    bool ok = true;
-
-    message.set_ack_status(ack_status_);
-
-    return true;
+bool Round1BCMessage::ToProtoObject(safeheron::proto::multi_party_ecdsa::Li24::sign::PresignRound1BCMessage &message) const {
+    return EncodeBNArr(v_arr_, wire_version_, message.mutable_v(), message.mutable_v_bin());
 }
 
-bool Round3BCMessage::FromProtoObject(const safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round3BCMessage &message) {
-    bool ok = true;
-
-    ack_status_ = message.ack_status();
+bool Round1BCMessage::FromProtoObject(const safeheron::proto::multi_party_ecdsa::Li24::sign::PresignRound1BCMessage &message) {
+    DecodeBNArr(message.v(), message.v_bin(), v_arr_);
+    for (const BN &v : v_arr_) {
+        if (v == 0) return false;
+    }
 
     return true;
 }
 
 
-typedef Round3BCMessage TheClass;
-typedef safeheron::proto::multi_party_ecdsa::Li24::key_refresh::Round3BCMessage ProtoObject;
+typedef Round1BCMessage TheClass;
+typedef safeheron::proto::multi_party_ecdsa::Li24::sign::PresignRound1BCMessage ProtoObject;
 
 bool TheClass::ToBase64(string &b64) const {
     bool ok = true;
@@ -88,7 +83,6 @@ bool TheClass::FromJsonString(const string &json_str) {
     return FromProtoObject(proto_object);
 }
 
-
 }
 }
 }
@@ -0,0 +1,94 @@
+#include "crypto-suites/crypto-curve/curve.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/presign/round2.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/presign/context.h"
+
+using std::string;
+using safeheron::bignum::BN;
+using safeheron::curve::Curve;
+using safeheron::multi_party_ecdsa::Li24::SignKey;
+
+namespace safeheron {
+namespace multi_party_ecdsa{
+namespace Li24{
+namespace presign{
+
+void Round2::Init() {
+
+    Context *ctx = this->get_context();
+    for (int i = 0; i < ctx->get_total_parties() - 1; ++i) {
+        bc_message_arr_.emplace_back();
+    }
+
+}
+
+bool Round2::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
+
+    Context *ctx = this->get_context();
+    const SignKey &sign_key = ctx->sign_key_;
+
+    int pos = sign_key.get_remote_party_pos(party_id);
+    if (pos == -1) {
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
+        return false;
+    }
+
+    bool ok = ctx->DecodeMessage(bc_msg, bc_message_arr_[pos]);
+    if (!ok) {
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to deserialize the message!");
+        return false;
+    }
+
+    return true;
+}
+
+bool Round2::ReceiveVerify(const std::string &party_id) {
+    Context *ctx = this->get_context();
+    const SignKey &sign_key = ctx->sign_key_;
+
+    int pos = sign_key.get_remote_party_pos(party_id);
+    if (bc_message_arr_[pos].v_arr_.size() != ctx->presig_count()) {
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Presignature count mismatch in message from " + party_id + "!");
+        return false;
+    }
+
+    return true;
+}
+
+bool Round2::ComputeVerify() {
+    Context *ctx = this->get_context();
+    const SignKey &sign_key = ctx->sign_key_;
+
+    const Curve * curv = GetCurveParam(sign_key.X_.GetCurveType());
+
+    ctx->presig_arr_.clear();
+    for (size_t slot = 0; slot < ctx->presig_count(); ++slot) {
+        BN v = ctx->local_party_.v_arr_[slot];
+        for (size_t i = 0; i < bc_message_arr_.size(); ++i) {
+            v = (v + bc_message_arr_[i].v_arr_[slot]) % curv->n;
+        }
+        if (v == 0) {
+            ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "v == 0 in presignature slot " + std::to_string(slot) + "!");
+            return false;
+        }
+
+        Presignature presig;
+        presig.R_ = ctx->R_arr_[slot];
+        presig.r_ = ctx->r_arr_[slot];
+        presig.phi_ = ctx->local_party_.phi_arr_[slot];
+        presig.u_ = ctx->local_party_.u_arr_[slot];
+        presig.v_inv_ = v.InvM(curv->n);
+        ctx->presig_arr_.push_back(presig);
+    }
+
+    return true;
+}
+
+bool Round2::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
+                         std::vector<std::string> &out_des_arr) const {
+    return true;
+}
+
+}
+}
+}
+}
@@ -1,23 +1,26 @@
 
-#ifndef SAFEHERON_MULTI_PARTY_ECDSA_Li24_KEY_REFRESH_ROUND4_H
-#define SAFEHERON_MULTI_PARTY_ECDSA_Li24_KEY_REFRESH_ROUND4_H
+#ifndef SAFEHERON_MULTI_PARTY_ECDSA_Li24_PRESIGN_ROUND2_H
+#define SAFEHERON_MULTI_PARTY_ECDSA_Li24_PRESIGN_ROUND2_H
 
 #include <string>
 #include <vector>
 #include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_context.h"
-#include "multi-party-sig/multi-party-ecdsa/Li24/key_refresh/message.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/presign/message.h"
 
 namespace safeheron {
 namespace multi_party_ecdsa{
 namespace Li24{
-namespace key_refresh {
+namespace presign{
 
-class Round4 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRound {
+class Context;
+
+class Round2 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRoundT<Context> {
 public:
-    std::vector<Round3BCMessage> bc_message_arr_;
+    std::vector<Round1BCMessage> bc_message_arr_;
 
 public:
-    Round4(): MPCRound(safeheron::mpc_flow::mpc_parallel_v2::MessageType::BROADCAST, safeheron::mpc_flow::mpc_parallel_v2::MessageType::None){}
+    Round2(): MPCRoundT(safeheron::mpc_flow::mpc_parallel_v2::MessageType::BROADCAST,
+                       safeheron::mpc_flow::mpc_parallel_v2::MessageType::None){}
 
     void Init() override;
 
@@ -32,10 +35,9 @@ public:
 };
 
 }
-
 }
 }
 }
 
 
-#endif //SAFEHERON_MULTI_PARTY_ECDSA_Li24_KEY_REFRESH_ROUND4_H
+#endif //SAFEHERON_MULTI_PARTY_ECDSA_Li24_PRESIGN_ROUND2_H
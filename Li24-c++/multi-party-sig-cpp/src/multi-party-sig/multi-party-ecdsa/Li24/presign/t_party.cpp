@@ -0,0 +1,2 @@
+
+#include "t_party.h"
\ No newline at end of file
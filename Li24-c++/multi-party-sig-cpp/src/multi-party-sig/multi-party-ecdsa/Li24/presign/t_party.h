@@ -0,0 +1,22 @@
+#ifndef SAFEHERON_MULTI_PARTY_ECDSA_Li24_PRESIGN_T_PARTY_H
+#define SAFEHERON_MULTI_PARTY_ECDSA_Li24_PRESIGN_T_PARTY_H
+
+
+#include "multi-party-sig/multi-party-ecdsa/Li24/batch_sign/t_party.h"
+
+namespace safeheron {
+namespace multi_party_ecdsa{
+namespace Li24{
+namespace presign{
+
+// The local party of a presignature run holds the same per-slot values as that of batch signing, except delta_arr_
+// which stays empty.
+typedef batch_sign::LocalTParty LocalTParty;
+
+}
+}
+}
+}
+
+
+#endif //SAFEHERON_MULTI_PARTY_ECDSA_Li24_PRESIGN_T_PARTY_H
@@ -2,22 +2,33 @@
 // Created by 17830 on 2024/4/21.
 //
 #include "multi-party-sig/multi-party-ecdsa/Li24/prg/prg.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/prg/sha256_lanes.h"
 #include "iostream"
+#include <cstring>
+
 void PRG::reset()
 {
     hash_256.Reset();
+    counter_ = 0;
 }
 
 void PRG::init(const safeheron::bignum::BN& data)
 {
     num = data;
+    seed_ = data;
+    data.ToBytes32LE(key_);
+    counter_ = 0;
 }
 
 safeheron::bignum::BN PRG::rand()
 {
+    if (type_ == PRGType::Counter) {
+        return rand_at(counter_++);
+    }
 /*    std::string str;
     num.ToHexStr(str);
     std::cout<<str<<std::endl;*/
+    ++counter_;
     uint8_t inbuf[32];
     num.ToBytes32LE(inbuf);
     hash_256.Write(inbuf,32);
@@ -26,3 +37,89 @@ safeheron::bignum::BN PRG::rand()
     num = safeheron::bignum::BN::FromBytesLE(outbuf,32);
     return num;
 }
+
+safeheron::bignum::BN PRG::rand_at(uint64_t i) const
+{
+    uint8_t ctr[8];
+    for (int k = 0; k < 8; ++k) {
+        ctr[k] = static_cast<uint8_t>(i >> (8 * k));
+    }
+    safeheron::hash::CSHA256 sha256;
+    sha256.Write(key_, 32);
+    sha256.Write(ctr, 8);
+    uint8_t outbuf[32];
+    sha256.Finalize(outbuf);
+    return safeheron::bignum::BN::FromBytesLE(outbuf, 32);
+}
+
+void PRG::rand_lanes(const std::vector<PRG *> &prg_arr, size_t count, std::vector<safeheron::bignum::BN> &out_arr)
+{
+    out_arr.resize(prg_arr.size() * count);
+    std::vector<size_t> chain_pos_arr;
+    std::vector<size_t> counter_pos_arr;
+    for (size_t i = 0; i < prg_arr.size(); ++i) {
+        if (prg_arr[i]->type_ == PRGType::Counter) {
+            counter_pos_arr.push_back(i);
+        } else {
+            chain_pos_arr.push_back(i);
+        }
+    }
+
+    // Counter mode: every output is a message of its own, key || LE64(i)
+    if (!counter_pos_arr.empty()) {
+        const size_t msg_len = 40;
+        size_t n = counter_pos_arr.size() * count;
+        std::vector<uint8_t> msg_buf(n * msg_len);
+        std::vector<const uint8_t *> msg_arr(n);
+        for (size_t k = 0; k < counter_pos_arr.size(); ++k) {
+            PRG *prg = prg_arr[counter_pos_arr[k]];
+            for (size_t j = 0; j < count; ++j) {
+                uint8_t *msg = &msg_buf[(k * count + j) * msg_len];
+                uint64_t i = prg->counter_ + j;
+                memcpy(msg, prg->key_, 32);
+                for (int b = 0; b < 8; ++b) {
+                    msg[32 + b] = static_cast<uint8_t>(i >> (8 * b));
+                }
+                msg_arr[k * count + j] = msg;
+            }
+            prg->counter_ += count;
+        }
+        std::vector<uint8_t> out_buf(n * 32);
+        SHA256Lanes(msg_arr.data(), msg_len, n, out_buf.data());
+        for (size_t k = 0; k < counter_pos_arr.size(); ++k) {
+            for (size_t j = 0; j < count; ++j) {
+                out_arr[counter_pos_arr[k] * count + j] =
+                        safeheron::bignum::BN::FromBytesLE(&out_buf[(k * count + j) * 32], 32);
+            }
+        }
+    }
+
+    // Hash chain: every output carries on from the SHA256 state of the previous one
+    for (size_t pos : chain_pos_arr) {
+        for (size_t j = 0; j < count; ++j) {
+            out_arr[pos * count + j] = prg_arr[pos]->rand();
+        }
+    }
+}
+
+void PRG::seek(uint64_t position)
+{
+    if (type_ == PRGType::Counter) {
+        counter_ = position;
+        return;
+    }
+    if (position < counter_) {
+        hash_256.Reset();
+        num = seed_;
+        counter_ = 0;
+    }
+    while (counter_ < position) {
+        rand();
+    }
+}
+
+bool IsValidPRGType(int32_t type)
+{
+    return type == static_cast<int32_t>(PRGType::HashChain) ||
+           type == static_cast<int32_t>(PRGType::Counter);
+}
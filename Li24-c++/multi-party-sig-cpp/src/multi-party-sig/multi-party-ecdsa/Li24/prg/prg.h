@@ -5,19 +5,90 @@
 #ifndef MULTIPARTYSIG_PRG_H
 #define MULTIPARTYSIG_PRG_H
 
+#include <cstdint>
+#include <vector>
 #include "crypto-suites/crypto-bn/rand.h"
 #include "crypto-suites/crypto-bn/bn.h"
 #include "crypto-suites/crypto-hash/sha256.h"
 
+/**
+ * Output construction of the PRG, stored per sign key.
+ *  - HashChain: the i-th rand() writes LE32(out_{i-1}) to one CSHA256 and finalizes it, out_0 = seed. Finalize()
+ *               pads the stream but does not reset it, so out_i = SHA256(LE32(out_0) || pad_1 || ... || pad_{i-1} ||
+ *               LE32(out_{i-1})), where pad_j is the padding of the first 64 * j - 32 bytes. Each output depends on
+ *               the SHA256 state left by the previous one, so outputs must be drawn in order, one at a time.
+ *  - Counter:   out_i = SHA256(seed || LE64(i)). Any output can be computed directly.
+ */
+enum class PRGType : int32_t {
+    HashChain = 0,
+    Counter = 1,
+};
+
 class PRG
 {
 private:
     safeheron::hash::CSHA256 hash_256;
     safeheron::bignum::BN num;
 
+    PRGType type_ = PRGType::HashChain;
+    // Seed kept to replay the hash chain on seek().
+    safeheron::bignum::BN seed_;
+    // Seed encoded once in init(), used as the key of the counter mode.
+    uint8_t key_[32] = {0};
+    // Number of outputs consumed so far, i.e. the index of the next output.
+    uint64_t counter_ = 0;
+
 public:
     void reset();
     void init(const safeheron::bignum::BN& data);
     safeheron::bignum::BN rand();
+
+    /**
+     * Compute the i-th output of the counter mode without touching the state.
+     * Only meaningful when type() == PRGType::Counter.
+     */
+    safeheron::bignum::BN rand_at(uint64_t i) const;
+
+    /**
+     * Move to the given position, so that the next rand() returns output number 'position'.
+     * O(1) in counter mode. The hash chain is replayed from the seed, or from the current
+     * position when moving forward, one hash per output: O(1) resume needs a counter-mode key.
+     */
+    void seek(uint64_t position);
+
+    uint64_t position() const { return counter_; }
+
+    /**
+     * Draw 'count' outputs from every PRG of prg_arr, the same as calling rand() 'count' times on each of them:
+     * out_arr[i * count + j] is output j of prg_arr[i]. The outputs of the counter mode are hashed side by side with
+     * SHA256Lanes(); those of a hash chain are drawn with rand(), see PRGType.
+     */
+    static void rand_lanes(const std::vector<PRG *> &prg_arr, size_t count,
+                           std::vector<safeheron::bignum::BN> &out_arr);
+
+    void set_type(PRGType type) { type_ = type; }
+    PRGType type() const { return type_; }
 };
+
+/**
+ * Number of PRG outputs a single Li24 signature consumes from each remote party (k, phi, w).
+ */
+const uint64_t PRG_OUTPUTS_PER_SIGN = 3;
+
+/**
+ * Version of the persisted PRG cursor.
+ */
+const int32_t PRG_CURSOR_VERSION = 1;
+
+/**
+ * Largest PRG cursor of a hash-chain key accepted on load, about a million signatures with every remote party.
+ * Loading replays each chain from the seed up to its cursor, a counter-mode key resumes at any cursor in O(1).
+ */
+const uint64_t PRG_MAX_CHAIN_POSITION = PRG_OUTPUTS_PER_SIGN << 20;
+
+/**
+ * Check whether the value is a known PRGType.
+ */
+bool IsValidPRGType(int32_t type);
+
 #endif //MULTIPARTYSIG_PRG_H
@@ -0,0 +1,282 @@
+#include "multi-party-sig/multi-party-ecdsa/Li24/prg/sha256_lanes.h"
+#include <cstring>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define SHA256_LANES_X86 1
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+
+namespace {
+
+const uint32_t K[64] = {
+        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+        0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+        0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+        0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+        0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+        0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+        0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+        0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+};
+
+const uint32_t IV[8] = {
+        0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19,
+};
+
+// Single padded block of a message of at most SHA256_LANES_MAX_MSG_LEN bytes
+void PadBlock(const uint8_t *msg, size_t msg_len, uint8_t block[64]) {
+    memset(block, 0, 64);
+    memcpy(block, msg, msg_len);
+    block[msg_len] = 0x80;
+    uint64_t bits = (uint64_t)msg_len * 8;
+    for (int i = 0; i < 8; ++i) {
+        block[63 - i] = (uint8_t)(bits >> (8 * i));
+    }
+}
+
+uint32_t ReadBE32(const uint8_t *p) {
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | (uint32_t)p[3];
+}
+
+void WriteBE32(uint8_t *p, uint32_t v) {
+    p[0] = (uint8_t)(v >> 24);
+    p[1] = (uint8_t)(v >> 16);
+    p[2] = (uint8_t)(v >> 8);
+    p[3] = (uint8_t)v;
+}
+
+uint32_t Rotr(uint32_t x, int n) {
+    return (x >> n) | (x << (32 - n));
+}
+
+void CompressScalar(uint32_t state[8], const uint8_t block[64]) {
+    uint32_t w[64];
+    for (int t = 0; t < 16; ++t) w[t] = ReadBE32(block + 4 * t);
+    for (int t = 16; t < 64; ++t) {
+        uint32_t s0 = Rotr(w[t - 15], 7) ^ Rotr(w[t - 15], 18) ^ (w[t - 15] >> 3);
+        uint32_t s1 = Rotr(w[t - 2], 17) ^ Rotr(w[t - 2], 19) ^ (w[t - 2] >> 10);
+        w[t] = w[t - 16] + s0 + w[t - 7] + s1;
+    }
+    uint32_t a = state[0], b = state[1], c = state[2], d = state[3];
+    uint32_t e = state[4], f = state[5], g = state[6], h = state[7];
+    for (int t = 0; t < 64; ++t) {
+        uint32_t t1 = h + (Rotr(e, 6) ^ Rotr(e, 11) ^ Rotr(e, 25)) + ((e & f) ^ (~e & g)) + K[t] + w[t];
+        uint32_t t2 = (Rotr(a, 2) ^ Rotr(a, 13) ^ Rotr(a, 22)) + ((a & b) ^ (a & c) ^ (b & c));
+        h = g; g = f; f = e; e = d + t1;
+        d = c; c = b; b = a; a = t1 + t2;
+    }
+    state[0] += a; state[1] += b; state[2] += c; state[3] += d;
+    state[4] += e; state[5] += f; state[6] += g; state[7] += h;
+}
+
+void LanesScalar(const uint8_t *const *msg_arr, size_t msg_len, size_t count, uint8_t *out_arr) {
+    uint8_t block[64];
+    for (size_t i = 0; i < count; ++i) {
+        uint32_t state[8];
+        memcpy(state, IV, sizeof(state));
+        PadBlock(msg_arr[i], msg_len, block);
+        CompressScalar(state, block);
+        for (int k = 0; k < 8; ++k) WriteBE32(out_arr + 32 * i + 4 * k, state[k]);
+    }
+}
+
+#ifdef SHA256_LANES_X86
+
+const size_t AVX2_LANES = 8;
+
+#define AVX2_ROTR(x, n) _mm256_or_si256(_mm256_srli_epi32(x, n), _mm256_slli_epi32(x, 32 - (n)))
+
+__attribute__((target("avx2")))
+void CompressAVX2(const uint32_t w_in[16][AVX2_LANES], uint32_t out[8][AVX2_LANES]) {
+    __m256i w[64];
+    for (int t = 0; t < 16; ++t) w[t] = _mm256_loadu_si256((const __m256i *)w_in[t]);
+    for (int t = 16; t < 64; ++t) {
+        __m256i s0 = _mm256_xor_si256(_mm256_xor_si256(AVX2_ROTR(w[t - 15], 7), AVX2_ROTR(w[t - 15], 18)),
+                                      _mm256_srli_epi32(w[t - 15], 3));
+        __m256i s1 = _mm256_xor_si256(_mm256_xor_si256(AVX2_ROTR(w[t - 2], 17), AVX2_ROTR(w[t - 2], 19)),
+                                      _mm256_srli_epi32(w[t - 2], 10));
+        w[t] = _mm256_add_epi32(_mm256_add_epi32(w[t - 16], s0), _mm256_add_epi32(w[t - 7], s1));
+    }
+    __m256i a = _mm256_set1_epi32((int)IV[0]), b = _mm256_set1_epi32((int)IV[1]);
+    __m256i c = _mm256_set1_epi32((int)IV[2]), d = _mm256_set1_epi32((int)IV[3]);
+    __m256i e = _mm256_set1_epi32((int)IV[4]), f = _mm256_set1_epi32((int)IV[5]);
+    __m256i g = _mm256_set1_epi32((int)IV[6]), h = _mm256_set1_epi32((int)IV[7]);
+    for (int t = 0; t < 64; ++t) {
+        __m256i sig1 = _mm256_xor_si256(_mm256_xor_si256(AVX2_ROTR(e, 6), AVX2_ROTR(e, 11)), AVX2_ROTR(e, 25));
+        __m256i ch = _mm256_xor_si256(_mm256_and_si256(e, f), _mm256_andnot_si256(e, g));
+        __m256i t1 = _mm256_add_epi32(_mm256_add_epi32(h, sig1),
+                                      _mm256_add_epi32(ch, _mm256_add_epi32(_mm256_set1_epi32((int)K[t]), w[t])));
+        __m256i sig0 = _mm256_xor_si256(_mm256_xor_si256(AVX2_ROTR(a, 2), AVX2_ROTR(a, 13)), AVX2_ROTR(a, 22));
+        __m256i maj = _mm256_xor_si256(_mm256_and_si256(a, _mm256_xor_si256(b, c)), _mm256_and_si256(b, c));
+        __m256i t2 = _mm256_add_epi32(sig0, maj);
+        h = g; g = f; f = e; e = _mm256_add_epi32(d, t1);
+        d = c; c = b; b = a; a = _mm256_add_epi32(t1, t2);
+    }
+    __m256i state[8] = {a, b, c, d, e, f, g, h};
+    for (int k = 0; k < 8; ++k) {
+        _mm256_storeu_si256((__m256i *)out[k], _mm256_add_epi32(state[k], _mm256_set1_epi32((int)IV[k])));
+    }
+}
+
+void LanesAVX2(const uint8_t *const *msg_arr, size_t msg_len, size_t count, uint8_t *out_arr) {
+    uint8_t block[64];
+    uint32_t w[16][AVX2_LANES];
+    uint32_t state[8][AVX2_LANES];
+    for (size_t base = 0; base < count; base += AVX2_LANES) {
+        size_t lanes = count - base < AVX2_LANES ? count - base : AVX2_LANES;
+        // Unused lanes hash the last message again
+        for (size_t l = 0; l < AVX2_LANES; ++l) {
+            PadBlock(msg_arr[base + (l < lanes ? l : lanes - 1)], msg_len, block);
+            for (int t = 0; t < 16; ++t) w[t][l] = ReadBE32(block + 4 * t);
+        }
+        CompressAVX2(w, state);
+        for (size_t l = 0; l < lanes; ++l) {
+            for (int k = 0; k < 8; ++k) WriteBE32(out_arr + 32 * (base + l) + 4 * k, state[k][l]);
+        }
+    }
+}
+
+const size_t SHANI_LANES = 2;
+
+// Two independent messages are interleaved, the rounds of one run while the other waits for its latency
+__attribute__((target("sha,sse4.1")))
+void CompressSHANI(const uint8_t block_arr[SHANI_LANES][64], uint32_t out[SHANI_LANES][8]) {
+    const __m128i MASK = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+    // The rounds work on the state as ABEF and CDGH
+    __m128i tmp = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&IV[0]), 0xB1);
+    __m128i cdgh = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)&IV[4]), 0x1B);
+    const __m128i abef_iv = _mm_alignr_epi8(tmp, cdgh, 8);
+    const __m128i cdgh_iv = _mm_blend_epi16(cdgh, tmp, 0xF0);
+
+    __m128i state0[SHANI_LANES], state1[SHANI_LANES], w[SHANI_LANES][4];
+    for (size_t l = 0; l < SHANI_LANES; ++l) {
+        state0[l] = abef_iv;
+        state1[l] = cdgh_iv;
+        for (int i = 0; i < 4; ++i) {
+            w[l][i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(block_arr[l] + 16 * i)), MASK);
+        }
+    }
+    for (int i = 0; i < 16; ++i) {
+        const __m128i k = _mm_loadu_si128((const __m128i *)&K[4 * i]);
+        for (size_t l = 0; l < SHANI_LANES; ++l) {
+            __m128i msg = _mm_add_epi32(w[l][i & 3], k);
+            state1[l] = _mm_sha256rnds2_epu32(state1[l], state0[l], msg);
+            state0[l] = _mm_sha256rnds2_epu32(state0[l], state1[l], _mm_shuffle_epi32(msg, 0x0E));
+            if (i < 12) {
+                // Words 4 * (i + 4) .. 4 * (i + 4) + 3 of the schedule
+                __m128i next = _mm_sha256msg1_epu32(w[l][i & 3], w[l][(i + 1) & 3]);
+                next = _mm_add_epi32(next, _mm_alignr_epi8(w[l][(i + 3) & 3], w[l][(i + 2) & 3], 4));
+                w[l][i & 3] = _mm_sha256msg2_epu32(next, w[l][(i + 3) & 3]);
+            }
+        }
+    }
+
+    for (size_t l = 0; l < SHANI_LANES; ++l) {
+        tmp = _mm_shuffle_epi32(_mm_add_epi32(state0[l], abef_iv), 0x1B);
+        cdgh = _mm_shuffle_epi32(_mm_add_epi32(state1[l], cdgh_iv), 0xB1);
+        _mm_storeu_si128((__m128i *)&out[l][0], _mm_blend_epi16(tmp, cdgh, 0xF0));
+        _mm_storeu_si128((__m128i *)&out[l][4], _mm_alignr_epi8(cdgh, tmp, 8));
+    }
+}
+
+void LanesSHANI(const uint8_t *const *msg_arr, size_t msg_len, size_t count, uint8_t *out_arr) {
+    uint8_t block_arr[SHANI_LANES][64];
+    uint32_t state[SHANI_LANES][8];
+    for (size_t base = 0; base < count; base += SHANI_LANES) {
+        size_t lanes = count - base < SHANI_LANES ? count - base : SHANI_LANES;
+        for (size_t l = 0; l < SHANI_LANES; ++l) {
+            PadBlock(msg_arr[base + (l < lanes ? l : lanes - 1)], msg_len, block_arr[l]);
+        }
+        CompressSHANI(block_arr, state);
+        for (size_t l = 0; l < lanes; ++l) {
+            for (int k = 0; k < 8; ++k) WriteBE32(out_arr + 32 * (base + l) + 4 * k, state[l][k]);
+        }
+    }
+}
+
+bool CpuHasAVX2() {
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) return false;
+    // AVX registers must be enabled by the OS
+    if (!(ecx & bit_OSXSAVE) || !(ecx & bit_AVX)) return false;
+    unsigned int xcr0_lo, xcr0_hi;
+    __asm__ volatile("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+    if ((xcr0_lo & 6) != 6) return false;
+    if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) return false;
+    return (ebx & bit_AVX2) != 0;
+}
+
+bool CpuHasSHANI() {
+    unsigned int eax, ebx, ecx, edx;
+    if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) return false;
+    if (!(ecx & bit_SSSE3) || !(ecx & bit_SSE4_1)) return false;
+    if (!__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) return false;
+    return (ebx & bit_SHA) != 0;
+}
+
+#endif
+
+}
+
+bool SHA256LanesSupported(SHA256LanesEngine engine) {
+    switch (engine) {
+        case SHA256LanesEngine::Scalar:
+            return true;
+#ifdef SHA256_LANES_X86
+        case SHA256LanesEngine::AVX2: {
+            static const bool supported = CpuHasAVX2();
+            return supported;
+        }
+        case SHA256LanesEngine::SHANI: {
+            static const bool supported = CpuHasSHANI();
+            return supported;
+        }
+#endif
+        default:
+            return false;
+    }
+}
+
+SHA256LanesEngine SHA256LanesDefaultEngine() {
+    static const SHA256LanesEngine engine =
+            SHA256LanesSupported(SHA256LanesEngine::SHANI) ? SHA256LanesEngine::SHANI :
+            SHA256LanesSupported(SHA256LanesEngine::AVX2) ? SHA256LanesEngine::AVX2 :
+            SHA256LanesEngine::Scalar;
+    return engine;
+}
+
+const char *SHA256LanesEngineName(SHA256LanesEngine engine) {
+    switch (engine) {
+        case SHA256LanesEngine::Scalar: return "scalar";
+        case SHA256LanesEngine::AVX2: return "avx2";
+        case SHA256LanesEngine::SHANI: return "sha-ni";
+    }
+    return "unknown";
+}
+
+bool SHA256Lanes(const uint8_t *const *msg_arr, size_t msg_len, size_t count, uint8_t *out_arr) {
+    return SHA256Lanes(SHA256LanesDefaultEngine(), msg_arr, msg_len, count, out_arr);
+}
+
+bool SHA256Lanes(SHA256LanesEngine engine, const uint8_t *const *msg_arr, size_t msg_len, size_t count,
+                 uint8_t *out_arr) {
+    if (msg_len > SHA256_LANES_MAX_MSG_LEN || !SHA256LanesSupported(engine)) return false;
+    if (count == 0) return true;
+    switch (engine) {
+        case SHA256LanesEngine::Scalar:
+            LanesScalar(msg_arr, msg_len, count, out_arr);
+            return true;
+#ifdef SHA256_LANES_X86
+        case SHA256LanesEngine::AVX2:
+            LanesAVX2(msg_arr, msg_len, count, out_arr);
+            return true;
+        case SHA256LanesEngine::SHANI:
+            LanesSHANI(msg_arr, msg_len, count, out_arr);
+            return true;
+#endif
+        default:
+            return false;
+    }
+}
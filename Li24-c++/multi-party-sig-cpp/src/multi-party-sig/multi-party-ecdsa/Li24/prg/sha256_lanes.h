@@ -0,0 +1,45 @@
+#ifndef MULTIPARTYSIG_SHA256_LANES_H
+#define MULTIPARTYSIG_SHA256_LANES_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Implementations of SHA256Lanes().
+ *  - Scalar: portable, one message after the other.
+ *  - AVX2:   8 messages side by side, one per 32-bit lane.
+ *  - SHANI:  x86 SHA extensions, 2 messages interleaved.
+ */
+enum class SHA256LanesEngine : int32_t {
+    Scalar = 0,
+    AVX2 = 1,
+    SHANI = 2,
+};
+
+/**
+ * Maximum length of a message, so that it fits in a single block with its padding.
+ */
+const size_t SHA256_LANES_MAX_MSG_LEN = 55;
+
+/**
+ * Check whether the engine is compiled in and supported by the CPU.
+ */
+bool SHA256LanesSupported(SHA256LanesEngine engine);
+
+/**
+ * Fastest engine supported by the CPU, detected once.
+ */
+SHA256LanesEngine SHA256LanesDefaultEngine();
+
+const char *SHA256LanesEngineName(SHA256LanesEngine engine);
+
+/**
+ * Hash 'count' independent messages of the same length: out_arr + 32 * i = SHA256(msg_arr[i], msg_len).
+ * @return false if msg_len > SHA256_LANES_MAX_MSG_LEN or the engine is not supported.
+ */
+bool SHA256Lanes(const uint8_t *const *msg_arr, size_t msg_len, size_t count, uint8_t *out_arr);
+
+bool SHA256Lanes(SHA256LanesEngine engine, const uint8_t *const *msg_arr, size_t msg_len, size_t count,
+                 uint8_t *out_arr);
+
+#endif //MULTIPARTYSIG_SHA256_LANES_H
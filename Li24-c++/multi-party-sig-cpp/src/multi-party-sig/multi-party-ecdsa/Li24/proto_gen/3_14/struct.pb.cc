@@ -15,11 +15,16 @@
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
 extern PROTOBUF_INTERNAL_EXPORT_curve_5fpoint_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_CurvePoint_curve_5fpoint_2eproto;
-extern PROTOBUF_INTERNAL_EXPORT_Li24_2fstruct_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_Party_Li24_2fstruct_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_Li24_2fstruct_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_PRGCursor_Li24_2fstruct_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_Li24_2fstruct_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_Party_Li24_2fstruct_2eproto;
 namespace safeheron {
 namespace proto {
 namespace multi_party_ecdsa {
 namespace Li24 {
+class PRGCursorDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<PRGCursor> _instance;
+} _PRGCursor_default_instance_;
 class PartyDefaultTypeInternal {
  public:
   ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Party> _instance;
@@ -32,6 +37,19 @@ class SignKeyDefaultTypeInternal {
 }  // namespace multi_party_ecdsa
 }  // namespace proto
 }  // namespace safeheron
+static void InitDefaultsscc_info_PRGCursor_Li24_2fstruct_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::safeheron::proto::multi_party_ecdsa::Li24::_PRGCursor_default_instance_;
+    new (ptr) ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_PRGCursor_Li24_2fstruct_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_PRGCursor_Li24_2fstruct_2eproto}, {}};
+
 static void InitDefaultsscc_info_Party_Li24_2fstruct_2eproto() {
   GOOGLE_PROTOBUF_VERIFY_VERSION;
 
@@ -42,9 +60,10 @@ static void InitDefaultsscc_info_Party_Li24_2fstruct_2eproto() {
   }
 }
 
-::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_Party_Li24_2fstruct_2eproto =
-    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_Party_Li24_2fstruct_2eproto}, {
-      &scc_info_CurvePoint_curve_5fpoint_2eproto.base,}};
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_Party_Li24_2fstruct_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 2, 0, InitDefaultsscc_info_Party_Li24_2fstruct_2eproto}, {
+      &scc_info_CurvePoint_curve_5fpoint_2eproto.base,
+      &scc_info_PRGCursor_Li24_2fstruct_2eproto.base,}};
 
 static void InitDefaultsscc_info_SignKey_Li24_2fstruct_2eproto() {
   GOOGLE_PROTOBUF_VERIFY_VERSION;
@@ -61,11 +80,18 @@ static void InitDefaultsscc_info_SignKey_Li24_2fstruct_2eproto() {
       &scc_info_Party_Li24_2fstruct_2eproto.base,
       &scc_info_CurvePoint_curve_5fpoint_2eproto.base,}};
 
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_Li24_2fstruct_2eproto[2];
+static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_Li24_2fstruct_2eproto[3];
 static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_Li24_2fstruct_2eproto = nullptr;
 static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_Li24_2fstruct_2eproto = nullptr;
 
 const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_Li24_2fstruct_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor, version_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor, position_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::Party, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -76,6 +102,10 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_Li24_2fstruct_2eproto::offsets
   PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::Party, x_),
   PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::Party, g_x_),
   PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::Party, seed_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::Party, prg_cursor_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::Party, index_bin_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::Party, x_bin_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::Party, seed_bin_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::SignKey, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -87,13 +117,17 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_Li24_2fstruct_2eproto::offsets
   PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::SignKey, local_party_),
   PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::SignKey, remote_parties_),
   PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::SignKey, g_x_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::SignKey, prg_type_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::SignKey, wire_version_),
 };
 static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::Party)},
-  { 10, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::SignKey)},
+  { 0, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor)},
+  { 7, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::Party)},
+  { 21, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::SignKey)},
 };
 
 static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::safeheron::proto::multi_party_ecdsa::Li24::_PRGCursor_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::safeheron::proto::multi_party_ecdsa::Li24::_Party_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::safeheron::proto::multi_party_ecdsa::Li24::_SignKey_default_instance_),
 };
@@ -101,31 +135,37 @@ static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] =
 const char descriptor_table_protodef_Li24_2fstruct_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
   "\n\021Li24/struct.proto\022&safeheron.proto.mul"
   "ti_party_ecdsa.Li24\032\021curve_point.proto\032\016"
-  "paillier.proto\"k\n\005Party\022\020\n\010party_id\030\001 \001("
-  "\t\022\r\n\005index\030\003 \001(\t\022\t\n\001x\030\010 \001(\t\022(\n\003g_x\030\t \001(\013"
-  "2\033.safeheron.proto.CurvePoint\022\014\n\004seed\030\n "
-  "\003(\t\"\372\001\n\007SignKey\022\024\n\014workspace_id\030\001 \001(\t\022\021\n"
-  "\tthreshold\030\002 \001(\005\022\021\n\tn_parties\030\003 \001(\005\022B\n\013l"
-  "ocal_party\030\005 \001(\0132-.safeheron.proto.multi"
-  "_party_ecdsa.Li24.Party\022E\n\016remote_partie"
-  "s\030\006 \003(\0132-.safeheron.proto.multi_party_ec"
-  "dsa.Li24.Party\022(\n\003g_x\030\007 \001(\0132\033.safeheron."
-  "proto.CurvePointb\006proto3"
+  "paillier.proto\".\n\tPRGCursor\022\017\n\007version\030\001"
+  " \001(\005\022\020\n\010position\030\002 \001(\004\"\346\001\n\005Party\022\020\n\010part"
+  "y_id\030\001 \001(\t\022\r\n\005index\030\003 \001(\t\022\t\n\001x\030\010 \001(\t\022(\n\003"
+  "g_x\030\t \001(\0132\033.safeheron.proto.CurvePoint\022\014"
+  "\n\004seed\030\n \003(\t\022E\n\nprg_cursor\030\013 \001(\01321.safeh"
+  "eron.proto.multi_party_ecdsa.Li24.PRGCur"
+  "sor\022\021\n\tindex_bin\030\014 \001(\014\022\r\n\005x_bin\030\r \001(\014\022\020\n"
+  "\010seed_bin\030\016 \003(\014\"\242\002\n\007SignKey\022\024\n\014workspace"
+  "_id\030\001 \001(\t\022\021\n\tthreshold\030\002 \001(\005\022\021\n\tn_partie"
+  "s\030\003 \001(\005\022B\n\013local_party\030\005 \001(\0132-.safeheron"
+  ".proto.multi_party_ecdsa.Li24.Party\022E\n\016r"
+  "emote_parties\030\006 \003(\0132-.safeheron.proto.mu"
+  "lti_party_ecdsa.Li24.Party\022(\n\003g_x\030\007 \001(\0132"
+  "\033.safeheron.proto.CurvePoint\022\020\n\010prg_type"
+  "\030\010 \001(\005\022\024\n\014wire_version\030\t \001(\005b\006proto3"
   ;
 static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_Li24_2fstruct_2eproto_deps[2] = {
   &::descriptor_table_curve_5fpoint_2eproto,
   &::descriptor_table_paillier_2eproto,
 };
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_Li24_2fstruct_2eproto_sccs[2] = {
+static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_Li24_2fstruct_2eproto_sccs[3] = {
+  &scc_info_PRGCursor_Li24_2fstruct_2eproto.base,
   &scc_info_Party_Li24_2fstruct_2eproto.base,
   &scc_info_SignKey_Li24_2fstruct_2eproto.base,
 };
 static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_Li24_2fstruct_2eproto_once;
 const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_Li24_2fstruct_2eproto = {
-  false, false, descriptor_table_protodef_Li24_2fstruct_2eproto, "Li24/struct.proto", 464,
-  &descriptor_table_Li24_2fstruct_2eproto_once, descriptor_table_Li24_2fstruct_2eproto_sccs, descriptor_table_Li24_2fstruct_2eproto_deps, 2, 2,
+  false, false, descriptor_table_protodef_Li24_2fstruct_2eproto, "Li24/struct.proto", 676,
+  &descriptor_table_Li24_2fstruct_2eproto_once, descriptor_table_Li24_2fstruct_2eproto_sccs, descriptor_table_Li24_2fstruct_2eproto_deps, 3, 2,
   schemas, file_default_instances, TableStruct_Li24_2fstruct_2eproto::offsets,
-  file_level_metadata_Li24_2fstruct_2eproto, 2, file_level_enum_descriptors_Li24_2fstruct_2eproto, file_level_service_descriptors_Li24_2fstruct_2eproto,
+  file_level_metadata_Li24_2fstruct_2eproto, 3, file_level_enum_descriptors_Li24_2fstruct_2eproto, file_level_service_descriptors_Li24_2fstruct_2eproto,
 };
 
 // Force running AddDescriptors() at dynamic initialization time.
@@ -135,17 +175,251 @@ namespace proto {
 namespace multi_party_ecdsa {
 namespace Li24 {
 
+// ===================================================================
+
+class PRGCursor::_Internal {
+ public:
+};
+
+PRGCursor::PRGCursor(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:safeheron.proto.multi_party_ecdsa.Li24.PRGCursor)
+}
+PRGCursor::PRGCursor(const PRGCursor& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&version_, &from.version_,
+    static_cast<size_t>(reinterpret_cast<char*>(&position_) -
+    reinterpret_cast<char*>(&version_)) + sizeof(position_));
+  // @@protoc_insertion_point(copy_constructor:safeheron.proto.multi_party_ecdsa.Li24.PRGCursor)
+}
+
+void PRGCursor::SharedCtor() {
+  ::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
+      reinterpret_cast<char*>(&version_) - reinterpret_cast<char*>(this)),
+      0, static_cast<size_t>(reinterpret_cast<char*>(&position_) -
+      reinterpret_cast<char*>(&version_)) + sizeof(position_));
+}
+
+PRGCursor::~PRGCursor() {
+  // @@protoc_insertion_point(destructor:safeheron.proto.multi_party_ecdsa.Li24.PRGCursor)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void PRGCursor::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void PRGCursor::ArenaDtor(void* object) {
+  PRGCursor* _this = reinterpret_cast< PRGCursor* >(object);
+  (void)_this;
+}
+void PRGCursor::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void PRGCursor::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const PRGCursor& PRGCursor::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_PRGCursor_Li24_2fstruct_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void PRGCursor::Clear() {
+// @@protoc_insertion_point(message_clear_start:safeheron.proto.multi_party_ecdsa.Li24.PRGCursor)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&version_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&position_) -
+      reinterpret_cast<char*>(&version_)) + sizeof(position_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PRGCursor::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // int32 version = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 8)) {
+          version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint64 position = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 16)) {
+          position_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* PRGCursor::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:safeheron.proto.multi_party_ecdsa.Li24.PRGCursor)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 version = 1;
+  if (this->version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(1, this->_internal_version(), target);
+  }
+
+  // uint64 position = 2;
+  if (this->position() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(2, this->_internal_position(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:safeheron.proto.multi_party_ecdsa.Li24.PRGCursor)
+  return target;
+}
+
+size_t PRGCursor::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:safeheron.proto.multi_party_ecdsa.Li24.PRGCursor)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 version = 1;
+  if (this->version() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_version());
+  }
+
+  // uint64 position = 2;
+  if (this->position() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
+        this->_internal_position());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void PRGCursor::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:safeheron.proto.multi_party_ecdsa.Li24.PRGCursor)
+  GOOGLE_DCHECK_NE(&from, this);
+  const PRGCursor* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<PRGCursor>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:safeheron.proto.multi_party_ecdsa.Li24.PRGCursor)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:safeheron.proto.multi_party_ecdsa.Li24.PRGCursor)
+    MergeFrom(*source);
+  }
+}
+
+void PRGCursor::MergeFrom(const PRGCursor& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:safeheron.proto.multi_party_ecdsa.Li24.PRGCursor)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.version() != 0) {
+    _internal_set_version(from._internal_version());
+  }
+  if (from.position() != 0) {
+    _internal_set_position(from._internal_position());
+  }
+}
+
+void PRGCursor::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:safeheron.proto.multi_party_ecdsa.Li24.PRGCursor)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void PRGCursor::CopyFrom(const PRGCursor& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:safeheron.proto.multi_party_ecdsa.Li24.PRGCursor)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PRGCursor::IsInitialized() const {
+  return true;
+}
+
+void PRGCursor::InternalSwap(PRGCursor* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PRGCursor, position_)
+      + sizeof(PRGCursor::position_)
+      - PROTOBUF_FIELD_OFFSET(PRGCursor, version_)>(
+          reinterpret_cast<char*>(&version_),
+          reinterpret_cast<char*>(&other->version_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PRGCursor::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
 // ===================================================================
 
 class Party::_Internal {
  public:
   static const ::safeheron::proto::CurvePoint& g_x(const Party* msg);
+  static const ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor& prg_cursor(const Party* msg);
 };
 
 const ::safeheron::proto::CurvePoint&
 Party::_Internal::g_x(const Party* msg) {
   return *msg->g_x_;
 }
+const ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor&
+Party::_Internal::prg_cursor(const Party* msg) {
+  return *msg->prg_cursor_;
+}
 void Party::clear_g_x() {
   if (GetArena() == nullptr && g_x_ != nullptr) {
     delete g_x_;
@@ -154,14 +428,16 @@ void Party::clear_g_x() {
 }
 Party::Party(::PROTOBUF_NAMESPACE_ID::Arena* arena)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena),
-  seed_(arena) {
+  seed_(arena),
+  seed_bin_(arena) {
   SharedCtor();
   RegisterArenaDtor(arena);
   // @@protoc_insertion_point(arena_constructor:safeheron.proto.multi_party_ecdsa.Li24.Party)
 }
 Party::Party(const Party& from)
   : ::PROTOBUF_NAMESPACE_ID::Message(),
-      seed_(from.seed_) {
+      seed_(from.seed_),
+      seed_bin_(from.seed_bin_) {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   party_id_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
   if (!from._internal_party_id().empty()) {
@@ -178,11 +454,26 @@ Party::Party(const Party& from)
     x_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_x(), 
       GetArena());
   }
+  index_bin_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_index_bin().empty()) {
+    index_bin_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_index_bin(), 
+      GetArena());
+  }
+  x_bin_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_x_bin().empty()) {
+    x_bin_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_x_bin(), 
+      GetArena());
+  }
   if (from._internal_has_g_x()) {
     g_x_ = new ::safeheron::proto::CurvePoint(*from.g_x_);
   } else {
     g_x_ = nullptr;
   }
+  if (from._internal_has_prg_cursor()) {
+    prg_cursor_ = new ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor(*from.prg_cursor_);
+  } else {
+    prg_cursor_ = nullptr;
+  }
   // @@protoc_insertion_point(copy_constructor:safeheron.proto.multi_party_ecdsa.Li24.Party)
 }
 
@@ -191,7 +482,12 @@ void Party::SharedCtor() {
   party_id_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
   index_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
   x_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
-  g_x_ = nullptr;
+  index_bin_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  x_bin_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  ::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
+      reinterpret_cast<char*>(&g_x_) - reinterpret_cast<char*>(this)),
+      0, static_cast<size_t>(reinterpret_cast<char*>(&prg_cursor_) -
+      reinterpret_cast<char*>(&g_x_)) + sizeof(prg_cursor_));
 }
 
 Party::~Party() {
@@ -205,7 +501,10 @@ void Party::SharedDtor() {
   party_id_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
   index_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
   x_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  index_bin_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  x_bin_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
   if (this != internal_default_instance()) delete g_x_;
+  if (this != internal_default_instance()) delete prg_cursor_;
 }
 
 void Party::ArenaDtor(void* object) {
@@ -230,13 +529,20 @@ void Party::Clear() {
   (void) cached_has_bits;
 
   seed_.Clear();
+  seed_bin_.Clear();
   party_id_.ClearToEmpty();
   index_.ClearToEmpty();
   x_.ClearToEmpty();
+  index_bin_.ClearToEmpty();
+  x_bin_.ClearToEmpty();
   if (GetArena() == nullptr && g_x_ != nullptr) {
     delete g_x_;
   }
   g_x_ = nullptr;
+  if (GetArena() == nullptr && prg_cursor_ != nullptr) {
+    delete prg_cursor_;
+  }
+  prg_cursor_ = nullptr;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -295,6 +601,42 @@ const char* Party::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::inte
           } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<82>(ptr));
         } else goto handle_unusual;
         continue;
+      // .safeheron.proto.multi_party_ecdsa.Li24.PRGCursor prg_cursor = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_prg_cursor(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // bytes index_bin = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 98)) {
+          auto str = _internal_mutable_index_bin();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // bytes x_bin = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 106)) {
+          auto str = _internal_mutable_x_bin();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated bytes seed_bin = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 114)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_seed_bin();
+            ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<114>(ptr));
+        } else goto handle_unusual;
+        continue;
       default: {
       handle_unusual:
         if ((tag & 7) == 4 || tag == 0) {
@@ -371,6 +713,32 @@ failure:
     target = stream->WriteString(10, s, target);
   }
 
+  // .safeheron.proto.multi_party_ecdsa.Li24.PRGCursor prg_cursor = 11;
+  if (this->has_prg_cursor()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        11, _Internal::prg_cursor(this), target, stream);
+  }
+
+  // bytes index_bin = 12;
+  if (this->index_bin().size() > 0) {
+    target = stream->WriteBytesMaybeAliased(
+        12, this->_internal_index_bin(), target);
+  }
+
+  // bytes x_bin = 13;
+  if (this->x_bin().size() > 0) {
+    target = stream->WriteBytesMaybeAliased(
+        13, this->_internal_x_bin(), target);
+  }
+
+  // repeated bytes seed_bin = 14;
+  for (int i = 0, n = this->_internal_seed_bin_size(); i < n; i++) {
+    const auto& s = this->_internal_seed_bin(i);
+    target = stream->WriteBytes(14, s, target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -395,6 +763,14 @@ size_t Party::ByteSizeLong() const {
       seed_.Get(i));
   }
 
+  // repeated bytes seed_bin = 14;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(seed_bin_.size());
+  for (int i = 0, n = seed_bin_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      seed_bin_.Get(i));
+  }
+
   // string party_id = 1;
   if (this->party_id().size() > 0) {
     total_size += 1 +
@@ -416,6 +792,20 @@ size_t Party::ByteSizeLong() const {
         this->_internal_x());
   }
 
+  // bytes index_bin = 12;
+  if (this->index_bin().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_index_bin());
+  }
+
+  // bytes x_bin = 13;
+  if (this->x_bin().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_x_bin());
+  }
+
   // .safeheron.proto.CurvePoint g_x = 9;
   if (this->has_g_x()) {
     total_size += 1 +
@@ -423,6 +813,13 @@ size_t Party::ByteSizeLong() const {
         *g_x_);
   }
 
+  // .safeheron.proto.multi_party_ecdsa.Li24.PRGCursor prg_cursor = 11;
+  if (this->has_prg_cursor()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *prg_cursor_);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
         _internal_metadata_, total_size, &_cached_size_);
@@ -455,6 +852,7 @@ void Party::MergeFrom(const Party& from) {
   (void) cached_has_bits;
 
   seed_.MergeFrom(from.seed_);
+  seed_bin_.MergeFrom(from.seed_bin_);
   if (from.party_id().size() > 0) {
     _internal_set_party_id(from._internal_party_id());
   }
@@ -464,9 +862,18 @@ void Party::MergeFrom(const Party& from) {
   if (from.x().size() > 0) {
     _internal_set_x(from._internal_x());
   }
+  if (from.index_bin().size() > 0) {
+    _internal_set_index_bin(from._internal_index_bin());
+  }
+  if (from.x_bin().size() > 0) {
+    _internal_set_x_bin(from._internal_x_bin());
+  }
   if (from.has_g_x()) {
     _internal_mutable_g_x()->::safeheron::proto::CurvePoint::MergeFrom(from._internal_g_x());
   }
+  if (from.has_prg_cursor()) {
+    _internal_mutable_prg_cursor()->::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor::MergeFrom(from._internal_prg_cursor());
+  }
 }
 
 void Party::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
@@ -491,10 +898,18 @@ void Party::InternalSwap(Party* other) {
   using std::swap;
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
   seed_.InternalSwap(&other->seed_);
+  seed_bin_.InternalSwap(&other->seed_bin_);
   party_id_.Swap(&other->party_id_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
   index_.Swap(&other->index_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
   x_.Swap(&other->x_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-  swap(g_x_, other->g_x_);
+  index_bin_.Swap(&other->index_bin_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  x_bin_.Swap(&other->x_bin_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Party, prg_cursor_)
+      + sizeof(Party::prg_cursor_)
+      - PROTOBUF_FIELD_OFFSET(Party, g_x_)>(
+          reinterpret_cast<char*>(&g_x_),
+          reinterpret_cast<char*>(&other->g_x_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Party::GetMetadata() const {
@@ -551,8 +966,8 @@ SignKey::SignKey(const SignKey& from)
     g_x_ = nullptr;
   }
   ::memcpy(&threshold_, &from.threshold_,
-    static_cast<size_t>(reinterpret_cast<char*>(&n_parties_) -
-    reinterpret_cast<char*>(&threshold_)) + sizeof(n_parties_));
+    static_cast<size_t>(reinterpret_cast<char*>(&wire_version_) -
+    reinterpret_cast<char*>(&threshold_)) + sizeof(wire_version_));
   // @@protoc_insertion_point(copy_constructor:safeheron.proto.multi_party_ecdsa.Li24.SignKey)
 }
 
@@ -561,8 +976,8 @@ void SignKey::SharedCtor() {
   workspace_id_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
   ::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
       reinterpret_cast<char*>(&local_party_) - reinterpret_cast<char*>(this)),
-      0, static_cast<size_t>(reinterpret_cast<char*>(&n_parties_) -
-      reinterpret_cast<char*>(&local_party_)) + sizeof(n_parties_));
+      0, static_cast<size_t>(reinterpret_cast<char*>(&wire_version_) -
+      reinterpret_cast<char*>(&local_party_)) + sizeof(wire_version_));
 }
 
 SignKey::~SignKey() {
@@ -610,8 +1025,8 @@ void SignKey::Clear() {
   }
   g_x_ = nullptr;
   ::memset(&threshold_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&n_parties_) -
-      reinterpret_cast<char*>(&threshold_)) + sizeof(n_parties_));
+      reinterpret_cast<char*>(&wire_version_) -
+      reinterpret_cast<char*>(&threshold_)) + sizeof(wire_version_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -671,6 +1086,20 @@ const char* SignKey::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::in
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
+      // int32 prg_type = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 64)) {
+          prg_type_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // int32 wire_version = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 72)) {
+          wire_version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
       default: {
       handle_unusual:
         if ((tag & 7) == 4 || tag == 0) {
@@ -745,6 +1174,18 @@ failure:
         7, _Internal::g_x(this), target, stream);
   }
 
+  // int32 prg_type = 8;
+  if (this->prg_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(8, this->_internal_prg_type(), target);
+  }
+
+  // int32 wire_version = 9;
+  if (this->wire_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteInt32ToArray(9, this->_internal_wire_version(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -803,6 +1244,20 @@ size_t SignKey::ByteSizeLong() const {
         this->_internal_n_parties());
   }
 
+  // int32 prg_type = 8;
+  if (this->prg_type() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_prg_type());
+  }
+
+  // int32 wire_version = 9;
+  if (this->wire_version() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::Int32Size(
+        this->_internal_wire_version());
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
         _internal_metadata_, total_size, &_cached_size_);
@@ -850,6 +1305,12 @@ void SignKey::MergeFrom(const SignKey& from) {
   if (from.n_parties() != 0) {
     _internal_set_n_parties(from._internal_n_parties());
   }
+  if (from.prg_type() != 0) {
+    _internal_set_prg_type(from._internal_prg_type());
+  }
+  if (from.wire_version() != 0) {
+    _internal_set_wire_version(from._internal_wire_version());
+  }
 }
 
 void SignKey::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
@@ -876,8 +1337,8 @@ void SignKey::InternalSwap(SignKey* other) {
   remote_parties_.InternalSwap(&other->remote_parties_);
   workspace_id_.Swap(&other->workspace_id_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(SignKey, n_parties_)
-      + sizeof(SignKey::n_parties_)
+      PROTOBUF_FIELD_OFFSET(SignKey, wire_version_)
+      + sizeof(SignKey::wire_version_)
       - PROTOBUF_FIELD_OFFSET(SignKey, local_party_)>(
           reinterpret_cast<char*>(&local_party_),
           reinterpret_cast<char*>(&other->local_party_));
@@ -894,6 +1355,9 @@ void SignKey::InternalSwap(SignKey* other) {
 }  // namespace proto
 }  // namespace safeheron
 PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor* Arena::CreateMaybeMessage< ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor >(arena);
+}
 template<> PROTOBUF_NOINLINE ::safeheron::proto::multi_party_ecdsa::Li24::Party* Arena::CreateMaybeMessage< ::safeheron::proto::multi_party_ecdsa::Li24::Party >(Arena* arena) {
   return Arena::CreateMessageInternal< ::safeheron::proto::multi_party_ecdsa::Li24::Party >(arena);
 }
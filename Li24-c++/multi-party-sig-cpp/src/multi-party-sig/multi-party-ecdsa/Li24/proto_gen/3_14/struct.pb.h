@@ -48,7 +48,7 @@ struct TableStruct_Li24_2fstruct_2eproto {
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
   static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[2]
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[3]
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
   static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
   static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
@@ -59,6 +59,9 @@ namespace safeheron {
 namespace proto {
 namespace multi_party_ecdsa {
 namespace Li24 {
+class PRGCursor;
+class PRGCursorDefaultTypeInternal;
+extern PRGCursorDefaultTypeInternal _PRGCursor_default_instance_;
 class Party;
 class PartyDefaultTypeInternal;
 extern PartyDefaultTypeInternal _Party_default_instance_;
@@ -70,6 +73,7 @@ extern SignKeyDefaultTypeInternal _SignKey_default_instance_;
 }  // namespace proto
 }  // namespace safeheron
 PROTOBUF_NAMESPACE_OPEN
+template<> ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor* Arena::CreateMaybeMessage<::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor>(Arena*);
 template<> ::safeheron::proto::multi_party_ecdsa::Li24::Party* Arena::CreateMaybeMessage<::safeheron::proto::multi_party_ecdsa::Li24::Party>(Arena*);
 template<> ::safeheron::proto::multi_party_ecdsa::Li24::SignKey* Arena::CreateMaybeMessage<::safeheron::proto::multi_party_ecdsa::Li24::SignKey>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
@@ -80,6 +84,153 @@ namespace Li24 {
 
 // ===================================================================
 
+class PRGCursor PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:safeheron.proto.multi_party_ecdsa.Li24.PRGCursor) */ {
+ public:
+  inline PRGCursor() : PRGCursor(nullptr) {}
+  virtual ~PRGCursor();
+
+  PRGCursor(const PRGCursor& from);
+  PRGCursor(PRGCursor&& from) noexcept
+    : PRGCursor() {
+    *this = ::std::move(from);
+  }
+
+  inline PRGCursor& operator=(const PRGCursor& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PRGCursor& operator=(PRGCursor&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const PRGCursor& default_instance();
+
+  static inline const PRGCursor* internal_default_instance() {
+    return reinterpret_cast<const PRGCursor*>(
+               &_PRGCursor_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(PRGCursor& a, PRGCursor& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PRGCursor* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PRGCursor* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline PRGCursor* New() const final {
+    return CreateMaybeMessage<PRGCursor>(nullptr);
+  }
+
+  PRGCursor* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<PRGCursor>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const PRGCursor& from);
+  void MergeFrom(const PRGCursor& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PRGCursor* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "safeheron.proto.multi_party_ecdsa.Li24.PRGCursor";
+  }
+  protected:
+  explicit PRGCursor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_Li24_2fstruct_2eproto);
+    return ::descriptor_table_Li24_2fstruct_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kVersionFieldNumber = 1,
+    kPositionFieldNumber = 2,
+  };
+  // int32 version = 1;
+  void clear_version();
+  ::PROTOBUF_NAMESPACE_ID::int32 version() const;
+  void set_version(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_version() const;
+  void _internal_set_version(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // uint64 position = 2;
+  void clear_position();
+  ::PROTOBUF_NAMESPACE_ID::uint64 position() const;
+  void set_position(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_position() const;
+  void _internal_set_position(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:safeheron.proto.multi_party_ecdsa.Li24.PRGCursor)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::int32 version_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 position_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_Li24_2fstruct_2eproto;
+};
+// -------------------------------------------------------------------
+
 class Party PROTOBUF_FINAL :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:safeheron.proto.multi_party_ecdsa.Li24.Party) */ {
  public:
@@ -121,7 +272,7 @@ class Party PROTOBUF_FINAL :
                &_Party_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    0;
+    1;
 
   friend void swap(Party& a, Party& b) {
     a.Swap(&b);
@@ -193,10 +344,14 @@ class Party PROTOBUF_FINAL :
 
   enum : int {
     kSeedFieldNumber = 10,
+    kSeedBinFieldNumber = 14,
     kPartyIdFieldNumber = 1,
     kIndexFieldNumber = 3,
     kXFieldNumber = 8,
+    kIndexBinFieldNumber = 12,
+    kXBinFieldNumber = 13,
     kGXFieldNumber = 9,
+    kPrgCursorFieldNumber = 11,
   };
   // repeated string seed = 10;
   int seed_size() const;
@@ -222,6 +377,30 @@ class Party PROTOBUF_FINAL :
   std::string* _internal_add_seed();
   public:
 
+  // repeated bytes seed_bin = 14;
+  int seed_bin_size() const;
+  private:
+  int _internal_seed_bin_size() const;
+  public:
+  void clear_seed_bin();
+  const std::string& seed_bin(int index) const;
+  std::string* mutable_seed_bin(int index);
+  void set_seed_bin(int index, const std::string& value);
+  void set_seed_bin(int index, std::string&& value);
+  void set_seed_bin(int index, const char* value);
+  void set_seed_bin(int index, const void* value, size_t size);
+  std::string* add_seed_bin();
+  void add_seed_bin(const std::string& value);
+  void add_seed_bin(std::string&& value);
+  void add_seed_bin(const char* value);
+  void add_seed_bin(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& seed_bin() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_seed_bin();
+  private:
+  const std::string& _internal_seed_bin(int index) const;
+  std::string* _internal_add_seed_bin();
+  public:
+
   // string party_id = 1;
   void clear_party_id();
   const std::string& party_id() const;
@@ -270,6 +449,38 @@ class Party PROTOBUF_FINAL :
   std::string* _internal_mutable_x();
   public:
 
+  // bytes index_bin = 12;
+  void clear_index_bin();
+  const std::string& index_bin() const;
+  void set_index_bin(const std::string& value);
+  void set_index_bin(std::string&& value);
+  void set_index_bin(const char* value);
+  void set_index_bin(const void* value, size_t size);
+  std::string* mutable_index_bin();
+  std::string* release_index_bin();
+  void set_allocated_index_bin(std::string* index_bin);
+  private:
+  const std::string& _internal_index_bin() const;
+  void _internal_set_index_bin(const std::string& value);
+  std::string* _internal_mutable_index_bin();
+  public:
+
+  // bytes x_bin = 13;
+  void clear_x_bin();
+  const std::string& x_bin() const;
+  void set_x_bin(const std::string& value);
+  void set_x_bin(std::string&& value);
+  void set_x_bin(const char* value);
+  void set_x_bin(const void* value, size_t size);
+  std::string* mutable_x_bin();
+  std::string* release_x_bin();
+  void set_allocated_x_bin(std::string* x_bin);
+  private:
+  const std::string& _internal_x_bin() const;
+  void _internal_set_x_bin(const std::string& value);
+  std::string* _internal_mutable_x_bin();
+  public:
+
   // .safeheron.proto.CurvePoint g_x = 9;
   bool has_g_x() const;
   private:
@@ -288,6 +499,24 @@ class Party PROTOBUF_FINAL :
       ::safeheron::proto::CurvePoint* g_x);
   ::safeheron::proto::CurvePoint* unsafe_arena_release_g_x();
 
+  // .safeheron.proto.multi_party_ecdsa.Li24.PRGCursor prg_cursor = 11;
+  bool has_prg_cursor() const;
+  private:
+  bool _internal_has_prg_cursor() const;
+  public:
+  void clear_prg_cursor();
+  const ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor& prg_cursor() const;
+  ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor* release_prg_cursor();
+  ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor* mutable_prg_cursor();
+  void set_allocated_prg_cursor(::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor* prg_cursor);
+  private:
+  const ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor& _internal_prg_cursor() const;
+  ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor* _internal_mutable_prg_cursor();
+  public:
+  void unsafe_arena_set_allocated_prg_cursor(
+      ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor* prg_cursor);
+  ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor* unsafe_arena_release_prg_cursor();
+
   // @@protoc_insertion_point(class_scope:safeheron.proto.multi_party_ecdsa.Li24.Party)
  private:
   class _Internal;
@@ -296,10 +525,14 @@ class Party PROTOBUF_FINAL :
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
   ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> seed_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> seed_bin_;
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr party_id_;
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr index_;
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr x_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr index_bin_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr x_bin_;
   ::safeheron::proto::CurvePoint* g_x_;
+  ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor* prg_cursor_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_Li24_2fstruct_2eproto;
 };
@@ -346,7 +579,7 @@ class SignKey PROTOBUF_FINAL :
                &_SignKey_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    1;
+    2;
 
   friend void swap(SignKey& a, SignKey& b) {
     a.Swap(&b);
@@ -423,6 +656,8 @@ class SignKey PROTOBUF_FINAL :
     kGXFieldNumber = 7,
     kThresholdFieldNumber = 2,
     kNPartiesFieldNumber = 3,
+    kPrgTypeFieldNumber = 8,
+    kWireVersionFieldNumber = 9,
   };
   // repeated .safeheron.proto.multi_party_ecdsa.Li24.Party remote_parties = 6;
   int remote_parties_size() const;
@@ -512,6 +747,24 @@ class SignKey PROTOBUF_FINAL :
   void _internal_set_n_parties(::PROTOBUF_NAMESPACE_ID::int32 value);
   public:
 
+  // int32 prg_type = 8;
+  void clear_prg_type();
+  ::PROTOBUF_NAMESPACE_ID::int32 prg_type() const;
+  void set_prg_type(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_prg_type() const;
+  void _internal_set_prg_type(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
+  // int32 wire_version = 9;
+  void clear_wire_version();
+  ::PROTOBUF_NAMESPACE_ID::int32 wire_version() const;
+  void set_wire_version(::PROTOBUF_NAMESPACE_ID::int32 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::int32 _internal_wire_version() const;
+  void _internal_set_wire_version(::PROTOBUF_NAMESPACE_ID::int32 value);
+  public:
+
   // @@protoc_insertion_point(class_scope:safeheron.proto.multi_party_ecdsa.Li24.SignKey)
  private:
   class _Internal;
@@ -525,6 +778,8 @@ class SignKey PROTOBUF_FINAL :
   ::safeheron::proto::CurvePoint* g_x_;
   ::PROTOBUF_NAMESPACE_ID::int32 threshold_;
   ::PROTOBUF_NAMESPACE_ID::int32 n_parties_;
+  ::PROTOBUF_NAMESPACE_ID::int32 prg_type_;
+  ::PROTOBUF_NAMESPACE_ID::int32 wire_version_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_Li24_2fstruct_2eproto;
 };
@@ -537,6 +792,50 @@ class SignKey PROTOBUF_FINAL :
   #pragma GCC diagnostic push
   #pragma GCC diagnostic ignored "-Wstrict-aliasing"
 #endif  // __GNUC__
+// PRGCursor
+
+// int32 version = 1;
+inline void PRGCursor::clear_version() {
+  version_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 PRGCursor::_internal_version() const {
+  return version_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 PRGCursor::version() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.PRGCursor.version)
+  return _internal_version();
+}
+inline void PRGCursor::_internal_set_version(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  version_ = value;
+}
+inline void PRGCursor::set_version(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.PRGCursor.version)
+}
+
+// uint64 position = 2;
+inline void PRGCursor::clear_position() {
+  position_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 PRGCursor::_internal_position() const {
+  return position_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 PRGCursor::position() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.PRGCursor.position)
+  return _internal_position();
+}
+inline void PRGCursor::_internal_set_position(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  position_ = value;
+}
+inline void PRGCursor::set_position(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_position(value);
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.PRGCursor.position)
+}
+
+// -------------------------------------------------------------------
+
 // Party
 
 // string party_id = 1;
@@ -873,6 +1172,285 @@ Party::mutable_seed() {
   return &seed_;
 }
 
+// .safeheron.proto.multi_party_ecdsa.Li24.PRGCursor prg_cursor = 11;
+inline bool Party::_internal_has_prg_cursor() const {
+  return this != internal_default_instance() && prg_cursor_ != nullptr;
+}
+inline bool Party::has_prg_cursor() const {
+  return _internal_has_prg_cursor();
+}
+inline void Party::clear_prg_cursor() {
+  if (GetArena() == nullptr && prg_cursor_ != nullptr) {
+    delete prg_cursor_;
+  }
+  prg_cursor_ = nullptr;
+}
+inline const ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor& Party::_internal_prg_cursor() const {
+  const ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor* p = prg_cursor_;
+  return p != nullptr ? *p : reinterpret_cast<const ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor&>(
+      ::safeheron::proto::multi_party_ecdsa::Li24::_PRGCursor_default_instance_);
+}
+inline const ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor& Party::prg_cursor() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.Party.prg_cursor)
+  return _internal_prg_cursor();
+}
+inline void Party::unsafe_arena_set_allocated_prg_cursor(
+    ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor* prg_cursor) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(prg_cursor_);
+  }
+  prg_cursor_ = prg_cursor;
+  if (prg_cursor) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.Party.prg_cursor)
+}
+inline ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor* Party::release_prg_cursor() {
+  
+  ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor* temp = prg_cursor_;
+  prg_cursor_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor* Party::unsafe_arena_release_prg_cursor() {
+  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.Party.prg_cursor)
+  
+  ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor* temp = prg_cursor_;
+  prg_cursor_ = nullptr;
+  return temp;
+}
+inline ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor* Party::_internal_mutable_prg_cursor() {
+  
+  if (prg_cursor_ == nullptr) {
+    auto* p = CreateMaybeMessage<::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor>(GetArena());
+    prg_cursor_ = p;
+  }
+  return prg_cursor_;
+}
+inline ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor* Party::mutable_prg_cursor() {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.Party.prg_cursor)
+  return _internal_mutable_prg_cursor();
+}
+inline void Party::set_allocated_prg_cursor(::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor* prg_cursor) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete prg_cursor_;
+  }
+  if (prg_cursor) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(prg_cursor);
+    if (message_arena != submessage_arena) {
+      prg_cursor = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, prg_cursor, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  prg_cursor_ = prg_cursor;
+  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.Party.prg_cursor)
+}
+
+// bytes index_bin = 12;
+inline void Party::clear_index_bin() {
+  index_bin_.ClearToEmpty();
+}
+inline const std::string& Party::index_bin() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.Party.index_bin)
+  return _internal_index_bin();
+}
+inline void Party::set_index_bin(const std::string& value) {
+  _internal_set_index_bin(value);
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.Party.index_bin)
+}
+inline std::string* Party::mutable_index_bin() {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.Party.index_bin)
+  return _internal_mutable_index_bin();
+}
+inline const std::string& Party::_internal_index_bin() const {
+  return index_bin_.Get();
+}
+inline void Party::_internal_set_index_bin(const std::string& value) {
+  
+  index_bin_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+}
+inline void Party::set_index_bin(std::string&& value) {
+  
+  index_bin_.Set(
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:safeheron.proto.multi_party_ecdsa.Li24.Party.index_bin)
+}
+inline void Party::set_index_bin(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  index_bin_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
+  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.Party.index_bin)
+}
+inline void Party::set_index_bin(const void* value,
+    size_t size) {
+  
+  index_bin_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.Party.index_bin)
+}
+inline std::string* Party::_internal_mutable_index_bin() {
+  
+  return index_bin_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+}
+inline std::string* Party::release_index_bin() {
+  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.Party.index_bin)
+  return index_bin_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void Party::set_allocated_index_bin(std::string* index_bin) {
+  if (index_bin != nullptr) {
+    
+  } else {
+    
+  }
+  index_bin_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), index_bin,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.Party.index_bin)
+}
+
+// bytes x_bin = 13;
+inline void Party::clear_x_bin() {
+  x_bin_.ClearToEmpty();
+}
+inline const std::string& Party::x_bin() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.Party.x_bin)
+  return _internal_x_bin();
+}
+inline void Party::set_x_bin(const std::string& value) {
+  _internal_set_x_bin(value);
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.Party.x_bin)
+}
+inline std::string* Party::mutable_x_bin() {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.Party.x_bin)
+  return _internal_mutable_x_bin();
+}
+inline const std::string& Party::_internal_x_bin() const {
+  return x_bin_.Get();
+}
+inline void Party::_internal_set_x_bin(const std::string& value) {
+  
+  x_bin_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+}
+inline void Party::set_x_bin(std::string&& value) {
+  
+  x_bin_.Set(
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:safeheron.proto.multi_party_ecdsa.Li24.Party.x_bin)
+}
+inline void Party::set_x_bin(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  x_bin_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
+  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.Party.x_bin)
+}
+inline void Party::set_x_bin(const void* value,
+    size_t size) {
+  
+  x_bin_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.Party.x_bin)
+}
+inline std::string* Party::_internal_mutable_x_bin() {
+  
+  return x_bin_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+}
+inline std::string* Party::release_x_bin() {
+  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.Party.x_bin)
+  return x_bin_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void Party::set_allocated_x_bin(std::string* x_bin) {
+  if (x_bin != nullptr) {
+    
+  } else {
+    
+  }
+  x_bin_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), x_bin,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.Party.x_bin)
+}
+
+// repeated bytes seed_bin = 14;
+inline int Party::_internal_seed_bin_size() const {
+  return seed_bin_.size();
+}
+inline int Party::seed_bin_size() const {
+  return _internal_seed_bin_size();
+}
+inline void Party::clear_seed_bin() {
+  seed_bin_.Clear();
+}
+inline std::string* Party::add_seed_bin() {
+  // @@protoc_insertion_point(field_add_mutable:safeheron.proto.multi_party_ecdsa.Li24.Party.seed_bin)
+  return _internal_add_seed_bin();
+}
+inline const std::string& Party::_internal_seed_bin(int index) const {
+  return seed_bin_.Get(index);
+}
+inline const std::string& Party::seed_bin(int index) const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.Party.seed_bin)
+  return _internal_seed_bin(index);
+}
+inline std::string* Party::mutable_seed_bin(int index) {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.Party.seed_bin)
+  return seed_bin_.Mutable(index);
+}
+inline void Party::set_seed_bin(int index, const std::string& value) {
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.Party.seed_bin)
+  seed_bin_.Mutable(index)->assign(value);
+}
+inline void Party::set_seed_bin(int index, std::string&& value) {
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.Party.seed_bin)
+  seed_bin_.Mutable(index)->assign(std::move(value));
+}
+inline void Party::set_seed_bin(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  seed_bin_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.Party.seed_bin)
+}
+inline void Party::set_seed_bin(int index, const void* value, size_t size) {
+  seed_bin_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.Party.seed_bin)
+}
+inline std::string* Party::_internal_add_seed_bin() {
+  return seed_bin_.Add();
+}
+inline void Party::add_seed_bin(const std::string& value) {
+  seed_bin_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.Party.seed_bin)
+}
+inline void Party::add_seed_bin(std::string&& value) {
+  seed_bin_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.Party.seed_bin)
+}
+inline void Party::add_seed_bin(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  seed_bin_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:safeheron.proto.multi_party_ecdsa.Li24.Party.seed_bin)
+}
+inline void Party::add_seed_bin(const void* value, size_t size) {
+  seed_bin_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:safeheron.proto.multi_party_ecdsa.Li24.Party.seed_bin)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+Party::seed_bin() const {
+  // @@protoc_insertion_point(field_list:safeheron.proto.multi_party_ecdsa.Li24.Party.seed_bin)
+  return seed_bin_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+Party::mutable_seed_bin() {
+  // @@protoc_insertion_point(field_mutable_list:safeheron.proto.multi_party_ecdsa.Li24.Party.seed_bin)
+  return &seed_bin_;
+}
+
 // -------------------------------------------------------------------
 
 // SignKey
@@ -1177,11 +1755,53 @@ inline void SignKey::set_allocated_g_x(::safeheron::proto::CurvePoint* g_x) {
   // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.SignKey.g_x)
 }
 
+// int32 prg_type = 8;
+inline void SignKey::clear_prg_type() {
+  prg_type_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 SignKey::_internal_prg_type() const {
+  return prg_type_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 SignKey::prg_type() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.SignKey.prg_type)
+  return _internal_prg_type();
+}
+inline void SignKey::_internal_set_prg_type(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  prg_type_ = value;
+}
+inline void SignKey::set_prg_type(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_prg_type(value);
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.SignKey.prg_type)
+}
+
+// int32 wire_version = 9;
+inline void SignKey::clear_wire_version() {
+  wire_version_ = 0;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 SignKey::_internal_wire_version() const {
+  return wire_version_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::int32 SignKey::wire_version() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.SignKey.wire_version)
+  return _internal_wire_version();
+}
+inline void SignKey::_internal_set_wire_version(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  
+  wire_version_ = value;
+}
+inline void SignKey::set_wire_version(::PROTOBUF_NAMESPACE_ID::int32 value) {
+  _internal_set_wire_version(value);
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.SignKey.wire_version)
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -24,21 +24,30 @@ namespace safeheron {
 namespace proto {
 namespace multi_party_ecdsa {
 namespace Li24 {
+PROTOBUF_CONSTEXPR PRGCursor::PRGCursor(
+    ::_pbi::ConstantInitialized)
+  : position_(uint64_t{0u})
+  , version_(0){}
+struct PRGCursorDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PRGCursorDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PRGCursorDefaultTypeInternal() {}
+  union {
+    PRGCursor _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PRGCursorDefaultTypeInternal _PRGCursor_default_instance_;
 PROTOBUF_CONSTEXPR Party::Party(
     ::_pbi::ConstantInitialized)
-  : party_id_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
+  : seed_()
+  , seed_bin_()
+  , party_id_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
   , index_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
   , x_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , n_tilde_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , p_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , q_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , h1_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , h2_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , alpha_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , beta_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , pail_priv_(nullptr)
-  , pail_pub_(nullptr)
-  , g_x_(nullptr){}
+  , index_bin_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
+  , x_bin_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
+  , g_x_(nullptr)
+  , prg_cursor_(nullptr){}
 struct PartyDefaultTypeInternal {
   PROTOBUF_CONSTEXPR PartyDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -55,7 +64,9 @@ PROTOBUF_CONSTEXPR SignKey::SignKey(
   , local_party_(nullptr)
   , g_x_(nullptr)
   , threshold_(0)
-  , n_parties_(0){}
+  , n_parties_(0)
+  , prg_type_(0)
+  , wire_version_(0){}
 struct SignKeyDefaultTypeInternal {
   PROTOBUF_CONSTEXPR SignKeyDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -69,11 +80,19 @@ PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORIT
 }  // namespace multi_party_ecdsa
 }  // namespace proto
 }  // namespace safeheron
-static ::_pb::Metadata file_level_metadata_Li24_2fstruct_2eproto[2];
+static ::_pb::Metadata file_level_metadata_Li24_2fstruct_2eproto[3];
 static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_Li24_2fstruct_2eproto = nullptr;
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_Li24_2fstruct_2eproto = nullptr;
 
 const uint32_t TableStruct_Li24_2fstruct_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor, version_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor, position_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::Party, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -82,17 +101,13 @@ const uint32_t TableStruct_Li24_2fstruct_2eproto::offsets[] PROTOBUF_SECTION_VAR
   ~0u,  // no _inlined_string_donated_
   PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::Party, party_id_),
   PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::Party, index_),
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::Party, pail_priv_),
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::Party, pail_pub_),
   PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::Party, x_),
   PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::Party, g_x_),
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::Party, n_tilde_),
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::Party, p_),
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::Party, q_),
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::Party, h1_),
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::Party, h2_),
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::Party, alpha_),
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::Party, beta_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::Party, seed_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::Party, prg_cursor_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::Party, index_bin_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::Party, x_bin_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::Party, seed_bin_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::SignKey, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -105,13 +120,17 @@ const uint32_t TableStruct_Li24_2fstruct_2eproto::offsets[] PROTOBUF_SECTION_VAR
   PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::SignKey, local_party_),
   PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::SignKey, remote_parties_),
   PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::SignKey, g_x_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::SignKey, prg_type_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::SignKey, wire_version_),
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
-  { 0, -1, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::Party)},
-  { 19, -1, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::SignKey)},
+  { 0, -1, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor)},
+  { 8, -1, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::Party)},
+  { 23, -1, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::SignKey)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
+  &::safeheron::proto::multi_party_ecdsa::Li24::_PRGCursor_default_instance_._instance,
   &::safeheron::proto::multi_party_ecdsa::Li24::_Party_default_instance_._instance,
   &::safeheron::proto::multi_party_ecdsa::Li24::_SignKey_default_instance_._instance,
 };
@@ -119,20 +138,21 @@ static const ::_pb::Message* const file_default_instances[] = {
 const char descriptor_table_protodef_Li24_2fstruct_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
   "\n\021Li24/struct.proto\022&safeheron.proto.mul"
   "ti_party_ecdsa.Li24\032\021curve_point.proto\032\016"
-  "paillier.proto\"\223\002\n\005Party\022\020\n\010party_id\030\001 \001"
-  "(\t\022\r\n\005index\030\003 \001(\t\022,\n\tpail_priv\030\006 \001(\0132\031.s"
-  "afeheron.proto.PailPriv\022*\n\010pail_pub\030\007 \001("
-  "\0132\030.safeheron.proto.PailPub\022\t\n\001x\030\010 \001(\t\022("
-  "\n\003g_x\030\t \001(\0132\033.safeheron.proto.CurvePoint"
-  "\022\017\n\007N_tilde\030\n \001(\t\022\t\n\001p\030\013 \001(\t\022\t\n\001q\030\014 \001(\t\022"
-  "\n\n\002h1\030\r \001(\t\022\n\n\002h2\030\016 \001(\t\022\r\n\005alpha\030\017 \001(\t\022\014"
-  "\n\004beta\030\020 \001(\t\"\372\001\n\007SignKey\022\024\n\014workspace_id"
-  "\030\001 \001(\t\022\021\n\tthreshold\030\002 \001(\005\022\021\n\tn_parties\030\003"
-  " \001(\005\022B\n\013local_party\030\005 \001(\0132-.safeheron.pr"
-  "oto.multi_party_ecdsa.Li24.Party\022E\n\016remo"
-  "te_parties\030\006 \003(\0132-.safeheron.proto.multi"
-  "_party_ecdsa.Li24.Party\022(\n\003g_x\030\007 \001(\0132\033.s"
-  "afeheron.proto.CurvePointb\006proto3"
+  "paillier.proto\".\n\tPRGCursor\022\017\n\007version\030\001"
+  " \001(\005\022\020\n\010position\030\002 \001(\004\"\346\001\n\005Party\022\020\n\010part"
+  "y_id\030\001 \001(\t\022\r\n\005index\030\003 \001(\t\022\t\n\001x\030\010 \001(\t\022(\n\003"
+  "g_x\030\t \001(\0132\033.safeheron.proto.CurvePoint\022\014"
+  "\n\004seed\030\n \003(\t\022E\n\nprg_cursor\030\013 \001(\01321.safeh"
+  "eron.proto.multi_party_ecdsa.Li24.PRGCur"
+  "sor\022\021\n\tindex_bin\030\014 \001(\014\022\r\n\005x_bin\030\r \001(\014\022\020\n"
+  "\010seed_bin\030\016 \003(\014\"\242\002\n\007SignKey\022\024\n\014workspace"
+  "_id\030\001 \001(\t\022\021\n\tthreshold\030\002 \001(\005\022\021\n\tn_partie"
+  "s\030\003 \001(\005\022B\n\013local_party\030\005 \001(\0132-.safeheron"
+  ".proto.multi_party_ecdsa.Li24.Party\022E\n\016r"
+  "emote_parties\030\006 \003(\0132-.safeheron.proto.mu"
+  "lti_party_ecdsa.Li24.Party\022(\n\003g_x\030\007 \001(\0132"
+  "\033.safeheron.proto.CurvePoint\022\020\n\010prg_type"
+  "\030\010 \001(\005\022\024\n\014wire_version\030\t \001(\005b\006proto3"
   ;
 static const ::_pbi::DescriptorTable* const descriptor_table_Li24_2fstruct_2eproto_deps[2] = {
   &::descriptor_table_curve_5fpoint_2eproto,
@@ -140,9 +160,9 @@ static const ::_pbi::DescriptorTable* const descriptor_table_Li24_2fstruct_2epro
 };
 static ::_pbi::once_flag descriptor_table_Li24_2fstruct_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_Li24_2fstruct_2eproto = {
-    false, false, 633, descriptor_table_protodef_Li24_2fstruct_2eproto,
+    false, false, 676, descriptor_table_protodef_Li24_2fstruct_2eproto,
     "Li24/struct.proto",
-    &descriptor_table_Li24_2fstruct_2eproto_once, descriptor_table_Li24_2fstruct_2eproto_deps, 2, 2,
+    &descriptor_table_Li24_2fstruct_2eproto_once, descriptor_table_Li24_2fstruct_2eproto_deps, 2, 3,
     schemas, file_default_instances, TableStruct_Li24_2fstruct_2eproto::offsets,
     file_level_metadata_Li24_2fstruct_2eproto, file_level_enum_descriptors_Li24_2fstruct_2eproto,
     file_level_service_descriptors_Li24_2fstruct_2eproto,
@@ -160,36 +180,224 @@ namespace Li24 {
 
 // ===================================================================
 
-class Party::_Internal {
+class PRGCursor::_Internal {
  public:
-  static const ::safeheron::proto::PailPriv& pail_priv(const Party* msg);
-  static const ::safeheron::proto::PailPub& pail_pub(const Party* msg);
-  static const ::safeheron::proto::CurvePoint& g_x(const Party* msg);
 };
 
-const ::safeheron::proto::PailPriv&
-Party::_Internal::pail_priv(const Party* msg) {
-  return *msg->pail_priv_;
+PRGCursor::PRGCursor(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor();
+  // @@protoc_insertion_point(arena_constructor:safeheron.proto.multi_party_ecdsa.Li24.PRGCursor)
 }
-const ::safeheron::proto::PailPub&
-Party::_Internal::pail_pub(const Party* msg) {
-  return *msg->pail_pub_;
+PRGCursor::PRGCursor(const PRGCursor& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&position_, &from.position_,
+    static_cast<size_t>(reinterpret_cast<char*>(&version_) -
+    reinterpret_cast<char*>(&position_)) + sizeof(version_));
+  // @@protoc_insertion_point(copy_constructor:safeheron.proto.multi_party_ecdsa.Li24.PRGCursor)
 }
-const ::safeheron::proto::CurvePoint&
-Party::_Internal::g_x(const Party* msg) {
-  return *msg->g_x_;
+
+inline void PRGCursor::SharedCtor() {
+::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
+    reinterpret_cast<char*>(&position_) - reinterpret_cast<char*>(this)),
+    0, static_cast<size_t>(reinterpret_cast<char*>(&version_) -
+    reinterpret_cast<char*>(&position_)) + sizeof(version_));
 }
-void Party::clear_pail_priv() {
-  if (GetArenaForAllocation() == nullptr && pail_priv_ != nullptr) {
-    delete pail_priv_;
+
+PRGCursor::~PRGCursor() {
+  // @@protoc_insertion_point(destructor:safeheron.proto.multi_party_ecdsa.Li24.PRGCursor)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
   }
-  pail_priv_ = nullptr;
+  SharedDtor();
+}
+
+inline void PRGCursor::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void PRGCursor::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+
+void PRGCursor::Clear() {
+// @@protoc_insertion_point(message_clear_start:safeheron.proto.multi_party_ecdsa.Li24.PRGCursor)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&position_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&version_) -
+      reinterpret_cast<char*>(&position_)) + sizeof(version_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PRGCursor::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 version = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 position = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          position_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
 }
-void Party::clear_pail_pub() {
-  if (GetArenaForAllocation() == nullptr && pail_pub_ != nullptr) {
-    delete pail_pub_;
+
+uint8_t* PRGCursor::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:safeheron.proto.multi_party_ecdsa.Li24.PRGCursor)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 version = 1;
+  if (this->_internal_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_version(), target);
   }
-  pail_pub_ = nullptr;
+
+  // uint64 position = 2;
+  if (this->_internal_position() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_position(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:safeheron.proto.multi_party_ecdsa.Li24.PRGCursor)
+  return target;
+}
+
+size_t PRGCursor::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:safeheron.proto.multi_party_ecdsa.Li24.PRGCursor)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 position = 2;
+  if (this->_internal_position() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_position());
+  }
+
+  // int32 version = 1;
+  if (this->_internal_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_version());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PRGCursor::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
+    PRGCursor::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PRGCursor::GetClassData() const { return &_class_data_; }
+
+void PRGCursor::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
+                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+  static_cast<PRGCursor *>(to)->MergeFrom(
+      static_cast<const PRGCursor &>(from));
+}
+
+
+void PRGCursor::MergeFrom(const PRGCursor& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:safeheron.proto.multi_party_ecdsa.Li24.PRGCursor)
+  GOOGLE_DCHECK_NE(&from, this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_position() != 0) {
+    _internal_set_position(from._internal_position());
+  }
+  if (from._internal_version() != 0) {
+    _internal_set_version(from._internal_version());
+  }
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PRGCursor::CopyFrom(const PRGCursor& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:safeheron.proto.multi_party_ecdsa.Li24.PRGCursor)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PRGCursor::IsInitialized() const {
+  return true;
+}
+
+void PRGCursor::InternalSwap(PRGCursor* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PRGCursor, version_)
+      + sizeof(PRGCursor::version_)
+      - PROTOBUF_FIELD_OFFSET(PRGCursor, position_)>(
+          reinterpret_cast<char*>(&position_),
+          reinterpret_cast<char*>(&other->position_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PRGCursor::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_Li24_2fstruct_2eproto_getter, &descriptor_table_Li24_2fstruct_2eproto_once,
+      file_level_metadata_Li24_2fstruct_2eproto[0]);
+}
+
+// ===================================================================
+
+class Party::_Internal {
+ public:
+  static const ::safeheron::proto::CurvePoint& g_x(const Party* msg);
+  static const ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor& prg_cursor(const Party* msg);
+};
+
+const ::safeheron::proto::CurvePoint&
+Party::_Internal::g_x(const Party* msg) {
+  return *msg->g_x_;
+}
+const ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor&
+Party::_Internal::prg_cursor(const Party* msg) {
+  return *msg->prg_cursor_;
 }
 void Party::clear_g_x() {
   if (GetArenaForAllocation() == nullptr && g_x_ != nullptr) {
@@ -199,12 +407,16 @@ void Party::clear_g_x() {
 }
 Party::Party(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned),
+  seed_(arena),
+  seed_bin_(arena) {
   SharedCtor();
   // @@protoc_insertion_point(arena_constructor:safeheron.proto.multi_party_ecdsa.Li24.Party)
 }
 Party::Party(const Party& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      seed_(from.seed_),
+      seed_bin_(from.seed_bin_) {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
   party_id_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
@@ -230,77 +442,32 @@ Party::Party(const Party& from)
     x_.Set(from._internal_x(), 
       GetArenaForAllocation());
   }
-  n_tilde_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    n_tilde_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_n_tilde().empty()) {
-    n_tilde_.Set(from._internal_n_tilde(), 
-      GetArenaForAllocation());
-  }
-  p_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    p_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_p().empty()) {
-    p_.Set(from._internal_p(), 
-      GetArenaForAllocation());
-  }
-  q_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    q_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_q().empty()) {
-    q_.Set(from._internal_q(), 
-      GetArenaForAllocation());
-  }
-  h1_.InitDefault();
+  index_bin_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    h1_.Set("", GetArenaForAllocation());
+    index_bin_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_h1().empty()) {
-    h1_.Set(from._internal_h1(), 
+  if (!from._internal_index_bin().empty()) {
+    index_bin_.Set(from._internal_index_bin(), 
       GetArenaForAllocation());
   }
-  h2_.InitDefault();
+  x_bin_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    h2_.Set("", GetArenaForAllocation());
+    x_bin_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_h2().empty()) {
-    h2_.Set(from._internal_h2(), 
+  if (!from._internal_x_bin().empty()) {
+    x_bin_.Set(from._internal_x_bin(), 
       GetArenaForAllocation());
   }
-  alpha_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    alpha_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_alpha().empty()) {
-    alpha_.Set(from._internal_alpha(), 
-      GetArenaForAllocation());
-  }
-  beta_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    beta_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_beta().empty()) {
-    beta_.Set(from._internal_beta(), 
-      GetArenaForAllocation());
-  }
-  if (from._internal_has_pail_priv()) {
-    pail_priv_ = new ::safeheron::proto::PailPriv(*from.pail_priv_);
-  } else {
-    pail_priv_ = nullptr;
-  }
-  if (from._internal_has_pail_pub()) {
-    pail_pub_ = new ::safeheron::proto::PailPub(*from.pail_pub_);
-  } else {
-    pail_pub_ = nullptr;
-  }
   if (from._internal_has_g_x()) {
     g_x_ = new ::safeheron::proto::CurvePoint(*from.g_x_);
   } else {
     g_x_ = nullptr;
   }
+  if (from._internal_has_prg_cursor()) {
+    prg_cursor_ = new ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor(*from.prg_cursor_);
+  } else {
+    prg_cursor_ = nullptr;
+  }
   // @@protoc_insertion_point(copy_constructor:safeheron.proto.multi_party_ecdsa.Li24.Party)
 }
 
@@ -317,38 +484,18 @@ x_.InitDefault();
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
   x_.Set("", GetArenaForAllocation());
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-n_tilde_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  n_tilde_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-p_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  p_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-q_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  q_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-h1_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  h1_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-h2_.InitDefault();
+index_bin_.InitDefault();
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  h2_.Set("", GetArenaForAllocation());
+  index_bin_.Set("", GetArenaForAllocation());
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-alpha_.InitDefault();
+x_bin_.InitDefault();
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  alpha_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-beta_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  beta_.Set("", GetArenaForAllocation());
+  x_bin_.Set("", GetArenaForAllocation());
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 ::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-    reinterpret_cast<char*>(&pail_priv_) - reinterpret_cast<char*>(this)),
-    0, static_cast<size_t>(reinterpret_cast<char*>(&g_x_) -
-    reinterpret_cast<char*>(&pail_priv_)) + sizeof(g_x_));
+    reinterpret_cast<char*>(&g_x_) - reinterpret_cast<char*>(this)),
+    0, static_cast<size_t>(reinterpret_cast<char*>(&prg_cursor_) -
+    reinterpret_cast<char*>(&g_x_)) + sizeof(prg_cursor_));
 }
 
 Party::~Party() {
@@ -365,16 +512,10 @@ inline void Party::SharedDtor() {
   party_id_.Destroy();
   index_.Destroy();
   x_.Destroy();
-  n_tilde_.Destroy();
-  p_.Destroy();
-  q_.Destroy();
-  h1_.Destroy();
-  h2_.Destroy();
-  alpha_.Destroy();
-  beta_.Destroy();
-  if (this != internal_default_instance()) delete pail_priv_;
-  if (this != internal_default_instance()) delete pail_pub_;
+  index_bin_.Destroy();
+  x_bin_.Destroy();
   if (this != internal_default_instance()) delete g_x_;
+  if (this != internal_default_instance()) delete prg_cursor_;
 }
 
 void Party::SetCachedSize(int size) const {
@@ -387,28 +528,21 @@ void Party::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  seed_.Clear();
+  seed_bin_.Clear();
   party_id_.ClearToEmpty();
   index_.ClearToEmpty();
   x_.ClearToEmpty();
-  n_tilde_.ClearToEmpty();
-  p_.ClearToEmpty();
-  q_.ClearToEmpty();
-  h1_.ClearToEmpty();
-  h2_.ClearToEmpty();
-  alpha_.ClearToEmpty();
-  beta_.ClearToEmpty();
-  if (GetArenaForAllocation() == nullptr && pail_priv_ != nullptr) {
-    delete pail_priv_;
-  }
-  pail_priv_ = nullptr;
-  if (GetArenaForAllocation() == nullptr && pail_pub_ != nullptr) {
-    delete pail_pub_;
-  }
-  pail_pub_ = nullptr;
+  index_bin_.ClearToEmpty();
+  x_bin_.ClearToEmpty();
   if (GetArenaForAllocation() == nullptr && g_x_ != nullptr) {
     delete g_x_;
   }
   g_x_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && prg_cursor_ != nullptr) {
+    delete prg_cursor_;
+  }
+  prg_cursor_ = nullptr;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -438,22 +572,6 @@ const char* Party::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
         } else
           goto handle_unusual;
         continue;
-      // .safeheron.proto.PailPriv pail_priv = 6;
-      case 6:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
-          ptr = ctx->ParseMessage(_internal_mutable_pail_priv(), ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // .safeheron.proto.PailPub pail_pub = 7;
-      case 7:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
-          ptr = ctx->ParseMessage(_internal_mutable_pail_pub(), ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
       // string x = 8;
       case 8:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
@@ -472,73 +590,58 @@ const char* Party::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
         } else
           goto handle_unusual;
         continue;
-      // string N_tilde = 10;
+      // repeated string seed = 10;
       case 10:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
-          auto str = _internal_mutable_n_tilde();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.Party.N_tilde"));
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_seed();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.Party.seed"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<82>(ptr));
         } else
           goto handle_unusual;
         continue;
-      // string p = 11;
+      // .safeheron.proto.multi_party_ecdsa.Li24.PRGCursor prg_cursor = 11;
       case 11:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
-          auto str = _internal_mutable_p();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          ptr = ctx->ParseMessage(_internal_mutable_prg_cursor(), ptr);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.Party.p"));
         } else
           goto handle_unusual;
         continue;
-      // string q = 12;
+      // bytes index_bin = 12;
       case 12:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
-          auto str = _internal_mutable_q();
+          auto str = _internal_mutable_index_bin();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.Party.q"));
         } else
           goto handle_unusual;
         continue;
-      // string h1 = 13;
+      // bytes x_bin = 13;
       case 13:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 106)) {
-          auto str = _internal_mutable_h1();
+          auto str = _internal_mutable_x_bin();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.Party.h1"));
         } else
           goto handle_unusual;
         continue;
-      // string h2 = 14;
+      // repeated bytes seed_bin = 14;
       case 14:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 114)) {
-          auto str = _internal_mutable_h2();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.Party.h2"));
-        } else
-          goto handle_unusual;
-        continue;
-      // string alpha = 15;
-      case 15:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 122)) {
-          auto str = _internal_mutable_alpha();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.Party.alpha"));
-        } else
-          goto handle_unusual;
-        continue;
-      // string beta = 16;
-      case 16:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 130)) {
-          auto str = _internal_mutable_beta();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.Party.beta"));
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_seed_bin();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<114>(ptr));
         } else
           goto handle_unusual;
         continue;
@@ -591,20 +694,6 @@ uint8_t* Party::_InternalSerialize(
         3, this->_internal_index(), target);
   }
 
-  // .safeheron.proto.PailPriv pail_priv = 6;
-  if (this->_internal_has_pail_priv()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(6, _Internal::pail_priv(this),
-        _Internal::pail_priv(this).GetCachedSize(), target, stream);
-  }
-
-  // .safeheron.proto.PailPub pail_pub = 7;
-  if (this->_internal_has_pail_pub()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(7, _Internal::pail_pub(this),
-        _Internal::pail_pub(this).GetCachedSize(), target, stream);
-  }
-
   // string x = 8;
   if (!this->_internal_x().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
@@ -622,74 +711,39 @@ uint8_t* Party::_InternalSerialize(
         _Internal::g_x(this).GetCachedSize(), target, stream);
   }
 
-  // string N_tilde = 10;
-  if (!this->_internal_n_tilde().empty()) {
+  // repeated string seed = 10;
+  for (int i = 0, n = this->_internal_seed_size(); i < n; i++) {
+    const auto& s = this->_internal_seed(i);
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_n_tilde().data(), static_cast<int>(this->_internal_n_tilde().length()),
+      s.data(), static_cast<int>(s.length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "safeheron.proto.multi_party_ecdsa.Li24.Party.N_tilde");
-    target = stream->WriteStringMaybeAliased(
-        10, this->_internal_n_tilde(), target);
+      "safeheron.proto.multi_party_ecdsa.Li24.Party.seed");
+    target = stream->WriteString(10, s, target);
   }
 
-  // string p = 11;
-  if (!this->_internal_p().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_p().data(), static_cast<int>(this->_internal_p().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "safeheron.proto.multi_party_ecdsa.Li24.Party.p");
-    target = stream->WriteStringMaybeAliased(
-        11, this->_internal_p(), target);
+  // .safeheron.proto.multi_party_ecdsa.Li24.PRGCursor prg_cursor = 11;
+  if (this->_internal_has_prg_cursor()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(11, _Internal::prg_cursor(this),
+        _Internal::prg_cursor(this).GetCachedSize(), target, stream);
   }
 
-  // string q = 12;
-  if (!this->_internal_q().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_q().data(), static_cast<int>(this->_internal_q().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "safeheron.proto.multi_party_ecdsa.Li24.Party.q");
-    target = stream->WriteStringMaybeAliased(
-        12, this->_internal_q(), target);
+  // bytes index_bin = 12;
+  if (!this->_internal_index_bin().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        12, this->_internal_index_bin(), target);
   }
 
-  // string h1 = 13;
-  if (!this->_internal_h1().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_h1().data(), static_cast<int>(this->_internal_h1().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "safeheron.proto.multi_party_ecdsa.Li24.Party.h1");
-    target = stream->WriteStringMaybeAliased(
-        13, this->_internal_h1(), target);
+  // bytes x_bin = 13;
+  if (!this->_internal_x_bin().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        13, this->_internal_x_bin(), target);
   }
 
-  // string h2 = 14;
-  if (!this->_internal_h2().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_h2().data(), static_cast<int>(this->_internal_h2().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "safeheron.proto.multi_party_ecdsa.Li24.Party.h2");
-    target = stream->WriteStringMaybeAliased(
-        14, this->_internal_h2(), target);
-  }
-
-  // string alpha = 15;
-  if (!this->_internal_alpha().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_alpha().data(), static_cast<int>(this->_internal_alpha().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "safeheron.proto.multi_party_ecdsa.Li24.Party.alpha");
-    target = stream->WriteStringMaybeAliased(
-        15, this->_internal_alpha(), target);
-  }
-
-  // string beta = 16;
-  if (!this->_internal_beta().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_beta().data(), static_cast<int>(this->_internal_beta().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "safeheron.proto.multi_party_ecdsa.Li24.Party.beta");
-    target = stream->WriteStringMaybeAliased(
-        16, this->_internal_beta(), target);
+  // repeated bytes seed_bin = 14;
+  for (int i = 0, n = this->_internal_seed_bin_size(); i < n; i++) {
+    const auto& s = this->_internal_seed_bin(i);
+    target = stream->WriteBytes(14, s, target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -708,6 +762,22 @@ size_t Party::ByteSizeLong() const {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
+  // repeated string seed = 10;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(seed_.size());
+  for (int i = 0, n = seed_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      seed_.Get(i));
+  }
+
+  // repeated bytes seed_bin = 14;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(seed_bin_.size());
+  for (int i = 0, n = seed_bin_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      seed_bin_.Get(i));
+  }
+
   // string party_id = 1;
   if (!this->_internal_party_id().empty()) {
     total_size += 1 +
@@ -729,74 +799,32 @@ size_t Party::ByteSizeLong() const {
         this->_internal_x());
   }
 
-  // string N_tilde = 10;
-  if (!this->_internal_n_tilde().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_n_tilde());
-  }
-
-  // string p = 11;
-  if (!this->_internal_p().empty()) {
+  // bytes index_bin = 12;
+  if (!this->_internal_index_bin().empty()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_p());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_index_bin());
   }
 
-  // string q = 12;
-  if (!this->_internal_q().empty()) {
+  // bytes x_bin = 13;
+  if (!this->_internal_x_bin().empty()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_q());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_x_bin());
   }
 
-  // string h1 = 13;
-  if (!this->_internal_h1().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_h1());
-  }
-
-  // string h2 = 14;
-  if (!this->_internal_h2().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_h2());
-  }
-
-  // string alpha = 15;
-  if (!this->_internal_alpha().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_alpha());
-  }
-
-  // string beta = 16;
-  if (!this->_internal_beta().empty()) {
-    total_size += 2 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_beta());
-  }
-
-  // .safeheron.proto.PailPriv pail_priv = 6;
-  if (this->_internal_has_pail_priv()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *pail_priv_);
-  }
-
-  // .safeheron.proto.PailPub pail_pub = 7;
-  if (this->_internal_has_pail_pub()) {
+  // .safeheron.proto.CurvePoint g_x = 9;
+  if (this->_internal_has_g_x()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *pail_pub_);
+        *g_x_);
   }
 
-  // .safeheron.proto.CurvePoint g_x = 9;
-  if (this->_internal_has_g_x()) {
+  // .safeheron.proto.multi_party_ecdsa.Li24.PRGCursor prg_cursor = 11;
+  if (this->_internal_has_prg_cursor()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *g_x_);
+        *prg_cursor_);
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
@@ -821,6 +849,8 @@ void Party::MergeFrom(const Party& from) {
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
+  seed_.MergeFrom(from.seed_);
+  seed_bin_.MergeFrom(from.seed_bin_);
   if (!from._internal_party_id().empty()) {
     _internal_set_party_id(from._internal_party_id());
   }
@@ -830,36 +860,18 @@ void Party::MergeFrom(const Party& from) {
   if (!from._internal_x().empty()) {
     _internal_set_x(from._internal_x());
   }
-  if (!from._internal_n_tilde().empty()) {
-    _internal_set_n_tilde(from._internal_n_tilde());
-  }
-  if (!from._internal_p().empty()) {
-    _internal_set_p(from._internal_p());
-  }
-  if (!from._internal_q().empty()) {
-    _internal_set_q(from._internal_q());
+  if (!from._internal_index_bin().empty()) {
+    _internal_set_index_bin(from._internal_index_bin());
   }
-  if (!from._internal_h1().empty()) {
-    _internal_set_h1(from._internal_h1());
-  }
-  if (!from._internal_h2().empty()) {
-    _internal_set_h2(from._internal_h2());
-  }
-  if (!from._internal_alpha().empty()) {
-    _internal_set_alpha(from._internal_alpha());
-  }
-  if (!from._internal_beta().empty()) {
-    _internal_set_beta(from._internal_beta());
-  }
-  if (from._internal_has_pail_priv()) {
-    _internal_mutable_pail_priv()->::safeheron::proto::PailPriv::MergeFrom(from._internal_pail_priv());
-  }
-  if (from._internal_has_pail_pub()) {
-    _internal_mutable_pail_pub()->::safeheron::proto::PailPub::MergeFrom(from._internal_pail_pub());
+  if (!from._internal_x_bin().empty()) {
+    _internal_set_x_bin(from._internal_x_bin());
   }
   if (from._internal_has_g_x()) {
     _internal_mutable_g_x()->::safeheron::proto::CurvePoint::MergeFrom(from._internal_g_x());
   }
+  if (from._internal_has_prg_cursor()) {
+    _internal_mutable_prg_cursor()->::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor::MergeFrom(from._internal_prg_cursor());
+  }
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -879,6 +891,8 @@ void Party::InternalSwap(Party* other) {
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  seed_.InternalSwap(&other->seed_);
+  seed_bin_.InternalSwap(&other->seed_bin_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
       &party_id_, lhs_arena,
       &other->party_id_, rhs_arena
@@ -892,45 +906,25 @@ void Party::InternalSwap(Party* other) {
       &other->x_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &n_tilde_, lhs_arena,
-      &other->n_tilde_, rhs_arena
+      &index_bin_, lhs_arena,
+      &other->index_bin_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &p_, lhs_arena,
-      &other->p_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &q_, lhs_arena,
-      &other->q_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &h1_, lhs_arena,
-      &other->h1_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &h2_, lhs_arena,
-      &other->h2_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &alpha_, lhs_arena,
-      &other->alpha_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &beta_, lhs_arena,
-      &other->beta_, rhs_arena
+      &x_bin_, lhs_arena,
+      &other->x_bin_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Party, g_x_)
-      + sizeof(Party::g_x_)
-      - PROTOBUF_FIELD_OFFSET(Party, pail_priv_)>(
-          reinterpret_cast<char*>(&pail_priv_),
-          reinterpret_cast<char*>(&other->pail_priv_));
+      PROTOBUF_FIELD_OFFSET(Party, prg_cursor_)
+      + sizeof(Party::prg_cursor_)
+      - PROTOBUF_FIELD_OFFSET(Party, g_x_)>(
+          reinterpret_cast<char*>(&g_x_),
+          reinterpret_cast<char*>(&other->g_x_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Party::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_Li24_2fstruct_2eproto_getter, &descriptor_table_Li24_2fstruct_2eproto_once,
-      file_level_metadata_Li24_2fstruct_2eproto[0]);
+      file_level_metadata_Li24_2fstruct_2eproto[1]);
 }
 
 // ===================================================================
@@ -985,8 +979,8 @@ SignKey::SignKey(const SignKey& from)
     g_x_ = nullptr;
   }
   ::memcpy(&threshold_, &from.threshold_,
-    static_cast<size_t>(reinterpret_cast<char*>(&n_parties_) -
-    reinterpret_cast<char*>(&threshold_)) + sizeof(n_parties_));
+    static_cast<size_t>(reinterpret_cast<char*>(&wire_version_) -
+    reinterpret_cast<char*>(&threshold_)) + sizeof(wire_version_));
   // @@protoc_insertion_point(copy_constructor:safeheron.proto.multi_party_ecdsa.Li24.SignKey)
 }
 
@@ -997,8 +991,8 @@ workspace_id_.InitDefault();
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 ::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
     reinterpret_cast<char*>(&local_party_) - reinterpret_cast<char*>(this)),
-    0, static_cast<size_t>(reinterpret_cast<char*>(&n_parties_) -
-    reinterpret_cast<char*>(&local_party_)) + sizeof(n_parties_));
+    0, static_cast<size_t>(reinterpret_cast<char*>(&wire_version_) -
+    reinterpret_cast<char*>(&local_party_)) + sizeof(wire_version_));
 }
 
 SignKey::~SignKey() {
@@ -1038,8 +1032,8 @@ void SignKey::Clear() {
   }
   g_x_ = nullptr;
   ::memset(&threshold_, 0, static_cast<size_t>(
-      reinterpret_cast<char*>(&n_parties_) -
-      reinterpret_cast<char*>(&threshold_)) + sizeof(n_parties_));
+      reinterpret_cast<char*>(&wire_version_) -
+      reinterpret_cast<char*>(&threshold_)) + sizeof(wire_version_));
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -1104,6 +1098,22 @@ const char* SignKey::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx)
         } else
           goto handle_unusual;
         continue;
+      // int32 prg_type = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          prg_type_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 wire_version = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          wire_version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
       default:
         goto handle_unusual;
     }  // switch
@@ -1177,6 +1187,18 @@ uint8_t* SignKey::_InternalSerialize(
         _Internal::g_x(this).GetCachedSize(), target, stream);
   }
 
+  // int32 prg_type = 8;
+  if (this->_internal_prg_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(8, this->_internal_prg_type(), target);
+  }
+
+  // int32 wire_version = 9;
+  if (this->_internal_wire_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(9, this->_internal_wire_version(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -1231,6 +1253,16 @@ size_t SignKey::ByteSizeLong() const {
     total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_n_parties());
   }
 
+  // int32 prg_type = 8;
+  if (this->_internal_prg_type() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_prg_type());
+  }
+
+  // int32 wire_version = 9;
+  if (this->_internal_wire_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_wire_version());
+  }
+
   return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
 }
 
@@ -1269,6 +1301,12 @@ void SignKey::MergeFrom(const SignKey& from) {
   if (from._internal_n_parties() != 0) {
     _internal_set_n_parties(from._internal_n_parties());
   }
+  if (from._internal_prg_type() != 0) {
+    _internal_set_prg_type(from._internal_prg_type());
+  }
+  if (from._internal_wire_version() != 0) {
+    _internal_set_wire_version(from._internal_wire_version());
+  }
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
@@ -1294,8 +1332,8 @@ void SignKey::InternalSwap(SignKey* other) {
       &other->workspace_id_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(SignKey, n_parties_)
-      + sizeof(SignKey::n_parties_)
+      PROTOBUF_FIELD_OFFSET(SignKey, wire_version_)
+      + sizeof(SignKey::wire_version_)
       - PROTOBUF_FIELD_OFFSET(SignKey, local_party_)>(
           reinterpret_cast<char*>(&local_party_),
           reinterpret_cast<char*>(&other->local_party_));
@@ -1304,7 +1342,7 @@ void SignKey::InternalSwap(SignKey* other) {
 ::PROTOBUF_NAMESPACE_ID::Metadata SignKey::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_Li24_2fstruct_2eproto_getter, &descriptor_table_Li24_2fstruct_2eproto_once,
-      file_level_metadata_Li24_2fstruct_2eproto[1]);
+      file_level_metadata_Li24_2fstruct_2eproto[2]);
 }
 
 // @@protoc_insertion_point(namespace_scope)
@@ -1313,6 +1351,10 @@ void SignKey::InternalSwap(SignKey* other) {
 }  // namespace proto
 }  // namespace safeheron
 PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor*
+Arena::CreateMaybeMessage< ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor >(arena);
+}
 template<> PROTOBUF_NOINLINE ::safeheron::proto::multi_party_ecdsa::Li24::Party*
 Arena::CreateMaybeMessage< ::safeheron::proto::multi_party_ecdsa::Li24::Party >(Arena* arena) {
   return Arena::CreateMessageInternal< ::safeheron::proto::multi_party_ecdsa::Li24::Party >(arena);
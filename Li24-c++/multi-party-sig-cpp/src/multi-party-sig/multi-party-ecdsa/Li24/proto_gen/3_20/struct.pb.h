@@ -50,6 +50,9 @@ namespace safeheron {
 namespace proto {
 namespace multi_party_ecdsa {
 namespace Li24 {
+class PRGCursor;
+struct PRGCursorDefaultTypeInternal;
+extern PRGCursorDefaultTypeInternal _PRGCursor_default_instance_;
 class Party;
 struct PartyDefaultTypeInternal;
 extern PartyDefaultTypeInternal _Party_default_instance_;
@@ -61,6 +64,7 @@ extern SignKeyDefaultTypeInternal _SignKey_default_instance_;
 }  // namespace proto
 }  // namespace safeheron
 PROTOBUF_NAMESPACE_OPEN
+template<> ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor* Arena::CreateMaybeMessage<::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor>(Arena*);
 template<> ::safeheron::proto::multi_party_ecdsa::Li24::Party* Arena::CreateMaybeMessage<::safeheron::proto::multi_party_ecdsa::Li24::Party>(Arena*);
 template<> ::safeheron::proto::multi_party_ecdsa::Li24::SignKey* Arena::CreateMaybeMessage<::safeheron::proto::multi_party_ecdsa::Li24::SignKey>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
@@ -71,6 +75,160 @@ namespace Li24 {
 
 // ===================================================================
 
+class PRGCursor final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:safeheron.proto.multi_party_ecdsa.Li24.PRGCursor) */ {
+ public:
+  inline PRGCursor() : PRGCursor(nullptr) {}
+  ~PRGCursor() override;
+  explicit PROTOBUF_CONSTEXPR PRGCursor(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PRGCursor(const PRGCursor& from);
+  PRGCursor(PRGCursor&& from) noexcept
+    : PRGCursor() {
+    *this = ::std::move(from);
+  }
+
+  inline PRGCursor& operator=(const PRGCursor& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PRGCursor& operator=(PRGCursor&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PRGCursor& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PRGCursor* internal_default_instance() {
+    return reinterpret_cast<const PRGCursor*>(
+               &_PRGCursor_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(PRGCursor& a, PRGCursor& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PRGCursor* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PRGCursor* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PRGCursor* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PRGCursor>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PRGCursor& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom(const PRGCursor& from);
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PRGCursor* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "safeheron.proto.multi_party_ecdsa.Li24.PRGCursor";
+  }
+  protected:
+  explicit PRGCursor(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPositionFieldNumber = 2,
+    kVersionFieldNumber = 1,
+  };
+  // uint64 position = 2;
+  void clear_position();
+  uint64_t position() const;
+  void set_position(uint64_t value);
+  private:
+  uint64_t _internal_position() const;
+  void _internal_set_position(uint64_t value);
+  public:
+
+  // int32 version = 1;
+  void clear_version();
+  int32_t version() const;
+  void set_version(int32_t value);
+  private:
+  int32_t _internal_version() const;
+  void _internal_set_version(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:safeheron.proto.multi_party_ecdsa.Li24.PRGCursor)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  uint64_t position_;
+  int32_t version_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_Li24_2fstruct_2eproto;
+};
+// -------------------------------------------------------------------
+
 class Party final :
     public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:safeheron.proto.multi_party_ecdsa.Li24.Party) */ {
  public:
@@ -119,7 +277,7 @@ class Party final :
                &_Party_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    0;
+    1;
 
   friend void swap(Party& a, Party& b) {
     a.Swap(&b);
@@ -190,20 +348,64 @@ class Party final :
   // accessors -------------------------------------------------------
 
   enum : int {
+    kSeedFieldNumber = 10,
+    kSeedBinFieldNumber = 14,
     kPartyIdFieldNumber = 1,
     kIndexFieldNumber = 3,
     kXFieldNumber = 8,
-    kNTildeFieldNumber = 10,
-    kPFieldNumber = 11,
-    kQFieldNumber = 12,
-    kH1FieldNumber = 13,
-    kH2FieldNumber = 14,
-    kAlphaFieldNumber = 15,
-    kBetaFieldNumber = 16,
-    kPailPrivFieldNumber = 6,
-    kPailPubFieldNumber = 7,
+    kIndexBinFieldNumber = 12,
+    kXBinFieldNumber = 13,
     kGXFieldNumber = 9,
+    kPrgCursorFieldNumber = 11,
   };
+  // repeated string seed = 10;
+  int seed_size() const;
+  private:
+  int _internal_seed_size() const;
+  public:
+  void clear_seed();
+  const std::string& seed(int index) const;
+  std::string* mutable_seed(int index);
+  void set_seed(int index, const std::string& value);
+  void set_seed(int index, std::string&& value);
+  void set_seed(int index, const char* value);
+  void set_seed(int index, const char* value, size_t size);
+  std::string* add_seed();
+  void add_seed(const std::string& value);
+  void add_seed(std::string&& value);
+  void add_seed(const char* value);
+  void add_seed(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& seed() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_seed();
+  private:
+  const std::string& _internal_seed(int index) const;
+  std::string* _internal_add_seed();
+  public:
+
+  // repeated bytes seed_bin = 14;
+  int seed_bin_size() const;
+  private:
+  int _internal_seed_bin_size() const;
+  public:
+  void clear_seed_bin();
+  const std::string& seed_bin(int index) const;
+  std::string* mutable_seed_bin(int index);
+  void set_seed_bin(int index, const std::string& value);
+  void set_seed_bin(int index, std::string&& value);
+  void set_seed_bin(int index, const char* value);
+  void set_seed_bin(int index, const void* value, size_t size);
+  std::string* add_seed_bin();
+  void add_seed_bin(const std::string& value);
+  void add_seed_bin(std::string&& value);
+  void add_seed_bin(const char* value);
+  void add_seed_bin(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& seed_bin() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_seed_bin();
+  private:
+  const std::string& _internal_seed_bin(int index) const;
+  std::string* _internal_add_seed_bin();
+  public:
+
   // string party_id = 1;
   void clear_party_id();
   const std::string& party_id() const;
@@ -246,140 +448,34 @@ class Party final :
   std::string* _internal_mutable_x();
   public:
 
-  // string N_tilde = 10;
-  void clear_n_tilde();
-  const std::string& n_tilde() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_n_tilde(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_n_tilde();
-  PROTOBUF_NODISCARD std::string* release_n_tilde();
-  void set_allocated_n_tilde(std::string* n_tilde);
-  private:
-  const std::string& _internal_n_tilde() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_n_tilde(const std::string& value);
-  std::string* _internal_mutable_n_tilde();
-  public:
-
-  // string p = 11;
-  void clear_p();
-  const std::string& p() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_p(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_p();
-  PROTOBUF_NODISCARD std::string* release_p();
-  void set_allocated_p(std::string* p);
-  private:
-  const std::string& _internal_p() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_p(const std::string& value);
-  std::string* _internal_mutable_p();
-  public:
-
-  // string q = 12;
-  void clear_q();
-  const std::string& q() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_q(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_q();
-  PROTOBUF_NODISCARD std::string* release_q();
-  void set_allocated_q(std::string* q);
-  private:
-  const std::string& _internal_q() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_q(const std::string& value);
-  std::string* _internal_mutable_q();
-  public:
-
-  // string h1 = 13;
-  void clear_h1();
-  const std::string& h1() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_h1(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_h1();
-  PROTOBUF_NODISCARD std::string* release_h1();
-  void set_allocated_h1(std::string* h1);
-  private:
-  const std::string& _internal_h1() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_h1(const std::string& value);
-  std::string* _internal_mutable_h1();
-  public:
-
-  // string h2 = 14;
-  void clear_h2();
-  const std::string& h2() const;
+  // bytes index_bin = 12;
+  void clear_index_bin();
+  const std::string& index_bin() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_h2(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_h2();
-  PROTOBUF_NODISCARD std::string* release_h2();
-  void set_allocated_h2(std::string* h2);
+  void set_index_bin(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_index_bin();
+  PROTOBUF_NODISCARD std::string* release_index_bin();
+  void set_allocated_index_bin(std::string* index_bin);
   private:
-  const std::string& _internal_h2() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_h2(const std::string& value);
-  std::string* _internal_mutable_h2();
+  const std::string& _internal_index_bin() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_index_bin(const std::string& value);
+  std::string* _internal_mutable_index_bin();
   public:
 
-  // string alpha = 15;
-  void clear_alpha();
-  const std::string& alpha() const;
+  // bytes x_bin = 13;
+  void clear_x_bin();
+  const std::string& x_bin() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_alpha(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_alpha();
-  PROTOBUF_NODISCARD std::string* release_alpha();
-  void set_allocated_alpha(std::string* alpha);
+  void set_x_bin(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_x_bin();
+  PROTOBUF_NODISCARD std::string* release_x_bin();
+  void set_allocated_x_bin(std::string* x_bin);
   private:
-  const std::string& _internal_alpha() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_alpha(const std::string& value);
-  std::string* _internal_mutable_alpha();
+  const std::string& _internal_x_bin() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_x_bin(const std::string& value);
+  std::string* _internal_mutable_x_bin();
   public:
 
-  // string beta = 16;
-  void clear_beta();
-  const std::string& beta() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_beta(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_beta();
-  PROTOBUF_NODISCARD std::string* release_beta();
-  void set_allocated_beta(std::string* beta);
-  private:
-  const std::string& _internal_beta() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_beta(const std::string& value);
-  std::string* _internal_mutable_beta();
-  public:
-
-  // .safeheron.proto.PailPriv pail_priv = 6;
-  bool has_pail_priv() const;
-  private:
-  bool _internal_has_pail_priv() const;
-  public:
-  void clear_pail_priv();
-  const ::safeheron::proto::PailPriv& pail_priv() const;
-  PROTOBUF_NODISCARD ::safeheron::proto::PailPriv* release_pail_priv();
-  ::safeheron::proto::PailPriv* mutable_pail_priv();
-  void set_allocated_pail_priv(::safeheron::proto::PailPriv* pail_priv);
-  private:
-  const ::safeheron::proto::PailPriv& _internal_pail_priv() const;
-  ::safeheron::proto::PailPriv* _internal_mutable_pail_priv();
-  public:
-  void unsafe_arena_set_allocated_pail_priv(
-      ::safeheron::proto::PailPriv* pail_priv);
-  ::safeheron::proto::PailPriv* unsafe_arena_release_pail_priv();
-
-  // .safeheron.proto.PailPub pail_pub = 7;
-  bool has_pail_pub() const;
-  private:
-  bool _internal_has_pail_pub() const;
-  public:
-  void clear_pail_pub();
-  const ::safeheron::proto::PailPub& pail_pub() const;
-  PROTOBUF_NODISCARD ::safeheron::proto::PailPub* release_pail_pub();
-  ::safeheron::proto::PailPub* mutable_pail_pub();
-  void set_allocated_pail_pub(::safeheron::proto::PailPub* pail_pub);
-  private:
-  const ::safeheron::proto::PailPub& _internal_pail_pub() const;
-  ::safeheron::proto::PailPub* _internal_mutable_pail_pub();
-  public:
-  void unsafe_arena_set_allocated_pail_pub(
-      ::safeheron::proto::PailPub* pail_pub);
-  ::safeheron::proto::PailPub* unsafe_arena_release_pail_pub();
-
   // .safeheron.proto.CurvePoint g_x = 9;
   bool has_g_x() const;
   private:
@@ -398,6 +494,24 @@ class Party final :
       ::safeheron::proto::CurvePoint* g_x);
   ::safeheron::proto::CurvePoint* unsafe_arena_release_g_x();
 
+  // .safeheron.proto.multi_party_ecdsa.Li24.PRGCursor prg_cursor = 11;
+  bool has_prg_cursor() const;
+  private:
+  bool _internal_has_prg_cursor() const;
+  public:
+  void clear_prg_cursor();
+  const ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor& prg_cursor() const;
+  PROTOBUF_NODISCARD ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor* release_prg_cursor();
+  ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor* mutable_prg_cursor();
+  void set_allocated_prg_cursor(::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor* prg_cursor);
+  private:
+  const ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor& _internal_prg_cursor() const;
+  ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor* _internal_mutable_prg_cursor();
+  public:
+  void unsafe_arena_set_allocated_prg_cursor(
+      ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor* prg_cursor);
+  ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor* unsafe_arena_release_prg_cursor();
+
   // @@protoc_insertion_point(class_scope:safeheron.proto.multi_party_ecdsa.Li24.Party)
  private:
   class _Internal;
@@ -405,19 +519,15 @@ class Party final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> seed_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> seed_bin_;
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr party_id_;
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr index_;
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr x_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr n_tilde_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr p_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr q_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr h1_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr h2_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr alpha_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr beta_;
-  ::safeheron::proto::PailPriv* pail_priv_;
-  ::safeheron::proto::PailPub* pail_pub_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr index_bin_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr x_bin_;
   ::safeheron::proto::CurvePoint* g_x_;
+  ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor* prg_cursor_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_Li24_2fstruct_2eproto;
 };
@@ -471,7 +581,7 @@ class SignKey final :
                &_SignKey_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    1;
+    2;
 
   friend void swap(SignKey& a, SignKey& b) {
     a.Swap(&b);
@@ -548,6 +658,8 @@ class SignKey final :
     kGXFieldNumber = 7,
     kThresholdFieldNumber = 2,
     kNPartiesFieldNumber = 3,
+    kPrgTypeFieldNumber = 8,
+    kWireVersionFieldNumber = 9,
   };
   // repeated .safeheron.proto.multi_party_ecdsa.Li24.Party remote_parties = 6;
   int remote_parties_size() const;
@@ -635,6 +747,24 @@ class SignKey final :
   void _internal_set_n_parties(int32_t value);
   public:
 
+  // int32 prg_type = 8;
+  void clear_prg_type();
+  int32_t prg_type() const;
+  void set_prg_type(int32_t value);
+  private:
+  int32_t _internal_prg_type() const;
+  void _internal_set_prg_type(int32_t value);
+  public:
+
+  // int32 wire_version = 9;
+  void clear_wire_version();
+  int32_t wire_version() const;
+  void set_wire_version(int32_t value);
+  private:
+  int32_t _internal_wire_version() const;
+  void _internal_set_wire_version(int32_t value);
+  public:
+
   // @@protoc_insertion_point(class_scope:safeheron.proto.multi_party_ecdsa.Li24.SignKey)
  private:
   class _Internal;
@@ -648,6 +778,8 @@ class SignKey final :
   ::safeheron::proto::CurvePoint* g_x_;
   int32_t threshold_;
   int32_t n_parties_;
+  int32_t prg_type_;
+  int32_t wire_version_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_Li24_2fstruct_2eproto;
 };
@@ -660,6 +792,50 @@ class SignKey final :
   #pragma GCC diagnostic push
   #pragma GCC diagnostic ignored "-Wstrict-aliasing"
 #endif  // __GNUC__
+// PRGCursor
+
+// int32 version = 1;
+inline void PRGCursor::clear_version() {
+  version_ = 0;
+}
+inline int32_t PRGCursor::_internal_version() const {
+  return version_;
+}
+inline int32_t PRGCursor::version() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.PRGCursor.version)
+  return _internal_version();
+}
+inline void PRGCursor::_internal_set_version(int32_t value) {
+  
+  version_ = value;
+}
+inline void PRGCursor::set_version(int32_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.PRGCursor.version)
+}
+
+// uint64 position = 2;
+inline void PRGCursor::clear_position() {
+  position_ = uint64_t{0u};
+}
+inline uint64_t PRGCursor::_internal_position() const {
+  return position_;
+}
+inline uint64_t PRGCursor::position() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.PRGCursor.position)
+  return _internal_position();
+}
+inline void PRGCursor::_internal_set_position(uint64_t value) {
+  
+  position_ = value;
+}
+inline void PRGCursor::set_position(uint64_t value) {
+  _internal_set_position(value);
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.PRGCursor.position)
+}
+
+// -------------------------------------------------------------------
+
 // Party
 
 // string party_id = 1;
@@ -762,176 +938,6 @@ inline void Party::set_allocated_index(std::string* index) {
   // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.Party.index)
 }
 
-// .safeheron.proto.PailPriv pail_priv = 6;
-inline bool Party::_internal_has_pail_priv() const {
-  return this != internal_default_instance() && pail_priv_ != nullptr;
-}
-inline bool Party::has_pail_priv() const {
-  return _internal_has_pail_priv();
-}
-inline const ::safeheron::proto::PailPriv& Party::_internal_pail_priv() const {
-  const ::safeheron::proto::PailPriv* p = pail_priv_;
-  return p != nullptr ? *p : reinterpret_cast<const ::safeheron::proto::PailPriv&>(
-      ::safeheron::proto::_PailPriv_default_instance_);
-}
-inline const ::safeheron::proto::PailPriv& Party::pail_priv() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.Party.pail_priv)
-  return _internal_pail_priv();
-}
-inline void Party::unsafe_arena_set_allocated_pail_priv(
-    ::safeheron::proto::PailPriv* pail_priv) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(pail_priv_);
-  }
-  pail_priv_ = pail_priv;
-  if (pail_priv) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.Party.pail_priv)
-}
-inline ::safeheron::proto::PailPriv* Party::release_pail_priv() {
-  
-  ::safeheron::proto::PailPriv* temp = pail_priv_;
-  pail_priv_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
-}
-inline ::safeheron::proto::PailPriv* Party::unsafe_arena_release_pail_priv() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.Party.pail_priv)
-  
-  ::safeheron::proto::PailPriv* temp = pail_priv_;
-  pail_priv_ = nullptr;
-  return temp;
-}
-inline ::safeheron::proto::PailPriv* Party::_internal_mutable_pail_priv() {
-  
-  if (pail_priv_ == nullptr) {
-    auto* p = CreateMaybeMessage<::safeheron::proto::PailPriv>(GetArenaForAllocation());
-    pail_priv_ = p;
-  }
-  return pail_priv_;
-}
-inline ::safeheron::proto::PailPriv* Party::mutable_pail_priv() {
-  ::safeheron::proto::PailPriv* _msg = _internal_mutable_pail_priv();
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.Party.pail_priv)
-  return _msg;
-}
-inline void Party::set_allocated_pail_priv(::safeheron::proto::PailPriv* pail_priv) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(pail_priv_);
-  }
-  if (pail_priv) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(pail_priv));
-    if (message_arena != submessage_arena) {
-      pail_priv = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, pail_priv, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  pail_priv_ = pail_priv;
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.Party.pail_priv)
-}
-
-// .safeheron.proto.PailPub pail_pub = 7;
-inline bool Party::_internal_has_pail_pub() const {
-  return this != internal_default_instance() && pail_pub_ != nullptr;
-}
-inline bool Party::has_pail_pub() const {
-  return _internal_has_pail_pub();
-}
-inline const ::safeheron::proto::PailPub& Party::_internal_pail_pub() const {
-  const ::safeheron::proto::PailPub* p = pail_pub_;
-  return p != nullptr ? *p : reinterpret_cast<const ::safeheron::proto::PailPub&>(
-      ::safeheron::proto::_PailPub_default_instance_);
-}
-inline const ::safeheron::proto::PailPub& Party::pail_pub() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.Party.pail_pub)
-  return _internal_pail_pub();
-}
-inline void Party::unsafe_arena_set_allocated_pail_pub(
-    ::safeheron::proto::PailPub* pail_pub) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(pail_pub_);
-  }
-  pail_pub_ = pail_pub;
-  if (pail_pub) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.Party.pail_pub)
-}
-inline ::safeheron::proto::PailPub* Party::release_pail_pub() {
-  
-  ::safeheron::proto::PailPub* temp = pail_pub_;
-  pail_pub_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
-}
-inline ::safeheron::proto::PailPub* Party::unsafe_arena_release_pail_pub() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.Party.pail_pub)
-  
-  ::safeheron::proto::PailPub* temp = pail_pub_;
-  pail_pub_ = nullptr;
-  return temp;
-}
-inline ::safeheron::proto::PailPub* Party::_internal_mutable_pail_pub() {
-  
-  if (pail_pub_ == nullptr) {
-    auto* p = CreateMaybeMessage<::safeheron::proto::PailPub>(GetArenaForAllocation());
-    pail_pub_ = p;
-  }
-  return pail_pub_;
-}
-inline ::safeheron::proto::PailPub* Party::mutable_pail_pub() {
-  ::safeheron::proto::PailPub* _msg = _internal_mutable_pail_pub();
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.Party.pail_pub)
-  return _msg;
-}
-inline void Party::set_allocated_pail_pub(::safeheron::proto::PailPub* pail_pub) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(pail_pub_);
-  }
-  if (pail_pub) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(pail_pub));
-    if (message_arena != submessage_arena) {
-      pail_pub = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, pail_pub, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  pail_pub_ = pail_pub;
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.Party.pail_pub)
-}
-
 // string x = 8;
 inline void Party::clear_x() {
   x_.ClearToEmpty();
@@ -1067,354 +1073,344 @@ inline void Party::set_allocated_g_x(::safeheron::proto::CurvePoint* g_x) {
   // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.Party.g_x)
 }
 
-// string N_tilde = 10;
-inline void Party::clear_n_tilde() {
-  n_tilde_.ClearToEmpty();
+// repeated string seed = 10;
+inline int Party::_internal_seed_size() const {
+  return seed_.size();
 }
-inline const std::string& Party::n_tilde() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.Party.N_tilde)
-  return _internal_n_tilde();
+inline int Party::seed_size() const {
+  return _internal_seed_size();
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void Party::set_n_tilde(ArgT0&& arg0, ArgT... args) {
- 
- n_tilde_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.Party.N_tilde)
+inline void Party::clear_seed() {
+  seed_.Clear();
 }
-inline std::string* Party::mutable_n_tilde() {
-  std::string* _s = _internal_mutable_n_tilde();
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.Party.N_tilde)
+inline std::string* Party::add_seed() {
+  std::string* _s = _internal_add_seed();
+  // @@protoc_insertion_point(field_add_mutable:safeheron.proto.multi_party_ecdsa.Li24.Party.seed)
   return _s;
 }
-inline const std::string& Party::_internal_n_tilde() const {
-  return n_tilde_.Get();
+inline const std::string& Party::_internal_seed(int index) const {
+  return seed_.Get(index);
 }
-inline void Party::_internal_set_n_tilde(const std::string& value) {
-  
-  n_tilde_.Set(value, GetArenaForAllocation());
+inline const std::string& Party::seed(int index) const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.Party.seed)
+  return _internal_seed(index);
 }
-inline std::string* Party::_internal_mutable_n_tilde() {
-  
-  return n_tilde_.Mutable(GetArenaForAllocation());
+inline std::string* Party::mutable_seed(int index) {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.Party.seed)
+  return seed_.Mutable(index);
 }
-inline std::string* Party::release_n_tilde() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.Party.N_tilde)
-  return n_tilde_.Release();
+inline void Party::set_seed(int index, const std::string& value) {
+  seed_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.Party.seed)
 }
-inline void Party::set_allocated_n_tilde(std::string* n_tilde) {
-  if (n_tilde != nullptr) {
-    
-  } else {
-    
-  }
-  n_tilde_.SetAllocated(n_tilde, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (n_tilde_.IsDefault()) {
-    n_tilde_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.Party.N_tilde)
+inline void Party::set_seed(int index, std::string&& value) {
+  seed_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.Party.seed)
 }
-
-// string p = 11;
-inline void Party::clear_p() {
-  p_.ClearToEmpty();
+inline void Party::set_seed(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  seed_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.Party.seed)
 }
-inline const std::string& Party::p() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.Party.p)
-  return _internal_p();
+inline void Party::set_seed(int index, const char* value, size_t size) {
+  seed_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.Party.seed)
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void Party::set_p(ArgT0&& arg0, ArgT... args) {
- 
- p_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.Party.p)
+inline std::string* Party::_internal_add_seed() {
+  return seed_.Add();
 }
-inline std::string* Party::mutable_p() {
-  std::string* _s = _internal_mutable_p();
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.Party.p)
-  return _s;
+inline void Party::add_seed(const std::string& value) {
+  seed_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.Party.seed)
 }
-inline const std::string& Party::_internal_p() const {
-  return p_.Get();
+inline void Party::add_seed(std::string&& value) {
+  seed_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.Party.seed)
 }
-inline void Party::_internal_set_p(const std::string& value) {
-  
-  p_.Set(value, GetArenaForAllocation());
+inline void Party::add_seed(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  seed_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:safeheron.proto.multi_party_ecdsa.Li24.Party.seed)
 }
-inline std::string* Party::_internal_mutable_p() {
-  
-  return p_.Mutable(GetArenaForAllocation());
+inline void Party::add_seed(const char* value, size_t size) {
+  seed_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:safeheron.proto.multi_party_ecdsa.Li24.Party.seed)
 }
-inline std::string* Party::release_p() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.Party.p)
-  return p_.Release();
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+Party::seed() const {
+  // @@protoc_insertion_point(field_list:safeheron.proto.multi_party_ecdsa.Li24.Party.seed)
+  return seed_;
 }
-inline void Party::set_allocated_p(std::string* p) {
-  if (p != nullptr) {
-    
-  } else {
-    
-  }
-  p_.SetAllocated(p, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (p_.IsDefault()) {
-    p_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.Party.p)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+Party::mutable_seed() {
+  // @@protoc_insertion_point(field_mutable_list:safeheron.proto.multi_party_ecdsa.Li24.Party.seed)
+  return &seed_;
 }
 
-// string q = 12;
-inline void Party::clear_q() {
-  q_.ClearToEmpty();
+// .safeheron.proto.multi_party_ecdsa.Li24.PRGCursor prg_cursor = 11;
+inline bool Party::_internal_has_prg_cursor() const {
+  return this != internal_default_instance() && prg_cursor_ != nullptr;
 }
-inline const std::string& Party::q() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.Party.q)
-  return _internal_q();
+inline bool Party::has_prg_cursor() const {
+  return _internal_has_prg_cursor();
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void Party::set_q(ArgT0&& arg0, ArgT... args) {
- 
- q_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.Party.q)
+inline void Party::clear_prg_cursor() {
+  if (GetArenaForAllocation() == nullptr && prg_cursor_ != nullptr) {
+    delete prg_cursor_;
+  }
+  prg_cursor_ = nullptr;
 }
-inline std::string* Party::mutable_q() {
-  std::string* _s = _internal_mutable_q();
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.Party.q)
-  return _s;
+inline const ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor& Party::_internal_prg_cursor() const {
+  const ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor* p = prg_cursor_;
+  return p != nullptr ? *p : reinterpret_cast<const ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor&>(
+      ::safeheron::proto::multi_party_ecdsa::Li24::_PRGCursor_default_instance_);
 }
-inline const std::string& Party::_internal_q() const {
-  return q_.Get();
+inline const ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor& Party::prg_cursor() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.Party.prg_cursor)
+  return _internal_prg_cursor();
 }
-inline void Party::_internal_set_q(const std::string& value) {
+inline void Party::unsafe_arena_set_allocated_prg_cursor(
+    ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor* prg_cursor) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(prg_cursor_);
+  }
+  prg_cursor_ = prg_cursor;
+  if (prg_cursor) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.Party.prg_cursor)
+}
+inline ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor* Party::release_prg_cursor() {
   
-  q_.Set(value, GetArenaForAllocation());
+  ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor* temp = prg_cursor_;
+  prg_cursor_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
 }
-inline std::string* Party::_internal_mutable_q() {
+inline ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor* Party::unsafe_arena_release_prg_cursor() {
+  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.Party.prg_cursor)
   
-  return q_.Mutable(GetArenaForAllocation());
+  ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor* temp = prg_cursor_;
+  prg_cursor_ = nullptr;
+  return temp;
 }
-inline std::string* Party::release_q() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.Party.q)
-  return q_.Release();
+inline ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor* Party::_internal_mutable_prg_cursor() {
+  
+  if (prg_cursor_ == nullptr) {
+    auto* p = CreateMaybeMessage<::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor>(GetArenaForAllocation());
+    prg_cursor_ = p;
+  }
+  return prg_cursor_;
 }
-inline void Party::set_allocated_q(std::string* q) {
-  if (q != nullptr) {
+inline ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor* Party::mutable_prg_cursor() {
+  ::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor* _msg = _internal_mutable_prg_cursor();
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.Party.prg_cursor)
+  return _msg;
+}
+inline void Party::set_allocated_prg_cursor(::safeheron::proto::multi_party_ecdsa::Li24::PRGCursor* prg_cursor) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete prg_cursor_;
+  }
+  if (prg_cursor) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(prg_cursor);
+    if (message_arena != submessage_arena) {
+      prg_cursor = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, prg_cursor, submessage_arena);
+    }
     
   } else {
     
   }
-  q_.SetAllocated(q, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (q_.IsDefault()) {
-    q_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.Party.q)
+  prg_cursor_ = prg_cursor;
+  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.Party.prg_cursor)
 }
 
-// string h1 = 13;
-inline void Party::clear_h1() {
-  h1_.ClearToEmpty();
+// bytes index_bin = 12;
+inline void Party::clear_index_bin() {
+  index_bin_.ClearToEmpty();
 }
-inline const std::string& Party::h1() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.Party.h1)
-  return _internal_h1();
+inline const std::string& Party::index_bin() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.Party.index_bin)
+  return _internal_index_bin();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void Party::set_h1(ArgT0&& arg0, ArgT... args) {
+void Party::set_index_bin(ArgT0&& arg0, ArgT... args) {
  
- h1_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.Party.h1)
+ index_bin_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.Party.index_bin)
 }
-inline std::string* Party::mutable_h1() {
-  std::string* _s = _internal_mutable_h1();
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.Party.h1)
+inline std::string* Party::mutable_index_bin() {
+  std::string* _s = _internal_mutable_index_bin();
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.Party.index_bin)
   return _s;
 }
-inline const std::string& Party::_internal_h1() const {
-  return h1_.Get();
+inline const std::string& Party::_internal_index_bin() const {
+  return index_bin_.Get();
 }
-inline void Party::_internal_set_h1(const std::string& value) {
+inline void Party::_internal_set_index_bin(const std::string& value) {
   
-  h1_.Set(value, GetArenaForAllocation());
+  index_bin_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Party::_internal_mutable_h1() {
+inline std::string* Party::_internal_mutable_index_bin() {
   
-  return h1_.Mutable(GetArenaForAllocation());
+  return index_bin_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Party::release_h1() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.Party.h1)
-  return h1_.Release();
+inline std::string* Party::release_index_bin() {
+  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.Party.index_bin)
+  return index_bin_.Release();
 }
-inline void Party::set_allocated_h1(std::string* h1) {
-  if (h1 != nullptr) {
+inline void Party::set_allocated_index_bin(std::string* index_bin) {
+  if (index_bin != nullptr) {
     
   } else {
     
   }
-  h1_.SetAllocated(h1, GetArenaForAllocation());
+  index_bin_.SetAllocated(index_bin, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (h1_.IsDefault()) {
-    h1_.Set("", GetArenaForAllocation());
+  if (index_bin_.IsDefault()) {
+    index_bin_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.Party.h1)
+  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.Party.index_bin)
 }
 
-// string h2 = 14;
-inline void Party::clear_h2() {
-  h2_.ClearToEmpty();
+// bytes x_bin = 13;
+inline void Party::clear_x_bin() {
+  x_bin_.ClearToEmpty();
 }
-inline const std::string& Party::h2() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.Party.h2)
-  return _internal_h2();
+inline const std::string& Party::x_bin() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.Party.x_bin)
+  return _internal_x_bin();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void Party::set_h2(ArgT0&& arg0, ArgT... args) {
+void Party::set_x_bin(ArgT0&& arg0, ArgT... args) {
  
- h2_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.Party.h2)
+ x_bin_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.Party.x_bin)
 }
-inline std::string* Party::mutable_h2() {
-  std::string* _s = _internal_mutable_h2();
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.Party.h2)
+inline std::string* Party::mutable_x_bin() {
+  std::string* _s = _internal_mutable_x_bin();
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.Party.x_bin)
   return _s;
 }
-inline const std::string& Party::_internal_h2() const {
-  return h2_.Get();
+inline const std::string& Party::_internal_x_bin() const {
+  return x_bin_.Get();
 }
-inline void Party::_internal_set_h2(const std::string& value) {
+inline void Party::_internal_set_x_bin(const std::string& value) {
   
-  h2_.Set(value, GetArenaForAllocation());
+  x_bin_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Party::_internal_mutable_h2() {
+inline std::string* Party::_internal_mutable_x_bin() {
   
-  return h2_.Mutable(GetArenaForAllocation());
+  return x_bin_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Party::release_h2() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.Party.h2)
-  return h2_.Release();
+inline std::string* Party::release_x_bin() {
+  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.Party.x_bin)
+  return x_bin_.Release();
 }
-inline void Party::set_allocated_h2(std::string* h2) {
-  if (h2 != nullptr) {
+inline void Party::set_allocated_x_bin(std::string* x_bin) {
+  if (x_bin != nullptr) {
     
   } else {
     
   }
-  h2_.SetAllocated(h2, GetArenaForAllocation());
+  x_bin_.SetAllocated(x_bin, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (h2_.IsDefault()) {
-    h2_.Set("", GetArenaForAllocation());
+  if (x_bin_.IsDefault()) {
+    x_bin_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.Party.h2)
+  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.Party.x_bin)
 }
 
-// string alpha = 15;
-inline void Party::clear_alpha() {
-  alpha_.ClearToEmpty();
+// repeated bytes seed_bin = 14;
+inline int Party::_internal_seed_bin_size() const {
+  return seed_bin_.size();
 }
-inline const std::string& Party::alpha() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.Party.alpha)
-  return _internal_alpha();
+inline int Party::seed_bin_size() const {
+  return _internal_seed_bin_size();
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void Party::set_alpha(ArgT0&& arg0, ArgT... args) {
- 
- alpha_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.Party.alpha)
+inline void Party::clear_seed_bin() {
+  seed_bin_.Clear();
 }
-inline std::string* Party::mutable_alpha() {
-  std::string* _s = _internal_mutable_alpha();
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.Party.alpha)
+inline std::string* Party::add_seed_bin() {
+  std::string* _s = _internal_add_seed_bin();
+  // @@protoc_insertion_point(field_add_mutable:safeheron.proto.multi_party_ecdsa.Li24.Party.seed_bin)
   return _s;
 }
-inline const std::string& Party::_internal_alpha() const {
-  return alpha_.Get();
+inline const std::string& Party::_internal_seed_bin(int index) const {
+  return seed_bin_.Get(index);
 }
-inline void Party::_internal_set_alpha(const std::string& value) {
-  
-  alpha_.Set(value, GetArenaForAllocation());
+inline const std::string& Party::seed_bin(int index) const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.Party.seed_bin)
+  return _internal_seed_bin(index);
 }
-inline std::string* Party::_internal_mutable_alpha() {
-  
-  return alpha_.Mutable(GetArenaForAllocation());
+inline std::string* Party::mutable_seed_bin(int index) {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.Party.seed_bin)
+  return seed_bin_.Mutable(index);
 }
-inline std::string* Party::release_alpha() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.Party.alpha)
-  return alpha_.Release();
+inline void Party::set_seed_bin(int index, const std::string& value) {
+  seed_bin_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.Party.seed_bin)
 }
-inline void Party::set_allocated_alpha(std::string* alpha) {
-  if (alpha != nullptr) {
-    
-  } else {
-    
-  }
-  alpha_.SetAllocated(alpha, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (alpha_.IsDefault()) {
-    alpha_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.Party.alpha)
+inline void Party::set_seed_bin(int index, std::string&& value) {
+  seed_bin_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.Party.seed_bin)
 }
-
-// string beta = 16;
-inline void Party::clear_beta() {
-  beta_.ClearToEmpty();
+inline void Party::set_seed_bin(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  seed_bin_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.Party.seed_bin)
 }
-inline const std::string& Party::beta() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.Party.beta)
-  return _internal_beta();
+inline void Party::set_seed_bin(int index, const void* value, size_t size) {
+  seed_bin_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.Party.seed_bin)
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void Party::set_beta(ArgT0&& arg0, ArgT... args) {
- 
- beta_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.Party.beta)
+inline std::string* Party::_internal_add_seed_bin() {
+  return seed_bin_.Add();
 }
-inline std::string* Party::mutable_beta() {
-  std::string* _s = _internal_mutable_beta();
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.Party.beta)
-  return _s;
+inline void Party::add_seed_bin(const std::string& value) {
+  seed_bin_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.Party.seed_bin)
 }
-inline const std::string& Party::_internal_beta() const {
-  return beta_.Get();
+inline void Party::add_seed_bin(std::string&& value) {
+  seed_bin_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.Party.seed_bin)
 }
-inline void Party::_internal_set_beta(const std::string& value) {
-  
-  beta_.Set(value, GetArenaForAllocation());
+inline void Party::add_seed_bin(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  seed_bin_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:safeheron.proto.multi_party_ecdsa.Li24.Party.seed_bin)
 }
-inline std::string* Party::_internal_mutable_beta() {
-  
-  return beta_.Mutable(GetArenaForAllocation());
+inline void Party::add_seed_bin(const void* value, size_t size) {
+  seed_bin_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:safeheron.proto.multi_party_ecdsa.Li24.Party.seed_bin)
 }
-inline std::string* Party::release_beta() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.Party.beta)
-  return beta_.Release();
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+Party::seed_bin() const {
+  // @@protoc_insertion_point(field_list:safeheron.proto.multi_party_ecdsa.Li24.Party.seed_bin)
+  return seed_bin_;
 }
-inline void Party::set_allocated_beta(std::string* beta) {
-  if (beta != nullptr) {
-    
-  } else {
-    
-  }
-  beta_.SetAllocated(beta, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (beta_.IsDefault()) {
-    beta_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.Party.beta)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+Party::mutable_seed_bin() {
+  // @@protoc_insertion_point(field_mutable_list:safeheron.proto.multi_party_ecdsa.Li24.Party.seed_bin)
+  return &seed_bin_;
 }
 
 // -------------------------------------------------------------------
@@ -1726,11 +1722,53 @@ inline void SignKey::set_allocated_g_x(::safeheron::proto::CurvePoint* g_x) {
   // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.SignKey.g_x)
 }
 
+// int32 prg_type = 8;
+inline void SignKey::clear_prg_type() {
+  prg_type_ = 0;
+}
+inline int32_t SignKey::_internal_prg_type() const {
+  return prg_type_;
+}
+inline int32_t SignKey::prg_type() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.SignKey.prg_type)
+  return _internal_prg_type();
+}
+inline void SignKey::_internal_set_prg_type(int32_t value) {
+  
+  prg_type_ = value;
+}
+inline void SignKey::set_prg_type(int32_t value) {
+  _internal_set_prg_type(value);
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.SignKey.prg_type)
+}
+
+// int32 wire_version = 9;
+inline void SignKey::clear_wire_version() {
+  wire_version_ = 0;
+}
+inline int32_t SignKey::_internal_wire_version() const {
+  return wire_version_;
+}
+inline int32_t SignKey::wire_version() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.SignKey.wire_version)
+  return _internal_wire_version();
+}
+inline void SignKey::_internal_set_wire_version(int32_t value) {
+  
+  wire_version_ = value;
+}
+inline void SignKey::set_wire_version(int32_t value) {
+  _internal_set_wire_version(value);
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.SignKey.wire_version)
+}
+
 #ifdef __GNUC__
   #pragma GCC diagnostic pop
 #endif  // __GNUC__
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -0,0 +1,69 @@
+#include <algorithm>
+#include "crypto-suites/crypto-curve/curve.h"
+#include "crypto-suites/crypto-sss/polynomial.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/quorum.h"
+
+using std::vector;
+using safeheron::bignum::BN;
+using safeheron::curve::Curve;
+using safeheron::sss::Polynomial;
+
+namespace safeheron {
+namespace multi_party_ecdsa{
+namespace Li24{
+
+// Window of the party at position index: its round 0 P2P shares go to the positions [start, end], wrapping around
+static void P2PWindow(size_t index, size_t t, size_t remote_count, size_t &start, size_t &end) {
+    start = (index + 1) % t;
+    if (t % 2 == 1) {
+        end = (index + (remote_count / 2)) % t;
+    } else if (index < t / 2) {
+        end = (index + (t / 2)) % t;
+    } else {
+        end = (index + (t / 2) - 1) % t;
+    }
+}
+
+bool Quorum::Compute(const SignKey &sign_key) {
+    const Curve *curv = safeheron::curve::GetCurveParam(sign_key.X_.GetCurveType());
+    if (curv == nullptr || sign_key.threshold_ == 0) return false;
+
+    vector<BN> share_index_arr;
+    for (size_t i = 0; i < sign_key.remote_parties_.size(); ++i) {
+        share_index_arr.push_back(sign_key.remote_parties_[i].index_);
+    }
+    share_index_arr.push_back(sign_key.local_party_.index_);
+    Polynomial::GetLArray(l_arr_, BN::ZERO, share_index_arr, curv->n);
+
+    // Sort the positions by share index, the local party is the last one
+    vector<size_t> order(share_index_arr.size());
+    for (size_t i = 0; i < order.size(); ++i) order[i] = i;
+    std::sort(order.begin(), order.end(), [&share_index_arr](size_t left, size_t right) {
+        return share_index_arr[left] < share_index_arr[right];
+    });
+    remote_party_indexes_.resize(sign_key.remote_parties_.size());
+    for (size_t pos = 0; pos < order.size(); ++pos) {
+        if (order[pos] == sign_key.remote_parties_.size()) {
+            local_party_index_ = pos;
+        } else {
+            remote_party_indexes_[order[pos]] = pos;
+        }
+    }
+
+    threshold_ = sign_key.threshold_;
+    P2PWindow(local_party_index_, threshold_, remote_party_indexes_.size(), p2p_start_, p2p_end_);
+
+    return true;
+}
+
+bool Quorum::InRemoteP2PWindow(size_t remote_pos) const {
+    if (remote_pos >= remote_party_indexes_.size() || threshold_ == 0) return false;
+    size_t start = 0, end = 0;
+    P2PWindow(remote_party_indexes_[remote_pos], threshold_, remote_party_indexes_.size(), start, end);
+    size_t index = local_party_index_;
+    return (start <= end) ? (index >= start && index <= end) : (index >= start || index <= end);
+}
+
+}
+}
+}
@@ -0,0 +1,49 @@
+#ifndef SAFEHERON_MULTI_PARTY_ECDSA_Li24_QUORUM_H
+#define SAFEHERON_MULTI_PARTY_ECDSA_Li24_QUORUM_H
+
+#include <vector>
+#include "crypto-suites/crypto-bn/bn.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/sign_key.h"
+
+namespace safeheron {
+namespace multi_party_ecdsa{
+namespace Li24{
+
+/**
+ * The values of a signature which only depend on the sign key and on the set of signers.
+ * SignKeyHandle caches them for every set of signers, so that the next signatures skip the modular inversions and
+ * the sorting.
+ */
+class Quorum {
+public:
+    /**
+     * Compute the values for a sign key trimmed to the signers.
+     */
+    bool Compute(const SignKey &sign_key);
+
+public:
+    // Lagrange coefficients at 0: the remote parties in the order of the sign key, then the local party.
+    std::vector<safeheron::bignum::BN> l_arr_;
+
+    // Positions of the parties once sorted by share index
+    size_t local_party_index_ = 0;
+    std::vector<size_t> remote_party_indexes_;
+
+    // The round 0 P2P shares go to the positions [p2p_start_, p2p_end_], which wraps around if p2p_end_ < p2p_start_.
+    size_t p2p_start_ = 0;
+    size_t p2p_end_ = 0;
+
+    size_t threshold_ = 0;
+
+    /**
+     * Whether the local party is in the round 0 P2P window of a remote party, i.e. gets its shares.
+     * @param remote_pos position of the remote party in the sign key.
+     */
+    bool InRemoteP2PWindow(size_t remote_pos) const;
+};
+
+}
+}
+}
+
+#endif //SAFEHERON_MULTI_PARTY_ECDSA_Li24_QUORUM_H
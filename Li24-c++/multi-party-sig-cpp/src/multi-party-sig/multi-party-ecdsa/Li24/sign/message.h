@@ -4,6 +4,7 @@
 
 #include "crypto-suites/crypto-bn/bn.h"
 #include "multi-party-sig/multi-party-ecdsa/Li24/sign/proto_gen/sign.pb.switch.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/wire.h"
 #include "crypto-suites/crypto-curve/curve.h"
 namespace safeheron {
 namespace multi_party_ecdsa{
@@ -34,6 +35,8 @@ public:
     safeheron::bignum::BN k_;
     safeheron::bignum::BN w_;
     safeheron::bignum::BN phi_;
+    // Encoding of the big integers when written, both are read
+    WireVersion wire_version_ = WireVersion::Hex;
 
 public:
     bool ToProtoObject(safeheron::proto::multi_party_ecdsa::Li24::sign::Round0P2PMessage &message) const;
@@ -53,6 +56,7 @@ class Round1BCMessage {
 public:
     safeheron::bignum::BN delta_;
     safeheron::bignum::BN v_;
+    WireVersion wire_version_ = WireVersion::Hex;
 
 public:
     bool ToProtoObject(safeheron::proto::multi_party_ecdsa::Li24::sign::Round1P2PMessage &message) const;
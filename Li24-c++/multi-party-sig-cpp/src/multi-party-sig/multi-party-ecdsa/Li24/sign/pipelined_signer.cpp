@@ -0,0 +1,119 @@
+#include "multi-party-sig/multi-party-ecdsa/Li24/sign/pipelined_signer.h"
+
+using safeheron::bignum::BN;
+using safeheron::mpc_flow::mpc_parallel_v2::MPCContext;
+using safeheron::mpc_flow::mpc_parallel_v2::MPCSession;
+using safeheron::mpc_flow::mpc_parallel_v2::MessageEncoding;
+
+namespace safeheron {
+namespace multi_party_ecdsa{
+namespace Li24{
+namespace sign{
+
+PipelinedSigner::PipelinedSigner(std::shared_ptr<const SignKeyHandle> sign_key_handle,
+                                 const std::vector<std::string> &participant_id_arr,
+                                 size_t max_in_flight,
+                                 CompletionCallback on_completion)
+        : sign_key_handle_(std::move(sign_key_handle)), participant_id_arr_(participant_id_arr),
+          max_in_flight_(max_in_flight), on_completion_(std::move(on_completion)), executor_(nullptr),
+          message_encoding_(MessageEncoding::Base64), next_seq_(0) {
+}
+
+bool PipelinedSigner::Submit(const BN &m, uint64_t &out_seq) {
+    if (session_map_.size() >= max_in_flight_) return false;
+
+    std::unique_ptr<Context> ctx(new Context(participant_id_arr_.size()));
+    if (!Context::CreateContext(*ctx, *sign_key_handle_, participant_id_arr_, m)) return false;
+    ctx->set_executor(executor_);
+    ctx->set_message_encoding(message_encoding_);
+    // CreateContext() reserved the PRG outputs of the signature, in the order of submission
+    uint64_t seq = next_seq_;
+    next_seq_++;
+    out_seq = seq;
+
+    MPCSession *session = new MPCSession(std::to_string(seq), std::move(ctx));
+    session_map_[seq].reset(session);
+    MPCSession::OutboundCallback on_outbound = [this, seq](const std::string &, int round,
+                                                            const std::vector<std::string> &out_p2p_msg_arr,
+                                                            const std::string &out_bc_msg,
+                                                            const std::vector<std::string> &out_des_arr) {
+        OnOutbound(seq, round, out_p2p_msg_arr, out_bc_msg, out_des_arr);
+    };
+    MPCSession::Status status = session->Start(on_outbound);
+
+    // Replay the messages of the peers which got here first
+    auto iter = orphan_map_.find(seq);
+    if (iter != orphan_map_.end()) {
+        std::vector<MPCSession::Message> orphan_arr;
+        orphan_arr.swap(iter->second);
+        orphan_map_.erase(iter);
+        for (auto &orphan : orphan_arr) {
+            if (status != MPCSession::Status::Running) break;
+            status = session->Deliver(std::move(orphan), on_outbound);
+        }
+    }
+    CheckCompletion(seq, status);
+    return true;
+}
+
+bool PipelinedSigner::Deliver(const std::string &party_id, TaggedMessage msg) {
+    MPCSession::Message session_msg;
+    session_msg.party_id_ = party_id;
+    session_msg.round_ = msg.round_;
+    session_msg.p2p_msg_ = std::move(msg.p2p_msg_);
+    session_msg.bc_msg_ = std::move(msg.bc_msg_);
+
+    if (msg.seq_ >= next_seq_) {
+        // A peer never runs more than max_in_flight signatures past the oldest one this party is still running
+        if (msg.seq_ >= next_seq_ + max_in_flight_) return false;
+        orphan_map_[msg.seq_].push_back(std::move(session_msg));
+        return true;
+    }
+
+    auto iter = session_map_.find(msg.seq_);
+    if (iter == session_map_.end()) return true;
+    uint64_t seq = msg.seq_;
+    MPCSession::OutboundCallback on_outbound = [this, seq](const std::string &, int round,
+                                                            const std::vector<std::string> &out_p2p_msg_arr,
+                                                            const std::string &out_bc_msg,
+                                                            const std::vector<std::string> &out_des_arr) {
+        OnOutbound(seq, round, out_p2p_msg_arr, out_bc_msg, out_des_arr);
+    };
+    MPCSession::Status status = iter->second->Deliver(std::move(session_msg), on_outbound);
+    CheckCompletion(seq, status);
+    return true;
+}
+
+void PipelinedSigner::Flush(std::map<std::string, std::vector<TaggedMessage>> &out_msg_map) {
+    out_msg_map.clear();
+    out_msg_map.swap(outbox_map_);
+}
+
+void PipelinedSigner::OnOutbound(uint64_t seq, int round, const std::vector<std::string> &out_p2p_msg_arr,
+                                 const std::string &out_bc_msg, const std::vector<std::string> &out_des_arr) {
+    for (size_t i = 0; i < out_des_arr.size(); ++i) {
+        TaggedMessage msg;
+        msg.seq_ = seq;
+        msg.round_ = round;
+        msg.p2p_msg_ = out_p2p_msg_arr.empty() ? "" : out_p2p_msg_arr[i];
+        msg.bc_msg_ = out_bc_msg;
+        outbox_map_[out_des_arr[i]].push_back(std::move(msg));
+    }
+}
+
+void PipelinedSigner::CheckCompletion(uint64_t seq, MPCSession::Status status) {
+    if (status == MPCSession::Status::Running) return;
+    auto iter = session_map_.find(seq);
+    std::unique_ptr<MPCContext> ctx = iter->second->ReleaseContext();
+    session_map_.erase(iter);
+    if (on_completion_) {
+        // The session was created from a Context in Submit()
+        std::unique_ptr<Context> sign_ctx(static_cast<Context *>(ctx.release()));
+        on_completion_(seq, std::move(sign_ctx), status == MPCSession::Status::Finished);
+    }
+}
+
+}
+}
+}
+}
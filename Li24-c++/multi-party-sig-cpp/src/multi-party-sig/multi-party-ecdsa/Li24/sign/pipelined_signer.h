@@ -0,0 +1,115 @@
+#ifndef SAFEHERON_MULTI_PARTY_ECDSA_Li24_SIGN_PIPELINED_SIGNER_H
+#define SAFEHERON_MULTI_PARTY_ECDSA_Li24_SIGN_PIPELINED_SIGNER_H
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "crypto-suites/crypto-bn/bn.h"
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_session.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/sign_key_handle.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/sign/context.h"
+
+namespace safeheron {
+namespace multi_party_ecdsa{
+namespace Li24{
+namespace sign{
+
+/**
+ * Runs up to max_in_flight signatures on the same key at the same time, so that round r of signature j+1 goes out
+ * with round r+1 of signature j instead of waiting for signature j to be over.
+ *
+ * The signatures are numbered in the order they are submitted, and every party must submit the same messages in
+ * the same order. Each signature reserves its PRG outputs from the sign key handle when it is submitted (see
+ * SignKeyHandle::Trim()), so the blinding shares still match whatever order the signatures finish in, and
+ * SignKeyHandle::CurrentSignKey() already accounts for them.
+ *
+ * The messages are tagged with their signature and round, and are collected per destination until Flush().
+ * Not thread safe, the owner serializes the calls. The completion callback runs inside Deliver().
+ */
+class PipelinedSigner {
+public:
+    struct TaggedMessage {
+        uint64_t seq_;
+        int round_;
+        std::string p2p_msg_;
+        std::string bc_msg_;
+    };
+
+    /**
+     * @param ok false if the signature has failed, the error stack of the context tells why.
+     */
+    typedef std::function<void(uint64_t seq, std::unique_ptr<Context> ctx, bool ok)> CompletionCallback;
+
+    /**
+     * @param participant_id_arr all the parties that take part in the signatures.
+     */
+    PipelinedSigner(std::shared_ptr<const SignKeyHandle> sign_key_handle,
+                    const std::vector<std::string> &participant_id_arr,
+                    size_t max_in_flight,
+                    CompletionCallback on_completion);
+
+    PipelinedSigner(const PipelinedSigner &) = delete;
+
+    PipelinedSigner &operator=(const PipelinedSigner &) = delete;
+
+    /**
+     * Executor of the contexts created afterwards, see MPCContext::set_executor().
+     */
+    void set_executor(safeheron::mpc_flow::mpc_parallel_v2::Executor *executor) { executor_ = executor; }
+
+    void set_message_encoding(safeheron::mpc_flow::mpc_parallel_v2::MessageEncoding encoding) { message_encoding_ = encoding; }
+
+    /**
+     * Start signing m.
+     * @param out_seq number of the signature.
+     * @return false if max_in_flight signatures are running already, or if the context could not be created.
+     */
+    bool Submit(const safeheron::bignum::BN &m, uint64_t &out_seq);
+
+    /**
+     * Deliver a message sent by party_id. Messages of a signature which is not submitted here yet are kept until it
+     * is, messages of a signature which is over are dropped.
+     * @return false if the message belongs to a signature too far ahead of this party.
+     */
+    bool Deliver(const std::string &party_id, TaggedMessage msg);
+
+    /**
+     * Take the messages to send, keyed by destination, all the signatures and rounds mixed.
+     */
+    void Flush(std::map<std::string, std::vector<TaggedMessage>> &out_msg_map);
+
+    size_t in_flight() const { return session_map_.size(); }
+
+    uint64_t next_seq() const { return next_seq_; }
+
+private:
+    void OnOutbound(uint64_t seq, int round, const std::vector<std::string> &out_p2p_msg_arr,
+                    const std::string &out_bc_msg, const std::vector<std::string> &out_des_arr);
+
+    // Hand the context back once the signature is over
+    void CheckCompletion(uint64_t seq, safeheron::mpc_flow::mpc_parallel_v2::MPCSession::Status status);
+
+private:
+    std::shared_ptr<const SignKeyHandle> sign_key_handle_;
+    std::vector<std::string> participant_id_arr_;
+    size_t max_in_flight_;
+    CompletionCallback on_completion_;
+    safeheron::mpc_flow::mpc_parallel_v2::Executor *executor_;
+    safeheron::mpc_flow::mpc_parallel_v2::MessageEncoding message_encoding_;
+
+    uint64_t next_seq_;
+    std::map<uint64_t, std::unique_ptr<safeheron::mpc_flow::mpc_parallel_v2::MPCSession>> session_map_;
+    // Messages of signatures not submitted yet, keyed by signature
+    std::map<uint64_t, std::vector<safeheron::mpc_flow::mpc_parallel_v2::MPCSession::Message>> orphan_map_;
+    std::map<std::string, std::vector<TaggedMessage>> outbox_map_;
+};
+
+}
+}
+}
+}
+
+#endif //SAFEHERON_MULTI_PARTY_ECDSA_Li24_SIGN_PIPELINED_SIGNER_H
@@ -32,6 +32,26 @@ class Round1P2PMessageDefaultTypeInternal {
  public:
   ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<Round1P2PMessage> _instance;
 } _Round1P2PMessage_default_instance_;
+class BatchRound0BCMessageDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<BatchRound0BCMessage> _instance;
+} _BatchRound0BCMessage_default_instance_;
+class BatchRound0P2PMessageDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<BatchRound0P2PMessage> _instance;
+} _BatchRound0P2PMessage_default_instance_;
+class BatchRound1BCMessageDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<BatchRound1BCMessage> _instance;
+} _BatchRound1BCMessage_default_instance_;
+class PresignRound1BCMessageDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<PresignRound1BCMessage> _instance;
+} _PresignRound1BCMessage_default_instance_;
+class OnlineRound0BCMessageDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<OnlineRound0BCMessage> _instance;
+} _OnlineRound0BCMessage_default_instance_;
 }  // namespace sign
 }  // namespace Li24
 }  // namespace multi_party_ecdsa
@@ -77,7 +97,73 @@ static void InitDefaultsscc_info_Round1P2PMessage_Li24_2fsign_2eproto() {
 ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Round1P2PMessage_Li24_2fsign_2eproto =
     {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_Round1P2PMessage_Li24_2fsign_2eproto}, {}};
 
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_Li24_2fsign_2eproto[3];
+static void InitDefaultsscc_info_BatchRound0BCMessage_Li24_2fsign_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::safeheron::proto::multi_party_ecdsa::Li24::sign::_BatchRound0BCMessage_default_instance_;
+    new (ptr) ::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0BCMessage();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_BatchRound0BCMessage_Li24_2fsign_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_BatchRound0BCMessage_Li24_2fsign_2eproto}, {
+      &scc_info_CurvePoint_curve_5fpoint_2eproto.base,}};
+
+static void InitDefaultsscc_info_BatchRound0P2PMessage_Li24_2fsign_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::safeheron::proto::multi_party_ecdsa::Li24::sign::_BatchRound0P2PMessage_default_instance_;
+    new (ptr) ::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0P2PMessage();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_BatchRound0P2PMessage_Li24_2fsign_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_BatchRound0P2PMessage_Li24_2fsign_2eproto}, {}};
+
+static void InitDefaultsscc_info_BatchRound1BCMessage_Li24_2fsign_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::safeheron::proto::multi_party_ecdsa::Li24::sign::_BatchRound1BCMessage_default_instance_;
+    new (ptr) ::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound1BCMessage();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_BatchRound1BCMessage_Li24_2fsign_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_BatchRound1BCMessage_Li24_2fsign_2eproto}, {}};
+
+static void InitDefaultsscc_info_PresignRound1BCMessage_Li24_2fsign_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::safeheron::proto::multi_party_ecdsa::Li24::sign::_PresignRound1BCMessage_default_instance_;
+    new (ptr) ::safeheron::proto::multi_party_ecdsa::Li24::sign::PresignRound1BCMessage();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_PresignRound1BCMessage_Li24_2fsign_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_PresignRound1BCMessage_Li24_2fsign_2eproto}, {}};
+
+static void InitDefaultsscc_info_OnlineRound0BCMessage_Li24_2fsign_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::safeheron::proto::multi_party_ecdsa::Li24::sign::_OnlineRound0BCMessage_default_instance_;
+    new (ptr) ::safeheron::proto::multi_party_ecdsa::Li24::sign::OnlineRound0BCMessage();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_OnlineRound0BCMessage_Li24_2fsign_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_OnlineRound0BCMessage_Li24_2fsign_2eproto}, {}};
+
+static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_Li24_2fsign_2eproto[8];
 static constexpr ::PROTOBUF_NAMESPACE_ID::EnumDescriptor const** file_level_enum_descriptors_Li24_2fsign_2eproto = nullptr;
 static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_Li24_2fsign_2eproto = nullptr;
 
@@ -96,6 +182,9 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_Li24_2fsign_2eproto::offsets[]
   PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round0P2PMessage, w_),
   PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round0P2PMessage, k_),
   PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round0P2PMessage, phi_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round0P2PMessage, w_bin_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round0P2PMessage, k_bin_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round0P2PMessage, phi_bin_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round1P2PMessage, _internal_metadata_),
   ~0u,  // no _extensions_
@@ -103,42 +192,113 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_Li24_2fsign_2eproto::offsets[]
   ~0u,  // no _weak_field_map_
   PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round1P2PMessage, delta_),
   PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round1P2PMessage, v_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round1P2PMessage, delta_bin_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round1P2PMessage, v_bin_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0BCMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0BCMessage, gk_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0P2PMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0P2PMessage, w_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0P2PMessage, k_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0P2PMessage, phi_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0P2PMessage, w_bin_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0P2PMessage, k_bin_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0P2PMessage, phi_bin_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound1BCMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound1BCMessage, delta_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound1BCMessage, v_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound1BCMessage, delta_bin_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound1BCMessage, v_bin_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::PresignRound1BCMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::PresignRound1BCMessage, v_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::PresignRound1BCMessage, v_bin_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::OnlineRound0BCMessage, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::OnlineRound0BCMessage, r_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::OnlineRound0BCMessage, delta_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::OnlineRound0BCMessage, r_bin_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::OnlineRound0BCMessage, delta_bin_),
 };
 static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round0BCMessage)},
   { 6, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round0P2PMessage)},
-  { 14, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round1P2PMessage)},
+  { 17, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round1P2PMessage)},
+  { 26, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0BCMessage)},
+  { 32, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0P2PMessage)},
+  { 43, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound1BCMessage)},
+  { 52, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::sign::PresignRound1BCMessage)},
+  { 59, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::sign::OnlineRound0BCMessage)},
 };
 
 static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::safeheron::proto::multi_party_ecdsa::Li24::sign::_Round0BCMessage_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::safeheron::proto::multi_party_ecdsa::Li24::sign::_Round0P2PMessage_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::safeheron::proto::multi_party_ecdsa::Li24::sign::_Round1P2PMessage_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::safeheron::proto::multi_party_ecdsa::Li24::sign::_BatchRound0BCMessage_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::safeheron::proto::multi_party_ecdsa::Li24::sign::_BatchRound0P2PMessage_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::safeheron::proto::multi_party_ecdsa::Li24::sign::_BatchRound1BCMessage_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::safeheron::proto::multi_party_ecdsa::Li24::sign::_PresignRound1BCMessage_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::safeheron::proto::multi_party_ecdsa::Li24::sign::_OnlineRound0BCMessage_default_instance_),
 };
 
 const char descriptor_table_protodef_Li24_2fsign_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
   "\n\017Li24/sign.proto\022+safeheron.proto.multi"
   "_party_ecdsa.Li24.sign\032\021curve_point.prot"
   "o\":\n\017Round0BCMessage\022\'\n\002GK\030\001 \001(\0132\033.safeh"
-  "eron.proto.CurvePoint\"5\n\020Round0P2PMessag"
-  "e\022\t\n\001w\030\001 \001(\t\022\t\n\001k\030\002 \001(\t\022\013\n\003phi\030\003 \001(\t\",\n\020"
-  "Round1P2PMessage\022\r\n\005delta\030\001 \001(\t\022\t\n\001v\030\002 \001"
-  "(\tb\006proto3"
+  "eron.proto.CurvePoint\"d\n\020Round0P2PMessag"
+  "e\022\t\n\001w\030\001 \001(\t\022\t\n\001k\030\002 \001(\t\022\013\n\003phi\030\003 \001(\t\022\r\n\005"
+  "w_bin\030\004 \001(\014\022\r\n\005k_bin\030\005 \001(\014\022\017\n\007phi_bin\030\006 "
+  "\001(\014\"N\n\020Round1P2PMessage\022\r\n\005delta\030\001 \001(\t\022\t"
+  "\n\001v\030\002 \001(\t\022\021\n\tdelta_bin\030\003 \001(\014\022\r\n\005v_bin\030\004 "
+  "\001(\014\"?\n\024BatchRound0BCMessage\022\'\n\002GK\030\001 \003(\0132"
+  "\033.safeheron.proto.CurvePoint\"i\n\025BatchRou"
+  "nd0P2PMessage\022\t\n\001w\030\001 \003(\t\022\t\n\001k\030\002 \003(\t\022\013\n\003p"
+  "hi\030\003 \003(\t\022\r\n\005w_bin\030\004 \003(\014\022\r\n\005k_bin\030\005 \003(\014\022\017"
+  "\n\007phi_bin\030\006 \003(\014\"R\n\024BatchRound1BCMessage\022"
+  "\r\n\005delta\030\001 \003(\t\022\t\n\001v\030\002 \003(\t\022\021\n\tdelta_bin\030\003"
+  " \003(\014\022\r\n\005v_bin\030\004 \003(\014\"2\n\026PresignRound1BCMe"
+  "ssage\022\t\n\001v\030\001 \003(\t\022\r\n\005v_bin\030\002 \003(\014\"S\n\025Onlin"
+  "eRound0BCMessage\022\t\n\001r\030\001 \001(\t\022\r\n\005delta\030\002 \001"
+  "(\t\022\r\n\005r_bin\030\003 \001(\014\022\021\n\tdelta_bin\030\004 \001(\014b\006pr"
+  "oto3"
   ;
 static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_Li24_2fsign_2eproto_deps[1] = {
   &::descriptor_table_curve_5fpoint_2eproto,
 };
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_Li24_2fsign_2eproto_sccs[3] = {
+static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_Li24_2fsign_2eproto_sccs[8] = {
   &scc_info_Round0BCMessage_Li24_2fsign_2eproto.base,
   &scc_info_Round0P2PMessage_Li24_2fsign_2eproto.base,
   &scc_info_Round1P2PMessage_Li24_2fsign_2eproto.base,
+  &scc_info_BatchRound0BCMessage_Li24_2fsign_2eproto.base,
+  &scc_info_BatchRound0P2PMessage_Li24_2fsign_2eproto.base,
+  &scc_info_BatchRound1BCMessage_Li24_2fsign_2eproto.base,
+  &scc_info_PresignRound1BCMessage_Li24_2fsign_2eproto.base,
+  &scc_info_OnlineRound0BCMessage_Li24_2fsign_2eproto.base,
 };
 static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_Li24_2fsign_2eproto_once;
 const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_Li24_2fsign_2eproto = {
-  false, false, descriptor_table_protodef_Li24_2fsign_2eproto, "Li24/sign.proto", 250,
-  &descriptor_table_Li24_2fsign_2eproto_once, descriptor_table_Li24_2fsign_2eproto_sccs, descriptor_table_Li24_2fsign_2eproto_deps, 3, 1,
+  false, false, descriptor_table_protodef_Li24_2fsign_2eproto, "Li24/sign.proto", 724,
+  &descriptor_table_Li24_2fsign_2eproto_once, descriptor_table_Li24_2fsign_2eproto_sccs, descriptor_table_Li24_2fsign_2eproto_deps, 8, 1,
   schemas, file_default_instances, TableStruct_Li24_2fsign_2eproto::offsets,
-  file_level_metadata_Li24_2fsign_2eproto, 3, file_level_enum_descriptors_Li24_2fsign_2eproto, file_level_service_descriptors_Li24_2fsign_2eproto,
+  file_level_metadata_Li24_2fsign_2eproto, 8, file_level_enum_descriptors_Li24_2fsign_2eproto, file_level_service_descriptors_Li24_2fsign_2eproto,
 };
 
 // Force running AddDescriptors() at dynamic initialization time.
@@ -395,6 +555,21 @@ Round0P2PMessage::Round0P2PMessage(const Round0P2PMessage& from)
     phi_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_phi(), 
       GetArena());
   }
+  w_bin_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_w_bin().empty()) {
+    w_bin_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_w_bin(), 
+      GetArena());
+  }
+  k_bin_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_k_bin().empty()) {
+    k_bin_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_k_bin(), 
+      GetArena());
+  }
+  phi_bin_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_phi_bin().empty()) {
+    phi_bin_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_phi_bin(), 
+      GetArena());
+  }
   // @@protoc_insertion_point(copy_constructor:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage)
 }
 
@@ -403,6 +578,9 @@ void Round0P2PMessage::SharedCtor() {
   w_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
   k_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
   phi_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  w_bin_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  k_bin_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  phi_bin_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
 
 Round0P2PMessage::~Round0P2PMessage() {
@@ -416,6 +594,9 @@ void Round0P2PMessage::SharedDtor() {
   w_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
   k_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
   phi_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  w_bin_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  k_bin_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  phi_bin_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
 
 void Round0P2PMessage::ArenaDtor(void* object) {
@@ -442,6 +623,9 @@ void Round0P2PMessage::Clear() {
   w_.ClearToEmpty();
   k_.ClearToEmpty();
   phi_.ClearToEmpty();
+  w_bin_.ClearToEmpty();
+  k_bin_.ClearToEmpty();
+  phi_bin_.ClearToEmpty();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -479,6 +663,30 @@ const char* Round0P2PMessage::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPA
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
+      // bytes w_bin = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+          auto str = _internal_mutable_w_bin();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // bytes k_bin = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+          auto str = _internal_mutable_k_bin();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // bytes phi_bin = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
+          auto str = _internal_mutable_phi_bin();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
       default: {
       handle_unusual:
         if ((tag & 7) == 4 || tag == 0) {
@@ -537,6 +745,24 @@ failure:
         3, this->_internal_phi(), target);
   }
 
+  // bytes w_bin = 4;
+  if (this->w_bin().size() > 0) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_w_bin(), target);
+  }
+
+  // bytes k_bin = 5;
+  if (this->k_bin().size() > 0) {
+    target = stream->WriteBytesMaybeAliased(
+        5, this->_internal_k_bin(), target);
+  }
+
+  // bytes phi_bin = 6;
+  if (this->phi_bin().size() > 0) {
+    target = stream->WriteBytesMaybeAliased(
+        6, this->_internal_phi_bin(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -574,6 +800,27 @@ size_t Round0P2PMessage::ByteSizeLong() const {
         this->_internal_phi());
   }
 
+  // bytes w_bin = 4;
+  if (this->w_bin().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_w_bin());
+  }
+
+  // bytes k_bin = 5;
+  if (this->k_bin().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_k_bin());
+  }
+
+  // bytes phi_bin = 6;
+  if (this->phi_bin().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_phi_bin());
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
         _internal_metadata_, total_size, &_cached_size_);
@@ -614,6 +861,15 @@ void Round0P2PMessage::MergeFrom(const Round0P2PMessage& from) {
   if (from.phi().size() > 0) {
     _internal_set_phi(from._internal_phi());
   }
+  if (from.w_bin().size() > 0) {
+    _internal_set_w_bin(from._internal_w_bin());
+  }
+  if (from.k_bin().size() > 0) {
+    _internal_set_k_bin(from._internal_k_bin());
+  }
+  if (from.phi_bin().size() > 0) {
+    _internal_set_phi_bin(from._internal_phi_bin());
+  }
 }
 
 void Round0P2PMessage::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
@@ -640,6 +896,9 @@ void Round0P2PMessage::InternalSwap(Round0P2PMessage* other) {
   w_.Swap(&other->w_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
   k_.Swap(&other->k_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
   phi_.Swap(&other->phi_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  w_bin_.Swap(&other->w_bin_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  k_bin_.Swap(&other->k_bin_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  phi_bin_.Swap(&other->phi_bin_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Round0P2PMessage::GetMetadata() const {
@@ -672,6 +931,16 @@ Round1P2PMessage::Round1P2PMessage(const Round1P2PMessage& from)
     v_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_v(), 
       GetArena());
   }
+  delta_bin_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_delta_bin().empty()) {
+    delta_bin_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_delta_bin(), 
+      GetArena());
+  }
+  v_bin_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_v_bin().empty()) {
+    v_bin_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_v_bin(), 
+      GetArena());
+  }
   // @@protoc_insertion_point(copy_constructor:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage)
 }
 
@@ -679,6 +948,8 @@ void Round1P2PMessage::SharedCtor() {
   ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_Round1P2PMessage_Li24_2fsign_2eproto.base);
   delta_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
   v_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  delta_bin_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  v_bin_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
 
 Round1P2PMessage::~Round1P2PMessage() {
@@ -691,6 +962,8 @@ void Round1P2PMessage::SharedDtor() {
   GOOGLE_DCHECK(GetArena() == nullptr);
   delta_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
   v_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  delta_bin_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  v_bin_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
 }
 
 void Round1P2PMessage::ArenaDtor(void* object) {
@@ -716,6 +989,8 @@ void Round1P2PMessage::Clear() {
 
   delta_.ClearToEmpty();
   v_.ClearToEmpty();
+  delta_bin_.ClearToEmpty();
+  v_bin_.ClearToEmpty();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -744,6 +1019,22 @@ const char* Round1P2PMessage::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPA
           CHK_(ptr);
         } else goto handle_unusual;
         continue;
+      // bytes delta_bin = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+          auto str = _internal_mutable_delta_bin();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // bytes v_bin = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+          auto str = _internal_mutable_v_bin();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
       default: {
       handle_unusual:
         if ((tag & 7) == 4 || tag == 0) {
@@ -792,6 +1083,18 @@ failure:
         2, this->_internal_v(), target);
   }
 
+  // bytes delta_bin = 3;
+  if (this->delta_bin().size() > 0) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_delta_bin(), target);
+  }
+
+  // bytes v_bin = 4;
+  if (this->v_bin().size() > 0) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_v_bin(), target);
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
@@ -822,6 +1125,20 @@ size_t Round1P2PMessage::ByteSizeLong() const {
         this->_internal_v());
   }
 
+  // bytes delta_bin = 3;
+  if (this->delta_bin().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_delta_bin());
+  }
+
+  // bytes v_bin = 4;
+  if (this->v_bin().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_v_bin());
+  }
+
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
         _internal_metadata_, total_size, &_cached_size_);
@@ -859,6 +1176,12 @@ void Round1P2PMessage::MergeFrom(const Round1P2PMessage& from) {
   if (from.v().size() > 0) {
     _internal_set_v(from._internal_v());
   }
+  if (from.delta_bin().size() > 0) {
+    _internal_set_delta_bin(from._internal_delta_bin());
+  }
+  if (from.v_bin().size() > 0) {
+    _internal_set_v_bin(from._internal_v_bin());
+  }
 }
 
 void Round1P2PMessage::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
@@ -884,6 +1207,8 @@ void Round1P2PMessage::InternalSwap(Round1P2PMessage* other) {
   _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
   delta_.Swap(&other->delta_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
   v_.Swap(&other->v_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  delta_bin_.Swap(&other->delta_bin_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  v_bin_.Swap(&other->v_bin_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Round1P2PMessage::GetMetadata() const {
@@ -891,21 +1216,1464 @@ void Round1P2PMessage::InternalSwap(Round1P2PMessage* other) {
 }
 
 
-// @@protoc_insertion_point(namespace_scope)
-}  // namespace sign
-}  // namespace Li24
-}  // namespace multi_party_ecdsa
-}  // namespace proto
-}  // namespace safeheron
-PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round0BCMessage* Arena::CreateMaybeMessage< ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round0BCMessage >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round0BCMessage >(arena);
+// ===================================================================
+
+class BatchRound0BCMessage::_Internal {
+ public:
+};
+
+void BatchRound0BCMessage::clear_gk() {
+  gk_.Clear();
 }
-template<> PROTOBUF_NOINLINE ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round0P2PMessage* Arena::CreateMaybeMessage< ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round0P2PMessage >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round0P2PMessage >(arena);
+BatchRound0BCMessage::BatchRound0BCMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  gk_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0BCMessage)
 }
-template<> PROTOBUF_NOINLINE ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round1P2PMessage* Arena::CreateMaybeMessage< ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round1P2PMessage >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round1P2PMessage >(arena);
+BatchRound0BCMessage::BatchRound0BCMessage(const BatchRound0BCMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      gk_(from.gk_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0BCMessage)
+}
+
+void BatchRound0BCMessage::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_BatchRound0BCMessage_Li24_2fsign_2eproto.base);
+}
+
+BatchRound0BCMessage::~BatchRound0BCMessage() {
+  // @@protoc_insertion_point(destructor:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0BCMessage)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void BatchRound0BCMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void BatchRound0BCMessage::ArenaDtor(void* object) {
+  BatchRound0BCMessage* _this = reinterpret_cast< BatchRound0BCMessage* >(object);
+  (void)_this;
+}
+void BatchRound0BCMessage::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void BatchRound0BCMessage::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const BatchRound0BCMessage& BatchRound0BCMessage::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_BatchRound0BCMessage_Li24_2fsign_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void BatchRound0BCMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0BCMessage)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  gk_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BatchRound0BCMessage::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // repeated .safeheron.proto.CurvePoint GK = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_gk(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* BatchRound0BCMessage::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0BCMessage)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .safeheron.proto.CurvePoint GK = 1;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_gk_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, this->_internal_gk(i), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0BCMessage)
+  return target;
+}
+
+size_t BatchRound0BCMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0BCMessage)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .safeheron.proto.CurvePoint GK = 1;
+  total_size += 1UL * this->_internal_gk_size();
+  for (const auto& msg : this->gk_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void BatchRound0BCMessage::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0BCMessage)
+  GOOGLE_DCHECK_NE(&from, this);
+  const BatchRound0BCMessage* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<BatchRound0BCMessage>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0BCMessage)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0BCMessage)
+    MergeFrom(*source);
+  }
+}
+
+void BatchRound0BCMessage::MergeFrom(const BatchRound0BCMessage& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0BCMessage)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  gk_.MergeFrom(from.gk_);
+}
+
+void BatchRound0BCMessage::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0BCMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void BatchRound0BCMessage::CopyFrom(const BatchRound0BCMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0BCMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BatchRound0BCMessage::IsInitialized() const {
+  return true;
+}
+
+void BatchRound0BCMessage::InternalSwap(BatchRound0BCMessage* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  gk_.InternalSwap(&other->gk_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BatchRound0BCMessage::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+class BatchRound0P2PMessage::_Internal {
+ public:
+};
+
+BatchRound0P2PMessage::BatchRound0P2PMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  w_(arena),
+  k_(arena),
+  phi_(arena),
+  w_bin_(arena),
+  k_bin_(arena),
+  phi_bin_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage)
+}
+BatchRound0P2PMessage::BatchRound0P2PMessage(const BatchRound0P2PMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      w_(from.w_),
+      k_(from.k_),
+      phi_(from.phi_),
+      w_bin_(from.w_bin_),
+      k_bin_(from.k_bin_),
+      phi_bin_(from.phi_bin_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage)
+}
+
+void BatchRound0P2PMessage::SharedCtor() {
+}
+
+BatchRound0P2PMessage::~BatchRound0P2PMessage() {
+  // @@protoc_insertion_point(destructor:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void BatchRound0P2PMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void BatchRound0P2PMessage::ArenaDtor(void* object) {
+  BatchRound0P2PMessage* _this = reinterpret_cast< BatchRound0P2PMessage* >(object);
+  (void)_this;
+}
+void BatchRound0P2PMessage::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void BatchRound0P2PMessage::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const BatchRound0P2PMessage& BatchRound0P2PMessage::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_BatchRound0P2PMessage_Li24_2fsign_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void BatchRound0P2PMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  w_.Clear();
+  k_.Clear();
+  phi_.Clear();
+  w_bin_.Clear();
+  k_bin_.Clear();
+  phi_bin_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BatchRound0P2PMessage::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // repeated string w = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_w();
+            ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w"));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated string k = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_k();
+            ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k"));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated string phi = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_phi();
+            ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi"));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated bytes w_bin = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_w_bin();
+            ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated bytes k_bin = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_k_bin();
+            ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated bytes phi_bin = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_phi_bin();
+            ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* BatchRound0P2PMessage::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated string w = 1;
+  for (int i = 0, n = this->_internal_w_size(); i < n; i++) {
+    const auto& s = this->_internal_w(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w");
+    target = stream->WriteString(1, s, target);
+  }
+
+  // repeated string k = 2;
+  for (int i = 0, n = this->_internal_k_size(); i < n; i++) {
+    const auto& s = this->_internal_k(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k");
+    target = stream->WriteString(2, s, target);
+  }
+
+  // repeated string phi = 3;
+  for (int i = 0, n = this->_internal_phi_size(); i < n; i++) {
+    const auto& s = this->_internal_phi(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi");
+    target = stream->WriteString(3, s, target);
+  }
+
+  // repeated bytes w_bin = 4;
+  for (int i = 0, n = this->_internal_w_bin_size(); i < n; i++) {
+    const auto& s = this->_internal_w_bin(i);
+    target = stream->WriteBytes(4, s, target);
+  }
+
+  // repeated bytes k_bin = 5;
+  for (int i = 0, n = this->_internal_k_bin_size(); i < n; i++) {
+    const auto& s = this->_internal_k_bin(i);
+    target = stream->WriteBytes(5, s, target);
+  }
+
+  // repeated bytes phi_bin = 6;
+  for (int i = 0, n = this->_internal_phi_bin_size(); i < n; i++) {
+    const auto& s = this->_internal_phi_bin(i);
+    target = stream->WriteBytes(6, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage)
+  return target;
+}
+
+size_t BatchRound0P2PMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string w = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(w_.size());
+  for (int i = 0, n = w_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      w_.Get(i));
+  }
+
+  // repeated string k = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(k_.size());
+  for (int i = 0, n = k_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      k_.Get(i));
+  }
+
+  // repeated string phi = 3;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(phi_.size());
+  for (int i = 0, n = phi_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      phi_.Get(i));
+  }
+
+  // repeated bytes w_bin = 4;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(w_bin_.size());
+  for (int i = 0, n = w_bin_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      w_bin_.Get(i));
+  }
+
+  // repeated bytes k_bin = 5;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(k_bin_.size());
+  for (int i = 0, n = k_bin_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      k_bin_.Get(i));
+  }
+
+  // repeated bytes phi_bin = 6;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(phi_bin_.size());
+  for (int i = 0, n = phi_bin_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      phi_bin_.Get(i));
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void BatchRound0P2PMessage::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage)
+  GOOGLE_DCHECK_NE(&from, this);
+  const BatchRound0P2PMessage* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<BatchRound0P2PMessage>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage)
+    MergeFrom(*source);
+  }
+}
+
+void BatchRound0P2PMessage::MergeFrom(const BatchRound0P2PMessage& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  w_.MergeFrom(from.w_);
+  k_.MergeFrom(from.k_);
+  phi_.MergeFrom(from.phi_);
+  w_bin_.MergeFrom(from.w_bin_);
+  k_bin_.MergeFrom(from.k_bin_);
+  phi_bin_.MergeFrom(from.phi_bin_);
+}
+
+void BatchRound0P2PMessage::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void BatchRound0P2PMessage::CopyFrom(const BatchRound0P2PMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BatchRound0P2PMessage::IsInitialized() const {
+  return true;
+}
+
+void BatchRound0P2PMessage::InternalSwap(BatchRound0P2PMessage* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  w_.InternalSwap(&other->w_);
+  k_.InternalSwap(&other->k_);
+  phi_.InternalSwap(&other->phi_);
+  w_bin_.InternalSwap(&other->w_bin_);
+  k_bin_.InternalSwap(&other->k_bin_);
+  phi_bin_.InternalSwap(&other->phi_bin_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BatchRound0P2PMessage::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+class BatchRound1BCMessage::_Internal {
+ public:
+};
+
+BatchRound1BCMessage::BatchRound1BCMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  delta_(arena),
+  v_(arena),
+  delta_bin_(arena),
+  v_bin_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage)
+}
+BatchRound1BCMessage::BatchRound1BCMessage(const BatchRound1BCMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      delta_(from.delta_),
+      v_(from.v_),
+      delta_bin_(from.delta_bin_),
+      v_bin_(from.v_bin_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage)
+}
+
+void BatchRound1BCMessage::SharedCtor() {
+}
+
+BatchRound1BCMessage::~BatchRound1BCMessage() {
+  // @@protoc_insertion_point(destructor:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void BatchRound1BCMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void BatchRound1BCMessage::ArenaDtor(void* object) {
+  BatchRound1BCMessage* _this = reinterpret_cast< BatchRound1BCMessage* >(object);
+  (void)_this;
+}
+void BatchRound1BCMessage::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void BatchRound1BCMessage::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const BatchRound1BCMessage& BatchRound1BCMessage::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_BatchRound1BCMessage_Li24_2fsign_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void BatchRound1BCMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  delta_.Clear();
+  v_.Clear();
+  delta_bin_.Clear();
+  v_bin_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BatchRound1BCMessage::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // repeated string delta = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_delta();
+            ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta"));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated string v = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_v();
+            ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v"));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated bytes delta_bin = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_delta_bin();
+            ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated bytes v_bin = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_v_bin();
+            ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* BatchRound1BCMessage::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated string delta = 1;
+  for (int i = 0, n = this->_internal_delta_size(); i < n; i++) {
+    const auto& s = this->_internal_delta(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta");
+    target = stream->WriteString(1, s, target);
+  }
+
+  // repeated string v = 2;
+  for (int i = 0, n = this->_internal_v_size(); i < n; i++) {
+    const auto& s = this->_internal_v(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v");
+    target = stream->WriteString(2, s, target);
+  }
+
+  // repeated bytes delta_bin = 3;
+  for (int i = 0, n = this->_internal_delta_bin_size(); i < n; i++) {
+    const auto& s = this->_internal_delta_bin(i);
+    target = stream->WriteBytes(3, s, target);
+  }
+
+  // repeated bytes v_bin = 4;
+  for (int i = 0, n = this->_internal_v_bin_size(); i < n; i++) {
+    const auto& s = this->_internal_v_bin(i);
+    target = stream->WriteBytes(4, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage)
+  return target;
+}
+
+size_t BatchRound1BCMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string delta = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(delta_.size());
+  for (int i = 0, n = delta_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      delta_.Get(i));
+  }
+
+  // repeated string v = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(v_.size());
+  for (int i = 0, n = v_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      v_.Get(i));
+  }
+
+  // repeated bytes delta_bin = 3;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(delta_bin_.size());
+  for (int i = 0, n = delta_bin_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      delta_bin_.Get(i));
+  }
+
+  // repeated bytes v_bin = 4;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(v_bin_.size());
+  for (int i = 0, n = v_bin_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      v_bin_.Get(i));
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void BatchRound1BCMessage::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage)
+  GOOGLE_DCHECK_NE(&from, this);
+  const BatchRound1BCMessage* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<BatchRound1BCMessage>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage)
+    MergeFrom(*source);
+  }
+}
+
+void BatchRound1BCMessage::MergeFrom(const BatchRound1BCMessage& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  delta_.MergeFrom(from.delta_);
+  v_.MergeFrom(from.v_);
+  delta_bin_.MergeFrom(from.delta_bin_);
+  v_bin_.MergeFrom(from.v_bin_);
+}
+
+void BatchRound1BCMessage::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void BatchRound1BCMessage::CopyFrom(const BatchRound1BCMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BatchRound1BCMessage::IsInitialized() const {
+  return true;
+}
+
+void BatchRound1BCMessage::InternalSwap(BatchRound1BCMessage* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  delta_.InternalSwap(&other->delta_);
+  v_.InternalSwap(&other->v_);
+  delta_bin_.InternalSwap(&other->delta_bin_);
+  v_bin_.InternalSwap(&other->v_bin_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BatchRound1BCMessage::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+class PresignRound1BCMessage::_Internal {
+ public:
+};
+
+PresignRound1BCMessage::PresignRound1BCMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  v_(arena),
+  v_bin_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage)
+}
+PresignRound1BCMessage::PresignRound1BCMessage(const PresignRound1BCMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      v_(from.v_),
+      v_bin_(from.v_bin_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage)
+}
+
+void PresignRound1BCMessage::SharedCtor() {
+}
+
+PresignRound1BCMessage::~PresignRound1BCMessage() {
+  // @@protoc_insertion_point(destructor:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void PresignRound1BCMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+}
+
+void PresignRound1BCMessage::ArenaDtor(void* object) {
+  PresignRound1BCMessage* _this = reinterpret_cast< PresignRound1BCMessage* >(object);
+  (void)_this;
+}
+void PresignRound1BCMessage::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void PresignRound1BCMessage::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const PresignRound1BCMessage& PresignRound1BCMessage::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_PresignRound1BCMessage_Li24_2fsign_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void PresignRound1BCMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  v_.Clear();
+  v_bin_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PresignRound1BCMessage::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // repeated string v = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_v();
+            ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v"));
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // repeated bytes v_bin = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_v_bin();
+            ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* PresignRound1BCMessage::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated string v = 1;
+  for (int i = 0, n = this->_internal_v_size(); i < n; i++) {
+    const auto& s = this->_internal_v(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v");
+    target = stream->WriteString(1, s, target);
+  }
+
+  // repeated bytes v_bin = 2;
+  for (int i = 0, n = this->_internal_v_bin_size(); i < n; i++) {
+    const auto& s = this->_internal_v_bin(i);
+    target = stream->WriteBytes(2, s, target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage)
+  return target;
+}
+
+size_t PresignRound1BCMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated string v = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(v_.size());
+  for (int i = 0, n = v_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      v_.Get(i));
+  }
+
+  // repeated bytes v_bin = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(v_bin_.size());
+  for (int i = 0, n = v_bin_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      v_bin_.Get(i));
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void PresignRound1BCMessage::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage)
+  GOOGLE_DCHECK_NE(&from, this);
+  const PresignRound1BCMessage* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<PresignRound1BCMessage>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage)
+    MergeFrom(*source);
+  }
+}
+
+void PresignRound1BCMessage::MergeFrom(const PresignRound1BCMessage& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  v_.MergeFrom(from.v_);
+  v_bin_.MergeFrom(from.v_bin_);
+}
+
+void PresignRound1BCMessage::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void PresignRound1BCMessage::CopyFrom(const PresignRound1BCMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PresignRound1BCMessage::IsInitialized() const {
+  return true;
+}
+
+void PresignRound1BCMessage::InternalSwap(PresignRound1BCMessage* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  v_.InternalSwap(&other->v_);
+  v_bin_.InternalSwap(&other->v_bin_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PresignRound1BCMessage::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+class OnlineRound0BCMessage::_Internal {
+ public:
+};
+
+OnlineRound0BCMessage::OnlineRound0BCMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage)
+}
+OnlineRound0BCMessage::OnlineRound0BCMessage(const OnlineRound0BCMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  r_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_r().empty()) {
+    r_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_r(), 
+      GetArena());
+  }
+  delta_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_delta().empty()) {
+    delta_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_delta(), 
+      GetArena());
+  }
+  r_bin_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_r_bin().empty()) {
+    r_bin_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_r_bin(), 
+      GetArena());
+  }
+  delta_bin_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_delta_bin().empty()) {
+    delta_bin_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, from._internal_delta_bin(), 
+      GetArena());
+  }
+  // @@protoc_insertion_point(copy_constructor:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage)
+}
+
+void OnlineRound0BCMessage::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_OnlineRound0BCMessage_Li24_2fsign_2eproto.base);
+  r_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  delta_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  r_bin_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  delta_bin_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+
+OnlineRound0BCMessage::~OnlineRound0BCMessage() {
+  // @@protoc_insertion_point(destructor:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void OnlineRound0BCMessage::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  r_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  delta_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  r_bin_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  delta_bin_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+}
+
+void OnlineRound0BCMessage::ArenaDtor(void* object) {
+  OnlineRound0BCMessage* _this = reinterpret_cast< OnlineRound0BCMessage* >(object);
+  (void)_this;
+}
+void OnlineRound0BCMessage::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void OnlineRound0BCMessage::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const OnlineRound0BCMessage& OnlineRound0BCMessage::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_OnlineRound0BCMessage_Li24_2fsign_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void OnlineRound0BCMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  r_.ClearToEmpty();
+  delta_.ClearToEmpty();
+  r_bin_.ClearToEmpty();
+  delta_bin_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* OnlineRound0BCMessage::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // string r = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          auto str = _internal_mutable_r();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.r"));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // string delta = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          auto str = _internal_mutable_delta();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.delta"));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // bytes r_bin = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+          auto str = _internal_mutable_r_bin();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // bytes delta_bin = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+          auto str = _internal_mutable_delta_bin();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* OnlineRound0BCMessage::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string r = 1;
+  if (this->r().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_r().data(), static_cast<int>(this->_internal_r().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.r");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_r(), target);
+  }
+
+  // string delta = 2;
+  if (this->delta().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_delta().data(), static_cast<int>(this->_internal_delta().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.delta");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_delta(), target);
+  }
+
+  // bytes r_bin = 3;
+  if (this->r_bin().size() > 0) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_r_bin(), target);
+  }
+
+  // bytes delta_bin = 4;
+  if (this->delta_bin().size() > 0) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_delta_bin(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage)
+  return target;
+}
+
+size_t OnlineRound0BCMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string r = 1;
+  if (this->r().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_r());
+  }
+
+  // string delta = 2;
+  if (this->delta().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_delta());
+  }
+
+  // bytes r_bin = 3;
+  if (this->r_bin().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_r_bin());
+  }
+
+  // bytes delta_bin = 4;
+  if (this->delta_bin().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_delta_bin());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void OnlineRound0BCMessage::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage)
+  GOOGLE_DCHECK_NE(&from, this);
+  const OnlineRound0BCMessage* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<OnlineRound0BCMessage>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage)
+    MergeFrom(*source);
+  }
+}
+
+void OnlineRound0BCMessage::MergeFrom(const OnlineRound0BCMessage& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.r().size() > 0) {
+    _internal_set_r(from._internal_r());
+  }
+  if (from.delta().size() > 0) {
+    _internal_set_delta(from._internal_delta());
+  }
+  if (from.r_bin().size() > 0) {
+    _internal_set_r_bin(from._internal_r_bin());
+  }
+  if (from.delta_bin().size() > 0) {
+    _internal_set_delta_bin(from._internal_delta_bin());
+  }
+}
+
+void OnlineRound0BCMessage::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void OnlineRound0BCMessage::CopyFrom(const OnlineRound0BCMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool OnlineRound0BCMessage::IsInitialized() const {
+  return true;
+}
+
+void OnlineRound0BCMessage::InternalSwap(OnlineRound0BCMessage* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  r_.Swap(&other->r_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  delta_.Swap(&other->delta_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  r_bin_.Swap(&other->r_bin_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  delta_bin_.Swap(&other->delta_bin_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata OnlineRound0BCMessage::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace sign
+}  // namespace Li24
+}  // namespace multi_party_ecdsa
+}  // namespace proto
+}  // namespace safeheron
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round0BCMessage* Arena::CreateMaybeMessage< ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round0BCMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round0BCMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round0P2PMessage* Arena::CreateMaybeMessage< ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round0P2PMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round0P2PMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round1P2PMessage* Arena::CreateMaybeMessage< ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round1P2PMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round1P2PMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0BCMessage* Arena::CreateMaybeMessage< ::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0BCMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0BCMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0P2PMessage* Arena::CreateMaybeMessage< ::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0P2PMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0P2PMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound1BCMessage* Arena::CreateMaybeMessage< ::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound1BCMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound1BCMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::safeheron::proto::multi_party_ecdsa::Li24::sign::PresignRound1BCMessage* Arena::CreateMaybeMessage< ::safeheron::proto::multi_party_ecdsa::Li24::sign::PresignRound1BCMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::safeheron::proto::multi_party_ecdsa::Li24::sign::PresignRound1BCMessage >(arena);
+}
+template<> PROTOBUF_NOINLINE ::safeheron::proto::multi_party_ecdsa::Li24::sign::OnlineRound0BCMessage* Arena::CreateMaybeMessage< ::safeheron::proto::multi_party_ecdsa::Li24::sign::OnlineRound0BCMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::safeheron::proto::multi_party_ecdsa::Li24::sign::OnlineRound0BCMessage >(arena);
 }
 PROTOBUF_NAMESPACE_CLOSE
 
@@ -47,7 +47,7 @@ struct TableStruct_Li24_2fsign_2eproto {
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
   static const ::PROTOBUF_NAMESPACE_ID::internal::AuxiliaryParseTableField aux[]
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[3]
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[8]
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
   static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
   static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
@@ -59,6 +59,21 @@ namespace proto {
 namespace multi_party_ecdsa {
 namespace Li24 {
 namespace sign {
+class BatchRound0BCMessage;
+class BatchRound0BCMessageDefaultTypeInternal;
+extern BatchRound0BCMessageDefaultTypeInternal _BatchRound0BCMessage_default_instance_;
+class BatchRound0P2PMessage;
+class BatchRound0P2PMessageDefaultTypeInternal;
+extern BatchRound0P2PMessageDefaultTypeInternal _BatchRound0P2PMessage_default_instance_;
+class BatchRound1BCMessage;
+class BatchRound1BCMessageDefaultTypeInternal;
+extern BatchRound1BCMessageDefaultTypeInternal _BatchRound1BCMessage_default_instance_;
+class OnlineRound0BCMessage;
+class OnlineRound0BCMessageDefaultTypeInternal;
+extern OnlineRound0BCMessageDefaultTypeInternal _OnlineRound0BCMessage_default_instance_;
+class PresignRound1BCMessage;
+class PresignRound1BCMessageDefaultTypeInternal;
+extern PresignRound1BCMessageDefaultTypeInternal _PresignRound1BCMessage_default_instance_;
 class Round0BCMessage;
 class Round0BCMessageDefaultTypeInternal;
 extern Round0BCMessageDefaultTypeInternal _Round0BCMessage_default_instance_;
@@ -74,6 +89,11 @@ extern Round1P2PMessageDefaultTypeInternal _Round1P2PMessage_default_instance_;
 }  // namespace proto
 }  // namespace safeheron
 PROTOBUF_NAMESPACE_OPEN
+template<> ::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0BCMessage* Arena::CreateMaybeMessage<::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0BCMessage>(Arena*);
+template<> ::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0P2PMessage* Arena::CreateMaybeMessage<::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0P2PMessage>(Arena*);
+template<> ::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound1BCMessage* Arena::CreateMaybeMessage<::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound1BCMessage>(Arena*);
+template<> ::safeheron::proto::multi_party_ecdsa::Li24::sign::OnlineRound0BCMessage* Arena::CreateMaybeMessage<::safeheron::proto::multi_party_ecdsa::Li24::sign::OnlineRound0BCMessage>(Arena*);
+template<> ::safeheron::proto::multi_party_ecdsa::Li24::sign::PresignRound1BCMessage* Arena::CreateMaybeMessage<::safeheron::proto::multi_party_ecdsa::Li24::sign::PresignRound1BCMessage>(Arena*);
 template<> ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round0BCMessage* Arena::CreateMaybeMessage<::safeheron::proto::multi_party_ecdsa::Li24::sign::Round0BCMessage>(Arena*);
 template<> ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round0P2PMessage* Arena::CreateMaybeMessage<::safeheron::proto::multi_party_ecdsa::Li24::sign::Round0P2PMessage>(Arena*);
 template<> ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round1P2PMessage* Arena::CreateMaybeMessage<::safeheron::proto::multi_party_ecdsa::Li24::sign::Round1P2PMessage>(Arena*);
@@ -346,6 +366,9 @@ class Round0P2PMessage PROTOBUF_FINAL :
     kWFieldNumber = 1,
     kKFieldNumber = 2,
     kPhiFieldNumber = 3,
+    kWBinFieldNumber = 4,
+    kKBinFieldNumber = 5,
+    kPhiBinFieldNumber = 6,
   };
   // string w = 1;
   void clear_w();
@@ -395,6 +418,54 @@ class Round0P2PMessage PROTOBUF_FINAL :
   std::string* _internal_mutable_phi();
   public:
 
+  // bytes w_bin = 4;
+  void clear_w_bin();
+  const std::string& w_bin() const;
+  void set_w_bin(const std::string& value);
+  void set_w_bin(std::string&& value);
+  void set_w_bin(const char* value);
+  void set_w_bin(const void* value, size_t size);
+  std::string* mutable_w_bin();
+  std::string* release_w_bin();
+  void set_allocated_w_bin(std::string* w_bin);
+  private:
+  const std::string& _internal_w_bin() const;
+  void _internal_set_w_bin(const std::string& value);
+  std::string* _internal_mutable_w_bin();
+  public:
+
+  // bytes k_bin = 5;
+  void clear_k_bin();
+  const std::string& k_bin() const;
+  void set_k_bin(const std::string& value);
+  void set_k_bin(std::string&& value);
+  void set_k_bin(const char* value);
+  void set_k_bin(const void* value, size_t size);
+  std::string* mutable_k_bin();
+  std::string* release_k_bin();
+  void set_allocated_k_bin(std::string* k_bin);
+  private:
+  const std::string& _internal_k_bin() const;
+  void _internal_set_k_bin(const std::string& value);
+  std::string* _internal_mutable_k_bin();
+  public:
+
+  // bytes phi_bin = 6;
+  void clear_phi_bin();
+  const std::string& phi_bin() const;
+  void set_phi_bin(const std::string& value);
+  void set_phi_bin(std::string&& value);
+  void set_phi_bin(const char* value);
+  void set_phi_bin(const void* value, size_t size);
+  std::string* mutable_phi_bin();
+  std::string* release_phi_bin();
+  void set_allocated_phi_bin(std::string* phi_bin);
+  private:
+  const std::string& _internal_phi_bin() const;
+  void _internal_set_phi_bin(const std::string& value);
+  std::string* _internal_mutable_phi_bin();
+  public:
+
   // @@protoc_insertion_point(class_scope:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage)
  private:
   class _Internal;
@@ -405,6 +476,9 @@ class Round0P2PMessage PROTOBUF_FINAL :
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr w_;
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr k_;
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr phi_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr w_bin_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr k_bin_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr phi_bin_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_Li24_2fsign_2eproto;
 };
@@ -524,6 +598,8 @@ class Round1P2PMessage PROTOBUF_FINAL :
   enum : int {
     kDeltaFieldNumber = 1,
     kVFieldNumber = 2,
+    kDeltaBinFieldNumber = 3,
+    kVBinFieldNumber = 4,
   };
   // string delta = 1;
   void clear_delta();
@@ -557,6 +633,38 @@ class Round1P2PMessage PROTOBUF_FINAL :
   std::string* _internal_mutable_v();
   public:
 
+  // bytes delta_bin = 3;
+  void clear_delta_bin();
+  const std::string& delta_bin() const;
+  void set_delta_bin(const std::string& value);
+  void set_delta_bin(std::string&& value);
+  void set_delta_bin(const char* value);
+  void set_delta_bin(const void* value, size_t size);
+  std::string* mutable_delta_bin();
+  std::string* release_delta_bin();
+  void set_allocated_delta_bin(std::string* delta_bin);
+  private:
+  const std::string& _internal_delta_bin() const;
+  void _internal_set_delta_bin(const std::string& value);
+  std::string* _internal_mutable_delta_bin();
+  public:
+
+  // bytes v_bin = 4;
+  void clear_v_bin();
+  const std::string& v_bin() const;
+  void set_v_bin(const std::string& value);
+  void set_v_bin(std::string&& value);
+  void set_v_bin(const char* value);
+  void set_v_bin(const void* value, size_t size);
+  std::string* mutable_v_bin();
+  std::string* release_v_bin();
+  void set_allocated_v_bin(std::string* v_bin);
+  private:
+  const std::string& _internal_v_bin() const;
+  void _internal_set_v_bin(const std::string& value);
+  std::string* _internal_mutable_v_bin();
+  public:
+
   // @@protoc_insertion_point(class_scope:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage)
  private:
   class _Internal;
@@ -566,339 +674,2802 @@ class Round1P2PMessage PROTOBUF_FINAL :
   typedef void DestructorSkippable_;
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr delta_;
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr v_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr delta_bin_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr v_bin_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_Li24_2fsign_2eproto;
 };
-// ===================================================================
+// -------------------------------------------------------------------
 
+class BatchRound0BCMessage PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0BCMessage) */ {
+ public:
+  inline BatchRound0BCMessage() : BatchRound0BCMessage(nullptr) {}
+  virtual ~BatchRound0BCMessage();
 
-// ===================================================================
+  BatchRound0BCMessage(const BatchRound0BCMessage& from);
+  BatchRound0BCMessage(BatchRound0BCMessage&& from) noexcept
+    : BatchRound0BCMessage() {
+    *this = ::std::move(from);
+  }
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// Round0BCMessage
+  inline BatchRound0BCMessage& operator=(const BatchRound0BCMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BatchRound0BCMessage& operator=(BatchRound0BCMessage&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
 
-// .safeheron.proto.CurvePoint GK = 1;
-inline bool Round0BCMessage::_internal_has_gk() const {
-  return this != internal_default_instance() && gk_ != nullptr;
-}
-inline bool Round0BCMessage::has_gk() const {
-  return _internal_has_gk();
-}
-inline const ::safeheron::proto::CurvePoint& Round0BCMessage::_internal_gk() const {
-  const ::safeheron::proto::CurvePoint* p = gk_;
-  return p != nullptr ? *p : reinterpret_cast<const ::safeheron::proto::CurvePoint&>(
-      ::safeheron::proto::_CurvePoint_default_instance_);
-}
-inline const ::safeheron::proto::CurvePoint& Round0BCMessage::gk() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0BCMessage.GK)
-  return _internal_gk();
-}
-inline void Round0BCMessage::unsafe_arena_set_allocated_gk(
-    ::safeheron::proto::CurvePoint* gk) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(gk_);
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
   }
-  gk_ = gk;
-  if (gk) {
-    
-  } else {
-    
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0BCMessage.GK)
-}
-inline ::safeheron::proto::CurvePoint* Round0BCMessage::release_gk() {
-  
-  ::safeheron::proto::CurvePoint* temp = gk_;
-  gk_ = nullptr;
-  if (GetArena() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
   }
-  return temp;
-}
-inline ::safeheron::proto::CurvePoint* Round0BCMessage::unsafe_arena_release_gk() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0BCMessage.GK)
-  
-  ::safeheron::proto::CurvePoint* temp = gk_;
-  gk_ = nullptr;
-  return temp;
-}
-inline ::safeheron::proto::CurvePoint* Round0BCMessage::_internal_mutable_gk() {
-  
-  if (gk_ == nullptr) {
-    auto* p = CreateMaybeMessage<::safeheron::proto::CurvePoint>(GetArena());
-    gk_ = p;
+  static const BatchRound0BCMessage& default_instance();
+
+  static inline const BatchRound0BCMessage* internal_default_instance() {
+    return reinterpret_cast<const BatchRound0BCMessage*>(
+               &_BatchRound0BCMessage_default_instance_);
   }
-  return gk_;
-}
-inline ::safeheron::proto::CurvePoint* Round0BCMessage::mutable_gk() {
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0BCMessage.GK)
-  return _internal_mutable_gk();
-}
-inline void Round0BCMessage::set_allocated_gk(::safeheron::proto::CurvePoint* gk) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
-  if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(gk_);
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(BatchRound0BCMessage& a, BatchRound0BCMessage& b) {
+    a.Swap(&b);
   }
-  if (gk) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(gk)->GetArena();
-    if (message_arena != submessage_arena) {
-      gk = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, gk, submessage_arena);
+  inline void Swap(BatchRound0BCMessage* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
-    
-  } else {
-    
   }
-  gk_ = gk;
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0BCMessage.GK)
-}
-
-// -------------------------------------------------------------------
+  void UnsafeArenaSwap(BatchRound0BCMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
 
-// Round0P2PMessage
+  // implements Message ----------------------------------------------
 
-// string w = 1;
-inline void Round0P2PMessage::clear_w() {
-  w_.ClearToEmpty();
-}
-inline const std::string& Round0P2PMessage::w() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.w)
-  return _internal_w();
-}
-inline void Round0P2PMessage::set_w(const std::string& value) {
-  _internal_set_w(value);
-  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.w)
-}
-inline std::string* Round0P2PMessage::mutable_w() {
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.w)
-  return _internal_mutable_w();
-}
-inline const std::string& Round0P2PMessage::_internal_w() const {
-  return w_.Get();
-}
-inline void Round0P2PMessage::_internal_set_w(const std::string& value) {
-  
-  w_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
-}
-inline void Round0P2PMessage::set_w(std::string&& value) {
-  
-  w_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.w)
-}
-inline void Round0P2PMessage::set_w(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  w_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.w)
-}
-inline void Round0P2PMessage::set_w(const char* value,
-    size_t size) {
-  
-  w_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.w)
-}
-inline std::string* Round0P2PMessage::_internal_mutable_w() {
-  
-  return w_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
-}
-inline std::string* Round0P2PMessage::release_w() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.w)
-  return w_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline void Round0P2PMessage::set_allocated_w(std::string* w) {
-  if (w != nullptr) {
-    
-  } else {
-    
+  inline BatchRound0BCMessage* New() const final {
+    return CreateMaybeMessage<BatchRound0BCMessage>(nullptr);
   }
-  w_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), w,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.w)
-}
 
-// string k = 2;
-inline void Round0P2PMessage::clear_k() {
-  k_.ClearToEmpty();
-}
-inline const std::string& Round0P2PMessage::k() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.k)
-  return _internal_k();
-}
-inline void Round0P2PMessage::set_k(const std::string& value) {
-  _internal_set_k(value);
-  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.k)
-}
-inline std::string* Round0P2PMessage::mutable_k() {
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.k)
-  return _internal_mutable_k();
-}
-inline const std::string& Round0P2PMessage::_internal_k() const {
-  return k_.Get();
-}
-inline void Round0P2PMessage::_internal_set_k(const std::string& value) {
-  
-  k_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
-}
-inline void Round0P2PMessage::set_k(std::string&& value) {
-  
-  k_.Set(
-    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.k)
-}
-inline void Round0P2PMessage::set_k(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  k_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.k)
-}
-inline void Round0P2PMessage::set_k(const char* value,
-    size_t size) {
-  
-  k_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.k)
-}
-inline std::string* Round0P2PMessage::_internal_mutable_k() {
-  
-  return k_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
-}
-inline std::string* Round0P2PMessage::release_k() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.k)
-  return k_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline void Round0P2PMessage::set_allocated_k(std::string* k) {
-  if (k != nullptr) {
-    
-  } else {
-    
+  BatchRound0BCMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<BatchRound0BCMessage>(arena);
   }
-  k_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), k,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.k)
-}
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const BatchRound0BCMessage& from);
+  void MergeFrom(const BatchRound0BCMessage& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
 
-// string phi = 3;
-inline void Round0P2PMessage::clear_phi() {
-  phi_.ClearToEmpty();
-}
-inline const std::string& Round0P2PMessage::phi() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.phi)
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BatchRound0BCMessage* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0BCMessage";
+  }
+  protected:
+  explicit BatchRound0BCMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_Li24_2fsign_2eproto);
+    return ::descriptor_table_Li24_2fsign_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kGKFieldNumber = 1,
+  };
+  // repeated .safeheron.proto.CurvePoint GK = 1;
+  int gk_size() const;
+  private:
+  int _internal_gk_size() const;
+  public:
+  void clear_gk();
+  ::safeheron::proto::CurvePoint* mutable_gk(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::safeheron::proto::CurvePoint >*
+      mutable_gk();
+  private:
+  const ::safeheron::proto::CurvePoint& _internal_gk(int index) const;
+  ::safeheron::proto::CurvePoint* _internal_add_gk();
+  public:
+  const ::safeheron::proto::CurvePoint& gk(int index) const;
+  ::safeheron::proto::CurvePoint* add_gk();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::safeheron::proto::CurvePoint >&
+      gk() const;
+
+  // @@protoc_insertion_point(class_scope:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0BCMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::safeheron::proto::CurvePoint > gk_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_Li24_2fsign_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BatchRound0P2PMessage PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage) */ {
+ public:
+  inline BatchRound0P2PMessage() : BatchRound0P2PMessage(nullptr) {}
+  virtual ~BatchRound0P2PMessage();
+
+  BatchRound0P2PMessage(const BatchRound0P2PMessage& from);
+  BatchRound0P2PMessage(BatchRound0P2PMessage&& from) noexcept
+    : BatchRound0P2PMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline BatchRound0P2PMessage& operator=(const BatchRound0P2PMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BatchRound0P2PMessage& operator=(BatchRound0P2PMessage&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const BatchRound0P2PMessage& default_instance();
+
+  static inline const BatchRound0P2PMessage* internal_default_instance() {
+    return reinterpret_cast<const BatchRound0P2PMessage*>(
+               &_BatchRound0P2PMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(BatchRound0P2PMessage& a, BatchRound0P2PMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BatchRound0P2PMessage* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BatchRound0P2PMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline BatchRound0P2PMessage* New() const final {
+    return CreateMaybeMessage<BatchRound0P2PMessage>(nullptr);
+  }
+
+  BatchRound0P2PMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<BatchRound0P2PMessage>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const BatchRound0P2PMessage& from);
+  void MergeFrom(const BatchRound0P2PMessage& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BatchRound0P2PMessage* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage";
+  }
+  protected:
+  explicit BatchRound0P2PMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_Li24_2fsign_2eproto);
+    return ::descriptor_table_Li24_2fsign_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kWFieldNumber = 1,
+    kKFieldNumber = 2,
+    kPhiFieldNumber = 3,
+    kWBinFieldNumber = 4,
+    kKBinFieldNumber = 5,
+    kPhiBinFieldNumber = 6,
+  };
+  // repeated string w = 1;
+  int w_size() const;
+  private:
+  int _internal_w_size() const;
+  public:
+  void clear_w();
+  const std::string& w(int index) const;
+  std::string* mutable_w(int index);
+  void set_w(int index, const std::string& value);
+  void set_w(int index, std::string&& value);
+  void set_w(int index, const char* value);
+  void set_w(int index, const char* value, size_t size);
+  std::string* add_w();
+  void add_w(const std::string& value);
+  void add_w(std::string&& value);
+  void add_w(const char* value);
+  void add_w(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& w() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_w();
+  private:
+  const std::string& _internal_w(int index) const;
+  std::string* _internal_add_w();
+  public:
+
+  // repeated string k = 2;
+  int k_size() const;
+  private:
+  int _internal_k_size() const;
+  public:
+  void clear_k();
+  const std::string& k(int index) const;
+  std::string* mutable_k(int index);
+  void set_k(int index, const std::string& value);
+  void set_k(int index, std::string&& value);
+  void set_k(int index, const char* value);
+  void set_k(int index, const char* value, size_t size);
+  std::string* add_k();
+  void add_k(const std::string& value);
+  void add_k(std::string&& value);
+  void add_k(const char* value);
+  void add_k(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& k() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_k();
+  private:
+  const std::string& _internal_k(int index) const;
+  std::string* _internal_add_k();
+  public:
+
+  // repeated string phi = 3;
+  int phi_size() const;
+  private:
+  int _internal_phi_size() const;
+  public:
+  void clear_phi();
+  const std::string& phi(int index) const;
+  std::string* mutable_phi(int index);
+  void set_phi(int index, const std::string& value);
+  void set_phi(int index, std::string&& value);
+  void set_phi(int index, const char* value);
+  void set_phi(int index, const char* value, size_t size);
+  std::string* add_phi();
+  void add_phi(const std::string& value);
+  void add_phi(std::string&& value);
+  void add_phi(const char* value);
+  void add_phi(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& phi() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_phi();
+  private:
+  const std::string& _internal_phi(int index) const;
+  std::string* _internal_add_phi();
+  public:
+
+  // repeated bytes w_bin = 4;
+  int w_bin_size() const;
+  private:
+  int _internal_w_bin_size() const;
+  public:
+  void clear_w_bin();
+  const std::string& w_bin(int index) const;
+  std::string* mutable_w_bin(int index);
+  void set_w_bin(int index, const std::string& value);
+  void set_w_bin(int index, std::string&& value);
+  void set_w_bin(int index, const char* value);
+  void set_w_bin(int index, const void* value, size_t size);
+  std::string* add_w_bin();
+  void add_w_bin(const std::string& value);
+  void add_w_bin(std::string&& value);
+  void add_w_bin(const char* value);
+  void add_w_bin(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& w_bin() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_w_bin();
+  private:
+  const std::string& _internal_w_bin(int index) const;
+  std::string* _internal_add_w_bin();
+  public:
+
+  // repeated bytes k_bin = 5;
+  int k_bin_size() const;
+  private:
+  int _internal_k_bin_size() const;
+  public:
+  void clear_k_bin();
+  const std::string& k_bin(int index) const;
+  std::string* mutable_k_bin(int index);
+  void set_k_bin(int index, const std::string& value);
+  void set_k_bin(int index, std::string&& value);
+  void set_k_bin(int index, const char* value);
+  void set_k_bin(int index, const void* value, size_t size);
+  std::string* add_k_bin();
+  void add_k_bin(const std::string& value);
+  void add_k_bin(std::string&& value);
+  void add_k_bin(const char* value);
+  void add_k_bin(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& k_bin() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_k_bin();
+  private:
+  const std::string& _internal_k_bin(int index) const;
+  std::string* _internal_add_k_bin();
+  public:
+
+  // repeated bytes phi_bin = 6;
+  int phi_bin_size() const;
+  private:
+  int _internal_phi_bin_size() const;
+  public:
+  void clear_phi_bin();
+  const std::string& phi_bin(int index) const;
+  std::string* mutable_phi_bin(int index);
+  void set_phi_bin(int index, const std::string& value);
+  void set_phi_bin(int index, std::string&& value);
+  void set_phi_bin(int index, const char* value);
+  void set_phi_bin(int index, const void* value, size_t size);
+  std::string* add_phi_bin();
+  void add_phi_bin(const std::string& value);
+  void add_phi_bin(std::string&& value);
+  void add_phi_bin(const char* value);
+  void add_phi_bin(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& phi_bin() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_phi_bin();
+  private:
+  const std::string& _internal_phi_bin(int index) const;
+  std::string* _internal_add_phi_bin();
+  public:
+
+  // @@protoc_insertion_point(class_scope:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> w_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> k_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> phi_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> w_bin_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> k_bin_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> phi_bin_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_Li24_2fsign_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BatchRound1BCMessage PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage) */ {
+ public:
+  inline BatchRound1BCMessage() : BatchRound1BCMessage(nullptr) {}
+  virtual ~BatchRound1BCMessage();
+
+  BatchRound1BCMessage(const BatchRound1BCMessage& from);
+  BatchRound1BCMessage(BatchRound1BCMessage&& from) noexcept
+    : BatchRound1BCMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline BatchRound1BCMessage& operator=(const BatchRound1BCMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BatchRound1BCMessage& operator=(BatchRound1BCMessage&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const BatchRound1BCMessage& default_instance();
+
+  static inline const BatchRound1BCMessage* internal_default_instance() {
+    return reinterpret_cast<const BatchRound1BCMessage*>(
+               &_BatchRound1BCMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(BatchRound1BCMessage& a, BatchRound1BCMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BatchRound1BCMessage* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BatchRound1BCMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline BatchRound1BCMessage* New() const final {
+    return CreateMaybeMessage<BatchRound1BCMessage>(nullptr);
+  }
+
+  BatchRound1BCMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<BatchRound1BCMessage>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const BatchRound1BCMessage& from);
+  void MergeFrom(const BatchRound1BCMessage& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BatchRound1BCMessage* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage";
+  }
+  protected:
+  explicit BatchRound1BCMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_Li24_2fsign_2eproto);
+    return ::descriptor_table_Li24_2fsign_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDeltaFieldNumber = 1,
+    kVFieldNumber = 2,
+    kDeltaBinFieldNumber = 3,
+    kVBinFieldNumber = 4,
+  };
+  // repeated string delta = 1;
+  int delta_size() const;
+  private:
+  int _internal_delta_size() const;
+  public:
+  void clear_delta();
+  const std::string& delta(int index) const;
+  std::string* mutable_delta(int index);
+  void set_delta(int index, const std::string& value);
+  void set_delta(int index, std::string&& value);
+  void set_delta(int index, const char* value);
+  void set_delta(int index, const char* value, size_t size);
+  std::string* add_delta();
+  void add_delta(const std::string& value);
+  void add_delta(std::string&& value);
+  void add_delta(const char* value);
+  void add_delta(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& delta() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_delta();
+  private:
+  const std::string& _internal_delta(int index) const;
+  std::string* _internal_add_delta();
+  public:
+
+  // repeated string v = 2;
+  int v_size() const;
+  private:
+  int _internal_v_size() const;
+  public:
+  void clear_v();
+  const std::string& v(int index) const;
+  std::string* mutable_v(int index);
+  void set_v(int index, const std::string& value);
+  void set_v(int index, std::string&& value);
+  void set_v(int index, const char* value);
+  void set_v(int index, const char* value, size_t size);
+  std::string* add_v();
+  void add_v(const std::string& value);
+  void add_v(std::string&& value);
+  void add_v(const char* value);
+  void add_v(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& v() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_v();
+  private:
+  const std::string& _internal_v(int index) const;
+  std::string* _internal_add_v();
+  public:
+
+  // repeated bytes delta_bin = 3;
+  int delta_bin_size() const;
+  private:
+  int _internal_delta_bin_size() const;
+  public:
+  void clear_delta_bin();
+  const std::string& delta_bin(int index) const;
+  std::string* mutable_delta_bin(int index);
+  void set_delta_bin(int index, const std::string& value);
+  void set_delta_bin(int index, std::string&& value);
+  void set_delta_bin(int index, const char* value);
+  void set_delta_bin(int index, const void* value, size_t size);
+  std::string* add_delta_bin();
+  void add_delta_bin(const std::string& value);
+  void add_delta_bin(std::string&& value);
+  void add_delta_bin(const char* value);
+  void add_delta_bin(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& delta_bin() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_delta_bin();
+  private:
+  const std::string& _internal_delta_bin(int index) const;
+  std::string* _internal_add_delta_bin();
+  public:
+
+  // repeated bytes v_bin = 4;
+  int v_bin_size() const;
+  private:
+  int _internal_v_bin_size() const;
+  public:
+  void clear_v_bin();
+  const std::string& v_bin(int index) const;
+  std::string* mutable_v_bin(int index);
+  void set_v_bin(int index, const std::string& value);
+  void set_v_bin(int index, std::string&& value);
+  void set_v_bin(int index, const char* value);
+  void set_v_bin(int index, const void* value, size_t size);
+  std::string* add_v_bin();
+  void add_v_bin(const std::string& value);
+  void add_v_bin(std::string&& value);
+  void add_v_bin(const char* value);
+  void add_v_bin(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& v_bin() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_v_bin();
+  private:
+  const std::string& _internal_v_bin(int index) const;
+  std::string* _internal_add_v_bin();
+  public:
+
+  // @@protoc_insertion_point(class_scope:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> delta_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> v_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> delta_bin_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> v_bin_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_Li24_2fsign_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PresignRound1BCMessage PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage) */ {
+ public:
+  inline PresignRound1BCMessage() : PresignRound1BCMessage(nullptr) {}
+  virtual ~PresignRound1BCMessage();
+
+  PresignRound1BCMessage(const PresignRound1BCMessage& from);
+  PresignRound1BCMessage(PresignRound1BCMessage&& from) noexcept
+    : PresignRound1BCMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline PresignRound1BCMessage& operator=(const PresignRound1BCMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PresignRound1BCMessage& operator=(PresignRound1BCMessage&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const PresignRound1BCMessage& default_instance();
+
+  static inline const PresignRound1BCMessage* internal_default_instance() {
+    return reinterpret_cast<const PresignRound1BCMessage*>(
+               &_PresignRound1BCMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(PresignRound1BCMessage& a, PresignRound1BCMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PresignRound1BCMessage* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PresignRound1BCMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline PresignRound1BCMessage* New() const final {
+    return CreateMaybeMessage<PresignRound1BCMessage>(nullptr);
+  }
+
+  PresignRound1BCMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<PresignRound1BCMessage>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const PresignRound1BCMessage& from);
+  void MergeFrom(const PresignRound1BCMessage& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PresignRound1BCMessage* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage";
+  }
+  protected:
+  explicit PresignRound1BCMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_Li24_2fsign_2eproto);
+    return ::descriptor_table_Li24_2fsign_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kVFieldNumber = 1,
+    kVBinFieldNumber = 2,
+  };
+  // repeated string v = 1;
+  int v_size() const;
+  private:
+  int _internal_v_size() const;
+  public:
+  void clear_v();
+  const std::string& v(int index) const;
+  std::string* mutable_v(int index);
+  void set_v(int index, const std::string& value);
+  void set_v(int index, std::string&& value);
+  void set_v(int index, const char* value);
+  void set_v(int index, const char* value, size_t size);
+  std::string* add_v();
+  void add_v(const std::string& value);
+  void add_v(std::string&& value);
+  void add_v(const char* value);
+  void add_v(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& v() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_v();
+  private:
+  const std::string& _internal_v(int index) const;
+  std::string* _internal_add_v();
+  public:
+
+  // repeated bytes v_bin = 2;
+  int v_bin_size() const;
+  private:
+  int _internal_v_bin_size() const;
+  public:
+  void clear_v_bin();
+  const std::string& v_bin(int index) const;
+  std::string* mutable_v_bin(int index);
+  void set_v_bin(int index, const std::string& value);
+  void set_v_bin(int index, std::string&& value);
+  void set_v_bin(int index, const char* value);
+  void set_v_bin(int index, const void* value, size_t size);
+  std::string* add_v_bin();
+  void add_v_bin(const std::string& value);
+  void add_v_bin(std::string&& value);
+  void add_v_bin(const char* value);
+  void add_v_bin(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& v_bin() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_v_bin();
+  private:
+  const std::string& _internal_v_bin(int index) const;
+  std::string* _internal_add_v_bin();
+  public:
+
+  // @@protoc_insertion_point(class_scope:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> v_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> v_bin_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_Li24_2fsign_2eproto;
+};
+// -------------------------------------------------------------------
+
+class OnlineRound0BCMessage PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage) */ {
+ public:
+  inline OnlineRound0BCMessage() : OnlineRound0BCMessage(nullptr) {}
+  virtual ~OnlineRound0BCMessage();
+
+  OnlineRound0BCMessage(const OnlineRound0BCMessage& from);
+  OnlineRound0BCMessage(OnlineRound0BCMessage&& from) noexcept
+    : OnlineRound0BCMessage() {
+    *this = ::std::move(from);
+  }
+
+  inline OnlineRound0BCMessage& operator=(const OnlineRound0BCMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline OnlineRound0BCMessage& operator=(OnlineRound0BCMessage&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const OnlineRound0BCMessage& default_instance();
+
+  static inline const OnlineRound0BCMessage* internal_default_instance() {
+    return reinterpret_cast<const OnlineRound0BCMessage*>(
+               &_OnlineRound0BCMessage_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(OnlineRound0BCMessage& a, OnlineRound0BCMessage& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(OnlineRound0BCMessage* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(OnlineRound0BCMessage* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline OnlineRound0BCMessage* New() const final {
+    return CreateMaybeMessage<OnlineRound0BCMessage>(nullptr);
+  }
+
+  OnlineRound0BCMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<OnlineRound0BCMessage>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const OnlineRound0BCMessage& from);
+  void MergeFrom(const OnlineRound0BCMessage& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(OnlineRound0BCMessage* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage";
+  }
+  protected:
+  explicit OnlineRound0BCMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_Li24_2fsign_2eproto);
+    return ::descriptor_table_Li24_2fsign_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRFieldNumber = 1,
+    kDeltaFieldNumber = 2,
+    kRBinFieldNumber = 3,
+    kDeltaBinFieldNumber = 4,
+  };
+  // string r = 1;
+  void clear_r();
+  const std::string& r() const;
+  void set_r(const std::string& value);
+  void set_r(std::string&& value);
+  void set_r(const char* value);
+  void set_r(const char* value, size_t size);
+  std::string* mutable_r();
+  std::string* release_r();
+  void set_allocated_r(std::string* r);
+  private:
+  const std::string& _internal_r() const;
+  void _internal_set_r(const std::string& value);
+  std::string* _internal_mutable_r();
+  public:
+
+  // string delta = 2;
+  void clear_delta();
+  const std::string& delta() const;
+  void set_delta(const std::string& value);
+  void set_delta(std::string&& value);
+  void set_delta(const char* value);
+  void set_delta(const char* value, size_t size);
+  std::string* mutable_delta();
+  std::string* release_delta();
+  void set_allocated_delta(std::string* delta);
+  private:
+  const std::string& _internal_delta() const;
+  void _internal_set_delta(const std::string& value);
+  std::string* _internal_mutable_delta();
+  public:
+
+  // bytes r_bin = 3;
+  void clear_r_bin();
+  const std::string& r_bin() const;
+  void set_r_bin(const std::string& value);
+  void set_r_bin(std::string&& value);
+  void set_r_bin(const char* value);
+  void set_r_bin(const void* value, size_t size);
+  std::string* mutable_r_bin();
+  std::string* release_r_bin();
+  void set_allocated_r_bin(std::string* r_bin);
+  private:
+  const std::string& _internal_r_bin() const;
+  void _internal_set_r_bin(const std::string& value);
+  std::string* _internal_mutable_r_bin();
+  public:
+
+  // bytes delta_bin = 4;
+  void clear_delta_bin();
+  const std::string& delta_bin() const;
+  void set_delta_bin(const std::string& value);
+  void set_delta_bin(std::string&& value);
+  void set_delta_bin(const char* value);
+  void set_delta_bin(const void* value, size_t size);
+  std::string* mutable_delta_bin();
+  std::string* release_delta_bin();
+  void set_allocated_delta_bin(std::string* delta_bin);
+  private:
+  const std::string& _internal_delta_bin() const;
+  void _internal_set_delta_bin(const std::string& value);
+  std::string* _internal_mutable_delta_bin();
+  public:
+
+  // @@protoc_insertion_point(class_scope:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr r_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr delta_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr r_bin_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr delta_bin_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_Li24_2fsign_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Round0BCMessage
+
+// .safeheron.proto.CurvePoint GK = 1;
+inline bool Round0BCMessage::_internal_has_gk() const {
+  return this != internal_default_instance() && gk_ != nullptr;
+}
+inline bool Round0BCMessage::has_gk() const {
+  return _internal_has_gk();
+}
+inline const ::safeheron::proto::CurvePoint& Round0BCMessage::_internal_gk() const {
+  const ::safeheron::proto::CurvePoint* p = gk_;
+  return p != nullptr ? *p : reinterpret_cast<const ::safeheron::proto::CurvePoint&>(
+      ::safeheron::proto::_CurvePoint_default_instance_);
+}
+inline const ::safeheron::proto::CurvePoint& Round0BCMessage::gk() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0BCMessage.GK)
+  return _internal_gk();
+}
+inline void Round0BCMessage::unsafe_arena_set_allocated_gk(
+    ::safeheron::proto::CurvePoint* gk) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(gk_);
+  }
+  gk_ = gk;
+  if (gk) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0BCMessage.GK)
+}
+inline ::safeheron::proto::CurvePoint* Round0BCMessage::release_gk() {
+  
+  ::safeheron::proto::CurvePoint* temp = gk_;
+  gk_ = nullptr;
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::safeheron::proto::CurvePoint* Round0BCMessage::unsafe_arena_release_gk() {
+  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0BCMessage.GK)
+  
+  ::safeheron::proto::CurvePoint* temp = gk_;
+  gk_ = nullptr;
+  return temp;
+}
+inline ::safeheron::proto::CurvePoint* Round0BCMessage::_internal_mutable_gk() {
+  
+  if (gk_ == nullptr) {
+    auto* p = CreateMaybeMessage<::safeheron::proto::CurvePoint>(GetArena());
+    gk_ = p;
+  }
+  return gk_;
+}
+inline ::safeheron::proto::CurvePoint* Round0BCMessage::mutable_gk() {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0BCMessage.GK)
+  return _internal_mutable_gk();
+}
+inline void Round0BCMessage::set_allocated_gk(::safeheron::proto::CurvePoint* gk) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(gk_);
+  }
+  if (gk) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(gk)->GetArena();
+    if (message_arena != submessage_arena) {
+      gk = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, gk, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  gk_ = gk;
+  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0BCMessage.GK)
+}
+
+// -------------------------------------------------------------------
+
+// Round0P2PMessage
+
+// string w = 1;
+inline void Round0P2PMessage::clear_w() {
+  w_.ClearToEmpty();
+}
+inline const std::string& Round0P2PMessage::w() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.w)
+  return _internal_w();
+}
+inline void Round0P2PMessage::set_w(const std::string& value) {
+  _internal_set_w(value);
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.w)
+}
+inline std::string* Round0P2PMessage::mutable_w() {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.w)
+  return _internal_mutable_w();
+}
+inline const std::string& Round0P2PMessage::_internal_w() const {
+  return w_.Get();
+}
+inline void Round0P2PMessage::_internal_set_w(const std::string& value) {
+  
+  w_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+}
+inline void Round0P2PMessage::set_w(std::string&& value) {
+  
+  w_.Set(
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.w)
+}
+inline void Round0P2PMessage::set_w(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  w_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
+  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.w)
+}
+inline void Round0P2PMessage::set_w(const char* value,
+    size_t size) {
+  
+  w_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.w)
+}
+inline std::string* Round0P2PMessage::_internal_mutable_w() {
+  
+  return w_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+}
+inline std::string* Round0P2PMessage::release_w() {
+  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.w)
+  return w_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void Round0P2PMessage::set_allocated_w(std::string* w) {
+  if (w != nullptr) {
+    
+  } else {
+    
+  }
+  w_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), w,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.w)
+}
+
+// string k = 2;
+inline void Round0P2PMessage::clear_k() {
+  k_.ClearToEmpty();
+}
+inline const std::string& Round0P2PMessage::k() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.k)
+  return _internal_k();
+}
+inline void Round0P2PMessage::set_k(const std::string& value) {
+  _internal_set_k(value);
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.k)
+}
+inline std::string* Round0P2PMessage::mutable_k() {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.k)
+  return _internal_mutable_k();
+}
+inline const std::string& Round0P2PMessage::_internal_k() const {
+  return k_.Get();
+}
+inline void Round0P2PMessage::_internal_set_k(const std::string& value) {
+  
+  k_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+}
+inline void Round0P2PMessage::set_k(std::string&& value) {
+  
+  k_.Set(
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.k)
+}
+inline void Round0P2PMessage::set_k(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  k_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
+  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.k)
+}
+inline void Round0P2PMessage::set_k(const char* value,
+    size_t size) {
+  
+  k_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.k)
+}
+inline std::string* Round0P2PMessage::_internal_mutable_k() {
+  
+  return k_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+}
+inline std::string* Round0P2PMessage::release_k() {
+  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.k)
+  return k_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void Round0P2PMessage::set_allocated_k(std::string* k) {
+  if (k != nullptr) {
+    
+  } else {
+    
+  }
+  k_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), k,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.k)
+}
+
+// string phi = 3;
+inline void Round0P2PMessage::clear_phi() {
+  phi_.ClearToEmpty();
+}
+inline const std::string& Round0P2PMessage::phi() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.phi)
   return _internal_phi();
 }
-inline void Round0P2PMessage::set_phi(const std::string& value) {
-  _internal_set_phi(value);
-  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.phi)
+inline void Round0P2PMessage::set_phi(const std::string& value) {
+  _internal_set_phi(value);
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.phi)
+}
+inline std::string* Round0P2PMessage::mutable_phi() {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.phi)
+  return _internal_mutable_phi();
+}
+inline const std::string& Round0P2PMessage::_internal_phi() const {
+  return phi_.Get();
+}
+inline void Round0P2PMessage::_internal_set_phi(const std::string& value) {
+  
+  phi_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+}
+inline void Round0P2PMessage::set_phi(std::string&& value) {
+  
+  phi_.Set(
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.phi)
+}
+inline void Round0P2PMessage::set_phi(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  phi_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
+  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.phi)
+}
+inline void Round0P2PMessage::set_phi(const char* value,
+    size_t size) {
+  
+  phi_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.phi)
+}
+inline std::string* Round0P2PMessage::_internal_mutable_phi() {
+  
+  return phi_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+}
+inline std::string* Round0P2PMessage::release_phi() {
+  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.phi)
+  return phi_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void Round0P2PMessage::set_allocated_phi(std::string* phi) {
+  if (phi != nullptr) {
+    
+  } else {
+    
+  }
+  phi_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), phi,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.phi)
+}
+
+// bytes w_bin = 4;
+inline void Round0P2PMessage::clear_w_bin() {
+  w_bin_.ClearToEmpty();
+}
+inline const std::string& Round0P2PMessage::w_bin() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.w_bin)
+  return _internal_w_bin();
+}
+inline void Round0P2PMessage::set_w_bin(const std::string& value) {
+  _internal_set_w_bin(value);
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.w_bin)
+}
+inline std::string* Round0P2PMessage::mutable_w_bin() {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.w_bin)
+  return _internal_mutable_w_bin();
+}
+inline const std::string& Round0P2PMessage::_internal_w_bin() const {
+  return w_bin_.Get();
+}
+inline void Round0P2PMessage::_internal_set_w_bin(const std::string& value) {
+  
+  w_bin_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+}
+inline void Round0P2PMessage::set_w_bin(std::string&& value) {
+  
+  w_bin_.Set(
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.w_bin)
+}
+inline void Round0P2PMessage::set_w_bin(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  w_bin_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
+  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.w_bin)
+}
+inline void Round0P2PMessage::set_w_bin(const void* value,
+    size_t size) {
+  
+  w_bin_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.w_bin)
+}
+inline std::string* Round0P2PMessage::_internal_mutable_w_bin() {
+  
+  return w_bin_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+}
+inline std::string* Round0P2PMessage::release_w_bin() {
+  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.w_bin)
+  return w_bin_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void Round0P2PMessage::set_allocated_w_bin(std::string* w_bin) {
+  if (w_bin != nullptr) {
+    
+  } else {
+    
+  }
+  w_bin_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), w_bin,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.w_bin)
+}
+
+// bytes k_bin = 5;
+inline void Round0P2PMessage::clear_k_bin() {
+  k_bin_.ClearToEmpty();
+}
+inline const std::string& Round0P2PMessage::k_bin() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.k_bin)
+  return _internal_k_bin();
+}
+inline void Round0P2PMessage::set_k_bin(const std::string& value) {
+  _internal_set_k_bin(value);
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.k_bin)
+}
+inline std::string* Round0P2PMessage::mutable_k_bin() {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.k_bin)
+  return _internal_mutable_k_bin();
+}
+inline const std::string& Round0P2PMessage::_internal_k_bin() const {
+  return k_bin_.Get();
+}
+inline void Round0P2PMessage::_internal_set_k_bin(const std::string& value) {
+  
+  k_bin_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+}
+inline void Round0P2PMessage::set_k_bin(std::string&& value) {
+  
+  k_bin_.Set(
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.k_bin)
+}
+inline void Round0P2PMessage::set_k_bin(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  k_bin_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
+  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.k_bin)
+}
+inline void Round0P2PMessage::set_k_bin(const void* value,
+    size_t size) {
+  
+  k_bin_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.k_bin)
+}
+inline std::string* Round0P2PMessage::_internal_mutable_k_bin() {
+  
+  return k_bin_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+}
+inline std::string* Round0P2PMessage::release_k_bin() {
+  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.k_bin)
+  return k_bin_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void Round0P2PMessage::set_allocated_k_bin(std::string* k_bin) {
+  if (k_bin != nullptr) {
+    
+  } else {
+    
+  }
+  k_bin_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), k_bin,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.k_bin)
+}
+
+// bytes phi_bin = 6;
+inline void Round0P2PMessage::clear_phi_bin() {
+  phi_bin_.ClearToEmpty();
+}
+inline const std::string& Round0P2PMessage::phi_bin() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.phi_bin)
+  return _internal_phi_bin();
+}
+inline void Round0P2PMessage::set_phi_bin(const std::string& value) {
+  _internal_set_phi_bin(value);
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.phi_bin)
+}
+inline std::string* Round0P2PMessage::mutable_phi_bin() {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.phi_bin)
+  return _internal_mutable_phi_bin();
+}
+inline const std::string& Round0P2PMessage::_internal_phi_bin() const {
+  return phi_bin_.Get();
+}
+inline void Round0P2PMessage::_internal_set_phi_bin(const std::string& value) {
+  
+  phi_bin_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+}
+inline void Round0P2PMessage::set_phi_bin(std::string&& value) {
+  
+  phi_bin_.Set(
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.phi_bin)
+}
+inline void Round0P2PMessage::set_phi_bin(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  phi_bin_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
+  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.phi_bin)
+}
+inline void Round0P2PMessage::set_phi_bin(const void* value,
+    size_t size) {
+  
+  phi_bin_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.phi_bin)
+}
+inline std::string* Round0P2PMessage::_internal_mutable_phi_bin() {
+  
+  return phi_bin_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+}
+inline std::string* Round0P2PMessage::release_phi_bin() {
+  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.phi_bin)
+  return phi_bin_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void Round0P2PMessage::set_allocated_phi_bin(std::string* phi_bin) {
+  if (phi_bin != nullptr) {
+    
+  } else {
+    
+  }
+  phi_bin_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), phi_bin,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.phi_bin)
+}
+
+// -------------------------------------------------------------------
+
+// Round1P2PMessage
+
+// string delta = 1;
+inline void Round1P2PMessage::clear_delta() {
+  delta_.ClearToEmpty();
+}
+inline const std::string& Round1P2PMessage::delta() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.delta)
+  return _internal_delta();
+}
+inline void Round1P2PMessage::set_delta(const std::string& value) {
+  _internal_set_delta(value);
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.delta)
+}
+inline std::string* Round1P2PMessage::mutable_delta() {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.delta)
+  return _internal_mutable_delta();
+}
+inline const std::string& Round1P2PMessage::_internal_delta() const {
+  return delta_.Get();
+}
+inline void Round1P2PMessage::_internal_set_delta(const std::string& value) {
+  
+  delta_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+}
+inline void Round1P2PMessage::set_delta(std::string&& value) {
+  
+  delta_.Set(
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.delta)
+}
+inline void Round1P2PMessage::set_delta(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  delta_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
+  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.delta)
+}
+inline void Round1P2PMessage::set_delta(const char* value,
+    size_t size) {
+  
+  delta_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.delta)
+}
+inline std::string* Round1P2PMessage::_internal_mutable_delta() {
+  
+  return delta_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+}
+inline std::string* Round1P2PMessage::release_delta() {
+  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.delta)
+  return delta_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void Round1P2PMessage::set_allocated_delta(std::string* delta) {
+  if (delta != nullptr) {
+    
+  } else {
+    
+  }
+  delta_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), delta,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.delta)
+}
+
+// string v = 2;
+inline void Round1P2PMessage::clear_v() {
+  v_.ClearToEmpty();
+}
+inline const std::string& Round1P2PMessage::v() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.v)
+  return _internal_v();
+}
+inline void Round1P2PMessage::set_v(const std::string& value) {
+  _internal_set_v(value);
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.v)
+}
+inline std::string* Round1P2PMessage::mutable_v() {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.v)
+  return _internal_mutable_v();
+}
+inline const std::string& Round1P2PMessage::_internal_v() const {
+  return v_.Get();
+}
+inline void Round1P2PMessage::_internal_set_v(const std::string& value) {
+  
+  v_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+}
+inline void Round1P2PMessage::set_v(std::string&& value) {
+  
+  v_.Set(
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.v)
+}
+inline void Round1P2PMessage::set_v(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  v_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
+  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.v)
+}
+inline void Round1P2PMessage::set_v(const char* value,
+    size_t size) {
+  
+  v_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.v)
+}
+inline std::string* Round1P2PMessage::_internal_mutable_v() {
+  
+  return v_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+}
+inline std::string* Round1P2PMessage::release_v() {
+  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.v)
+  return v_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void Round1P2PMessage::set_allocated_v(std::string* v) {
+  if (v != nullptr) {
+    
+  } else {
+    
+  }
+  v_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), v,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.v)
+}
+
+// bytes delta_bin = 3;
+inline void Round1P2PMessage::clear_delta_bin() {
+  delta_bin_.ClearToEmpty();
+}
+inline const std::string& Round1P2PMessage::delta_bin() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.delta_bin)
+  return _internal_delta_bin();
+}
+inline void Round1P2PMessage::set_delta_bin(const std::string& value) {
+  _internal_set_delta_bin(value);
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.delta_bin)
+}
+inline std::string* Round1P2PMessage::mutable_delta_bin() {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.delta_bin)
+  return _internal_mutable_delta_bin();
+}
+inline const std::string& Round1P2PMessage::_internal_delta_bin() const {
+  return delta_bin_.Get();
+}
+inline void Round1P2PMessage::_internal_set_delta_bin(const std::string& value) {
+  
+  delta_bin_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+}
+inline void Round1P2PMessage::set_delta_bin(std::string&& value) {
+  
+  delta_bin_.Set(
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.delta_bin)
+}
+inline void Round1P2PMessage::set_delta_bin(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  delta_bin_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
+  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.delta_bin)
+}
+inline void Round1P2PMessage::set_delta_bin(const void* value,
+    size_t size) {
+  
+  delta_bin_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.delta_bin)
+}
+inline std::string* Round1P2PMessage::_internal_mutable_delta_bin() {
+  
+  return delta_bin_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+}
+inline std::string* Round1P2PMessage::release_delta_bin() {
+  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.delta_bin)
+  return delta_bin_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void Round1P2PMessage::set_allocated_delta_bin(std::string* delta_bin) {
+  if (delta_bin != nullptr) {
+    
+  } else {
+    
+  }
+  delta_bin_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), delta_bin,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.delta_bin)
+}
+
+// bytes v_bin = 4;
+inline void Round1P2PMessage::clear_v_bin() {
+  v_bin_.ClearToEmpty();
+}
+inline const std::string& Round1P2PMessage::v_bin() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.v_bin)
+  return _internal_v_bin();
+}
+inline void Round1P2PMessage::set_v_bin(const std::string& value) {
+  _internal_set_v_bin(value);
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.v_bin)
+}
+inline std::string* Round1P2PMessage::mutable_v_bin() {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.v_bin)
+  return _internal_mutable_v_bin();
+}
+inline const std::string& Round1P2PMessage::_internal_v_bin() const {
+  return v_bin_.Get();
+}
+inline void Round1P2PMessage::_internal_set_v_bin(const std::string& value) {
+  
+  v_bin_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+}
+inline void Round1P2PMessage::set_v_bin(std::string&& value) {
+  
+  v_bin_.Set(
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.v_bin)
+}
+inline void Round1P2PMessage::set_v_bin(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  v_bin_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
+  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.v_bin)
+}
+inline void Round1P2PMessage::set_v_bin(const void* value,
+    size_t size) {
+  
+  v_bin_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.v_bin)
+}
+inline std::string* Round1P2PMessage::_internal_mutable_v_bin() {
+  
+  return v_bin_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+}
+inline std::string* Round1P2PMessage::release_v_bin() {
+  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.v_bin)
+  return v_bin_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void Round1P2PMessage::set_allocated_v_bin(std::string* v_bin) {
+  if (v_bin != nullptr) {
+    
+  } else {
+    
+  }
+  v_bin_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), v_bin,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.v_bin)
+}
+
+// -------------------------------------------------------------------
+
+// BatchRound0BCMessage
+
+// repeated .safeheron.proto.CurvePoint GK = 1;
+inline int BatchRound0BCMessage::_internal_gk_size() const {
+  return gk_.size();
+}
+inline int BatchRound0BCMessage::gk_size() const {
+  return _internal_gk_size();
+}
+inline ::safeheron::proto::CurvePoint* BatchRound0BCMessage::mutable_gk(int index) {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0BCMessage.GK)
+  return gk_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::safeheron::proto::CurvePoint >*
+BatchRound0BCMessage::mutable_gk() {
+  // @@protoc_insertion_point(field_mutable_list:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0BCMessage.GK)
+  return &gk_;
+}
+inline const ::safeheron::proto::CurvePoint& BatchRound0BCMessage::_internal_gk(int index) const {
+  return gk_.Get(index);
+}
+inline const ::safeheron::proto::CurvePoint& BatchRound0BCMessage::gk(int index) const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0BCMessage.GK)
+  return _internal_gk(index);
+}
+inline ::safeheron::proto::CurvePoint* BatchRound0BCMessage::_internal_add_gk() {
+  return gk_.Add();
+}
+inline ::safeheron::proto::CurvePoint* BatchRound0BCMessage::add_gk() {
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0BCMessage.GK)
+  return _internal_add_gk();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::safeheron::proto::CurvePoint >&
+BatchRound0BCMessage::gk() const {
+  // @@protoc_insertion_point(field_list:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0BCMessage.GK)
+  return gk_;
+}
+
+// -------------------------------------------------------------------
+
+// BatchRound0P2PMessage
+
+// repeated string w = 1;
+inline int BatchRound0P2PMessage::_internal_w_size() const {
+  return w_.size();
+}
+inline int BatchRound0P2PMessage::w_size() const {
+  return _internal_w_size();
+}
+inline void BatchRound0P2PMessage::clear_w() {
+  w_.Clear();
+}
+inline std::string* BatchRound0P2PMessage::add_w() {
+  // @@protoc_insertion_point(field_add_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w)
+  return _internal_add_w();
+}
+inline const std::string& BatchRound0P2PMessage::_internal_w(int index) const {
+  return w_.Get(index);
+}
+inline const std::string& BatchRound0P2PMessage::w(int index) const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w)
+  return _internal_w(index);
+}
+inline std::string* BatchRound0P2PMessage::mutable_w(int index) {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w)
+  return w_.Mutable(index);
+}
+inline void BatchRound0P2PMessage::set_w(int index, const std::string& value) {
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w)
+  w_.Mutable(index)->assign(value);
+}
+inline void BatchRound0P2PMessage::set_w(int index, std::string&& value) {
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w)
+  w_.Mutable(index)->assign(std::move(value));
+}
+inline void BatchRound0P2PMessage::set_w(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  w_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w)
+}
+inline void BatchRound0P2PMessage::set_w(int index, const char* value, size_t size) {
+  w_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w)
+}
+inline std::string* BatchRound0P2PMessage::_internal_add_w() {
+  return w_.Add();
+}
+inline void BatchRound0P2PMessage::add_w(const std::string& value) {
+  w_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w)
+}
+inline void BatchRound0P2PMessage::add_w(std::string&& value) {
+  w_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w)
+}
+inline void BatchRound0P2PMessage::add_w(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  w_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w)
+}
+inline void BatchRound0P2PMessage::add_w(const char* value, size_t size) {
+  w_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+BatchRound0P2PMessage::w() const {
+  // @@protoc_insertion_point(field_list:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w)
+  return w_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+BatchRound0P2PMessage::mutable_w() {
+  // @@protoc_insertion_point(field_mutable_list:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w)
+  return &w_;
+}
+
+// repeated string k = 2;
+inline int BatchRound0P2PMessage::_internal_k_size() const {
+  return k_.size();
+}
+inline int BatchRound0P2PMessage::k_size() const {
+  return _internal_k_size();
+}
+inline void BatchRound0P2PMessage::clear_k() {
+  k_.Clear();
+}
+inline std::string* BatchRound0P2PMessage::add_k() {
+  // @@protoc_insertion_point(field_add_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k)
+  return _internal_add_k();
+}
+inline const std::string& BatchRound0P2PMessage::_internal_k(int index) const {
+  return k_.Get(index);
+}
+inline const std::string& BatchRound0P2PMessage::k(int index) const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k)
+  return _internal_k(index);
+}
+inline std::string* BatchRound0P2PMessage::mutable_k(int index) {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k)
+  return k_.Mutable(index);
+}
+inline void BatchRound0P2PMessage::set_k(int index, const std::string& value) {
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k)
+  k_.Mutable(index)->assign(value);
+}
+inline void BatchRound0P2PMessage::set_k(int index, std::string&& value) {
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k)
+  k_.Mutable(index)->assign(std::move(value));
+}
+inline void BatchRound0P2PMessage::set_k(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  k_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k)
+}
+inline void BatchRound0P2PMessage::set_k(int index, const char* value, size_t size) {
+  k_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k)
+}
+inline std::string* BatchRound0P2PMessage::_internal_add_k() {
+  return k_.Add();
+}
+inline void BatchRound0P2PMessage::add_k(const std::string& value) {
+  k_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k)
+}
+inline void BatchRound0P2PMessage::add_k(std::string&& value) {
+  k_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k)
+}
+inline void BatchRound0P2PMessage::add_k(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  k_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k)
+}
+inline void BatchRound0P2PMessage::add_k(const char* value, size_t size) {
+  k_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+BatchRound0P2PMessage::k() const {
+  // @@protoc_insertion_point(field_list:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k)
+  return k_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+BatchRound0P2PMessage::mutable_k() {
+  // @@protoc_insertion_point(field_mutable_list:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k)
+  return &k_;
+}
+
+// repeated string phi = 3;
+inline int BatchRound0P2PMessage::_internal_phi_size() const {
+  return phi_.size();
+}
+inline int BatchRound0P2PMessage::phi_size() const {
+  return _internal_phi_size();
+}
+inline void BatchRound0P2PMessage::clear_phi() {
+  phi_.Clear();
+}
+inline std::string* BatchRound0P2PMessage::add_phi() {
+  // @@protoc_insertion_point(field_add_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi)
+  return _internal_add_phi();
+}
+inline const std::string& BatchRound0P2PMessage::_internal_phi(int index) const {
+  return phi_.Get(index);
+}
+inline const std::string& BatchRound0P2PMessage::phi(int index) const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi)
+  return _internal_phi(index);
+}
+inline std::string* BatchRound0P2PMessage::mutable_phi(int index) {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi)
+  return phi_.Mutable(index);
+}
+inline void BatchRound0P2PMessage::set_phi(int index, const std::string& value) {
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi)
+  phi_.Mutable(index)->assign(value);
+}
+inline void BatchRound0P2PMessage::set_phi(int index, std::string&& value) {
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi)
+  phi_.Mutable(index)->assign(std::move(value));
+}
+inline void BatchRound0P2PMessage::set_phi(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  phi_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi)
+}
+inline void BatchRound0P2PMessage::set_phi(int index, const char* value, size_t size) {
+  phi_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi)
+}
+inline std::string* BatchRound0P2PMessage::_internal_add_phi() {
+  return phi_.Add();
+}
+inline void BatchRound0P2PMessage::add_phi(const std::string& value) {
+  phi_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi)
+}
+inline void BatchRound0P2PMessage::add_phi(std::string&& value) {
+  phi_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi)
+}
+inline void BatchRound0P2PMessage::add_phi(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  phi_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi)
+}
+inline void BatchRound0P2PMessage::add_phi(const char* value, size_t size) {
+  phi_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+BatchRound0P2PMessage::phi() const {
+  // @@protoc_insertion_point(field_list:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi)
+  return phi_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+BatchRound0P2PMessage::mutable_phi() {
+  // @@protoc_insertion_point(field_mutable_list:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi)
+  return &phi_;
+}
+
+// repeated bytes w_bin = 4;
+inline int BatchRound0P2PMessage::_internal_w_bin_size() const {
+  return w_bin_.size();
+}
+inline int BatchRound0P2PMessage::w_bin_size() const {
+  return _internal_w_bin_size();
+}
+inline void BatchRound0P2PMessage::clear_w_bin() {
+  w_bin_.Clear();
+}
+inline std::string* BatchRound0P2PMessage::add_w_bin() {
+  // @@protoc_insertion_point(field_add_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w_bin)
+  return _internal_add_w_bin();
+}
+inline const std::string& BatchRound0P2PMessage::_internal_w_bin(int index) const {
+  return w_bin_.Get(index);
+}
+inline const std::string& BatchRound0P2PMessage::w_bin(int index) const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w_bin)
+  return _internal_w_bin(index);
+}
+inline std::string* BatchRound0P2PMessage::mutable_w_bin(int index) {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w_bin)
+  return w_bin_.Mutable(index);
+}
+inline void BatchRound0P2PMessage::set_w_bin(int index, const std::string& value) {
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w_bin)
+  w_bin_.Mutable(index)->assign(value);
+}
+inline void BatchRound0P2PMessage::set_w_bin(int index, std::string&& value) {
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w_bin)
+  w_bin_.Mutable(index)->assign(std::move(value));
+}
+inline void BatchRound0P2PMessage::set_w_bin(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  w_bin_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w_bin)
+}
+inline void BatchRound0P2PMessage::set_w_bin(int index, const void* value, size_t size) {
+  w_bin_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w_bin)
+}
+inline std::string* BatchRound0P2PMessage::_internal_add_w_bin() {
+  return w_bin_.Add();
+}
+inline void BatchRound0P2PMessage::add_w_bin(const std::string& value) {
+  w_bin_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w_bin)
+}
+inline void BatchRound0P2PMessage::add_w_bin(std::string&& value) {
+  w_bin_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w_bin)
+}
+inline void BatchRound0P2PMessage::add_w_bin(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  w_bin_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w_bin)
+}
+inline void BatchRound0P2PMessage::add_w_bin(const void* value, size_t size) {
+  w_bin_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w_bin)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+BatchRound0P2PMessage::w_bin() const {
+  // @@protoc_insertion_point(field_list:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w_bin)
+  return w_bin_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+BatchRound0P2PMessage::mutable_w_bin() {
+  // @@protoc_insertion_point(field_mutable_list:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w_bin)
+  return &w_bin_;
+}
+
+// repeated bytes k_bin = 5;
+inline int BatchRound0P2PMessage::_internal_k_bin_size() const {
+  return k_bin_.size();
+}
+inline int BatchRound0P2PMessage::k_bin_size() const {
+  return _internal_k_bin_size();
+}
+inline void BatchRound0P2PMessage::clear_k_bin() {
+  k_bin_.Clear();
+}
+inline std::string* BatchRound0P2PMessage::add_k_bin() {
+  // @@protoc_insertion_point(field_add_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k_bin)
+  return _internal_add_k_bin();
+}
+inline const std::string& BatchRound0P2PMessage::_internal_k_bin(int index) const {
+  return k_bin_.Get(index);
+}
+inline const std::string& BatchRound0P2PMessage::k_bin(int index) const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k_bin)
+  return _internal_k_bin(index);
+}
+inline std::string* BatchRound0P2PMessage::mutable_k_bin(int index) {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k_bin)
+  return k_bin_.Mutable(index);
+}
+inline void BatchRound0P2PMessage::set_k_bin(int index, const std::string& value) {
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k_bin)
+  k_bin_.Mutable(index)->assign(value);
+}
+inline void BatchRound0P2PMessage::set_k_bin(int index, std::string&& value) {
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k_bin)
+  k_bin_.Mutable(index)->assign(std::move(value));
+}
+inline void BatchRound0P2PMessage::set_k_bin(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  k_bin_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k_bin)
+}
+inline void BatchRound0P2PMessage::set_k_bin(int index, const void* value, size_t size) {
+  k_bin_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k_bin)
+}
+inline std::string* BatchRound0P2PMessage::_internal_add_k_bin() {
+  return k_bin_.Add();
+}
+inline void BatchRound0P2PMessage::add_k_bin(const std::string& value) {
+  k_bin_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k_bin)
+}
+inline void BatchRound0P2PMessage::add_k_bin(std::string&& value) {
+  k_bin_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k_bin)
+}
+inline void BatchRound0P2PMessage::add_k_bin(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  k_bin_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k_bin)
+}
+inline void BatchRound0P2PMessage::add_k_bin(const void* value, size_t size) {
+  k_bin_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k_bin)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+BatchRound0P2PMessage::k_bin() const {
+  // @@protoc_insertion_point(field_list:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k_bin)
+  return k_bin_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+BatchRound0P2PMessage::mutable_k_bin() {
+  // @@protoc_insertion_point(field_mutable_list:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k_bin)
+  return &k_bin_;
+}
+
+// repeated bytes phi_bin = 6;
+inline int BatchRound0P2PMessage::_internal_phi_bin_size() const {
+  return phi_bin_.size();
+}
+inline int BatchRound0P2PMessage::phi_bin_size() const {
+  return _internal_phi_bin_size();
+}
+inline void BatchRound0P2PMessage::clear_phi_bin() {
+  phi_bin_.Clear();
+}
+inline std::string* BatchRound0P2PMessage::add_phi_bin() {
+  // @@protoc_insertion_point(field_add_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi_bin)
+  return _internal_add_phi_bin();
+}
+inline const std::string& BatchRound0P2PMessage::_internal_phi_bin(int index) const {
+  return phi_bin_.Get(index);
+}
+inline const std::string& BatchRound0P2PMessage::phi_bin(int index) const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi_bin)
+  return _internal_phi_bin(index);
+}
+inline std::string* BatchRound0P2PMessage::mutable_phi_bin(int index) {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi_bin)
+  return phi_bin_.Mutable(index);
+}
+inline void BatchRound0P2PMessage::set_phi_bin(int index, const std::string& value) {
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi_bin)
+  phi_bin_.Mutable(index)->assign(value);
+}
+inline void BatchRound0P2PMessage::set_phi_bin(int index, std::string&& value) {
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi_bin)
+  phi_bin_.Mutable(index)->assign(std::move(value));
+}
+inline void BatchRound0P2PMessage::set_phi_bin(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  phi_bin_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi_bin)
+}
+inline void BatchRound0P2PMessage::set_phi_bin(int index, const void* value, size_t size) {
+  phi_bin_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi_bin)
+}
+inline std::string* BatchRound0P2PMessage::_internal_add_phi_bin() {
+  return phi_bin_.Add();
+}
+inline void BatchRound0P2PMessage::add_phi_bin(const std::string& value) {
+  phi_bin_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi_bin)
+}
+inline void BatchRound0P2PMessage::add_phi_bin(std::string&& value) {
+  phi_bin_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi_bin)
+}
+inline void BatchRound0P2PMessage::add_phi_bin(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  phi_bin_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi_bin)
+}
+inline void BatchRound0P2PMessage::add_phi_bin(const void* value, size_t size) {
+  phi_bin_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi_bin)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+BatchRound0P2PMessage::phi_bin() const {
+  // @@protoc_insertion_point(field_list:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi_bin)
+  return phi_bin_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+BatchRound0P2PMessage::mutable_phi_bin() {
+  // @@protoc_insertion_point(field_mutable_list:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi_bin)
+  return &phi_bin_;
+}
+
+// -------------------------------------------------------------------
+
+// BatchRound1BCMessage
+
+// repeated string delta = 1;
+inline int BatchRound1BCMessage::_internal_delta_size() const {
+  return delta_.size();
+}
+inline int BatchRound1BCMessage::delta_size() const {
+  return _internal_delta_size();
+}
+inline void BatchRound1BCMessage::clear_delta() {
+  delta_.Clear();
 }
-inline std::string* Round0P2PMessage::mutable_phi() {
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.phi)
-  return _internal_mutable_phi();
+inline std::string* BatchRound1BCMessage::add_delta() {
+  // @@protoc_insertion_point(field_add_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta)
+  return _internal_add_delta();
 }
-inline const std::string& Round0P2PMessage::_internal_phi() const {
-  return phi_.Get();
+inline const std::string& BatchRound1BCMessage::_internal_delta(int index) const {
+  return delta_.Get(index);
 }
-inline void Round0P2PMessage::_internal_set_phi(const std::string& value) {
+inline const std::string& BatchRound1BCMessage::delta(int index) const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta)
+  return _internal_delta(index);
+}
+inline std::string* BatchRound1BCMessage::mutable_delta(int index) {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta)
+  return delta_.Mutable(index);
+}
+inline void BatchRound1BCMessage::set_delta(int index, const std::string& value) {
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta)
+  delta_.Mutable(index)->assign(value);
+}
+inline void BatchRound1BCMessage::set_delta(int index, std::string&& value) {
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta)
+  delta_.Mutable(index)->assign(std::move(value));
+}
+inline void BatchRound1BCMessage::set_delta(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  delta_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta)
+}
+inline void BatchRound1BCMessage::set_delta(int index, const char* value, size_t size) {
+  delta_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta)
+}
+inline std::string* BatchRound1BCMessage::_internal_add_delta() {
+  return delta_.Add();
+}
+inline void BatchRound1BCMessage::add_delta(const std::string& value) {
+  delta_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta)
+}
+inline void BatchRound1BCMessage::add_delta(std::string&& value) {
+  delta_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta)
+}
+inline void BatchRound1BCMessage::add_delta(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  delta_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta)
+}
+inline void BatchRound1BCMessage::add_delta(const char* value, size_t size) {
+  delta_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+BatchRound1BCMessage::delta() const {
+  // @@protoc_insertion_point(field_list:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta)
+  return delta_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+BatchRound1BCMessage::mutable_delta() {
+  // @@protoc_insertion_point(field_mutable_list:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta)
+  return &delta_;
+}
+
+// repeated string v = 2;
+inline int BatchRound1BCMessage::_internal_v_size() const {
+  return v_.size();
+}
+inline int BatchRound1BCMessage::v_size() const {
+  return _internal_v_size();
+}
+inline void BatchRound1BCMessage::clear_v() {
+  v_.Clear();
+}
+inline std::string* BatchRound1BCMessage::add_v() {
+  // @@protoc_insertion_point(field_add_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v)
+  return _internal_add_v();
+}
+inline const std::string& BatchRound1BCMessage::_internal_v(int index) const {
+  return v_.Get(index);
+}
+inline const std::string& BatchRound1BCMessage::v(int index) const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v)
+  return _internal_v(index);
+}
+inline std::string* BatchRound1BCMessage::mutable_v(int index) {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v)
+  return v_.Mutable(index);
+}
+inline void BatchRound1BCMessage::set_v(int index, const std::string& value) {
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v)
+  v_.Mutable(index)->assign(value);
+}
+inline void BatchRound1BCMessage::set_v(int index, std::string&& value) {
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v)
+  v_.Mutable(index)->assign(std::move(value));
+}
+inline void BatchRound1BCMessage::set_v(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  v_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v)
+}
+inline void BatchRound1BCMessage::set_v(int index, const char* value, size_t size) {
+  v_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v)
+}
+inline std::string* BatchRound1BCMessage::_internal_add_v() {
+  return v_.Add();
+}
+inline void BatchRound1BCMessage::add_v(const std::string& value) {
+  v_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v)
+}
+inline void BatchRound1BCMessage::add_v(std::string&& value) {
+  v_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v)
+}
+inline void BatchRound1BCMessage::add_v(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  v_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v)
+}
+inline void BatchRound1BCMessage::add_v(const char* value, size_t size) {
+  v_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+BatchRound1BCMessage::v() const {
+  // @@protoc_insertion_point(field_list:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v)
+  return v_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+BatchRound1BCMessage::mutable_v() {
+  // @@protoc_insertion_point(field_mutable_list:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v)
+  return &v_;
+}
+
+// repeated bytes delta_bin = 3;
+inline int BatchRound1BCMessage::_internal_delta_bin_size() const {
+  return delta_bin_.size();
+}
+inline int BatchRound1BCMessage::delta_bin_size() const {
+  return _internal_delta_bin_size();
+}
+inline void BatchRound1BCMessage::clear_delta_bin() {
+  delta_bin_.Clear();
+}
+inline std::string* BatchRound1BCMessage::add_delta_bin() {
+  // @@protoc_insertion_point(field_add_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta_bin)
+  return _internal_add_delta_bin();
+}
+inline const std::string& BatchRound1BCMessage::_internal_delta_bin(int index) const {
+  return delta_bin_.Get(index);
+}
+inline const std::string& BatchRound1BCMessage::delta_bin(int index) const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta_bin)
+  return _internal_delta_bin(index);
+}
+inline std::string* BatchRound1BCMessage::mutable_delta_bin(int index) {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta_bin)
+  return delta_bin_.Mutable(index);
+}
+inline void BatchRound1BCMessage::set_delta_bin(int index, const std::string& value) {
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta_bin)
+  delta_bin_.Mutable(index)->assign(value);
+}
+inline void BatchRound1BCMessage::set_delta_bin(int index, std::string&& value) {
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta_bin)
+  delta_bin_.Mutable(index)->assign(std::move(value));
+}
+inline void BatchRound1BCMessage::set_delta_bin(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  delta_bin_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta_bin)
+}
+inline void BatchRound1BCMessage::set_delta_bin(int index, const void* value, size_t size) {
+  delta_bin_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta_bin)
+}
+inline std::string* BatchRound1BCMessage::_internal_add_delta_bin() {
+  return delta_bin_.Add();
+}
+inline void BatchRound1BCMessage::add_delta_bin(const std::string& value) {
+  delta_bin_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta_bin)
+}
+inline void BatchRound1BCMessage::add_delta_bin(std::string&& value) {
+  delta_bin_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta_bin)
+}
+inline void BatchRound1BCMessage::add_delta_bin(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  delta_bin_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta_bin)
+}
+inline void BatchRound1BCMessage::add_delta_bin(const void* value, size_t size) {
+  delta_bin_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta_bin)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+BatchRound1BCMessage::delta_bin() const {
+  // @@protoc_insertion_point(field_list:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta_bin)
+  return delta_bin_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+BatchRound1BCMessage::mutable_delta_bin() {
+  // @@protoc_insertion_point(field_mutable_list:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta_bin)
+  return &delta_bin_;
+}
+
+// repeated bytes v_bin = 4;
+inline int BatchRound1BCMessage::_internal_v_bin_size() const {
+  return v_bin_.size();
+}
+inline int BatchRound1BCMessage::v_bin_size() const {
+  return _internal_v_bin_size();
+}
+inline void BatchRound1BCMessage::clear_v_bin() {
+  v_bin_.Clear();
+}
+inline std::string* BatchRound1BCMessage::add_v_bin() {
+  // @@protoc_insertion_point(field_add_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v_bin)
+  return _internal_add_v_bin();
+}
+inline const std::string& BatchRound1BCMessage::_internal_v_bin(int index) const {
+  return v_bin_.Get(index);
+}
+inline const std::string& BatchRound1BCMessage::v_bin(int index) const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v_bin)
+  return _internal_v_bin(index);
+}
+inline std::string* BatchRound1BCMessage::mutable_v_bin(int index) {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v_bin)
+  return v_bin_.Mutable(index);
+}
+inline void BatchRound1BCMessage::set_v_bin(int index, const std::string& value) {
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v_bin)
+  v_bin_.Mutable(index)->assign(value);
+}
+inline void BatchRound1BCMessage::set_v_bin(int index, std::string&& value) {
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v_bin)
+  v_bin_.Mutable(index)->assign(std::move(value));
+}
+inline void BatchRound1BCMessage::set_v_bin(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  v_bin_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v_bin)
+}
+inline void BatchRound1BCMessage::set_v_bin(int index, const void* value, size_t size) {
+  v_bin_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v_bin)
+}
+inline std::string* BatchRound1BCMessage::_internal_add_v_bin() {
+  return v_bin_.Add();
+}
+inline void BatchRound1BCMessage::add_v_bin(const std::string& value) {
+  v_bin_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v_bin)
+}
+inline void BatchRound1BCMessage::add_v_bin(std::string&& value) {
+  v_bin_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v_bin)
+}
+inline void BatchRound1BCMessage::add_v_bin(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  v_bin_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v_bin)
+}
+inline void BatchRound1BCMessage::add_v_bin(const void* value, size_t size) {
+  v_bin_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v_bin)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+BatchRound1BCMessage::v_bin() const {
+  // @@protoc_insertion_point(field_list:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v_bin)
+  return v_bin_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+BatchRound1BCMessage::mutable_v_bin() {
+  // @@protoc_insertion_point(field_mutable_list:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v_bin)
+  return &v_bin_;
+}
+
+// -------------------------------------------------------------------
+
+// PresignRound1BCMessage
+
+// repeated string v = 1;
+inline int PresignRound1BCMessage::_internal_v_size() const {
+  return v_.size();
+}
+inline int PresignRound1BCMessage::v_size() const {
+  return _internal_v_size();
+}
+inline void PresignRound1BCMessage::clear_v() {
+  v_.Clear();
+}
+inline std::string* PresignRound1BCMessage::add_v() {
+  // @@protoc_insertion_point(field_add_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v)
+  return _internal_add_v();
+}
+inline const std::string& PresignRound1BCMessage::_internal_v(int index) const {
+  return v_.Get(index);
+}
+inline const std::string& PresignRound1BCMessage::v(int index) const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v)
+  return _internal_v(index);
+}
+inline std::string* PresignRound1BCMessage::mutable_v(int index) {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v)
+  return v_.Mutable(index);
+}
+inline void PresignRound1BCMessage::set_v(int index, const std::string& value) {
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v)
+  v_.Mutable(index)->assign(value);
+}
+inline void PresignRound1BCMessage::set_v(int index, std::string&& value) {
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v)
+  v_.Mutable(index)->assign(std::move(value));
+}
+inline void PresignRound1BCMessage::set_v(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  v_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v)
+}
+inline void PresignRound1BCMessage::set_v(int index, const char* value, size_t size) {
+  v_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v)
+}
+inline std::string* PresignRound1BCMessage::_internal_add_v() {
+  return v_.Add();
+}
+inline void PresignRound1BCMessage::add_v(const std::string& value) {
+  v_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v)
+}
+inline void PresignRound1BCMessage::add_v(std::string&& value) {
+  v_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v)
+}
+inline void PresignRound1BCMessage::add_v(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  v_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v)
+}
+inline void PresignRound1BCMessage::add_v(const char* value, size_t size) {
+  v_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+PresignRound1BCMessage::v() const {
+  // @@protoc_insertion_point(field_list:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v)
+  return v_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+PresignRound1BCMessage::mutable_v() {
+  // @@protoc_insertion_point(field_mutable_list:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v)
+  return &v_;
+}
+
+// repeated bytes v_bin = 2;
+inline int PresignRound1BCMessage::_internal_v_bin_size() const {
+  return v_bin_.size();
+}
+inline int PresignRound1BCMessage::v_bin_size() const {
+  return _internal_v_bin_size();
+}
+inline void PresignRound1BCMessage::clear_v_bin() {
+  v_bin_.Clear();
+}
+inline std::string* PresignRound1BCMessage::add_v_bin() {
+  // @@protoc_insertion_point(field_add_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v_bin)
+  return _internal_add_v_bin();
+}
+inline const std::string& PresignRound1BCMessage::_internal_v_bin(int index) const {
+  return v_bin_.Get(index);
+}
+inline const std::string& PresignRound1BCMessage::v_bin(int index) const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v_bin)
+  return _internal_v_bin(index);
+}
+inline std::string* PresignRound1BCMessage::mutable_v_bin(int index) {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v_bin)
+  return v_bin_.Mutable(index);
+}
+inline void PresignRound1BCMessage::set_v_bin(int index, const std::string& value) {
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v_bin)
+  v_bin_.Mutable(index)->assign(value);
+}
+inline void PresignRound1BCMessage::set_v_bin(int index, std::string&& value) {
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v_bin)
+  v_bin_.Mutable(index)->assign(std::move(value));
+}
+inline void PresignRound1BCMessage::set_v_bin(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  v_bin_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v_bin)
+}
+inline void PresignRound1BCMessage::set_v_bin(int index, const void* value, size_t size) {
+  v_bin_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v_bin)
+}
+inline std::string* PresignRound1BCMessage::_internal_add_v_bin() {
+  return v_bin_.Add();
+}
+inline void PresignRound1BCMessage::add_v_bin(const std::string& value) {
+  v_bin_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v_bin)
+}
+inline void PresignRound1BCMessage::add_v_bin(std::string&& value) {
+  v_bin_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v_bin)
+}
+inline void PresignRound1BCMessage::add_v_bin(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  v_bin_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v_bin)
+}
+inline void PresignRound1BCMessage::add_v_bin(const void* value, size_t size) {
+  v_bin_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v_bin)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+PresignRound1BCMessage::v_bin() const {
+  // @@protoc_insertion_point(field_list:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v_bin)
+  return v_bin_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+PresignRound1BCMessage::mutable_v_bin() {
+  // @@protoc_insertion_point(field_mutable_list:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v_bin)
+  return &v_bin_;
+}
+
+// -------------------------------------------------------------------
+
+// OnlineRound0BCMessage
+
+// string r = 1;
+inline void OnlineRound0BCMessage::clear_r() {
+  r_.ClearToEmpty();
+}
+inline const std::string& OnlineRound0BCMessage::r() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.r)
+  return _internal_r();
+}
+inline void OnlineRound0BCMessage::set_r(const std::string& value) {
+  _internal_set_r(value);
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.r)
+}
+inline std::string* OnlineRound0BCMessage::mutable_r() {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.r)
+  return _internal_mutable_r();
+}
+inline const std::string& OnlineRound0BCMessage::_internal_r() const {
+  return r_.Get();
+}
+inline void OnlineRound0BCMessage::_internal_set_r(const std::string& value) {
   
-  phi_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+  r_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
 }
-inline void Round0P2PMessage::set_phi(std::string&& value) {
+inline void OnlineRound0BCMessage::set_r(std::string&& value) {
   
-  phi_.Set(
+  r_.Set(
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.phi)
+  // @@protoc_insertion_point(field_set_rvalue:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.r)
 }
-inline void Round0P2PMessage::set_phi(const char* value) {
+inline void OnlineRound0BCMessage::set_r(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
   
-  phi_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.phi)
+  r_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
+  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.r)
 }
-inline void Round0P2PMessage::set_phi(const char* value,
+inline void OnlineRound0BCMessage::set_r(const char* value,
     size_t size) {
   
-  phi_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
+  r_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
       reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.phi)
+  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.r)
 }
-inline std::string* Round0P2PMessage::_internal_mutable_phi() {
+inline std::string* OnlineRound0BCMessage::_internal_mutable_r() {
   
-  return phi_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+  return r_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
 }
-inline std::string* Round0P2PMessage::release_phi() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.phi)
-  return phi_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* OnlineRound0BCMessage::release_r() {
+  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.r)
+  return r_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline void Round0P2PMessage::set_allocated_phi(std::string* phi) {
-  if (phi != nullptr) {
+inline void OnlineRound0BCMessage::set_allocated_r(std::string* r) {
+  if (r != nullptr) {
     
   } else {
     
   }
-  phi_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), phi,
+  r_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), r,
       GetArena());
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.phi)
+  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.r)
 }
 
-// -------------------------------------------------------------------
-
-// Round1P2PMessage
-
-// string delta = 1;
-inline void Round1P2PMessage::clear_delta() {
+// string delta = 2;
+inline void OnlineRound0BCMessage::clear_delta() {
   delta_.ClearToEmpty();
 }
-inline const std::string& Round1P2PMessage::delta() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.delta)
+inline const std::string& OnlineRound0BCMessage::delta() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.delta)
   return _internal_delta();
 }
-inline void Round1P2PMessage::set_delta(const std::string& value) {
+inline void OnlineRound0BCMessage::set_delta(const std::string& value) {
   _internal_set_delta(value);
-  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.delta)
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.delta)
 }
-inline std::string* Round1P2PMessage::mutable_delta() {
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.delta)
+inline std::string* OnlineRound0BCMessage::mutable_delta() {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.delta)
   return _internal_mutable_delta();
 }
-inline const std::string& Round1P2PMessage::_internal_delta() const {
+inline const std::string& OnlineRound0BCMessage::_internal_delta() const {
   return delta_.Get();
 }
-inline void Round1P2PMessage::_internal_set_delta(const std::string& value) {
+inline void OnlineRound0BCMessage::_internal_set_delta(const std::string& value) {
   
   delta_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
 }
-inline void Round1P2PMessage::set_delta(std::string&& value) {
+inline void OnlineRound0BCMessage::set_delta(std::string&& value) {
   
   delta_.Set(
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.delta)
+  // @@protoc_insertion_point(field_set_rvalue:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.delta)
 }
-inline void Round1P2PMessage::set_delta(const char* value) {
+inline void OnlineRound0BCMessage::set_delta(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
   
   delta_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.delta)
+  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.delta)
 }
-inline void Round1P2PMessage::set_delta(const char* value,
+inline void OnlineRound0BCMessage::set_delta(const char* value,
     size_t size) {
   
   delta_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
       reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.delta)
+  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.delta)
 }
-inline std::string* Round1P2PMessage::_internal_mutable_delta() {
+inline std::string* OnlineRound0BCMessage::_internal_mutable_delta() {
   
   return delta_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
 }
-inline std::string* Round1P2PMessage::release_delta() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.delta)
+inline std::string* OnlineRound0BCMessage::release_delta() {
+  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.delta)
   return delta_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline void Round1P2PMessage::set_allocated_delta(std::string* delta) {
+inline void OnlineRound0BCMessage::set_allocated_delta(std::string* delta) {
   if (delta != nullptr) {
     
   } else {
@@ -906,68 +3477,129 @@ inline void Round1P2PMessage::set_allocated_delta(std::string* delta) {
   }
   delta_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), delta,
       GetArena());
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.delta)
+  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.delta)
 }
 
-// string v = 2;
-inline void Round1P2PMessage::clear_v() {
-  v_.ClearToEmpty();
+// bytes r_bin = 3;
+inline void OnlineRound0BCMessage::clear_r_bin() {
+  r_bin_.ClearToEmpty();
 }
-inline const std::string& Round1P2PMessage::v() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.v)
-  return _internal_v();
+inline const std::string& OnlineRound0BCMessage::r_bin() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.r_bin)
+  return _internal_r_bin();
 }
-inline void Round1P2PMessage::set_v(const std::string& value) {
-  _internal_set_v(value);
-  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.v)
+inline void OnlineRound0BCMessage::set_r_bin(const std::string& value) {
+  _internal_set_r_bin(value);
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.r_bin)
 }
-inline std::string* Round1P2PMessage::mutable_v() {
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.v)
-  return _internal_mutable_v();
+inline std::string* OnlineRound0BCMessage::mutable_r_bin() {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.r_bin)
+  return _internal_mutable_r_bin();
 }
-inline const std::string& Round1P2PMessage::_internal_v() const {
-  return v_.Get();
+inline const std::string& OnlineRound0BCMessage::_internal_r_bin() const {
+  return r_bin_.Get();
 }
-inline void Round1P2PMessage::_internal_set_v(const std::string& value) {
+inline void OnlineRound0BCMessage::_internal_set_r_bin(const std::string& value) {
   
-  v_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+  r_bin_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
 }
-inline void Round1P2PMessage::set_v(std::string&& value) {
+inline void OnlineRound0BCMessage::set_r_bin(std::string&& value) {
   
-  v_.Set(
+  r_bin_.Set(
     ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.v)
+  // @@protoc_insertion_point(field_set_rvalue:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.r_bin)
 }
-inline void Round1P2PMessage::set_v(const char* value) {
+inline void OnlineRound0BCMessage::set_r_bin(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
   
-  v_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
-  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.v)
+  r_bin_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
+  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.r_bin)
 }
-inline void Round1P2PMessage::set_v(const char* value,
+inline void OnlineRound0BCMessage::set_r_bin(const void* value,
     size_t size) {
   
-  v_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
+  r_bin_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
       reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.v)
+  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.r_bin)
 }
-inline std::string* Round1P2PMessage::_internal_mutable_v() {
+inline std::string* OnlineRound0BCMessage::_internal_mutable_r_bin() {
   
-  return v_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+  return r_bin_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
 }
-inline std::string* Round1P2PMessage::release_v() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.v)
-  return v_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* OnlineRound0BCMessage::release_r_bin() {
+  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.r_bin)
+  return r_bin_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline void Round1P2PMessage::set_allocated_v(std::string* v) {
-  if (v != nullptr) {
+inline void OnlineRound0BCMessage::set_allocated_r_bin(std::string* r_bin) {
+  if (r_bin != nullptr) {
     
   } else {
     
   }
-  v_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), v,
+  r_bin_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), r_bin,
       GetArena());
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.v)
+  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.r_bin)
+}
+
+// bytes delta_bin = 4;
+inline void OnlineRound0BCMessage::clear_delta_bin() {
+  delta_bin_.ClearToEmpty();
+}
+inline const std::string& OnlineRound0BCMessage::delta_bin() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.delta_bin)
+  return _internal_delta_bin();
+}
+inline void OnlineRound0BCMessage::set_delta_bin(const std::string& value) {
+  _internal_set_delta_bin(value);
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.delta_bin)
+}
+inline std::string* OnlineRound0BCMessage::mutable_delta_bin() {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.delta_bin)
+  return _internal_mutable_delta_bin();
+}
+inline const std::string& OnlineRound0BCMessage::_internal_delta_bin() const {
+  return delta_bin_.Get();
+}
+inline void OnlineRound0BCMessage::_internal_set_delta_bin(const std::string& value) {
+  
+  delta_bin_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, value, GetArena());
+}
+inline void OnlineRound0BCMessage::set_delta_bin(std::string&& value) {
+  
+  delta_bin_.Set(
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.delta_bin)
+}
+inline void OnlineRound0BCMessage::set_delta_bin(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  delta_bin_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(value), GetArena());
+  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.delta_bin)
+}
+inline void OnlineRound0BCMessage::set_delta_bin(const void* value,
+    size_t size) {
+  
+  delta_bin_.Set(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.delta_bin)
+}
+inline std::string* OnlineRound0BCMessage::_internal_mutable_delta_bin() {
+  
+  return delta_bin_.Mutable(::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::EmptyDefault{}, GetArena());
+}
+inline std::string* OnlineRound0BCMessage::release_delta_bin() {
+  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.delta_bin)
+  return delta_bin_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void OnlineRound0BCMessage::set_allocated_delta_bin(std::string* delta_bin) {
+  if (delta_bin != nullptr) {
+    
+  } else {
+    
+  }
+  delta_bin_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), delta_bin,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.delta_bin)
 }
 
 #ifdef __GNUC__
@@ -977,6 +3609,16 @@ inline void Round1P2PMessage::set_allocated_v(std::string* v) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
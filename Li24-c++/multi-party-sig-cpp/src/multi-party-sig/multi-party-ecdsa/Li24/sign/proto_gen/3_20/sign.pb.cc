@@ -27,8 +27,7 @@ namespace Li24 {
 namespace sign {
 PROTOBUF_CONSTEXPR Round0BCMessage::Round0BCMessage(
     ::_pbi::ConstantInitialized)
-  : message_a_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , commitment_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}){}
+  : gk_(nullptr){}
 struct Round0BCMessageDefaultTypeInternal {
   PROTOBUF_CONSTEXPR Round0BCMessageDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -40,7 +39,12 @@ struct Round0BCMessageDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Round0BCMessageDefaultTypeInternal _Round0BCMessage_default_instance_;
 PROTOBUF_CONSTEXPR Round0P2PMessage::Round0P2PMessage(
     ::_pbi::ConstantInitialized)
-  : alice_proof_(nullptr){}
+  : w_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
+  , k_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
+  , phi_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
+  , w_bin_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
+  , k_bin_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
+  , phi_bin_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}){}
 struct Round0P2PMessageDefaultTypeInternal {
   PROTOBUF_CONSTEXPR Round0P2PMessageDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -52,10 +56,10 @@ struct Round0P2PMessageDefaultTypeInternal {
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Round0P2PMessageDefaultTypeInternal _Round0P2PMessage_default_instance_;
 PROTOBUF_CONSTEXPR Round1P2PMessage::Round1P2PMessage(
     ::_pbi::ConstantInitialized)
-  : message_b_for_k_gamma_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , message_b_for_k_w_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , bob_proof_1_(nullptr)
-  , bob_proof_2_(nullptr){}
+  : delta_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
+  , v_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
+  , delta_bin_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
+  , v_bin_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}){}
 struct Round1P2PMessageDefaultTypeInternal {
   PROTOBUF_CONSTEXPR Round1P2PMessageDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
@@ -65,103 +69,84 @@ struct Round1P2PMessageDefaultTypeInternal {
   };
 };
 PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Round1P2PMessageDefaultTypeInternal _Round1P2PMessage_default_instance_;
-PROTOBUF_CONSTEXPR Round2BCMessage::Round2BCMessage(
+PROTOBUF_CONSTEXPR BatchRound0BCMessage::BatchRound0BCMessage(
     ::_pbi::ConstantInitialized)
-  : delta_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}){}
-struct Round2BCMessageDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR Round2BCMessageDefaultTypeInternal()
+  : gk_(){}
+struct BatchRound0BCMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BatchRound0BCMessageDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
-  ~Round2BCMessageDefaultTypeInternal() {}
+  ~BatchRound0BCMessageDefaultTypeInternal() {}
   union {
-    Round2BCMessage _instance;
+    BatchRound0BCMessage _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Round2BCMessageDefaultTypeInternal _Round2BCMessage_default_instance_;
-PROTOBUF_CONSTEXPR Round3BCMessage::Round3BCMessage(
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BatchRound0BCMessageDefaultTypeInternal _BatchRound0BCMessage_default_instance_;
+PROTOBUF_CONSTEXPR BatchRound0P2PMessage::BatchRound0P2PMessage(
     ::_pbi::ConstantInitialized)
-  : blind_factor_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , dlog_proof_gamma__(nullptr){}
-struct Round3BCMessageDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR Round3BCMessageDefaultTypeInternal()
+  : w_()
+  , k_()
+  , phi_()
+  , w_bin_()
+  , k_bin_()
+  , phi_bin_(){}
+struct BatchRound0P2PMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BatchRound0P2PMessageDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
-  ~Round3BCMessageDefaultTypeInternal() {}
+  ~BatchRound0P2PMessageDefaultTypeInternal() {}
   union {
-    Round3BCMessage _instance;
+    BatchRound0P2PMessage _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Round3BCMessageDefaultTypeInternal _Round3BCMessage_default_instance_;
-PROTOBUF_CONSTEXPR Round4BCMessage::Round4BCMessage(
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BatchRound0P2PMessageDefaultTypeInternal _BatchRound0P2PMessage_default_instance_;
+PROTOBUF_CONSTEXPR BatchRound1BCMessage::BatchRound1BCMessage(
     ::_pbi::ConstantInitialized)
-  : commitment_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}){}
-struct Round4BCMessageDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR Round4BCMessageDefaultTypeInternal()
+  : delta_()
+  , v_()
+  , delta_bin_()
+  , v_bin_(){}
+struct BatchRound1BCMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BatchRound1BCMessageDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
-  ~Round4BCMessageDefaultTypeInternal() {}
+  ~BatchRound1BCMessageDefaultTypeInternal() {}
   union {
-    Round4BCMessage _instance;
+    BatchRound1BCMessage _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Round4BCMessageDefaultTypeInternal _Round4BCMessage_default_instance_;
-PROTOBUF_CONSTEXPR Round5BCMessage::Round5BCMessage(
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BatchRound1BCMessageDefaultTypeInternal _BatchRound1BCMessage_default_instance_;
+PROTOBUF_CONSTEXPR PresignRound1BCMessage::PresignRound1BCMessage(
     ::_pbi::ConstantInitialized)
-  : blind_factor_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , v_(nullptr)
-  , a_(nullptr)
-  , lc_proof_vrg_(nullptr)
-  , dlog_proof_rho_(nullptr){}
-struct Round5BCMessageDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR Round5BCMessageDefaultTypeInternal()
+  : v_()
+  , v_bin_(){}
+struct PresignRound1BCMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PresignRound1BCMessageDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
-  ~Round5BCMessageDefaultTypeInternal() {}
+  ~PresignRound1BCMessageDefaultTypeInternal() {}
   union {
-    Round5BCMessage _instance;
+    PresignRound1BCMessage _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Round5BCMessageDefaultTypeInternal _Round5BCMessage_default_instance_;
-PROTOBUF_CONSTEXPR Round6BCMessage::Round6BCMessage(
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PresignRound1BCMessageDefaultTypeInternal _PresignRound1BCMessage_default_instance_;
+PROTOBUF_CONSTEXPR OnlineRound0BCMessage::OnlineRound0BCMessage(
     ::_pbi::ConstantInitialized)
-  : commitment_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}){}
-struct Round6BCMessageDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR Round6BCMessageDefaultTypeInternal()
+  : r_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
+  , delta_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
+  , r_bin_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
+  , delta_bin_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}){}
+struct OnlineRound0BCMessageDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR OnlineRound0BCMessageDefaultTypeInternal()
       : _instance(::_pbi::ConstantInitialized{}) {}
-  ~Round6BCMessageDefaultTypeInternal() {}
+  ~OnlineRound0BCMessageDefaultTypeInternal() {}
   union {
-    Round6BCMessage _instance;
+    OnlineRound0BCMessage _instance;
   };
 };
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Round6BCMessageDefaultTypeInternal _Round6BCMessage_default_instance_;
-PROTOBUF_CONSTEXPR Round7BCMessage::Round7BCMessage(
-    ::_pbi::ConstantInitialized)
-  : blind_factor_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{})
-  , u_(nullptr)
-  , t_(nullptr){}
-struct Round7BCMessageDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR Round7BCMessageDefaultTypeInternal()
-      : _instance(::_pbi::ConstantInitialized{}) {}
-  ~Round7BCMessageDefaultTypeInternal() {}
-  union {
-    Round7BCMessage _instance;
-  };
-};
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Round7BCMessageDefaultTypeInternal _Round7BCMessage_default_instance_;
-PROTOBUF_CONSTEXPR Round8BCMessage::Round8BCMessage(
-    ::_pbi::ConstantInitialized)
-  : si_(&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}){}
-struct Round8BCMessageDefaultTypeInternal {
-  PROTOBUF_CONSTEXPR Round8BCMessageDefaultTypeInternal()
-      : _instance(::_pbi::ConstantInitialized{}) {}
-  ~Round8BCMessageDefaultTypeInternal() {}
-  union {
-    Round8BCMessage _instance;
-  };
-};
-PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 Round8BCMessageDefaultTypeInternal _Round8BCMessage_default_instance_;
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OnlineRound0BCMessageDefaultTypeInternal _OnlineRound0BCMessage_default_instance_;
 }  // namespace sign
 }  // namespace Li24
 }  // namespace multi_party_ecdsa
 }  // namespace proto
 }  // namespace safeheron
-static ::_pb::Metadata file_level_metadata_Li24_2fsign_2eproto[10];
+static ::_pb::Metadata file_level_metadata_Li24_2fsign_2eproto[8];
 static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_Li24_2fsign_2eproto = nullptr;
 static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_Li24_2fsign_2eproto = nullptr;
 
@@ -172,146 +157,128 @@ const uint32_t TableStruct_Li24_2fsign_2eproto::offsets[] PROTOBUF_SECTION_VARIA
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round0BCMessage, message_a_),
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round0BCMessage, commitment_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round0BCMessage, gk_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round0P2PMessage, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round0P2PMessage, alice_proof_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round0P2PMessage, w_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round0P2PMessage, k_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round0P2PMessage, phi_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round0P2PMessage, w_bin_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round0P2PMessage, k_bin_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round0P2PMessage, phi_bin_),
   ~0u,  // no _has_bits_
   PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round1P2PMessage, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round1P2PMessage, message_b_for_k_gamma_),
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round1P2PMessage, message_b_for_k_w_),
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round1P2PMessage, bob_proof_1_),
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round1P2PMessage, bob_proof_2_),
-  ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round2BCMessage, _internal_metadata_),
-  ~0u,  // no _extensions_
-  ~0u,  // no _oneof_case_
-  ~0u,  // no _weak_field_map_
-  ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round2BCMessage, delta_),
-  ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round3BCMessage, _internal_metadata_),
-  ~0u,  // no _extensions_
-  ~0u,  // no _oneof_case_
-  ~0u,  // no _weak_field_map_
-  ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round3BCMessage, blind_factor_),
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round3BCMessage, dlog_proof_gamma__),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round1P2PMessage, delta_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round1P2PMessage, v_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round1P2PMessage, delta_bin_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round1P2PMessage, v_bin_),
   ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round4BCMessage, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0BCMessage, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round4BCMessage, commitment_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0BCMessage, gk_),
   ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round5BCMessage, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0P2PMessage, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round5BCMessage, v_),
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round5BCMessage, a_),
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round5BCMessage, blind_factor_),
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round5BCMessage, lc_proof_vrg_),
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round5BCMessage, dlog_proof_rho_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0P2PMessage, w_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0P2PMessage, k_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0P2PMessage, phi_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0P2PMessage, w_bin_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0P2PMessage, k_bin_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0P2PMessage, phi_bin_),
   ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round6BCMessage, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound1BCMessage, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round6BCMessage, commitment_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound1BCMessage, delta_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound1BCMessage, v_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound1BCMessage, delta_bin_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound1BCMessage, v_bin_),
   ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round7BCMessage, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::PresignRound1BCMessage, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round7BCMessage, u_),
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round7BCMessage, t_),
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round7BCMessage, blind_factor_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::PresignRound1BCMessage, v_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::PresignRound1BCMessage, v_bin_),
   ~0u,  // no _has_bits_
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round8BCMessage, _internal_metadata_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::OnlineRound0BCMessage, _internal_metadata_),
   ~0u,  // no _extensions_
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   ~0u,  // no _inlined_string_donated_
-  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round8BCMessage, si_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::OnlineRound0BCMessage, r_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::OnlineRound0BCMessage, delta_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::OnlineRound0BCMessage, r_bin_),
+  PROTOBUF_FIELD_OFFSET(::safeheron::proto::multi_party_ecdsa::Li24::sign::OnlineRound0BCMessage, delta_bin_),
 };
 static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round0BCMessage)},
-  { 8, -1, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round0P2PMessage)},
-  { 15, -1, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round1P2PMessage)},
-  { 25, -1, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round2BCMessage)},
-  { 32, -1, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round3BCMessage)},
-  { 40, -1, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round4BCMessage)},
-  { 47, -1, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round5BCMessage)},
-  { 58, -1, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round6BCMessage)},
-  { 65, -1, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round7BCMessage)},
-  { 74, -1, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round8BCMessage)},
+  { 7, -1, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round0P2PMessage)},
+  { 19, -1, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::sign::Round1P2PMessage)},
+  { 29, -1, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0BCMessage)},
+  { 36, -1, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0P2PMessage)},
+  { 48, -1, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound1BCMessage)},
+  { 58, -1, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::sign::PresignRound1BCMessage)},
+  { 66, -1, -1, sizeof(::safeheron::proto::multi_party_ecdsa::Li24::sign::OnlineRound0BCMessage)},
 };
 
 static const ::_pb::Message* const file_default_instances[] = {
   &::safeheron::proto::multi_party_ecdsa::Li24::sign::_Round0BCMessage_default_instance_._instance,
   &::safeheron::proto::multi_party_ecdsa::Li24::sign::_Round0P2PMessage_default_instance_._instance,
   &::safeheron::proto::multi_party_ecdsa::Li24::sign::_Round1P2PMessage_default_instance_._instance,
-  &::safeheron::proto::multi_party_ecdsa::Li24::sign::_Round2BCMessage_default_instance_._instance,
-  &::safeheron::proto::multi_party_ecdsa::Li24::sign::_Round3BCMessage_default_instance_._instance,
-  &::safeheron::proto::multi_party_ecdsa::Li24::sign::_Round4BCMessage_default_instance_._instance,
-  &::safeheron::proto::multi_party_ecdsa::Li24::sign::_Round5BCMessage_default_instance_._instance,
-  &::safeheron::proto::multi_party_ecdsa::Li24::sign::_Round6BCMessage_default_instance_._instance,
-  &::safeheron::proto::multi_party_ecdsa::Li24::sign::_Round7BCMessage_default_instance_._instance,
-  &::safeheron::proto::multi_party_ecdsa::Li24::sign::_Round8BCMessage_default_instance_._instance,
+  &::safeheron::proto::multi_party_ecdsa::Li24::sign::_BatchRound0BCMessage_default_instance_._instance,
+  &::safeheron::proto::multi_party_ecdsa::Li24::sign::_BatchRound0P2PMessage_default_instance_._instance,
+  &::safeheron::proto::multi_party_ecdsa::Li24::sign::_BatchRound1BCMessage_default_instance_._instance,
+  &::safeheron::proto::multi_party_ecdsa::Li24::sign::_PresignRound1BCMessage_default_instance_._instance,
+  &::safeheron::proto::multi_party_ecdsa::Li24::sign::_OnlineRound0BCMessage_default_instance_._instance,
 };
 
 const char descriptor_table_protodef_Li24_2fsign_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
   "\n\017Li24/sign.proto\022+safeheron.proto.multi"
   "_party_ecdsa.Li24.sign\032\021curve_point.prot"
-  "o\032\tzkp.proto\"8\n\017Round0BCMessage\022\021\n\tmessa"
-  "ge_a\030\001 \001(\t\022\022\n\ncommitment\030\002 \001(\t\"N\n\020Round0"
-  "P2PMessage\022:\n\013alice_proof\030\003 \001(\0132%.safehe"
-  "ron.proto.PailEncRangeProof_V1\"\311\001\n\020Round"
-  "1P2PMessage\022\035\n\025message_b_for_k_gamma\030\001 \001"
-  "(\t\022\031\n\021message_b_for_k_w\030\002 \001(\t\0227\n\013bob_pro"
-  "of_1\030\003 \001(\0132\".safeheron.proto.PailAffRang"
-  "eProof\022B\n\013bob_proof_2\030\004 \001(\0132-.safeheron."
-  "proto.PailAffGroupEleRangeProof_V1\" \n\017Ro"
-  "und2BCMessage\022\r\n\005delta\030\001 \001(\t\"^\n\017Round3BC"
-  "Message\022\024\n\014blind_factor\030\001 \001(\t\0225\n\021dlog_pr"
-  "oof_gamma_\030\002 \001(\0132\032.safeheron.proto.DLogP"
-  "roof\"%\n\017Round4BCMessage\022\022\n\ncommitment\030\001 "
-  "\001(\t\"\355\001\n\017Round5BCMessage\022&\n\001V\030\001 \001(\0132\033.saf"
-  "eheron.proto.CurvePoint\022&\n\001A\030\002 \001(\0132\033.saf"
-  "eheron.proto.CurvePoint\022\024\n\014blind_factor\030"
-  "\004 \001(\t\022=\n\014lc_proof_VRG\030\005 \001(\0132\'.safeheron."
-  "proto.LinearCombinationProof\0225\n\016dlog_pro"
-  "of_rho\030\006 \001(\0132\035.safeheron.proto.DLogProof"
-  "_V2\"%\n\017Round6BCMessage\022\022\n\ncommitment\030\001 \001"
-  "(\t\"w\n\017Round7BCMessage\022&\n\001U\030\001 \001(\0132\033.safeh"
-  "eron.proto.CurvePoint\022&\n\001T\030\002 \001(\0132\033.safeh"
-  "eron.proto.CurvePoint\022\024\n\014blind_factor\030\003 "
-  "\001(\t\"\035\n\017Round8BCMessage\022\n\n\002si\030\001 \001(\tb\006prot"
-  "o3"
+  "o\":\n\017Round0BCMessage\022\'\n\002GK\030\001 \001(\0132\033.safeh"
+  "eron.proto.CurvePoint\"d\n\020Round0P2PMessag"
+  "e\022\t\n\001w\030\001 \001(\t\022\t\n\001k\030\002 \001(\t\022\013\n\003phi\030\003 \001(\t\022\r\n\005"
+  "w_bin\030\004 \001(\014\022\r\n\005k_bin\030\005 \001(\014\022\017\n\007phi_bin\030\006 "
+  "\001(\014\"N\n\020Round1P2PMessage\022\r\n\005delta\030\001 \001(\t\022\t"
+  "\n\001v\030\002 \001(\t\022\021\n\tdelta_bin\030\003 \001(\014\022\r\n\005v_bin\030\004 "
+  "\001(\014\"?\n\024BatchRound0BCMessage\022\'\n\002GK\030\001 \003(\0132"
+  "\033.safeheron.proto.CurvePoint\"i\n\025BatchRou"
+  "nd0P2PMessage\022\t\n\001w\030\001 \003(\t\022\t\n\001k\030\002 \003(\t\022\013\n\003p"
+  "hi\030\003 \003(\t\022\r\n\005w_bin\030\004 \003(\014\022\r\n\005k_bin\030\005 \003(\014\022\017"
+  "\n\007phi_bin\030\006 \003(\014\"R\n\024BatchRound1BCMessage\022"
+  "\r\n\005delta\030\001 \003(\t\022\t\n\001v\030\002 \003(\t\022\021\n\tdelta_bin\030\003"
+  " \003(\014\022\r\n\005v_bin\030\004 \003(\014\"2\n\026PresignRound1BCMe"
+  "ssage\022\t\n\001v\030\001 \003(\t\022\r\n\005v_bin\030\002 \003(\014\"S\n\025Onlin"
+  "eRound0BCMessage\022\t\n\001r\030\001 \001(\t\022\r\n\005delta\030\002 \001"
+  "(\t\022\r\n\005r_bin\030\003 \001(\014\022\021\n\tdelta_bin\030\004 \001(\014b\006pr"
+  "oto3"
   ;
-static const ::_pbi::DescriptorTable* const descriptor_table_Li24_2fsign_2eproto_deps[2] = {
+static const ::_pbi::DescriptorTable* const descriptor_table_Li24_2fsign_2eproto_deps[1] = {
   &::descriptor_table_curve_5fpoint_2eproto,
-  &::descriptor_table_zkp_2eproto,
 };
 static ::_pbi::once_flag descriptor_table_Li24_2fsign_2eproto_once;
 const ::_pbi::DescriptorTable descriptor_table_Li24_2fsign_2eproto = {
-    false, false, 1042, descriptor_table_protodef_Li24_2fsign_2eproto,
+    false, false, 724, descriptor_table_protodef_Li24_2fsign_2eproto,
     "Li24/sign.proto",
-    &descriptor_table_Li24_2fsign_2eproto_once, descriptor_table_Li24_2fsign_2eproto_deps, 2, 10,
+    &descriptor_table_Li24_2fsign_2eproto_once, descriptor_table_Li24_2fsign_2eproto_deps, 1, 8,
     schemas, file_default_instances, TableStruct_Li24_2fsign_2eproto::offsets,
     file_level_metadata_Li24_2fsign_2eproto, file_level_enum_descriptors_Li24_2fsign_2eproto,
     file_level_service_descriptors_Li24_2fsign_2eproto,
@@ -332,8 +299,19 @@ namespace sign {
 
 class Round0BCMessage::_Internal {
  public:
+  static const ::safeheron::proto::CurvePoint& gk(const Round0BCMessage* msg);
 };
 
+const ::safeheron::proto::CurvePoint&
+Round0BCMessage::_Internal::gk(const Round0BCMessage* msg) {
+  return *msg->gk_;
+}
+void Round0BCMessage::clear_gk() {
+  if (GetArenaForAllocation() == nullptr && gk_ != nullptr) {
+    delete gk_;
+  }
+  gk_ = nullptr;
+}
 Round0BCMessage::Round0BCMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
@@ -343,34 +321,16 @@ Round0BCMessage::Round0BCMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
 Round0BCMessage::Round0BCMessage(const Round0BCMessage& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  message_a_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    message_a_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_message_a().empty()) {
-    message_a_.Set(from._internal_message_a(), 
-      GetArenaForAllocation());
-  }
-  commitment_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    commitment_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_commitment().empty()) {
-    commitment_.Set(from._internal_commitment(), 
-      GetArenaForAllocation());
+  if (from._internal_has_gk()) {
+    gk_ = new ::safeheron::proto::CurvePoint(*from.gk_);
+  } else {
+    gk_ = nullptr;
   }
   // @@protoc_insertion_point(copy_constructor:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0BCMessage)
 }
 
 inline void Round0BCMessage::SharedCtor() {
-message_a_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  message_a_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-commitment_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  commitment_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+gk_ = nullptr;
 }
 
 Round0BCMessage::~Round0BCMessage() {
@@ -384,8 +344,7 @@ Round0BCMessage::~Round0BCMessage() {
 
 inline void Round0BCMessage::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  message_a_.Destroy();
-  commitment_.Destroy();
+  if (this != internal_default_instance()) delete gk_;
 }
 
 void Round0BCMessage::SetCachedSize(int size) const {
@@ -398,8 +357,10 @@ void Round0BCMessage::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  message_a_.ClearToEmpty();
-  commitment_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && gk_ != nullptr) {
+    delete gk_;
+  }
+  gk_ = nullptr;
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -409,23 +370,11 @@ const char* Round0BCMessage::_InternalParse(const char* ptr, ::_pbi::ParseContex
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string message_a = 1;
+      // .safeheron.proto.CurvePoint GK = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_message_a();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.sign.Round0BCMessage.message_a"));
-        } else
-          goto handle_unusual;
-        continue;
-      // string commitment = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          auto str = _internal_mutable_commitment();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          ptr = ctx->ParseMessage(_internal_mutable_gk(), ptr);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.sign.Round0BCMessage.commitment"));
         } else
           goto handle_unusual;
         continue;
@@ -458,24 +407,11 @@ uint8_t* Round0BCMessage::_InternalSerialize(
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string message_a = 1;
-  if (!this->_internal_message_a().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_message_a().data(), static_cast<int>(this->_internal_message_a().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "safeheron.proto.multi_party_ecdsa.Li24.sign.Round0BCMessage.message_a");
-    target = stream->WriteStringMaybeAliased(
-        1, this->_internal_message_a(), target);
-  }
-
-  // string commitment = 2;
-  if (!this->_internal_commitment().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_commitment().data(), static_cast<int>(this->_internal_commitment().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "safeheron.proto.multi_party_ecdsa.Li24.sign.Round0BCMessage.commitment");
-    target = stream->WriteStringMaybeAliased(
-        2, this->_internal_commitment(), target);
+  // .safeheron.proto.CurvePoint GK = 1;
+  if (this->_internal_has_gk()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::gk(this),
+        _Internal::gk(this).GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -494,18 +430,11 @@ size_t Round0BCMessage::ByteSizeLong() const {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string message_a = 1;
-  if (!this->_internal_message_a().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_message_a());
-  }
-
-  // string commitment = 2;
-  if (!this->_internal_commitment().empty()) {
+  // .safeheron.proto.CurvePoint GK = 1;
+  if (this->_internal_has_gk()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_commitment());
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *gk_);
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
@@ -530,11 +459,8 @@ void Round0BCMessage::MergeFrom(const Round0BCMessage& from) {
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!from._internal_message_a().empty()) {
-    _internal_set_message_a(from._internal_message_a());
-  }
-  if (!from._internal_commitment().empty()) {
-    _internal_set_commitment(from._internal_commitment());
+  if (from._internal_has_gk()) {
+    _internal_mutable_gk()->::safeheron::proto::CurvePoint::MergeFrom(from._internal_gk());
   }
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
@@ -552,17 +478,8 @@ bool Round0BCMessage::IsInitialized() const {
 
 void Round0BCMessage::InternalSwap(Round0BCMessage* other) {
   using std::swap;
-  auto* lhs_arena = GetArenaForAllocation();
-  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &message_a_, lhs_arena,
-      &other->message_a_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &commitment_, lhs_arena,
-      &other->commitment_, rhs_arena
-  );
+  swap(gk_, other->gk_);
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Round0BCMessage::GetMetadata() const {
@@ -575,19 +492,8 @@ void Round0BCMessage::InternalSwap(Round0BCMessage* other) {
 
 class Round0P2PMessage::_Internal {
  public:
-  static const ::safeheron::proto::PailEncRangeProof_V1& alice_proof(const Round0P2PMessage* msg);
 };
 
-const ::safeheron::proto::PailEncRangeProof_V1&
-Round0P2PMessage::_Internal::alice_proof(const Round0P2PMessage* msg) {
-  return *msg->alice_proof_;
-}
-void Round0P2PMessage::clear_alice_proof() {
-  if (GetArenaForAllocation() == nullptr && alice_proof_ != nullptr) {
-    delete alice_proof_;
-  }
-  alice_proof_ = nullptr;
-}
 Round0P2PMessage::Round0P2PMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
@@ -597,16 +503,82 @@ Round0P2PMessage::Round0P2PMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
 Round0P2PMessage::Round0P2PMessage(const Round0P2PMessage& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  if (from._internal_has_alice_proof()) {
-    alice_proof_ = new ::safeheron::proto::PailEncRangeProof_V1(*from.alice_proof_);
-  } else {
-    alice_proof_ = nullptr;
+  w_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    w_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_w().empty()) {
+    w_.Set(from._internal_w(), 
+      GetArenaForAllocation());
+  }
+  k_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    k_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_k().empty()) {
+    k_.Set(from._internal_k(), 
+      GetArenaForAllocation());
+  }
+  phi_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    phi_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_phi().empty()) {
+    phi_.Set(from._internal_phi(), 
+      GetArenaForAllocation());
+  }
+  w_bin_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    w_bin_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_w_bin().empty()) {
+    w_bin_.Set(from._internal_w_bin(), 
+      GetArenaForAllocation());
+  }
+  k_bin_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    k_bin_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_k_bin().empty()) {
+    k_bin_.Set(from._internal_k_bin(), 
+      GetArenaForAllocation());
+  }
+  phi_bin_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    phi_bin_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_phi_bin().empty()) {
+    phi_bin_.Set(from._internal_phi_bin(), 
+      GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage)
 }
 
 inline void Round0P2PMessage::SharedCtor() {
-alice_proof_ = nullptr;
+w_.InitDefault();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  w_.Set("", GetArenaForAllocation());
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+k_.InitDefault();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  k_.Set("", GetArenaForAllocation());
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+phi_.InitDefault();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  phi_.Set("", GetArenaForAllocation());
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+w_bin_.InitDefault();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  w_bin_.Set("", GetArenaForAllocation());
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+k_bin_.InitDefault();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  k_bin_.Set("", GetArenaForAllocation());
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+phi_bin_.InitDefault();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  phi_bin_.Set("", GetArenaForAllocation());
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
 Round0P2PMessage::~Round0P2PMessage() {
@@ -620,7 +592,12 @@ Round0P2PMessage::~Round0P2PMessage() {
 
 inline void Round0P2PMessage::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  if (this != internal_default_instance()) delete alice_proof_;
+  w_.Destroy();
+  k_.Destroy();
+  phi_.Destroy();
+  w_bin_.Destroy();
+  k_bin_.Destroy();
+  phi_bin_.Destroy();
 }
 
 void Round0P2PMessage::SetCachedSize(int size) const {
@@ -633,10 +610,12 @@ void Round0P2PMessage::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  if (GetArenaForAllocation() == nullptr && alice_proof_ != nullptr) {
-    delete alice_proof_;
-  }
-  alice_proof_ = nullptr;
+  w_.ClearToEmpty();
+  k_.ClearToEmpty();
+  phi_.ClearToEmpty();
+  w_bin_.ClearToEmpty();
+  k_bin_.ClearToEmpty();
+  phi_bin_.ClearToEmpty();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -646,10 +625,59 @@ const char* Round0P2PMessage::_InternalParse(const char* ptr, ::_pbi::ParseConte
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .safeheron.proto.PailEncRangeProof_V1 alice_proof = 3;
+      // string w = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_w();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.w"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string k = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_k();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.k"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string phi = 3;
       case 3:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          ptr = ctx->ParseMessage(_internal_mutable_alice_proof(), ptr);
+          auto str = _internal_mutable_phi();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.phi"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes w_bin = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_w_bin();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes k_bin = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          auto str = _internal_mutable_k_bin();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes phi_bin = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          auto str = _internal_mutable_phi_bin();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -683,11 +711,52 @@ uint8_t* Round0P2PMessage::_InternalSerialize(
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .safeheron.proto.PailEncRangeProof_V1 alice_proof = 3;
-  if (this->_internal_has_alice_proof()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(3, _Internal::alice_proof(this),
-        _Internal::alice_proof(this).GetCachedSize(), target, stream);
+  // string w = 1;
+  if (!this->_internal_w().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_w().data(), static_cast<int>(this->_internal_w().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.w");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_w(), target);
+  }
+
+  // string k = 2;
+  if (!this->_internal_k().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_k().data(), static_cast<int>(this->_internal_k().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.k");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_k(), target);
+  }
+
+  // string phi = 3;
+  if (!this->_internal_phi().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_phi().data(), static_cast<int>(this->_internal_phi().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.phi");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_phi(), target);
+  }
+
+  // bytes w_bin = 4;
+  if (!this->_internal_w_bin().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_w_bin(), target);
+  }
+
+  // bytes k_bin = 5;
+  if (!this->_internal_k_bin().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        5, this->_internal_k_bin(), target);
+  }
+
+  // bytes phi_bin = 6;
+  if (!this->_internal_phi_bin().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        6, this->_internal_phi_bin(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -706,11 +775,46 @@ size_t Round0P2PMessage::ByteSizeLong() const {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // .safeheron.proto.PailEncRangeProof_V1 alice_proof = 3;
-  if (this->_internal_has_alice_proof()) {
+  // string w = 1;
+  if (!this->_internal_w().empty()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *alice_proof_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_w());
+  }
+
+  // string k = 2;
+  if (!this->_internal_k().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_k());
+  }
+
+  // string phi = 3;
+  if (!this->_internal_phi().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_phi());
+  }
+
+  // bytes w_bin = 4;
+  if (!this->_internal_w_bin().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_w_bin());
+  }
+
+  // bytes k_bin = 5;
+  if (!this->_internal_k_bin().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_k_bin());
+  }
+
+  // bytes phi_bin = 6;
+  if (!this->_internal_phi_bin().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_phi_bin());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
@@ -735,8 +839,23 @@ void Round0P2PMessage::MergeFrom(const Round0P2PMessage& from) {
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (from._internal_has_alice_proof()) {
-    _internal_mutable_alice_proof()->::safeheron::proto::PailEncRangeProof_V1::MergeFrom(from._internal_alice_proof());
+  if (!from._internal_w().empty()) {
+    _internal_set_w(from._internal_w());
+  }
+  if (!from._internal_k().empty()) {
+    _internal_set_k(from._internal_k());
+  }
+  if (!from._internal_phi().empty()) {
+    _internal_set_phi(from._internal_phi());
+  }
+  if (!from._internal_w_bin().empty()) {
+    _internal_set_w_bin(from._internal_w_bin());
+  }
+  if (!from._internal_k_bin().empty()) {
+    _internal_set_k_bin(from._internal_k_bin());
+  }
+  if (!from._internal_phi_bin().empty()) {
+    _internal_set_phi_bin(from._internal_phi_bin());
   }
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
@@ -754,8 +873,33 @@ bool Round0P2PMessage::IsInitialized() const {
 
 void Round0P2PMessage::InternalSwap(Round0P2PMessage* other) {
   using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  swap(alice_proof_, other->alice_proof_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &w_, lhs_arena,
+      &other->w_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &k_, lhs_arena,
+      &other->k_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &phi_, lhs_arena,
+      &other->phi_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &w_bin_, lhs_arena,
+      &other->w_bin_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &k_bin_, lhs_arena,
+      &other->k_bin_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &phi_bin_, lhs_arena,
+      &other->phi_bin_, rhs_arena
+  );
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Round0P2PMessage::GetMetadata() const {
@@ -768,30 +912,8 @@ void Round0P2PMessage::InternalSwap(Round0P2PMessage* other) {
 
 class Round1P2PMessage::_Internal {
  public:
-  static const ::safeheron::proto::PailAffRangeProof& bob_proof_1(const Round1P2PMessage* msg);
-  static const ::safeheron::proto::PailAffGroupEleRangeProof_V1& bob_proof_2(const Round1P2PMessage* msg);
 };
 
-const ::safeheron::proto::PailAffRangeProof&
-Round1P2PMessage::_Internal::bob_proof_1(const Round1P2PMessage* msg) {
-  return *msg->bob_proof_1_;
-}
-const ::safeheron::proto::PailAffGroupEleRangeProof_V1&
-Round1P2PMessage::_Internal::bob_proof_2(const Round1P2PMessage* msg) {
-  return *msg->bob_proof_2_;
-}
-void Round1P2PMessage::clear_bob_proof_1() {
-  if (GetArenaForAllocation() == nullptr && bob_proof_1_ != nullptr) {
-    delete bob_proof_1_;
-  }
-  bob_proof_1_ = nullptr;
-}
-void Round1P2PMessage::clear_bob_proof_2() {
-  if (GetArenaForAllocation() == nullptr && bob_proof_2_ != nullptr) {
-    delete bob_proof_2_;
-  }
-  bob_proof_2_ = nullptr;
-}
 Round1P2PMessage::Round1P2PMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
@@ -801,48 +923,58 @@ Round1P2PMessage::Round1P2PMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
 Round1P2PMessage::Round1P2PMessage(const Round1P2PMessage& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  message_b_for_k_gamma_.InitDefault();
+  delta_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    message_b_for_k_gamma_.Set("", GetArenaForAllocation());
+    delta_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_message_b_for_k_gamma().empty()) {
-    message_b_for_k_gamma_.Set(from._internal_message_b_for_k_gamma(), 
+  if (!from._internal_delta().empty()) {
+    delta_.Set(from._internal_delta(), 
       GetArenaForAllocation());
   }
-  message_b_for_k_w_.InitDefault();
+  v_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    message_b_for_k_w_.Set("", GetArenaForAllocation());
+    v_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_message_b_for_k_w().empty()) {
-    message_b_for_k_w_.Set(from._internal_message_b_for_k_w(), 
+  if (!from._internal_v().empty()) {
+    v_.Set(from._internal_v(), 
       GetArenaForAllocation());
   }
-  if (from._internal_has_bob_proof_1()) {
-    bob_proof_1_ = new ::safeheron::proto::PailAffRangeProof(*from.bob_proof_1_);
-  } else {
-    bob_proof_1_ = nullptr;
+  delta_bin_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    delta_bin_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_delta_bin().empty()) {
+    delta_bin_.Set(from._internal_delta_bin(), 
+      GetArenaForAllocation());
   }
-  if (from._internal_has_bob_proof_2()) {
-    bob_proof_2_ = new ::safeheron::proto::PailAffGroupEleRangeProof_V1(*from.bob_proof_2_);
-  } else {
-    bob_proof_2_ = nullptr;
+  v_bin_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    v_bin_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_v_bin().empty()) {
+    v_bin_.Set(from._internal_v_bin(), 
+      GetArenaForAllocation());
   }
   // @@protoc_insertion_point(copy_constructor:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage)
 }
 
 inline void Round1P2PMessage::SharedCtor() {
-message_b_for_k_gamma_.InitDefault();
+delta_.InitDefault();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  delta_.Set("", GetArenaForAllocation());
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+v_.InitDefault();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  v_.Set("", GetArenaForAllocation());
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+delta_bin_.InitDefault();
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  message_b_for_k_gamma_.Set("", GetArenaForAllocation());
+  delta_bin_.Set("", GetArenaForAllocation());
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-message_b_for_k_w_.InitDefault();
+v_bin_.InitDefault();
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  message_b_for_k_w_.Set("", GetArenaForAllocation());
+  v_bin_.Set("", GetArenaForAllocation());
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-    reinterpret_cast<char*>(&bob_proof_1_) - reinterpret_cast<char*>(this)),
-    0, static_cast<size_t>(reinterpret_cast<char*>(&bob_proof_2_) -
-    reinterpret_cast<char*>(&bob_proof_1_)) + sizeof(bob_proof_2_));
 }
 
 Round1P2PMessage::~Round1P2PMessage() {
@@ -856,10 +988,10 @@ Round1P2PMessage::~Round1P2PMessage() {
 
 inline void Round1P2PMessage::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  message_b_for_k_gamma_.Destroy();
-  message_b_for_k_w_.Destroy();
-  if (this != internal_default_instance()) delete bob_proof_1_;
-  if (this != internal_default_instance()) delete bob_proof_2_;
+  delta_.Destroy();
+  v_.Destroy();
+  delta_bin_.Destroy();
+  v_bin_.Destroy();
 }
 
 void Round1P2PMessage::SetCachedSize(int size) const {
@@ -872,16 +1004,10 @@ void Round1P2PMessage::Clear() {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  message_b_for_k_gamma_.ClearToEmpty();
-  message_b_for_k_w_.ClearToEmpty();
-  if (GetArenaForAllocation() == nullptr && bob_proof_1_ != nullptr) {
-    delete bob_proof_1_;
-  }
-  bob_proof_1_ = nullptr;
-  if (GetArenaForAllocation() == nullptr && bob_proof_2_ != nullptr) {
-    delete bob_proof_2_;
-  }
-  bob_proof_2_ = nullptr;
+  delta_.ClearToEmpty();
+  v_.ClearToEmpty();
+  delta_bin_.ClearToEmpty();
+  v_bin_.ClearToEmpty();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
@@ -891,38 +1017,40 @@ const char* Round1P2PMessage::_InternalParse(const char* ptr, ::_pbi::ParseConte
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string message_b_for_k_gamma = 1;
+      // string delta = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_message_b_for_k_gamma();
+          auto str = _internal_mutable_delta();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.message_b_for_k_gamma"));
+          CHK_(::_pbi::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.delta"));
         } else
           goto handle_unusual;
         continue;
-      // string message_b_for_k_w = 2;
+      // string v = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          auto str = _internal_mutable_message_b_for_k_w();
+          auto str = _internal_mutable_v();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.message_b_for_k_w"));
+          CHK_(::_pbi::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.v"));
         } else
           goto handle_unusual;
         continue;
-      // .safeheron.proto.PailAffRangeProof bob_proof_1 = 3;
+      // bytes delta_bin = 3;
       case 3:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          ptr = ctx->ParseMessage(_internal_mutable_bob_proof_1(), ptr);
+          auto str = _internal_mutable_delta_bin();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
         } else
           goto handle_unusual;
         continue;
-      // .safeheron.proto.PailAffGroupEleRangeProof_V1 bob_proof_2 = 4;
+      // bytes v_bin = 4;
       case 4:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
-          ptr = ctx->ParseMessage(_internal_mutable_bob_proof_2(), ptr);
+          auto str = _internal_mutable_v_bin();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
         } else
           goto handle_unusual;
@@ -956,38 +1084,36 @@ uint8_t* Round1P2PMessage::_InternalSerialize(
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string message_b_for_k_gamma = 1;
-  if (!this->_internal_message_b_for_k_gamma().empty()) {
+  // string delta = 1;
+  if (!this->_internal_delta().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_message_b_for_k_gamma().data(), static_cast<int>(this->_internal_message_b_for_k_gamma().length()),
+      this->_internal_delta().data(), static_cast<int>(this->_internal_delta().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.message_b_for_k_gamma");
+      "safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.delta");
     target = stream->WriteStringMaybeAliased(
-        1, this->_internal_message_b_for_k_gamma(), target);
+        1, this->_internal_delta(), target);
   }
 
-  // string message_b_for_k_w = 2;
-  if (!this->_internal_message_b_for_k_w().empty()) {
+  // string v = 2;
+  if (!this->_internal_v().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_message_b_for_k_w().data(), static_cast<int>(this->_internal_message_b_for_k_w().length()),
+      this->_internal_v().data(), static_cast<int>(this->_internal_v().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.message_b_for_k_w");
+      "safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.v");
     target = stream->WriteStringMaybeAliased(
-        2, this->_internal_message_b_for_k_w(), target);
+        2, this->_internal_v(), target);
   }
 
-  // .safeheron.proto.PailAffRangeProof bob_proof_1 = 3;
-  if (this->_internal_has_bob_proof_1()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(3, _Internal::bob_proof_1(this),
-        _Internal::bob_proof_1(this).GetCachedSize(), target, stream);
+  // bytes delta_bin = 3;
+  if (!this->_internal_delta_bin().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_delta_bin(), target);
   }
 
-  // .safeheron.proto.PailAffGroupEleRangeProof_V1 bob_proof_2 = 4;
-  if (this->_internal_has_bob_proof_2()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(4, _Internal::bob_proof_2(this),
-        _Internal::bob_proof_2(this).GetCachedSize(), target, stream);
+  // bytes v_bin = 4;
+  if (!this->_internal_v_bin().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_v_bin(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
@@ -1006,32 +1132,32 @@ size_t Round1P2PMessage::ByteSizeLong() const {
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string message_b_for_k_gamma = 1;
-  if (!this->_internal_message_b_for_k_gamma().empty()) {
+  // string delta = 1;
+  if (!this->_internal_delta().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_message_b_for_k_gamma());
+        this->_internal_delta());
   }
 
-  // string message_b_for_k_w = 2;
-  if (!this->_internal_message_b_for_k_w().empty()) {
+  // string v = 2;
+  if (!this->_internal_v().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_message_b_for_k_w());
+        this->_internal_v());
   }
 
-  // .safeheron.proto.PailAffRangeProof bob_proof_1 = 3;
-  if (this->_internal_has_bob_proof_1()) {
+  // bytes delta_bin = 3;
+  if (!this->_internal_delta_bin().empty()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *bob_proof_1_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_delta_bin());
   }
 
-  // .safeheron.proto.PailAffGroupEleRangeProof_V1 bob_proof_2 = 4;
-  if (this->_internal_has_bob_proof_2()) {
+  // bytes v_bin = 4;
+  if (!this->_internal_v_bin().empty()) {
     total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *bob_proof_2_);
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_v_bin());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
@@ -1056,17 +1182,17 @@ void Round1P2PMessage::MergeFrom(const Round1P2PMessage& from) {
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!from._internal_message_b_for_k_gamma().empty()) {
-    _internal_set_message_b_for_k_gamma(from._internal_message_b_for_k_gamma());
+  if (!from._internal_delta().empty()) {
+    _internal_set_delta(from._internal_delta());
   }
-  if (!from._internal_message_b_for_k_w().empty()) {
-    _internal_set_message_b_for_k_w(from._internal_message_b_for_k_w());
+  if (!from._internal_v().empty()) {
+    _internal_set_v(from._internal_v());
   }
-  if (from._internal_has_bob_proof_1()) {
-    _internal_mutable_bob_proof_1()->::safeheron::proto::PailAffRangeProof::MergeFrom(from._internal_bob_proof_1());
+  if (!from._internal_delta_bin().empty()) {
+    _internal_set_delta_bin(from._internal_delta_bin());
   }
-  if (from._internal_has_bob_proof_2()) {
-    _internal_mutable_bob_proof_2()->::safeheron::proto::PailAffGroupEleRangeProof_V1::MergeFrom(from._internal_bob_proof_2());
+  if (!from._internal_v_bin().empty()) {
+    _internal_set_v_bin(from._internal_v_bin());
   }
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
@@ -1088,19 +1214,21 @@ void Round1P2PMessage::InternalSwap(Round1P2PMessage* other) {
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &message_b_for_k_gamma_, lhs_arena,
-      &other->message_b_for_k_gamma_, rhs_arena
+      &delta_, lhs_arena,
+      &other->delta_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &v_, lhs_arena,
+      &other->v_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &delta_bin_, lhs_arena,
+      &other->delta_bin_, rhs_arena
   );
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &message_b_for_k_w_, lhs_arena,
-      &other->message_b_for_k_w_, rhs_arena
+      &v_bin_, lhs_arena,
+      &other->v_bin_, rhs_arena
   );
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Round1P2PMessage, bob_proof_2_)
-      + sizeof(Round1P2PMessage::bob_proof_2_)
-      - PROTOBUF_FIELD_OFFSET(Round1P2PMessage, bob_proof_1_)>(
-          reinterpret_cast<char*>(&bob_proof_1_),
-          reinterpret_cast<char*>(&other->bob_proof_1_));
 }
 
 ::PROTOBUF_NAMESPACE_ID::Metadata Round1P2PMessage::GetMetadata() const {
@@ -1111,39 +1239,32 @@ void Round1P2PMessage::InternalSwap(Round1P2PMessage* other) {
 
 // ===================================================================
 
-class Round2BCMessage::_Internal {
+class BatchRound0BCMessage::_Internal {
  public:
 };
 
-Round2BCMessage::Round2BCMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+void BatchRound0BCMessage::clear_gk() {
+  gk_.Clear();
+}
+BatchRound0BCMessage::BatchRound0BCMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned),
+  gk_(arena) {
   SharedCtor();
-  // @@protoc_insertion_point(arena_constructor:safeheron.proto.multi_party_ecdsa.Li24.sign.Round2BCMessage)
+  // @@protoc_insertion_point(arena_constructor:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0BCMessage)
 }
-Round2BCMessage::Round2BCMessage(const Round2BCMessage& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message() {
+BatchRound0BCMessage::BatchRound0BCMessage(const BatchRound0BCMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      gk_(from.gk_) {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  delta_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    delta_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_delta().empty()) {
-    delta_.Set(from._internal_delta(), 
-      GetArenaForAllocation());
-  }
-  // @@protoc_insertion_point(copy_constructor:safeheron.proto.multi_party_ecdsa.Li24.sign.Round2BCMessage)
+  // @@protoc_insertion_point(copy_constructor:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0BCMessage)
 }
 
-inline void Round2BCMessage::SharedCtor() {
-delta_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  delta_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+inline void BatchRound0BCMessage::SharedCtor() {
 }
 
-Round2BCMessage::~Round2BCMessage() {
-  // @@protoc_insertion_point(destructor:safeheron.proto.multi_party_ecdsa.Li24.sign.Round2BCMessage)
+BatchRound0BCMessage::~BatchRound0BCMessage() {
+  // @@protoc_insertion_point(destructor:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0BCMessage)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -1151,263 +1272,40 @@ Round2BCMessage::~Round2BCMessage() {
   SharedDtor();
 }
 
-inline void Round2BCMessage::SharedDtor() {
+inline void BatchRound0BCMessage::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  delta_.Destroy();
 }
 
-void Round2BCMessage::SetCachedSize(int size) const {
+void BatchRound0BCMessage::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
 
-void Round2BCMessage::Clear() {
-// @@protoc_insertion_point(message_clear_start:safeheron.proto.multi_party_ecdsa.Li24.sign.Round2BCMessage)
+void BatchRound0BCMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0BCMessage)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  delta_.ClearToEmpty();
+  gk_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Round2BCMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* BatchRound0BCMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string delta = 1;
+      // repeated .safeheron.proto.CurvePoint GK = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_delta();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.sign.Round2BCMessage.delta"));
-        } else
-          goto handle_unusual;
-        continue;
-      default:
-        goto handle_unusual;
-    }  // switch
-  handle_unusual:
-    if ((tag == 0) || ((tag & 7) == 4)) {
-      CHK_(ptr);
-      ctx->SetLastTag(tag);
-      goto message_done;
-    }
-    ptr = UnknownFieldParse(
-        tag,
-        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-        ptr, ctx);
-    CHK_(ptr != nullptr);
-  }  // while
-message_done:
-  return ptr;
-failure:
-  ptr = nullptr;
-  goto message_done;
-#undef CHK_
-}
-
-uint8_t* Round2BCMessage::_InternalSerialize(
-    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:safeheron.proto.multi_party_ecdsa.Li24.sign.Round2BCMessage)
-  uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // string delta = 1;
-  if (!this->_internal_delta().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_delta().data(), static_cast<int>(this->_internal_delta().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "safeheron.proto.multi_party_ecdsa.Li24.sign.Round2BCMessage.delta");
-    target = stream->WriteStringMaybeAliased(
-        1, this->_internal_delta(), target);
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:safeheron.proto.multi_party_ecdsa.Li24.sign.Round2BCMessage)
-  return target;
-}
-
-size_t Round2BCMessage::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:safeheron.proto.multi_party_ecdsa.Li24.sign.Round2BCMessage)
-  size_t total_size = 0;
-
-  uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  // string delta = 1;
-  if (!this->_internal_delta().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_delta());
-  }
-
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
-}
-
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Round2BCMessage::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
-    Round2BCMessage::MergeImpl
-};
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Round2BCMessage::GetClassData() const { return &_class_data_; }
-
-void Round2BCMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<Round2BCMessage *>(to)->MergeFrom(
-      static_cast<const Round2BCMessage &>(from));
-}
-
-
-void Round2BCMessage::MergeFrom(const Round2BCMessage& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:safeheron.proto.multi_party_ecdsa.Li24.sign.Round2BCMessage)
-  GOOGLE_DCHECK_NE(&from, this);
-  uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_delta().empty()) {
-    _internal_set_delta(from._internal_delta());
-  }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void Round2BCMessage::CopyFrom(const Round2BCMessage& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:safeheron.proto.multi_party_ecdsa.Li24.sign.Round2BCMessage)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool Round2BCMessage::IsInitialized() const {
-  return true;
-}
-
-void Round2BCMessage::InternalSwap(Round2BCMessage* other) {
-  using std::swap;
-  auto* lhs_arena = GetArenaForAllocation();
-  auto* rhs_arena = other->GetArenaForAllocation();
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &delta_, lhs_arena,
-      &other->delta_, rhs_arena
-  );
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata Round2BCMessage::GetMetadata() const {
-  return ::_pbi::AssignDescriptors(
-      &descriptor_table_Li24_2fsign_2eproto_getter, &descriptor_table_Li24_2fsign_2eproto_once,
-      file_level_metadata_Li24_2fsign_2eproto[3]);
-}
-
-// ===================================================================
-
-class Round3BCMessage::_Internal {
- public:
-  static const ::safeheron::proto::DLogProof& dlog_proof_gamma_(const Round3BCMessage* msg);
-};
-
-const ::safeheron::proto::DLogProof&
-Round3BCMessage::_Internal::dlog_proof_gamma_(const Round3BCMessage* msg) {
-  return *msg->dlog_proof_gamma__;
-}
-void Round3BCMessage::clear_dlog_proof_gamma_() {
-  if (GetArenaForAllocation() == nullptr && dlog_proof_gamma__ != nullptr) {
-    delete dlog_proof_gamma__;
-  }
-  dlog_proof_gamma__ = nullptr;
-}
-Round3BCMessage::Round3BCMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-                         bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
-  // @@protoc_insertion_point(arena_constructor:safeheron.proto.multi_party_ecdsa.Li24.sign.Round3BCMessage)
-}
-Round3BCMessage::Round3BCMessage(const Round3BCMessage& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message() {
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  blind_factor_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    blind_factor_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_blind_factor().empty()) {
-    blind_factor_.Set(from._internal_blind_factor(), 
-      GetArenaForAllocation());
-  }
-  if (from._internal_has_dlog_proof_gamma_()) {
-    dlog_proof_gamma__ = new ::safeheron::proto::DLogProof(*from.dlog_proof_gamma__);
-  } else {
-    dlog_proof_gamma__ = nullptr;
-  }
-  // @@protoc_insertion_point(copy_constructor:safeheron.proto.multi_party_ecdsa.Li24.sign.Round3BCMessage)
-}
-
-inline void Round3BCMessage::SharedCtor() {
-blind_factor_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  blind_factor_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-dlog_proof_gamma__ = nullptr;
-}
-
-Round3BCMessage::~Round3BCMessage() {
-  // @@protoc_insertion_point(destructor:safeheron.proto.multi_party_ecdsa.Li24.sign.Round3BCMessage)
-  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
-  (void)arena;
-    return;
-  }
-  SharedDtor();
-}
-
-inline void Round3BCMessage::SharedDtor() {
-  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  blind_factor_.Destroy();
-  if (this != internal_default_instance()) delete dlog_proof_gamma__;
-}
-
-void Round3BCMessage::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-
-void Round3BCMessage::Clear() {
-// @@protoc_insertion_point(message_clear_start:safeheron.proto.multi_party_ecdsa.Li24.sign.Round3BCMessage)
-  uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  blind_factor_.ClearToEmpty();
-  if (GetArenaForAllocation() == nullptr && dlog_proof_gamma__ != nullptr) {
-    delete dlog_proof_gamma__;
-  }
-  dlog_proof_gamma__ = nullptr;
-  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-const char* Round3BCMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
-#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  while (!ctx->Done(&ptr)) {
-    uint32_t tag;
-    ptr = ::_pbi::ReadTag(ptr, &tag);
-    switch (tag >> 3) {
-      // string blind_factor = 1;
-      case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_blind_factor();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.sign.Round3BCMessage.blind_factor"));
-        } else
-          goto handle_unusual;
-        continue;
-      // .safeheron.proto.DLogProof dlog_proof_gamma_ = 2;
-      case 2:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          ptr = ctx->ParseMessage(_internal_mutable_dlog_proof_gamma_(), ptr);
-          CHK_(ptr);
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_gk(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
         } else
           goto handle_unusual;
         continue;
@@ -1434,417 +1332,127 @@ failure:
 #undef CHK_
 }
 
-uint8_t* Round3BCMessage::_InternalSerialize(
+uint8_t* BatchRound0BCMessage::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:safeheron.proto.multi_party_ecdsa.Li24.sign.Round3BCMessage)
+  // @@protoc_insertion_point(serialize_to_array_start:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0BCMessage)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string blind_factor = 1;
-  if (!this->_internal_blind_factor().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_blind_factor().data(), static_cast<int>(this->_internal_blind_factor().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "safeheron.proto.multi_party_ecdsa.Li24.sign.Round3BCMessage.blind_factor");
-    target = stream->WriteStringMaybeAliased(
-        1, this->_internal_blind_factor(), target);
-  }
-
-  // .safeheron.proto.DLogProof dlog_proof_gamma_ = 2;
-  if (this->_internal_has_dlog_proof_gamma_()) {
+  // repeated .safeheron.proto.CurvePoint GK = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_gk_size()); i < n; i++) {
+    const auto& repfield = this->_internal_gk(i);
     target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(2, _Internal::dlog_proof_gamma_(this),
-        _Internal::dlog_proof_gamma_(this).GetCachedSize(), target, stream);
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:safeheron.proto.multi_party_ecdsa.Li24.sign.Round3BCMessage)
+  // @@protoc_insertion_point(serialize_to_array_end:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0BCMessage)
   return target;
 }
 
-size_t Round3BCMessage::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:safeheron.proto.multi_party_ecdsa.Li24.sign.Round3BCMessage)
+size_t BatchRound0BCMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0BCMessage)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string blind_factor = 1;
-  if (!this->_internal_blind_factor().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_blind_factor());
-  }
-
-  // .safeheron.proto.DLogProof dlog_proof_gamma_ = 2;
-  if (this->_internal_has_dlog_proof_gamma_()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *dlog_proof_gamma__);
+  // repeated .safeheron.proto.CurvePoint GK = 1;
+  total_size += 1UL * this->_internal_gk_size();
+  for (const auto& msg : this->gk_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Round3BCMessage::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BatchRound0BCMessage::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
-    Round3BCMessage::MergeImpl
+    BatchRound0BCMessage::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Round3BCMessage::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BatchRound0BCMessage::GetClassData() const { return &_class_data_; }
 
-void Round3BCMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
+void BatchRound0BCMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
                       const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<Round3BCMessage *>(to)->MergeFrom(
-      static_cast<const Round3BCMessage &>(from));
+  static_cast<BatchRound0BCMessage *>(to)->MergeFrom(
+      static_cast<const BatchRound0BCMessage &>(from));
 }
 
 
-void Round3BCMessage::MergeFrom(const Round3BCMessage& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:safeheron.proto.multi_party_ecdsa.Li24.sign.Round3BCMessage)
+void BatchRound0BCMessage::MergeFrom(const BatchRound0BCMessage& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0BCMessage)
   GOOGLE_DCHECK_NE(&from, this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!from._internal_blind_factor().empty()) {
-    _internal_set_blind_factor(from._internal_blind_factor());
-  }
-  if (from._internal_has_dlog_proof_gamma_()) {
-    _internal_mutable_dlog_proof_gamma_()->::safeheron::proto::DLogProof::MergeFrom(from._internal_dlog_proof_gamma_());
-  }
+  gk_.MergeFrom(from.gk_);
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Round3BCMessage::CopyFrom(const Round3BCMessage& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:safeheron.proto.multi_party_ecdsa.Li24.sign.Round3BCMessage)
+void BatchRound0BCMessage::CopyFrom(const BatchRound0BCMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0BCMessage)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Round3BCMessage::IsInitialized() const {
+bool BatchRound0BCMessage::IsInitialized() const {
   return true;
 }
 
-void Round3BCMessage::InternalSwap(Round3BCMessage* other) {
+void BatchRound0BCMessage::InternalSwap(BatchRound0BCMessage* other) {
   using std::swap;
-  auto* lhs_arena = GetArenaForAllocation();
-  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &blind_factor_, lhs_arena,
-      &other->blind_factor_, rhs_arena
-  );
-  swap(dlog_proof_gamma__, other->dlog_proof_gamma__);
+  gk_.InternalSwap(&other->gk_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata Round3BCMessage::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata BatchRound0BCMessage::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_Li24_2fsign_2eproto_getter, &descriptor_table_Li24_2fsign_2eproto_once,
-      file_level_metadata_Li24_2fsign_2eproto[4]);
-}
-
-// ===================================================================
-
-class Round4BCMessage::_Internal {
- public:
-};
-
-Round4BCMessage::Round4BCMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-                         bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
-  SharedCtor();
-  // @@protoc_insertion_point(arena_constructor:safeheron.proto.multi_party_ecdsa.Li24.sign.Round4BCMessage)
-}
-Round4BCMessage::Round4BCMessage(const Round4BCMessage& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message() {
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  commitment_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    commitment_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_commitment().empty()) {
-    commitment_.Set(from._internal_commitment(), 
-      GetArenaForAllocation());
-  }
-  // @@protoc_insertion_point(copy_constructor:safeheron.proto.multi_party_ecdsa.Li24.sign.Round4BCMessage)
-}
-
-inline void Round4BCMessage::SharedCtor() {
-commitment_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  commitment_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-}
-
-Round4BCMessage::~Round4BCMessage() {
-  // @@protoc_insertion_point(destructor:safeheron.proto.multi_party_ecdsa.Li24.sign.Round4BCMessage)
-  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
-  (void)arena;
-    return;
-  }
-  SharedDtor();
-}
-
-inline void Round4BCMessage::SharedDtor() {
-  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  commitment_.Destroy();
-}
-
-void Round4BCMessage::SetCachedSize(int size) const {
-  _cached_size_.Set(size);
-}
-
-void Round4BCMessage::Clear() {
-// @@protoc_insertion_point(message_clear_start:safeheron.proto.multi_party_ecdsa.Li24.sign.Round4BCMessage)
-  uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  commitment_.ClearToEmpty();
-  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
-}
-
-const char* Round4BCMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
-#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
-  while (!ctx->Done(&ptr)) {
-    uint32_t tag;
-    ptr = ::_pbi::ReadTag(ptr, &tag);
-    switch (tag >> 3) {
-      // string commitment = 1;
-      case 1:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_commitment();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.sign.Round4BCMessage.commitment"));
-        } else
-          goto handle_unusual;
-        continue;
-      default:
-        goto handle_unusual;
-    }  // switch
-  handle_unusual:
-    if ((tag == 0) || ((tag & 7) == 4)) {
-      CHK_(ptr);
-      ctx->SetLastTag(tag);
-      goto message_done;
-    }
-    ptr = UnknownFieldParse(
-        tag,
-        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
-        ptr, ctx);
-    CHK_(ptr != nullptr);
-  }  // while
-message_done:
-  return ptr;
-failure:
-  ptr = nullptr;
-  goto message_done;
-#undef CHK_
-}
-
-uint8_t* Round4BCMessage::_InternalSerialize(
-    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:safeheron.proto.multi_party_ecdsa.Li24.sign.Round4BCMessage)
-  uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  // string commitment = 1;
-  if (!this->_internal_commitment().empty()) {
-    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_commitment().data(), static_cast<int>(this->_internal_commitment().length()),
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "safeheron.proto.multi_party_ecdsa.Li24.sign.Round4BCMessage.commitment");
-    target = stream->WriteStringMaybeAliased(
-        1, this->_internal_commitment(), target);
-  }
-
-  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
-    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
-        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
-  }
-  // @@protoc_insertion_point(serialize_to_array_end:safeheron.proto.multi_party_ecdsa.Li24.sign.Round4BCMessage)
-  return target;
-}
-
-size_t Round4BCMessage::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:safeheron.proto.multi_party_ecdsa.Li24.sign.Round4BCMessage)
-  size_t total_size = 0;
-
-  uint32_t cached_has_bits = 0;
-  // Prevent compiler warnings about cached_has_bits being unused
-  (void) cached_has_bits;
-
-  // string commitment = 1;
-  if (!this->_internal_commitment().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_commitment());
-  }
-
-  return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
-}
-
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Round4BCMessage::_class_data_ = {
-    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
-    Round4BCMessage::MergeImpl
-};
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Round4BCMessage::GetClassData() const { return &_class_data_; }
-
-void Round4BCMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
-                      const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<Round4BCMessage *>(to)->MergeFrom(
-      static_cast<const Round4BCMessage &>(from));
-}
-
-
-void Round4BCMessage::MergeFrom(const Round4BCMessage& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:safeheron.proto.multi_party_ecdsa.Li24.sign.Round4BCMessage)
-  GOOGLE_DCHECK_NE(&from, this);
-  uint32_t cached_has_bits = 0;
-  (void) cached_has_bits;
-
-  if (!from._internal_commitment().empty()) {
-    _internal_set_commitment(from._internal_commitment());
-  }
-  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-}
-
-void Round4BCMessage::CopyFrom(const Round4BCMessage& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:safeheron.proto.multi_party_ecdsa.Li24.sign.Round4BCMessage)
-  if (&from == this) return;
-  Clear();
-  MergeFrom(from);
-}
-
-bool Round4BCMessage::IsInitialized() const {
-  return true;
-}
-
-void Round4BCMessage::InternalSwap(Round4BCMessage* other) {
-  using std::swap;
-  auto* lhs_arena = GetArenaForAllocation();
-  auto* rhs_arena = other->GetArenaForAllocation();
-  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &commitment_, lhs_arena,
-      &other->commitment_, rhs_arena
-  );
-}
-
-::PROTOBUF_NAMESPACE_ID::Metadata Round4BCMessage::GetMetadata() const {
-  return ::_pbi::AssignDescriptors(
-      &descriptor_table_Li24_2fsign_2eproto_getter, &descriptor_table_Li24_2fsign_2eproto_once,
-      file_level_metadata_Li24_2fsign_2eproto[5]);
+      file_level_metadata_Li24_2fsign_2eproto[3]);
 }
 
 // ===================================================================
 
-class Round5BCMessage::_Internal {
+class BatchRound0P2PMessage::_Internal {
  public:
-  static const ::safeheron::proto::CurvePoint& v(const Round5BCMessage* msg);
-  static const ::safeheron::proto::CurvePoint& a(const Round5BCMessage* msg);
-  static const ::safeheron::proto::LinearCombinationProof& lc_proof_vrg(const Round5BCMessage* msg);
-  static const ::safeheron::proto::DLogProof_V2& dlog_proof_rho(const Round5BCMessage* msg);
 };
 
-const ::safeheron::proto::CurvePoint&
-Round5BCMessage::_Internal::v(const Round5BCMessage* msg) {
-  return *msg->v_;
-}
-const ::safeheron::proto::CurvePoint&
-Round5BCMessage::_Internal::a(const Round5BCMessage* msg) {
-  return *msg->a_;
-}
-const ::safeheron::proto::LinearCombinationProof&
-Round5BCMessage::_Internal::lc_proof_vrg(const Round5BCMessage* msg) {
-  return *msg->lc_proof_vrg_;
-}
-const ::safeheron::proto::DLogProof_V2&
-Round5BCMessage::_Internal::dlog_proof_rho(const Round5BCMessage* msg) {
-  return *msg->dlog_proof_rho_;
-}
-void Round5BCMessage::clear_v() {
-  if (GetArenaForAllocation() == nullptr && v_ != nullptr) {
-    delete v_;
-  }
-  v_ = nullptr;
-}
-void Round5BCMessage::clear_a() {
-  if (GetArenaForAllocation() == nullptr && a_ != nullptr) {
-    delete a_;
-  }
-  a_ = nullptr;
-}
-void Round5BCMessage::clear_lc_proof_vrg() {
-  if (GetArenaForAllocation() == nullptr && lc_proof_vrg_ != nullptr) {
-    delete lc_proof_vrg_;
-  }
-  lc_proof_vrg_ = nullptr;
-}
-void Round5BCMessage::clear_dlog_proof_rho() {
-  if (GetArenaForAllocation() == nullptr && dlog_proof_rho_ != nullptr) {
-    delete dlog_proof_rho_;
-  }
-  dlog_proof_rho_ = nullptr;
-}
-Round5BCMessage::Round5BCMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+BatchRound0P2PMessage::BatchRound0P2PMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned),
+  w_(arena),
+  k_(arena),
+  phi_(arena),
+  w_bin_(arena),
+  k_bin_(arena),
+  phi_bin_(arena) {
   SharedCtor();
-  // @@protoc_insertion_point(arena_constructor:safeheron.proto.multi_party_ecdsa.Li24.sign.Round5BCMessage)
-}
-Round5BCMessage::Round5BCMessage(const Round5BCMessage& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  // @@protoc_insertion_point(arena_constructor:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage)
+}
+BatchRound0P2PMessage::BatchRound0P2PMessage(const BatchRound0P2PMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      w_(from.w_),
+      k_(from.k_),
+      phi_(from.phi_),
+      w_bin_(from.w_bin_),
+      k_bin_(from.k_bin_),
+      phi_bin_(from.phi_bin_) {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  blind_factor_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    blind_factor_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_blind_factor().empty()) {
-    blind_factor_.Set(from._internal_blind_factor(), 
-      GetArenaForAllocation());
-  }
-  if (from._internal_has_v()) {
-    v_ = new ::safeheron::proto::CurvePoint(*from.v_);
-  } else {
-    v_ = nullptr;
-  }
-  if (from._internal_has_a()) {
-    a_ = new ::safeheron::proto::CurvePoint(*from.a_);
-  } else {
-    a_ = nullptr;
-  }
-  if (from._internal_has_lc_proof_vrg()) {
-    lc_proof_vrg_ = new ::safeheron::proto::LinearCombinationProof(*from.lc_proof_vrg_);
-  } else {
-    lc_proof_vrg_ = nullptr;
-  }
-  if (from._internal_has_dlog_proof_rho()) {
-    dlog_proof_rho_ = new ::safeheron::proto::DLogProof_V2(*from.dlog_proof_rho_);
-  } else {
-    dlog_proof_rho_ = nullptr;
-  }
-  // @@protoc_insertion_point(copy_constructor:safeheron.proto.multi_party_ecdsa.Li24.sign.Round5BCMessage)
+  // @@protoc_insertion_point(copy_constructor:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage)
 }
 
-inline void Round5BCMessage::SharedCtor() {
-blind_factor_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  blind_factor_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-    reinterpret_cast<char*>(&v_) - reinterpret_cast<char*>(this)),
-    0, static_cast<size_t>(reinterpret_cast<char*>(&dlog_proof_rho_) -
-    reinterpret_cast<char*>(&v_)) + sizeof(dlog_proof_rho_));
+inline void BatchRound0P2PMessage::SharedCtor() {
 }
 
-Round5BCMessage::~Round5BCMessage() {
-  // @@protoc_insertion_point(destructor:safeheron.proto.multi_party_ecdsa.Li24.sign.Round5BCMessage)
+BatchRound0P2PMessage::~BatchRound0P2PMessage() {
+  // @@protoc_insertion_point(destructor:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -1852,90 +1460,119 @@ Round5BCMessage::~Round5BCMessage() {
   SharedDtor();
 }
 
-inline void Round5BCMessage::SharedDtor() {
+inline void BatchRound0P2PMessage::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  blind_factor_.Destroy();
-  if (this != internal_default_instance()) delete v_;
-  if (this != internal_default_instance()) delete a_;
-  if (this != internal_default_instance()) delete lc_proof_vrg_;
-  if (this != internal_default_instance()) delete dlog_proof_rho_;
 }
 
-void Round5BCMessage::SetCachedSize(int size) const {
+void BatchRound0P2PMessage::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
 
-void Round5BCMessage::Clear() {
-// @@protoc_insertion_point(message_clear_start:safeheron.proto.multi_party_ecdsa.Li24.sign.Round5BCMessage)
+void BatchRound0P2PMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  blind_factor_.ClearToEmpty();
-  if (GetArenaForAllocation() == nullptr && v_ != nullptr) {
-    delete v_;
-  }
-  v_ = nullptr;
-  if (GetArenaForAllocation() == nullptr && a_ != nullptr) {
-    delete a_;
-  }
-  a_ = nullptr;
-  if (GetArenaForAllocation() == nullptr && lc_proof_vrg_ != nullptr) {
-    delete lc_proof_vrg_;
-  }
-  lc_proof_vrg_ = nullptr;
-  if (GetArenaForAllocation() == nullptr && dlog_proof_rho_ != nullptr) {
-    delete dlog_proof_rho_;
-  }
-  dlog_proof_rho_ = nullptr;
+  w_.Clear();
+  k_.Clear();
+  phi_.Clear();
+  w_bin_.Clear();
+  k_bin_.Clear();
+  phi_bin_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Round5BCMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* BatchRound0P2PMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .safeheron.proto.CurvePoint V = 1;
+      // repeated string w = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          ptr = ctx->ParseMessage(_internal_mutable_v(), ptr);
-          CHK_(ptr);
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_w();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
         } else
           goto handle_unusual;
         continue;
-      // .safeheron.proto.CurvePoint A = 2;
+      // repeated string k = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          ptr = ctx->ParseMessage(_internal_mutable_a(), ptr);
-          CHK_(ptr);
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_k();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string phi = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_phi();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
         } else
           goto handle_unusual;
         continue;
-      // string blind_factor = 4;
+      // repeated bytes w_bin = 4;
       case 4:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
-          auto str = _internal_mutable_blind_factor();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.sign.Round5BCMessage.blind_factor"));
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_w_bin();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
         } else
           goto handle_unusual;
         continue;
-      // .safeheron.proto.LinearCombinationProof lc_proof_VRG = 5;
+      // repeated bytes k_bin = 5;
       case 5:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
-          ptr = ctx->ParseMessage(_internal_mutable_lc_proof_vrg(), ptr);
-          CHK_(ptr);
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_k_bin();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
         } else
           goto handle_unusual;
         continue;
-      // .safeheron.proto.DLogProof_V2 dlog_proof_rho = 6;
+      // repeated bytes phi_bin = 6;
       case 6:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
-          ptr = ctx->ParseMessage(_internal_mutable_dlog_proof_rho(), ptr);
-          CHK_(ptr);
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_phi_bin();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<50>(ptr));
         } else
           goto handle_unusual;
         continue;
@@ -1962,210 +1599,214 @@ failure:
 #undef CHK_
 }
 
-uint8_t* Round5BCMessage::_InternalSerialize(
+uint8_t* BatchRound0P2PMessage::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:safeheron.proto.multi_party_ecdsa.Li24.sign.Round5BCMessage)
+  // @@protoc_insertion_point(serialize_to_array_start:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .safeheron.proto.CurvePoint V = 1;
-  if (this->_internal_has_v()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, _Internal::v(this),
-        _Internal::v(this).GetCachedSize(), target, stream);
+  // repeated string w = 1;
+  for (int i = 0, n = this->_internal_w_size(); i < n; i++) {
+    const auto& s = this->_internal_w(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w");
+    target = stream->WriteString(1, s, target);
   }
 
-  // .safeheron.proto.CurvePoint A = 2;
-  if (this->_internal_has_a()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(2, _Internal::a(this),
-        _Internal::a(this).GetCachedSize(), target, stream);
+  // repeated string k = 2;
+  for (int i = 0, n = this->_internal_k_size(); i < n; i++) {
+    const auto& s = this->_internal_k(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k");
+    target = stream->WriteString(2, s, target);
   }
 
-  // string blind_factor = 4;
-  if (!this->_internal_blind_factor().empty()) {
+  // repeated string phi = 3;
+  for (int i = 0, n = this->_internal_phi_size(); i < n; i++) {
+    const auto& s = this->_internal_phi(i);
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_blind_factor().data(), static_cast<int>(this->_internal_blind_factor().length()),
+      s.data(), static_cast<int>(s.length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "safeheron.proto.multi_party_ecdsa.Li24.sign.Round5BCMessage.blind_factor");
-    target = stream->WriteStringMaybeAliased(
-        4, this->_internal_blind_factor(), target);
+      "safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi");
+    target = stream->WriteString(3, s, target);
   }
 
-  // .safeheron.proto.LinearCombinationProof lc_proof_VRG = 5;
-  if (this->_internal_has_lc_proof_vrg()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(5, _Internal::lc_proof_vrg(this),
-        _Internal::lc_proof_vrg(this).GetCachedSize(), target, stream);
+  // repeated bytes w_bin = 4;
+  for (int i = 0, n = this->_internal_w_bin_size(); i < n; i++) {
+    const auto& s = this->_internal_w_bin(i);
+    target = stream->WriteBytes(4, s, target);
   }
 
-  // .safeheron.proto.DLogProof_V2 dlog_proof_rho = 6;
-  if (this->_internal_has_dlog_proof_rho()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(6, _Internal::dlog_proof_rho(this),
-        _Internal::dlog_proof_rho(this).GetCachedSize(), target, stream);
+  // repeated bytes k_bin = 5;
+  for (int i = 0, n = this->_internal_k_bin_size(); i < n; i++) {
+    const auto& s = this->_internal_k_bin(i);
+    target = stream->WriteBytes(5, s, target);
+  }
+
+  // repeated bytes phi_bin = 6;
+  for (int i = 0, n = this->_internal_phi_bin_size(); i < n; i++) {
+    const auto& s = this->_internal_phi_bin(i);
+    target = stream->WriteBytes(6, s, target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:safeheron.proto.multi_party_ecdsa.Li24.sign.Round5BCMessage)
+  // @@protoc_insertion_point(serialize_to_array_end:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage)
   return target;
 }
 
-size_t Round5BCMessage::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:safeheron.proto.multi_party_ecdsa.Li24.sign.Round5BCMessage)
+size_t BatchRound0P2PMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string blind_factor = 4;
-  if (!this->_internal_blind_factor().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_blind_factor());
+  // repeated string w = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(w_.size());
+  for (int i = 0, n = w_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      w_.Get(i));
   }
 
-  // .safeheron.proto.CurvePoint V = 1;
-  if (this->_internal_has_v()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *v_);
+  // repeated string k = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(k_.size());
+  for (int i = 0, n = k_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      k_.Get(i));
   }
 
-  // .safeheron.proto.CurvePoint A = 2;
-  if (this->_internal_has_a()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *a_);
+  // repeated string phi = 3;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(phi_.size());
+  for (int i = 0, n = phi_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      phi_.Get(i));
   }
 
-  // .safeheron.proto.LinearCombinationProof lc_proof_VRG = 5;
-  if (this->_internal_has_lc_proof_vrg()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *lc_proof_vrg_);
+  // repeated bytes w_bin = 4;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(w_bin_.size());
+  for (int i = 0, n = w_bin_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      w_bin_.Get(i));
   }
 
-  // .safeheron.proto.DLogProof_V2 dlog_proof_rho = 6;
-  if (this->_internal_has_dlog_proof_rho()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *dlog_proof_rho_);
+  // repeated bytes k_bin = 5;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(k_bin_.size());
+  for (int i = 0, n = k_bin_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      k_bin_.Get(i));
+  }
+
+  // repeated bytes phi_bin = 6;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(phi_bin_.size());
+  for (int i = 0, n = phi_bin_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      phi_bin_.Get(i));
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Round5BCMessage::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BatchRound0P2PMessage::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
-    Round5BCMessage::MergeImpl
+    BatchRound0P2PMessage::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Round5BCMessage::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BatchRound0P2PMessage::GetClassData() const { return &_class_data_; }
 
-void Round5BCMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
+void BatchRound0P2PMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
                       const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<Round5BCMessage *>(to)->MergeFrom(
-      static_cast<const Round5BCMessage &>(from));
+  static_cast<BatchRound0P2PMessage *>(to)->MergeFrom(
+      static_cast<const BatchRound0P2PMessage &>(from));
 }
 
 
-void Round5BCMessage::MergeFrom(const Round5BCMessage& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:safeheron.proto.multi_party_ecdsa.Li24.sign.Round5BCMessage)
+void BatchRound0P2PMessage::MergeFrom(const BatchRound0P2PMessage& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage)
   GOOGLE_DCHECK_NE(&from, this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!from._internal_blind_factor().empty()) {
-    _internal_set_blind_factor(from._internal_blind_factor());
-  }
-  if (from._internal_has_v()) {
-    _internal_mutable_v()->::safeheron::proto::CurvePoint::MergeFrom(from._internal_v());
-  }
-  if (from._internal_has_a()) {
-    _internal_mutable_a()->::safeheron::proto::CurvePoint::MergeFrom(from._internal_a());
-  }
-  if (from._internal_has_lc_proof_vrg()) {
-    _internal_mutable_lc_proof_vrg()->::safeheron::proto::LinearCombinationProof::MergeFrom(from._internal_lc_proof_vrg());
-  }
-  if (from._internal_has_dlog_proof_rho()) {
-    _internal_mutable_dlog_proof_rho()->::safeheron::proto::DLogProof_V2::MergeFrom(from._internal_dlog_proof_rho());
-  }
+  w_.MergeFrom(from.w_);
+  k_.MergeFrom(from.k_);
+  phi_.MergeFrom(from.phi_);
+  w_bin_.MergeFrom(from.w_bin_);
+  k_bin_.MergeFrom(from.k_bin_);
+  phi_bin_.MergeFrom(from.phi_bin_);
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Round5BCMessage::CopyFrom(const Round5BCMessage& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:safeheron.proto.multi_party_ecdsa.Li24.sign.Round5BCMessage)
+void BatchRound0P2PMessage::CopyFrom(const BatchRound0P2PMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Round5BCMessage::IsInitialized() const {
+bool BatchRound0P2PMessage::IsInitialized() const {
   return true;
 }
 
-void Round5BCMessage::InternalSwap(Round5BCMessage* other) {
+void BatchRound0P2PMessage::InternalSwap(BatchRound0P2PMessage* other) {
   using std::swap;
-  auto* lhs_arena = GetArenaForAllocation();
-  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &blind_factor_, lhs_arena,
-      &other->blind_factor_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Round5BCMessage, dlog_proof_rho_)
-      + sizeof(Round5BCMessage::dlog_proof_rho_)
-      - PROTOBUF_FIELD_OFFSET(Round5BCMessage, v_)>(
-          reinterpret_cast<char*>(&v_),
-          reinterpret_cast<char*>(&other->v_));
+  w_.InternalSwap(&other->w_);
+  k_.InternalSwap(&other->k_);
+  phi_.InternalSwap(&other->phi_);
+  w_bin_.InternalSwap(&other->w_bin_);
+  k_bin_.InternalSwap(&other->k_bin_);
+  phi_bin_.InternalSwap(&other->phi_bin_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata Round5BCMessage::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata BatchRound0P2PMessage::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_Li24_2fsign_2eproto_getter, &descriptor_table_Li24_2fsign_2eproto_once,
-      file_level_metadata_Li24_2fsign_2eproto[6]);
+      file_level_metadata_Li24_2fsign_2eproto[4]);
 }
 
 // ===================================================================
 
-class Round6BCMessage::_Internal {
+class BatchRound1BCMessage::_Internal {
  public:
 };
 
-Round6BCMessage::Round6BCMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+BatchRound1BCMessage::BatchRound1BCMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned),
+  delta_(arena),
+  v_(arena),
+  delta_bin_(arena),
+  v_bin_(arena) {
   SharedCtor();
-  // @@protoc_insertion_point(arena_constructor:safeheron.proto.multi_party_ecdsa.Li24.sign.Round6BCMessage)
-}
-Round6BCMessage::Round6BCMessage(const Round6BCMessage& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  // @@protoc_insertion_point(arena_constructor:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage)
+}
+BatchRound1BCMessage::BatchRound1BCMessage(const BatchRound1BCMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      delta_(from.delta_),
+      v_(from.v_),
+      delta_bin_(from.delta_bin_),
+      v_bin_(from.v_bin_) {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  commitment_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    commitment_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_commitment().empty()) {
-    commitment_.Set(from._internal_commitment(), 
-      GetArenaForAllocation());
-  }
-  // @@protoc_insertion_point(copy_constructor:safeheron.proto.multi_party_ecdsa.Li24.sign.Round6BCMessage)
+  // @@protoc_insertion_point(copy_constructor:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage)
 }
 
-inline void Round6BCMessage::SharedCtor() {
-commitment_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  commitment_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+inline void BatchRound1BCMessage::SharedCtor() {
 }
 
-Round6BCMessage::~Round6BCMessage() {
-  // @@protoc_insertion_point(destructor:safeheron.proto.multi_party_ecdsa.Li24.sign.Round6BCMessage)
+BatchRound1BCMessage::~BatchRound1BCMessage() {
+  // @@protoc_insertion_point(destructor:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -2173,38 +1814,88 @@ Round6BCMessage::~Round6BCMessage() {
   SharedDtor();
 }
 
-inline void Round6BCMessage::SharedDtor() {
+inline void BatchRound1BCMessage::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  commitment_.Destroy();
 }
 
-void Round6BCMessage::SetCachedSize(int size) const {
+void BatchRound1BCMessage::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
 
-void Round6BCMessage::Clear() {
-// @@protoc_insertion_point(message_clear_start:safeheron.proto.multi_party_ecdsa.Li24.sign.Round6BCMessage)
+void BatchRound1BCMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  commitment_.ClearToEmpty();
+  delta_.Clear();
+  v_.Clear();
+  delta_bin_.Clear();
+  v_bin_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Round6BCMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* BatchRound1BCMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string commitment = 1;
+      // repeated string delta = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_commitment();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.sign.Round6BCMessage.commitment"));
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_delta();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated string v = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_v();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated bytes delta_bin = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_delta_bin();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated bytes v_bin = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_v_bin();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
         } else
           goto handle_unusual;
         continue;
@@ -2231,172 +1922,174 @@ failure:
 #undef CHK_
 }
 
-uint8_t* Round6BCMessage::_InternalSerialize(
+uint8_t* BatchRound1BCMessage::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:safeheron.proto.multi_party_ecdsa.Li24.sign.Round6BCMessage)
+  // @@protoc_insertion_point(serialize_to_array_start:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string commitment = 1;
-  if (!this->_internal_commitment().empty()) {
+  // repeated string delta = 1;
+  for (int i = 0, n = this->_internal_delta_size(); i < n; i++) {
+    const auto& s = this->_internal_delta(i);
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_commitment().data(), static_cast<int>(this->_internal_commitment().length()),
+      s.data(), static_cast<int>(s.length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "safeheron.proto.multi_party_ecdsa.Li24.sign.Round6BCMessage.commitment");
-    target = stream->WriteStringMaybeAliased(
-        1, this->_internal_commitment(), target);
+      "safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta");
+    target = stream->WriteString(1, s, target);
+  }
+
+  // repeated string v = 2;
+  for (int i = 0, n = this->_internal_v_size(); i < n; i++) {
+    const auto& s = this->_internal_v(i);
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      s.data(), static_cast<int>(s.length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v");
+    target = stream->WriteString(2, s, target);
+  }
+
+  // repeated bytes delta_bin = 3;
+  for (int i = 0, n = this->_internal_delta_bin_size(); i < n; i++) {
+    const auto& s = this->_internal_delta_bin(i);
+    target = stream->WriteBytes(3, s, target);
+  }
+
+  // repeated bytes v_bin = 4;
+  for (int i = 0, n = this->_internal_v_bin_size(); i < n; i++) {
+    const auto& s = this->_internal_v_bin(i);
+    target = stream->WriteBytes(4, s, target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:safeheron.proto.multi_party_ecdsa.Li24.sign.Round6BCMessage)
+  // @@protoc_insertion_point(serialize_to_array_end:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage)
   return target;
 }
 
-size_t Round6BCMessage::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:safeheron.proto.multi_party_ecdsa.Li24.sign.Round6BCMessage)
+size_t BatchRound1BCMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string commitment = 1;
-  if (!this->_internal_commitment().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_commitment());
+  // repeated string delta = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(delta_.size());
+  for (int i = 0, n = delta_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      delta_.Get(i));
+  }
+
+  // repeated string v = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(v_.size());
+  for (int i = 0, n = v_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      v_.Get(i));
+  }
+
+  // repeated bytes delta_bin = 3;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(delta_bin_.size());
+  for (int i = 0, n = delta_bin_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      delta_bin_.Get(i));
+  }
+
+  // repeated bytes v_bin = 4;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(v_bin_.size());
+  for (int i = 0, n = v_bin_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      v_bin_.Get(i));
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Round6BCMessage::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BatchRound1BCMessage::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
-    Round6BCMessage::MergeImpl
+    BatchRound1BCMessage::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Round6BCMessage::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BatchRound1BCMessage::GetClassData() const { return &_class_data_; }
 
-void Round6BCMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
+void BatchRound1BCMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
                       const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<Round6BCMessage *>(to)->MergeFrom(
-      static_cast<const Round6BCMessage &>(from));
+  static_cast<BatchRound1BCMessage *>(to)->MergeFrom(
+      static_cast<const BatchRound1BCMessage &>(from));
 }
 
 
-void Round6BCMessage::MergeFrom(const Round6BCMessage& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:safeheron.proto.multi_party_ecdsa.Li24.sign.Round6BCMessage)
+void BatchRound1BCMessage::MergeFrom(const BatchRound1BCMessage& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage)
   GOOGLE_DCHECK_NE(&from, this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!from._internal_commitment().empty()) {
-    _internal_set_commitment(from._internal_commitment());
-  }
+  delta_.MergeFrom(from.delta_);
+  v_.MergeFrom(from.v_);
+  delta_bin_.MergeFrom(from.delta_bin_);
+  v_bin_.MergeFrom(from.v_bin_);
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Round6BCMessage::CopyFrom(const Round6BCMessage& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:safeheron.proto.multi_party_ecdsa.Li24.sign.Round6BCMessage)
+void BatchRound1BCMessage::CopyFrom(const BatchRound1BCMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Round6BCMessage::IsInitialized() const {
+bool BatchRound1BCMessage::IsInitialized() const {
   return true;
 }
 
-void Round6BCMessage::InternalSwap(Round6BCMessage* other) {
+void BatchRound1BCMessage::InternalSwap(BatchRound1BCMessage* other) {
   using std::swap;
-  auto* lhs_arena = GetArenaForAllocation();
-  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &commitment_, lhs_arena,
-      &other->commitment_, rhs_arena
-  );
+  delta_.InternalSwap(&other->delta_);
+  v_.InternalSwap(&other->v_);
+  delta_bin_.InternalSwap(&other->delta_bin_);
+  v_bin_.InternalSwap(&other->v_bin_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata Round6BCMessage::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata BatchRound1BCMessage::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_Li24_2fsign_2eproto_getter, &descriptor_table_Li24_2fsign_2eproto_once,
-      file_level_metadata_Li24_2fsign_2eproto[7]);
+      file_level_metadata_Li24_2fsign_2eproto[5]);
 }
 
 // ===================================================================
 
-class Round7BCMessage::_Internal {
+class PresignRound1BCMessage::_Internal {
  public:
-  static const ::safeheron::proto::CurvePoint& u(const Round7BCMessage* msg);
-  static const ::safeheron::proto::CurvePoint& t(const Round7BCMessage* msg);
 };
 
-const ::safeheron::proto::CurvePoint&
-Round7BCMessage::_Internal::u(const Round7BCMessage* msg) {
-  return *msg->u_;
-}
-const ::safeheron::proto::CurvePoint&
-Round7BCMessage::_Internal::t(const Round7BCMessage* msg) {
-  return *msg->t_;
-}
-void Round7BCMessage::clear_u() {
-  if (GetArenaForAllocation() == nullptr && u_ != nullptr) {
-    delete u_;
-  }
-  u_ = nullptr;
-}
-void Round7BCMessage::clear_t() {
-  if (GetArenaForAllocation() == nullptr && t_ != nullptr) {
-    delete t_;
-  }
-  t_ = nullptr;
-}
-Round7BCMessage::Round7BCMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+PresignRound1BCMessage::PresignRound1BCMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
-  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned),
+  v_(arena),
+  v_bin_(arena) {
   SharedCtor();
-  // @@protoc_insertion_point(arena_constructor:safeheron.proto.multi_party_ecdsa.Li24.sign.Round7BCMessage)
+  // @@protoc_insertion_point(arena_constructor:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage)
 }
-Round7BCMessage::Round7BCMessage(const Round7BCMessage& from)
-  : ::PROTOBUF_NAMESPACE_ID::Message() {
+PresignRound1BCMessage::PresignRound1BCMessage(const PresignRound1BCMessage& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      v_(from.v_),
+      v_bin_(from.v_bin_) {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  blind_factor_.InitDefault();
-  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    blind_factor_.Set("", GetArenaForAllocation());
-  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_blind_factor().empty()) {
-    blind_factor_.Set(from._internal_blind_factor(), 
-      GetArenaForAllocation());
-  }
-  if (from._internal_has_u()) {
-    u_ = new ::safeheron::proto::CurvePoint(*from.u_);
-  } else {
-    u_ = nullptr;
-  }
-  if (from._internal_has_t()) {
-    t_ = new ::safeheron::proto::CurvePoint(*from.t_);
-  } else {
-    t_ = nullptr;
-  }
-  // @@protoc_insertion_point(copy_constructor:safeheron.proto.multi_party_ecdsa.Li24.sign.Round7BCMessage)
+  // @@protoc_insertion_point(copy_constructor:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage)
 }
 
-inline void Round7BCMessage::SharedCtor() {
-blind_factor_.InitDefault();
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  blind_factor_.Set("", GetArenaForAllocation());
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-::memset(reinterpret_cast<char*>(this) + static_cast<size_t>(
-    reinterpret_cast<char*>(&u_) - reinterpret_cast<char*>(this)),
-    0, static_cast<size_t>(reinterpret_cast<char*>(&t_) -
-    reinterpret_cast<char*>(&u_)) + sizeof(t_));
+inline void PresignRound1BCMessage::SharedCtor() {
 }
 
-Round7BCMessage::~Round7BCMessage() {
-  // @@protoc_insertion_point(destructor:safeheron.proto.multi_party_ecdsa.Li24.sign.Round7BCMessage)
+PresignRound1BCMessage::~PresignRound1BCMessage() {
+  // @@protoc_insertion_point(destructor:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -2404,64 +2097,57 @@ Round7BCMessage::~Round7BCMessage() {
   SharedDtor();
 }
 
-inline void Round7BCMessage::SharedDtor() {
+inline void PresignRound1BCMessage::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  blind_factor_.Destroy();
-  if (this != internal_default_instance()) delete u_;
-  if (this != internal_default_instance()) delete t_;
 }
 
-void Round7BCMessage::SetCachedSize(int size) const {
+void PresignRound1BCMessage::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
 
-void Round7BCMessage::Clear() {
-// @@protoc_insertion_point(message_clear_start:safeheron.proto.multi_party_ecdsa.Li24.sign.Round7BCMessage)
+void PresignRound1BCMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  blind_factor_.ClearToEmpty();
-  if (GetArenaForAllocation() == nullptr && u_ != nullptr) {
-    delete u_;
-  }
-  u_ = nullptr;
-  if (GetArenaForAllocation() == nullptr && t_ != nullptr) {
-    delete t_;
-  }
-  t_ = nullptr;
+  v_.Clear();
+  v_bin_.Clear();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Round7BCMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* PresignRound1BCMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // .safeheron.proto.CurvePoint U = 1;
+      // repeated string v = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          ptr = ctx->ParseMessage(_internal_mutable_u(), ptr);
-          CHK_(ptr);
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_v();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            CHK_(::_pbi::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v"));
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
         } else
           goto handle_unusual;
         continue;
-      // .safeheron.proto.CurvePoint T = 2;
+      // repeated bytes v_bin = 2;
       case 2:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
-          ptr = ctx->ParseMessage(_internal_mutable_t(), ptr);
-          CHK_(ptr);
-        } else
-          goto handle_unusual;
-        continue;
-      // string blind_factor = 3;
-      case 3:
-        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
-          auto str = _internal_mutable_blind_factor();
-          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
-          CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.sign.Round7BCMessage.blind_factor"));
+          ptr -= 1;
+          do {
+            ptr += 1;
+            auto str = _internal_add_v_bin();
+            ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
         } else
           goto handle_unusual;
         continue;
@@ -2488,176 +2174,182 @@ failure:
 #undef CHK_
 }
 
-uint8_t* Round7BCMessage::_InternalSerialize(
+uint8_t* PresignRound1BCMessage::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:safeheron.proto.multi_party_ecdsa.Li24.sign.Round7BCMessage)
+  // @@protoc_insertion_point(serialize_to_array_start:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // .safeheron.proto.CurvePoint U = 1;
-  if (this->_internal_has_u()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(1, _Internal::u(this),
-        _Internal::u(this).GetCachedSize(), target, stream);
-  }
-
-  // .safeheron.proto.CurvePoint T = 2;
-  if (this->_internal_has_t()) {
-    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
-      InternalWriteMessage(2, _Internal::t(this),
-        _Internal::t(this).GetCachedSize(), target, stream);
-  }
-
-  // string blind_factor = 3;
-  if (!this->_internal_blind_factor().empty()) {
+  // repeated string v = 1;
+  for (int i = 0, n = this->_internal_v_size(); i < n; i++) {
+    const auto& s = this->_internal_v(i);
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_blind_factor().data(), static_cast<int>(this->_internal_blind_factor().length()),
+      s.data(), static_cast<int>(s.length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "safeheron.proto.multi_party_ecdsa.Li24.sign.Round7BCMessage.blind_factor");
-    target = stream->WriteStringMaybeAliased(
-        3, this->_internal_blind_factor(), target);
+      "safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v");
+    target = stream->WriteString(1, s, target);
+  }
+
+  // repeated bytes v_bin = 2;
+  for (int i = 0, n = this->_internal_v_bin_size(); i < n; i++) {
+    const auto& s = this->_internal_v_bin(i);
+    target = stream->WriteBytes(2, s, target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:safeheron.proto.multi_party_ecdsa.Li24.sign.Round7BCMessage)
+  // @@protoc_insertion_point(serialize_to_array_end:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage)
   return target;
 }
 
-size_t Round7BCMessage::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:safeheron.proto.multi_party_ecdsa.Li24.sign.Round7BCMessage)
+size_t PresignRound1BCMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string blind_factor = 3;
-  if (!this->_internal_blind_factor().empty()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_blind_factor());
-  }
-
-  // .safeheron.proto.CurvePoint U = 1;
-  if (this->_internal_has_u()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *u_);
+  // repeated string v = 1;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(v_.size());
+  for (int i = 0, n = v_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+      v_.Get(i));
   }
 
-  // .safeheron.proto.CurvePoint T = 2;
-  if (this->_internal_has_t()) {
-    total_size += 1 +
-      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
-        *t_);
+  // repeated bytes v_bin = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(v_bin_.size());
+  for (int i = 0, n = v_bin_.size(); i < n; i++) {
+    total_size += ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+      v_bin_.Get(i));
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Round7BCMessage::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PresignRound1BCMessage::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
-    Round7BCMessage::MergeImpl
+    PresignRound1BCMessage::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Round7BCMessage::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PresignRound1BCMessage::GetClassData() const { return &_class_data_; }
 
-void Round7BCMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
+void PresignRound1BCMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
                       const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<Round7BCMessage *>(to)->MergeFrom(
-      static_cast<const Round7BCMessage &>(from));
+  static_cast<PresignRound1BCMessage *>(to)->MergeFrom(
+      static_cast<const PresignRound1BCMessage &>(from));
 }
 
 
-void Round7BCMessage::MergeFrom(const Round7BCMessage& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:safeheron.proto.multi_party_ecdsa.Li24.sign.Round7BCMessage)
+void PresignRound1BCMessage::MergeFrom(const PresignRound1BCMessage& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage)
   GOOGLE_DCHECK_NE(&from, this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!from._internal_blind_factor().empty()) {
-    _internal_set_blind_factor(from._internal_blind_factor());
-  }
-  if (from._internal_has_u()) {
-    _internal_mutable_u()->::safeheron::proto::CurvePoint::MergeFrom(from._internal_u());
-  }
-  if (from._internal_has_t()) {
-    _internal_mutable_t()->::safeheron::proto::CurvePoint::MergeFrom(from._internal_t());
-  }
+  v_.MergeFrom(from.v_);
+  v_bin_.MergeFrom(from.v_bin_);
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Round7BCMessage::CopyFrom(const Round7BCMessage& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:safeheron.proto.multi_party_ecdsa.Li24.sign.Round7BCMessage)
+void PresignRound1BCMessage::CopyFrom(const PresignRound1BCMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Round7BCMessage::IsInitialized() const {
+bool PresignRound1BCMessage::IsInitialized() const {
   return true;
 }
 
-void Round7BCMessage::InternalSwap(Round7BCMessage* other) {
+void PresignRound1BCMessage::InternalSwap(PresignRound1BCMessage* other) {
   using std::swap;
-  auto* lhs_arena = GetArenaForAllocation();
-  auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &blind_factor_, lhs_arena,
-      &other->blind_factor_, rhs_arena
-  );
-  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
-      PROTOBUF_FIELD_OFFSET(Round7BCMessage, t_)
-      + sizeof(Round7BCMessage::t_)
-      - PROTOBUF_FIELD_OFFSET(Round7BCMessage, u_)>(
-          reinterpret_cast<char*>(&u_),
-          reinterpret_cast<char*>(&other->u_));
+  v_.InternalSwap(&other->v_);
+  v_bin_.InternalSwap(&other->v_bin_);
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata Round7BCMessage::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata PresignRound1BCMessage::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_Li24_2fsign_2eproto_getter, &descriptor_table_Li24_2fsign_2eproto_once,
-      file_level_metadata_Li24_2fsign_2eproto[8]);
+      file_level_metadata_Li24_2fsign_2eproto[6]);
 }
 
 // ===================================================================
 
-class Round8BCMessage::_Internal {
+class OnlineRound0BCMessage::_Internal {
  public:
 };
 
-Round8BCMessage::Round8BCMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+OnlineRound0BCMessage::OnlineRound0BCMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                          bool is_message_owned)
   : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
   SharedCtor();
-  // @@protoc_insertion_point(arena_constructor:safeheron.proto.multi_party_ecdsa.Li24.sign.Round8BCMessage)
+  // @@protoc_insertion_point(arena_constructor:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage)
 }
-Round8BCMessage::Round8BCMessage(const Round8BCMessage& from)
+OnlineRound0BCMessage::OnlineRound0BCMessage(const OnlineRound0BCMessage& from)
   : ::PROTOBUF_NAMESPACE_ID::Message() {
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
-  si_.InitDefault();
+  r_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    r_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_r().empty()) {
+    r_.Set(from._internal_r(), 
+      GetArenaForAllocation());
+  }
+  delta_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    delta_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_delta().empty()) {
+    delta_.Set(from._internal_delta(), 
+      GetArenaForAllocation());
+  }
+  r_bin_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    r_bin_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_r_bin().empty()) {
+    r_bin_.Set(from._internal_r_bin(), 
+      GetArenaForAllocation());
+  }
+  delta_bin_.InitDefault();
   #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-    si_.Set("", GetArenaForAllocation());
+    delta_bin_.Set("", GetArenaForAllocation());
   #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (!from._internal_si().empty()) {
-    si_.Set(from._internal_si(), 
+  if (!from._internal_delta_bin().empty()) {
+    delta_bin_.Set(from._internal_delta_bin(), 
       GetArenaForAllocation());
   }
-  // @@protoc_insertion_point(copy_constructor:safeheron.proto.multi_party_ecdsa.Li24.sign.Round8BCMessage)
+  // @@protoc_insertion_point(copy_constructor:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage)
 }
 
-inline void Round8BCMessage::SharedCtor() {
-si_.InitDefault();
+inline void OnlineRound0BCMessage::SharedCtor() {
+r_.InitDefault();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  r_.Set("", GetArenaForAllocation());
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+delta_.InitDefault();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  delta_.Set("", GetArenaForAllocation());
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+r_bin_.InitDefault();
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  r_bin_.Set("", GetArenaForAllocation());
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+delta_bin_.InitDefault();
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  si_.Set("", GetArenaForAllocation());
+  delta_bin_.Set("", GetArenaForAllocation());
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
 }
 
-Round8BCMessage::~Round8BCMessage() {
-  // @@protoc_insertion_point(destructor:safeheron.proto.multi_party_ecdsa.Li24.sign.Round8BCMessage)
+OnlineRound0BCMessage::~OnlineRound0BCMessage() {
+  // @@protoc_insertion_point(destructor:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage)
   if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
   (void)arena;
     return;
@@ -2665,38 +2357,72 @@ Round8BCMessage::~Round8BCMessage() {
   SharedDtor();
 }
 
-inline void Round8BCMessage::SharedDtor() {
+inline void OnlineRound0BCMessage::SharedDtor() {
   GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
-  si_.Destroy();
+  r_.Destroy();
+  delta_.Destroy();
+  r_bin_.Destroy();
+  delta_bin_.Destroy();
 }
 
-void Round8BCMessage::SetCachedSize(int size) const {
+void OnlineRound0BCMessage::SetCachedSize(int size) const {
   _cached_size_.Set(size);
 }
 
-void Round8BCMessage::Clear() {
-// @@protoc_insertion_point(message_clear_start:safeheron.proto.multi_party_ecdsa.Li24.sign.Round8BCMessage)
+void OnlineRound0BCMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage)
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  si_.ClearToEmpty();
+  r_.ClearToEmpty();
+  delta_.ClearToEmpty();
+  r_bin_.ClearToEmpty();
+  delta_bin_.ClearToEmpty();
   _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
 
-const char* Round8BCMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+const char* OnlineRound0BCMessage::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
 #define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
   while (!ctx->Done(&ptr)) {
     uint32_t tag;
     ptr = ::_pbi::ReadTag(ptr, &tag);
     switch (tag >> 3) {
-      // string si = 1;
+      // string r = 1;
       case 1:
         if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
-          auto str = _internal_mutable_si();
+          auto str = _internal_mutable_r();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.r"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string delta = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_delta();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.delta"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes r_bin = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_r_bin();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes delta_bin = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_delta_bin();
           ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
           CHK_(ptr);
-          CHK_(::_pbi::VerifyUTF8(str, "safeheron.proto.multi_party_ecdsa.Li24.sign.Round8BCMessage.si"));
         } else
           goto handle_unusual;
         continue;
@@ -2723,99 +2449,163 @@ failure:
 #undef CHK_
 }
 
-uint8_t* Round8BCMessage::_InternalSerialize(
+uint8_t* OnlineRound0BCMessage::_InternalSerialize(
     uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
-  // @@protoc_insertion_point(serialize_to_array_start:safeheron.proto.multi_party_ecdsa.Li24.sign.Round8BCMessage)
+  // @@protoc_insertion_point(serialize_to_array_start:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage)
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  // string si = 1;
-  if (!this->_internal_si().empty()) {
+  // string r = 1;
+  if (!this->_internal_r().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_r().data(), static_cast<int>(this->_internal_r().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.r");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_r(), target);
+  }
+
+  // string delta = 2;
+  if (!this->_internal_delta().empty()) {
     ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
-      this->_internal_si().data(), static_cast<int>(this->_internal_si().length()),
+      this->_internal_delta().data(), static_cast<int>(this->_internal_delta().length()),
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
-      "safeheron.proto.multi_party_ecdsa.Li24.sign.Round8BCMessage.si");
+      "safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.delta");
     target = stream->WriteStringMaybeAliased(
-        1, this->_internal_si(), target);
+        2, this->_internal_delta(), target);
+  }
+
+  // bytes r_bin = 3;
+  if (!this->_internal_r_bin().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        3, this->_internal_r_bin(), target);
+  }
+
+  // bytes delta_bin = 4;
+  if (!this->_internal_delta_bin().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        4, this->_internal_delta_bin(), target);
   }
 
   if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
     target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
         _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
   }
-  // @@protoc_insertion_point(serialize_to_array_end:safeheron.proto.multi_party_ecdsa.Li24.sign.Round8BCMessage)
+  // @@protoc_insertion_point(serialize_to_array_end:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage)
   return target;
 }
 
-size_t Round8BCMessage::ByteSizeLong() const {
-// @@protoc_insertion_point(message_byte_size_start:safeheron.proto.multi_party_ecdsa.Li24.sign.Round8BCMessage)
+size_t OnlineRound0BCMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage)
   size_t total_size = 0;
 
   uint32_t cached_has_bits = 0;
   // Prevent compiler warnings about cached_has_bits being unused
   (void) cached_has_bits;
 
-  // string si = 1;
-  if (!this->_internal_si().empty()) {
+  // string r = 1;
+  if (!this->_internal_r().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_r());
+  }
+
+  // string delta = 2;
+  if (!this->_internal_delta().empty()) {
     total_size += 1 +
       ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
-        this->_internal_si());
+        this->_internal_delta());
+  }
+
+  // bytes r_bin = 3;
+  if (!this->_internal_r_bin().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_r_bin());
+  }
+
+  // bytes delta_bin = 4;
+  if (!this->_internal_delta_bin().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_delta_bin());
   }
 
   return MaybeComputeUnknownFieldsSize(total_size, &_cached_size_);
 }
 
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Round8BCMessage::_class_data_ = {
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData OnlineRound0BCMessage::_class_data_ = {
     ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSizeCheck,
-    Round8BCMessage::MergeImpl
+    OnlineRound0BCMessage::MergeImpl
 };
-const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Round8BCMessage::GetClassData() const { return &_class_data_; }
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*OnlineRound0BCMessage::GetClassData() const { return &_class_data_; }
 
-void Round8BCMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
+void OnlineRound0BCMessage::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to,
                       const ::PROTOBUF_NAMESPACE_ID::Message& from) {
-  static_cast<Round8BCMessage *>(to)->MergeFrom(
-      static_cast<const Round8BCMessage &>(from));
+  static_cast<OnlineRound0BCMessage *>(to)->MergeFrom(
+      static_cast<const OnlineRound0BCMessage &>(from));
 }
 
 
-void Round8BCMessage::MergeFrom(const Round8BCMessage& from) {
-// @@protoc_insertion_point(class_specific_merge_from_start:safeheron.proto.multi_party_ecdsa.Li24.sign.Round8BCMessage)
+void OnlineRound0BCMessage::MergeFrom(const OnlineRound0BCMessage& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage)
   GOOGLE_DCHECK_NE(&from, this);
   uint32_t cached_has_bits = 0;
   (void) cached_has_bits;
 
-  if (!from._internal_si().empty()) {
-    _internal_set_si(from._internal_si());
+  if (!from._internal_r().empty()) {
+    _internal_set_r(from._internal_r());
+  }
+  if (!from._internal_delta().empty()) {
+    _internal_set_delta(from._internal_delta());
+  }
+  if (!from._internal_r_bin().empty()) {
+    _internal_set_r_bin(from._internal_r_bin());
+  }
+  if (!from._internal_delta_bin().empty()) {
+    _internal_set_delta_bin(from._internal_delta_bin());
   }
   _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
 }
 
-void Round8BCMessage::CopyFrom(const Round8BCMessage& from) {
-// @@protoc_insertion_point(class_specific_copy_from_start:safeheron.proto.multi_party_ecdsa.Li24.sign.Round8BCMessage)
+void OnlineRound0BCMessage::CopyFrom(const OnlineRound0BCMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage)
   if (&from == this) return;
   Clear();
   MergeFrom(from);
 }
 
-bool Round8BCMessage::IsInitialized() const {
+bool OnlineRound0BCMessage::IsInitialized() const {
   return true;
 }
 
-void Round8BCMessage::InternalSwap(Round8BCMessage* other) {
+void OnlineRound0BCMessage::InternalSwap(OnlineRound0BCMessage* other) {
   using std::swap;
   auto* lhs_arena = GetArenaForAllocation();
   auto* rhs_arena = other->GetArenaForAllocation();
   _internal_metadata_.InternalSwap(&other->_internal_metadata_);
   ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
-      &si_, lhs_arena,
-      &other->si_, rhs_arena
+      &r_, lhs_arena,
+      &other->r_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &delta_, lhs_arena,
+      &other->delta_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &r_bin_, lhs_arena,
+      &other->r_bin_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &delta_bin_, lhs_arena,
+      &other->delta_bin_, rhs_arena
   );
 }
 
-::PROTOBUF_NAMESPACE_ID::Metadata Round8BCMessage::GetMetadata() const {
+::PROTOBUF_NAMESPACE_ID::Metadata OnlineRound0BCMessage::GetMetadata() const {
   return ::_pbi::AssignDescriptors(
       &descriptor_table_Li24_2fsign_2eproto_getter, &descriptor_table_Li24_2fsign_2eproto_once,
-      file_level_metadata_Li24_2fsign_2eproto[9]);
+      file_level_metadata_Li24_2fsign_2eproto[7]);
 }
 
 // @@protoc_insertion_point(namespace_scope)
@@ -2837,33 +2627,25 @@ template<> PROTOBUF_NOINLINE ::safeheron::proto::multi_party_ecdsa::Li24::sign::
 Arena::CreateMaybeMessage< ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round1P2PMessage >(Arena* arena) {
   return Arena::CreateMessageInternal< ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round1P2PMessage >(arena);
 }
-template<> PROTOBUF_NOINLINE ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round2BCMessage*
-Arena::CreateMaybeMessage< ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round2BCMessage >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round2BCMessage >(arena);
-}
-template<> PROTOBUF_NOINLINE ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round3BCMessage*
-Arena::CreateMaybeMessage< ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round3BCMessage >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round3BCMessage >(arena);
-}
-template<> PROTOBUF_NOINLINE ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round4BCMessage*
-Arena::CreateMaybeMessage< ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round4BCMessage >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round4BCMessage >(arena);
+template<> PROTOBUF_NOINLINE ::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0BCMessage*
+Arena::CreateMaybeMessage< ::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0BCMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0BCMessage >(arena);
 }
-template<> PROTOBUF_NOINLINE ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round5BCMessage*
-Arena::CreateMaybeMessage< ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round5BCMessage >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round5BCMessage >(arena);
+template<> PROTOBUF_NOINLINE ::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0P2PMessage*
+Arena::CreateMaybeMessage< ::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0P2PMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0P2PMessage >(arena);
 }
-template<> PROTOBUF_NOINLINE ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round6BCMessage*
-Arena::CreateMaybeMessage< ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round6BCMessage >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round6BCMessage >(arena);
+template<> PROTOBUF_NOINLINE ::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound1BCMessage*
+Arena::CreateMaybeMessage< ::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound1BCMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound1BCMessage >(arena);
 }
-template<> PROTOBUF_NOINLINE ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round7BCMessage*
-Arena::CreateMaybeMessage< ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round7BCMessage >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round7BCMessage >(arena);
+template<> PROTOBUF_NOINLINE ::safeheron::proto::multi_party_ecdsa::Li24::sign::PresignRound1BCMessage*
+Arena::CreateMaybeMessage< ::safeheron::proto::multi_party_ecdsa::Li24::sign::PresignRound1BCMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::safeheron::proto::multi_party_ecdsa::Li24::sign::PresignRound1BCMessage >(arena);
 }
-template<> PROTOBUF_NOINLINE ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round8BCMessage*
-Arena::CreateMaybeMessage< ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round8BCMessage >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round8BCMessage >(arena);
+template<> PROTOBUF_NOINLINE ::safeheron::proto::multi_party_ecdsa::Li24::sign::OnlineRound0BCMessage*
+Arena::CreateMaybeMessage< ::safeheron::proto::multi_party_ecdsa::Li24::sign::OnlineRound0BCMessage >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::safeheron::proto::multi_party_ecdsa::Li24::sign::OnlineRound0BCMessage >(arena);
 }
 PROTOBUF_NAMESPACE_CLOSE
 
@@ -31,7 +31,6 @@
 #include <google/protobuf/extension_set.h>  // IWYU pragma: export
 #include <google/protobuf/unknown_field_set.h>
 #include "crypto-suites/crypto-curve/proto_gen/curve_point.pb.switch.h"
-#include "crypto-suites/crypto-zkp/proto_gen/zkp.pb.switch.h"
 // @@protoc_insertion_point(includes)
 #include <google/protobuf/port_def.inc>
 #define PROTOBUF_INTERNAL_EXPORT_Li24_2fsign_2eproto
@@ -51,6 +50,21 @@ namespace proto {
 namespace multi_party_ecdsa {
 namespace Li24 {
 namespace sign {
+class BatchRound0BCMessage;
+struct BatchRound0BCMessageDefaultTypeInternal;
+extern BatchRound0BCMessageDefaultTypeInternal _BatchRound0BCMessage_default_instance_;
+class BatchRound0P2PMessage;
+struct BatchRound0P2PMessageDefaultTypeInternal;
+extern BatchRound0P2PMessageDefaultTypeInternal _BatchRound0P2PMessage_default_instance_;
+class BatchRound1BCMessage;
+struct BatchRound1BCMessageDefaultTypeInternal;
+extern BatchRound1BCMessageDefaultTypeInternal _BatchRound1BCMessage_default_instance_;
+class OnlineRound0BCMessage;
+struct OnlineRound0BCMessageDefaultTypeInternal;
+extern OnlineRound0BCMessageDefaultTypeInternal _OnlineRound0BCMessage_default_instance_;
+class PresignRound1BCMessage;
+struct PresignRound1BCMessageDefaultTypeInternal;
+extern PresignRound1BCMessageDefaultTypeInternal _PresignRound1BCMessage_default_instance_;
 class Round0BCMessage;
 struct Round0BCMessageDefaultTypeInternal;
 extern Round0BCMessageDefaultTypeInternal _Round0BCMessage_default_instance_;
@@ -60,43 +74,20 @@ extern Round0P2PMessageDefaultTypeInternal _Round0P2PMessage_default_instance_;
 class Round1P2PMessage;
 struct Round1P2PMessageDefaultTypeInternal;
 extern Round1P2PMessageDefaultTypeInternal _Round1P2PMessage_default_instance_;
-class Round2BCMessage;
-struct Round2BCMessageDefaultTypeInternal;
-extern Round2BCMessageDefaultTypeInternal _Round2BCMessage_default_instance_;
-class Round3BCMessage;
-struct Round3BCMessageDefaultTypeInternal;
-extern Round3BCMessageDefaultTypeInternal _Round3BCMessage_default_instance_;
-class Round4BCMessage;
-struct Round4BCMessageDefaultTypeInternal;
-extern Round4BCMessageDefaultTypeInternal _Round4BCMessage_default_instance_;
-class Round5BCMessage;
-struct Round5BCMessageDefaultTypeInternal;
-extern Round5BCMessageDefaultTypeInternal _Round5BCMessage_default_instance_;
-class Round6BCMessage;
-struct Round6BCMessageDefaultTypeInternal;
-extern Round6BCMessageDefaultTypeInternal _Round6BCMessage_default_instance_;
-class Round7BCMessage;
-struct Round7BCMessageDefaultTypeInternal;
-extern Round7BCMessageDefaultTypeInternal _Round7BCMessage_default_instance_;
-class Round8BCMessage;
-struct Round8BCMessageDefaultTypeInternal;
-extern Round8BCMessageDefaultTypeInternal _Round8BCMessage_default_instance_;
 }  // namespace sign
 }  // namespace Li24
 }  // namespace multi_party_ecdsa
 }  // namespace proto
 }  // namespace safeheron
 PROTOBUF_NAMESPACE_OPEN
+template<> ::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0BCMessage* Arena::CreateMaybeMessage<::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0BCMessage>(Arena*);
+template<> ::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0P2PMessage* Arena::CreateMaybeMessage<::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound0P2PMessage>(Arena*);
+template<> ::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound1BCMessage* Arena::CreateMaybeMessage<::safeheron::proto::multi_party_ecdsa::Li24::sign::BatchRound1BCMessage>(Arena*);
+template<> ::safeheron::proto::multi_party_ecdsa::Li24::sign::OnlineRound0BCMessage* Arena::CreateMaybeMessage<::safeheron::proto::multi_party_ecdsa::Li24::sign::OnlineRound0BCMessage>(Arena*);
+template<> ::safeheron::proto::multi_party_ecdsa::Li24::sign::PresignRound1BCMessage* Arena::CreateMaybeMessage<::safeheron::proto::multi_party_ecdsa::Li24::sign::PresignRound1BCMessage>(Arena*);
 template<> ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round0BCMessage* Arena::CreateMaybeMessage<::safeheron::proto::multi_party_ecdsa::Li24::sign::Round0BCMessage>(Arena*);
 template<> ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round0P2PMessage* Arena::CreateMaybeMessage<::safeheron::proto::multi_party_ecdsa::Li24::sign::Round0P2PMessage>(Arena*);
 template<> ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round1P2PMessage* Arena::CreateMaybeMessage<::safeheron::proto::multi_party_ecdsa::Li24::sign::Round1P2PMessage>(Arena*);
-template<> ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round2BCMessage* Arena::CreateMaybeMessage<::safeheron::proto::multi_party_ecdsa::Li24::sign::Round2BCMessage>(Arena*);
-template<> ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round3BCMessage* Arena::CreateMaybeMessage<::safeheron::proto::multi_party_ecdsa::Li24::sign::Round3BCMessage>(Arena*);
-template<> ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round4BCMessage* Arena::CreateMaybeMessage<::safeheron::proto::multi_party_ecdsa::Li24::sign::Round4BCMessage>(Arena*);
-template<> ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round5BCMessage* Arena::CreateMaybeMessage<::safeheron::proto::multi_party_ecdsa::Li24::sign::Round5BCMessage>(Arena*);
-template<> ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round6BCMessage* Arena::CreateMaybeMessage<::safeheron::proto::multi_party_ecdsa::Li24::sign::Round6BCMessage>(Arena*);
-template<> ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round7BCMessage* Arena::CreateMaybeMessage<::safeheron::proto::multi_party_ecdsa::Li24::sign::Round7BCMessage>(Arena*);
-template<> ::safeheron::proto::multi_party_ecdsa::Li24::sign::Round8BCMessage* Arena::CreateMaybeMessage<::safeheron::proto::multi_party_ecdsa::Li24::sign::Round8BCMessage>(Arena*);
 PROTOBUF_NAMESPACE_CLOSE
 namespace safeheron {
 namespace proto {
@@ -225,36 +216,25 @@ class Round0BCMessage final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kMessageAFieldNumber = 1,
-    kCommitmentFieldNumber = 2,
+    kGKFieldNumber = 1,
   };
-  // string message_a = 1;
-  void clear_message_a();
-  const std::string& message_a() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_message_a(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_message_a();
-  PROTOBUF_NODISCARD std::string* release_message_a();
-  void set_allocated_message_a(std::string* message_a);
-  private:
-  const std::string& _internal_message_a() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message_a(const std::string& value);
-  std::string* _internal_mutable_message_a();
+  // .safeheron.proto.CurvePoint GK = 1;
+  bool has_gk() const;
+  private:
+  bool _internal_has_gk() const;
   public:
-
-  // string commitment = 2;
-  void clear_commitment();
-  const std::string& commitment() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_commitment(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_commitment();
-  PROTOBUF_NODISCARD std::string* release_commitment();
-  void set_allocated_commitment(std::string* commitment);
-  private:
-  const std::string& _internal_commitment() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_commitment(const std::string& value);
-  std::string* _internal_mutable_commitment();
+  void clear_gk();
+  const ::safeheron::proto::CurvePoint& gk() const;
+  PROTOBUF_NODISCARD ::safeheron::proto::CurvePoint* release_gk();
+  ::safeheron::proto::CurvePoint* mutable_gk();
+  void set_allocated_gk(::safeheron::proto::CurvePoint* gk);
+  private:
+  const ::safeheron::proto::CurvePoint& _internal_gk() const;
+  ::safeheron::proto::CurvePoint* _internal_mutable_gk();
   public:
+  void unsafe_arena_set_allocated_gk(
+      ::safeheron::proto::CurvePoint* gk);
+  ::safeheron::proto::CurvePoint* unsafe_arena_release_gk();
 
   // @@protoc_insertion_point(class_scope:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0BCMessage)
  private:
@@ -263,8 +243,7 @@ class Round0BCMessage final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_a_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr commitment_;
+  ::safeheron::proto::CurvePoint* gk_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_Li24_2fsign_2eproto;
 };
@@ -389,25 +368,96 @@ class Round0P2PMessage final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kAliceProofFieldNumber = 3,
+    kWFieldNumber = 1,
+    kKFieldNumber = 2,
+    kPhiFieldNumber = 3,
+    kWBinFieldNumber = 4,
+    kKBinFieldNumber = 5,
+    kPhiBinFieldNumber = 6,
   };
-  // .safeheron.proto.PailEncRangeProof_V1 alice_proof = 3;
-  bool has_alice_proof() const;
+  // string w = 1;
+  void clear_w();
+  const std::string& w() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_w(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_w();
+  PROTOBUF_NODISCARD std::string* release_w();
+  void set_allocated_w(std::string* w);
+  private:
+  const std::string& _internal_w() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_w(const std::string& value);
+  std::string* _internal_mutable_w();
+  public:
+
+  // string k = 2;
+  void clear_k();
+  const std::string& k() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_k(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_k();
+  PROTOBUF_NODISCARD std::string* release_k();
+  void set_allocated_k(std::string* k);
+  private:
+  const std::string& _internal_k() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_k(const std::string& value);
+  std::string* _internal_mutable_k();
+  public:
+
+  // string phi = 3;
+  void clear_phi();
+  const std::string& phi() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_phi(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_phi();
+  PROTOBUF_NODISCARD std::string* release_phi();
+  void set_allocated_phi(std::string* phi);
+  private:
+  const std::string& _internal_phi() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_phi(const std::string& value);
+  std::string* _internal_mutable_phi();
+  public:
+
+  // bytes w_bin = 4;
+  void clear_w_bin();
+  const std::string& w_bin() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_w_bin(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_w_bin();
+  PROTOBUF_NODISCARD std::string* release_w_bin();
+  void set_allocated_w_bin(std::string* w_bin);
+  private:
+  const std::string& _internal_w_bin() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_w_bin(const std::string& value);
+  std::string* _internal_mutable_w_bin();
+  public:
+
+  // bytes k_bin = 5;
+  void clear_k_bin();
+  const std::string& k_bin() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_k_bin(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_k_bin();
+  PROTOBUF_NODISCARD std::string* release_k_bin();
+  void set_allocated_k_bin(std::string* k_bin);
   private:
-  bool _internal_has_alice_proof() const;
+  const std::string& _internal_k_bin() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_k_bin(const std::string& value);
+  std::string* _internal_mutable_k_bin();
   public:
-  void clear_alice_proof();
-  const ::safeheron::proto::PailEncRangeProof_V1& alice_proof() const;
-  PROTOBUF_NODISCARD ::safeheron::proto::PailEncRangeProof_V1* release_alice_proof();
-  ::safeheron::proto::PailEncRangeProof_V1* mutable_alice_proof();
-  void set_allocated_alice_proof(::safeheron::proto::PailEncRangeProof_V1* alice_proof);
-  private:
-  const ::safeheron::proto::PailEncRangeProof_V1& _internal_alice_proof() const;
-  ::safeheron::proto::PailEncRangeProof_V1* _internal_mutable_alice_proof();
+
+  // bytes phi_bin = 6;
+  void clear_phi_bin();
+  const std::string& phi_bin() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_phi_bin(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_phi_bin();
+  PROTOBUF_NODISCARD std::string* release_phi_bin();
+  void set_allocated_phi_bin(std::string* phi_bin);
+  private:
+  const std::string& _internal_phi_bin() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_phi_bin(const std::string& value);
+  std::string* _internal_mutable_phi_bin();
   public:
-  void unsafe_arena_set_allocated_alice_proof(
-      ::safeheron::proto::PailEncRangeProof_V1* alice_proof);
-  ::safeheron::proto::PailEncRangeProof_V1* unsafe_arena_release_alice_proof();
 
   // @@protoc_insertion_point(class_scope:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage)
  private:
@@ -416,7 +466,12 @@ class Round0P2PMessage final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::safeheron::proto::PailEncRangeProof_V1* alice_proof_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr w_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr k_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr phi_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr w_bin_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr k_bin_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr phi_bin_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_Li24_2fsign_2eproto;
 };
@@ -541,74 +596,66 @@ class Round1P2PMessage final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kMessageBForKGammaFieldNumber = 1,
-    kMessageBForKWFieldNumber = 2,
-    kBobProof1FieldNumber = 3,
-    kBobProof2FieldNumber = 4,
+    kDeltaFieldNumber = 1,
+    kVFieldNumber = 2,
+    kDeltaBinFieldNumber = 3,
+    kVBinFieldNumber = 4,
   };
-  // string message_b_for_k_gamma = 1;
-  void clear_message_b_for_k_gamma();
-  const std::string& message_b_for_k_gamma() const;
+  // string delta = 1;
+  void clear_delta();
+  const std::string& delta() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_message_b_for_k_gamma(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_message_b_for_k_gamma();
-  PROTOBUF_NODISCARD std::string* release_message_b_for_k_gamma();
-  void set_allocated_message_b_for_k_gamma(std::string* message_b_for_k_gamma);
-  private:
-  const std::string& _internal_message_b_for_k_gamma() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message_b_for_k_gamma(const std::string& value);
-  std::string* _internal_mutable_message_b_for_k_gamma();
+  void set_delta(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_delta();
+  PROTOBUF_NODISCARD std::string* release_delta();
+  void set_allocated_delta(std::string* delta);
+  private:
+  const std::string& _internal_delta() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_delta(const std::string& value);
+  std::string* _internal_mutable_delta();
   public:
 
-  // string message_b_for_k_w = 2;
-  void clear_message_b_for_k_w();
-  const std::string& message_b_for_k_w() const;
+  // string v = 2;
+  void clear_v();
+  const std::string& v() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_message_b_for_k_w(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_message_b_for_k_w();
-  PROTOBUF_NODISCARD std::string* release_message_b_for_k_w();
-  void set_allocated_message_b_for_k_w(std::string* message_b_for_k_w);
-  private:
-  const std::string& _internal_message_b_for_k_w() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message_b_for_k_w(const std::string& value);
-  std::string* _internal_mutable_message_b_for_k_w();
+  void set_v(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_v();
+  PROTOBUF_NODISCARD std::string* release_v();
+  void set_allocated_v(std::string* v);
+  private:
+  const std::string& _internal_v() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_v(const std::string& value);
+  std::string* _internal_mutable_v();
   public:
 
-  // .safeheron.proto.PailAffRangeProof bob_proof_1 = 3;
-  bool has_bob_proof_1() const;
+  // bytes delta_bin = 3;
+  void clear_delta_bin();
+  const std::string& delta_bin() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_delta_bin(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_delta_bin();
+  PROTOBUF_NODISCARD std::string* release_delta_bin();
+  void set_allocated_delta_bin(std::string* delta_bin);
   private:
-  bool _internal_has_bob_proof_1() const;
+  const std::string& _internal_delta_bin() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_delta_bin(const std::string& value);
+  std::string* _internal_mutable_delta_bin();
   public:
-  void clear_bob_proof_1();
-  const ::safeheron::proto::PailAffRangeProof& bob_proof_1() const;
-  PROTOBUF_NODISCARD ::safeheron::proto::PailAffRangeProof* release_bob_proof_1();
-  ::safeheron::proto::PailAffRangeProof* mutable_bob_proof_1();
-  void set_allocated_bob_proof_1(::safeheron::proto::PailAffRangeProof* bob_proof_1);
-  private:
-  const ::safeheron::proto::PailAffRangeProof& _internal_bob_proof_1() const;
-  ::safeheron::proto::PailAffRangeProof* _internal_mutable_bob_proof_1();
-  public:
-  void unsafe_arena_set_allocated_bob_proof_1(
-      ::safeheron::proto::PailAffRangeProof* bob_proof_1);
-  ::safeheron::proto::PailAffRangeProof* unsafe_arena_release_bob_proof_1();
 
-  // .safeheron.proto.PailAffGroupEleRangeProof_V1 bob_proof_2 = 4;
-  bool has_bob_proof_2() const;
+  // bytes v_bin = 4;
+  void clear_v_bin();
+  const std::string& v_bin() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_v_bin(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_v_bin();
+  PROTOBUF_NODISCARD std::string* release_v_bin();
+  void set_allocated_v_bin(std::string* v_bin);
   private:
-  bool _internal_has_bob_proof_2() const;
+  const std::string& _internal_v_bin() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_v_bin(const std::string& value);
+  std::string* _internal_mutable_v_bin();
   public:
-  void clear_bob_proof_2();
-  const ::safeheron::proto::PailAffGroupEleRangeProof_V1& bob_proof_2() const;
-  PROTOBUF_NODISCARD ::safeheron::proto::PailAffGroupEleRangeProof_V1* release_bob_proof_2();
-  ::safeheron::proto::PailAffGroupEleRangeProof_V1* mutable_bob_proof_2();
-  void set_allocated_bob_proof_2(::safeheron::proto::PailAffGroupEleRangeProof_V1* bob_proof_2);
-  private:
-  const ::safeheron::proto::PailAffGroupEleRangeProof_V1& _internal_bob_proof_2() const;
-  ::safeheron::proto::PailAffGroupEleRangeProof_V1* _internal_mutable_bob_proof_2();
-  public:
-  void unsafe_arena_set_allocated_bob_proof_2(
-      ::safeheron::proto::PailAffGroupEleRangeProof_V1* bob_proof_2);
-  ::safeheron::proto::PailAffGroupEleRangeProof_V1* unsafe_arena_release_bob_proof_2();
 
   // @@protoc_insertion_point(class_scope:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage)
  private:
@@ -617,33 +664,33 @@ class Round1P2PMessage final :
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_b_for_k_gamma_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_b_for_k_w_;
-  ::safeheron::proto::PailAffRangeProof* bob_proof_1_;
-  ::safeheron::proto::PailAffGroupEleRangeProof_V1* bob_proof_2_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr delta_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr v_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr delta_bin_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr v_bin_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_Li24_2fsign_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Round2BCMessage final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:safeheron.proto.multi_party_ecdsa.Li24.sign.Round2BCMessage) */ {
+class BatchRound0BCMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0BCMessage) */ {
  public:
-  inline Round2BCMessage() : Round2BCMessage(nullptr) {}
-  ~Round2BCMessage() override;
-  explicit PROTOBUF_CONSTEXPR Round2BCMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline BatchRound0BCMessage() : BatchRound0BCMessage(nullptr) {}
+  ~BatchRound0BCMessage() override;
+  explicit PROTOBUF_CONSTEXPR BatchRound0BCMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Round2BCMessage(const Round2BCMessage& from);
-  Round2BCMessage(Round2BCMessage&& from) noexcept
-    : Round2BCMessage() {
+  BatchRound0BCMessage(const BatchRound0BCMessage& from);
+  BatchRound0BCMessage(BatchRound0BCMessage&& from) noexcept
+    : BatchRound0BCMessage() {
     *this = ::std::move(from);
   }
 
-  inline Round2BCMessage& operator=(const Round2BCMessage& from) {
+  inline BatchRound0BCMessage& operator=(const BatchRound0BCMessage& from) {
     CopyFrom(from);
     return *this;
   }
-  inline Round2BCMessage& operator=(Round2BCMessage&& from) noexcept {
+  inline BatchRound0BCMessage& operator=(BatchRound0BCMessage&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -666,20 +713,20 @@ class Round2BCMessage final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const Round2BCMessage& default_instance() {
+  static const BatchRound0BCMessage& default_instance() {
     return *internal_default_instance();
   }
-  static inline const Round2BCMessage* internal_default_instance() {
-    return reinterpret_cast<const Round2BCMessage*>(
-               &_Round2BCMessage_default_instance_);
+  static inline const BatchRound0BCMessage* internal_default_instance() {
+    return reinterpret_cast<const BatchRound0BCMessage*>(
+               &_BatchRound0BCMessage_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     3;
 
-  friend void swap(Round2BCMessage& a, Round2BCMessage& b) {
+  friend void swap(BatchRound0BCMessage& a, BatchRound0BCMessage& b) {
     a.Swap(&b);
   }
-  inline void Swap(Round2BCMessage* other) {
+  inline void Swap(BatchRound0BCMessage* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -692,7 +739,7 @@ class Round2BCMessage final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(Round2BCMessage* other) {
+  void UnsafeArenaSwap(BatchRound0BCMessage* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -700,13 +747,13 @@ class Round2BCMessage final :
 
   // implements Message ----------------------------------------------
 
-  Round2BCMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<Round2BCMessage>(arena);
+  BatchRound0BCMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BatchRound0BCMessage>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const Round2BCMessage& from);
+  void CopyFrom(const BatchRound0BCMessage& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const Round2BCMessage& from);
+  void MergeFrom(const BatchRound0BCMessage& from);
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
   public:
@@ -723,15 +770,15 @@ class Round2BCMessage final :
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(Round2BCMessage* other);
+  void InternalSwap(BatchRound0BCMessage* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "safeheron.proto.multi_party_ecdsa.Li24.sign.Round2BCMessage";
+    return "safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0BCMessage";
   }
   protected:
-  explicit Round2BCMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit BatchRound0BCMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -745,53 +792,57 @@ class Round2BCMessage final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kDeltaFieldNumber = 1,
+    kGKFieldNumber = 1,
   };
-  // string delta = 1;
-  void clear_delta();
-  const std::string& delta() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_delta(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_delta();
-  PROTOBUF_NODISCARD std::string* release_delta();
-  void set_allocated_delta(std::string* delta);
+  // repeated .safeheron.proto.CurvePoint GK = 1;
+  int gk_size() const;
   private:
-  const std::string& _internal_delta() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_delta(const std::string& value);
-  std::string* _internal_mutable_delta();
+  int _internal_gk_size() const;
   public:
+  void clear_gk();
+  ::safeheron::proto::CurvePoint* mutable_gk(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::safeheron::proto::CurvePoint >*
+      mutable_gk();
+  private:
+  const ::safeheron::proto::CurvePoint& _internal_gk(int index) const;
+  ::safeheron::proto::CurvePoint* _internal_add_gk();
+  public:
+  const ::safeheron::proto::CurvePoint& gk(int index) const;
+  ::safeheron::proto::CurvePoint* add_gk();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::safeheron::proto::CurvePoint >&
+      gk() const;
 
-  // @@protoc_insertion_point(class_scope:safeheron.proto.multi_party_ecdsa.Li24.sign.Round2BCMessage)
+  // @@protoc_insertion_point(class_scope:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0BCMessage)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr delta_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::safeheron::proto::CurvePoint > gk_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_Li24_2fsign_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Round3BCMessage final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:safeheron.proto.multi_party_ecdsa.Li24.sign.Round3BCMessage) */ {
+class BatchRound0P2PMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage) */ {
  public:
-  inline Round3BCMessage() : Round3BCMessage(nullptr) {}
-  ~Round3BCMessage() override;
-  explicit PROTOBUF_CONSTEXPR Round3BCMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline BatchRound0P2PMessage() : BatchRound0P2PMessage(nullptr) {}
+  ~BatchRound0P2PMessage() override;
+  explicit PROTOBUF_CONSTEXPR BatchRound0P2PMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Round3BCMessage(const Round3BCMessage& from);
-  Round3BCMessage(Round3BCMessage&& from) noexcept
-    : Round3BCMessage() {
+  BatchRound0P2PMessage(const BatchRound0P2PMessage& from);
+  BatchRound0P2PMessage(BatchRound0P2PMessage&& from) noexcept
+    : BatchRound0P2PMessage() {
     *this = ::std::move(from);
   }
 
-  inline Round3BCMessage& operator=(const Round3BCMessage& from) {
+  inline BatchRound0P2PMessage& operator=(const BatchRound0P2PMessage& from) {
     CopyFrom(from);
     return *this;
   }
-  inline Round3BCMessage& operator=(Round3BCMessage&& from) noexcept {
+  inline BatchRound0P2PMessage& operator=(BatchRound0P2PMessage&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -814,20 +865,20 @@ class Round3BCMessage final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const Round3BCMessage& default_instance() {
+  static const BatchRound0P2PMessage& default_instance() {
     return *internal_default_instance();
   }
-  static inline const Round3BCMessage* internal_default_instance() {
-    return reinterpret_cast<const Round3BCMessage*>(
-               &_Round3BCMessage_default_instance_);
+  static inline const BatchRound0P2PMessage* internal_default_instance() {
+    return reinterpret_cast<const BatchRound0P2PMessage*>(
+               &_BatchRound0P2PMessage_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
     4;
 
-  friend void swap(Round3BCMessage& a, Round3BCMessage& b) {
+  friend void swap(BatchRound0P2PMessage& a, BatchRound0P2PMessage& b) {
     a.Swap(&b);
   }
-  inline void Swap(Round3BCMessage* other) {
+  inline void Swap(BatchRound0P2PMessage* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -840,7 +891,7 @@ class Round3BCMessage final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(Round3BCMessage* other) {
+  void UnsafeArenaSwap(BatchRound0P2PMessage* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -848,13 +899,13 @@ class Round3BCMessage final :
 
   // implements Message ----------------------------------------------
 
-  Round3BCMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<Round3BCMessage>(arena);
+  BatchRound0P2PMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BatchRound0P2PMessage>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const Round3BCMessage& from);
+  void CopyFrom(const BatchRound0P2PMessage& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const Round3BCMessage& from);
+  void MergeFrom(const BatchRound0P2PMessage& from);
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
   public:
@@ -871,15 +922,15 @@ class Round3BCMessage final :
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(Round3BCMessage* other);
+  void InternalSwap(BatchRound0P2PMessage* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "safeheron.proto.multi_party_ecdsa.Li24.sign.Round3BCMessage";
+    return "safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage";
   }
   protected:
-  explicit Round3BCMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit BatchRound0P2PMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -893,221 +944,193 @@ class Round3BCMessage final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kBlindFactorFieldNumber = 1,
-    kDlogProofGammaFieldNumber = 2,
+    kWFieldNumber = 1,
+    kKFieldNumber = 2,
+    kPhiFieldNumber = 3,
+    kWBinFieldNumber = 4,
+    kKBinFieldNumber = 5,
+    kPhiBinFieldNumber = 6,
   };
-  // string blind_factor = 1;
-  void clear_blind_factor();
-  const std::string& blind_factor() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_blind_factor(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_blind_factor();
-  PROTOBUF_NODISCARD std::string* release_blind_factor();
-  void set_allocated_blind_factor(std::string* blind_factor);
-  private:
-  const std::string& _internal_blind_factor() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_blind_factor(const std::string& value);
-  std::string* _internal_mutable_blind_factor();
+  // repeated string w = 1;
+  int w_size() const;
+  private:
+  int _internal_w_size() const;
+  public:
+  void clear_w();
+  const std::string& w(int index) const;
+  std::string* mutable_w(int index);
+  void set_w(int index, const std::string& value);
+  void set_w(int index, std::string&& value);
+  void set_w(int index, const char* value);
+  void set_w(int index, const char* value, size_t size);
+  std::string* add_w();
+  void add_w(const std::string& value);
+  void add_w(std::string&& value);
+  void add_w(const char* value);
+  void add_w(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& w() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_w();
+  private:
+  const std::string& _internal_w(int index) const;
+  std::string* _internal_add_w();
   public:
 
-  // .safeheron.proto.DLogProof dlog_proof_gamma_ = 2;
-  bool has_dlog_proof_gamma_() const;
+  // repeated string k = 2;
+  int k_size() const;
   private:
-  bool _internal_has_dlog_proof_gamma_() const;
+  int _internal_k_size() const;
   public:
-  void clear_dlog_proof_gamma_();
-  const ::safeheron::proto::DLogProof& dlog_proof_gamma_() const;
-  PROTOBUF_NODISCARD ::safeheron::proto::DLogProof* release_dlog_proof_gamma_();
-  ::safeheron::proto::DLogProof* mutable_dlog_proof_gamma_();
-  void set_allocated_dlog_proof_gamma_(::safeheron::proto::DLogProof* dlog_proof_gamma_);
-  private:
-  const ::safeheron::proto::DLogProof& _internal_dlog_proof_gamma_() const;
-  ::safeheron::proto::DLogProof* _internal_mutable_dlog_proof_gamma_();
+  void clear_k();
+  const std::string& k(int index) const;
+  std::string* mutable_k(int index);
+  void set_k(int index, const std::string& value);
+  void set_k(int index, std::string&& value);
+  void set_k(int index, const char* value);
+  void set_k(int index, const char* value, size_t size);
+  std::string* add_k();
+  void add_k(const std::string& value);
+  void add_k(std::string&& value);
+  void add_k(const char* value);
+  void add_k(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& k() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_k();
+  private:
+  const std::string& _internal_k(int index) const;
+  std::string* _internal_add_k();
   public:
-  void unsafe_arena_set_allocated_dlog_proof_gamma_(
-      ::safeheron::proto::DLogProof* dlog_proof_gamma_);
-  ::safeheron::proto::DLogProof* unsafe_arena_release_dlog_proof_gamma_();
-
-  // @@protoc_insertion_point(class_scope:safeheron.proto.multi_party_ecdsa.Li24.sign.Round3BCMessage)
- private:
-  class _Internal;
-
-  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
-  typedef void InternalArenaConstructable_;
-  typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr blind_factor_;
-  ::safeheron::proto::DLogProof* dlog_proof_gamma__;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_Li24_2fsign_2eproto;
-};
-// -------------------------------------------------------------------
-
-class Round4BCMessage final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:safeheron.proto.multi_party_ecdsa.Li24.sign.Round4BCMessage) */ {
- public:
-  inline Round4BCMessage() : Round4BCMessage(nullptr) {}
-  ~Round4BCMessage() override;
-  explicit PROTOBUF_CONSTEXPR Round4BCMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
-
-  Round4BCMessage(const Round4BCMessage& from);
-  Round4BCMessage(Round4BCMessage&& from) noexcept
-    : Round4BCMessage() {
-    *this = ::std::move(from);
-  }
-
-  inline Round4BCMessage& operator=(const Round4BCMessage& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline Round4BCMessage& operator=(Round4BCMessage&& from) noexcept {
-    if (this == &from) return *this;
-    if (GetOwningArena() == from.GetOwningArena()
-  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
-        && GetOwningArena() != nullptr
-  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
-    ) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
-
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
-  }
-  static const Round4BCMessage& default_instance() {
-    return *internal_default_instance();
-  }
-  static inline const Round4BCMessage* internal_default_instance() {
-    return reinterpret_cast<const Round4BCMessage*>(
-               &_Round4BCMessage_default_instance_);
-  }
-  static constexpr int kIndexInFileMessages =
-    5;
-
-  friend void swap(Round4BCMessage& a, Round4BCMessage& b) {
-    a.Swap(&b);
-  }
-  inline void Swap(Round4BCMessage* other) {
-    if (other == this) return;
-  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetOwningArena() != nullptr &&
-        GetOwningArena() == other->GetOwningArena()) {
-   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetOwningArena() == other->GetOwningArena()) {
-  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
-      InternalSwap(other);
-    } else {
-      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
-    }
-  }
-  void UnsafeArenaSwap(Round4BCMessage* other) {
-    if (other == this) return;
-    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
 
-  Round4BCMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<Round4BCMessage>(arena);
-  }
-  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const Round4BCMessage& from);
-  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const Round4BCMessage& from);
+  // repeated string phi = 3;
+  int phi_size() const;
   private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
+  int _internal_phi_size() const;
   public:
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  uint8_t* _InternalSerialize(
-      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
+  void clear_phi();
+  const std::string& phi(int index) const;
+  std::string* mutable_phi(int index);
+  void set_phi(int index, const std::string& value);
+  void set_phi(int index, std::string&& value);
+  void set_phi(int index, const char* value);
+  void set_phi(int index, const char* value, size_t size);
+  std::string* add_phi();
+  void add_phi(const std::string& value);
+  void add_phi(std::string&& value);
+  void add_phi(const char* value);
+  void add_phi(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& phi() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_phi();
   private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(Round4BCMessage* other);
+  const std::string& _internal_phi(int index) const;
+  std::string* _internal_add_phi();
+  public:
 
+  // repeated bytes w_bin = 4;
+  int w_bin_size() const;
   private:
-  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
-  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "safeheron.proto.multi_party_ecdsa.Li24.sign.Round4BCMessage";
-  }
-  protected:
-  explicit Round4BCMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-                       bool is_message_owned = false);
+  int _internal_w_bin_size() const;
+  public:
+  void clear_w_bin();
+  const std::string& w_bin(int index) const;
+  std::string* mutable_w_bin(int index);
+  void set_w_bin(int index, const std::string& value);
+  void set_w_bin(int index, std::string&& value);
+  void set_w_bin(int index, const char* value);
+  void set_w_bin(int index, const void* value, size_t size);
+  std::string* add_w_bin();
+  void add_w_bin(const std::string& value);
+  void add_w_bin(std::string&& value);
+  void add_w_bin(const char* value);
+  void add_w_bin(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& w_bin() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_w_bin();
+  private:
+  const std::string& _internal_w_bin(int index) const;
+  std::string* _internal_add_w_bin();
   public:
 
-  static const ClassData _class_data_;
-  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
-
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
+  // repeated bytes k_bin = 5;
+  int k_bin_size() const;
+  private:
+  int _internal_k_bin_size() const;
+  public:
+  void clear_k_bin();
+  const std::string& k_bin(int index) const;
+  std::string* mutable_k_bin(int index);
+  void set_k_bin(int index, const std::string& value);
+  void set_k_bin(int index, std::string&& value);
+  void set_k_bin(int index, const char* value);
+  void set_k_bin(int index, const void* value, size_t size);
+  std::string* add_k_bin();
+  void add_k_bin(const std::string& value);
+  void add_k_bin(std::string&& value);
+  void add_k_bin(const char* value);
+  void add_k_bin(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& k_bin() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_k_bin();
+  private:
+  const std::string& _internal_k_bin(int index) const;
+  std::string* _internal_add_k_bin();
+  public:
 
-  enum : int {
-    kCommitmentFieldNumber = 1,
-  };
-  // string commitment = 1;
-  void clear_commitment();
-  const std::string& commitment() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_commitment(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_commitment();
-  PROTOBUF_NODISCARD std::string* release_commitment();
-  void set_allocated_commitment(std::string* commitment);
-  private:
-  const std::string& _internal_commitment() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_commitment(const std::string& value);
-  std::string* _internal_mutable_commitment();
+  // repeated bytes phi_bin = 6;
+  int phi_bin_size() const;
+  private:
+  int _internal_phi_bin_size() const;
+  public:
+  void clear_phi_bin();
+  const std::string& phi_bin(int index) const;
+  std::string* mutable_phi_bin(int index);
+  void set_phi_bin(int index, const std::string& value);
+  void set_phi_bin(int index, std::string&& value);
+  void set_phi_bin(int index, const char* value);
+  void set_phi_bin(int index, const void* value, size_t size);
+  std::string* add_phi_bin();
+  void add_phi_bin(const std::string& value);
+  void add_phi_bin(std::string&& value);
+  void add_phi_bin(const char* value);
+  void add_phi_bin(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& phi_bin() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_phi_bin();
+  private:
+  const std::string& _internal_phi_bin(int index) const;
+  std::string* _internal_add_phi_bin();
   public:
 
-  // @@protoc_insertion_point(class_scope:safeheron.proto.multi_party_ecdsa.Li24.sign.Round4BCMessage)
+  // @@protoc_insertion_point(class_scope:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr commitment_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> w_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> k_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> phi_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> w_bin_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> k_bin_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> phi_bin_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_Li24_2fsign_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Round5BCMessage final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:safeheron.proto.multi_party_ecdsa.Li24.sign.Round5BCMessage) */ {
+class BatchRound1BCMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage) */ {
  public:
-  inline Round5BCMessage() : Round5BCMessage(nullptr) {}
-  ~Round5BCMessage() override;
-  explicit PROTOBUF_CONSTEXPR Round5BCMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline BatchRound1BCMessage() : BatchRound1BCMessage(nullptr) {}
+  ~BatchRound1BCMessage() override;
+  explicit PROTOBUF_CONSTEXPR BatchRound1BCMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Round5BCMessage(const Round5BCMessage& from);
-  Round5BCMessage(Round5BCMessage&& from) noexcept
-    : Round5BCMessage() {
+  BatchRound1BCMessage(const BatchRound1BCMessage& from);
+  BatchRound1BCMessage(BatchRound1BCMessage&& from) noexcept
+    : BatchRound1BCMessage() {
     *this = ::std::move(from);
   }
 
-  inline Round5BCMessage& operator=(const Round5BCMessage& from) {
+  inline BatchRound1BCMessage& operator=(const BatchRound1BCMessage& from) {
     CopyFrom(from);
     return *this;
   }
-  inline Round5BCMessage& operator=(Round5BCMessage&& from) noexcept {
+  inline BatchRound1BCMessage& operator=(BatchRound1BCMessage&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1130,20 +1153,20 @@ class Round5BCMessage final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const Round5BCMessage& default_instance() {
+  static const BatchRound1BCMessage& default_instance() {
     return *internal_default_instance();
   }
-  static inline const Round5BCMessage* internal_default_instance() {
-    return reinterpret_cast<const Round5BCMessage*>(
-               &_Round5BCMessage_default_instance_);
+  static inline const BatchRound1BCMessage* internal_default_instance() {
+    return reinterpret_cast<const BatchRound1BCMessage*>(
+               &_BatchRound1BCMessage_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    6;
+    5;
 
-  friend void swap(Round5BCMessage& a, Round5BCMessage& b) {
+  friend void swap(BatchRound1BCMessage& a, BatchRound1BCMessage& b) {
     a.Swap(&b);
   }
-  inline void Swap(Round5BCMessage* other) {
+  inline void Swap(BatchRound1BCMessage* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1156,7 +1179,7 @@ class Round5BCMessage final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(Round5BCMessage* other) {
+  void UnsafeArenaSwap(BatchRound1BCMessage* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1164,13 +1187,13 @@ class Round5BCMessage final :
 
   // implements Message ----------------------------------------------
 
-  Round5BCMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<Round5BCMessage>(arena);
+  BatchRound1BCMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BatchRound1BCMessage>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const Round5BCMessage& from);
+  void CopyFrom(const BatchRound1BCMessage& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const Round5BCMessage& from);
+  void MergeFrom(const BatchRound1BCMessage& from);
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
   public:
@@ -1187,15 +1210,15 @@ class Round5BCMessage final :
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(Round5BCMessage* other);
+  void InternalSwap(BatchRound1BCMessage* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "safeheron.proto.multi_party_ecdsa.Li24.sign.Round5BCMessage";
+    return "safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage";
   }
   protected:
-  explicit Round5BCMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit BatchRound1BCMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -1209,133 +1232,141 @@ class Round5BCMessage final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kBlindFactorFieldNumber = 4,
-    kVFieldNumber = 1,
-    kAFieldNumber = 2,
-    kLcProofVRGFieldNumber = 5,
-    kDlogProofRhoFieldNumber = 6,
+    kDeltaFieldNumber = 1,
+    kVFieldNumber = 2,
+    kDeltaBinFieldNumber = 3,
+    kVBinFieldNumber = 4,
   };
-  // string blind_factor = 4;
-  void clear_blind_factor();
-  const std::string& blind_factor() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_blind_factor(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_blind_factor();
-  PROTOBUF_NODISCARD std::string* release_blind_factor();
-  void set_allocated_blind_factor(std::string* blind_factor);
-  private:
-  const std::string& _internal_blind_factor() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_blind_factor(const std::string& value);
-  std::string* _internal_mutable_blind_factor();
-  public:
-
-  // .safeheron.proto.CurvePoint V = 1;
-  bool has_v() const;
+  // repeated string delta = 1;
+  int delta_size() const;
   private:
-  bool _internal_has_v() const;
+  int _internal_delta_size() const;
   public:
-  void clear_v();
-  const ::safeheron::proto::CurvePoint& v() const;
-  PROTOBUF_NODISCARD ::safeheron::proto::CurvePoint* release_v();
-  ::safeheron::proto::CurvePoint* mutable_v();
-  void set_allocated_v(::safeheron::proto::CurvePoint* v);
+  void clear_delta();
+  const std::string& delta(int index) const;
+  std::string* mutable_delta(int index);
+  void set_delta(int index, const std::string& value);
+  void set_delta(int index, std::string&& value);
+  void set_delta(int index, const char* value);
+  void set_delta(int index, const char* value, size_t size);
+  std::string* add_delta();
+  void add_delta(const std::string& value);
+  void add_delta(std::string&& value);
+  void add_delta(const char* value);
+  void add_delta(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& delta() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_delta();
   private:
-  const ::safeheron::proto::CurvePoint& _internal_v() const;
-  ::safeheron::proto::CurvePoint* _internal_mutable_v();
+  const std::string& _internal_delta(int index) const;
+  std::string* _internal_add_delta();
   public:
-  void unsafe_arena_set_allocated_v(
-      ::safeheron::proto::CurvePoint* v);
-  ::safeheron::proto::CurvePoint* unsafe_arena_release_v();
 
-  // .safeheron.proto.CurvePoint A = 2;
-  bool has_a() const;
+  // repeated string v = 2;
+  int v_size() const;
   private:
-  bool _internal_has_a() const;
+  int _internal_v_size() const;
   public:
-  void clear_a();
-  const ::safeheron::proto::CurvePoint& a() const;
-  PROTOBUF_NODISCARD ::safeheron::proto::CurvePoint* release_a();
-  ::safeheron::proto::CurvePoint* mutable_a();
-  void set_allocated_a(::safeheron::proto::CurvePoint* a);
-  private:
-  const ::safeheron::proto::CurvePoint& _internal_a() const;
-  ::safeheron::proto::CurvePoint* _internal_mutable_a();
+  void clear_v();
+  const std::string& v(int index) const;
+  std::string* mutable_v(int index);
+  void set_v(int index, const std::string& value);
+  void set_v(int index, std::string&& value);
+  void set_v(int index, const char* value);
+  void set_v(int index, const char* value, size_t size);
+  std::string* add_v();
+  void add_v(const std::string& value);
+  void add_v(std::string&& value);
+  void add_v(const char* value);
+  void add_v(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& v() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_v();
+  private:
+  const std::string& _internal_v(int index) const;
+  std::string* _internal_add_v();
   public:
-  void unsafe_arena_set_allocated_a(
-      ::safeheron::proto::CurvePoint* a);
-  ::safeheron::proto::CurvePoint* unsafe_arena_release_a();
 
-  // .safeheron.proto.LinearCombinationProof lc_proof_VRG = 5;
-  bool has_lc_proof_vrg() const;
+  // repeated bytes delta_bin = 3;
+  int delta_bin_size() const;
   private:
-  bool _internal_has_lc_proof_vrg() const;
+  int _internal_delta_bin_size() const;
   public:
-  void clear_lc_proof_vrg();
-  const ::safeheron::proto::LinearCombinationProof& lc_proof_vrg() const;
-  PROTOBUF_NODISCARD ::safeheron::proto::LinearCombinationProof* release_lc_proof_vrg();
-  ::safeheron::proto::LinearCombinationProof* mutable_lc_proof_vrg();
-  void set_allocated_lc_proof_vrg(::safeheron::proto::LinearCombinationProof* lc_proof_vrg);
-  private:
-  const ::safeheron::proto::LinearCombinationProof& _internal_lc_proof_vrg() const;
-  ::safeheron::proto::LinearCombinationProof* _internal_mutable_lc_proof_vrg();
+  void clear_delta_bin();
+  const std::string& delta_bin(int index) const;
+  std::string* mutable_delta_bin(int index);
+  void set_delta_bin(int index, const std::string& value);
+  void set_delta_bin(int index, std::string&& value);
+  void set_delta_bin(int index, const char* value);
+  void set_delta_bin(int index, const void* value, size_t size);
+  std::string* add_delta_bin();
+  void add_delta_bin(const std::string& value);
+  void add_delta_bin(std::string&& value);
+  void add_delta_bin(const char* value);
+  void add_delta_bin(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& delta_bin() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_delta_bin();
+  private:
+  const std::string& _internal_delta_bin(int index) const;
+  std::string* _internal_add_delta_bin();
   public:
-  void unsafe_arena_set_allocated_lc_proof_vrg(
-      ::safeheron::proto::LinearCombinationProof* lc_proof_vrg);
-  ::safeheron::proto::LinearCombinationProof* unsafe_arena_release_lc_proof_vrg();
 
-  // .safeheron.proto.DLogProof_V2 dlog_proof_rho = 6;
-  bool has_dlog_proof_rho() const;
+  // repeated bytes v_bin = 4;
+  int v_bin_size() const;
   private:
-  bool _internal_has_dlog_proof_rho() const;
+  int _internal_v_bin_size() const;
   public:
-  void clear_dlog_proof_rho();
-  const ::safeheron::proto::DLogProof_V2& dlog_proof_rho() const;
-  PROTOBUF_NODISCARD ::safeheron::proto::DLogProof_V2* release_dlog_proof_rho();
-  ::safeheron::proto::DLogProof_V2* mutable_dlog_proof_rho();
-  void set_allocated_dlog_proof_rho(::safeheron::proto::DLogProof_V2* dlog_proof_rho);
-  private:
-  const ::safeheron::proto::DLogProof_V2& _internal_dlog_proof_rho() const;
-  ::safeheron::proto::DLogProof_V2* _internal_mutable_dlog_proof_rho();
+  void clear_v_bin();
+  const std::string& v_bin(int index) const;
+  std::string* mutable_v_bin(int index);
+  void set_v_bin(int index, const std::string& value);
+  void set_v_bin(int index, std::string&& value);
+  void set_v_bin(int index, const char* value);
+  void set_v_bin(int index, const void* value, size_t size);
+  std::string* add_v_bin();
+  void add_v_bin(const std::string& value);
+  void add_v_bin(std::string&& value);
+  void add_v_bin(const char* value);
+  void add_v_bin(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& v_bin() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_v_bin();
+  private:
+  const std::string& _internal_v_bin(int index) const;
+  std::string* _internal_add_v_bin();
   public:
-  void unsafe_arena_set_allocated_dlog_proof_rho(
-      ::safeheron::proto::DLogProof_V2* dlog_proof_rho);
-  ::safeheron::proto::DLogProof_V2* unsafe_arena_release_dlog_proof_rho();
 
-  // @@protoc_insertion_point(class_scope:safeheron.proto.multi_party_ecdsa.Li24.sign.Round5BCMessage)
+  // @@protoc_insertion_point(class_scope:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr blind_factor_;
-  ::safeheron::proto::CurvePoint* v_;
-  ::safeheron::proto::CurvePoint* a_;
-  ::safeheron::proto::LinearCombinationProof* lc_proof_vrg_;
-  ::safeheron::proto::DLogProof_V2* dlog_proof_rho_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> delta_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> v_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> delta_bin_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> v_bin_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_Li24_2fsign_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Round6BCMessage final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:safeheron.proto.multi_party_ecdsa.Li24.sign.Round6BCMessage) */ {
+class PresignRound1BCMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage) */ {
  public:
-  inline Round6BCMessage() : Round6BCMessage(nullptr) {}
-  ~Round6BCMessage() override;
-  explicit PROTOBUF_CONSTEXPR Round6BCMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline PresignRound1BCMessage() : PresignRound1BCMessage(nullptr) {}
+  ~PresignRound1BCMessage() override;
+  explicit PROTOBUF_CONSTEXPR PresignRound1BCMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Round6BCMessage(const Round6BCMessage& from);
-  Round6BCMessage(Round6BCMessage&& from) noexcept
-    : Round6BCMessage() {
+  PresignRound1BCMessage(const PresignRound1BCMessage& from);
+  PresignRound1BCMessage(PresignRound1BCMessage&& from) noexcept
+    : PresignRound1BCMessage() {
     *this = ::std::move(from);
   }
 
-  inline Round6BCMessage& operator=(const Round6BCMessage& from) {
+  inline PresignRound1BCMessage& operator=(const PresignRound1BCMessage& from) {
     CopyFrom(from);
     return *this;
   }
-  inline Round6BCMessage& operator=(Round6BCMessage&& from) noexcept {
+  inline PresignRound1BCMessage& operator=(PresignRound1BCMessage&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1358,20 +1389,20 @@ class Round6BCMessage final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const Round6BCMessage& default_instance() {
+  static const PresignRound1BCMessage& default_instance() {
     return *internal_default_instance();
   }
-  static inline const Round6BCMessage* internal_default_instance() {
-    return reinterpret_cast<const Round6BCMessage*>(
-               &_Round6BCMessage_default_instance_);
+  static inline const PresignRound1BCMessage* internal_default_instance() {
+    return reinterpret_cast<const PresignRound1BCMessage*>(
+               &_PresignRound1BCMessage_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    7;
+    6;
 
-  friend void swap(Round6BCMessage& a, Round6BCMessage& b) {
+  friend void swap(PresignRound1BCMessage& a, PresignRound1BCMessage& b) {
     a.Swap(&b);
   }
-  inline void Swap(Round6BCMessage* other) {
+  inline void Swap(PresignRound1BCMessage* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1384,7 +1415,7 @@ class Round6BCMessage final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(Round6BCMessage* other) {
+  void UnsafeArenaSwap(PresignRound1BCMessage* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1392,13 +1423,13 @@ class Round6BCMessage final :
 
   // implements Message ----------------------------------------------
 
-  Round6BCMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<Round6BCMessage>(arena);
+  PresignRound1BCMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PresignRound1BCMessage>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const Round6BCMessage& from);
+  void CopyFrom(const PresignRound1BCMessage& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const Round6BCMessage& from);
+  void MergeFrom(const PresignRound1BCMessage& from);
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
   public:
@@ -1415,15 +1446,15 @@ class Round6BCMessage final :
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(Round6BCMessage* other);
+  void InternalSwap(PresignRound1BCMessage* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "safeheron.proto.multi_party_ecdsa.Li24.sign.Round6BCMessage";
+    return "safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage";
   }
   protected:
-  explicit Round6BCMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit PresignRound1BCMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -1437,53 +1468,89 @@ class Round6BCMessage final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kCommitmentFieldNumber = 1,
+    kVFieldNumber = 1,
+    kVBinFieldNumber = 2,
   };
-  // string commitment = 1;
-  void clear_commitment();
-  const std::string& commitment() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_commitment(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_commitment();
-  PROTOBUF_NODISCARD std::string* release_commitment();
-  void set_allocated_commitment(std::string* commitment);
-  private:
-  const std::string& _internal_commitment() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_commitment(const std::string& value);
-  std::string* _internal_mutable_commitment();
+  // repeated string v = 1;
+  int v_size() const;
+  private:
+  int _internal_v_size() const;
+  public:
+  void clear_v();
+  const std::string& v(int index) const;
+  std::string* mutable_v(int index);
+  void set_v(int index, const std::string& value);
+  void set_v(int index, std::string&& value);
+  void set_v(int index, const char* value);
+  void set_v(int index, const char* value, size_t size);
+  std::string* add_v();
+  void add_v(const std::string& value);
+  void add_v(std::string&& value);
+  void add_v(const char* value);
+  void add_v(const char* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& v() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_v();
+  private:
+  const std::string& _internal_v(int index) const;
+  std::string* _internal_add_v();
+  public:
+
+  // repeated bytes v_bin = 2;
+  int v_bin_size() const;
+  private:
+  int _internal_v_bin_size() const;
+  public:
+  void clear_v_bin();
+  const std::string& v_bin(int index) const;
+  std::string* mutable_v_bin(int index);
+  void set_v_bin(int index, const std::string& value);
+  void set_v_bin(int index, std::string&& value);
+  void set_v_bin(int index, const char* value);
+  void set_v_bin(int index, const void* value, size_t size);
+  std::string* add_v_bin();
+  void add_v_bin(const std::string& value);
+  void add_v_bin(std::string&& value);
+  void add_v_bin(const char* value);
+  void add_v_bin(const void* value, size_t size);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>& v_bin() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>* mutable_v_bin();
+  private:
+  const std::string& _internal_v_bin(int index) const;
+  std::string* _internal_add_v_bin();
   public:
 
-  // @@protoc_insertion_point(class_scope:safeheron.proto.multi_party_ecdsa.Li24.sign.Round6BCMessage)
+  // @@protoc_insertion_point(class_scope:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr commitment_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> v_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string> v_bin_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_Li24_2fsign_2eproto;
 };
 // -------------------------------------------------------------------
 
-class Round7BCMessage final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:safeheron.proto.multi_party_ecdsa.Li24.sign.Round7BCMessage) */ {
+class OnlineRound0BCMessage final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage) */ {
  public:
-  inline Round7BCMessage() : Round7BCMessage(nullptr) {}
-  ~Round7BCMessage() override;
-  explicit PROTOBUF_CONSTEXPR Round7BCMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+  inline OnlineRound0BCMessage() : OnlineRound0BCMessage(nullptr) {}
+  ~OnlineRound0BCMessage() override;
+  explicit PROTOBUF_CONSTEXPR OnlineRound0BCMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Round7BCMessage(const Round7BCMessage& from);
-  Round7BCMessage(Round7BCMessage&& from) noexcept
-    : Round7BCMessage() {
+  OnlineRound0BCMessage(const OnlineRound0BCMessage& from);
+  OnlineRound0BCMessage(OnlineRound0BCMessage&& from) noexcept
+    : OnlineRound0BCMessage() {
     *this = ::std::move(from);
   }
 
-  inline Round7BCMessage& operator=(const Round7BCMessage& from) {
+  inline OnlineRound0BCMessage& operator=(const OnlineRound0BCMessage& from) {
     CopyFrom(from);
     return *this;
   }
-  inline Round7BCMessage& operator=(Round7BCMessage&& from) noexcept {
+  inline OnlineRound0BCMessage& operator=(OnlineRound0BCMessage&& from) noexcept {
     if (this == &from) return *this;
     if (GetOwningArena() == from.GetOwningArena()
   #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
@@ -1506,20 +1573,20 @@ class Round7BCMessage final :
   static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
     return default_instance().GetMetadata().reflection;
   }
-  static const Round7BCMessage& default_instance() {
+  static const OnlineRound0BCMessage& default_instance() {
     return *internal_default_instance();
   }
-  static inline const Round7BCMessage* internal_default_instance() {
-    return reinterpret_cast<const Round7BCMessage*>(
-               &_Round7BCMessage_default_instance_);
+  static inline const OnlineRound0BCMessage* internal_default_instance() {
+    return reinterpret_cast<const OnlineRound0BCMessage*>(
+               &_OnlineRound0BCMessage_default_instance_);
   }
   static constexpr int kIndexInFileMessages =
-    8;
+    7;
 
-  friend void swap(Round7BCMessage& a, Round7BCMessage& b) {
+  friend void swap(OnlineRound0BCMessage& a, OnlineRound0BCMessage& b) {
     a.Swap(&b);
   }
-  inline void Swap(Round7BCMessage* other) {
+  inline void Swap(OnlineRound0BCMessage* other) {
     if (other == this) return;
   #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
     if (GetOwningArena() != nullptr &&
@@ -1532,7 +1599,7 @@ class Round7BCMessage final :
       ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
     }
   }
-  void UnsafeArenaSwap(Round7BCMessage* other) {
+  void UnsafeArenaSwap(OnlineRound0BCMessage* other) {
     if (other == this) return;
     GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
     InternalSwap(other);
@@ -1540,13 +1607,13 @@ class Round7BCMessage final :
 
   // implements Message ----------------------------------------------
 
-  Round7BCMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<Round7BCMessage>(arena);
+  OnlineRound0BCMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<OnlineRound0BCMessage>(arena);
   }
   using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const Round7BCMessage& from);
+  void CopyFrom(const OnlineRound0BCMessage& from);
   using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const Round7BCMessage& from);
+  void MergeFrom(const OnlineRound0BCMessage& from);
   private:
   static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
   public:
@@ -1563,15 +1630,15 @@ class Round7BCMessage final :
   void SharedCtor();
   void SharedDtor();
   void SetCachedSize(int size) const final;
-  void InternalSwap(Round7BCMessage* other);
+  void InternalSwap(OnlineRound0BCMessage* other);
 
   private:
   friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
   static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "safeheron.proto.multi_party_ecdsa.Li24.sign.Round7BCMessage";
+    return "safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage";
   }
   protected:
-  explicit Round7BCMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+  explicit OnlineRound0BCMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
                        bool is_message_owned = false);
   public:
 
@@ -1585,735 +1652,521 @@ class Round7BCMessage final :
   // accessors -------------------------------------------------------
 
   enum : int {
-    kBlindFactorFieldNumber = 3,
-    kUFieldNumber = 1,
-    kTFieldNumber = 2,
+    kRFieldNumber = 1,
+    kDeltaFieldNumber = 2,
+    kRBinFieldNumber = 3,
+    kDeltaBinFieldNumber = 4,
   };
-  // string blind_factor = 3;
-  void clear_blind_factor();
-  const std::string& blind_factor() const;
+  // string r = 1;
+  void clear_r();
+  const std::string& r() const;
   template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_blind_factor(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_blind_factor();
-  PROTOBUF_NODISCARD std::string* release_blind_factor();
-  void set_allocated_blind_factor(std::string* blind_factor);
-  private:
-  const std::string& _internal_blind_factor() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_blind_factor(const std::string& value);
-  std::string* _internal_mutable_blind_factor();
+  void set_r(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_r();
+  PROTOBUF_NODISCARD std::string* release_r();
+  void set_allocated_r(std::string* r);
+  private:
+  const std::string& _internal_r() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_r(const std::string& value);
+  std::string* _internal_mutable_r();
   public:
 
-  // .safeheron.proto.CurvePoint U = 1;
-  bool has_u() const;
+  // string delta = 2;
+  void clear_delta();
+  const std::string& delta() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_delta(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_delta();
+  PROTOBUF_NODISCARD std::string* release_delta();
+  void set_allocated_delta(std::string* delta);
   private:
-  bool _internal_has_u() const;
-  public:
-  void clear_u();
-  const ::safeheron::proto::CurvePoint& u() const;
-  PROTOBUF_NODISCARD ::safeheron::proto::CurvePoint* release_u();
-  ::safeheron::proto::CurvePoint* mutable_u();
-  void set_allocated_u(::safeheron::proto::CurvePoint* u);
-  private:
-  const ::safeheron::proto::CurvePoint& _internal_u() const;
-  ::safeheron::proto::CurvePoint* _internal_mutable_u();
+  const std::string& _internal_delta() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_delta(const std::string& value);
+  std::string* _internal_mutable_delta();
   public:
-  void unsafe_arena_set_allocated_u(
-      ::safeheron::proto::CurvePoint* u);
-  ::safeheron::proto::CurvePoint* unsafe_arena_release_u();
 
-  // .safeheron.proto.CurvePoint T = 2;
-  bool has_t() const;
+  // bytes r_bin = 3;
+  void clear_r_bin();
+  const std::string& r_bin() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_r_bin(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_r_bin();
+  PROTOBUF_NODISCARD std::string* release_r_bin();
+  void set_allocated_r_bin(std::string* r_bin);
   private:
-  bool _internal_has_t() const;
+  const std::string& _internal_r_bin() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_r_bin(const std::string& value);
+  std::string* _internal_mutable_r_bin();
   public:
-  void clear_t();
-  const ::safeheron::proto::CurvePoint& t() const;
-  PROTOBUF_NODISCARD ::safeheron::proto::CurvePoint* release_t();
-  ::safeheron::proto::CurvePoint* mutable_t();
-  void set_allocated_t(::safeheron::proto::CurvePoint* t);
-  private:
-  const ::safeheron::proto::CurvePoint& _internal_t() const;
-  ::safeheron::proto::CurvePoint* _internal_mutable_t();
+
+  // bytes delta_bin = 4;
+  void clear_delta_bin();
+  const std::string& delta_bin() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_delta_bin(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_delta_bin();
+  PROTOBUF_NODISCARD std::string* release_delta_bin();
+  void set_allocated_delta_bin(std::string* delta_bin);
+  private:
+  const std::string& _internal_delta_bin() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_delta_bin(const std::string& value);
+  std::string* _internal_mutable_delta_bin();
   public:
-  void unsafe_arena_set_allocated_t(
-      ::safeheron::proto::CurvePoint* t);
-  ::safeheron::proto::CurvePoint* unsafe_arena_release_t();
 
-  // @@protoc_insertion_point(class_scope:safeheron.proto.multi_party_ecdsa.Li24.sign.Round7BCMessage)
+  // @@protoc_insertion_point(class_scope:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage)
  private:
   class _Internal;
 
   template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
   typedef void InternalArenaConstructable_;
   typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr blind_factor_;
-  ::safeheron::proto::CurvePoint* u_;
-  ::safeheron::proto::CurvePoint* t_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr r_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr delta_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr r_bin_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr delta_bin_;
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_Li24_2fsign_2eproto;
 };
-// -------------------------------------------------------------------
+// ===================================================================
 
-class Round8BCMessage final :
-    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:safeheron.proto.multi_party_ecdsa.Li24.sign.Round8BCMessage) */ {
- public:
-  inline Round8BCMessage() : Round8BCMessage(nullptr) {}
-  ~Round8BCMessage() override;
-  explicit PROTOBUF_CONSTEXPR Round8BCMessage(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
 
-  Round8BCMessage(const Round8BCMessage& from);
-  Round8BCMessage(Round8BCMessage&& from) noexcept
-    : Round8BCMessage() {
-    *this = ::std::move(from);
-  }
+// ===================================================================
 
-  inline Round8BCMessage& operator=(const Round8BCMessage& from) {
-    CopyFrom(from);
-    return *this;
-  }
-  inline Round8BCMessage& operator=(Round8BCMessage&& from) noexcept {
-    if (this == &from) return *this;
-    if (GetOwningArena() == from.GetOwningArena()
-  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
-        && GetOwningArena() != nullptr
-  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
-    ) {
-      InternalSwap(&from);
-    } else {
-      CopyFrom(from);
-    }
-    return *this;
-  }
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Round0BCMessage
 
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
-    return GetDescriptor();
-  }
-  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
-    return default_instance().GetMetadata().descriptor;
+// .safeheron.proto.CurvePoint GK = 1;
+inline bool Round0BCMessage::_internal_has_gk() const {
+  return this != internal_default_instance() && gk_ != nullptr;
+}
+inline bool Round0BCMessage::has_gk() const {
+  return _internal_has_gk();
+}
+inline const ::safeheron::proto::CurvePoint& Round0BCMessage::_internal_gk() const {
+  const ::safeheron::proto::CurvePoint* p = gk_;
+  return p != nullptr ? *p : reinterpret_cast<const ::safeheron::proto::CurvePoint&>(
+      ::safeheron::proto::_CurvePoint_default_instance_);
+}
+inline const ::safeheron::proto::CurvePoint& Round0BCMessage::gk() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0BCMessage.GK)
+  return _internal_gk();
+}
+inline void Round0BCMessage::unsafe_arena_set_allocated_gk(
+    ::safeheron::proto::CurvePoint* gk) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(gk_);
   }
-  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
-    return default_instance().GetMetadata().reflection;
+  gk_ = gk;
+  if (gk) {
+    
+  } else {
+    
   }
-  static const Round8BCMessage& default_instance() {
-    return *internal_default_instance();
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0BCMessage.GK)
+}
+inline ::safeheron::proto::CurvePoint* Round0BCMessage::release_gk() {
+  
+  ::safeheron::proto::CurvePoint* temp = gk_;
+  gk_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
-  static inline const Round8BCMessage* internal_default_instance() {
-    return reinterpret_cast<const Round8BCMessage*>(
-               &_Round8BCMessage_default_instance_);
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::safeheron::proto::CurvePoint* Round0BCMessage::unsafe_arena_release_gk() {
+  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0BCMessage.GK)
+  
+  ::safeheron::proto::CurvePoint* temp = gk_;
+  gk_ = nullptr;
+  return temp;
+}
+inline ::safeheron::proto::CurvePoint* Round0BCMessage::_internal_mutable_gk() {
+  
+  if (gk_ == nullptr) {
+    auto* p = CreateMaybeMessage<::safeheron::proto::CurvePoint>(GetArenaForAllocation());
+    gk_ = p;
   }
-  static constexpr int kIndexInFileMessages =
-    9;
-
-  friend void swap(Round8BCMessage& a, Round8BCMessage& b) {
-    a.Swap(&b);
+  return gk_;
+}
+inline ::safeheron::proto::CurvePoint* Round0BCMessage::mutable_gk() {
+  ::safeheron::proto::CurvePoint* _msg = _internal_mutable_gk();
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0BCMessage.GK)
+  return _msg;
+}
+inline void Round0BCMessage::set_allocated_gk(::safeheron::proto::CurvePoint* gk) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(gk_);
   }
-  inline void Swap(Round8BCMessage* other) {
-    if (other == this) return;
-  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetOwningArena() != nullptr &&
-        GetOwningArena() == other->GetOwningArena()) {
-   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
-    if (GetOwningArena() == other->GetOwningArena()) {
-  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
-      InternalSwap(other);
-    } else {
-      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+  if (gk) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(gk));
+    if (message_arena != submessage_arena) {
+      gk = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, gk, submessage_arena);
     }
+    
+  } else {
+    
   }
-  void UnsafeArenaSwap(Round8BCMessage* other) {
-    if (other == this) return;
-    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
-    InternalSwap(other);
-  }
-
-  // implements Message ----------------------------------------------
-
-  Round8BCMessage* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
-    return CreateMaybeMessage<Round8BCMessage>(arena);
-  }
-  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
-  void CopyFrom(const Round8BCMessage& from);
-  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
-  void MergeFrom(const Round8BCMessage& from);
-  private:
-  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message* to, const ::PROTOBUF_NAMESPACE_ID::Message& from);
-  public:
-  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
-  bool IsInitialized() const final;
-
-  size_t ByteSizeLong() const final;
-  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
-  uint8_t* _InternalSerialize(
-      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
-  int GetCachedSize() const final { return _cached_size_.Get(); }
-
-  private:
-  void SharedCtor();
-  void SharedDtor();
-  void SetCachedSize(int size) const final;
-  void InternalSwap(Round8BCMessage* other);
-
-  private:
-  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
-  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
-    return "safeheron.proto.multi_party_ecdsa.Li24.sign.Round8BCMessage";
-  }
-  protected:
-  explicit Round8BCMessage(::PROTOBUF_NAMESPACE_ID::Arena* arena,
-                       bool is_message_owned = false);
-  public:
-
-  static const ClassData _class_data_;
-  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
-
-  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
-
-  // nested types ----------------------------------------------------
-
-  // accessors -------------------------------------------------------
-
-  enum : int {
-    kSiFieldNumber = 1,
-  };
-  // string si = 1;
-  void clear_si();
-  const std::string& si() const;
-  template <typename ArgT0 = const std::string&, typename... ArgT>
-  void set_si(ArgT0&& arg0, ArgT... args);
-  std::string* mutable_si();
-  PROTOBUF_NODISCARD std::string* release_si();
-  void set_allocated_si(std::string* si);
-  private:
-  const std::string& _internal_si() const;
-  inline PROTOBUF_ALWAYS_INLINE void _internal_set_si(const std::string& value);
-  std::string* _internal_mutable_si();
-  public:
-
-  // @@protoc_insertion_point(class_scope:safeheron.proto.multi_party_ecdsa.Li24.sign.Round8BCMessage)
- private:
-  class _Internal;
-
-  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
-  typedef void InternalArenaConstructable_;
-  typedef void DestructorSkippable_;
-  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr si_;
-  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
-  friend struct ::TableStruct_Li24_2fsign_2eproto;
-};
-// ===================================================================
-
+  gk_ = gk;
+  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0BCMessage.GK)
+}
 
-// ===================================================================
+// -------------------------------------------------------------------
 
-#ifdef __GNUC__
-  #pragma GCC diagnostic push
-  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
-#endif  // __GNUC__
-// Round0BCMessage
+// Round0P2PMessage
 
-// string message_a = 1;
-inline void Round0BCMessage::clear_message_a() {
-  message_a_.ClearToEmpty();
+// string w = 1;
+inline void Round0P2PMessage::clear_w() {
+  w_.ClearToEmpty();
 }
-inline const std::string& Round0BCMessage::message_a() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0BCMessage.message_a)
-  return _internal_message_a();
+inline const std::string& Round0P2PMessage::w() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.w)
+  return _internal_w();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void Round0BCMessage::set_message_a(ArgT0&& arg0, ArgT... args) {
+void Round0P2PMessage::set_w(ArgT0&& arg0, ArgT... args) {
  
- message_a_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0BCMessage.message_a)
+ w_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.w)
 }
-inline std::string* Round0BCMessage::mutable_message_a() {
-  std::string* _s = _internal_mutable_message_a();
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0BCMessage.message_a)
+inline std::string* Round0P2PMessage::mutable_w() {
+  std::string* _s = _internal_mutable_w();
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.w)
   return _s;
 }
-inline const std::string& Round0BCMessage::_internal_message_a() const {
-  return message_a_.Get();
+inline const std::string& Round0P2PMessage::_internal_w() const {
+  return w_.Get();
 }
-inline void Round0BCMessage::_internal_set_message_a(const std::string& value) {
+inline void Round0P2PMessage::_internal_set_w(const std::string& value) {
   
-  message_a_.Set(value, GetArenaForAllocation());
+  w_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Round0BCMessage::_internal_mutable_message_a() {
+inline std::string* Round0P2PMessage::_internal_mutable_w() {
   
-  return message_a_.Mutable(GetArenaForAllocation());
+  return w_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Round0BCMessage::release_message_a() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0BCMessage.message_a)
-  return message_a_.Release();
+inline std::string* Round0P2PMessage::release_w() {
+  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.w)
+  return w_.Release();
 }
-inline void Round0BCMessage::set_allocated_message_a(std::string* message_a) {
-  if (message_a != nullptr) {
+inline void Round0P2PMessage::set_allocated_w(std::string* w) {
+  if (w != nullptr) {
     
   } else {
     
   }
-  message_a_.SetAllocated(message_a, GetArenaForAllocation());
+  w_.SetAllocated(w, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (message_a_.IsDefault()) {
-    message_a_.Set("", GetArenaForAllocation());
+  if (w_.IsDefault()) {
+    w_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0BCMessage.message_a)
+  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.w)
 }
 
-// string commitment = 2;
-inline void Round0BCMessage::clear_commitment() {
-  commitment_.ClearToEmpty();
+// string k = 2;
+inline void Round0P2PMessage::clear_k() {
+  k_.ClearToEmpty();
 }
-inline const std::string& Round0BCMessage::commitment() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0BCMessage.commitment)
-  return _internal_commitment();
+inline const std::string& Round0P2PMessage::k() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.k)
+  return _internal_k();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void Round0BCMessage::set_commitment(ArgT0&& arg0, ArgT... args) {
+void Round0P2PMessage::set_k(ArgT0&& arg0, ArgT... args) {
  
- commitment_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0BCMessage.commitment)
+ k_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.k)
 }
-inline std::string* Round0BCMessage::mutable_commitment() {
-  std::string* _s = _internal_mutable_commitment();
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0BCMessage.commitment)
+inline std::string* Round0P2PMessage::mutable_k() {
+  std::string* _s = _internal_mutable_k();
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.k)
   return _s;
 }
-inline const std::string& Round0BCMessage::_internal_commitment() const {
-  return commitment_.Get();
+inline const std::string& Round0P2PMessage::_internal_k() const {
+  return k_.Get();
 }
-inline void Round0BCMessage::_internal_set_commitment(const std::string& value) {
+inline void Round0P2PMessage::_internal_set_k(const std::string& value) {
   
-  commitment_.Set(value, GetArenaForAllocation());
+  k_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Round0BCMessage::_internal_mutable_commitment() {
+inline std::string* Round0P2PMessage::_internal_mutable_k() {
   
-  return commitment_.Mutable(GetArenaForAllocation());
+  return k_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Round0BCMessage::release_commitment() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0BCMessage.commitment)
-  return commitment_.Release();
+inline std::string* Round0P2PMessage::release_k() {
+  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.k)
+  return k_.Release();
 }
-inline void Round0BCMessage::set_allocated_commitment(std::string* commitment) {
-  if (commitment != nullptr) {
+inline void Round0P2PMessage::set_allocated_k(std::string* k) {
+  if (k != nullptr) {
     
   } else {
     
   }
-  commitment_.SetAllocated(commitment, GetArenaForAllocation());
+  k_.SetAllocated(k, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (commitment_.IsDefault()) {
-    commitment_.Set("", GetArenaForAllocation());
+  if (k_.IsDefault()) {
+    k_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0BCMessage.commitment)
+  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.k)
 }
 
-// -------------------------------------------------------------------
-
-// Round0P2PMessage
-
-// .safeheron.proto.PailEncRangeProof_V1 alice_proof = 3;
-inline bool Round0P2PMessage::_internal_has_alice_proof() const {
-  return this != internal_default_instance() && alice_proof_ != nullptr;
+// string phi = 3;
+inline void Round0P2PMessage::clear_phi() {
+  phi_.ClearToEmpty();
 }
-inline bool Round0P2PMessage::has_alice_proof() const {
-  return _internal_has_alice_proof();
+inline const std::string& Round0P2PMessage::phi() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.phi)
+  return _internal_phi();
 }
-inline const ::safeheron::proto::PailEncRangeProof_V1& Round0P2PMessage::_internal_alice_proof() const {
-  const ::safeheron::proto::PailEncRangeProof_V1* p = alice_proof_;
-  return p != nullptr ? *p : reinterpret_cast<const ::safeheron::proto::PailEncRangeProof_V1&>(
-      ::safeheron::proto::_PailEncRangeProof_V1_default_instance_);
-}
-inline const ::safeheron::proto::PailEncRangeProof_V1& Round0P2PMessage::alice_proof() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.alice_proof)
-  return _internal_alice_proof();
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Round0P2PMessage::set_phi(ArgT0&& arg0, ArgT... args) {
+ 
+ phi_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.phi)
 }
-inline void Round0P2PMessage::unsafe_arena_set_allocated_alice_proof(
-    ::safeheron::proto::PailEncRangeProof_V1* alice_proof) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(alice_proof_);
-  }
-  alice_proof_ = alice_proof;
-  if (alice_proof) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.alice_proof)
+inline std::string* Round0P2PMessage::mutable_phi() {
+  std::string* _s = _internal_mutable_phi();
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.phi)
+  return _s;
 }
-inline ::safeheron::proto::PailEncRangeProof_V1* Round0P2PMessage::release_alice_proof() {
-  
-  ::safeheron::proto::PailEncRangeProof_V1* temp = alice_proof_;
-  alice_proof_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+inline const std::string& Round0P2PMessage::_internal_phi() const {
+  return phi_.Get();
 }
-inline ::safeheron::proto::PailEncRangeProof_V1* Round0P2PMessage::unsafe_arena_release_alice_proof() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.alice_proof)
+inline void Round0P2PMessage::_internal_set_phi(const std::string& value) {
   
-  ::safeheron::proto::PailEncRangeProof_V1* temp = alice_proof_;
-  alice_proof_ = nullptr;
-  return temp;
+  phi_.Set(value, GetArenaForAllocation());
 }
-inline ::safeheron::proto::PailEncRangeProof_V1* Round0P2PMessage::_internal_mutable_alice_proof() {
+inline std::string* Round0P2PMessage::_internal_mutable_phi() {
   
-  if (alice_proof_ == nullptr) {
-    auto* p = CreateMaybeMessage<::safeheron::proto::PailEncRangeProof_V1>(GetArenaForAllocation());
-    alice_proof_ = p;
-  }
-  return alice_proof_;
+  return phi_.Mutable(GetArenaForAllocation());
 }
-inline ::safeheron::proto::PailEncRangeProof_V1* Round0P2PMessage::mutable_alice_proof() {
-  ::safeheron::proto::PailEncRangeProof_V1* _msg = _internal_mutable_alice_proof();
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.alice_proof)
-  return _msg;
+inline std::string* Round0P2PMessage::release_phi() {
+  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.phi)
+  return phi_.Release();
 }
-inline void Round0P2PMessage::set_allocated_alice_proof(::safeheron::proto::PailEncRangeProof_V1* alice_proof) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(alice_proof_);
-  }
-  if (alice_proof) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(alice_proof));
-    if (message_arena != submessage_arena) {
-      alice_proof = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, alice_proof, submessage_arena);
-    }
+inline void Round0P2PMessage::set_allocated_phi(std::string* phi) {
+  if (phi != nullptr) {
     
   } else {
     
   }
-  alice_proof_ = alice_proof;
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.alice_proof)
+  phi_.SetAllocated(phi, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (phi_.IsDefault()) {
+    phi_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.phi)
 }
 
-// -------------------------------------------------------------------
-
-// Round1P2PMessage
-
-// string message_b_for_k_gamma = 1;
-inline void Round1P2PMessage::clear_message_b_for_k_gamma() {
-  message_b_for_k_gamma_.ClearToEmpty();
+// bytes w_bin = 4;
+inline void Round0P2PMessage::clear_w_bin() {
+  w_bin_.ClearToEmpty();
 }
-inline const std::string& Round1P2PMessage::message_b_for_k_gamma() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.message_b_for_k_gamma)
-  return _internal_message_b_for_k_gamma();
+inline const std::string& Round0P2PMessage::w_bin() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.w_bin)
+  return _internal_w_bin();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void Round1P2PMessage::set_message_b_for_k_gamma(ArgT0&& arg0, ArgT... args) {
+void Round0P2PMessage::set_w_bin(ArgT0&& arg0, ArgT... args) {
  
- message_b_for_k_gamma_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.message_b_for_k_gamma)
+ w_bin_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.w_bin)
 }
-inline std::string* Round1P2PMessage::mutable_message_b_for_k_gamma() {
-  std::string* _s = _internal_mutable_message_b_for_k_gamma();
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.message_b_for_k_gamma)
+inline std::string* Round0P2PMessage::mutable_w_bin() {
+  std::string* _s = _internal_mutable_w_bin();
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.w_bin)
   return _s;
 }
-inline const std::string& Round1P2PMessage::_internal_message_b_for_k_gamma() const {
-  return message_b_for_k_gamma_.Get();
+inline const std::string& Round0P2PMessage::_internal_w_bin() const {
+  return w_bin_.Get();
 }
-inline void Round1P2PMessage::_internal_set_message_b_for_k_gamma(const std::string& value) {
+inline void Round0P2PMessage::_internal_set_w_bin(const std::string& value) {
   
-  message_b_for_k_gamma_.Set(value, GetArenaForAllocation());
+  w_bin_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Round1P2PMessage::_internal_mutable_message_b_for_k_gamma() {
+inline std::string* Round0P2PMessage::_internal_mutable_w_bin() {
   
-  return message_b_for_k_gamma_.Mutable(GetArenaForAllocation());
+  return w_bin_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Round1P2PMessage::release_message_b_for_k_gamma() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.message_b_for_k_gamma)
-  return message_b_for_k_gamma_.Release();
+inline std::string* Round0P2PMessage::release_w_bin() {
+  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.w_bin)
+  return w_bin_.Release();
 }
-inline void Round1P2PMessage::set_allocated_message_b_for_k_gamma(std::string* message_b_for_k_gamma) {
-  if (message_b_for_k_gamma != nullptr) {
+inline void Round0P2PMessage::set_allocated_w_bin(std::string* w_bin) {
+  if (w_bin != nullptr) {
     
   } else {
     
   }
-  message_b_for_k_gamma_.SetAllocated(message_b_for_k_gamma, GetArenaForAllocation());
+  w_bin_.SetAllocated(w_bin, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (message_b_for_k_gamma_.IsDefault()) {
-    message_b_for_k_gamma_.Set("", GetArenaForAllocation());
+  if (w_bin_.IsDefault()) {
+    w_bin_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.message_b_for_k_gamma)
+  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.w_bin)
 }
 
-// string message_b_for_k_w = 2;
-inline void Round1P2PMessage::clear_message_b_for_k_w() {
-  message_b_for_k_w_.ClearToEmpty();
+// bytes k_bin = 5;
+inline void Round0P2PMessage::clear_k_bin() {
+  k_bin_.ClearToEmpty();
 }
-inline const std::string& Round1P2PMessage::message_b_for_k_w() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.message_b_for_k_w)
-  return _internal_message_b_for_k_w();
+inline const std::string& Round0P2PMessage::k_bin() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.k_bin)
+  return _internal_k_bin();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void Round1P2PMessage::set_message_b_for_k_w(ArgT0&& arg0, ArgT... args) {
+void Round0P2PMessage::set_k_bin(ArgT0&& arg0, ArgT... args) {
  
- message_b_for_k_w_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.message_b_for_k_w)
+ k_bin_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.k_bin)
 }
-inline std::string* Round1P2PMessage::mutable_message_b_for_k_w() {
-  std::string* _s = _internal_mutable_message_b_for_k_w();
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.message_b_for_k_w)
+inline std::string* Round0P2PMessage::mutable_k_bin() {
+  std::string* _s = _internal_mutable_k_bin();
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.k_bin)
   return _s;
 }
-inline const std::string& Round1P2PMessage::_internal_message_b_for_k_w() const {
-  return message_b_for_k_w_.Get();
+inline const std::string& Round0P2PMessage::_internal_k_bin() const {
+  return k_bin_.Get();
 }
-inline void Round1P2PMessage::_internal_set_message_b_for_k_w(const std::string& value) {
+inline void Round0P2PMessage::_internal_set_k_bin(const std::string& value) {
   
-  message_b_for_k_w_.Set(value, GetArenaForAllocation());
+  k_bin_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Round1P2PMessage::_internal_mutable_message_b_for_k_w() {
+inline std::string* Round0P2PMessage::_internal_mutable_k_bin() {
   
-  return message_b_for_k_w_.Mutable(GetArenaForAllocation());
+  return k_bin_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Round1P2PMessage::release_message_b_for_k_w() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.message_b_for_k_w)
-  return message_b_for_k_w_.Release();
+inline std::string* Round0P2PMessage::release_k_bin() {
+  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.k_bin)
+  return k_bin_.Release();
 }
-inline void Round1P2PMessage::set_allocated_message_b_for_k_w(std::string* message_b_for_k_w) {
-  if (message_b_for_k_w != nullptr) {
+inline void Round0P2PMessage::set_allocated_k_bin(std::string* k_bin) {
+  if (k_bin != nullptr) {
     
   } else {
     
   }
-  message_b_for_k_w_.SetAllocated(message_b_for_k_w, GetArenaForAllocation());
+  k_bin_.SetAllocated(k_bin, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (message_b_for_k_w_.IsDefault()) {
-    message_b_for_k_w_.Set("", GetArenaForAllocation());
+  if (k_bin_.IsDefault()) {
+    k_bin_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.message_b_for_k_w)
+  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.k_bin)
 }
 
-// .safeheron.proto.PailAffRangeProof bob_proof_1 = 3;
-inline bool Round1P2PMessage::_internal_has_bob_proof_1() const {
-  return this != internal_default_instance() && bob_proof_1_ != nullptr;
-}
-inline bool Round1P2PMessage::has_bob_proof_1() const {
-  return _internal_has_bob_proof_1();
+// bytes phi_bin = 6;
+inline void Round0P2PMessage::clear_phi_bin() {
+  phi_bin_.ClearToEmpty();
 }
-inline const ::safeheron::proto::PailAffRangeProof& Round1P2PMessage::_internal_bob_proof_1() const {
-  const ::safeheron::proto::PailAffRangeProof* p = bob_proof_1_;
-  return p != nullptr ? *p : reinterpret_cast<const ::safeheron::proto::PailAffRangeProof&>(
-      ::safeheron::proto::_PailAffRangeProof_default_instance_);
+inline const std::string& Round0P2PMessage::phi_bin() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.phi_bin)
+  return _internal_phi_bin();
 }
-inline const ::safeheron::proto::PailAffRangeProof& Round1P2PMessage::bob_proof_1() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.bob_proof_1)
-  return _internal_bob_proof_1();
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Round0P2PMessage::set_phi_bin(ArgT0&& arg0, ArgT... args) {
+ 
+ phi_bin_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.phi_bin)
 }
-inline void Round1P2PMessage::unsafe_arena_set_allocated_bob_proof_1(
-    ::safeheron::proto::PailAffRangeProof* bob_proof_1) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(bob_proof_1_);
-  }
-  bob_proof_1_ = bob_proof_1;
-  if (bob_proof_1) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.bob_proof_1)
+inline std::string* Round0P2PMessage::mutable_phi_bin() {
+  std::string* _s = _internal_mutable_phi_bin();
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.phi_bin)
+  return _s;
 }
-inline ::safeheron::proto::PailAffRangeProof* Round1P2PMessage::release_bob_proof_1() {
-  
-  ::safeheron::proto::PailAffRangeProof* temp = bob_proof_1_;
-  bob_proof_1_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+inline const std::string& Round0P2PMessage::_internal_phi_bin() const {
+  return phi_bin_.Get();
 }
-inline ::safeheron::proto::PailAffRangeProof* Round1P2PMessage::unsafe_arena_release_bob_proof_1() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.bob_proof_1)
+inline void Round0P2PMessage::_internal_set_phi_bin(const std::string& value) {
   
-  ::safeheron::proto::PailAffRangeProof* temp = bob_proof_1_;
-  bob_proof_1_ = nullptr;
-  return temp;
+  phi_bin_.Set(value, GetArenaForAllocation());
 }
-inline ::safeheron::proto::PailAffRangeProof* Round1P2PMessage::_internal_mutable_bob_proof_1() {
+inline std::string* Round0P2PMessage::_internal_mutable_phi_bin() {
   
-  if (bob_proof_1_ == nullptr) {
-    auto* p = CreateMaybeMessage<::safeheron::proto::PailAffRangeProof>(GetArenaForAllocation());
-    bob_proof_1_ = p;
-  }
-  return bob_proof_1_;
-}
-inline ::safeheron::proto::PailAffRangeProof* Round1P2PMessage::mutable_bob_proof_1() {
-  ::safeheron::proto::PailAffRangeProof* _msg = _internal_mutable_bob_proof_1();
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.bob_proof_1)
-  return _msg;
-}
-inline void Round1P2PMessage::set_allocated_bob_proof_1(::safeheron::proto::PailAffRangeProof* bob_proof_1) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(bob_proof_1_);
-  }
-  if (bob_proof_1) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(bob_proof_1));
-    if (message_arena != submessage_arena) {
-      bob_proof_1 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, bob_proof_1, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  bob_proof_1_ = bob_proof_1;
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.bob_proof_1)
-}
-
-// .safeheron.proto.PailAffGroupEleRangeProof_V1 bob_proof_2 = 4;
-inline bool Round1P2PMessage::_internal_has_bob_proof_2() const {
-  return this != internal_default_instance() && bob_proof_2_ != nullptr;
-}
-inline bool Round1P2PMessage::has_bob_proof_2() const {
-  return _internal_has_bob_proof_2();
+  return phi_bin_.Mutable(GetArenaForAllocation());
 }
-inline const ::safeheron::proto::PailAffGroupEleRangeProof_V1& Round1P2PMessage::_internal_bob_proof_2() const {
-  const ::safeheron::proto::PailAffGroupEleRangeProof_V1* p = bob_proof_2_;
-  return p != nullptr ? *p : reinterpret_cast<const ::safeheron::proto::PailAffGroupEleRangeProof_V1&>(
-      ::safeheron::proto::_PailAffGroupEleRangeProof_V1_default_instance_);
+inline std::string* Round0P2PMessage::release_phi_bin() {
+  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.phi_bin)
+  return phi_bin_.Release();
 }
-inline const ::safeheron::proto::PailAffGroupEleRangeProof_V1& Round1P2PMessage::bob_proof_2() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.bob_proof_2)
-  return _internal_bob_proof_2();
-}
-inline void Round1P2PMessage::unsafe_arena_set_allocated_bob_proof_2(
-    ::safeheron::proto::PailAffGroupEleRangeProof_V1* bob_proof_2) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(bob_proof_2_);
-  }
-  bob_proof_2_ = bob_proof_2;
-  if (bob_proof_2) {
+inline void Round0P2PMessage::set_allocated_phi_bin(std::string* phi_bin) {
+  if (phi_bin != nullptr) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.bob_proof_2)
-}
-inline ::safeheron::proto::PailAffGroupEleRangeProof_V1* Round1P2PMessage::release_bob_proof_2() {
-  
-  ::safeheron::proto::PailAffGroupEleRangeProof_V1* temp = bob_proof_2_;
-  bob_proof_2_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
-}
-inline ::safeheron::proto::PailAffGroupEleRangeProof_V1* Round1P2PMessage::unsafe_arena_release_bob_proof_2() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.bob_proof_2)
-  
-  ::safeheron::proto::PailAffGroupEleRangeProof_V1* temp = bob_proof_2_;
-  bob_proof_2_ = nullptr;
-  return temp;
-}
-inline ::safeheron::proto::PailAffGroupEleRangeProof_V1* Round1P2PMessage::_internal_mutable_bob_proof_2() {
-  
-  if (bob_proof_2_ == nullptr) {
-    auto* p = CreateMaybeMessage<::safeheron::proto::PailAffGroupEleRangeProof_V1>(GetArenaForAllocation());
-    bob_proof_2_ = p;
-  }
-  return bob_proof_2_;
-}
-inline ::safeheron::proto::PailAffGroupEleRangeProof_V1* Round1P2PMessage::mutable_bob_proof_2() {
-  ::safeheron::proto::PailAffGroupEleRangeProof_V1* _msg = _internal_mutable_bob_proof_2();
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.bob_proof_2)
-  return _msg;
-}
-inline void Round1P2PMessage::set_allocated_bob_proof_2(::safeheron::proto::PailAffGroupEleRangeProof_V1* bob_proof_2) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(bob_proof_2_);
-  }
-  if (bob_proof_2) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(bob_proof_2));
-    if (message_arena != submessage_arena) {
-      bob_proof_2 = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, bob_proof_2, submessage_arena);
-    }
-    
-  } else {
-    
+  phi_bin_.SetAllocated(phi_bin, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (phi_bin_.IsDefault()) {
+    phi_bin_.Set("", GetArenaForAllocation());
   }
-  bob_proof_2_ = bob_proof_2;
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.bob_proof_2)
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round0P2PMessage.phi_bin)
 }
 
 // -------------------------------------------------------------------
 
-// Round2BCMessage
+// Round1P2PMessage
 
 // string delta = 1;
-inline void Round2BCMessage::clear_delta() {
+inline void Round1P2PMessage::clear_delta() {
   delta_.ClearToEmpty();
 }
-inline const std::string& Round2BCMessage::delta() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round2BCMessage.delta)
+inline const std::string& Round1P2PMessage::delta() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.delta)
   return _internal_delta();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void Round2BCMessage::set_delta(ArgT0&& arg0, ArgT... args) {
+void Round1P2PMessage::set_delta(ArgT0&& arg0, ArgT... args) {
  
  delta_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.Round2BCMessage.delta)
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.delta)
 }
-inline std::string* Round2BCMessage::mutable_delta() {
+inline std::string* Round1P2PMessage::mutable_delta() {
   std::string* _s = _internal_mutable_delta();
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round2BCMessage.delta)
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.delta)
   return _s;
 }
-inline const std::string& Round2BCMessage::_internal_delta() const {
+inline const std::string& Round1P2PMessage::_internal_delta() const {
   return delta_.Get();
 }
-inline void Round2BCMessage::_internal_set_delta(const std::string& value) {
+inline void Round1P2PMessage::_internal_set_delta(const std::string& value) {
   
   delta_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Round2BCMessage::_internal_mutable_delta() {
+inline std::string* Round1P2PMessage::_internal_mutable_delta() {
   
   return delta_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Round2BCMessage::release_delta() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round2BCMessage.delta)
+inline std::string* Round1P2PMessage::release_delta() {
+  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.delta)
   return delta_.Release();
 }
-inline void Round2BCMessage::set_allocated_delta(std::string* delta) {
+inline void Round1P2PMessage::set_allocated_delta(std::string* delta) {
   if (delta != nullptr) {
     
   } else {
@@ -2325,926 +2178,1314 @@ inline void Round2BCMessage::set_allocated_delta(std::string* delta) {
     delta_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round2BCMessage.delta)
+  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.delta)
 }
 
-// -------------------------------------------------------------------
-
-// Round3BCMessage
-
-// string blind_factor = 1;
-inline void Round3BCMessage::clear_blind_factor() {
-  blind_factor_.ClearToEmpty();
+// string v = 2;
+inline void Round1P2PMessage::clear_v() {
+  v_.ClearToEmpty();
 }
-inline const std::string& Round3BCMessage::blind_factor() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round3BCMessage.blind_factor)
-  return _internal_blind_factor();
+inline const std::string& Round1P2PMessage::v() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.v)
+  return _internal_v();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void Round3BCMessage::set_blind_factor(ArgT0&& arg0, ArgT... args) {
+void Round1P2PMessage::set_v(ArgT0&& arg0, ArgT... args) {
  
- blind_factor_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.Round3BCMessage.blind_factor)
+ v_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.v)
 }
-inline std::string* Round3BCMessage::mutable_blind_factor() {
-  std::string* _s = _internal_mutable_blind_factor();
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round3BCMessage.blind_factor)
+inline std::string* Round1P2PMessage::mutable_v() {
+  std::string* _s = _internal_mutable_v();
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.v)
   return _s;
 }
-inline const std::string& Round3BCMessage::_internal_blind_factor() const {
-  return blind_factor_.Get();
+inline const std::string& Round1P2PMessage::_internal_v() const {
+  return v_.Get();
 }
-inline void Round3BCMessage::_internal_set_blind_factor(const std::string& value) {
+inline void Round1P2PMessage::_internal_set_v(const std::string& value) {
   
-  blind_factor_.Set(value, GetArenaForAllocation());
+  v_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Round3BCMessage::_internal_mutable_blind_factor() {
+inline std::string* Round1P2PMessage::_internal_mutable_v() {
   
-  return blind_factor_.Mutable(GetArenaForAllocation());
+  return v_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Round3BCMessage::release_blind_factor() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round3BCMessage.blind_factor)
-  return blind_factor_.Release();
+inline std::string* Round1P2PMessage::release_v() {
+  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.v)
+  return v_.Release();
 }
-inline void Round3BCMessage::set_allocated_blind_factor(std::string* blind_factor) {
-  if (blind_factor != nullptr) {
+inline void Round1P2PMessage::set_allocated_v(std::string* v) {
+  if (v != nullptr) {
     
   } else {
     
   }
-  blind_factor_.SetAllocated(blind_factor, GetArenaForAllocation());
+  v_.SetAllocated(v, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (blind_factor_.IsDefault()) {
-    blind_factor_.Set("", GetArenaForAllocation());
+  if (v_.IsDefault()) {
+    v_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round3BCMessage.blind_factor)
+  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.v)
 }
 
-// .safeheron.proto.DLogProof dlog_proof_gamma_ = 2;
-inline bool Round3BCMessage::_internal_has_dlog_proof_gamma_() const {
-  return this != internal_default_instance() && dlog_proof_gamma__ != nullptr;
+// bytes delta_bin = 3;
+inline void Round1P2PMessage::clear_delta_bin() {
+  delta_bin_.ClearToEmpty();
+}
+inline const std::string& Round1P2PMessage::delta_bin() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.delta_bin)
+  return _internal_delta_bin();
 }
-inline bool Round3BCMessage::has_dlog_proof_gamma_() const {
-  return _internal_has_dlog_proof_gamma_();
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Round1P2PMessage::set_delta_bin(ArgT0&& arg0, ArgT... args) {
+ 
+ delta_bin_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.delta_bin)
 }
-inline const ::safeheron::proto::DLogProof& Round3BCMessage::_internal_dlog_proof_gamma_() const {
-  const ::safeheron::proto::DLogProof* p = dlog_proof_gamma__;
-  return p != nullptr ? *p : reinterpret_cast<const ::safeheron::proto::DLogProof&>(
-      ::safeheron::proto::_DLogProof_default_instance_);
+inline std::string* Round1P2PMessage::mutable_delta_bin() {
+  std::string* _s = _internal_mutable_delta_bin();
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.delta_bin)
+  return _s;
 }
-inline const ::safeheron::proto::DLogProof& Round3BCMessage::dlog_proof_gamma_() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round3BCMessage.dlog_proof_gamma_)
-  return _internal_dlog_proof_gamma_();
+inline const std::string& Round1P2PMessage::_internal_delta_bin() const {
+  return delta_bin_.Get();
 }
-inline void Round3BCMessage::unsafe_arena_set_allocated_dlog_proof_gamma_(
-    ::safeheron::proto::DLogProof* dlog_proof_gamma_) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(dlog_proof_gamma__);
-  }
-  dlog_proof_gamma__ = dlog_proof_gamma_;
-  if (dlog_proof_gamma_) {
+inline void Round1P2PMessage::_internal_set_delta_bin(const std::string& value) {
+  
+  delta_bin_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Round1P2PMessage::_internal_mutable_delta_bin() {
+  
+  return delta_bin_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Round1P2PMessage::release_delta_bin() {
+  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.delta_bin)
+  return delta_bin_.Release();
+}
+inline void Round1P2PMessage::set_allocated_delta_bin(std::string* delta_bin) {
+  if (delta_bin != nullptr) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round3BCMessage.dlog_proof_gamma_)
+  delta_bin_.SetAllocated(delta_bin, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (delta_bin_.IsDefault()) {
+    delta_bin_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.delta_bin)
 }
-inline ::safeheron::proto::DLogProof* Round3BCMessage::release_dlog_proof_gamma_() {
-  
-  ::safeheron::proto::DLogProof* temp = dlog_proof_gamma__;
-  dlog_proof_gamma__ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+
+// bytes v_bin = 4;
+inline void Round1P2PMessage::clear_v_bin() {
+  v_bin_.ClearToEmpty();
 }
-inline ::safeheron::proto::DLogProof* Round3BCMessage::unsafe_arena_release_dlog_proof_gamma_() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round3BCMessage.dlog_proof_gamma_)
+inline const std::string& Round1P2PMessage::v_bin() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.v_bin)
+  return _internal_v_bin();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Round1P2PMessage::set_v_bin(ArgT0&& arg0, ArgT... args) {
+ 
+ v_bin_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.v_bin)
+}
+inline std::string* Round1P2PMessage::mutable_v_bin() {
+  std::string* _s = _internal_mutable_v_bin();
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.v_bin)
+  return _s;
+}
+inline const std::string& Round1P2PMessage::_internal_v_bin() const {
+  return v_bin_.Get();
+}
+inline void Round1P2PMessage::_internal_set_v_bin(const std::string& value) {
   
-  ::safeheron::proto::DLogProof* temp = dlog_proof_gamma__;
-  dlog_proof_gamma__ = nullptr;
-  return temp;
+  v_bin_.Set(value, GetArenaForAllocation());
 }
-inline ::safeheron::proto::DLogProof* Round3BCMessage::_internal_mutable_dlog_proof_gamma_() {
+inline std::string* Round1P2PMessage::_internal_mutable_v_bin() {
   
-  if (dlog_proof_gamma__ == nullptr) {
-    auto* p = CreateMaybeMessage<::safeheron::proto::DLogProof>(GetArenaForAllocation());
-    dlog_proof_gamma__ = p;
-  }
-  return dlog_proof_gamma__;
+  return v_bin_.Mutable(GetArenaForAllocation());
 }
-inline ::safeheron::proto::DLogProof* Round3BCMessage::mutable_dlog_proof_gamma_() {
-  ::safeheron::proto::DLogProof* _msg = _internal_mutable_dlog_proof_gamma_();
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round3BCMessage.dlog_proof_gamma_)
-  return _msg;
+inline std::string* Round1P2PMessage::release_v_bin() {
+  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.v_bin)
+  return v_bin_.Release();
 }
-inline void Round3BCMessage::set_allocated_dlog_proof_gamma_(::safeheron::proto::DLogProof* dlog_proof_gamma_) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(dlog_proof_gamma__);
-  }
-  if (dlog_proof_gamma_) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(dlog_proof_gamma_));
-    if (message_arena != submessage_arena) {
-      dlog_proof_gamma_ = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, dlog_proof_gamma_, submessage_arena);
-    }
+inline void Round1P2PMessage::set_allocated_v_bin(std::string* v_bin) {
+  if (v_bin != nullptr) {
     
   } else {
     
   }
-  dlog_proof_gamma__ = dlog_proof_gamma_;
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round3BCMessage.dlog_proof_gamma_)
+  v_bin_.SetAllocated(v_bin, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (v_bin_.IsDefault()) {
+    v_bin_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round1P2PMessage.v_bin)
 }
 
 // -------------------------------------------------------------------
 
-// Round4BCMessage
+// BatchRound0BCMessage
 
-// string commitment = 1;
-inline void Round4BCMessage::clear_commitment() {
-  commitment_.ClearToEmpty();
+// repeated .safeheron.proto.CurvePoint GK = 1;
+inline int BatchRound0BCMessage::_internal_gk_size() const {
+  return gk_.size();
 }
-inline const std::string& Round4BCMessage::commitment() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round4BCMessage.commitment)
-  return _internal_commitment();
+inline int BatchRound0BCMessage::gk_size() const {
+  return _internal_gk_size();
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void Round4BCMessage::set_commitment(ArgT0&& arg0, ArgT... args) {
- 
- commitment_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.Round4BCMessage.commitment)
+inline ::safeheron::proto::CurvePoint* BatchRound0BCMessage::mutable_gk(int index) {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0BCMessage.GK)
+  return gk_.Mutable(index);
 }
-inline std::string* Round4BCMessage::mutable_commitment() {
-  std::string* _s = _internal_mutable_commitment();
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round4BCMessage.commitment)
-  return _s;
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::safeheron::proto::CurvePoint >*
+BatchRound0BCMessage::mutable_gk() {
+  // @@protoc_insertion_point(field_mutable_list:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0BCMessage.GK)
+  return &gk_;
 }
-inline const std::string& Round4BCMessage::_internal_commitment() const {
-  return commitment_.Get();
+inline const ::safeheron::proto::CurvePoint& BatchRound0BCMessage::_internal_gk(int index) const {
+  return gk_.Get(index);
 }
-inline void Round4BCMessage::_internal_set_commitment(const std::string& value) {
-  
-  commitment_.Set(value, GetArenaForAllocation());
+inline const ::safeheron::proto::CurvePoint& BatchRound0BCMessage::gk(int index) const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0BCMessage.GK)
+  return _internal_gk(index);
 }
-inline std::string* Round4BCMessage::_internal_mutable_commitment() {
-  
-  return commitment_.Mutable(GetArenaForAllocation());
+inline ::safeheron::proto::CurvePoint* BatchRound0BCMessage::_internal_add_gk() {
+  return gk_.Add();
 }
-inline std::string* Round4BCMessage::release_commitment() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round4BCMessage.commitment)
-  return commitment_.Release();
+inline ::safeheron::proto::CurvePoint* BatchRound0BCMessage::add_gk() {
+  ::safeheron::proto::CurvePoint* _add = _internal_add_gk();
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0BCMessage.GK)
+  return _add;
 }
-inline void Round4BCMessage::set_allocated_commitment(std::string* commitment) {
-  if (commitment != nullptr) {
-    
-  } else {
-    
-  }
-  commitment_.SetAllocated(commitment, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (commitment_.IsDefault()) {
-    commitment_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round4BCMessage.commitment)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::safeheron::proto::CurvePoint >&
+BatchRound0BCMessage::gk() const {
+  // @@protoc_insertion_point(field_list:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0BCMessage.GK)
+  return gk_;
 }
 
 // -------------------------------------------------------------------
 
-// Round5BCMessage
+// BatchRound0P2PMessage
 
-// .safeheron.proto.CurvePoint V = 1;
-inline bool Round5BCMessage::_internal_has_v() const {
-  return this != internal_default_instance() && v_ != nullptr;
+// repeated string w = 1;
+inline int BatchRound0P2PMessage::_internal_w_size() const {
+  return w_.size();
 }
-inline bool Round5BCMessage::has_v() const {
-  return _internal_has_v();
+inline int BatchRound0P2PMessage::w_size() const {
+  return _internal_w_size();
 }
-inline const ::safeheron::proto::CurvePoint& Round5BCMessage::_internal_v() const {
-  const ::safeheron::proto::CurvePoint* p = v_;
-  return p != nullptr ? *p : reinterpret_cast<const ::safeheron::proto::CurvePoint&>(
-      ::safeheron::proto::_CurvePoint_default_instance_);
+inline void BatchRound0P2PMessage::clear_w() {
+  w_.Clear();
 }
-inline const ::safeheron::proto::CurvePoint& Round5BCMessage::v() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round5BCMessage.V)
-  return _internal_v();
+inline std::string* BatchRound0P2PMessage::add_w() {
+  std::string* _s = _internal_add_w();
+  // @@protoc_insertion_point(field_add_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w)
+  return _s;
 }
-inline void Round5BCMessage::unsafe_arena_set_allocated_v(
-    ::safeheron::proto::CurvePoint* v) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(v_);
-  }
-  v_ = v;
-  if (v) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round5BCMessage.V)
+inline const std::string& BatchRound0P2PMessage::_internal_w(int index) const {
+  return w_.Get(index);
 }
-inline ::safeheron::proto::CurvePoint* Round5BCMessage::release_v() {
-  
-  ::safeheron::proto::CurvePoint* temp = v_;
-  v_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+inline const std::string& BatchRound0P2PMessage::w(int index) const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w)
+  return _internal_w(index);
 }
-inline ::safeheron::proto::CurvePoint* Round5BCMessage::unsafe_arena_release_v() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round5BCMessage.V)
-  
-  ::safeheron::proto::CurvePoint* temp = v_;
-  v_ = nullptr;
-  return temp;
+inline std::string* BatchRound0P2PMessage::mutable_w(int index) {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w)
+  return w_.Mutable(index);
 }
-inline ::safeheron::proto::CurvePoint* Round5BCMessage::_internal_mutable_v() {
-  
-  if (v_ == nullptr) {
-    auto* p = CreateMaybeMessage<::safeheron::proto::CurvePoint>(GetArenaForAllocation());
-    v_ = p;
-  }
-  return v_;
+inline void BatchRound0P2PMessage::set_w(int index, const std::string& value) {
+  w_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w)
 }
-inline ::safeheron::proto::CurvePoint* Round5BCMessage::mutable_v() {
-  ::safeheron::proto::CurvePoint* _msg = _internal_mutable_v();
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round5BCMessage.V)
-  return _msg;
+inline void BatchRound0P2PMessage::set_w(int index, std::string&& value) {
+  w_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w)
 }
-inline void Round5BCMessage::set_allocated_v(::safeheron::proto::CurvePoint* v) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(v_);
-  }
-  if (v) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(v));
-    if (message_arena != submessage_arena) {
-      v = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, v, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  v_ = v;
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round5BCMessage.V)
+inline void BatchRound0P2PMessage::set_w(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  w_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w)
+}
+inline void BatchRound0P2PMessage::set_w(int index, const char* value, size_t size) {
+  w_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w)
+}
+inline std::string* BatchRound0P2PMessage::_internal_add_w() {
+  return w_.Add();
+}
+inline void BatchRound0P2PMessage::add_w(const std::string& value) {
+  w_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w)
+}
+inline void BatchRound0P2PMessage::add_w(std::string&& value) {
+  w_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w)
+}
+inline void BatchRound0P2PMessage::add_w(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  w_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w)
+}
+inline void BatchRound0P2PMessage::add_w(const char* value, size_t size) {
+  w_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+BatchRound0P2PMessage::w() const {
+  // @@protoc_insertion_point(field_list:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w)
+  return w_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+BatchRound0P2PMessage::mutable_w() {
+  // @@protoc_insertion_point(field_mutable_list:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w)
+  return &w_;
 }
 
-// .safeheron.proto.CurvePoint A = 2;
-inline bool Round5BCMessage::_internal_has_a() const {
-  return this != internal_default_instance() && a_ != nullptr;
+// repeated string k = 2;
+inline int BatchRound0P2PMessage::_internal_k_size() const {
+  return k_.size();
 }
-inline bool Round5BCMessage::has_a() const {
-  return _internal_has_a();
+inline int BatchRound0P2PMessage::k_size() const {
+  return _internal_k_size();
 }
-inline const ::safeheron::proto::CurvePoint& Round5BCMessage::_internal_a() const {
-  const ::safeheron::proto::CurvePoint* p = a_;
-  return p != nullptr ? *p : reinterpret_cast<const ::safeheron::proto::CurvePoint&>(
-      ::safeheron::proto::_CurvePoint_default_instance_);
+inline void BatchRound0P2PMessage::clear_k() {
+  k_.Clear();
 }
-inline const ::safeheron::proto::CurvePoint& Round5BCMessage::a() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round5BCMessage.A)
-  return _internal_a();
+inline std::string* BatchRound0P2PMessage::add_k() {
+  std::string* _s = _internal_add_k();
+  // @@protoc_insertion_point(field_add_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k)
+  return _s;
 }
-inline void Round5BCMessage::unsafe_arena_set_allocated_a(
-    ::safeheron::proto::CurvePoint* a) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(a_);
-  }
-  a_ = a;
-  if (a) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round5BCMessage.A)
+inline const std::string& BatchRound0P2PMessage::_internal_k(int index) const {
+  return k_.Get(index);
 }
-inline ::safeheron::proto::CurvePoint* Round5BCMessage::release_a() {
-  
-  ::safeheron::proto::CurvePoint* temp = a_;
-  a_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+inline const std::string& BatchRound0P2PMessage::k(int index) const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k)
+  return _internal_k(index);
 }
-inline ::safeheron::proto::CurvePoint* Round5BCMessage::unsafe_arena_release_a() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round5BCMessage.A)
-  
-  ::safeheron::proto::CurvePoint* temp = a_;
-  a_ = nullptr;
-  return temp;
+inline std::string* BatchRound0P2PMessage::mutable_k(int index) {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k)
+  return k_.Mutable(index);
 }
-inline ::safeheron::proto::CurvePoint* Round5BCMessage::_internal_mutable_a() {
-  
-  if (a_ == nullptr) {
-    auto* p = CreateMaybeMessage<::safeheron::proto::CurvePoint>(GetArenaForAllocation());
-    a_ = p;
-  }
-  return a_;
+inline void BatchRound0P2PMessage::set_k(int index, const std::string& value) {
+  k_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k)
 }
-inline ::safeheron::proto::CurvePoint* Round5BCMessage::mutable_a() {
-  ::safeheron::proto::CurvePoint* _msg = _internal_mutable_a();
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round5BCMessage.A)
-  return _msg;
+inline void BatchRound0P2PMessage::set_k(int index, std::string&& value) {
+  k_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k)
 }
-inline void Round5BCMessage::set_allocated_a(::safeheron::proto::CurvePoint* a) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(a_);
-  }
-  if (a) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(a));
-    if (message_arena != submessage_arena) {
-      a = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, a, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  a_ = a;
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round5BCMessage.A)
+inline void BatchRound0P2PMessage::set_k(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  k_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k)
+}
+inline void BatchRound0P2PMessage::set_k(int index, const char* value, size_t size) {
+  k_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k)
+}
+inline std::string* BatchRound0P2PMessage::_internal_add_k() {
+  return k_.Add();
+}
+inline void BatchRound0P2PMessage::add_k(const std::string& value) {
+  k_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k)
+}
+inline void BatchRound0P2PMessage::add_k(std::string&& value) {
+  k_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k)
+}
+inline void BatchRound0P2PMessage::add_k(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  k_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k)
+}
+inline void BatchRound0P2PMessage::add_k(const char* value, size_t size) {
+  k_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+BatchRound0P2PMessage::k() const {
+  // @@protoc_insertion_point(field_list:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k)
+  return k_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+BatchRound0P2PMessage::mutable_k() {
+  // @@protoc_insertion_point(field_mutable_list:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k)
+  return &k_;
 }
 
-// string blind_factor = 4;
-inline void Round5BCMessage::clear_blind_factor() {
-  blind_factor_.ClearToEmpty();
+// repeated string phi = 3;
+inline int BatchRound0P2PMessage::_internal_phi_size() const {
+  return phi_.size();
 }
-inline const std::string& Round5BCMessage::blind_factor() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round5BCMessage.blind_factor)
-  return _internal_blind_factor();
+inline int BatchRound0P2PMessage::phi_size() const {
+  return _internal_phi_size();
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void Round5BCMessage::set_blind_factor(ArgT0&& arg0, ArgT... args) {
- 
- blind_factor_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.Round5BCMessage.blind_factor)
+inline void BatchRound0P2PMessage::clear_phi() {
+  phi_.Clear();
 }
-inline std::string* Round5BCMessage::mutable_blind_factor() {
-  std::string* _s = _internal_mutable_blind_factor();
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round5BCMessage.blind_factor)
+inline std::string* BatchRound0P2PMessage::add_phi() {
+  std::string* _s = _internal_add_phi();
+  // @@protoc_insertion_point(field_add_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi)
   return _s;
 }
-inline const std::string& Round5BCMessage::_internal_blind_factor() const {
-  return blind_factor_.Get();
+inline const std::string& BatchRound0P2PMessage::_internal_phi(int index) const {
+  return phi_.Get(index);
 }
-inline void Round5BCMessage::_internal_set_blind_factor(const std::string& value) {
-  
-  blind_factor_.Set(value, GetArenaForAllocation());
+inline const std::string& BatchRound0P2PMessage::phi(int index) const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi)
+  return _internal_phi(index);
 }
-inline std::string* Round5BCMessage::_internal_mutable_blind_factor() {
-  
-  return blind_factor_.Mutable(GetArenaForAllocation());
+inline std::string* BatchRound0P2PMessage::mutable_phi(int index) {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi)
+  return phi_.Mutable(index);
 }
-inline std::string* Round5BCMessage::release_blind_factor() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round5BCMessage.blind_factor)
-  return blind_factor_.Release();
+inline void BatchRound0P2PMessage::set_phi(int index, const std::string& value) {
+  phi_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi)
 }
-inline void Round5BCMessage::set_allocated_blind_factor(std::string* blind_factor) {
-  if (blind_factor != nullptr) {
-    
-  } else {
-    
-  }
-  blind_factor_.SetAllocated(blind_factor, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (blind_factor_.IsDefault()) {
-    blind_factor_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round5BCMessage.blind_factor)
+inline void BatchRound0P2PMessage::set_phi(int index, std::string&& value) {
+  phi_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi)
+}
+inline void BatchRound0P2PMessage::set_phi(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  phi_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi)
+}
+inline void BatchRound0P2PMessage::set_phi(int index, const char* value, size_t size) {
+  phi_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi)
+}
+inline std::string* BatchRound0P2PMessage::_internal_add_phi() {
+  return phi_.Add();
+}
+inline void BatchRound0P2PMessage::add_phi(const std::string& value) {
+  phi_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi)
+}
+inline void BatchRound0P2PMessage::add_phi(std::string&& value) {
+  phi_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi)
+}
+inline void BatchRound0P2PMessage::add_phi(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  phi_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi)
+}
+inline void BatchRound0P2PMessage::add_phi(const char* value, size_t size) {
+  phi_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+BatchRound0P2PMessage::phi() const {
+  // @@protoc_insertion_point(field_list:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi)
+  return phi_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+BatchRound0P2PMessage::mutable_phi() {
+  // @@protoc_insertion_point(field_mutable_list:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi)
+  return &phi_;
 }
 
-// .safeheron.proto.LinearCombinationProof lc_proof_VRG = 5;
-inline bool Round5BCMessage::_internal_has_lc_proof_vrg() const {
-  return this != internal_default_instance() && lc_proof_vrg_ != nullptr;
+// repeated bytes w_bin = 4;
+inline int BatchRound0P2PMessage::_internal_w_bin_size() const {
+  return w_bin_.size();
 }
-inline bool Round5BCMessage::has_lc_proof_vrg() const {
-  return _internal_has_lc_proof_vrg();
+inline int BatchRound0P2PMessage::w_bin_size() const {
+  return _internal_w_bin_size();
 }
-inline const ::safeheron::proto::LinearCombinationProof& Round5BCMessage::_internal_lc_proof_vrg() const {
-  const ::safeheron::proto::LinearCombinationProof* p = lc_proof_vrg_;
-  return p != nullptr ? *p : reinterpret_cast<const ::safeheron::proto::LinearCombinationProof&>(
-      ::safeheron::proto::_LinearCombinationProof_default_instance_);
+inline void BatchRound0P2PMessage::clear_w_bin() {
+  w_bin_.Clear();
 }
-inline const ::safeheron::proto::LinearCombinationProof& Round5BCMessage::lc_proof_vrg() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round5BCMessage.lc_proof_VRG)
-  return _internal_lc_proof_vrg();
+inline std::string* BatchRound0P2PMessage::add_w_bin() {
+  std::string* _s = _internal_add_w_bin();
+  // @@protoc_insertion_point(field_add_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w_bin)
+  return _s;
 }
-inline void Round5BCMessage::unsafe_arena_set_allocated_lc_proof_vrg(
-    ::safeheron::proto::LinearCombinationProof* lc_proof_vrg) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(lc_proof_vrg_);
-  }
-  lc_proof_vrg_ = lc_proof_vrg;
-  if (lc_proof_vrg) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round5BCMessage.lc_proof_VRG)
+inline const std::string& BatchRound0P2PMessage::_internal_w_bin(int index) const {
+  return w_bin_.Get(index);
 }
-inline ::safeheron::proto::LinearCombinationProof* Round5BCMessage::release_lc_proof_vrg() {
-  
-  ::safeheron::proto::LinearCombinationProof* temp = lc_proof_vrg_;
-  lc_proof_vrg_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+inline const std::string& BatchRound0P2PMessage::w_bin(int index) const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w_bin)
+  return _internal_w_bin(index);
 }
-inline ::safeheron::proto::LinearCombinationProof* Round5BCMessage::unsafe_arena_release_lc_proof_vrg() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round5BCMessage.lc_proof_VRG)
-  
-  ::safeheron::proto::LinearCombinationProof* temp = lc_proof_vrg_;
-  lc_proof_vrg_ = nullptr;
-  return temp;
+inline std::string* BatchRound0P2PMessage::mutable_w_bin(int index) {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w_bin)
+  return w_bin_.Mutable(index);
 }
-inline ::safeheron::proto::LinearCombinationProof* Round5BCMessage::_internal_mutable_lc_proof_vrg() {
-  
-  if (lc_proof_vrg_ == nullptr) {
-    auto* p = CreateMaybeMessage<::safeheron::proto::LinearCombinationProof>(GetArenaForAllocation());
-    lc_proof_vrg_ = p;
-  }
-  return lc_proof_vrg_;
+inline void BatchRound0P2PMessage::set_w_bin(int index, const std::string& value) {
+  w_bin_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w_bin)
 }
-inline ::safeheron::proto::LinearCombinationProof* Round5BCMessage::mutable_lc_proof_vrg() {
-  ::safeheron::proto::LinearCombinationProof* _msg = _internal_mutable_lc_proof_vrg();
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round5BCMessage.lc_proof_VRG)
-  return _msg;
+inline void BatchRound0P2PMessage::set_w_bin(int index, std::string&& value) {
+  w_bin_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w_bin)
 }
-inline void Round5BCMessage::set_allocated_lc_proof_vrg(::safeheron::proto::LinearCombinationProof* lc_proof_vrg) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(lc_proof_vrg_);
-  }
-  if (lc_proof_vrg) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(lc_proof_vrg));
-    if (message_arena != submessage_arena) {
-      lc_proof_vrg = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, lc_proof_vrg, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  lc_proof_vrg_ = lc_proof_vrg;
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round5BCMessage.lc_proof_VRG)
+inline void BatchRound0P2PMessage::set_w_bin(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  w_bin_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w_bin)
+}
+inline void BatchRound0P2PMessage::set_w_bin(int index, const void* value, size_t size) {
+  w_bin_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w_bin)
+}
+inline std::string* BatchRound0P2PMessage::_internal_add_w_bin() {
+  return w_bin_.Add();
+}
+inline void BatchRound0P2PMessage::add_w_bin(const std::string& value) {
+  w_bin_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w_bin)
+}
+inline void BatchRound0P2PMessage::add_w_bin(std::string&& value) {
+  w_bin_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w_bin)
+}
+inline void BatchRound0P2PMessage::add_w_bin(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  w_bin_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w_bin)
+}
+inline void BatchRound0P2PMessage::add_w_bin(const void* value, size_t size) {
+  w_bin_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w_bin)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+BatchRound0P2PMessage::w_bin() const {
+  // @@protoc_insertion_point(field_list:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w_bin)
+  return w_bin_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+BatchRound0P2PMessage::mutable_w_bin() {
+  // @@protoc_insertion_point(field_mutable_list:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.w_bin)
+  return &w_bin_;
 }
 
-// .safeheron.proto.DLogProof_V2 dlog_proof_rho = 6;
-inline bool Round5BCMessage::_internal_has_dlog_proof_rho() const {
-  return this != internal_default_instance() && dlog_proof_rho_ != nullptr;
+// repeated bytes k_bin = 5;
+inline int BatchRound0P2PMessage::_internal_k_bin_size() const {
+  return k_bin_.size();
 }
-inline bool Round5BCMessage::has_dlog_proof_rho() const {
-  return _internal_has_dlog_proof_rho();
+inline int BatchRound0P2PMessage::k_bin_size() const {
+  return _internal_k_bin_size();
 }
-inline const ::safeheron::proto::DLogProof_V2& Round5BCMessage::_internal_dlog_proof_rho() const {
-  const ::safeheron::proto::DLogProof_V2* p = dlog_proof_rho_;
-  return p != nullptr ? *p : reinterpret_cast<const ::safeheron::proto::DLogProof_V2&>(
-      ::safeheron::proto::_DLogProof_V2_default_instance_);
+inline void BatchRound0P2PMessage::clear_k_bin() {
+  k_bin_.Clear();
 }
-inline const ::safeheron::proto::DLogProof_V2& Round5BCMessage::dlog_proof_rho() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round5BCMessage.dlog_proof_rho)
-  return _internal_dlog_proof_rho();
+inline std::string* BatchRound0P2PMessage::add_k_bin() {
+  std::string* _s = _internal_add_k_bin();
+  // @@protoc_insertion_point(field_add_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k_bin)
+  return _s;
 }
-inline void Round5BCMessage::unsafe_arena_set_allocated_dlog_proof_rho(
-    ::safeheron::proto::DLogProof_V2* dlog_proof_rho) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(dlog_proof_rho_);
-  }
-  dlog_proof_rho_ = dlog_proof_rho;
-  if (dlog_proof_rho) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round5BCMessage.dlog_proof_rho)
+inline const std::string& BatchRound0P2PMessage::_internal_k_bin(int index) const {
+  return k_bin_.Get(index);
 }
-inline ::safeheron::proto::DLogProof_V2* Round5BCMessage::release_dlog_proof_rho() {
-  
-  ::safeheron::proto::DLogProof_V2* temp = dlog_proof_rho_;
-  dlog_proof_rho_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+inline const std::string& BatchRound0P2PMessage::k_bin(int index) const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k_bin)
+  return _internal_k_bin(index);
 }
-inline ::safeheron::proto::DLogProof_V2* Round5BCMessage::unsafe_arena_release_dlog_proof_rho() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round5BCMessage.dlog_proof_rho)
-  
-  ::safeheron::proto::DLogProof_V2* temp = dlog_proof_rho_;
-  dlog_proof_rho_ = nullptr;
-  return temp;
+inline std::string* BatchRound0P2PMessage::mutable_k_bin(int index) {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k_bin)
+  return k_bin_.Mutable(index);
 }
-inline ::safeheron::proto::DLogProof_V2* Round5BCMessage::_internal_mutable_dlog_proof_rho() {
-  
-  if (dlog_proof_rho_ == nullptr) {
-    auto* p = CreateMaybeMessage<::safeheron::proto::DLogProof_V2>(GetArenaForAllocation());
-    dlog_proof_rho_ = p;
-  }
-  return dlog_proof_rho_;
+inline void BatchRound0P2PMessage::set_k_bin(int index, const std::string& value) {
+  k_bin_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k_bin)
 }
-inline ::safeheron::proto::DLogProof_V2* Round5BCMessage::mutable_dlog_proof_rho() {
-  ::safeheron::proto::DLogProof_V2* _msg = _internal_mutable_dlog_proof_rho();
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round5BCMessage.dlog_proof_rho)
-  return _msg;
+inline void BatchRound0P2PMessage::set_k_bin(int index, std::string&& value) {
+  k_bin_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k_bin)
 }
-inline void Round5BCMessage::set_allocated_dlog_proof_rho(::safeheron::proto::DLogProof_V2* dlog_proof_rho) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(dlog_proof_rho_);
-  }
-  if (dlog_proof_rho) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(dlog_proof_rho));
-    if (message_arena != submessage_arena) {
-      dlog_proof_rho = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, dlog_proof_rho, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  dlog_proof_rho_ = dlog_proof_rho;
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round5BCMessage.dlog_proof_rho)
+inline void BatchRound0P2PMessage::set_k_bin(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  k_bin_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k_bin)
+}
+inline void BatchRound0P2PMessage::set_k_bin(int index, const void* value, size_t size) {
+  k_bin_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k_bin)
+}
+inline std::string* BatchRound0P2PMessage::_internal_add_k_bin() {
+  return k_bin_.Add();
+}
+inline void BatchRound0P2PMessage::add_k_bin(const std::string& value) {
+  k_bin_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k_bin)
+}
+inline void BatchRound0P2PMessage::add_k_bin(std::string&& value) {
+  k_bin_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k_bin)
+}
+inline void BatchRound0P2PMessage::add_k_bin(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  k_bin_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k_bin)
+}
+inline void BatchRound0P2PMessage::add_k_bin(const void* value, size_t size) {
+  k_bin_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k_bin)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+BatchRound0P2PMessage::k_bin() const {
+  // @@protoc_insertion_point(field_list:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k_bin)
+  return k_bin_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+BatchRound0P2PMessage::mutable_k_bin() {
+  // @@protoc_insertion_point(field_mutable_list:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.k_bin)
+  return &k_bin_;
+}
+
+// repeated bytes phi_bin = 6;
+inline int BatchRound0P2PMessage::_internal_phi_bin_size() const {
+  return phi_bin_.size();
+}
+inline int BatchRound0P2PMessage::phi_bin_size() const {
+  return _internal_phi_bin_size();
+}
+inline void BatchRound0P2PMessage::clear_phi_bin() {
+  phi_bin_.Clear();
+}
+inline std::string* BatchRound0P2PMessage::add_phi_bin() {
+  std::string* _s = _internal_add_phi_bin();
+  // @@protoc_insertion_point(field_add_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi_bin)
+  return _s;
+}
+inline const std::string& BatchRound0P2PMessage::_internal_phi_bin(int index) const {
+  return phi_bin_.Get(index);
+}
+inline const std::string& BatchRound0P2PMessage::phi_bin(int index) const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi_bin)
+  return _internal_phi_bin(index);
+}
+inline std::string* BatchRound0P2PMessage::mutable_phi_bin(int index) {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi_bin)
+  return phi_bin_.Mutable(index);
+}
+inline void BatchRound0P2PMessage::set_phi_bin(int index, const std::string& value) {
+  phi_bin_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi_bin)
+}
+inline void BatchRound0P2PMessage::set_phi_bin(int index, std::string&& value) {
+  phi_bin_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi_bin)
+}
+inline void BatchRound0P2PMessage::set_phi_bin(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  phi_bin_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi_bin)
+}
+inline void BatchRound0P2PMessage::set_phi_bin(int index, const void* value, size_t size) {
+  phi_bin_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi_bin)
+}
+inline std::string* BatchRound0P2PMessage::_internal_add_phi_bin() {
+  return phi_bin_.Add();
+}
+inline void BatchRound0P2PMessage::add_phi_bin(const std::string& value) {
+  phi_bin_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi_bin)
+}
+inline void BatchRound0P2PMessage::add_phi_bin(std::string&& value) {
+  phi_bin_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi_bin)
+}
+inline void BatchRound0P2PMessage::add_phi_bin(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  phi_bin_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi_bin)
+}
+inline void BatchRound0P2PMessage::add_phi_bin(const void* value, size_t size) {
+  phi_bin_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi_bin)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+BatchRound0P2PMessage::phi_bin() const {
+  // @@protoc_insertion_point(field_list:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi_bin)
+  return phi_bin_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+BatchRound0P2PMessage::mutable_phi_bin() {
+  // @@protoc_insertion_point(field_mutable_list:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound0P2PMessage.phi_bin)
+  return &phi_bin_;
 }
 
 // -------------------------------------------------------------------
 
-// Round6BCMessage
+// BatchRound1BCMessage
 
-// string commitment = 1;
-inline void Round6BCMessage::clear_commitment() {
-  commitment_.ClearToEmpty();
+// repeated string delta = 1;
+inline int BatchRound1BCMessage::_internal_delta_size() const {
+  return delta_.size();
 }
-inline const std::string& Round6BCMessage::commitment() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round6BCMessage.commitment)
-  return _internal_commitment();
+inline int BatchRound1BCMessage::delta_size() const {
+  return _internal_delta_size();
 }
-template <typename ArgT0, typename... ArgT>
-inline PROTOBUF_ALWAYS_INLINE
-void Round6BCMessage::set_commitment(ArgT0&& arg0, ArgT... args) {
- 
- commitment_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.Round6BCMessage.commitment)
+inline void BatchRound1BCMessage::clear_delta() {
+  delta_.Clear();
 }
-inline std::string* Round6BCMessage::mutable_commitment() {
-  std::string* _s = _internal_mutable_commitment();
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round6BCMessage.commitment)
+inline std::string* BatchRound1BCMessage::add_delta() {
+  std::string* _s = _internal_add_delta();
+  // @@protoc_insertion_point(field_add_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta)
   return _s;
 }
-inline const std::string& Round6BCMessage::_internal_commitment() const {
-  return commitment_.Get();
+inline const std::string& BatchRound1BCMessage::_internal_delta(int index) const {
+  return delta_.Get(index);
 }
-inline void Round6BCMessage::_internal_set_commitment(const std::string& value) {
-  
-  commitment_.Set(value, GetArenaForAllocation());
+inline const std::string& BatchRound1BCMessage::delta(int index) const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta)
+  return _internal_delta(index);
 }
-inline std::string* Round6BCMessage::_internal_mutable_commitment() {
-  
-  return commitment_.Mutable(GetArenaForAllocation());
+inline std::string* BatchRound1BCMessage::mutable_delta(int index) {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta)
+  return delta_.Mutable(index);
 }
-inline std::string* Round6BCMessage::release_commitment() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round6BCMessage.commitment)
-  return commitment_.Release();
+inline void BatchRound1BCMessage::set_delta(int index, const std::string& value) {
+  delta_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta)
 }
-inline void Round6BCMessage::set_allocated_commitment(std::string* commitment) {
-  if (commitment != nullptr) {
-    
-  } else {
-    
-  }
-  commitment_.SetAllocated(commitment, GetArenaForAllocation());
-#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (commitment_.IsDefault()) {
-    commitment_.Set("", GetArenaForAllocation());
-  }
-#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round6BCMessage.commitment)
+inline void BatchRound1BCMessage::set_delta(int index, std::string&& value) {
+  delta_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta)
+}
+inline void BatchRound1BCMessage::set_delta(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  delta_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta)
+}
+inline void BatchRound1BCMessage::set_delta(int index, const char* value, size_t size) {
+  delta_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta)
+}
+inline std::string* BatchRound1BCMessage::_internal_add_delta() {
+  return delta_.Add();
+}
+inline void BatchRound1BCMessage::add_delta(const std::string& value) {
+  delta_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta)
+}
+inline void BatchRound1BCMessage::add_delta(std::string&& value) {
+  delta_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta)
+}
+inline void BatchRound1BCMessage::add_delta(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  delta_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta)
+}
+inline void BatchRound1BCMessage::add_delta(const char* value, size_t size) {
+  delta_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+BatchRound1BCMessage::delta() const {
+  // @@protoc_insertion_point(field_list:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta)
+  return delta_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+BatchRound1BCMessage::mutable_delta() {
+  // @@protoc_insertion_point(field_mutable_list:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta)
+  return &delta_;
+}
+
+// repeated string v = 2;
+inline int BatchRound1BCMessage::_internal_v_size() const {
+  return v_.size();
+}
+inline int BatchRound1BCMessage::v_size() const {
+  return _internal_v_size();
+}
+inline void BatchRound1BCMessage::clear_v() {
+  v_.Clear();
+}
+inline std::string* BatchRound1BCMessage::add_v() {
+  std::string* _s = _internal_add_v();
+  // @@protoc_insertion_point(field_add_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v)
+  return _s;
+}
+inline const std::string& BatchRound1BCMessage::_internal_v(int index) const {
+  return v_.Get(index);
+}
+inline const std::string& BatchRound1BCMessage::v(int index) const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v)
+  return _internal_v(index);
+}
+inline std::string* BatchRound1BCMessage::mutable_v(int index) {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v)
+  return v_.Mutable(index);
+}
+inline void BatchRound1BCMessage::set_v(int index, const std::string& value) {
+  v_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v)
+}
+inline void BatchRound1BCMessage::set_v(int index, std::string&& value) {
+  v_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v)
+}
+inline void BatchRound1BCMessage::set_v(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  v_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v)
+}
+inline void BatchRound1BCMessage::set_v(int index, const char* value, size_t size) {
+  v_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v)
+}
+inline std::string* BatchRound1BCMessage::_internal_add_v() {
+  return v_.Add();
+}
+inline void BatchRound1BCMessage::add_v(const std::string& value) {
+  v_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v)
+}
+inline void BatchRound1BCMessage::add_v(std::string&& value) {
+  v_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v)
+}
+inline void BatchRound1BCMessage::add_v(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  v_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v)
+}
+inline void BatchRound1BCMessage::add_v(const char* value, size_t size) {
+  v_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+BatchRound1BCMessage::v() const {
+  // @@protoc_insertion_point(field_list:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v)
+  return v_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+BatchRound1BCMessage::mutable_v() {
+  // @@protoc_insertion_point(field_mutable_list:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v)
+  return &v_;
+}
+
+// repeated bytes delta_bin = 3;
+inline int BatchRound1BCMessage::_internal_delta_bin_size() const {
+  return delta_bin_.size();
+}
+inline int BatchRound1BCMessage::delta_bin_size() const {
+  return _internal_delta_bin_size();
+}
+inline void BatchRound1BCMessage::clear_delta_bin() {
+  delta_bin_.Clear();
+}
+inline std::string* BatchRound1BCMessage::add_delta_bin() {
+  std::string* _s = _internal_add_delta_bin();
+  // @@protoc_insertion_point(field_add_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta_bin)
+  return _s;
+}
+inline const std::string& BatchRound1BCMessage::_internal_delta_bin(int index) const {
+  return delta_bin_.Get(index);
+}
+inline const std::string& BatchRound1BCMessage::delta_bin(int index) const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta_bin)
+  return _internal_delta_bin(index);
+}
+inline std::string* BatchRound1BCMessage::mutable_delta_bin(int index) {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta_bin)
+  return delta_bin_.Mutable(index);
+}
+inline void BatchRound1BCMessage::set_delta_bin(int index, const std::string& value) {
+  delta_bin_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta_bin)
+}
+inline void BatchRound1BCMessage::set_delta_bin(int index, std::string&& value) {
+  delta_bin_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta_bin)
+}
+inline void BatchRound1BCMessage::set_delta_bin(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  delta_bin_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta_bin)
+}
+inline void BatchRound1BCMessage::set_delta_bin(int index, const void* value, size_t size) {
+  delta_bin_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta_bin)
+}
+inline std::string* BatchRound1BCMessage::_internal_add_delta_bin() {
+  return delta_bin_.Add();
+}
+inline void BatchRound1BCMessage::add_delta_bin(const std::string& value) {
+  delta_bin_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta_bin)
+}
+inline void BatchRound1BCMessage::add_delta_bin(std::string&& value) {
+  delta_bin_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta_bin)
+}
+inline void BatchRound1BCMessage::add_delta_bin(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  delta_bin_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta_bin)
+}
+inline void BatchRound1BCMessage::add_delta_bin(const void* value, size_t size) {
+  delta_bin_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta_bin)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+BatchRound1BCMessage::delta_bin() const {
+  // @@protoc_insertion_point(field_list:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta_bin)
+  return delta_bin_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+BatchRound1BCMessage::mutable_delta_bin() {
+  // @@protoc_insertion_point(field_mutable_list:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.delta_bin)
+  return &delta_bin_;
+}
+
+// repeated bytes v_bin = 4;
+inline int BatchRound1BCMessage::_internal_v_bin_size() const {
+  return v_bin_.size();
+}
+inline int BatchRound1BCMessage::v_bin_size() const {
+  return _internal_v_bin_size();
+}
+inline void BatchRound1BCMessage::clear_v_bin() {
+  v_bin_.Clear();
+}
+inline std::string* BatchRound1BCMessage::add_v_bin() {
+  std::string* _s = _internal_add_v_bin();
+  // @@protoc_insertion_point(field_add_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v_bin)
+  return _s;
+}
+inline const std::string& BatchRound1BCMessage::_internal_v_bin(int index) const {
+  return v_bin_.Get(index);
+}
+inline const std::string& BatchRound1BCMessage::v_bin(int index) const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v_bin)
+  return _internal_v_bin(index);
+}
+inline std::string* BatchRound1BCMessage::mutable_v_bin(int index) {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v_bin)
+  return v_bin_.Mutable(index);
+}
+inline void BatchRound1BCMessage::set_v_bin(int index, const std::string& value) {
+  v_bin_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v_bin)
+}
+inline void BatchRound1BCMessage::set_v_bin(int index, std::string&& value) {
+  v_bin_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v_bin)
+}
+inline void BatchRound1BCMessage::set_v_bin(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  v_bin_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v_bin)
+}
+inline void BatchRound1BCMessage::set_v_bin(int index, const void* value, size_t size) {
+  v_bin_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v_bin)
+}
+inline std::string* BatchRound1BCMessage::_internal_add_v_bin() {
+  return v_bin_.Add();
+}
+inline void BatchRound1BCMessage::add_v_bin(const std::string& value) {
+  v_bin_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v_bin)
+}
+inline void BatchRound1BCMessage::add_v_bin(std::string&& value) {
+  v_bin_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v_bin)
+}
+inline void BatchRound1BCMessage::add_v_bin(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  v_bin_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v_bin)
+}
+inline void BatchRound1BCMessage::add_v_bin(const void* value, size_t size) {
+  v_bin_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v_bin)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+BatchRound1BCMessage::v_bin() const {
+  // @@protoc_insertion_point(field_list:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v_bin)
+  return v_bin_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+BatchRound1BCMessage::mutable_v_bin() {
+  // @@protoc_insertion_point(field_mutable_list:safeheron.proto.multi_party_ecdsa.Li24.sign.BatchRound1BCMessage.v_bin)
+  return &v_bin_;
 }
 
 // -------------------------------------------------------------------
 
-// Round7BCMessage
+// PresignRound1BCMessage
 
-// .safeheron.proto.CurvePoint U = 1;
-inline bool Round7BCMessage::_internal_has_u() const {
-  return this != internal_default_instance() && u_ != nullptr;
+// repeated string v = 1;
+inline int PresignRound1BCMessage::_internal_v_size() const {
+  return v_.size();
 }
-inline bool Round7BCMessage::has_u() const {
-  return _internal_has_u();
+inline int PresignRound1BCMessage::v_size() const {
+  return _internal_v_size();
 }
-inline const ::safeheron::proto::CurvePoint& Round7BCMessage::_internal_u() const {
-  const ::safeheron::proto::CurvePoint* p = u_;
-  return p != nullptr ? *p : reinterpret_cast<const ::safeheron::proto::CurvePoint&>(
-      ::safeheron::proto::_CurvePoint_default_instance_);
+inline void PresignRound1BCMessage::clear_v() {
+  v_.Clear();
 }
-inline const ::safeheron::proto::CurvePoint& Round7BCMessage::u() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round7BCMessage.U)
-  return _internal_u();
+inline std::string* PresignRound1BCMessage::add_v() {
+  std::string* _s = _internal_add_v();
+  // @@protoc_insertion_point(field_add_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v)
+  return _s;
 }
-inline void Round7BCMessage::unsafe_arena_set_allocated_u(
-    ::safeheron::proto::CurvePoint* u) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(u_);
-  }
-  u_ = u;
-  if (u) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round7BCMessage.U)
+inline const std::string& PresignRound1BCMessage::_internal_v(int index) const {
+  return v_.Get(index);
 }
-inline ::safeheron::proto::CurvePoint* Round7BCMessage::release_u() {
-  
-  ::safeheron::proto::CurvePoint* temp = u_;
-  u_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+inline const std::string& PresignRound1BCMessage::v(int index) const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v)
+  return _internal_v(index);
+}
+inline std::string* PresignRound1BCMessage::mutable_v(int index) {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v)
+  return v_.Mutable(index);
+}
+inline void PresignRound1BCMessage::set_v(int index, const std::string& value) {
+  v_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v)
+}
+inline void PresignRound1BCMessage::set_v(int index, std::string&& value) {
+  v_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v)
+}
+inline void PresignRound1BCMessage::set_v(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  v_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v)
+}
+inline void PresignRound1BCMessage::set_v(int index, const char* value, size_t size) {
+  v_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v)
+}
+inline std::string* PresignRound1BCMessage::_internal_add_v() {
+  return v_.Add();
+}
+inline void PresignRound1BCMessage::add_v(const std::string& value) {
+  v_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v)
+}
+inline void PresignRound1BCMessage::add_v(std::string&& value) {
+  v_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v)
+}
+inline void PresignRound1BCMessage::add_v(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  v_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v)
+}
+inline void PresignRound1BCMessage::add_v(const char* value, size_t size) {
+  v_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+PresignRound1BCMessage::v() const {
+  // @@protoc_insertion_point(field_list:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v)
+  return v_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+PresignRound1BCMessage::mutable_v() {
+  // @@protoc_insertion_point(field_mutable_list:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v)
+  return &v_;
+}
+
+// repeated bytes v_bin = 2;
+inline int PresignRound1BCMessage::_internal_v_bin_size() const {
+  return v_bin_.size();
+}
+inline int PresignRound1BCMessage::v_bin_size() const {
+  return _internal_v_bin_size();
+}
+inline void PresignRound1BCMessage::clear_v_bin() {
+  v_bin_.Clear();
+}
+inline std::string* PresignRound1BCMessage::add_v_bin() {
+  std::string* _s = _internal_add_v_bin();
+  // @@protoc_insertion_point(field_add_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v_bin)
+  return _s;
+}
+inline const std::string& PresignRound1BCMessage::_internal_v_bin(int index) const {
+  return v_bin_.Get(index);
+}
+inline const std::string& PresignRound1BCMessage::v_bin(int index) const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v_bin)
+  return _internal_v_bin(index);
+}
+inline std::string* PresignRound1BCMessage::mutable_v_bin(int index) {
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v_bin)
+  return v_bin_.Mutable(index);
+}
+inline void PresignRound1BCMessage::set_v_bin(int index, const std::string& value) {
+  v_bin_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v_bin)
+}
+inline void PresignRound1BCMessage::set_v_bin(int index, std::string&& value) {
+  v_bin_.Mutable(index)->assign(std::move(value));
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v_bin)
+}
+inline void PresignRound1BCMessage::set_v_bin(int index, const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  v_bin_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v_bin)
+}
+inline void PresignRound1BCMessage::set_v_bin(int index, const void* value, size_t size) {
+  v_bin_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v_bin)
+}
+inline std::string* PresignRound1BCMessage::_internal_add_v_bin() {
+  return v_bin_.Add();
 }
-inline ::safeheron::proto::CurvePoint* Round7BCMessage::unsafe_arena_release_u() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round7BCMessage.U)
+inline void PresignRound1BCMessage::add_v_bin(const std::string& value) {
+  v_bin_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v_bin)
+}
+inline void PresignRound1BCMessage::add_v_bin(std::string&& value) {
+  v_bin_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v_bin)
+}
+inline void PresignRound1BCMessage::add_v_bin(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  v_bin_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v_bin)
+}
+inline void PresignRound1BCMessage::add_v_bin(const void* value, size_t size) {
+  v_bin_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v_bin)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>&
+PresignRound1BCMessage::v_bin() const {
+  // @@protoc_insertion_point(field_list:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v_bin)
+  return v_bin_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField<std::string>*
+PresignRound1BCMessage::mutable_v_bin() {
+  // @@protoc_insertion_point(field_mutable_list:safeheron.proto.multi_party_ecdsa.Li24.sign.PresignRound1BCMessage.v_bin)
+  return &v_bin_;
+}
+
+// -------------------------------------------------------------------
+
+// OnlineRound0BCMessage
+
+// string r = 1;
+inline void OnlineRound0BCMessage::clear_r() {
+  r_.ClearToEmpty();
+}
+inline const std::string& OnlineRound0BCMessage::r() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.r)
+  return _internal_r();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void OnlineRound0BCMessage::set_r(ArgT0&& arg0, ArgT... args) {
+ 
+ r_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.r)
+}
+inline std::string* OnlineRound0BCMessage::mutable_r() {
+  std::string* _s = _internal_mutable_r();
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.r)
+  return _s;
+}
+inline const std::string& OnlineRound0BCMessage::_internal_r() const {
+  return r_.Get();
+}
+inline void OnlineRound0BCMessage::_internal_set_r(const std::string& value) {
   
-  ::safeheron::proto::CurvePoint* temp = u_;
-  u_ = nullptr;
-  return temp;
+  r_.Set(value, GetArenaForAllocation());
 }
-inline ::safeheron::proto::CurvePoint* Round7BCMessage::_internal_mutable_u() {
+inline std::string* OnlineRound0BCMessage::_internal_mutable_r() {
   
-  if (u_ == nullptr) {
-    auto* p = CreateMaybeMessage<::safeheron::proto::CurvePoint>(GetArenaForAllocation());
-    u_ = p;
-  }
-  return u_;
+  return r_.Mutable(GetArenaForAllocation());
 }
-inline ::safeheron::proto::CurvePoint* Round7BCMessage::mutable_u() {
-  ::safeheron::proto::CurvePoint* _msg = _internal_mutable_u();
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round7BCMessage.U)
-  return _msg;
+inline std::string* OnlineRound0BCMessage::release_r() {
+  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.r)
+  return r_.Release();
 }
-inline void Round7BCMessage::set_allocated_u(::safeheron::proto::CurvePoint* u) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(u_);
-  }
-  if (u) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(u));
-    if (message_arena != submessage_arena) {
-      u = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, u, submessage_arena);
-    }
+inline void OnlineRound0BCMessage::set_allocated_r(std::string* r) {
+  if (r != nullptr) {
     
   } else {
     
   }
-  u_ = u;
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round7BCMessage.U)
+  r_.SetAllocated(r, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (r_.IsDefault()) {
+    r_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.r)
 }
 
-// .safeheron.proto.CurvePoint T = 2;
-inline bool Round7BCMessage::_internal_has_t() const {
-  return this != internal_default_instance() && t_ != nullptr;
-}
-inline bool Round7BCMessage::has_t() const {
-  return _internal_has_t();
+// string delta = 2;
+inline void OnlineRound0BCMessage::clear_delta() {
+  delta_.ClearToEmpty();
 }
-inline const ::safeheron::proto::CurvePoint& Round7BCMessage::_internal_t() const {
-  const ::safeheron::proto::CurvePoint* p = t_;
-  return p != nullptr ? *p : reinterpret_cast<const ::safeheron::proto::CurvePoint&>(
-      ::safeheron::proto::_CurvePoint_default_instance_);
+inline const std::string& OnlineRound0BCMessage::delta() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.delta)
+  return _internal_delta();
 }
-inline const ::safeheron::proto::CurvePoint& Round7BCMessage::t() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round7BCMessage.T)
-  return _internal_t();
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void OnlineRound0BCMessage::set_delta(ArgT0&& arg0, ArgT... args) {
+ 
+ delta_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.delta)
 }
-inline void Round7BCMessage::unsafe_arena_set_allocated_t(
-    ::safeheron::proto::CurvePoint* t) {
-  if (GetArenaForAllocation() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(t_);
-  }
-  t_ = t;
-  if (t) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round7BCMessage.T)
+inline std::string* OnlineRound0BCMessage::mutable_delta() {
+  std::string* _s = _internal_mutable_delta();
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.delta)
+  return _s;
 }
-inline ::safeheron::proto::CurvePoint* Round7BCMessage::release_t() {
-  
-  ::safeheron::proto::CurvePoint* temp = t_;
-  t_ = nullptr;
-#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
-  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
-  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  if (GetArenaForAllocation() == nullptr) { delete old; }
-#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
-  if (GetArenaForAllocation() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
-  return temp;
+inline const std::string& OnlineRound0BCMessage::_internal_delta() const {
+  return delta_.Get();
 }
-inline ::safeheron::proto::CurvePoint* Round7BCMessage::unsafe_arena_release_t() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round7BCMessage.T)
+inline void OnlineRound0BCMessage::_internal_set_delta(const std::string& value) {
   
-  ::safeheron::proto::CurvePoint* temp = t_;
-  t_ = nullptr;
-  return temp;
+  delta_.Set(value, GetArenaForAllocation());
 }
-inline ::safeheron::proto::CurvePoint* Round7BCMessage::_internal_mutable_t() {
+inline std::string* OnlineRound0BCMessage::_internal_mutable_delta() {
   
-  if (t_ == nullptr) {
-    auto* p = CreateMaybeMessage<::safeheron::proto::CurvePoint>(GetArenaForAllocation());
-    t_ = p;
-  }
-  return t_;
+  return delta_.Mutable(GetArenaForAllocation());
 }
-inline ::safeheron::proto::CurvePoint* Round7BCMessage::mutable_t() {
-  ::safeheron::proto::CurvePoint* _msg = _internal_mutable_t();
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round7BCMessage.T)
-  return _msg;
+inline std::string* OnlineRound0BCMessage::release_delta() {
+  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.delta)
+  return delta_.Release();
 }
-inline void Round7BCMessage::set_allocated_t(::safeheron::proto::CurvePoint* t) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
-  if (message_arena == nullptr) {
-    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(t_);
-  }
-  if (t) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
-                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(t));
-    if (message_arena != submessage_arena) {
-      t = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, t, submessage_arena);
-    }
+inline void OnlineRound0BCMessage::set_allocated_delta(std::string* delta) {
+  if (delta != nullptr) {
     
   } else {
     
   }
-  t_ = t;
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round7BCMessage.T)
+  delta_.SetAllocated(delta, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (delta_.IsDefault()) {
+    delta_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.delta)
 }
 
-// string blind_factor = 3;
-inline void Round7BCMessage::clear_blind_factor() {
-  blind_factor_.ClearToEmpty();
+// bytes r_bin = 3;
+inline void OnlineRound0BCMessage::clear_r_bin() {
+  r_bin_.ClearToEmpty();
 }
-inline const std::string& Round7BCMessage::blind_factor() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round7BCMessage.blind_factor)
-  return _internal_blind_factor();
+inline const std::string& OnlineRound0BCMessage::r_bin() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.r_bin)
+  return _internal_r_bin();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void Round7BCMessage::set_blind_factor(ArgT0&& arg0, ArgT... args) {
+void OnlineRound0BCMessage::set_r_bin(ArgT0&& arg0, ArgT... args) {
  
- blind_factor_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.Round7BCMessage.blind_factor)
+ r_bin_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.r_bin)
 }
-inline std::string* Round7BCMessage::mutable_blind_factor() {
-  std::string* _s = _internal_mutable_blind_factor();
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round7BCMessage.blind_factor)
+inline std::string* OnlineRound0BCMessage::mutable_r_bin() {
+  std::string* _s = _internal_mutable_r_bin();
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.r_bin)
   return _s;
 }
-inline const std::string& Round7BCMessage::_internal_blind_factor() const {
-  return blind_factor_.Get();
+inline const std::string& OnlineRound0BCMessage::_internal_r_bin() const {
+  return r_bin_.Get();
 }
-inline void Round7BCMessage::_internal_set_blind_factor(const std::string& value) {
+inline void OnlineRound0BCMessage::_internal_set_r_bin(const std::string& value) {
   
-  blind_factor_.Set(value, GetArenaForAllocation());
+  r_bin_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Round7BCMessage::_internal_mutable_blind_factor() {
+inline std::string* OnlineRound0BCMessage::_internal_mutable_r_bin() {
   
-  return blind_factor_.Mutable(GetArenaForAllocation());
+  return r_bin_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Round7BCMessage::release_blind_factor() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round7BCMessage.blind_factor)
-  return blind_factor_.Release();
+inline std::string* OnlineRound0BCMessage::release_r_bin() {
+  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.r_bin)
+  return r_bin_.Release();
 }
-inline void Round7BCMessage::set_allocated_blind_factor(std::string* blind_factor) {
-  if (blind_factor != nullptr) {
+inline void OnlineRound0BCMessage::set_allocated_r_bin(std::string* r_bin) {
+  if (r_bin != nullptr) {
     
   } else {
     
   }
-  blind_factor_.SetAllocated(blind_factor, GetArenaForAllocation());
+  r_bin_.SetAllocated(r_bin, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (blind_factor_.IsDefault()) {
-    blind_factor_.Set("", GetArenaForAllocation());
+  if (r_bin_.IsDefault()) {
+    r_bin_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round7BCMessage.blind_factor)
+  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.r_bin)
 }
 
-// -------------------------------------------------------------------
-
-// Round8BCMessage
-
-// string si = 1;
-inline void Round8BCMessage::clear_si() {
-  si_.ClearToEmpty();
+// bytes delta_bin = 4;
+inline void OnlineRound0BCMessage::clear_delta_bin() {
+  delta_bin_.ClearToEmpty();
 }
-inline const std::string& Round8BCMessage::si() const {
-  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.Round8BCMessage.si)
-  return _internal_si();
+inline const std::string& OnlineRound0BCMessage::delta_bin() const {
+  // @@protoc_insertion_point(field_get:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.delta_bin)
+  return _internal_delta_bin();
 }
 template <typename ArgT0, typename... ArgT>
 inline PROTOBUF_ALWAYS_INLINE
-void Round8BCMessage::set_si(ArgT0&& arg0, ArgT... args) {
+void OnlineRound0BCMessage::set_delta_bin(ArgT0&& arg0, ArgT... args) {
  
- si_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
-  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.Round8BCMessage.si)
+ delta_bin_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.delta_bin)
 }
-inline std::string* Round8BCMessage::mutable_si() {
-  std::string* _s = _internal_mutable_si();
-  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.Round8BCMessage.si)
+inline std::string* OnlineRound0BCMessage::mutable_delta_bin() {
+  std::string* _s = _internal_mutable_delta_bin();
+  // @@protoc_insertion_point(field_mutable:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.delta_bin)
   return _s;
 }
-inline const std::string& Round8BCMessage::_internal_si() const {
-  return si_.Get();
+inline const std::string& OnlineRound0BCMessage::_internal_delta_bin() const {
+  return delta_bin_.Get();
 }
-inline void Round8BCMessage::_internal_set_si(const std::string& value) {
+inline void OnlineRound0BCMessage::_internal_set_delta_bin(const std::string& value) {
   
-  si_.Set(value, GetArenaForAllocation());
+  delta_bin_.Set(value, GetArenaForAllocation());
 }
-inline std::string* Round8BCMessage::_internal_mutable_si() {
+inline std::string* OnlineRound0BCMessage::_internal_mutable_delta_bin() {
   
-  return si_.Mutable(GetArenaForAllocation());
+  return delta_bin_.Mutable(GetArenaForAllocation());
 }
-inline std::string* Round8BCMessage::release_si() {
-  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.Round8BCMessage.si)
-  return si_.Release();
+inline std::string* OnlineRound0BCMessage::release_delta_bin() {
+  // @@protoc_insertion_point(field_release:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.delta_bin)
+  return delta_bin_.Release();
 }
-inline void Round8BCMessage::set_allocated_si(std::string* si) {
-  if (si != nullptr) {
+inline void OnlineRound0BCMessage::set_allocated_delta_bin(std::string* delta_bin) {
+  if (delta_bin != nullptr) {
     
   } else {
     
   }
-  si_.SetAllocated(si, GetArenaForAllocation());
+  delta_bin_.SetAllocated(delta_bin, GetArenaForAllocation());
 #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  if (si_.IsDefault()) {
-    si_.Set("", GetArenaForAllocation());
+  if (delta_bin_.IsDefault()) {
+    delta_bin_.Set("", GetArenaForAllocation());
   }
 #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
-  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.Round8BCMessage.si)
+  // @@protoc_insertion_point(field_set_allocated:safeheron.proto.multi_party_ecdsa.Li24.sign.OnlineRound0BCMessage.delta_bin)
 }
 
 #ifdef __GNUC__
@@ -3264,10 +3505,6 @@ inline void Round8BCMessage::set_allocated_si(std::string* si) {
 
 // -------------------------------------------------------------------
 
-// -------------------------------------------------------------------
-
-// -------------------------------------------------------------------
-
 
 // @@protoc_insertion_point(namespace_scope)
 
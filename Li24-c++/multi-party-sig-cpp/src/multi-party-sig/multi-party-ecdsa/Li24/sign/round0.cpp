@@ -12,6 +12,7 @@ using safeheron::curve::CurvePoint;
 using safeheron::curve::Curve;
 using safeheron::sss::Polynomial;
 using safeheron::multi_party_ecdsa::Li24::SignKey;
+using safeheron::multi_party_ecdsa::Li24::Quorum;
 
 static BN POW2_256 = BN(1) << 256;
 
@@ -20,98 +21,66 @@ namespace multi_party_ecdsa{
 namespace Li24{
 namespace sign{
 bool Round0::MakeP2PMessage(size_t start,size_t end,std::vector<std::string> &out_p2p_msg_arr)const {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     const SignKey &sign_key = ctx->sign_key_;
-    if (end < start)
-    {
-        for (size_t i = 0; i < sign_key.remote_parties_.size(); ++i) {
-            Round0P2PMessage p2p_message;
-            if(ctx->remote_party_indexes[i]<=end ||ctx->remote_party_indexes[i]>=start)
-            {
-                p2p_message.k_ = ctx->local_party_.k_;
-                p2p_message.w_ = ctx->local_party_.w_;
-                p2p_message.phi_ = ctx->local_party_.phi_;
-            }
-            else
-            {
-                p2p_message.k_ = BN(0);
-                p2p_message.w_ = BN(0);
-                p2p_message.phi_ = BN(0);
-            }
-            string base64;
-            bool ok = p2p_message.ToBase64(base64);
-            if (!ok) {
-                ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to encode to base64!");
-                return false;
-            }
-            out_p2p_msg_arr.push_back(base64);
+    // Peers of a key with the bytes encoding take an empty payload as zero, older peers need the zeros sent
+    bool sparse = (sign_key.wire_version_ == WireVersion::Bytes);
+
+    for (size_t i = 0; i < sign_key.remote_parties_.size(); ++i) {
+        size_t index = ctx->remote_party_indexes[i];
+        // The window [start, end] wraps around when end < start
+        bool in_window = (start <= end) ? (index >= start && index <= end) : (index >= start || index <= end);
+        if (!in_window && sparse) {
+            out_p2p_msg_arr.emplace_back();
+            continue;
         }
-    }
-    if (start <= end)
-    {
-        for (size_t i = 0; i < sign_key.remote_parties_.size(); ++i) {
-            Round0P2PMessage p2p_message;
-            if (ctx->remote_party_indexes[i]<=end && ctx->remote_party_indexes[i]>=start)
-            {
-                p2p_message.k_ = ctx->local_party_.k_;
-                p2p_message.w_ = ctx->local_party_.w_;
-                p2p_message.phi_ = ctx->local_party_.phi_;
-            }
-            else
-            {
-                p2p_message.k_ = BN(0);
-                p2p_message.w_ = BN(0);
-                p2p_message.phi_ = BN(0);
-            }
-            string base64;
-            bool ok = p2p_message.ToBase64(base64);
-            if (!ok) {
-                ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to encode to base64!");
-                return false;
-            }
-            out_p2p_msg_arr.push_back(base64);
+
+        Round0P2PMessage p2p_message;
+        p2p_message.wire_version_ = sign_key.wire_version_;
+        if (in_window) {
+            p2p_message.k_ = ctx->local_party_.k_;
+            p2p_message.w_ = ctx->local_party_.w_;
+            p2p_message.phi_ = ctx->local_party_.phi_;
+        } else {
+            p2p_message.k_ = BN(0);
+            p2p_message.w_ = BN(0);
+            p2p_message.phi_ = BN(0);
+        }
+        string base64;
+        bool ok = ctx->EncodeMessage(p2p_message, base64);
+        if (!ok) {
+            ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to encode the message!");
+            return false;
         }
+        out_p2p_msg_arr.push_back(base64);
     }
     return true;
 }
 bool Round0::ComputeVerify() {
     bool ok = true;
     // Validate child private key share
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const Curve * curv = GetCurveParam(sign_key.X_.GetCurveType());
 
-    // Compute w = x * lambda mod q
-    vector<BN> share_index_arr;
-    for (size_t i = 0; i < sign_key.remote_parties_.size(); ++i) {
-        share_index_arr.push_back(sign_key.remote_parties_[i].index_);
-        ctx->remote_party_indexes.emplace_back();
-    }
-    share_index_arr.push_back(sign_key.local_party_.index_);
-    vector<BN> &l_arr = ctx->local_party_.l_arr_;
-    Polynomial::GetLArray(l_arr, BN::ZERO, share_index_arr, curv->n);
-    ctx->local_party_.lambda_ = l_arr[share_index_arr.size()-1];
-    ctx->local_party_.w_ = (sign_key.local_party_.x_ * ctx->local_party_.lambda_) % curv->n;
-
-
-    std::sort(share_index_arr.begin(), share_index_arr.end());
-    for (size_t i = 0; i < share_index_arr.size(); ++i) {
-        if(sign_key.local_party_.index_ == share_index_arr[i])
-        {
-            ctx->local_party_index = i;
-            break;
-        }
-    }
-    for (size_t i = 0; i < sign_key.remote_parties_.size(); ++i) {
-        for (size_t j = 0; j < share_index_arr.size(); ++j) {
-            if(sign_key.remote_parties_[i].index_ == share_index_arr[j])
-            {
-                ctx->remote_party_indexes[i] = j;
-                break;
-            }
+    // The quorum comes from the sign key handle, otherwise it is computed for this signature only
+    if (!ctx->quorum_) {
+        std::shared_ptr<Quorum> quorum = std::make_shared<Quorum>();
+        if (!quorum->Compute(sign_key)) {
+            ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed in quorum->Compute(sign_key)!");
+            return false;
         }
+        ctx->quorum_ = quorum;
     }
+    const Quorum &quorum = *ctx->quorum_;
+    ctx->local_party_.l_arr_ = quorum.l_arr_;
+    ctx->local_party_.lambda_ = quorum.l_arr_.back();
+    ctx->local_party_index = quorum.local_party_index_;
+    ctx->remote_party_indexes = quorum.remote_party_indexes_;
+
+    // Compute w = x * lambda mod q
+    ctx->local_party_.w_ = (sign_key.local_party_.x_ * ctx->local_party_.lambda_) % curv->n;
 
 
     // Sample k_i, phi_i in Z_q
@@ -119,42 +88,29 @@ bool Round0::ComputeVerify() {
     ctx->local_party_.phi_ = safeheron::rand::RandomBNLt(curv->n);
 
     //computes the blinding shares in sequence using PRG
-    BN temp(0);
+    // k, phi and w take the outputs 0, 1 and 2 of every remote party's PRG, drawn for all the parties at once
+    std::vector<PRG *> prg_arr;
     for (size_t i = 0; i < ctx->remote_party_indexes.size(); ++i) {
-        if(ctx->local_party_index > ctx->remote_party_indexes[i])
-        {
-            temp += ctx->sign_key_.remote_parties_[i].prg.rand();
-        }
-        else
-        {
-            temp -= ctx->sign_key_.remote_parties_[i].prg.rand();
-        }
+        prg_arr.push_back(&ctx->sign_key_.remote_parties_[i].prg);
     }
-    ctx->local_party_.k_ = (ctx->local_party_.k_ + temp) % curv->n;
-    temp = BN(0);
+    std::vector<BN> rand_arr;
+    PRG::rand_lanes(prg_arr, PRG_OUTPUTS_PER_SIGN, rand_arr);
+    BN temp[PRG_OUTPUTS_PER_SIGN] = {BN(0), BN(0), BN(0)};
     for (size_t i = 0; i < ctx->remote_party_indexes.size(); ++i) {
-        if(ctx->local_party_index > ctx->remote_party_indexes[i])
-        {
-            temp += ctx->sign_key_.remote_parties_[i].prg.rand();
-        }
-        else
-        {
-            temp -= ctx->sign_key_.remote_parties_[i].prg.rand();
-        }
-    }
-    ctx->local_party_.phi_ = (ctx->local_party_.phi_ + temp) % curv->n;
-    temp = BN(0);
-    for (size_t i = 0; i < ctx->remote_party_indexes.size(); ++i) {
-        if(ctx->local_party_index > ctx->remote_party_indexes[i])
-        {
-            temp += ctx->sign_key_.remote_parties_[i].prg.rand();
-        }
-        else
-        {
-            temp -= ctx->sign_key_.remote_parties_[i].prg.rand();
+        for (size_t j = 0; j < PRG_OUTPUTS_PER_SIGN; ++j) {
+            if(ctx->local_party_index > ctx->remote_party_indexes[i])
+            {
+                temp[j] += rand_arr[i * PRG_OUTPUTS_PER_SIGN + j];
+            }
+            else
+            {
+                temp[j] -= rand_arr[i * PRG_OUTPUTS_PER_SIGN + j];
+            }
         }
     }
-    ctx->local_party_.w_ = (ctx->local_party_.w_ + temp) % curv->n;
+    ctx->local_party_.k_ = (ctx->local_party_.k_ + temp[0]) % curv->n;
+    ctx->local_party_.phi_ = (ctx->local_party_.phi_ + temp[1]) % curv->n;
+    ctx->local_party_.w_ = (ctx->local_party_.w_ + temp[2]) % curv->n;
 
     //GK_
     ctx->local_party_.Gk_ = curv->g * ctx->local_party_.k_;
@@ -175,7 +131,7 @@ bool Round0::ComputeVerify() {
 
 bool Round0::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                          std::vector<std::string> &out_des_arr) const {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     out_p2p_msg_arr.clear();
@@ -188,34 +144,14 @@ bool Round0::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string
     bool ok = true;
 
     // make message p2p
-    size_t start = (ctx->local_party_index + 1) % sign_key.threshold_;
-    if(sign_key.threshold_ % 2 == 1) // t+1是奇数,即t是偶数
-    {
-        size_t end = (ctx->local_party_index + (sign_key.remote_parties_.size()/2)) % sign_key.threshold_;
-        ok = MakeP2PMessage(start,end,out_p2p_msg_arr);
-        if(!ok) return false;
-    }
-    else //t是偶数
-    {
-        if(ctx->local_party_index<sign_key.threshold_/2)
-        {
-            size_t end = (ctx->local_party_index + (sign_key.threshold_/2)) % sign_key.threshold_;
-            ok = MakeP2PMessage(start,end,out_p2p_msg_arr);
-            if(!ok) return false;
-        }
-        else
-        {
-            size_t end = (ctx->local_party_index + (sign_key.threshold_/2) -1) % sign_key.threshold_;
-            ok = MakeP2PMessage(start,end,out_p2p_msg_arr);
-            if(!ok) return false;
-        }
-    }
+    ok = MakeP2PMessage(ctx->quorum_->p2p_start_, ctx->quorum_->p2p_end_, out_p2p_msg_arr);
+    if (!ok) return false;
 
     Round0BCMessage bc_message;
     bc_message.Gk_ = ctx->local_party_.Gk_;
-    ok = bc_message.ToBase64(out_bc_msg);
+    ok = ctx->EncodeMessage(bc_message, out_bc_msg);
     if (!ok) {
-        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed in bc_message.ToBase64(out_bc_msg)!");
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed in ctx->EncodeMessage(bc_message, out_bc_msg)!");
         return false;
     }
 
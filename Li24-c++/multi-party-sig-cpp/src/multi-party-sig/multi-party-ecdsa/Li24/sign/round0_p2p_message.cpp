@@ -17,25 +17,25 @@ namespace Li24{
 namespace sign{
 
 bool Round0P2PMessage::ToProtoObject(safeheron::proto::multi_party_ecdsa::Li24::sign::Round0P2PMessage &message) const {
+    bool ok = true;
 
-    string str;
-    w_.ToHexStr(str);
-    message.set_w(str);
+    ok = EncodeBN(w_, wire_version_, message.mutable_w(), message.mutable_w_bin());
+    if (!ok) return false;
 
-    k_.ToHexStr(str);
-    message.set_k(str);
+    ok = EncodeBN(k_, wire_version_, message.mutable_k(), message.mutable_k_bin());
+    if (!ok) return false;
 
-    phi_.ToHexStr(str);
-    message.set_phi(str);
+    ok = EncodeBN(phi_, wire_version_, message.mutable_phi(), message.mutable_phi_bin());
+    if (!ok) return false;
 
     return true;
 }
 
 bool Round0P2PMessage::FromProtoObject(const safeheron::proto::multi_party_ecdsa::Li24::sign::Round0P2PMessage &message) {
 
-    w_ = BN::FromHexStr(message.w());
-    k_ = BN::FromHexStr(message.k());
-    phi_ = BN::FromHexStr(message.phi());
+    w_ = DecodeBN(message.w(), message.w_bin());
+    k_ = DecodeBN(message.k(), message.k_bin());
+    phi_ = DecodeBN(message.phi(), message.phi_bin());
 
     return true;
 }
@@ -1,5 +1,6 @@
 #include "crypto-suites/crypto-curve/curve.h"
 #include "crypto-suites/crypto-bn/rand.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/mont_scalar.h"
 #include "multi-party-sig/multi-party-ecdsa/Li24/sign/round1.h"
 #include "multi-party-sig/multi-party-ecdsa/Li24/sign/context.h"
 
@@ -19,7 +20,7 @@ namespace Li24{
 namespace sign{
 
 void Round1::Init() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     for (int i = 0; i < ctx->get_total_parties() - 1; ++i) {
         p2p_message_arr_.emplace_back();
         bc_message_arr_.emplace_back();
@@ -27,7 +28,7 @@ void Round1::Init() {
 }
 
 bool Round1::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const Curve * curv = GetCurveParam(sign_key.X_.GetCurveType());
@@ -38,15 +39,28 @@ bool Round1::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
         return false;
     }
 
-    bool ok = p2p_message_arr_[pos].FromBase64(p2p_msg);
-    if (!ok) {
-        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to deserialize from base64!");
-        return false;
+    bool ok = true;
+    if (p2p_msg.empty()) {
+        // Only a sender of a key with the bytes encoding leaves the shares out, and only for the parties outside
+        // its window
+        if (sign_key.wire_version_ != WireVersion::Bytes || !ctx->quorum_ || ctx->quorum_->InRemoteP2PWindow(pos)) {
+            ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Empty P2P message from party " + party_id + "!");
+            return false;
+        }
+        p2p_message_arr_[pos].k_ = BN(0);
+        p2p_message_arr_[pos].w_ = BN(0);
+        p2p_message_arr_[pos].phi_ = BN(0);
+    } else {
+        ok = ctx->DecodeMessage(p2p_msg, p2p_message_arr_[pos]);
+        if (!ok) {
+            ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to deserialize the message!");
+            return false;
+        }
     }
 
-    ok = bc_message_arr_[pos].FromBase64(bc_msg);
+    ok = ctx->DecodeMessage(bc_msg, bc_message_arr_[pos]);
     if (!ok) {
-        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to deserialize from base64!");
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to deserialize the message!");
         return false;
     }
 
@@ -59,7 +73,7 @@ bool Round1::ReceiveVerify(const std::string &party_id) {
 
 bool Round1::ComputeVerify() {
     bool ok = true;
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     const SignKey &sign_key = ctx->sign_key_;
     const Curve * curv = GetCurveParam(sign_key.X_.GetCurveType());
 
@@ -71,18 +85,39 @@ bool Round1::ComputeVerify() {
     ctx->r_ = GK.x();
     ctx->R_ = GK;
 
-    BN wi = ctx->local_party_.w_;
-    BN ki = ctx->local_party_.k_;
-    BN phii = ctx->local_party_.phi_;
-    BN ui = wi * phii;
-    BN vi = ki * phii;
-    for (size_t i = 0; i < p2p_message_arr_.size(); ++i) {
-        ui += (wi *  p2p_message_arr_[i].phi_ +  phii * p2p_message_arr_[i].w_) % curv->n;
-        vi += (ki *  p2p_message_arr_[i].phi_ +  phii * p2p_message_arr_[i].k_) % curv->n;
+    const MontField *field = MontField::Get(sign_key.X_.GetCurveType());
+    if (field) {
+        // u_i = w_i * (phi_i + sum(phi_j)) + phi_i * sum(w_j), v_i the same with k, on fixed 256-bit scalars
+        MontScalar wi = field->FromBN(ctx->local_party_.w_);
+        MontScalar ki = field->FromBN(ctx->local_party_.k_);
+        MontScalar phii = field->FromBN(ctx->local_party_.phi_);
+        MontScalar phi_sum = phii;
+        MontScalar w_sum = field->Zero();
+        MontScalar k_sum = field->Zero();
+        for (size_t i = 0; i < p2p_message_arr_.size(); ++i) {
+            phi_sum += field->FromBN(p2p_message_arr_[i].phi_);
+            w_sum += field->FromBN(p2p_message_arr_[i].w_);
+            k_sum += field->FromBN(p2p_message_arr_[i].k_);
+        }
+        MontScalar ui = wi * phi_sum + phii * w_sum;
+        MontScalar vi = ki * phi_sum + phii * k_sum;
+        ctx->local_party_.u_ = ui.ToBN();
+        ctx->local_party_.v_ = vi.ToBN();
+        ctx->local_party_.delta_ = (field->FromBN(ctx->m_) * phii + field->FromBN(ctx->r_) * ui).ToBN();
+    } else {
+        BN wi = ctx->local_party_.w_;
+        BN ki = ctx->local_party_.k_;
+        BN phii = ctx->local_party_.phi_;
+        BN ui = wi * phii;
+        BN vi = ki * phii;
+        for (size_t i = 0; i < p2p_message_arr_.size(); ++i) {
+            ui += (wi *  p2p_message_arr_[i].phi_ +  phii * p2p_message_arr_[i].w_) % curv->n;
+            vi += (ki *  p2p_message_arr_[i].phi_ +  phii * p2p_message_arr_[i].k_) % curv->n;
+        }
+        ctx->local_party_.u_ = ui;
+        ctx->local_party_.v_ = vi;
+        ctx->local_party_.delta_ = (ctx->m_ * phii + ctx->r_ * ui) %curv->n;
     }
-    ctx->local_party_.u_ = ui;
-    ctx->local_party_.v_ = vi;
-    ctx->local_party_.delta_ = (ctx->m_ * phii + ctx->r_ * ui) %curv->n;
     ctx->delta_ = ctx->local_party_.delta_;
 
 /*    std::string str;
@@ -93,7 +128,7 @@ bool Round1::ComputeVerify() {
 
 bool Round1::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                          std::vector<std::string> &out_des_arr) const {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     const SignKey &sign_key = ctx->sign_key_;
     bool ok = true;
     out_p2p_msg_arr.clear();
@@ -105,11 +140,12 @@ bool Round1::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string
     }
 
     Round1BCMessage bc_message;
+    bc_message.wire_version_ = sign_key.wire_version_;
     bc_message.v_ = ctx->local_party_.v_;
     bc_message.delta_ = ctx->delta_;
-    ok = bc_message.ToBase64(out_bc_msg);
+    ok = ctx->EncodeMessage(bc_message, out_bc_msg);
     if (!ok) {
-        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed in bc_message.ToBase64(out_bc_msg)!");
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed in ctx->EncodeMessage(bc_message, out_bc_msg)!");
         return false;
     }
 
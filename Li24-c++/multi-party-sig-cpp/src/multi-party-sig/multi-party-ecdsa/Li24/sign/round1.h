@@ -12,13 +12,15 @@ namespace multi_party_ecdsa{
 namespace Li24{
 namespace sign{
 
-class Round1 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRound {
+class Context;
+
+class Round1 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRoundT<Context> {
 public:
     std::vector<Round0BCMessage> bc_message_arr_;
     std::vector<Round0P2PMessage> p2p_message_arr_;
 
 public:
-    Round1(): MPCRound(safeheron::mpc_flow::mpc_parallel_v2::MessageType::P2P_BROADCAST,
+    Round1(): MPCRoundT(safeheron::mpc_flow::mpc_parallel_v2::MessageType::SPARSE_P2P_BROADCAST,
                        safeheron::mpc_flow::mpc_parallel_v2::MessageType::BROADCAST){}
 
     void Init() override;
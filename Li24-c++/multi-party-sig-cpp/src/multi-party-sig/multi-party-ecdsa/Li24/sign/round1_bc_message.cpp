@@ -17,13 +17,13 @@ namespace Li24{
 namespace sign{
 
 bool Round1BCMessage::ToProtoObject(safeheron::proto::multi_party_ecdsa::Li24::sign::Round1P2PMessage &message) const {
+    bool ok = true;
 
-    string str;
-    delta_.ToHexStr(str);
-    message.set_delta(str);
+    ok = EncodeBN(delta_, wire_version_, message.mutable_delta(), message.mutable_delta_bin());
+    if (!ok) return false;
 
-    v_.ToHexStr(str);
-    message.set_v(str);
+    ok = EncodeBN(v_, wire_version_, message.mutable_v(), message.mutable_v_bin());
+    if (!ok) return false;
 
     return true;
 }
@@ -31,9 +31,9 @@ bool Round1BCMessage::ToProtoObject(safeheron::proto::multi_party_ecdsa::Li24::s
 bool Round1BCMessage::FromProtoObject(const safeheron::proto::multi_party_ecdsa::Li24::sign::Round1P2PMessage &message) {
     bool ok = true;
 
-    delta_ = BN::FromHexStr(message.delta());
+    delta_ = DecodeBN(message.delta(), message.delta_bin());
     if (delta_ == 0) return false;
-    v_ = BN::FromHexStr(message.v());
+    v_ = DecodeBN(message.v(), message.v_bin());
     if (v_ == 0) return false;
 
     return true;
@@ -1,4 +1,5 @@
 #include "crypto-suites/crypto-curve/curve.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/mont_scalar.h"
 #include "multi-party-sig/multi-party-ecdsa/Li24/sign/round2.h"
 #include "multi-party-sig/multi-party-ecdsa/Li24/sign/context.h"
 
@@ -19,7 +20,7 @@ namespace sign{
 
 void Round2::Init() {
 
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     for (int i = 0; i < ctx->get_total_parties() - 1; ++i) {
         bc_message_arr_.emplace_back();
     }
@@ -28,7 +29,7 @@ void Round2::Init() {
 
 bool Round2::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
 
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     int pos = sign_key.get_remote_party_pos(party_id);
@@ -37,9 +38,9 @@ bool Round2::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
         return false;
     }
 
-    bool ok = bc_message_arr_[pos].FromBase64(bc_msg);
+    bool ok = ctx->DecodeMessage(bc_msg, bc_message_arr_[pos]);
     if (!ok) {
-        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to deserialize from base64!");
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to deserialize the message!");
         return false;
     }
 
@@ -51,24 +52,41 @@ bool Round2::ReceiveVerify(const std::string &party_id) {
 }
 
 bool Round2::ComputeVerify() {
-//    std::chrono::high_resolution_clock::time_point begin_test = std::chrono::high_resolution_clock::now();
     bool ok = true;
     // Validate child private key share
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const Curve * curv = GetCurveParam(sign_key.X_.GetCurveType());
 
-    BN delta = ctx->delta_;
-    BN v = ctx->local_party_.v_;
-    for (size_t i = 0; i < bc_message_arr_.size(); ++i) {
-        v =  (v+bc_message_arr_[i].v_)% curv->n;
-        delta = (delta +bc_message_arr_[i].delta_)% curv->n;
+    BN s;
+    const MontField *field = MontField::Get(sign_key.X_.GetCurveType());
+    if (field) {
+        MontScalar delta = field->FromBN(ctx->delta_);
+        MontScalar v = field->FromBN(ctx->local_party_.v_);
+        for (size_t i = 0; i < bc_message_arr_.size(); ++i) {
+            v += field->FromBN(bc_message_arr_[i].v_);
+            delta += field->FromBN(bc_message_arr_[i].delta_);
+        }
+        if (v.IsZero()) {
+            ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "v is not invertible!");
+            return false;
+        }
+        MontScalar v_inv = v.Inv();
+        ctx->v_inv_ = v_inv.ToBN();
+        s = (delta * v_inv).ToBN();
+    } else {
+        BN delta = ctx->delta_;
+        BN v = ctx->local_party_.v_;
+        for (size_t i = 0; i < bc_message_arr_.size(); ++i) {
+            v =  (v+bc_message_arr_[i].v_)% curv->n;
+            delta = (delta +bc_message_arr_[i].delta_)% curv->n;
+        }
+        v = v % curv->n;
+        delta = delta % curv->n;
+        ctx->v_inv_ = v.InvM(curv->n);
+        s = (delta * ctx->v_inv_) % curv->n;
     }
-    v = v % curv->n;
-    delta = delta % curv->n;
-    ctx->v_inv_ = v.InvM(curv->n);
-    BN s = (delta * ctx->v_inv_) % curv->n;
     // Recovery parameter
     uint32_t recovery_param = (ctx->R_.y().IsOdd() ? 1 : 0) |     // is_y_odd
                               ((ctx->R_.x() != ctx->r_) ? 2 : 0); // is_second_key
@@ -85,10 +103,6 @@ bool Round2::ComputeVerify() {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to verify R,S,V with child public key!");
         return false;
     }
-//    std::chrono::high_resolution_clock::time_point end_test = std::chrono::high_resolution_clock::now();
-//    std::chrono::duration<double> duration = end_test - begin_test;
-//    double time__ = duration.count();
-//    std::cout<<"compute_verify>>>>>>>>>>"<<time__<<std::endl;
     return true;
 }
 
@@ -12,12 +12,14 @@ namespace multi_party_ecdsa{
 namespace Li24{
 namespace sign{
 
-class Round2 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRound {
+class Context;
+
+class Round2 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRoundT<Context> {
 public:
     std::vector<Round1BCMessage> bc_message_arr_;
 
 public:
-    Round2(): MPCRound(safeheron::mpc_flow::mpc_parallel_v2::MessageType::BROADCAST,
+    Round2(): MPCRoundT(safeheron::mpc_flow::mpc_parallel_v2::MessageType::BROADCAST,
                        safeheron::mpc_flow::mpc_parallel_v2::MessageType::None){}
 
     void Init() override;
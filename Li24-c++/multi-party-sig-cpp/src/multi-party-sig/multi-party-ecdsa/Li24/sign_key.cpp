@@ -33,6 +33,22 @@ int SignKey::get_remote_party_pos(const std::string &remote_party_id) const {
     return pos;
 }
 
+bool SignKey::AdvanceCursors(const SignKey &trimmed_sign_key) {
+    vector<int> pos_arr;
+    for (const auto &trimmed_party : trimmed_sign_key.remote_parties_) {
+        int pos = get_remote_party_pos(trimmed_party.party_id_);
+        if (pos == -1) return false;
+        pos_arr.push_back(pos);
+    }
+
+    for (size_t i = 0; i < pos_arr.size(); ++i) {
+        PRG &prg = remote_parties_[pos_arr[i]].prg;
+        uint64_t position = trimmed_sign_key.remote_parties_[i].prg.position();
+        if (position > prg.position()) prg.seek(position);
+    }
+    return true;
+}
+
 bool SignKey::ToProtoObject(safeheron::proto::multi_party_ecdsa::Li24::SignKey &sign_key) const {
     bool ok = true;
     string str;
@@ -41,13 +57,13 @@ bool SignKey::ToProtoObject(safeheron::proto::multi_party_ecdsa::Li24::SignKey &
     sign_key.set_n_parties(n_parties_);
 
     safeheron::proto::multi_party_ecdsa::Li24::Party local_party;
-    ok = local_party_.ToProtoObject(local_party);
+    ok = local_party_.ToProtoObject(local_party, wire_version_);
     if (!ok) return false;
     sign_key.mutable_local_party()->CopyFrom(local_party);
 
     for (size_t i = 0; i < remote_parties_.size(); i++) {
         safeheron::proto::multi_party_ecdsa::Li24::Party remote_party;
-        ok = remote_parties_[i].ToProtoObject(remote_party);
+        ok = remote_parties_[i].ToProtoObject(remote_party, wire_version_);
         if (!ok) return false;
         safeheron::proto::multi_party_ecdsa::Li24::Party *new_party = sign_key.add_remote_parties();
         new_party->CopyFrom(remote_party);
@@ -58,6 +74,9 @@ bool SignKey::ToProtoObject(safeheron::proto::multi_party_ecdsa::Li24::SignKey &
     if (!ok) return false;
     sign_key.mutable_g_x()->CopyFrom(point);
 
+    sign_key.set_prg_type(static_cast<int32_t>(prg_type_));
+    sign_key.set_wire_version(static_cast<int32_t>(wire_version_));
+
     return true;
 }
 
@@ -84,6 +103,20 @@ bool SignKey::FromProtoObject(const safeheron::proto::multi_party_ecdsa::Li24::S
     ok = ok && !X_.IsInfinity();
     if (!ok) return false;
 
+    ok = IsValidPRGType(sign_key.prg_type());
+    if (!ok) return false;
+    prg_type_ = static_cast<PRGType>(sign_key.prg_type());
+    ok = WireVersionFromInt(sign_key.wire_version(), wire_version_);
+    if (!ok) return false;
+    for (size_t i = 0; i < remote_parties_.size(); ++i) {
+        uint64_t position = sign_key.remote_parties(i).prg_cursor().position();
+        // Resuming a hash chain costs one hash per output consumed
+        ok = (prg_type_ == PRGType::Counter) || (position <= PRG_MAX_CHAIN_POSITION);
+        if (!ok) return false;
+        remote_parties_[i].prg.set_type(prg_type_);
+        remote_parties_[i].prg.seek(position);
+    }
+
     return true;
 }
 
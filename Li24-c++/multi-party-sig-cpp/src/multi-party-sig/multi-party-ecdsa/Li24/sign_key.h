@@ -16,10 +16,22 @@ public:
     LocalParty local_party_;
     std::vector<RemoteParty> remote_parties_;
     safeheron::curve::CurvePoint X_;
+    // PRG construction shared with every remote party, HashChain for legacy keys.
+    PRGType prg_type_ = PRGType::HashChain;
+    // Encoding of the big integers in the key and in the messages of its protocols, Hex for legacy keys.
+    WireVersion wire_version_ = WireVersion::Hex;
 
 public:
     int get_remote_party_pos(const std::string &remote_party_id) const;
 
+    /**
+     * Move the PRG cursors forward to those of a key trimmed from this one, typically the key of a finished context,
+     * so that the next save stores the outputs it has consumed. Each remote party of the trimmed key is matched by
+     * id, the parties which did not take part keep their cursor. A cursor never moves back.
+     * @return false if a remote party of the trimmed key is not in this key, nothing is changed then.
+     */
+    bool AdvanceCursors(const SignKey &trimmed_sign_key);
+
     bool ValidityTest() const;
 
     bool ToProtoObject(safeheron::proto::multi_party_ecdsa::Li24::SignKey &sign_key) const;
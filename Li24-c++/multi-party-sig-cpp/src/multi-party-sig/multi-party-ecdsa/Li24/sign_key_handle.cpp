@@ -0,0 +1,110 @@
+#include "multi-party-sig/multi-party-ecdsa/Li24/sign_key_handle.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/util.h"
+
+using std::string;
+using std::vector;
+
+// Signer sets are few and stable, the bound only protects against a caller which signs with every possible subset.
+static const size_t MAX_CACHED_QUORUMS = 1024;
+
+namespace safeheron {
+namespace multi_party_ecdsa{
+namespace Li24{
+
+std::shared_ptr<const SignKeyHandle> SignKeyHandle::FromBase64(const string &sign_key_base64) {
+    SignKey sign_key;
+    if (!sign_key.FromBase64(sign_key_base64)) return nullptr;
+    return FromSignKey(sign_key);
+}
+
+std::shared_ptr<const SignKeyHandle> SignKeyHandle::FromSignKey(const SignKey &sign_key) {
+    if (!sign_key.ValidityTest()) return nullptr;
+    return std::shared_ptr<const SignKeyHandle>(new SignKeyHandle(sign_key));
+}
+
+SignKeyHandle::SignKeyHandle(const SignKey &sign_key): sign_key_(sign_key) {
+    for (const auto &remote_party : sign_key_.remote_parties_) {
+        prg_arr_.push_back(remote_party.prg);
+        reserved_arr_.push_back(remote_party.prg.position());
+    }
+}
+
+void SignKeyHandle::CurrentSignKey(SignKey &out_sign_key) const {
+    out_sign_key = sign_key_;
+    vector<uint64_t> reserved_arr;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (size_t i = 0; i < prg_arr_.size(); ++i) {
+            out_sign_key.remote_parties_[i].prg = prg_arr_[i];
+        }
+        reserved_arr = reserved_arr_;
+    }
+    for (size_t i = 0; i < reserved_arr.size(); ++i) {
+        out_sign_key.remote_parties_[i].prg.seek(reserved_arr[i]);
+    }
+}
+
+bool SignKeyHandle::Trim(SignKey &out_sign_key, const vector<string> &participant_id_arr, uint64_t prg_outputs) const {
+    bool ok = true;
+    out_sign_key = sign_key_;
+    ok = trim_sign_key(out_sign_key, participant_id_arr);
+    if (!ok) return false;
+
+    // The whole key is validated already
+    if (out_sign_key.remote_parties_.size() != sign_key_.remote_parties_.size()) {
+        ok = out_sign_key.ValidityTest();
+        if (!ok) return false;
+    }
+
+    // Reserve the outputs of every pair in one step, a counter bump per pair
+    vector<size_t> pos_arr;
+    vector<uint64_t> start_arr;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (auto &remote_party : out_sign_key.remote_parties_) {
+            size_t pos = sign_key_.get_remote_party_pos(remote_party.party_id_);
+            remote_party.prg = prg_arr_[pos];
+            pos_arr.push_back(pos);
+            start_arr.push_back(reserved_arr_[pos]);
+            reserved_arr_[pos] += prg_outputs;
+        }
+    }
+
+    // Catch up with the reservations, a hash chain only moves forward by the outputs reserved since the copy
+    for (size_t i = 0; i < pos_arr.size(); ++i) {
+        out_sign_key.remote_parties_[i].prg.seek(start_arr[i]);
+    }
+
+    // Later copies start from here
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (size_t i = 0; i < pos_arr.size(); ++i) {
+        const PRG &prg = out_sign_key.remote_parties_[i].prg;
+        if (prg_arr_[pos_arr[i]].position() < prg.position()) prg_arr_[pos_arr[i]] = prg;
+    }
+    return true;
+}
+
+std::shared_ptr<const Quorum> SignKeyHandle::GetQuorum(const SignKey &trimmed_sign_key) const {
+    string quorum_key;
+    for (const auto &remote_party : trimmed_sign_key.remote_parties_) {
+        quorum_key += std::to_string(remote_party.party_id_.size()) + ":" + remote_party.party_id_;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = quorum_map_.find(quorum_key);
+        if (iter != quorum_map_.end()) return iter->second;
+    }
+
+    std::shared_ptr<Quorum> quorum = std::make_shared<Quorum>();
+    if (!quorum->Compute(trimmed_sign_key)) return nullptr;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (quorum_map_.size() >= MAX_CACHED_QUORUMS) quorum_map_.clear();
+    quorum_map_[quorum_key] = quorum;
+    return quorum;
+}
+
+}
+}
+}
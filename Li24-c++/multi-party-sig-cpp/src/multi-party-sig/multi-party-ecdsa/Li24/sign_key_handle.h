@@ -0,0 +1,88 @@
+#ifndef SAFEHERON_MULTI_PARTY_ECDSA_Li24_SIGN_KEY_HANDLE_H
+#define SAFEHERON_MULTI_PARTY_ECDSA_Li24_SIGN_KEY_HANDLE_H
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "multi-party-sig/multi-party-ecdsa/Li24/sign_key.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/quorum.h"
+
+namespace safeheron {
+namespace multi_party_ecdsa{
+namespace Li24{
+
+/**
+ * A sign key which is parsed and validated once, then shared by all the contexts created from it.
+ *
+ * One handle can be used by several threads at the same time. Every context takes its own copy of the key (trimmed to
+ * the signers), the handle itself is never serialized again.
+ *
+ * The handle hands out the PRG outputs of every remote party: each Trim() reserves the next outputs of the pairs it
+ * keeps, so no two contexts blind with the same masks. Both parties of a pair must therefore create the contexts they
+ * share in the same order, and run every context they create. CurrentSignKey() is the key to save, so that a
+ * restarted signer goes on where the handle stopped.
+ */
+class SignKeyHandle {
+public:
+    /**
+     * Parse and validate a sign key.
+     * @param sign_key_base64 sign key in base64
+     * @return the handle, or nullptr if the key is invalid.
+     */
+    static std::shared_ptr<const SignKeyHandle> FromBase64(const std::string &sign_key_base64);
+
+    /**
+     * Validate a sign key and take a copy of it.
+     * @return the handle, or nullptr if the key is invalid.
+     */
+    static std::shared_ptr<const SignKeyHandle> FromSignKey(const SignKey &sign_key);
+
+    /**
+     * The key as it was parsed, its PRG cursors do not move.
+     */
+    const SignKey &sign_key() const { return sign_key_; }
+
+    /**
+     * The key with the PRG cursors moved past all the outputs reserved so far.
+     */
+    void CurrentSignKey(SignKey &out_sign_key) const;
+
+    /**
+     * Same as trim_sign_key(), without the base64 round trip. The PRG of every remote party of out_sign_key is moved
+     * to the first of prg_outputs outputs reserved for it. The reservation only bumps a counter under the handle's
+     * lock, a hash chain is moved forward after the lock is released.
+     * @param out_sign_key the key restricted to the participants.
+     * @param participant_id_arr all the parties that take part in the signature.
+     * @param prg_outputs number of outputs the context draws from each remote party's PRG.
+     */
+    bool Trim(SignKey &out_sign_key, const std::vector<std::string> &participant_id_arr,
+              uint64_t prg_outputs = PRG_OUTPUTS_PER_SIGN) const;
+
+    /**
+     * The quorum of a key returned by Trim(). It is computed on the first call for a set of signers and cached.
+     * @return the quorum, or nullptr if it could not be computed.
+     */
+    std::shared_ptr<const Quorum> GetQuorum(const SignKey &trimmed_sign_key) const;
+
+private:
+    explicit SignKeyHandle(const SignKey &sign_key);
+
+    SignKey sign_key_;
+
+    mutable std::mutex mutex_;
+    // Keyed by the ids of the remote signers. The cache does not change the key.
+    mutable std::map<std::string, std::shared_ptr<const Quorum>> quorum_map_;
+    // First output of every remote party's PRG not reserved yet, in the order of sign_key_.remote_parties_
+    mutable std::vector<uint64_t> reserved_arr_;
+    // PRG of every remote party at the furthest reservation start reached so far, never past reserved_arr_. The
+    // outputs in between are hashed by the callers of Trim(), outside the lock.
+    mutable std::vector<PRG> prg_arr_;
+};
+
+}
+}
+}
+
+#endif //SAFEHERON_MULTI_PARTY_ECDSA_Li24_SIGN_KEY_HANDLE_H
@@ -44,13 +44,8 @@ int find_party_id(std::string &party_id, const std::vector<std::string> &party_i
     return ret;
 }
 
-bool trim_sign_key(std::string &out_sign_key_base64, const std::string &in_sign_key_base64, const std::vector<std::string> &participant_id_arr){
-    bool ok = true;
-    if(!ok) return false;
-    SignKey sign_key;
-    ok = sign_key.FromBase64(in_sign_key_base64);
-    if(!ok) return false;
-    ok = (find_party_id(sign_key.local_party_.party_id_, participant_id_arr) != -1);
+bool trim_sign_key(SignKey &sign_key, const std::vector<std::string> &participant_id_arr){
+    bool ok = (find_party_id(sign_key.local_party_.party_id_, participant_id_arr) != -1);
     if(!ok) return false;
 
     auto iter = sign_key.remote_parties_.begin();
@@ -67,6 +62,18 @@ bool trim_sign_key(std::string &out_sign_key_base64, const std::string &in_sign_
     if(!ok) return false;
 
     sign_key.n_parties_ = (sign_key.remote_parties_.size() + 1);
+    return true;
+}
+
+bool trim_sign_key(std::string &out_sign_key_base64, const std::string &in_sign_key_base64, const std::vector<std::string> &participant_id_arr){
+    bool ok = true;
+    SignKey sign_key;
+    ok = sign_key.FromBase64(in_sign_key_base64);
+    if(!ok) return false;
+
+    ok = trim_sign_key(sign_key, participant_id_arr);
+    if(!ok) return false;
+
     ok = sign_key.ValidityTest();
     if (!ok) return false;
 
@@ -76,6 +83,20 @@ bool trim_sign_key(std::string &out_sign_key_base64, const std::string &in_sign_
     return true;
 }
 
+bool convert_sign_key(std::string &out_sign_key_base64, const std::string &in_sign_key_base64, WireVersion wire_version){
+    bool ok = true;
+    SignKey sign_key;
+    ok = sign_key.FromBase64(in_sign_key_base64);
+    if(!ok) return false;
+
+    sign_key.wire_version_ = wire_version;
+
+    ok = sign_key.ToBase64(out_sign_key_base64);
+    if (!ok) return false;
+
+    return true;
+}
+
 }
 }
 }
\ No newline at end of file
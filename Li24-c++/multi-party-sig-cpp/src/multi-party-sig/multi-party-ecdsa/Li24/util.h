@@ -6,6 +6,7 @@
 #include "crypto-suites/crypto-curve/curve.h"
 #include "crypto-suites/crypto-paillier/pail.h"
 #include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_context.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/wire.h"
 
 namespace safeheron {
 namespace multi_party_ecdsa {
@@ -15,6 +16,15 @@ bool CheckIndexArr(const std::vector<safeheron::bignum::BN> &share_index_arr, co
 
 int find_party_id(std::string &party_id, const std::vector<std::string> &party_id_arr);
 
+class SignKey;
+
+/**
+ * Restrict the sign key to the participants, in place. Unlike the base64 version below, the key is not validated.
+ * @param sign_key
+ * @param party_id_arr. Specified all the parties that would participated in HD Ecdsa Protocol.
+ */
+bool trim_sign_key(SignKey &sign_key, const std::vector<std::string> &participant_id_arr);
+
 /**
  * In {t,n} HD Ecdsa Protocol, the hd_sign key should be pretreated in ahead if t < n.
  * @param out_sign_key_base64
@@ -24,6 +34,15 @@ int find_party_id(std::string &party_id, const std::vector<std::string> &party_i
  */
 bool trim_sign_key(std::string &out_sign_key_base64, const std::string &in_sign_key_base64, const std::vector<std::string> &participant_id_arr);
 
+/**
+ * Re-encode a sign key, e.g. a legacy hex key to WireVersion::Bytes. The protocols write their messages with the
+ * encoding of the key, so all the parties of a key must convert it before they sign again.
+ * @param out_sign_key_base64
+ * @param in_sign_key_base64
+ * @param wire_version
+ */
+bool convert_sign_key(std::string &out_sign_key_base64, const std::string &in_sign_key_base64, WireVersion wire_version);
+
 }
 }
 }
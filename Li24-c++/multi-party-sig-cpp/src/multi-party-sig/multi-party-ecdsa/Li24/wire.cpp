@@ -0,0 +1,84 @@
+#include "multi-party-sig/multi-party-ecdsa/Li24/wire.h"
+
+using std::string;
+using std::vector;
+using safeheron::bignum::BN;
+using google::protobuf::RepeatedPtrField;
+
+namespace safeheron {
+namespace multi_party_ecdsa{
+namespace Li24{
+
+namespace {
+
+void ToWireBytes(const BN &num, string &bin) {
+    // Scalars and shares take a fixed 32 bytes, larger values their minimal length
+    if (num.BitLength() <= 256) {
+        num.ToBytes32BE(bin);
+    } else {
+        num.ToBytesBE(bin);
+    }
+}
+
+}
+
+bool WireVersionFromInt(int32_t value, WireVersion &wire_version) {
+    switch (value) {
+        case 0:
+        case static_cast<int32_t>(WireVersion::Hex):
+            wire_version = WireVersion::Hex;
+            return true;
+        case static_cast<int32_t>(WireVersion::Bytes):
+            wire_version = WireVersion::Bytes;
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool EncodeBN(const BN &num, WireVersion wire_version, string *hex, string *bin) {
+    hex->clear();
+    bin->clear();
+    if (num.IsNeg()) return false;
+    if (wire_version == WireVersion::Bytes) {
+        ToWireBytes(num, *bin);
+    } else {
+        num.ToHexStr(*hex);
+    }
+    return true;
+}
+
+bool EncodeBNArr(const vector<BN> &num_arr, WireVersion wire_version,
+                 RepeatedPtrField<string> *hex_arr, RepeatedPtrField<string> *bin_arr) {
+    hex_arr->Clear();
+    bin_arr->Clear();
+    RepeatedPtrField<string> *out_arr = (wire_version == WireVersion::Bytes) ? bin_arr : hex_arr;
+    for (const BN &num : num_arr) {
+        if (num.IsNeg()) return false;
+        if (wire_version == WireVersion::Bytes) {
+            ToWireBytes(num, *out_arr->Add());
+        } else {
+            num.ToHexStr(*out_arr->Add());
+        }
+    }
+    return true;
+}
+
+BN DecodeBN(const string &hex, const string &bin) {
+    if (!bin.empty()) return BN::FromBytesBE(bin);
+    return BN::FromHexStr(hex);
+}
+
+void DecodeBNArr(const RepeatedPtrField<string> &hex_arr, const RepeatedPtrField<string> &bin_arr,
+                 vector<BN> &num_arr) {
+    num_arr.clear();
+    if (bin_arr.size() > 0) {
+        for (const string &bin : bin_arr) num_arr.push_back(BN::FromBytesBE(bin));
+    } else {
+        for (const string &hex : hex_arr) num_arr.push_back(BN::FromHexStr(hex));
+    }
+}
+
+}
+}
+}
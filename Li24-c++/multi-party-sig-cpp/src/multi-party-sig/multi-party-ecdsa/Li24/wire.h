@@ -0,0 +1,51 @@
+#ifndef SAFEHERON_MULTI_PARTY_ECDSA_Li24_WIRE_H
+#define SAFEHERON_MULTI_PARTY_ECDSA_Li24_WIRE_H
+
+#include <string>
+#include <vector>
+#include <google/protobuf/repeated_field.h>
+#include "crypto-suites/crypto-bn/bn.h"
+
+namespace safeheron {
+namespace multi_party_ecdsa{
+namespace Li24{
+
+/**
+ * Encoding of the big integers in the sign key and in the messages, chosen at key generation.
+ *  - Hex:   hex strings, the legacy format.
+ *  - Bytes: big-endian bytes, 32 bytes for a value below 2^256. About half the size of Hex.
+ * Readers accept both, so only the writers have to agree.
+ */
+enum class WireVersion : int32_t {
+    Hex = 1,
+    Bytes = 2,
+};
+
+/**
+ * Read the version stored in a protobuf, 0 (not set) being Hex.
+ */
+bool WireVersionFromInt(int32_t value, WireVersion &wire_version);
+
+/**
+ * Write a non-negative value in the field of the version, the other one is cleared.
+ */
+bool EncodeBN(const safeheron::bignum::BN &num, WireVersion wire_version, std::string *hex, std::string *bin);
+
+bool EncodeBNArr(const std::vector<safeheron::bignum::BN> &num_arr, WireVersion wire_version,
+                 google::protobuf::RepeatedPtrField<std::string> *hex_arr,
+                 google::protobuf::RepeatedPtrField<std::string> *bin_arr);
+
+/**
+ * Read the bytes field if it is set, the hex one otherwise.
+ */
+safeheron::bignum::BN DecodeBN(const std::string &hex, const std::string &bin);
+
+void DecodeBNArr(const google::protobuf::RepeatedPtrField<std::string> &hex_arr,
+                 const google::protobuf::RepeatedPtrField<std::string> &bin_arr,
+                 std::vector<safeheron::bignum::BN> &num_arr);
+
+}
+}
+}
+
+#endif //SAFEHERON_MULTI_PARTY_ECDSA_Li24_WIRE_H
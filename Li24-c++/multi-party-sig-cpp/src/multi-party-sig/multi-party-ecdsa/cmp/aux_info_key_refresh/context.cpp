@@ -62,7 +62,7 @@ namespace multi_party_ecdsa{
 namespace cmp{
 namespace aux_info_key_refresh {
 
-Context::Context(int total_parties): MPCContext(total_parties), flag_prepare_pail_key_(false) , flag_update_minimal_key_(true) {
+Context::Context(int total_parties): MPCContext(total_parties), flag_prepare_pail_key_(false) , flag_update_minimal_key_(true), key_material_pool_(nullptr) {
     BindAllRounds();
 }
 
@@ -84,6 +84,7 @@ Context::Context(const Context &ctx): MPCContext(ctx){
 
     rho_ = ctx.rho_;
     X_ = ctx.X_;
+    key_material_pool_ = ctx.key_material_pool_;
     // End Assignments.
 
     BindAllRounds();
@@ -113,6 +114,7 @@ Context &Context::operator=(const Context &ctx){
 
     rho_ = ctx.rho_;
     X_ = ctx.X_;
+    key_material_pool_ = ctx.key_material_pool_;
     // End Assignments.
 
     BindAllRounds();
@@ -4,6 +4,7 @@
 #include <vector>
 #include "crypto-suites/crypto-bn/bn.h"
 #include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_context.h"
+#include "multi-party-sig/multi-party-ecdsa/common/key_material_pool.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/party.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/aux_info_key_refresh/t_party.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/minimal_sign_key.h"
@@ -39,6 +40,13 @@ public:
 public:
     void BindAllRounds();
 
+    /**
+     * Take (N, s, t) of round 0 from a pool instead of generating them inline. Ignored when the Paillier key is
+     * prepared in CreateContext. The pool is not owned and must outlive the context. Without a pool, or with an empty
+     * one, they are generated inline as before.
+     */
+    void set_key_material_pool(safeheron::multi_party_ecdsa::common::KeyMaterialPool *pool) { key_material_pool_ = pool; }
+
     static bool CreateContext(Context &ctx,
                               const safeheron::multi_party_ecdsa::cmp::MinimalSignKey &minimal_sign_key,
                               const std::string &sid,
@@ -91,6 +99,8 @@ public:
     safeheron::curve::CurvePoint X_;
 
     bool flag_update_minimal_key_; //update the private key shards or not
+
+    safeheron::multi_party_ecdsa::common::KeyMaterialPool *key_material_pool_;
 };
 
 }
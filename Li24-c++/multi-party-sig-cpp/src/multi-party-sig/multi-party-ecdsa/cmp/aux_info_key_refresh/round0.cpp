@@ -9,6 +9,8 @@ using std::vector;
 using safeheron::hash::CSafeHash256;
 using safeheron::bignum::BN;
 using safeheron::curve::CurvePoint;
+using safeheron::multi_party_ecdsa::common::KeyMaterialPool;
+using safeheron::multi_party_ecdsa::common::NTildeMaterial;
 
 namespace safeheron {
 namespace multi_party_ecdsa {
@@ -16,19 +18,24 @@ namespace cmp {
 namespace aux_info_key_refresh {
 
 bool Round0::ComputeVerify() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     SignKey &sign_key = ctx->sign_key_;
     const curve::Curve *curv = ctx->GetCurrentCurve();
     bool ok = true;
 
     if (!ctx->flag_prepare_pail_key_) {
-        safeheron::zkp::dln_proof::GenerateN_tilde(sign_key.local_party_.N_,
-                                                   sign_key.local_party_.s_,
-                                                   sign_key.local_party_.t_,
-                                                   ctx->local_party_.pp_,
-                                                   ctx->local_party_.qq_,
-                                                   sign_key.local_party_.alpha_,
-                                                   sign_key.local_party_.beta_);
+        // N = (2pp + 1)(2qq + 1) is also the Paillier modulus, so (N_tilde, h1, h2) of the pool serves as (N, s, t)
+        NTildeMaterial n_tilde;
+        if (!ctx->key_material_pool_ || !ctx->key_material_pool_->TakeNTilde(n_tilde)) {
+            KeyMaterialPool::GenerateNTilde(n_tilde);
+        }
+        sign_key.local_party_.N_ = n_tilde.N_tilde_;
+        sign_key.local_party_.s_ = n_tilde.h1_;
+        sign_key.local_party_.t_ = n_tilde.h2_;
+        ctx->local_party_.pp_ = n_tilde.p_;
+        ctx->local_party_.qq_ = n_tilde.q_;
+        sign_key.local_party_.alpha_ = n_tilde.alpha_;
+        sign_key.local_party_.beta_ = n_tilde.beta_;
         sign_key.local_party_.p_ = ctx->local_party_.pp_ * 2 + 1;
         sign_key.local_party_.q_ = ctx->local_party_.qq_ * 2 + 1;
     }
@@ -166,7 +173,7 @@ bool Round0::ComputeVerify() {
 
 bool Round0::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                              std::vector<std::string> &out_des_arr) const {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     SignKey &sign_key = ctx->sign_key_;
 
     out_p2p_msg_arr.clear();
@@ -181,9 +188,9 @@ bool Round0::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string
     bc_message.ssid_ = ctx->ssid_;
     bc_message.index_ = sign_key.local_party_.index_;
     bc_message.V_ = ctx->local_party_.V_;
-    bool ok = bc_message.ToBase64(out_bc_msg);
+    bool ok = ctx->EncodeMessage(bc_message, out_bc_msg);
     if (!ok) {
-        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed in bc_message.ToBase64(out_bc_msg)!");
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed in ctx->EncodeMessage(bc_message, out_bc_msg)!");
         return false;
     }
 
@@ -12,9 +12,11 @@ namespace cmp{
 namespace aux_info_key_refresh {
 
 
-class Round0 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRound {
+class Context;
+
+class Round0 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRoundT<Context> {
 public:
-    Round0() : MPCRound(safeheron::mpc_flow::mpc_parallel_v2::MessageType::None,
+    Round0() : MPCRoundT(safeheron::mpc_flow::mpc_parallel_v2::MessageType::None,
                         safeheron::mpc_flow::mpc_parallel_v2::MessageType::BROADCAST) {}
 
     bool ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) override { return true; }
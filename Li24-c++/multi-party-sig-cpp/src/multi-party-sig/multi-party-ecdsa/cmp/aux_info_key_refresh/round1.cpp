@@ -16,14 +16,14 @@ namespace cmp{
 namespace aux_info_key_refresh {
 
 void Round1::Init() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     for (int j = 0; j < ctx->get_total_parties() - 1; ++j) {
         bc_message_arr_.emplace_back();
     }
 }
 
 bool Round1::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     SignKey &minimal_sign_key = ctx->sign_key_;
 
     int pos = minimal_sign_key.get_remote_party_pos(party_id);
@@ -32,9 +32,9 @@ bool Round1::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
         return false;
     }
 
-    bool ok = bc_message_arr_[pos].FromBase64(bc_msg);
+    bool ok = ctx->DecodeMessage(bc_msg, bc_message_arr_[pos]);
     if (!ok) {
-        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to deserialize from base64!");
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to deserialize the message!");
         return false;
     }
 
@@ -42,7 +42,7 @@ bool Round1::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
 }
 
 bool Round1::ReceiveVerify(const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     SignKey &sign_key = ctx->sign_key_;
     bool ok = true;
 
@@ -72,7 +72,7 @@ bool Round1::ReceiveVerify(const std::string &party_id) {
 }
 
 bool Round1::ComputeVerify() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     SignKey &sign_key = ctx->sign_key_;
 
     return true;
@@ -80,7 +80,7 @@ bool Round1::ComputeVerify() {
 
 bool Round1::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                              std::vector<std::string> &out_des_arr) const {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     SignKey &sign_key = ctx->sign_key_;
 
     out_p2p_msg_arr.clear();
@@ -105,9 +105,9 @@ bool Round1::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string
     bc_message.psi_tilde_ = ctx->local_party_.psi_tilde_;
     bc_message.rho_ = ctx->local_party_.rho_;
     bc_message.u_ = ctx->local_party_.u_;
-    bool ok = bc_message.ToBase64(out_bc_msg);
+    bool ok = ctx->EncodeMessage(bc_message, out_bc_msg);
     if (!ok) {
-        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed in bc_message.ToBase64(out_bc_msg)!");
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed in ctx->EncodeMessage(bc_message, out_bc_msg)!");
         return false;
     }
 
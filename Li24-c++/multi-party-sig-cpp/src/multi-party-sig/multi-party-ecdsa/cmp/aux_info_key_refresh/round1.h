@@ -13,11 +13,13 @@ namespace cmp{
 namespace aux_info_key_refresh {
 
 
-class Round1 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRound {
+class Context;
+
+class Round1 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRoundT<Context> {
 public:
     std::vector<Round0BCMessage> bc_message_arr_;
 
-    Round1() : MPCRound(safeheron::mpc_flow::mpc_parallel_v2::MessageType::BROADCAST,
+    Round1() : MPCRoundT(safeheron::mpc_flow::mpc_parallel_v2::MessageType::BROADCAST,
                         safeheron::mpc_flow::mpc_parallel_v2::MessageType::BROADCAST) {}
 
     void Init() override;
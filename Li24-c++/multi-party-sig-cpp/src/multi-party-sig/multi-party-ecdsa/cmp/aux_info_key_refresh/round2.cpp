@@ -20,14 +20,14 @@ namespace cmp{
 namespace aux_info_key_refresh {
 
 void Round2::Init() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     for (int i = 0; i < ctx->get_total_parties() - 1; ++i) {
         bc_message_arr_.emplace_back();
     }
 }
 
 bool Round2::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     SignKey &sign_key = ctx->sign_key_;
 
     int pos = sign_key.get_remote_party_pos(party_id);
@@ -36,9 +36,9 @@ bool Round2::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
         return false;
     }
 
-    bool ok = bc_message_arr_[pos].FromBase64(bc_msg);
+    bool ok = ctx->DecodeMessage(bc_msg, bc_message_arr_[pos]);
     if (!ok) {
-        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to deserialize from base64!");
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to deserialize the message!");
         return false;
     }
 
@@ -46,7 +46,7 @@ bool Round2::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
 }
 
 bool Round2::ReceiveVerify(const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     SignKey &sign_key = ctx->sign_key_;
     bool ok = true;
     const Curve * curv = ctx->GetCurrentCurve();
@@ -188,7 +188,7 @@ bool Round2::ReceiveVerify(const std::string &party_id) {
 }
 
 bool Round2::ComputeVerify() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     SignKey &sign_key = ctx->sign_key_;
     bool ok = true;
     const curve::Curve *curv = ctx->GetCurrentCurve();
@@ -241,7 +241,7 @@ bool Round2::ComputeVerify() {
 
 bool Round2::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                              std::vector<std::string> &out_des_arr) const {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     SignKey &sign_key = ctx->sign_key_;
 
     out_p2p_msg_arr.clear();
@@ -262,9 +262,9 @@ bool Round2::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string
         p2p_message.C_ = ctx->remote_parties_[j].C_;
         p2p_message.psi_ij_ = ctx->remote_parties_[j].psi_;
         string base64;
-        bool ok = p2p_message.ToBase64(base64);
+        bool ok = ctx->EncodeMessage(p2p_message, base64);
         if (!ok) {
-            ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to encode to base64!");
+            ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to encode the message!");
             return false;
         }
         out_p2p_msg_arr.push_back(base64);
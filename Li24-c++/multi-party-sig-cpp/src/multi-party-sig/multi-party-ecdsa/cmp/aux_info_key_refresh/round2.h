@@ -12,11 +12,13 @@ namespace multi_party_ecdsa{
 namespace cmp{
 namespace aux_info_key_refresh {
 
-class Round2 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRound {
+class Context;
+
+class Round2 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRoundT<Context> {
 public:
     std::vector<Round1BCMessage> bc_message_arr_;
 
-    Round2() : MPCRound(safeheron::mpc_flow::mpc_parallel_v2::MessageType::BROADCAST,
+    Round2() : MPCRoundT(safeheron::mpc_flow::mpc_parallel_v2::MessageType::BROADCAST,
                         safeheron::mpc_flow::mpc_parallel_v2::MessageType::P2P) {}
 
     void Init() override;
@@ -19,14 +19,14 @@ namespace cmp{
 namespace aux_info_key_refresh {
 
 void Round3::Init() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     for (int j = 0; j < ctx->get_total_parties() - 1; ++j) {
         p2p_message_arr_.emplace_back();
     }
 }
 
 bool Round3::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     SignKey &sign_key = ctx->sign_key_;
 
     int pos = sign_key.get_remote_party_pos(party_id);
@@ -35,9 +35,9 @@ bool Round3::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
         return false;
     }
 
-    bool ok = p2p_message_arr_[pos].FromBase64(p2p_msg);
+    bool ok = ctx->DecodeMessage(p2p_msg, p2p_message_arr_[pos]);
     if (!ok) {
-        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to deserialize from base64!");
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to deserialize the message!");
         return false;
     }
 
@@ -45,7 +45,7 @@ bool Round3::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
 }
 
 bool Round3::ReceiveVerify(const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     SignKey &sign_key = ctx->sign_key_;
     const curve::Curve *curv = ctx->GetCurrentCurve();
     bool ok = true;
@@ -142,7 +142,7 @@ bool Round3::ReceiveVerify(const std::string &party_id) {
 
 bool Round3::ComputeVerify() {
     bool ok = true;
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     SignKey &sign_key = ctx->sign_key_;
     const curve::Curve *curv = ctx->GetCurrentCurve();
 
@@ -12,11 +12,13 @@ namespace multi_party_ecdsa{
 namespace cmp{
 namespace aux_info_key_refresh {
 
-class Round3 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRound {
+class Context;
+
+class Round3 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRoundT<Context> {
 public:
     std::vector<Round2P2PMessage> p2p_message_arr_;
 
-    Round3() : MPCRound(safeheron::mpc_flow::mpc_parallel_v2::MessageType::P2P,
+    Round3() : MPCRoundT(safeheron::mpc_flow::mpc_parallel_v2::MessageType::P2P,
                         safeheron::mpc_flow::mpc_parallel_v2::MessageType::None) {}
 
     void Init() override;
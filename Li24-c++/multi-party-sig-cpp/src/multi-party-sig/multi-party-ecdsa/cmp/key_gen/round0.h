@@ -5,9 +5,11 @@ namespace safeheron {
 namespace multi_party_ecdsa {
 namespace cmp {
 namespace key_gen {
-class Round0 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRound {
+class Context;
+
+class Round0 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRoundT<Context> {
 public:
-    Round0() : MPCRound(safeheron::mpc_flow::mpc_parallel_v2::MessageType::None,
+    Round0() : MPCRoundT(safeheron::mpc_flow::mpc_parallel_v2::MessageType::None,
                         safeheron::mpc_flow::mpc_parallel_v2::MessageType::None) {}
 
     bool ParseMsg(const std::string &p2p_msg, const std::string &bc_msg,
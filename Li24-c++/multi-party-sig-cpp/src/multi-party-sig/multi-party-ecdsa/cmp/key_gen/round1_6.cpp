@@ -6,7 +6,7 @@ namespace multi_party_ecdsa {
 namespace cmp {
 namespace key_gen {
 bool Round1_6::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
 
     bool ok = true;
     std::string err_info;
@@ -43,6 +43,7 @@ bool Round1_6::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, c
                 ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to create key refresh Context.");
                 return false;
             }
+            ctx->aux_info_key_refresh_ctx_.set_message_encoding(ctx->get_message_encoding());
             ok = ctx->aux_info_key_refresh_ctx_.PushMessage();
             if (!ok) {
                 err_info = safeheron::multi_party_ecdsa::cmp::get_err_info(ctx);
@@ -69,7 +70,7 @@ bool Round1_6::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, c
 
 bool Round1_6::MakeMessage(std::vector <std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                            std::vector <std::string> &out_des_arr) const {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     if (ctx->get_cur_round() < ctx->minimal_key_gen_ctx_.get_total_rounds() - 1) {
         ctx->minimal_key_gen_ctx_.PopMessages(out_p2p_msg_arr, out_bc_msg, out_des_arr);
     } else if (ctx->get_cur_round() < ctx->get_total_rounds() - 1) {
@@ -5,9 +5,11 @@ namespace safeheron {
 namespace multi_party_ecdsa {
 namespace cmp{
 namespace key_gen {
-class Round1_6 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRound {
+class Context;
+
+class Round1_6 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRoundT<Context> {
 public:
-    Round1_6() : MPCRound(safeheron::mpc_flow::mpc_parallel_v2::MessageType::None,
+    Round1_6() : MPCRoundT(safeheron::mpc_flow::mpc_parallel_v2::MessageType::None,
                           safeheron::mpc_flow::mpc_parallel_v2::MessageType::None) {}
 
     bool ParseMsg(const std::string &p2p_msg, const std::string &bc_msg,
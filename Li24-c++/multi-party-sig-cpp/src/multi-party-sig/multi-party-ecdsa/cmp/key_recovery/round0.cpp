@@ -11,7 +11,7 @@ namespace cmp {
 namespace key_recovery {
 
 bool Round0::ComputeVerify() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
 
     const safeheron::curve::Curve *curv = safeheron::curve::GetCurveParam(ctx->curve_type_);
     if (!curv) {
@@ -72,7 +72,7 @@ bool Round0::ComputeVerify() {
 
 bool Round0::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                          std::vector<std::string> &out_des_arr) const {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
 
     out_p2p_msg_arr.clear();
     out_bc_msg.clear();
@@ -83,9 +83,9 @@ bool Round0::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string
     std::string base64;
     Round0P2PMessage p2p_message;
     p2p_message.V_ = ctx->local_party_.V_i_;
-    bool ok = p2p_message.ToBase64(base64);
+    bool ok = ctx->EncodeMessage(p2p_message, base64);
     if (!ok) {
-        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed in bc_message.ToBase64(out_bc_msg)!");
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed in ctx->EncodeMessage(bc_message, out_bc_msg)!");
         return false;
     }
     out_p2p_msg_arr.push_back(base64);
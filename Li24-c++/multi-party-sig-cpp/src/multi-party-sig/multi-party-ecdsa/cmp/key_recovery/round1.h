@@ -7,11 +7,13 @@ namespace safeheron {
 namespace multi_party_ecdsa {
 namespace cmp {
 namespace key_recovery {
-class Round1 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRound {
+class Context;
+
+class Round1 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRoundT<Context> {
 public:
     Round0P2PMessage p2p_message_;
 
-    Round1() : MPCRound(safeheron::mpc_flow::mpc_parallel_v2::MessageType::P2P,
+    Round1() : MPCRoundT(safeheron::mpc_flow::mpc_parallel_v2::MessageType::P2P,
                         safeheron::mpc_flow::mpc_parallel_v2::MessageType::P2P) {}
 
     bool ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) override;
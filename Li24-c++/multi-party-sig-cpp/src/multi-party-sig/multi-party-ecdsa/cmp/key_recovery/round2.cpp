@@ -8,16 +8,16 @@ namespace cmp {
 namespace key_recovery {
 
 bool Round2::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
 
     if(party_id != ctx->remote_party_.party_id_) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Invalid party ID!");
         return false;
     }
 
-    bool ok = p2p_message_.FromBase64(p2p_msg);
+    bool ok = ctx->DecodeMessage(p2p_msg, p2p_message_);
     if (!ok) {
-        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to deserialize from base64!");
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to deserialize the message!");
         return false;
     }
 
@@ -25,7 +25,7 @@ bool Round2::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
 }
 
 bool Round2::ReceiveVerify(const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
 
     if (p2p_message_.i_ != ctx->local_party_.j_
         || p2p_message_.j_ != ctx->local_party_.i_
@@ -89,7 +89,7 @@ bool Round2::ReceiveVerify(const std::string &party_id) {
 }
 
 bool Round2::ComputeVerify() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     const safeheron::curve::Curve *curv = safeheron::curve::GetCurveParam(ctx->curve_type_);
     if (!curv) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "ctx->curve_type_ is invalid!");
@@ -134,7 +134,7 @@ bool Round2::ComputeVerify() {
 
 bool Round2::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                  std::vector<std::string> &out_des_arr) const {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
 
     out_p2p_msg_arr.clear();
     out_bc_msg.clear();
@@ -147,9 +147,9 @@ bool Round2::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string
     p2p_message.psi_ = ctx->local_party_.psi_i_;
 
     std::string base64;
-    bool ok = p2p_message.ToBase64(base64);
+    bool ok = ctx->EncodeMessage(p2p_message, base64);
     if (!ok) {
-        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed in bc_message.ToBase64(out_bc_msg)!");
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed in ctx->EncodeMessage(bc_message, out_bc_msg)!");
         return false;
     }
     out_p2p_msg_arr.push_back(base64);
@@ -18,7 +18,7 @@ namespace cmp{
 namespace minimal_key_gen {
 
 bool Round0::ComputeVerify() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     MinimalSignKey &minimal_sign_key = ctx->minimal_sign_key_;
     const curve::Curve* curv = ctx->GetCurrentCurve();
 
@@ -123,7 +123,7 @@ bool Round0::ComputeVerify() {
 
 bool Round0::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                              std::vector<std::string> &out_des_arr) const {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     MinimalSignKey &minimal_sign_key = ctx->minimal_sign_key_;
 
     out_p2p_msg_arr.clear();
@@ -138,9 +138,9 @@ bool Round0::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string
     bc_message.sid_ = ctx->sid_;
     bc_message.index_ = minimal_sign_key.local_party_.index_;
     bc_message.V_ = ctx->local_party_.V_;
-    bool ok = bc_message.ToBase64(out_bc_msg);
+    bool ok = ctx->EncodeMessage(bc_message, out_bc_msg);
     if (!ok) {
-        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed in bc_message.ToBase64(out_bc_msg)!");
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed in ctx->EncodeMessage(bc_message, out_bc_msg)!");
         return false;
     }
 
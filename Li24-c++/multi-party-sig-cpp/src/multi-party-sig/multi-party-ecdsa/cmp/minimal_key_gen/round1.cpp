@@ -17,14 +17,14 @@ namespace cmp{
 namespace minimal_key_gen {
 
 void Round1::Init() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     for (int j = 0; j < ctx->get_total_parties() - 1; ++j) {
         bc_message_arr_.emplace_back();
     }
 }
 
 bool Round1::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     MinimalSignKey &minimal_sign_key = ctx->minimal_sign_key_;
 
     int pos = minimal_sign_key.get_remote_party_pos(party_id);
@@ -33,9 +33,9 @@ bool Round1::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
         return false;
     }
 
-    bool ok = bc_message_arr_[pos].FromBase64(bc_msg);
+    bool ok = ctx->DecodeMessage(bc_msg, bc_message_arr_[pos]);
     if (!ok) {
-        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to deserialize from base64!");
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to deserialize the message!");
         return false;
     }
 
@@ -43,7 +43,7 @@ bool Round1::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
 }
 
 bool Round1::ReceiveVerify(const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     MinimalSignKey &minimal_sign_key = ctx->minimal_sign_key_;
     bool ok = true;
 
@@ -67,7 +67,7 @@ bool Round1::ReceiveVerify(const std::string &party_id) {
 }
 
 bool Round1::ComputeVerify() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     MinimalSignKey &minimal_sign_key = ctx->minimal_sign_key_;
 
     return true;
@@ -76,7 +76,7 @@ bool Round1::ComputeVerify() {
 bool Round1::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                              std::vector<std::string> &out_des_arr) const {
     bool ok = true;
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     MinimalSignKey &minimal_sign_key = ctx->minimal_sign_key_;
 
     out_p2p_msg_arr.clear();
@@ -93,9 +93,9 @@ bool Round1::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string
         p2p_message.index_ = minimal_sign_key.local_party_.index_;
         p2p_message.x_ij_ = ctx->local_party_.map_party_id_x_[minimal_sign_key.remote_parties_[j].party_id_];
         string base64;
-        bool ok = p2p_message.ToBase64(base64);
+        bool ok = ctx->EncodeMessage(p2p_message, base64);
         if (!ok) {
-            ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to encode to base64!");
+            ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to encode the message!");
             return false;
         }
         out_p2p_msg_arr.push_back(base64);
@@ -111,9 +111,9 @@ bool Round1::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string
     bc_message.c_ = ctx->local_party_.c_;
     bc_message.map_party_id_X_ = ctx->local_party_.map_party_id_X_;
     bc_message.u_ = ctx->local_party_.u_;
-    ok = bc_message.ToBase64(out_bc_msg);
+    ok = ctx->EncodeMessage(bc_message, out_bc_msg);
     if (!ok) {
-        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed in bc_message.ToBase64(out_bc_msg)!");
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed in ctx->EncodeMessage(bc_message, out_bc_msg)!");
         return false;
     }
 
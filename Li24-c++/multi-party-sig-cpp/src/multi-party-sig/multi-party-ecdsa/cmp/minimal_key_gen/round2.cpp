@@ -2,6 +2,7 @@
 #include "crypto-suites/crypto-hash/safe_hash256.h"
 #include "crypto-suites/crypto-encode/hex.h"
 #include "crypto-suites/crypto-sss/vsss.h"
+#include "multi-party-sig/multi-party-ecdsa/common/vss_batch_verifier.h"
 #include "multi-party-sig/mpc-flow/common/sid_maker.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/minimal_key_gen/context.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/minimal_key_gen/round2.h"
@@ -23,7 +24,7 @@ namespace cmp {
 namespace minimal_key_gen {
 
 void Round2::Init() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     for (int i = 0; i < ctx->get_total_parties() - 1; ++i) {
         bc_message_arr_.emplace_back();
         p2p_message_arr_.emplace_back();
@@ -31,7 +32,7 @@ void Round2::Init() {
 }
 
 bool Round2::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     MinimalSignKey &minimal_sign_key = ctx->minimal_sign_key_;
 
     int pos = minimal_sign_key.get_remote_party_pos(party_id);
@@ -40,15 +41,15 @@ bool Round2::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
         return false;
     }
 
-    bool ok = bc_message_arr_[pos].FromBase64(bc_msg);
+    bool ok = ctx->DecodeMessage(bc_msg, bc_message_arr_[pos]);
     if (!ok) {
-        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to deserialize from base64!");
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to deserialize the message!");
         return false;
     }
 
-    ok = p2p_message_arr_[pos].FromBase64(p2p_msg);
+    ok = ctx->DecodeMessage(p2p_msg, p2p_message_arr_[pos]);
     if (!ok) {
-        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to deserialize from base64!");
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to deserialize the message!");
         return false;
     }
 
@@ -56,7 +57,7 @@ bool Round2::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
 }
 
 bool Round2::ReceiveVerify(const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     MinimalSignKey &minimal_sign_key = ctx->minimal_sign_key_;
     bool ok = true;
     const Curve *curv = ctx->GetCurrentCurve();
@@ -133,18 +134,7 @@ bool Round2::ReceiveVerify(const std::string &party_id) {
         return false;
     }
 
-    // check x_ij according to Feldman Commitment
-    ok = safeheron::sss::vsss::VerifyShare(bc_message_arr_[pos].c_,
-                                           minimal_sign_key.threshold_,
-                                                     minimal_sign_key.local_party_.index_,
-                                                     p2p_message_arr_[pos].x_ij_,
-                                                     curv->g,
-                                                     curv->n);
-    if (!ok) {
-        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__,
-                           "ok = safeheron::sss::vsss::VerifyShare(message_arr_[pos].F_arr_, minimal_sign_key.remote_parties_[pos].index_, message_arr_[pos].x_ij_)");
-        return false;
-    }
+    // x_ij is checked against the Feldman commitment of all the peers at once in ComputeVerify
 
     iter = bc_message_arr_[pos].map_party_id_X_.find(minimal_sign_key.local_party_.party_id_);
     if(iter == ctx->remote_parties_[pos].map_party_id_X_.end()){
@@ -183,11 +173,25 @@ bool Round2::ReceiveVerify(const std::string &party_id) {
 }
 
 bool Round2::ComputeVerify() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     MinimalSignKey &minimal_sign_key = ctx->minimal_sign_key_;
     bool ok = true;
     const curve::Curve *curv = ctx->GetCurrentCurve();
 
+    // Check the shares of all the peers with one multi-scalar multiplication
+    safeheron::multi_party_ecdsa::common::VssBatchVerifier vss_verifier(ctx->GetCurrentCurveType(), (int)minimal_sign_key.threshold_, minimal_sign_key.local_party_.index_);
+    for (size_t i = 0; i < bc_message_arr_.size(); ++i) {
+        vss_verifier.Add(bc_message_arr_[i].c_, p2p_message_arr_[i].x_ij_);
+    }
+    std::vector<size_t> failed_arr;
+    if (!vss_verifier.Verify(failed_arr)) {
+        for (size_t pos : failed_arr) {
+            ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed in VerifyShare for party " + minimal_sign_key.remote_parties_[pos].party_id_ + "!");
+        }
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to verify the shares!");
+        return false;
+    }
+
     BN x = ctx->local_party_.map_party_id_x_[minimal_sign_key.local_party_.party_id_];
     for (size_t j = 0; j < ctx->remote_parties_.size(); ++j) {
         x = (x + ctx->remote_parties_[j].x_ij_) % curv->n;
@@ -230,7 +234,7 @@ bool Round2::ComputeVerify() {
 
 bool Round2::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                              std::vector<std::string> &out_des_arr) const {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     MinimalSignKey &minimal_sign_key = ctx->minimal_sign_key_;
 
     out_p2p_msg_arr.clear();
@@ -246,9 +250,9 @@ bool Round2::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string
     bc_message.index_ = minimal_sign_key.local_party_.index_;
     bc_message.psi_ = ctx->local_party_.psi_;
     bc_message.phi_ = ctx->local_party_.phi_;
-    bool ok = bc_message.ToBase64(out_bc_msg);
+    bool ok = ctx->EncodeMessage(bc_message, out_bc_msg);
     if (!ok) {
-        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed in bc_message.ToBase64(out_bc_msg)!");
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed in ctx->EncodeMessage(bc_message, out_bc_msg)!");
         return false;
     }
 
@@ -12,12 +12,14 @@ namespace multi_party_ecdsa{
 namespace cmp{
 namespace minimal_key_gen {
 
-class Round2 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRound {
+class Context;
+
+class Round2 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRoundT<Context> {
 public:
     std::vector<Round1BCMessage> bc_message_arr_;
     std::vector<Round1P2PMessage> p2p_message_arr_;
 
-    Round2() : MPCRound(safeheron::mpc_flow::mpc_parallel_v2::MessageType::P2P_BROADCAST,
+    Round2() : MPCRoundT(safeheron::mpc_flow::mpc_parallel_v2::MessageType::P2P_BROADCAST,
                         safeheron::mpc_flow::mpc_parallel_v2::MessageType::BROADCAST) {}
 
     void Init() override;
@@ -12,11 +12,13 @@ namespace multi_party_ecdsa{
 namespace cmp{
 namespace minimal_key_gen {
 
-class Round3 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRound {
+class Context;
+
+class Round3 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRoundT<Context> {
 public:
     std::vector<Round2BCMessage> bc_message_arr_;
 
-    Round3() : MPCRound(safeheron::mpc_flow::mpc_parallel_v2::MessageType::BROADCAST,
+    Round3() : MPCRoundT(safeheron::mpc_flow::mpc_parallel_v2::MessageType::BROADCAST,
                         safeheron::mpc_flow::mpc_parallel_v2::MessageType::None) {}
 
     void Init() override;
@@ -0,0 +1,169 @@
+#include "crypto-suites/crypto-bn/rand.h"
+#include "multi-party-sig/multi-party-ecdsa/cmp/pail_precompute.h"
+
+using std::string;
+using safeheron::bignum::BN;
+
+namespace safeheron {
+namespace multi_party_ecdsa{
+namespace cmp{
+
+static string ModulusKey(const BN &N) {
+    string key;
+    N.ToHexStr(key);
+    return key;
+}
+
+PailPrecompute::PailPrecompute(const SignKey &sign_key): fill_target_(0), stop_(false) {
+    local_party_id_ = sign_key.local_party_.party_id_;
+    p_ = sign_key.local_party_.p_;
+    q_ = sign_key.local_party_.q_;
+
+    local_key_ = ModulusKey(sign_key.local_party_.N_);
+    Modulus &local = modulus_map_[local_key_];
+    local.N_ = sign_key.local_party_.N_;
+    local.N_sqr_ = local.N_ * local.N_;
+    for (const auto &remote_party : sign_key.remote_parties_) {
+        Modulus &remote = modulus_map_[ModulusKey(remote_party.N_)];
+        remote.N_ = remote_party.N_;
+        remote.N_sqr_ = remote.N_ * remote.N_;
+    }
+}
+
+PailPrecompute::~PailPrecompute() {
+    StopBackgroundFill();
+}
+
+bool PailPrecompute::Match(const SignKey &sign_key) const {
+    return sign_key.local_party_.party_id_ == local_party_id_
+           && ModulusKey(sign_key.local_party_.N_) == local_key_;
+}
+
+PailPrecompute::Modulus *PailPrecompute::FindModulus(const BN &N) {
+    auto iter = modulus_map_.find(ModulusKey(N));
+    return iter == modulus_map_.end() ? nullptr : &iter->second;
+}
+
+const PailPrecompute::Modulus *PailPrecompute::FindModulus(const BN &N) const {
+    auto iter = modulus_map_.find(ModulusKey(N));
+    return iter == modulus_map_.end() ? nullptr : &iter->second;
+}
+
+void PailPrecompute::InitCRT() {
+    std::call_once(crt_once_, [this]() {
+        const BN &N = modulus_map_.at(local_key_).N_;
+        p_sqr_ = p_ * p_;
+        q_sqr_ = q_ * q_;
+        // The order of Z_{p^2}* is p(p-1), so the exponent can be reduced modulo it.
+        exp_p_ = N % (p_ * (p_ - 1));
+        exp_q_ = N % (q_ * (q_ - 1));
+        p_sqr_inv_ = p_sqr_.InvM(q_sqr_);
+    });
+}
+
+BN PailPrecompute::PowN(const BN &N, const BN &r) {
+    const Modulus *modulus = FindModulus(N);
+    if (modulus == nullptr) return r.PowM(N, N * N);
+    if (&modulus_map_.at(local_key_) != modulus || p_ * q_ != N) return r.PowM(N, modulus->N_sqr_);
+
+    InitCRT();
+    // x = x_p + p^2 * ((x_q - x_p) * (p^2)^-1 mod q^2)
+    BN x_p = (r % p_sqr_).PowM(exp_p_, p_sqr_);
+    BN x_q = (r % q_sqr_).PowM(exp_q_, q_sqr_);
+    BN h = ((x_q - x_p) * p_sqr_inv_) % q_sqr_;
+    if (h.IsNeg()) h += q_sqr_;
+    return x_p + p_sqr_ * h;
+}
+
+PailPrecompute::Nonce PailPrecompute::ComputeNonce(const Modulus &modulus) {
+    Nonce nonce;
+    nonce.r_ = safeheron::rand::RandomBNLtCoPrime(modulus.N_);
+    nonce.r_pow_n_ = PowN(modulus.N_, nonce.r_);
+    return nonce;
+}
+
+void PailPrecompute::TakeNonce(const BN &N, BN &r, BN &r_pow_n) {
+    Modulus *modulus = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        modulus = FindModulus(N);
+        if (modulus && !modulus->pool_.empty()) {
+            r = modulus->pool_.front().r_;
+            r_pow_n = modulus->pool_.front().r_pow_n_;
+            modulus->pool_.pop_front();
+            cond_.notify_all();
+            return;
+        }
+    }
+
+    if (modulus == nullptr) {
+        r = safeheron::rand::RandomBNLtCoPrime(N);
+        r_pow_n = r.PowM(N, N * N);
+        return;
+    }
+    Nonce nonce = ComputeNonce(*modulus);
+    r = nonce.r_;
+    r_pow_n = nonce.r_pow_n_;
+}
+
+BN PailPrecompute::EncryptNeg(const BN &N, const BN &m, BN &r) {
+    BN r_pow_n;
+    TakeNonce(N, r, r_pow_n);
+    BN N_sqr = N * N;
+    BN t_m = m % N;
+    if (t_m.IsNeg()) t_m += N;
+    // g = N + 1, so g^m = 1 + m * N mod N^2
+    return ((t_m * N + 1) * r_pow_n) % N_sqr;
+}
+
+void PailPrecompute::StartBackgroundFill(size_t nonce_count) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    fill_target_ = nonce_count;
+    if (fill_thread_.joinable()) {
+        cond_.notify_all();
+        return;
+    }
+    stop_ = false;
+    fill_thread_ = std::thread(&PailPrecompute::FillLoop, this);
+}
+
+void PailPrecompute::StopBackgroundFill() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    cond_.notify_all();
+    if (fill_thread_.joinable()) fill_thread_.join();
+}
+
+size_t PailPrecompute::pool_size(const BN &N) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const Modulus *modulus = FindModulus(N);
+    return modulus ? modulus->pool_.size() : 0;
+}
+
+void PailPrecompute::FillLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stop_) {
+        // Refill the emptiest pool first, so that every modulus gets nonces early.
+        Modulus *target = nullptr;
+        for (auto &item : modulus_map_) {
+            if (item.second.pool_.size() >= fill_target_) continue;
+            if (target == nullptr || item.second.pool_.size() < target->pool_.size()) target = &item.second;
+        }
+        if (target == nullptr) {
+            cond_.wait(lock);
+            continue;
+        }
+
+        // The entries of modulus_map_ are never erased, so target stays valid without the lock.
+        lock.unlock();
+        Nonce nonce = ComputeNonce(*target);
+        lock.lock();
+        target->pool_.push_back(nonce);
+    }
+}
+
+}
+}
+}
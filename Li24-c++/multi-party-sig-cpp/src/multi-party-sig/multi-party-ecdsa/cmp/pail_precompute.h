@@ -0,0 +1,127 @@
+#ifndef SAFEHERON_MULTI_PARTY_ECDSA_CMP_PAIL_PRECOMPUTE_H
+#define SAFEHERON_MULTI_PARTY_ECDSA_CMP_PAIL_PRECOMPUTE_H
+
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "crypto-suites/crypto-bn/bn.h"
+#include "multi-party-sig/multi-party-ecdsa/cmp/sign_key.h"
+
+namespace safeheron {
+namespace multi_party_ecdsa{
+namespace cmp{
+
+/**
+ * Paillier precomputation bound to one sign key, shared by every sign::Context created from that key.
+ *
+ * - r^N mod N^2 for the local modulus is computed with CRT over p^2 and q^2, which is about three times faster than
+ *   a plain exponentiation mod N^2.
+ * - A pool of nonces (r, r^N mod N^2) is kept for the local modulus and for the modulus of every remote party. The pool
+ *   can be filled by a background thread, otherwise the nonces are computed on demand.
+ *
+ * All the methods are thread safe.
+ */
+class PailPrecompute {
+public:
+    /**
+     * Nothing is computed here: the CRT parameters are set up on first use.
+     */
+    explicit PailPrecompute(const SignKey &sign_key);
+
+    ~PailPrecompute();
+
+    PailPrecompute(const PailPrecompute &) = delete;
+
+    PailPrecompute &operator=(const PailPrecompute &) = delete;
+
+    /**
+     * Whether the precomputation was built from the given key.
+     */
+    bool Match(const SignKey &sign_key) const;
+
+    /**
+     * Take a random nonce r in Z_N* together with r^N mod N^2.
+     * N must be the Paillier modulus of the local party or of one of the remote parties of the key.
+     */
+    void TakeNonce(const safeheron::bignum::BN &N, safeheron::bignum::BN &r, safeheron::bignum::BN &r_pow_n);
+
+    /**
+     * Compute r^N mod N^2, with CRT if N is the local modulus.
+     */
+    safeheron::bignum::BN PowN(const safeheron::bignum::BN &N, const safeheron::bignum::BN &r);
+
+    /**
+     * Paillier encryption with a fresh nonce: c = (1 + m * N) * r^N mod N^2, where m may be negative.
+     * The nonce is returned in r.
+     */
+    safeheron::bignum::BN EncryptNeg(const safeheron::bignum::BN &N, const safeheron::bignum::BN &m, safeheron::bignum::BN &r);
+
+    /**
+     * Start a background thread which keeps nonce_count nonces ready for every modulus of the key.
+     */
+    void StartBackgroundFill(size_t nonce_count);
+
+    /**
+     * Stop the background thread. The nonces already computed are kept.
+     */
+    void StopBackgroundFill();
+
+    /**
+     * Number of nonces ready for modulus N.
+     */
+    size_t pool_size(const safeheron::bignum::BN &N) const;
+
+private:
+    struct Nonce {
+        safeheron::bignum::BN r_;
+        safeheron::bignum::BN r_pow_n_;
+    };
+
+    struct Modulus {
+        safeheron::bignum::BN N_;
+        safeheron::bignum::BN N_sqr_;
+        std::deque<Nonce> pool_;
+    };
+
+    Modulus *FindModulus(const safeheron::bignum::BN &N);
+
+    const Modulus *FindModulus(const safeheron::bignum::BN &N) const;
+
+    void InitCRT();
+
+    Nonce ComputeNonce(const Modulus &modulus);
+
+    void FillLoop();
+
+private:
+    std::string local_party_id_;
+    safeheron::bignum::BN p_;
+    safeheron::bignum::BN q_;
+
+    // CRT parameters of the local modulus, set once by InitCRT()
+    std::once_flag crt_once_;
+    safeheron::bignum::BN p_sqr_;
+    safeheron::bignum::BN q_sqr_;
+    safeheron::bignum::BN exp_p_;        // N mod p(p-1)
+    safeheron::bignum::BN exp_q_;        // N mod q(q-1)
+    safeheron::bignum::BN p_sqr_inv_;    // (p^2)^-1 mod q^2
+
+    // Keyed by the hex string of N. The first entry added is the local modulus.
+    std::map<std::string, Modulus> modulus_map_;
+    std::string local_key_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable cond_;
+    std::thread fill_thread_;
+    size_t fill_target_;
+    bool stop_;
+};
+
+}
+}
+}
+
+#endif //SAFEHERON_MULTI_PARTY_ECDSA_CMP_PAIL_PRECOMPUTE_H
@@ -0,0 +1,29 @@
+#include "crypto-suites/crypto-curve/curve.h"
+#include "crypto-suites/crypto-sss/polynomial.h"
+#include "multi-party-sig/multi-party-ecdsa/cmp/quorum.h"
+
+using std::vector;
+using safeheron::bignum::BN;
+using safeheron::curve::Curve;
+using safeheron::sss::Polynomial;
+
+namespace safeheron {
+namespace multi_party_ecdsa{
+namespace cmp{
+
+bool Quorum::Compute(const SignKey &sign_key) {
+    const Curve *curv = safeheron::curve::GetCurveParam(sign_key.X_.GetCurveType());
+    if (curv == nullptr) return false;
+
+    vector<BN> share_index_arr;
+    for (size_t i = 0; i < sign_key.remote_parties_.size(); ++i) {
+        share_index_arr.push_back(sign_key.remote_parties_[i].index_);
+    }
+    share_index_arr.push_back(sign_key.local_party_.index_);
+    Polynomial::GetLArray(l_arr_, BN::ZERO, share_index_arr, curv->n);
+    return true;
+}
+
+}
+}
+}
@@ -0,0 +1,32 @@
+#ifndef SAFEHERON_MULTI_PARTY_ECDSA_CMP_QUORUM_H
+#define SAFEHERON_MULTI_PARTY_ECDSA_CMP_QUORUM_H
+
+#include <vector>
+#include "crypto-suites/crypto-bn/bn.h"
+#include "multi-party-sig/multi-party-ecdsa/cmp/sign_key.h"
+
+namespace safeheron {
+namespace multi_party_ecdsa{
+namespace cmp{
+
+/**
+ * The values of a signature which only depend on the sign key and on the set of signers.
+ * SignKeyHandle caches them for every set of signers, so that the next signatures skip the modular inversions.
+ */
+class Quorum {
+public:
+    /**
+     * Compute the values for a sign key trimmed to the signers.
+     */
+    bool Compute(const SignKey &sign_key);
+
+public:
+    // Lagrange coefficients at 0: the remote parties in the order of the sign key, then the local party.
+    std::vector<safeheron::bignum::BN> l_arr_;
+};
+
+}
+}
+}
+
+#endif //SAFEHERON_MULTI_PARTY_ECDSA_CMP_QUORUM_H
@@ -12,8 +12,10 @@
 
 using std::vector;
 using safeheron::bignum::BN;
-using safeheron::sss::Polynomial;
 using safeheron::multi_party_ecdsa::cmp::SignKey;
+using safeheron::multi_party_ecdsa::cmp::SignKeyHandle;
+using safeheron::multi_party_ecdsa::cmp::Quorum;
+using safeheron::multi_party_ecdsa::cmp::PailPrecompute;
 using safeheron::exception::LocatedException;
 using safeheron::mpc_flow::common::SIDMaker;
 
@@ -35,6 +37,7 @@ Context::Context(const Context &ctx): MPCContext(ctx){
     ssid_ = ctx.ssid_;
     sign_key_ = ctx.sign_key_;
     m_ = ctx.m_;
+    pail_precompute_ = ctx.pail_precompute_;
 
     local_party_ = ctx.local_party_;
     remote_parties_ = ctx.remote_parties_;
@@ -75,6 +78,7 @@ Context &Context::operator=(const Context &ctx){
     ssid_ = ctx.ssid_;
     sign_key_ = ctx.sign_key_;
     m_ = ctx.m_;
+    pail_precompute_ = ctx.pail_precompute_;
 
     local_party_ = ctx.local_party_;
     remote_parties_ = ctx.remote_parties_;
@@ -106,21 +110,13 @@ Context &Context::operator=(const Context &ctx){
     return *this;
 }
 
-static void PreprocessSignKey(SignKey &sign_key){
-    // Compute Lagrange interpolation coefficients {lambda_i} for each party that
+static void PreprocessSignKey(SignKey &sign_key, const vector<BN> &l_arr){
+    // The Lagrange interpolation coefficients {lambda_i} for each party that
     //              lambda_i = \Prod_m { x_m / {x_m - x_j}
     // which could be used to compute private key
     //              x = \sum_i { x_i * lambda_i }  mod q
-    vector<BN> share_index_arr;
-    for (size_t i = 0; i < sign_key.remote_parties_.size(); ++i) {
-        share_index_arr.push_back(sign_key.remote_parties_[i].index_);
-    }
-    share_index_arr.push_back(sign_key.local_party_.index_);
-
     const safeheron::curve::Curve * curv = safeheron::curve::GetCurveParam(sign_key.X_.GetCurveType());
 
-    vector<BN> l_arr;
-    Polynomial::GetLArray(l_arr, BN::ZERO, share_index_arr, curv->n);
     // Compute:
     // - the additive key shard pair (x_i, X_i) where X_i = g * x_i for local party
     // - and additive public key shards for remote parties.
@@ -135,17 +131,60 @@ bool Context::CreateContext(Context &ctx,
                             const std::string &sign_key_base64,
                             const safeheron::bignum::BN &m,
                             const std::string &ssid) {
+    return CreateContext(ctx, sign_key_base64, m, ssid, nullptr);
+}
+
+bool Context::CreateContext(Context &ctx,
+                            const std::string &sign_key_base64,
+                            const safeheron::bignum::BN &m,
+                            const std::string &ssid,
+                            const std::shared_ptr<PailPrecompute> &pail_precompute) {
     bool ok = true;
 
     // Parse the sign key
     SignKey &sign_key = ctx.sign_key_;
     ok = sign_key.FromBase64(sign_key_base64);
     if (!ok) return false;
+
+    return InitWithSignKey(ctx, m, ssid, pail_precompute, nullptr);
+}
+
+bool Context::CreateContext(Context &ctx,
+                            const SignKeyHandle &sign_key_handle,
+                            const std::vector<std::string> &participant_id_arr,
+                            const safeheron::bignum::BN &m,
+                            const std::string &ssid,
+                            const std::shared_ptr<PailPrecompute> &pail_precompute) {
+    bool ok = true;
+
+    // Take the sign key of the signers
+    ok = sign_key_handle.Trim(ctx.sign_key_, participant_id_arr);
+    if (!ok) return false;
+    std::shared_ptr<const Quorum> quorum = sign_key_handle.GetQuorum(ctx.sign_key_);
+    if (!quorum) return false;
+
+    return InitWithSignKey(ctx, m, ssid, pail_precompute, quorum);
+}
+
+bool Context::InitWithSignKey(Context &ctx,
+                              const safeheron::bignum::BN &m,
+                              const std::string &ssid,
+                              const std::shared_ptr<PailPrecompute> &pail_precompute,
+                              const std::shared_ptr<const Quorum> &quorum) {
+    bool ok = true;
+    SignKey &sign_key = ctx.sign_key_;
     ok = ((int)sign_key.n_parties_ == ctx.get_total_parties());
     if (!ok) return false;
 
     // Preprocessing to generate additive shards
-    PreprocessSignKey(sign_key);
+    if (quorum) {
+        PreprocessSignKey(sign_key, quorum->l_arr_);
+    } else {
+        Quorum local_quorum;
+        ok = local_quorum.Compute(sign_key);
+        if (!ok) return false;
+        PreprocessSignKey(sign_key, local_quorum.l_arr_);
+    }
 
     ctx.m_ = m;
 
@@ -164,6 +203,14 @@ bool Context::CreateContext(Context &ctx,
         ctx.remote_parties_[i].pail_pub_ = safeheron::pail::PailPubKey(sign_key.remote_parties_[i].N_, sign_key.remote_parties_[i].N_ + 1);
     }
 
+    // Reuse the Paillier precomputation of the key if there is one
+    if (pail_precompute) {
+        if (!pail_precompute->Match(sign_key)) return false;
+        ctx.pail_precompute_ = pail_precompute;
+    } else {
+        ctx.pail_precompute_ = std::make_shared<PailPrecompute>(sign_key);
+    }
+
     ctx.ComputeSSID(ssid);
     ctx.ComputeSSID_Index();
 
@@ -2,12 +2,15 @@
 #ifndef SAFEHERON_MULTI_PARTY_ECDSA_CMP_SIGN_CONTEXT_H
 #define SAFEHERON_MULTI_PARTY_ECDSA_CMP_SIGN_CONTEXT_H
 
+#include <memory>
 #include <vector>
 #include "crypto-suites/crypto-curve/curve.h"
 #include "crypto-suites/crypto-bn/bn.h"
 #include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_context.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/util.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/sign_key.h"
+#include "multi-party-sig/multi-party-ecdsa/cmp/sign_key_handle.h"
+#include "multi-party-sig/multi-party-ecdsa/cmp/pail_precompute.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/sign/t_party.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/sign/round0.h"
 #include "multi-party-sig/multi-party-ecdsa/cmp/sign/round1.h"
@@ -45,6 +48,28 @@ public:
                               const safeheron::bignum::BN &m,
                               const std::string &ssid);
 
+    /**
+     * Same as above, but reuse the Paillier precomputation of the key. Share one PailPrecompute between all the
+     * contexts created from the same sign key.
+     */
+    static bool CreateContext(Context &ctx,
+                              const std::string &sign_key_base64,
+                              const safeheron::bignum::BN &m,
+                              const std::string &ssid,
+                              const std::shared_ptr<safeheron::multi_party_ecdsa::cmp::PailPrecompute> &pail_precompute);
+
+    /**
+     * Same as above, but take the sign key from a handle, so that it is neither decoded nor trimmed from base64 again.
+     * @param participant_id_arr all the parties that take part in the signature.
+     * @param pail_precompute may be null, then the context creates its own.
+     */
+    static bool CreateContext(Context &ctx,
+                              const safeheron::multi_party_ecdsa::cmp::SignKeyHandle &sign_key_handle,
+                              const std::vector<std::string> &participant_id_arr,
+                              const safeheron::bignum::BN &m,
+                              const std::string &ssid,
+                              const std::shared_ptr<safeheron::multi_party_ecdsa::cmp::PailPrecompute> &pail_precompute = nullptr);
+
     const safeheron::curve::Curve * GetCurrentCurve() const{
         assert(sign_key_.X_.GetCurveType() != safeheron::curve::CurveType::INVALID_CURVE);
         const safeheron::curve::Curve* curv = safeheron::curve::GetCurveParam(sign_key_.X_.GetCurveType());;
@@ -105,10 +130,19 @@ public:
 
     void ComputeSSID_Index();
 
+private:
+    // Set up the context once sign_key_ is in place. The quorum is computed here if it is null.
+    static bool InitWithSignKey(Context &ctx,
+                                const safeheron::bignum::BN &m,
+                                const std::string &ssid,
+                                const std::shared_ptr<safeheron::multi_party_ecdsa::cmp::PailPrecompute> &pail_precompute,
+                                const std::shared_ptr<const safeheron::multi_party_ecdsa::cmp::Quorum> &quorum);
+
 public:
     std::string ssid_;
     safeheron::multi_party_ecdsa::cmp::SignKey sign_key_;
     safeheron::bignum::BN m_;
+    std::shared_ptr<safeheron::multi_party_ecdsa::cmp::PailPrecompute> pail_precompute_;
 
     LocalTParty local_party_;
     std::vector<RemoteTParty> remote_parties_;
@@ -29,7 +29,7 @@ namespace cmp{
 namespace sign {
 
 bool Round0::ComputeVerify() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     const SignKey &sign_key = ctx->sign_key_;
     const safeheron::curve::Curve * curv = ctx->GetCurrentCurve();
 
@@ -37,17 +37,14 @@ bool Round0::ComputeVerify() {
     ctx->local_party_.k_ = safeheron::rand::RandomBNLt(curv->n);
     ctx->local_party_.gamma_ = safeheron::rand::RandomBNLt(curv->n);
 
-    // Sample \rho_i, \nu_i in ZN*
-    ctx->local_party_.rho_ = safeheron::rand::RandomBNLtCoPrime(ctx->local_party_.pail_pub_.n());
-    ctx->local_party_.nu_ = safeheron::rand::RandomBNLtCoPrime(ctx->local_party_.pail_pub_.n());
-
     // \Gamma_i = g * \gamma_i
     ctx->local_party_.Gamma_ = curv->g * ctx->local_party_.gamma_;
 
+    // Sample \rho_i, \nu_i in ZN* from the nonce pool of the key
     // G_i = enc_i(\gamma_i, \nu_i)
-    ctx->local_party_.G_ = ctx->local_party_.pail_pub_.EncryptNegWithR(ctx->local_party_.gamma_, ctx->local_party_.nu_);
+    ctx->local_party_.G_ = ctx->pail_precompute_->EncryptNeg(ctx->local_party_.pail_pub_.n(), ctx->local_party_.gamma_, ctx->local_party_.nu_);
     // K_i = enc_i(\k_i, \rho_i)
-    ctx->local_party_.K_ = ctx->local_party_.pail_pub_.EncryptNegWithR(ctx->local_party_.k_, ctx->local_party_.rho_);
+    ctx->local_party_.K_ = ctx->pail_precompute_->EncryptNeg(ctx->local_party_.pail_pub_.n(), ctx->local_party_.k_, ctx->local_party_.rho_);
 
     // MTA(k, gamma) / MTA(k, x)   - step 1
     // Party i prove to party j that K_i = enc_i(\k_i, \rho_i),  i != j
@@ -73,7 +70,7 @@ bool Round0::ComputeVerify() {
 bool Round0::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                              std::vector<std::string> &out_des_arr) const {
     bool ok = true;
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     out_p2p_msg_arr.clear();
@@ -90,9 +87,9 @@ bool Round0::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string
         p2p_message.index_ = sign_key.local_party_.index_;
         p2p_message.psi_0_ij_ = ctx->remote_parties_[j].psi_0_ji_;
         string base64;
-        ok = p2p_message.ToBase64(base64);
+        ok = ctx->EncodeMessage(p2p_message, base64);
         if (!ok) {
-            ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to encode to base64!");
+            ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to encode the message!");
             return false;
         }
         out_p2p_msg_arr.push_back(base64);
@@ -103,9 +100,9 @@ bool Round0::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string
     bc_message.index_ = sign_key.local_party_.index_;
     bc_message.K_ = ctx->local_party_.K_;
     bc_message.G_ = ctx->local_party_.G_;
-    ok = bc_message.ToBase64(out_bc_msg);
+    ok = ctx->EncodeMessage(bc_message, out_bc_msg);
     if (!ok) {
-        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed in bc_message.ToBase64(out_bc_msg)!");
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed in ctx->EncodeMessage(bc_message, out_bc_msg)!");
         return false;
     }
 
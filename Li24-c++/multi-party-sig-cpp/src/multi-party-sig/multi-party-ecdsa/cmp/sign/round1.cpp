@@ -12,6 +12,7 @@ using safeheron::curve::CurvePoint;
 using safeheron::curve::Curve;
 using safeheron::sss::Polynomial;
 using safeheron::multi_party_ecdsa::cmp::SignKey;
+using safeheron::multi_party_ecdsa::cmp::PailPrecompute;
 using safeheron::zkp::pail::PailEncRangeSetUp_V2;
 using safeheron::zkp::pail::PailEncRangeStatement_V2;
 using safeheron::zkp::pail::PailEncRangeWitness_V2;
@@ -27,6 +28,7 @@ using safeheron::zkp::pail::PailEncGroupEleRangeProof;
 using safeheron::zkp::pail::PailAffRangeSetUp;
 using safeheron::zkp::pail::PailAffRangeStatement;
 using safeheron::zkp::pail::PailAffRangeProof;
+using safeheron::mpc_flow::mpc_parallel_v2::ParallelFor;
 
 static BN POW2_256 = BN(1) << 256;
 
@@ -36,7 +38,7 @@ namespace cmp{
 namespace sign {
 
 void Round1::Init() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     for (int j = 0; j < ctx->get_total_parties() - 1; ++j) {
         bc_message_arr_.emplace_back();
         p2p_message_arr_.emplace_back();
@@ -44,7 +46,7 @@ void Round1::Init() {
 }
 
 bool Round1::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const safeheron::curve::Curve * curv = ctx->GetCurrentCurve();
@@ -55,17 +57,17 @@ bool Round1::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
         return false;
     }
 
-    bool ok = bc_message_arr_[pos].FromBase64(bc_msg);
+    bool ok = ctx->DecodeMessage(bc_msg, bc_message_arr_[pos]);
     if (!ok) {
         ctx->Identify(party_id, ctx->get_cur_round());
-        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to deserialize from base64!");
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to deserialize the message!");
         return false;
     }
 
-    ok = p2p_message_arr_[pos].FromBase64(p2p_msg);
+    ok = ctx->DecodeMessage(p2p_msg, p2p_message_arr_[pos]);
     if (!ok) {
         ctx->Identify(party_id, ctx->get_cur_round());
-        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to deserialize from base64!");
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to deserialize the message!");
         return false;
     }
 
@@ -74,7 +76,7 @@ bool Round1::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
 
 bool Round1::ReceiveVerify(const std::string &party_id) {
     bool ok = true;
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const safeheron::curve::Curve * curv = ctx->GetCurrentCurve();
@@ -145,41 +147,42 @@ bool Round1::ReceiveVerify(const std::string &party_id) {
  *                = enc(remote_pub, alpha)
  * - cypher_beta = enc(local_pub, beta)
  *
+ * The nonces are taken from the precomputed pool of the key.
+ *
+ * @param pail_precompute
  * @param remote_pub
  * @param local_pub
  * @param c_a
  * @param b
  * @param beta
- * @param r1_lt_coprime_remote_pail_n
- * @param r2_lt_coprime_local_pail_n
+ * @param r1_lt_coprime_remote_pail_n: [out] nonce of cypher_alpha
+ * @param r2_lt_coprime_local_pail_n: [out] nonce of cypher_beta
  * @param cypher_alpha
  * @param cypher_beta
  */
-static void MTA_Step2(const pail::PailPubKey &remote_pub, const pail::PailPubKey &local_pub,
+static void MTA_Step2(PailPrecompute &pail_precompute,
+               const pail::PailPubKey &remote_pub, const pail::PailPubKey &local_pub,
                const BN &cypher_a, const BN &b, const BN &beta,
-               const BN &r1_lt_coprime_remote_pail_n,
-               const BN &r2_lt_coprime_local_pail_n,
+               BN &r1_lt_coprime_remote_pail_n,
+               BN &r2_lt_coprime_local_pail_n,
                BN &cypher_alpha,
                BN &cypher_beta){
     // cypher_alpha = a <hMul> b  <hAdd> negative_beta
     BN bma = remote_pub.HomomorphicMulPlain(cypher_a, b);
-    cypher_alpha = remote_pub.HomomorphicAddPlainWithR(bma, beta.Neg(), r1_lt_coprime_remote_pail_n);
-    cypher_beta = local_pub.EncryptNegWithR(beta.Neg(), r2_lt_coprime_local_pail_n);
+    cypher_alpha = (bma * pail_precompute.EncryptNeg(remote_pub.n(), beta.Neg(), r1_lt_coprime_remote_pail_n)) % remote_pub.n_sqr();
+    cypher_beta = pail_precompute.EncryptNeg(local_pub.n(), beta.Neg(), r2_lt_coprime_local_pail_n);
 }
 
 bool Round1::ComputeVerify() {
     bool ok = true;
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const safeheron::curve::Curve * curv = ctx->GetCurrentCurve();
-    for (size_t i = 0; i < ctx->remote_parties_.size(); ++i) {
+    // The work for each remote party is independent, spread it over the executor of the context if there is one.
+    ParallelFor(ctx->get_executor(), ctx->remote_parties_.size(), [&](size_t i) {
         // MTA(k, gamma) / MTA(k, x)
-        // Sample r_ij, s_ij, \hat{r}_ij, \hat{s}_ij in Zn*
-        ctx->remote_parties_[i].r_ij_ = safeheron::rand::RandomBNLtCoPrime(sign_key.local_party_.N_);
-        ctx->remote_parties_[i].s_ij_ = safeheron::rand::RandomBNLtCoPrime(sign_key.remote_parties_[i].N_);
-        ctx->remote_parties_[i].r_hat_ij_ = safeheron::rand::RandomBNLtCoPrime(sign_key.local_party_.N_);
-        ctx->remote_parties_[i].s_hat_ij_ = safeheron::rand::RandomBNLtCoPrime(sign_key.remote_parties_[i].N_);
+        // r_ij, s_ij, \hat{r}_ij, \hat{s}_ij in Zn* are taken from the nonce pool in MTA_Step2
 
         // Sample \beta_ij, \hat{beta}_ij in limit_J
         ctx->remote_parties_[i].beta_ij_ = safeheron::rand::RandomNegBNInSymInterval(SECURITY_PARAM_LIMIT_J);
@@ -188,7 +191,8 @@ bool Round1::ComputeVerify() {
         //MTA(k, gamma) - step 2
         // D_ji = (\gamma_i ☉ K_j ) ⨁ enc_j(-\beta_ij, s_ij)
         // F_ji = enc_i(-\beta_ij, r_ij)
-        MTA_Step2(ctx->remote_parties_[i].pail_pub_,
+        MTA_Step2(*ctx->pail_precompute_,
+                  ctx->remote_parties_[i].pail_pub_,
                   ctx->local_party_.pail_pub_,
                   ctx->remote_parties_[i].K_,
                   ctx->local_party_.gamma_,
@@ -201,7 +205,8 @@ bool Round1::ComputeVerify() {
         //MTA(k, x) - step 2
         // \hat{D}_ji = (\x_i ☉ K_j ) ⨁ enc_j(-\hat{\beta}_ij, \hat{s}_ij)
         // \hat{F}_ji = enc_i(-\hat{\beta}_ij, \hat{r}_ij)
-        MTA_Step2(ctx->remote_parties_[i].pail_pub_,
+        MTA_Step2(*ctx->pail_precompute_,
+                  ctx->remote_parties_[i].pail_pub_,
                   ctx->local_party_.pail_pub_,
                   ctx->remote_parties_[i].K_,
                   sign_key.local_party_.x_,
@@ -287,7 +292,7 @@ bool Round1::ComputeVerify() {
 
         ctx->remote_parties_[i].psi_prime_ji_.SetSalt(ctx->local_party_.ssid_index_);
         ctx->remote_parties_[i].psi_prime_ji_.Prove(setup_3, statement_3, witness_3);
-    }
+    });
 
     return true;
 }
@@ -295,7 +300,7 @@ bool Round1::ComputeVerify() {
 bool Round1::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                              std::vector<std::string> &out_des_arr) const {
     bool ok = true;
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     out_p2p_msg_arr.clear();
@@ -319,9 +324,9 @@ bool Round1::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string
         p2p_message.psi_hat_ij_ = ctx->remote_parties_[j].psi_hat_ji_;
         p2p_message.psi_prime_ij_ = ctx->remote_parties_[j].psi_prime_ji_;
         string base64;
-        ok = p2p_message.ToBase64(base64);
+        ok = ctx->EncodeMessage(p2p_message, base64);
         if (!ok) {
-            ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to encode to base64!");
+            ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to encode the message!");
             return false;
         }
         out_p2p_msg_arr.push_back(base64);
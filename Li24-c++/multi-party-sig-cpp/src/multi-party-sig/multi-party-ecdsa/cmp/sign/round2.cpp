@@ -40,6 +40,7 @@ using safeheron::zkp::pail::PailEncGroupEleRangeProof;
 using safeheron::zkp::pail::PailAffRangeSetUp;
 using safeheron::zkp::pail::PailAffRangeStatement;
 using safeheron::zkp::pail::PailAffRangeProof;
+using safeheron::mpc_flow::mpc_parallel_v2::ParallelFor;
 
 static BN POW2_256 = BN(1) << 256;
 
@@ -49,14 +50,14 @@ namespace cmp{
 namespace sign {
 
 void Round2::Init() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     for (int j = 0; j < ctx->get_total_parties() - 1; ++j) {
         p2p_message_arr_.emplace_back();
     }
 }
 
 bool Round2::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const safeheron::curve::Curve * curv = ctx->GetCurrentCurve();
@@ -69,10 +70,10 @@ bool Round2::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
     }
 
     // bool ok = message_arr_[pos].FromBase64(msg);
-    bool ok = p2p_message_arr_[pos].FromBase64(p2p_msg);
+    bool ok = ctx->DecodeMessage(p2p_msg, p2p_message_arr_[pos]);
     if (!ok) {
         ctx->Identify(party_id, ctx->get_cur_round());
-        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to deserialize from base64!");
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to deserialize the message!");
         return false;
     }
 
@@ -81,7 +82,7 @@ bool Round2::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
 
 bool Round2::ReceiveVerify(const std::string &party_id) {
     bool ok = true;
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const Curve * curv = ctx->GetCurrentCurve();
@@ -196,7 +197,7 @@ bool Round2::ReceiveVerify(const std::string &party_id) {
 
 bool Round2::ComputeVerify() {
     bool ok = true;
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const safeheron::curve::Curve * curv = ctx->GetCurrentCurve();
@@ -216,12 +217,12 @@ bool Round2::ComputeVerify() {
     // - \hat{\alpha}_ij = dec_i{\hat{D}_ij}
     // - \delta_i = \gamma_i * \k_i + \Sum_{j!=i}{ \alpha_ij       + \beta_ij        }     mod q
     // - \chi_i   = x_i      * \k_i + \Sum_{j!=i}{ \hat{\alpha}_ij + \hat{\beta}_ij  }     mod q
-    for (size_t j = 0; j < ctx->remote_parties_.size(); ++j) {
+    ParallelFor(ctx->get_executor(), ctx->remote_parties_.size(), [&](size_t j) {
         // \alpha_ij = dec_i{D_ij}
         ctx->remote_parties_[j].alpha_ij_ = ctx->local_party_.pail_priv_.DecryptNeg(p2p_message_arr_[j].D_ij_);
         // \hat{\alpha}_ij = dec_i{\hat{D}_ij}
         ctx->remote_parties_[j].alpha_hat_ij_ = ctx->local_party_.pail_priv_.DecryptNeg(p2p_message_arr_[j].D_hat_ij_);
-    }
+    });
 
     // \delta_i = \gamma_i * \k_i + \Sum_{j!=i}{ \alpha_ij + \beta_ij }     mod q
     BN delta = ctx->local_party_.gamma_ * ctx->local_party_.k_;
@@ -240,7 +241,8 @@ bool Round2::ComputeVerify() {
     // For j != i, party i prove to party j that according to \PI^{log*}
     // - K_i = enc_i(\k_i, \rho_i)
     // - \Delta_i = \Gamma_i * \k_i
-    for (size_t j = 0; j < ctx->remote_parties_.size(); ++j) {
+    // The proofs for different parties are independent, spread them over the executor of the context if there is one.
+    ParallelFor(ctx->get_executor(), ctx->remote_parties_.size(), [&](size_t j) {
         PailEncGroupEleRangeSetUp setup(sign_key.remote_parties_[j].N_,
                                           sign_key.remote_parties_[j].s_,
                                           sign_key.remote_parties_[j].t_);
@@ -259,7 +261,7 @@ bool Round2::ComputeVerify() {
 
         ctx->remote_parties_[j].psi_double_prime_ji_.SetSalt(ctx->local_party_.ssid_index_);
         ctx->remote_parties_[j].psi_double_prime_ji_.Prove(setup, statement, witness);
-    }
+    });
 
     return true;
 }
@@ -267,7 +269,7 @@ bool Round2::ComputeVerify() {
 bool Round2::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                              std::vector<std::string> &out_des_arr) const {
     bool ok = true;
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     out_p2p_msg_arr.clear();
@@ -286,9 +288,9 @@ bool Round2::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string
         p2p_message.Delta_ = ctx->local_party_.Delta_;
         p2p_message.psi_double_prime_ij_ = ctx->remote_parties_[j].psi_double_prime_ji_;
         string base64;
-        ok = p2p_message.ToBase64(base64);
+        ok = ctx->EncodeMessage(p2p_message, base64);
         if (!ok) {
-            ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to encode to base64!");
+            ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to encode the message!");
             return false;
         }
         out_p2p_msg_arr.push_back(base64);
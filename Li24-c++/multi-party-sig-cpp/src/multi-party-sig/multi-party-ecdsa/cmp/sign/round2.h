@@ -13,11 +13,13 @@ namespace cmp{
 namespace sign {
 
 
-class Round2 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRound {
+class Context;
+
+class Round2 : public safeheron::mpc_flow::mpc_parallel_v2::MPCRoundT<Context> {
 public:
     std::vector<Round1P2PMessage> p2p_message_arr_;
 
-    Round2() : MPCRound(safeheron::mpc_flow::mpc_parallel_v2::MessageType::P2P,
+    Round2() : MPCRoundT(safeheron::mpc_flow::mpc_parallel_v2::MessageType::P2P,
                         safeheron::mpc_flow::mpc_parallel_v2::MessageType::P2P) {}
 
     void Init() override;
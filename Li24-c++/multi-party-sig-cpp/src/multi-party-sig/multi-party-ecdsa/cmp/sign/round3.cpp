@@ -1,3 +1,4 @@
+#include <vector>
 #include "crypto-suites/crypto-curve/curve.h"
 #include "crypto-suites/crypto-bn/rand.h"
 #include "crypto-suites/crypto-hash/safe_hash256.h"
@@ -31,6 +32,7 @@ using safeheron::zkp::pail::PailDecModuloSetUp;
 using safeheron::zkp::pail::PailDecModuloStatement;
 using safeheron::zkp::pail::PailDecModuloWitness;
 using safeheron::zkp::pail::PailDecModuloProof;
+using safeheron::mpc_flow::mpc_parallel_v2::ParallelFor;
 
 static BN POW2_256 = BN(1) << 256;
 
@@ -56,14 +58,14 @@ static BN get_rho_in_pail_cypher(const BN& c, const BN& m, const BN& N, const BN
 }
 
 void Round3::Init() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     for (int j = 0; j < ctx->get_total_parties() - 1; ++j) {
         p2p_message_arr_.emplace_back();
     }
 }
 
 bool Round3::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const safeheron::curve::Curve * curv = ctx->GetCurrentCurve();
@@ -76,10 +78,10 @@ bool Round3::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
     }
 
     // bool ok = message_arr_[pos].FromBase64(msg);
-    bool ok = p2p_message_arr_[pos].FromBase64(p2p_msg);
+    bool ok = ctx->DecodeMessage(p2p_msg, p2p_message_arr_[pos]);
     if (!ok) {
         ctx->Identify(party_id, ctx->get_cur_round());
-        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to deserialize from base64!");
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to deserialize the message!");
         return false;
     }
 
@@ -88,7 +90,7 @@ bool Round3::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
 
 bool Round3::ReceiveVerify(const std::string &party_id) {
     bool ok = true;
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     const SignKey &sign_key = ctx->sign_key_;
     const Curve * curv = ctx->GetCurrentCurve();
 
@@ -141,7 +143,7 @@ bool Round3::ReceiveVerify(const std::string &party_id) {
 bool Round3::ComputeVerify() {
     bool ok = true;
     // Validate child private key share
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const safeheron::curve::Curve * curv = ctx->GetCurrentCurve();
@@ -180,7 +182,7 @@ bool Round3::ComputeVerify() {
 bool Round3::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                              std::vector<std::string> &out_des_arr) const {
     bool ok = true;
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     out_p2p_msg_arr.clear();
@@ -197,9 +199,9 @@ bool Round3::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string
         p2p_message.index_ = sign_key.local_party_.index_;
         p2p_message.sigma_ = ctx->local_party_.sigma_;
         string base64;
-        ok = p2p_message.ToBase64(base64);
+        ok = ctx->EncodeMessage(p2p_message, base64);
         if (!ok) {
-            ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to encode to base64!");
+            ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to encode the message!");
             return false;
         }
         out_p2p_msg_arr.push_back(base64);
@@ -210,54 +212,64 @@ bool Round3::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string
 
 bool Round3::BuildProof() {
     bool ok = true;
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const safeheron::curve::Curve *curv = ctx->GetCurrentCurve();
 
     // (a) For l != i, party i reprove to party l that {D_{j,i}}_{j!=i,l} are well formed according to \PI^{aff-g}
-    for (size_t l = 0; l < ctx->remote_parties_.size(); ++l) {
+    // Every (l, j) proof is independent: compute them into their own slots on the executor of the context if there
+    // is one, then fill the map in order.
+    const size_t n_remote = ctx->remote_parties_.size();
+    std::vector<PailAffGroupEleRangeProof_V2> id_proof_arr(n_remote * n_remote);
+    ParallelFor(ctx->get_executor(), n_remote * n_remote, [&](size_t k) {
+        size_t l = k / n_remote;
+        size_t j = k % n_remote;
+        if (l == j) return;
+        // Prove to party l that D_{j,i} is well formed
         safeheron::zkp::pail::PailAffGroupEleRangeSetUp_V2 setup(sign_key.remote_parties_[l].N_,
                                                                  sign_key.remote_parties_[l].s_,
                                                                  sign_key.remote_parties_[l].t_);
-        // For each j != i,l, prove {D_{j,i}}_{j!=i,l} are well formed
-        for (size_t j = 0; j < ctx->remote_parties_.size(); ++j) {
-            if (j != l) {
-                PailAffGroupEleRangeStatement_V2 statement(
-                        ctx->remote_parties_[j].pail_pub_.n(),
-                        ctx->remote_parties_[j].pail_pub_.n_sqr(),
-                        ctx->local_party_.pail_pub_.n(),
-                        ctx->local_party_.pail_pub_.n_sqr(),
-                        ctx->remote_parties_[j].K_,
-                        ctx->remote_parties_[j].D_ji,
-                        ctx->remote_parties_[j].F_ji,
-                        ctx->local_party_.Gamma_,
-                        curv->n,
-                        SECURITY_PARAM_L,
-                        SECURITY_PARAM_L_PRIME,
-                        SECURITY_PARAM_EPSILON);
+        PailAffGroupEleRangeStatement_V2 statement(
+                ctx->remote_parties_[j].pail_pub_.n(),
+                ctx->remote_parties_[j].pail_pub_.n_sqr(),
+                ctx->local_party_.pail_pub_.n(),
+                ctx->local_party_.pail_pub_.n_sqr(),
+                ctx->remote_parties_[j].K_,
+                ctx->remote_parties_[j].D_ji,
+                ctx->remote_parties_[j].F_ji,
+                ctx->local_party_.Gamma_,
+                curv->n,
+                SECURITY_PARAM_L,
+                SECURITY_PARAM_L_PRIME,
+                SECURITY_PARAM_EPSILON);
 
-                PailAffGroupEleRangeWitness_V2 witness(
-                        ctx->local_party_.gamma_,
-                        ctx->remote_parties_[j].beta_ij_.Neg(),
-                        ctx->remote_parties_[j].s_ij_,
-                        ctx->remote_parties_[j].r_ij_);
+        PailAffGroupEleRangeWitness_V2 witness(
+                ctx->local_party_.gamma_,
+                ctx->remote_parties_[j].beta_ij_.Neg(),
+                ctx->remote_parties_[j].s_ij_,
+                ctx->remote_parties_[j].r_ij_);
 
-                PailAffGroupEleRangeProof_V2 proof;
-                proof.SetSalt(ctx->local_party_.ssid_index_);
-                proof.Prove(setup, statement, witness);
-                ctx->proof_in_pre_sign_phase_.id_map_map_[sign_key.remote_parties_[l].party_id_][sign_key.remote_parties_[j].party_id_] = proof;
+        PailAffGroupEleRangeProof_V2 &proof = id_proof_arr[k];
+        proof.SetSalt(ctx->local_party_.ssid_index_);
+        proof.Prove(setup, statement, witness);
+    });
+    for (size_t l = 0; l < n_remote; ++l) {
+        for (size_t j = 0; j < n_remote; ++j) {
+            if (l != j) {
+                ctx->proof_in_pre_sign_phase_.id_map_map_[sign_key.remote_parties_[l].party_id_][sign_key.remote_parties_[j].party_id_] = id_proof_arr[l * n_remote + j];
             }
         }
     }
 
 
     // (b) Compute H_i = Enc_i(k_i, gamma_i) and prove in ZK that H_i is well formed wrt K_i and G_i in \PI^{mul}
-    // Sample rho in Z_N*
-    BN rho = safeheron::rand::RandomBNLtCoPrime(sign_key.local_party_.N_);
+    // Sample rho in Z_N* from the nonce pool of the key
+    BN rho, rho_pow_n;
+    ctx->pail_precompute_->TakeNonce(sign_key.local_party_.N_, rho, rho_pow_n);
     // c_k_gamma = G^k * rho^N  mod N^2
     BN c_k_gamma = (ctx->local_party_.G_.PowM(ctx->local_party_.k_, ctx->local_party_.pail_pub_.n_sqr())
-                    * rho.PowM(ctx->local_party_.pail_pub_.n(), ctx->local_party_.pail_pub_.n_sqr())) %
+                    * rho_pow_n) %
                    ctx->local_party_.pail_pub_.n_sqr();
     PailEncMulStatement statement(
             ctx->local_party_.pail_pub_.n(),
@@ -306,7 +318,8 @@ bool Round3::BuildProof() {
     // prove that
     // - c_deta = Enc(raw_deta, rho)
     // - raw_delta = delta mod q
-    for (size_t l = 0; l < ctx->remote_parties_.size(); ++l) {
+    std::vector<PailDecModuloProof> dec_proof_arr(ctx->remote_parties_.size());
+    ParallelFor(ctx->get_executor(), ctx->remote_parties_.size(), [&](size_t l) {
         safeheron::zkp::pail::PailDecModuloSetUp setup(sign_key.remote_parties_[l].N_,
                                                        sign_key.remote_parties_[l].s_,
                                                        sign_key.remote_parties_[l].t_);
@@ -323,10 +336,12 @@ bool Round3::BuildProof() {
                 raw_delta,
                 final_rho);
 
-        PailDecModuloProof proof;
+        PailDecModuloProof &proof = dec_proof_arr[l];
         proof.SetSalt(ctx->local_party_.ssid_index_);
         proof.Prove(setup, statement, witness);
-        ctx->proof_in_pre_sign_phase_.id_dec_proof_map_[sign_key.remote_parties_[l].party_id_] = proof;
+    });
+    for (size_t l = 0; l < ctx->remote_parties_.size(); ++l) {
+        ctx->proof_in_pre_sign_phase_.id_dec_proof_map_[sign_key.remote_parties_[l].party_id_] = dec_proof_arr[l];
     }
 
     return true;
@@ -338,7 +353,7 @@ bool Round3::VerifyProof(
         std::map<std::string, std::map<std::string, safeheron::bignum::BN>> &all_F) {
     bool ok = true;
 
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const safeheron::curve::Curve *curv = ctx->GetCurrentCurve();
@@ -32,6 +32,7 @@ using safeheron::zkp::pail::PailMulGroupEleRangeSetUp;
 using safeheron::zkp::pail::PailMulGroupEleRangeStatement;
 using safeheron::zkp::pail::PailMulGroupEleRangeWitness;
 using safeheron::zkp::pail::PailMulGroupEleRangeProof;
+using safeheron::mpc_flow::mpc_parallel_v2::ParallelFor;
 
 static BN POW2_256 = BN(1) << 256;
 
@@ -58,14 +59,14 @@ static BN get_rho_in_pail_cypher(const BN& c, const BN& m, const BN& N, const BN
 
 
 void Round4::Init() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     for (int j = 0; j < ctx->get_total_parties() - 1; ++j) {
         p2p_message_arr_.emplace_back();
     }
 }
 
 bool Round4::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const safeheron::curve::Curve * curv = ctx->GetCurrentCurve();
@@ -78,10 +79,10 @@ bool Round4::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
     }
 
     // bool ok = message_arr_[pos].FromBase64(msg);
-    bool ok = p2p_message_arr_[pos].FromBase64(p2p_msg);
+    bool ok = ctx->DecodeMessage(p2p_msg, p2p_message_arr_[pos]);
     if (!ok) {
         ctx->Identify(party_id, ctx->get_cur_round());
-        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to deserialize from base64!");
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to deserialize the message!");
         return false;
     }
 
@@ -91,7 +92,7 @@ bool Round4::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
 
 bool Round4::ReceiveVerify(const std::string &party_id) {
     bool ok = true;
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const safeheron::curve::Curve * curv = ctx->GetCurrentCurve();
@@ -124,7 +125,7 @@ bool Round4::ReceiveVerify(const std::string &party_id) {
 
 bool Round4::ComputeVerify() {
     bool ok = true;
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     const SignKey &sign_key = ctx->sign_key_;
     const Curve * curv = ctx->GetCurrentCurve();
 
@@ -166,58 +167,70 @@ bool Round4::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string
 bool Round4::BuildProof() {
     bool ok = true;
     // Validate child private key share
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const safeheron::curve::Curve *curv = ctx->GetCurrentCurve();
 
     // In case of failure in Figure 8, then retrieve the presigning transcript and do:
     // (a) For l != i, party i reprove to party l that {\hat{D}_{j,i}}_{j!=i,l} are well formed according to \PI^{aff-g}
-    for (size_t l = 0; l < ctx->remote_parties_.size(); ++l) {
+    // Every (l, j) proof is independent: compute them into their own slots on the executor of the context if there
+    // is one, then fill the map in order.
+    const size_t n_remote = ctx->remote_parties_.size();
+    std::vector<PailAffGroupEleRangeProof_V2> id_proof_arr(n_remote * n_remote);
+    ParallelFor(ctx->get_executor(), n_remote * n_remote, [&](size_t k) {
+        size_t l = k / n_remote;
+        size_t j = k % n_remote;
+        if (l == j) return;
+        // Prove to party l that \hat{D}_{j,i} is well formed
         safeheron::zkp::pail::PailAffGroupEleRangeSetUp_V2 setup(sign_key.remote_parties_[l].N_,
                                                                  sign_key.remote_parties_[l].s_,
                                                                  sign_key.remote_parties_[l].t_);
-        for (size_t j = 0; j < ctx->remote_parties_.size(); ++j) {
-            if (l != j) {
-                PailAffGroupEleRangeStatement_V2 statement(
-                        ctx->remote_parties_[j].pail_pub_.n(),
-                        ctx->remote_parties_[j].pail_pub_.n_sqr(),
-                        ctx->local_party_.pail_pub_.n(),
-                        ctx->local_party_.pail_pub_.n_sqr(),
-                        ctx->remote_parties_[j].K_,
-                        ctx->remote_parties_[j].D_hat_ji,
-                        ctx->remote_parties_[j].F_hat_ji,
-                        sign_key.local_party_.X_,
-                        curv->n,
-                        SECURITY_PARAM_L,
-                        SECURITY_PARAM_L_PRIME,
-                        SECURITY_PARAM_EPSILON);
+        PailAffGroupEleRangeStatement_V2 statement(
+                ctx->remote_parties_[j].pail_pub_.n(),
+                ctx->remote_parties_[j].pail_pub_.n_sqr(),
+                ctx->local_party_.pail_pub_.n(),
+                ctx->local_party_.pail_pub_.n_sqr(),
+                ctx->remote_parties_[j].K_,
+                ctx->remote_parties_[j].D_hat_ji,
+                ctx->remote_parties_[j].F_hat_ji,
+                sign_key.local_party_.X_,
+                curv->n,
+                SECURITY_PARAM_L,
+                SECURITY_PARAM_L_PRIME,
+                SECURITY_PARAM_EPSILON);
 
-                PailAffGroupEleRangeWitness_V2 witness(
-                        sign_key.local_party_.x_,
-                        ctx->remote_parties_[j].beta_hat_ij_.Neg(),
-                        ctx->remote_parties_[j].s_hat_ij_,
-                        ctx->remote_parties_[j].r_hat_ij_);
+        PailAffGroupEleRangeWitness_V2 witness(
+                sign_key.local_party_.x_,
+                ctx->remote_parties_[j].beta_hat_ij_.Neg(),
+                ctx->remote_parties_[j].s_hat_ij_,
+                ctx->remote_parties_[j].r_hat_ij_);
 
-                PailAffGroupEleRangeProof_V2 proof;
-                proof.SetSalt(ctx->local_party_.ssid_index_);
-                proof.Prove(setup, statement, witness);
-                ctx->proof_in_sign_phase_.id_map_map_[sign_key.remote_parties_[l].party_id_][sign_key.remote_parties_[j].party_id_] = proof;
+        PailAffGroupEleRangeProof_V2 &proof = id_proof_arr[k];
+        proof.SetSalt(ctx->local_party_.ssid_index_);
+        proof.Prove(setup, statement, witness);
+    });
+    for (size_t l = 0; l < n_remote; ++l) {
+        for (size_t j = 0; j < n_remote; ++j) {
+            if (l != j) {
+                ctx->proof_in_sign_phase_.id_map_map_[sign_key.remote_parties_[l].party_id_][sign_key.remote_parties_[j].party_id_] = id_proof_arr[l * n_remote + j];
             }
         }
     }
 
 
     // (b) Compute H_i = Enc_i(k_i, x_i) and prove in ZK that \hat{H}_i is well formed wrt K_i and X_i in \PI^{mul*}
-    // Sample rho in Z_N*
-    BN rho = safeheron::rand::RandomBNLtCoPrime(sign_key.local_party_.N_);
+    // Sample rho in Z_N* from the nonce pool of the key
+    BN rho, rho_pow_n;
+    ctx->pail_precompute_->TakeNonce(sign_key.local_party_.N_, rho, rho_pow_n);
     // c_k_x = K^x * rho^N  mod N^2
     BN c_k_x = (ctx->local_party_.K_.PowM(sign_key.local_party_.x_, ctx->local_party_.pail_pub_.n_sqr())
-                    * rho.PowM(ctx->local_party_.pail_pub_.n(), ctx->local_party_.pail_pub_.n_sqr())) %
+                    * rho_pow_n) %
                    ctx->local_party_.pail_pub_.n_sqr();
     ctx->proof_in_sign_phase_.c_k_x_ = c_k_x;
 
-    for (size_t l = 0; l < ctx->remote_parties_.size(); ++l) {
+    std::vector<PailMulGroupEleRangeProof> mul_proof_arr(ctx->remote_parties_.size());
+    ParallelFor(ctx->get_executor(), ctx->remote_parties_.size(), [&](size_t l) {
         PailMulGroupEleRangeSetUp setup(sign_key.remote_parties_[l].N_,
                                                        sign_key.remote_parties_[l].s_,
                                                        sign_key.remote_parties_[l].t_);
@@ -234,11 +247,12 @@ bool Round4::BuildProof() {
 
         PailMulGroupEleRangeWitness witness(sign_key.local_party_.x_, rho);
 
-        PailMulGroupEleRangeProof proof;
+        PailMulGroupEleRangeProof &proof = mul_proof_arr[l];
         proof.SetSalt(ctx->local_party_.ssid_index_);
         proof.Prove(setup, statement, witness);
-        ctx->proof_in_sign_phase_.id_mul_group_ele_proof_map_[sign_key.remote_parties_[l].party_id_] = proof;
-
+    });
+    for (size_t l = 0; l < ctx->remote_parties_.size(); ++l) {
+        ctx->proof_in_sign_phase_.id_mul_group_ele_proof_map_[sign_key.remote_parties_[l].party_id_] = mul_proof_arr[l];
     }
 
     // (c) For l != i, prove in ZK that \sigma is the plaintext value mod q of the cypher text obtained as
@@ -275,12 +289,13 @@ bool Round4::BuildProof() {
     BN raw_sigma = ctx->local_party_.k_ * ctx->m_ + r * raw_chi;
 
 
-    BN t_c_sigma = ( (raw_sigma * ctx->local_party_.pail_pub_.n() + 1) * final_rho.PowM(ctx->local_party_.pail_pub_.n(), ctx->local_party_.pail_pub_.n_sqr()) ) % ctx->local_party_.pail_pub_.n_sqr();
+    BN t_c_sigma = ( (raw_sigma * ctx->local_party_.pail_pub_.n() + 1) * ctx->pail_precompute_->PowN(ctx->local_party_.pail_pub_.n(), final_rho) ) % ctx->local_party_.pail_pub_.n_sqr();
 
     // Prove that:
     //         - c_sigma = Enc(raw_sigma, final_rho) = K_i^m * (\hat{H}_i * \PI_{j!=i}{\hat{D}_{i,j} * \hat{F}_{j,i}})^r
     //         - raw_sigma = sigma mod q
-    for (size_t l = 0; l < ctx->remote_parties_.size(); ++l) {
+    std::vector<PailDecModuloProof> dec_proof_arr(ctx->remote_parties_.size());
+    ParallelFor(ctx->get_executor(), ctx->remote_parties_.size(), [&](size_t l) {
         safeheron::zkp::pail::PailDecModuloSetUp setup(sign_key.remote_parties_[l].N_,
                                                        sign_key.remote_parties_[l].s_,
                                                        sign_key.remote_parties_[l].t_);
@@ -297,10 +312,12 @@ bool Round4::BuildProof() {
                 raw_sigma,
                 final_rho);
 
-        PailDecModuloProof proof;
+        PailDecModuloProof &proof = dec_proof_arr[l];
         proof.SetSalt(ctx->local_party_.ssid_index_);
         proof.Prove(setup, statement, witness);
-        ctx->proof_in_sign_phase_.id_dec_proof_map_[sign_key.remote_parties_[l].party_id_] = proof;
+    });
+    for (size_t l = 0; l < ctx->remote_parties_.size(); ++l) {
+        ctx->proof_in_sign_phase_.id_dec_proof_map_[sign_key.remote_parties_[l].party_id_] = dec_proof_arr[l];
     }
 
     return true;
@@ -312,7 +329,7 @@ bool Round4::VerifyProof(
         std::map<std::string, std::map<std::string, safeheron::bignum::BN>> &all_F_hat) {
     bool ok = true;
 
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const safeheron::curve::Curve *curv = ctx->GetCurrentCurve();
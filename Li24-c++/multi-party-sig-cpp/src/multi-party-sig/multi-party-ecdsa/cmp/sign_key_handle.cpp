@@ -0,0 +1,59 @@
+#include "multi-party-sig/multi-party-ecdsa/cmp/sign_key_handle.h"
+#include "multi-party-sig/multi-party-ecdsa/cmp/util.h"
+
+using std::string;
+using std::vector;
+
+// Signer sets are few and stable, the bound only protects against a caller which signs with every possible subset.
+static const size_t MAX_CACHED_QUORUMS = 1024;
+
+namespace safeheron {
+namespace multi_party_ecdsa{
+namespace cmp{
+
+std::shared_ptr<const SignKeyHandle> SignKeyHandle::FromBase64(const string &sign_key_base64) {
+    SignKey sign_key;
+    if (!sign_key.FromBase64(sign_key_base64)) return nullptr;
+    return FromSignKey(sign_key);
+}
+
+std::shared_ptr<const SignKeyHandle> SignKeyHandle::FromSignKey(const SignKey &sign_key) {
+    if (!sign_key.ValidityTest()) return nullptr;
+    return std::shared_ptr<const SignKeyHandle>(new SignKeyHandle(sign_key));
+}
+
+bool SignKeyHandle::Trim(SignKey &out_sign_key, const vector<string> &participant_id_arr) const {
+    bool ok = true;
+    out_sign_key = sign_key_;
+    ok = trim_sign_key(out_sign_key, participant_id_arr);
+    if (!ok) return false;
+
+    // The whole key is validated already
+    if (out_sign_key.remote_parties_.size() == sign_key_.remote_parties_.size()) return true;
+    return out_sign_key.ValidityTest();
+}
+
+std::shared_ptr<const Quorum> SignKeyHandle::GetQuorum(const SignKey &trimmed_sign_key) const {
+    string quorum_key;
+    for (const auto &remote_party : trimmed_sign_key.remote_parties_) {
+        quorum_key += std::to_string(remote_party.party_id_.size()) + ":" + remote_party.party_id_;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto iter = quorum_map_.find(quorum_key);
+        if (iter != quorum_map_.end()) return iter->second;
+    }
+
+    std::shared_ptr<Quorum> quorum = std::make_shared<Quorum>();
+    if (!quorum->Compute(trimmed_sign_key)) return nullptr;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (quorum_map_.size() >= MAX_CACHED_QUORUMS) quorum_map_.clear();
+    quorum_map_[quorum_key] = quorum;
+    return quorum;
+}
+
+}
+}
+}
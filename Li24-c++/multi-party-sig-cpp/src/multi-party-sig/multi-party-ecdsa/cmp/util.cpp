@@ -60,13 +60,8 @@ int compare_bytes(const std::string &left, const std::string &right){
     return (left.size() < right.size()) ? -1 : 1;
 }
 
-bool trim_sign_key(std::string &out_sign_key_base64, const std::string &in_sign_key_base64, const std::vector<std::string> &participant_id_arr){
-    bool ok = true;
-    SignKey sign_key;
-    ok = sign_key.FromBase64(in_sign_key_base64);
-    if(!ok) return false;
-
-    ok = (find_party_id(sign_key.local_party_.party_id_, participant_id_arr) != -1);
+bool trim_sign_key(SignKey &sign_key, const std::vector<std::string> &participant_id_arr){
+    bool ok = (find_party_id(sign_key.local_party_.party_id_, participant_id_arr) != -1);
     if(!ok) return false;
 
     auto iter = sign_key.remote_parties_.begin();
@@ -82,7 +77,19 @@ bool trim_sign_key(std::string &out_sign_key_base64, const std::string &in_sign_
     ok = (sign_key.threshold_ <= (sign_key.remote_parties_.size() + 1));
     if(!ok) return false;
 
-    sign_key.n_parties_ = sign_key.remote_parties_.size() + 1;
+    sign_key.n_parties_ = (sign_key.remote_parties_.size() + 1);
+    return true;
+}
+
+bool trim_sign_key(std::string &out_sign_key_base64, const std::string &in_sign_key_base64, const std::vector<std::string> &participant_id_arr){
+    bool ok = true;
+    SignKey sign_key;
+    ok = sign_key.FromBase64(in_sign_key_base64);
+    if(!ok) return false;
+
+    ok = trim_sign_key(sign_key, participant_id_arr);
+    if(!ok) return false;
+
     ok = sign_key.ValidityTest();
     if (!ok) return false;
 
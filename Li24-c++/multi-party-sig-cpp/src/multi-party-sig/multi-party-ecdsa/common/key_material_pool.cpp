@@ -0,0 +1,360 @@
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <openssl/evp.h>
+#include "crypto-suites/crypto-bn/rand.h"
+#include "crypto-suites/crypto-zkp/zkp.h"
+#include "crypto-suites/crypto-paillier/proto_gen/paillier.pb.switch.h"
+#include "multi-party-sig/multi-party-ecdsa/common/key_material_pool.h"
+
+using std::string;
+using safeheron::bignum::BN;
+
+namespace safeheron {
+namespace multi_party_ecdsa {
+namespace common {
+
+// File layout: MAGIC | salt | iv | AES-256-GCM(payload) | tag. MAGIC, salt and iv are authenticated as well.
+static const char FILE_MAGIC[] = "SHKMPOOL1";
+static const size_t FILE_MAGIC_LEN = sizeof(FILE_MAGIC) - 1;
+static const size_t SALT_LEN = 16;
+static const size_t IV_LEN = 12;
+static const size_t TAG_LEN = 16;
+static const size_t KEY_LEN = 32;
+static const int PBKDF2_ITERATIONS = 100000;
+
+static void AppendBytes(string &buf, const string &bytes) {
+    uint32_t len = (uint32_t)bytes.size();
+    for (int i = 0; i < 4; ++i) buf.push_back((char)((len >> (8 * i)) & 0xFF));
+    buf.append(bytes);
+}
+
+static bool ReadBytes(const string &buf, size_t &pos, string &bytes) {
+    if (buf.size() - pos < 4) return false;
+    uint32_t len = 0;
+    for (int i = 0; i < 4; ++i) len |= (uint32_t)(uint8_t)buf[pos + i] << (8 * i);
+    pos += 4;
+    if (buf.size() - pos < len) return false;
+    bytes.assign(buf, pos, len);
+    pos += len;
+    return true;
+}
+
+static void AppendBN(string &buf, const BN &num) {
+    string hex;
+    num.ToHexStr(hex);
+    AppendBytes(buf, hex);
+}
+
+static bool ReadBN(const string &buf, size_t &pos, BN &num) {
+    string hex;
+    if (!ReadBytes(buf, pos, hex) || hex.empty()) return false;
+    num = BN::FromHexStr(hex);
+    return true;
+}
+
+static bool DeriveKey(const string &passphrase, const uint8_t *salt, uint8_t *key) {
+    return PKCS5_PBKDF2_HMAC(passphrase.c_str(), (int)passphrase.size(), salt, (int)SALT_LEN, PBKDF2_ITERATIONS,
+                             EVP_sha256(), (int)KEY_LEN, key) == 1;
+}
+
+// Encrypt (decrypt) 'in' with AES-256-GCM. The tag is read from (written to) 'tag'.
+static bool AesGcm(bool encrypt, const uint8_t *key, const uint8_t *iv, const string &aad, const string &in,
+                   string &out, uint8_t *tag) {
+    EVP_CIPHER_CTX *cipher_ctx = EVP_CIPHER_CTX_new();
+    if (cipher_ctx == nullptr) return false;
+
+    bool ok = EVP_CipherInit_ex(cipher_ctx, EVP_aes_256_gcm(), nullptr, nullptr, nullptr, encrypt ? 1 : 0) == 1;
+    ok = ok && EVP_CIPHER_CTX_ctrl(cipher_ctx, EVP_CTRL_GCM_SET_IVLEN, (int)IV_LEN, nullptr) == 1;
+    ok = ok && EVP_CipherInit_ex(cipher_ctx, nullptr, nullptr, key, iv, encrypt ? 1 : 0) == 1;
+
+    int len = 0;
+    ok = ok && EVP_CipherUpdate(cipher_ctx, nullptr, &len, (const uint8_t *)aad.data(), (int)aad.size()) == 1;
+
+    out.assign(in.size() + 16, '\0');
+    int out_len = 0;
+    ok = ok && EVP_CipherUpdate(cipher_ctx, (uint8_t *)&out[0], &len, (const uint8_t *)in.data(), (int)in.size()) == 1;
+    out_len = len;
+    if (ok && !encrypt) ok = EVP_CIPHER_CTX_ctrl(cipher_ctx, EVP_CTRL_GCM_SET_TAG, (int)TAG_LEN, tag) == 1;
+    // Checks the tag when decrypting
+    ok = ok && EVP_CipherFinal_ex(cipher_ctx, (uint8_t *)&out[0] + out_len, &len) == 1;
+    out_len += len;
+    if (ok && encrypt) ok = EVP_CIPHER_CTX_ctrl(cipher_ctx, EVP_CTRL_GCM_GET_TAG, (int)TAG_LEN, tag) == 1;
+
+    EVP_CIPHER_CTX_free(cipher_ctx);
+    if (!ok) {
+        out.clear();
+        return false;
+    }
+    out.resize(out_len);
+    return true;
+}
+
+KeyMaterialPool::KeyMaterialPool(size_t capacity, size_t low_water_mark)
+        : capacity_(capacity),
+          low_water_mark_(low_water_mark == 0 ? 1 : (low_water_mark > capacity ? capacity : low_water_mark)),
+          filling_(false),
+          stop_(false) {
+}
+
+KeyMaterialPool::~KeyMaterialPool() {
+    Stop();
+}
+
+void KeyMaterialPool::Start() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (filling_) return;
+    stop_ = false;
+    filling_ = true;
+    filler_ = std::thread(&KeyMaterialPool::FillerLoop, this);
+}
+
+void KeyMaterialPool::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!filling_) return;
+        stop_ = true;
+    }
+    cond_.notify_all();
+    filler_.join();
+    std::lock_guard<std::mutex> lock(mutex_);
+    filling_ = false;
+}
+
+bool KeyMaterialPool::NeedFill() const {
+    return n_tilde_queue_.size() < low_water_mark_ || pail_queue_.size() < low_water_mark_;
+}
+
+void KeyMaterialPool::FillerLoop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stop_) {
+        cond_.wait(lock, [this] { return stop_ || NeedFill(); });
+
+        // Refill up to the capacity, one item at a time and without holding the lock, the emptier kind first
+        while (!stop_ && (n_tilde_queue_.size() < capacity_ || pail_queue_.size() < capacity_)) {
+            bool n_tilde_first = n_tilde_queue_.size() <= pail_queue_.size();
+            lock.unlock();
+            if (n_tilde_first) {
+                NTildeMaterial n_tilde;
+                GenerateNTilde(n_tilde);
+                lock.lock();
+                n_tilde_queue_.push_back(n_tilde);
+            } else {
+                PailMaterial pail;
+                GeneratePail(pail);
+                lock.lock();
+                pail_queue_.push_back(pail);
+            }
+        }
+    }
+}
+
+bool KeyMaterialPool::TakeNTilde(NTildeMaterial &n_tilde) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (n_tilde_queue_.empty()) {
+        cond_.notify_all();
+        return false;
+    }
+    n_tilde = n_tilde_queue_.front();
+    n_tilde_queue_.pop_front();
+    if (NeedFill()) cond_.notify_all();
+    return true;
+}
+
+bool KeyMaterialPool::TakePail(PailMaterial &pail) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (pail_queue_.empty()) {
+        cond_.notify_all();
+        return false;
+    }
+    pail = pail_queue_.front();
+    pail_queue_.pop_front();
+    if (NeedFill()) cond_.notify_all();
+    return true;
+}
+
+size_t KeyMaterialPool::n_tilde_count() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return n_tilde_queue_.size();
+}
+
+size_t KeyMaterialPool::pail_count() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return pail_queue_.size();
+}
+
+void KeyMaterialPool::GenerateNTilde(NTildeMaterial &n_tilde) {
+    safeheron::zkp::dln_proof::GenerateN_tilde(n_tilde.N_tilde_,
+                                               n_tilde.h1_,
+                                               n_tilde.h2_,
+                                               n_tilde.p_,
+                                               n_tilde.q_,
+                                               n_tilde.alpha_,
+                                               n_tilde.beta_);
+}
+
+void KeyMaterialPool::GeneratePail(PailMaterial &pail) {
+    safeheron::pail::CreateKeyPair2048(pail.pail_priv_, pail.pail_pub_);
+}
+
+bool KeyMaterialPool::SaveToFile(const std::string &path, const std::string &passphrase) {
+    // Take the items out first, so that none of them is handed out while it is being saved
+    std::deque<NTildeMaterial> n_tilde_arr;
+    std::deque<PailMaterial> pail_arr;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        n_tilde_arr.swap(n_tilde_queue_);
+        pail_arr.swap(pail_queue_);
+        if (NeedFill()) cond_.notify_all();
+    }
+
+    if (WriteFile(path, passphrase, n_tilde_arr, pail_arr)) return true;
+
+    // Nothing was saved: put the items back in front of anything the filler thread added meanwhile
+    std::lock_guard<std::mutex> lock(mutex_);
+    n_tilde_queue_.insert(n_tilde_queue_.begin(), n_tilde_arr.begin(), n_tilde_arr.end());
+    pail_queue_.insert(pail_queue_.begin(), pail_arr.begin(), pail_arr.end());
+    return false;
+}
+
+bool KeyMaterialPool::WriteFile(const std::string &path, const std::string &passphrase,
+                                const std::deque<NTildeMaterial> &n_tilde_arr,
+                                const std::deque<PailMaterial> &pail_arr) {
+    bool ok = true;
+
+    // Serialize
+    string payload;
+    AppendBytes(payload, std::to_string(n_tilde_arr.size()));
+    for (const auto &n_tilde : n_tilde_arr) {
+        AppendBN(payload, n_tilde.N_tilde_);
+        AppendBN(payload, n_tilde.h1_);
+        AppendBN(payload, n_tilde.h2_);
+        AppendBN(payload, n_tilde.p_);
+        AppendBN(payload, n_tilde.q_);
+        AppendBN(payload, n_tilde.alpha_);
+        AppendBN(payload, n_tilde.beta_);
+    }
+    AppendBytes(payload, std::to_string(pail_arr.size()));
+    for (const auto &pail : pail_arr) {
+        safeheron::proto::PailPriv pail_priv;
+        safeheron::proto::PailPub pail_pub;
+        ok = pail.pail_priv_.ToProtoObject(pail_priv) && pail.pail_pub_.ToProtoObject(pail_pub);
+        if (!ok) {
+            OPENSSL_cleanse(&payload[0], payload.size());
+            return false;
+        }
+        AppendBytes(payload, pail_priv.SerializeAsString());
+        AppendBytes(payload, pail_pub.SerializeAsString());
+    }
+
+    // Encrypt
+    uint8_t salt[SALT_LEN];
+    uint8_t iv[IV_LEN];
+    uint8_t key[KEY_LEN];
+    uint8_t tag[TAG_LEN];
+    safeheron::rand::RandomBytes(salt, sizeof salt);
+    safeheron::rand::RandomBytes(iv, sizeof iv);
+    if (!DeriveKey(passphrase, salt, key)) return false;
+
+    string header(FILE_MAGIC, FILE_MAGIC_LEN);
+    header.append((const char *)salt, sizeof salt);
+    header.append((const char *)iv, sizeof iv);
+    string cipher;
+    ok = AesGcm(true, key, iv, header, payload, cipher, tag);
+    OPENSSL_cleanse(key, sizeof key);
+    OPENSSL_cleanse(&payload[0], payload.size());
+    if (!ok) return false;
+
+    // Write to a temporary file first, so that a crash never leaves a truncated pool behind
+    string tmp_path = path + ".tmp";
+    {
+        std::ofstream out(tmp_path, std::ios::binary | std::ios::trunc);
+        if (!out) return false;
+        out.write(header.data(), (std::streamsize)header.size());
+        out.write(cipher.data(), (std::streamsize)cipher.size());
+        out.write((const char *)tag, sizeof tag);
+        if (!out.good()) {
+            out.close();
+            std::remove(tmp_path.c_str());
+            return false;
+        }
+    }
+    if (std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+        std::remove(tmp_path.c_str());
+        return false;
+    }
+    return true;
+}
+
+bool KeyMaterialPool::LoadFromFile(const std::string &path, const std::string &passphrase) {
+    bool ok = true;
+
+    string data;
+    {
+        std::ifstream in(path, std::ios::binary);
+        if (!in) return false;
+        data.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+    if (data.size() < FILE_MAGIC_LEN + SALT_LEN + IV_LEN + TAG_LEN) return false;
+    if (data.compare(0, FILE_MAGIC_LEN, FILE_MAGIC) != 0) return false;
+
+    // Decrypt
+    const uint8_t *salt = (const uint8_t *)data.data() + FILE_MAGIC_LEN;
+    const uint8_t *iv = salt + SALT_LEN;
+    uint8_t key[KEY_LEN];
+    uint8_t tag[TAG_LEN];
+    size_t header_len = FILE_MAGIC_LEN + SALT_LEN + IV_LEN;
+    memcpy(tag, data.data() + data.size() - TAG_LEN, TAG_LEN);
+    if (!DeriveKey(passphrase, salt, key)) return false;
+
+    string header = data.substr(0, header_len);
+    string cipher = data.substr(header_len, data.size() - header_len - TAG_LEN);
+    string payload;
+    ok = AesGcm(false, key, iv, header, cipher, payload, tag);
+    OPENSSL_cleanse(key, sizeof key);
+    if (!ok) return false;
+
+    // Parse everything before touching the pool
+    std::deque<NTildeMaterial> n_tilde_arr;
+    std::deque<PailMaterial> pail_arr;
+    size_t pos = 0;
+    string count;
+    ok = ReadBytes(payload, pos, count);
+    for (unsigned long i = 0, n = ok ? std::stoul(count) : 0; ok && i < n; ++i) {
+        NTildeMaterial n_tilde;
+        ok = ReadBN(payload, pos, n_tilde.N_tilde_) &&
+             ReadBN(payload, pos, n_tilde.h1_) &&
+             ReadBN(payload, pos, n_tilde.h2_) &&
+             ReadBN(payload, pos, n_tilde.p_) &&
+             ReadBN(payload, pos, n_tilde.q_) &&
+             ReadBN(payload, pos, n_tilde.alpha_) &&
+             ReadBN(payload, pos, n_tilde.beta_);
+        if (ok) n_tilde_arr.push_back(n_tilde);
+    }
+    ok = ok && ReadBytes(payload, pos, count);
+    for (unsigned long i = 0, n = ok ? std::stoul(count) : 0; ok && i < n; ++i) {
+        string priv_bytes, pub_bytes;
+        safeheron::proto::PailPriv pail_priv;
+        safeheron::proto::PailPub pail_pub;
+        PailMaterial pail;
+        ok = ReadBytes(payload, pos, priv_bytes) && ReadBytes(payload, pos, pub_bytes) &&
+             pail_priv.ParseFromString(priv_bytes) && pail_pub.ParseFromString(pub_bytes) &&
+             pail.pail_priv_.FromProtoObject(pail_priv) && pail.pail_pub_.FromProtoObject(pail_pub);
+        if (ok) pail_arr.push_back(pail);
+    }
+    OPENSSL_cleanse(&payload[0], payload.size());
+    if (!ok || pos != payload.size()) return false;
+
+    // Never hand out the same material twice
+    if (std::remove(path.c_str()) != 0) return false;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    n_tilde_queue_.insert(n_tilde_queue_.end(), n_tilde_arr.begin(), n_tilde_arr.end());
+    pail_queue_.insert(pail_queue_.end(), pail_arr.begin(), pail_arr.end());
+    return true;
+}
+
+}
+}
+}
@@ -0,0 +1,131 @@
+#ifndef SAFEHERON_MULTI_PARTY_ECDSA_COMMON_KEY_MATERIAL_POOL_H
+#define SAFEHERON_MULTI_PARTY_ECDSA_COMMON_KEY_MATERIAL_POOL_H
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include "crypto-suites/crypto-bn/bn.h"
+#include "crypto-suites/crypto-paillier/pail.h"
+
+namespace safeheron {
+namespace multi_party_ecdsa {
+namespace common {
+
+/**
+ * Output of safeheron::zkp::dln_proof::GenerateN_tilde.
+ */
+class NTildeMaterial {
+public:
+    safeheron::bignum::BN N_tilde_;
+    safeheron::bignum::BN h1_;
+    safeheron::bignum::BN h2_;
+    safeheron::bignum::BN p_;
+    safeheron::bignum::BN q_;
+    safeheron::bignum::BN alpha_;
+    safeheron::bignum::BN beta_;
+};
+
+/**
+ * Output of safeheron::pail::CreateKeyPair2048.
+ */
+class PailMaterial {
+public:
+    safeheron::pail::PailPrivKey pail_priv_;
+    safeheron::pail::PailPubKey pail_pub_;
+};
+
+/**
+ * Safe prime based key material generated ahead of time, so that round 0 of key generation and key refresh does not
+ * search for safe primes inline.
+ *
+ * A background thread keeps each kind of material between the low-water mark and the capacity. Every item is handed
+ * out once. When the pool is empty, Take*() returns false and the caller generates the material itself.
+ *
+ * The pool is shared by any number of contexts and threads. It is not owned by the contexts and must outlive them.
+ */
+class KeyMaterialPool {
+public:
+    /**
+     * @param capacity number of items of each kind the filler thread generates up to.
+     * @param low_water_mark the filler thread wakes up once a kind drops below this number of items.
+     */
+    KeyMaterialPool(size_t capacity, size_t low_water_mark);
+
+    ~KeyMaterialPool();
+
+    KeyMaterialPool(const KeyMaterialPool &) = delete;
+
+    KeyMaterialPool &operator=(const KeyMaterialPool &) = delete;
+
+    /**
+     * Start the filler thread. Does nothing if it is running already.
+     */
+    void Start();
+
+    /**
+     * Stop the filler thread. An item which is being generated is finished first, which may take several seconds.
+     */
+    void Stop();
+
+    bool TakeNTilde(NTildeMaterial &n_tilde);
+
+    bool TakePail(PailMaterial &pail);
+
+    size_t n_tilde_count() const;
+
+    size_t pail_count() const;
+
+    size_t capacity() const { return capacity_; }
+
+    size_t low_water_mark() const { return low_water_mark_; }
+
+    /**
+     * Move the items of the pool to a file, encrypted with AES-256-GCM under a key derived from the passphrase.
+     * The pool is left empty, so that an item is never both handed out here and loaded again from the file. Stop
+     * the filler thread first, or it refills the pool. If the file cannot be written, the items stay in the pool.
+     */
+    bool SaveToFile(const std::string &path, const std::string &passphrase);
+
+    /**
+     * Add the items of a file written by SaveToFile. The file is removed once it is loaded, so that no item can be
+     * handed out twice; save the pool again before the process exits.
+     * @return false if the file cannot be read, or the passphrase is wrong, or the file was tampered with.
+     */
+    bool LoadFromFile(const std::string &path, const std::string &passphrase);
+
+    /**
+     * Generate the material inline, for the callers without a pool or with an empty one.
+     */
+    static void GenerateNTilde(NTildeMaterial &n_tilde);
+
+    static void GeneratePail(PailMaterial &pail);
+
+private:
+    void FillerLoop();
+
+    bool NeedFill() const;
+
+    static bool WriteFile(const std::string &path, const std::string &passphrase,
+                          const std::deque<NTildeMaterial> &n_tilde_arr, const std::deque<PailMaterial> &pail_arr);
+
+private:
+    const size_t capacity_;
+    const size_t low_water_mark_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable cond_;
+    std::deque<NTildeMaterial> n_tilde_queue_;
+    std::deque<PailMaterial> pail_queue_;
+
+    std::thread filler_;
+    bool filling_;
+    bool stop_;
+};
+
+}
+}
+}
+
+#endif //SAFEHERON_MULTI_PARTY_ECDSA_COMMON_KEY_MATERIAL_POOL_H
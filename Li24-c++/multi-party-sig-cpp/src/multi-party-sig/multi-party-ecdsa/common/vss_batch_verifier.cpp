@@ -0,0 +1,216 @@
+#include "multi-party-sig/multi-party-ecdsa/common/vss_batch_verifier.h"
+#include <algorithm>
+#include <openssl/bn.h>
+#include <openssl/ec.h>
+#include <openssl/obj_mac.h>
+#include "crypto-suites/crypto-bn/rand.h"
+#include "crypto-suites/crypto-sss/vsss.h"
+
+using safeheron::bignum::BN;
+using safeheron::curve::Curve;
+using safeheron::curve::CurvePoint;
+using safeheron::curve::CurveType;
+
+namespace safeheron {
+namespace multi_party_ecdsa {
+namespace common {
+
+namespace {
+// Bits of scalar handled per addition
+const int WINDOW_BITS = 4;
+const int WINDOW_SIZE = 1 << WINDOW_BITS;
+// Size of the random coefficients of the batch
+const size_t COEFFICIENT_BITS = 128;
+
+// Window digits of the scalars, big endian, 256 / WINDOW_BITS of them per scalar
+void ToDigits(const std::vector<BN> &scalar_arr, size_t count, const BN &order, std::vector<uint8_t> &out_digit_arr) {
+    const size_t digits = 256 / WINDOW_BITS;
+    uint8_t buf[32];
+    out_digit_arr.resize(count * digits);
+    for (size_t i = 0; i < count; ++i) {
+        BN scalar = scalar_arr[i] % order;
+        scalar.ToBytes32BE(buf);
+        for (size_t d = 0; d < digits; ++d) {
+            int shift = 8 - WINDOW_BITS * (int)(d % (8 / WINDOW_BITS) + 1);
+            out_digit_arr[i * digits + d] = (buf[d / (8 / WINDOW_BITS)] >> shift) & (WINDOW_SIZE - 1);
+        }
+    }
+}
+
+int OpenSSLCurveNid(CurveType curve_type) {
+    switch (curve_type) {
+        case CurveType::SECP256K1: return NID_secp256k1;
+        case CurveType::P256: return NID_X9_62_prime256v1;
+        default: return NID_undef;
+    }
+}
+
+// Straus over the points of OpenSSL, which stay in Jacobian coordinates between the additions. The additions of
+// CurvePoint go back to affine coordinates every time, which costs a field inversion each.
+bool OpenSSLMultiScalarMul(const std::vector<CurvePoint> &point_arr, const std::vector<uint8_t> &digit_arr,
+                           size_t count, CurveType curve_type, CurvePoint &out) {
+    const size_t digits = 256 / WINDOW_BITS;
+    EC_GROUP *group = EC_GROUP_new_by_curve_name(OpenSSLCurveNid(curve_type));
+    BN_CTX *bn_ctx = BN_CTX_new();
+    BIGNUM *x = BN_new();
+    BIGNUM *y = BN_new();
+    EC_POINT *acc = group ? EC_POINT_new(group) : nullptr;
+    std::vector<EC_POINT *> table_arr(count * WINDOW_SIZE, nullptr);
+    uint8_t buf[32];
+
+    bool ok = group && bn_ctx && x && y && acc && EC_POINT_set_to_infinity(group, acc);
+    // table_arr[i * WINDOW_SIZE + d] = d * point_arr[i], d = 0 is never used
+    for (size_t i = 0; ok && i < count; ++i) {
+        if (point_arr[i].IsInfinity()) continue;
+        EC_POINT **table = &table_arr[i * WINDOW_SIZE];
+        for (int d = 1; ok && d < WINDOW_SIZE; ++d) {
+            table[d] = EC_POINT_new(group);
+            ok = table[d] != nullptr;
+        }
+        if (!ok) break;
+        point_arr[i].x().ToBytes32BE(buf);
+        ok = BN_bin2bn(buf, 32, x) != nullptr;
+        point_arr[i].y().ToBytes32BE(buf);
+        ok = ok && BN_bin2bn(buf, 32, y) != nullptr;
+        ok = ok && EC_POINT_set_affine_coordinates(group, table[1], x, y, bn_ctx);
+        for (int d = 2; ok && d < WINDOW_SIZE; ++d) {
+            ok = EC_POINT_add(group, table[d], table[d - 1], table[1], bn_ctx);
+        }
+    }
+
+    for (size_t d = 0; ok && d < digits; ++d) {
+        for (int k = 0; ok && d > 0 && k < WINDOW_BITS; ++k) {
+            ok = EC_POINT_dbl(group, acc, acc, bn_ctx);
+        }
+        for (size_t i = 0; ok && i < count; ++i) {
+            uint8_t digit = digit_arr[i * digits + d];
+            if (digit == 0 || !table_arr[i * WINDOW_SIZE + digit]) continue;
+            ok = EC_POINT_add(group, acc, acc, table_arr[i * WINDOW_SIZE + digit], bn_ctx);
+        }
+    }
+
+    if (ok) {
+        if (EC_POINT_is_at_infinity(group, acc)) {
+            out = CurvePoint(curve_type);
+        } else {
+            ok = EC_POINT_get_affine_coordinates(group, acc, x, y, bn_ctx);
+            uint8_t x_buf[32] = {0};
+            uint8_t y_buf[32] = {0};
+            ok = ok && BN_bn2binpad(x, x_buf, 32) == 32 && BN_bn2binpad(y, y_buf, 32) == 32;
+            if (ok) out = CurvePoint(BN::FromBytesBE(x_buf, 32), BN::FromBytesBE(y_buf, 32), curve_type);
+        }
+    }
+
+    for (EC_POINT *point : table_arr) EC_POINT_free(point);
+    EC_POINT_free(acc);
+    BN_free(y);
+    BN_free(x);
+    BN_CTX_free(bn_ctx);
+    EC_GROUP_free(group);
+    return ok;
+}
+
+}
+
+CurvePoint MultiScalarMul(const std::vector<CurvePoint> &point_arr, const std::vector<BN> &scalar_arr, CurveType curve_type) {
+    const Curve *curv = safeheron::curve::GetCurveParam(curve_type);
+    CurvePoint acc(curve_type);
+    size_t count = std::min(point_arr.size(), scalar_arr.size());
+    if (!curv || count == 0) return acc;
+
+    const size_t digits = 256 / WINDOW_BITS;
+    std::vector<uint8_t> digit_arr;
+    ToDigits(scalar_arr, count, curv->n, digit_arr);
+
+    if (OpenSSLCurveNid(curve_type) != NID_undef && OpenSSLMultiScalarMul(point_arr, digit_arr, count, curve_type, acc)) {
+        return acc;
+    }
+
+    // table_arr[i * WINDOW_SIZE + d] = d * point_arr[i], d = 0 is never used
+    std::vector<CurvePoint> table_arr(count * WINDOW_SIZE, CurvePoint(curve_type));
+    for (size_t i = 0; i < count; ++i) {
+        CurvePoint *table = &table_arr[i * WINDOW_SIZE];
+        table[1] = point_arr[i];
+        for (int d = 2; d < WINDOW_SIZE; ++d) {
+            table[d] = table[d - 1] + point_arr[i];
+        }
+    }
+
+    acc = CurvePoint(curve_type);
+    bool started = false;
+    for (size_t d = 0; d < digits; ++d) {
+        if (started) {
+            for (int k = 0; k < WINDOW_BITS; ++k) acc += acc;
+        }
+        for (size_t i = 0; i < count; ++i) {
+            uint8_t digit = digit_arr[i * digits + d];
+            if (digit == 0) continue;
+            acc += table_arr[i * WINDOW_SIZE + digit];
+            started = true;
+        }
+    }
+    return acc;
+}
+
+VssBatchVerifier::VssBatchVerifier(CurveType curve_type, int threshold, const BN &index)
+        : curve_type_(curve_type), threshold_(threshold), index_(index) {
+}
+
+void VssBatchVerifier::Add(const std::vector<CurvePoint> &commits, const BN &share) {
+    commits_arr_.push_back(&commits);
+    share_arr_.push_back(share);
+}
+
+bool VssBatchVerifier::Verify(std::vector<size_t> &out_failed_arr) const {
+    out_failed_arr.clear();
+    const Curve *curv = safeheron::curve::GetCurveParam(curve_type_);
+    if (!curv || threshold_ <= 0) return false;
+
+    bool ok = true;
+    for (const auto *commits : commits_arr_) {
+        if (commits->size() != (size_t)threshold_) ok = false;
+    }
+
+    if (ok) {
+        // index^k mod n
+        std::vector<BN> power_arr(threshold_);
+        power_arr[0] = BN(1);
+        for (int k = 1; k < threshold_; ++k) {
+            power_arr[k] = (power_arr[k - 1] * index_) % curv->n;
+        }
+
+        std::vector<CurvePoint> point_arr;
+        std::vector<BN> scalar_arr;
+        point_arr.reserve(commits_arr_.size() * threshold_ + 1);
+        scalar_arr.reserve(commits_arr_.size() * threshold_ + 1);
+        BN share_sum(0);
+        for (size_t j = 0; j < commits_arr_.size(); ++j) {
+            BN r = safeheron::rand::RandomBN(COEFFICIENT_BITS);
+            share_sum = (share_sum + r * share_arr_[j]) % curv->n;
+            for (int k = 0; k < threshold_; ++k) {
+                point_arr.push_back((*commits_arr_[j])[k]);
+                scalar_arr.push_back((r * power_arr[k]) % curv->n);
+            }
+        }
+        point_arr.push_back(curv->g);
+        scalar_arr.push_back((curv->n - share_sum) % curv->n);
+
+        if (MultiScalarMul(point_arr, scalar_arr, curve_type_).IsInfinity()) return true;
+    }
+
+    // Find the culprits
+    for (size_t j = 0; j < commits_arr_.size(); ++j) {
+        if (!VerifyOne(j)) out_failed_arr.push_back(j);
+    }
+    return out_failed_arr.empty();
+}
+
+bool VssBatchVerifier::VerifyOne(size_t pos) const {
+    const Curve *curv = safeheron::curve::GetCurveParam(curve_type_);
+    if (commits_arr_[pos]->size() != (size_t)threshold_) return false;
+    return safeheron::sss::vsss::VerifyShare(*commits_arr_[pos], threshold_, index_, share_arr_[pos], curv->g, curv->n);
+}
+
+}
+}
+}
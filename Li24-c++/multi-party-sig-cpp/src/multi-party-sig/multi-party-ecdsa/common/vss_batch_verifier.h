@@ -0,0 +1,66 @@
+#ifndef SAFEHERON_MULTI_PARTY_ECDSA_COMMON_VSS_BATCH_VERIFIER_H
+#define SAFEHERON_MULTI_PARTY_ECDSA_COMMON_VSS_BATCH_VERIFIER_H
+
+#include <vector>
+#include "crypto-suites/crypto-bn/bn.h"
+#include "crypto-suites/crypto-curve/curve.h"
+
+namespace safeheron {
+namespace multi_party_ecdsa {
+namespace common {
+
+/**
+ * Compute sum(scalar_arr[i] * point_arr[i]) with Straus' interleaved method: the doublings are shared by all the
+ * points, each point only costs a table of 15 multiples and one addition per 4 bits of scalar. secp256k1 and P256
+ * run on OpenSSL points, which avoids a field inversion per addition.
+ * @return the sum, the point at infinity for empty inputs.
+ */
+safeheron::curve::CurvePoint MultiScalarMul(const std::vector<safeheron::curve::CurvePoint> &point_arr,
+                                            const std::vector<safeheron::bignum::BN> &scalar_arr,
+                                            safeheron::curve::CurveType curve_type);
+
+/**
+ * Verifies the Feldman VSS shares received from all the peers at once.
+ *
+ * Every share x_j of commitments vs_j must satisfy g * x_j == sum_k(index^k * vs_j[k]). With random 128-bit r_j the
+ * batch checks sum_j(r_j * (sum_k(index^k * vs_j[k]) - g * x_j)) == O with a single multi-scalar multiplication,
+ * so a bad share passes with probability 2^-128 at most. If the batch check fails, each share is checked on its own
+ * so that the culprits can be named.
+ */
+class VssBatchVerifier {
+public:
+    /**
+     * @param threshold number of commitments of each share.
+     * @param index index of the local party, the point the shares are evaluated at.
+     */
+    VssBatchVerifier(safeheron::curve::CurveType curve_type, int threshold, const safeheron::bignum::BN &index);
+
+    /**
+     * Add the share received from a peer. The commitments are not copied and must outlive Verify().
+     */
+    void Add(const std::vector<safeheron::curve::CurvePoint> &commits, const safeheron::bignum::BN &share);
+
+    /**
+     * @param out_failed_arr positions, in the order of Add(), of the shares which are not valid.
+     * @return true if all the shares are valid.
+     */
+    bool Verify(std::vector<size_t> &out_failed_arr) const;
+
+    size_t size() const { return commits_arr_.size(); }
+
+private:
+    bool VerifyOne(size_t pos) const;
+
+private:
+    safeheron::curve::CurveType curve_type_;
+    int threshold_;
+    safeheron::bignum::BN index_;
+    std::vector<const std::vector<safeheron::curve::CurvePoint> *> commits_arr_;
+    std::vector<safeheron::bignum::BN> share_arr_;
+};
+
+}
+}
+}
+
+#endif //SAFEHERON_MULTI_PARTY_ECDSA_COMMON_VSS_BATCH_VERIFIER_H
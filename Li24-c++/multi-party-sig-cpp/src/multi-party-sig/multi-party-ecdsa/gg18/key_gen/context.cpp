@@ -12,7 +12,7 @@ namespace multi_party_ecdsa{
 namespace gg18{
 namespace key_gen {
 
-Context::Context(int total_parties): MPCContext(total_parties){
+Context::Context(int total_parties): MPCContext(total_parties), key_material_pool_(nullptr){
     BindAllRounds();
 }
 
@@ -28,6 +28,7 @@ Context::Context(const Context &ctx): MPCContext(ctx){
     round3_ = ctx.round3_;
 
     X_ = ctx.X_;
+    key_material_pool_ = ctx.key_material_pool_;
     // End Assignments.
 
     BindAllRounds();
@@ -51,6 +52,7 @@ Context &Context::operator=(const Context &ctx){
     round3_ = ctx.round3_;
 
     X_ = ctx.X_;
+    key_material_pool_ = ctx.key_material_pool_;
     // End Assignments.
 
     BindAllRounds();
@@ -4,6 +4,9 @@
 #include "multi-party-sig/multi-party-ecdsa/gg18/key_gen/context.h"
 
 using std::string;
+using safeheron::multi_party_ecdsa::common::KeyMaterialPool;
+using safeheron::multi_party_ecdsa::common::NTildeMaterial;
+using safeheron::multi_party_ecdsa::common::PailMaterial;
 
 namespace safeheron {
 namespace multi_party_ecdsa {
@@ -11,7 +14,7 @@ namespace gg18 {
 namespace key_gen {
 
 bool Round0::ComputeVerify() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     SignKey &sign_key = ctx->sign_key_;
     const curve::Curve *curv = curve::GetCurveParam(ctx->curve_type_);
 
@@ -25,17 +28,26 @@ bool Round0::ComputeVerify() {
     ctx->local_party_.kgc_y_ = safeheron::commitment::CreateComWithBlind(ctx->local_party_.y_,
                                                                          ctx->local_party_.kgd_y_.blind_factor_);
 
-    // Generate Paillier key pair
-    CreateKeyPair2048(sign_key.local_party_.pail_priv_, sign_key.local_party_.pail_pub_);
+    // Generate Paillier key pair, or take a pregenerated one
+    PailMaterial pail;
+    if (!ctx->key_material_pool_ || !ctx->key_material_pool_->TakePail(pail)) {
+        KeyMaterialPool::GeneratePail(pail);
+    }
+    sign_key.local_party_.pail_priv_ = pail.pail_priv_;
+    sign_key.local_party_.pail_pub_ = pail.pail_pub_;
 
-    // Generate (N_tilde, h1, h2)
-    safeheron::zkp::dln_proof::GenerateN_tilde(sign_key.local_party_.N_tilde_,
-                                               sign_key.local_party_.h1_,
-                                               sign_key.local_party_.h2_,
-                                               sign_key.local_party_.p_,
-                                               sign_key.local_party_.q_,
-                                               sign_key.local_party_.alpha_,
-                                               sign_key.local_party_.beta_);
+    // Generate (N_tilde, h1, h2), or take pregenerated ones
+    NTildeMaterial n_tilde;
+    if (!ctx->key_material_pool_ || !ctx->key_material_pool_->TakeNTilde(n_tilde)) {
+        KeyMaterialPool::GenerateNTilde(n_tilde);
+    }
+    sign_key.local_party_.N_tilde_ = n_tilde.N_tilde_;
+    sign_key.local_party_.h1_ = n_tilde.h1_;
+    sign_key.local_party_.h2_ = n_tilde.h2_;
+    sign_key.local_party_.p_ = n_tilde.p_;
+    sign_key.local_party_.q_ = n_tilde.q_;
+    sign_key.local_party_.alpha_ = n_tilde.alpha_;
+    sign_key.local_party_.beta_ = n_tilde.beta_;
     // DLN Proof
     ctx->local_party_.dln_proof1_.Prove(sign_key.local_party_.N_tilde_,
                                         sign_key.local_party_.h1_,
@@ -55,7 +67,7 @@ bool Round0::ComputeVerify() {
 
 bool Round0::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                          std::vector<std::string> &out_des_arr) const {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     SignKey &sign_key = ctx->sign_key_;
 
     out_p2p_msg_arr.clear();
@@ -75,7 +87,7 @@ bool Round0::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string
     message.h2_ = sign_key.local_party_.h2_;
     message.index_ = sign_key.local_party_.index_;
     message.pail_pub_ = sign_key.local_party_.pail_pub_;
-    message.ToBase64(out_bc_msg);
+    ctx->EncodeMessage(message, out_bc_msg);
 
     return true;
 }
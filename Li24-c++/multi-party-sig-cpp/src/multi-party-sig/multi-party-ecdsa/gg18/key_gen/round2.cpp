@@ -2,6 +2,7 @@
 #include <cstdio>
 #include "crypto-suites/crypto-commitment/commitment.h"
 #include "crypto-suites/crypto-bn/rand.h"
+#include "multi-party-sig/multi-party-ecdsa/common/vss_batch_verifier.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/key_gen/context.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/key_gen/round2.h"
 
@@ -18,7 +19,7 @@ namespace gg18{
 namespace key_gen {
 
 void Round2::Init() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     for (int i = 0; i < ctx->get_total_parties() - 1; ++i) {
         p2p_message_arr_.emplace_back();
         bc_message_arr_.emplace_back();
@@ -26,7 +27,7 @@ void Round2::Init() {
 }
 
 bool Round2::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     SignKey &sign_key = ctx->sign_key_;
 
     int pos = sign_key.get_remote_party_pos(party_id);
@@ -35,13 +36,13 @@ bool Round2::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
         return false;
     }
 
-    bool ok = bc_message_arr_[pos].FromBase64(bc_msg);
+    bool ok = ctx->DecodeMessage(bc_msg, bc_message_arr_[pos]);
     if (!ok) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to deserialize from base64(bc)!");
         return false;
     }
 
-    ok = p2p_message_arr_[pos].FromBase64(p2p_msg);
+    ok = ctx->DecodeMessage(p2p_msg, p2p_message_arr_[pos]);
     if (!ok) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to deserialize from base64(p2p)!");
         return false;
@@ -52,8 +53,7 @@ bool Round2::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
 
 bool Round2::ReceiveVerify(const std::string &party_id) {
     bool ok = true;
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
-    const curve::Curve *curv = curve::GetCurveParam(ctx->curve_type_);
+    Context *ctx = this->get_context();
     SignKey &sign_key = ctx->sign_key_;
 
     int pos = sign_key.get_remote_party_pos(party_id);
@@ -70,11 +70,6 @@ bool Round2::ReceiveVerify(const std::string &party_id) {
         return false;
     }
 
-    if (!safeheron::sss::vsss::VerifyShare(bc_message_arr_[pos].vs_, sign_key.threshold_, sign_key.local_party_.index_, p2p_message_arr_[pos].x_ij_, curv->g, curv->n)) {
-        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to verify VsssSecp256k1::VerifyShare!");
-        return false;
-    }
-
     safeheron::zkp::no_small_factor_proof::NoSmallFactorSetUp set_up(sign_key.local_party_.N_tilde_,
                                                                      sign_key.local_party_.h1_,
                                                                      sign_key.local_party_.h2_);
@@ -92,10 +87,24 @@ bool Round2::ReceiveVerify(const std::string &party_id) {
 
 bool Round2::ComputeVerify() {
     bool ok = true;
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     SignKey &sign_key = ctx->sign_key_;
     const curve::Curve *curv = curve::GetCurveParam(ctx->curve_type_);
 
+    // Check the shares of all the peers with one multi-scalar multiplication
+    safeheron::multi_party_ecdsa::common::VssBatchVerifier vss_verifier(ctx->curve_type_, (int)sign_key.threshold_, sign_key.local_party_.index_);
+    for (size_t i = 0; i < bc_message_arr_.size(); ++i) {
+        vss_verifier.Add(bc_message_arr_[i].vs_, p2p_message_arr_[i].x_ij_);
+    }
+    std::vector<size_t> failed_arr;
+    if (!vss_verifier.Verify(failed_arr)) {
+        for (size_t pos : failed_arr) {
+            ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed in VerifyShare for party " + sign_key.remote_parties_[pos].party_id_ + "!");
+        }
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to verify the shares!");
+        return false;
+    }
+
     CurvePoint pub = ctx->local_party_.y_;
 
     for (size_t i = 0; i < bc_message_arr_.size(); ++i) {
@@ -132,7 +141,7 @@ bool Round2::ComputeVerify() {
 
 bool Round2::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                          std::vector<std::string> &out_des_arr) const {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     SignKey &sign_key = ctx->sign_key_;
 
     out_p2p_msg_arr.clear();
@@ -148,7 +157,7 @@ bool Round2::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string
     message.dlog_proof_x_ = ctx->local_party_.dlog_proof_x_;
     message.pail_proof_ = ctx->local_party_.pail_proof_;
     string base64;
-    bool ok = message.ToBase64(out_bc_msg);
+    bool ok = ctx->EncodeMessage(message, out_bc_msg);
     if (!ok) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to encode to base64(Round2BCMessage)!");
         return false;
@@ -15,7 +15,7 @@ namespace multi_party_ecdsa{
 namespace gg18{
 namespace key_refresh {
 
-Context::Context(int total_parties): MPCContext(total_parties){
+Context::Context(int total_parties): MPCContext(total_parties), key_material_pool_(nullptr){
     BindAllRounds();
 }
 
@@ -29,6 +29,7 @@ Context::Context(const Context &ctx): MPCContext(ctx){
     round2_ = ctx.round2_;
     round3_ = ctx.round3_;
     round4_ = ctx.round4_;
+    key_material_pool_ = ctx.key_material_pool_;
     // End Assignments.
 
     BindAllRounds();
@@ -50,6 +51,7 @@ Context &Context::operator=(const Context &ctx){
     round2_ = ctx.round2_;
     round3_ = ctx.round3_;
     round4_ = ctx.round4_;
+    key_material_pool_ = ctx.key_material_pool_;
     // End Assignments.
 
     BindAllRounds();
@@ -5,6 +5,7 @@
 #include <vector>
 #include "crypto-suites/crypto-bn/bn.h"
 #include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_context.h"
+#include "multi-party-sig/multi-party-ecdsa/common/key_material_pool.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/sign_key.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/key_refresh/t_party.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/key_refresh/round0.h"
@@ -39,6 +40,13 @@ public:
 
     void BindAllRounds();
 
+    /**
+     * Take the Paillier key pair and (N_tilde, h1, h2) of round 0 from a pool instead of generating them inline.
+     * The pool is not owned and must outlive the context. Without a pool, or with an empty one, they are generated
+     * inline as before.
+     */
+    void set_key_material_pool(safeheron::multi_party_ecdsa::common::KeyMaterialPool *pool) { key_material_pool_ = pool; }
+
     static bool CreateContext(Context &ctx, std::string &sign_key_base64);
 
 public:
@@ -50,6 +58,8 @@ public:
     Round2 round2_;
     Round3 round3_;
     Round4 round4_;
+
+    safeheron::multi_party_ecdsa::common::KeyMaterialPool *key_material_pool_;
 };
 
 }
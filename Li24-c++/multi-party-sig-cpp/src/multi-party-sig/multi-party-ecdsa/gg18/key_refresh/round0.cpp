@@ -15,6 +15,9 @@ using safeheron::curve::CurveType;
 using safeheron::sss::Polynomial;
 
 using safeheron::multi_party_ecdsa::gg18::SignKey;
+using safeheron::multi_party_ecdsa::common::KeyMaterialPool;
+using safeheron::multi_party_ecdsa::common::NTildeMaterial;
+using safeheron::multi_party_ecdsa::common::PailMaterial;
 
 namespace safeheron {
 namespace multi_party_ecdsa{
@@ -23,7 +26,7 @@ namespace key_refresh {
 
 
 bool Round0::ComputeVerify() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     SignKey &sign_key = ctx->sign_key_;
     const Curve *curv = GetCurveParam(sign_key.X_.GetCurveType());
 
@@ -50,17 +53,26 @@ bool Round0::ComputeVerify() {
                                                 curv->n,
                                                 curv->g);
 
-    // Generate (N_tilde, h1, h2)
-    safeheron::zkp::dln_proof::GenerateN_tilde(sign_key.local_party_.N_tilde_,
-                    sign_key.local_party_.h1_,
-                    sign_key.local_party_.h2_,
-                    sign_key.local_party_.p_,
-                    sign_key.local_party_.q_,
-                    sign_key.local_party_.alpha_,
-                    sign_key.local_party_.beta_);
-
-    // Generate Paillier's Key Pair
-    CreateKeyPair2048(sign_key.local_party_.pail_priv_, sign_key.local_party_.pail_pub_);
+    // Generate (N_tilde, h1, h2), or take pregenerated ones
+    NTildeMaterial n_tilde;
+    if (!ctx->key_material_pool_ || !ctx->key_material_pool_->TakeNTilde(n_tilde)) {
+        KeyMaterialPool::GenerateNTilde(n_tilde);
+    }
+    sign_key.local_party_.N_tilde_ = n_tilde.N_tilde_;
+    sign_key.local_party_.h1_ = n_tilde.h1_;
+    sign_key.local_party_.h2_ = n_tilde.h2_;
+    sign_key.local_party_.p_ = n_tilde.p_;
+    sign_key.local_party_.q_ = n_tilde.q_;
+    sign_key.local_party_.alpha_ = n_tilde.alpha_;
+    sign_key.local_party_.beta_ = n_tilde.beta_;
+
+    // Generate Paillier's Key Pair, or take a pregenerated one
+    PailMaterial pail;
+    if (!ctx->key_material_pool_ || !ctx->key_material_pool_->TakePail(pail)) {
+        KeyMaterialPool::GeneratePail(pail);
+    }
+    sign_key.local_party_.pail_priv_ = pail.pail_priv_;
+    sign_key.local_party_.pail_pub_ = pail.pail_pub_;
 
     // Commitment(VS || N_tilde || h1 || h2 || pail_pub)
     char blind_factor_buf[256];
@@ -104,7 +116,7 @@ bool Round0::ComputeVerify() {
 
 bool Round0::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                          std::vector<std::string> &out_des_arr) const {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     SignKey &sign_key = ctx->sign_key_;
 
     out_p2p_msg_arr.clear();
@@ -117,7 +129,7 @@ bool Round0::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string
 
     Round0BCMessage message;
     message.V_ = ctx->local_party_.V_;
-    message.ToBase64(out_bc_msg);
+    ctx->EncodeMessage(message, out_bc_msg);
 
     return true;
 }
@@ -2,6 +2,7 @@
 #include "crypto-suites/crypto-curve/curve.h"
 #include "crypto-suites/crypto-hash/sha256.h"
 #include "crypto-suites/crypto-bn/rand.h"
+#include "multi-party-sig/multi-party-ecdsa/common/vss_batch_verifier.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/key_refresh/round2.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/key_refresh/context.h"
 
@@ -23,7 +24,7 @@ namespace gg18{
 namespace key_refresh {
 
 void Round2::Init() {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     for (int i = 0; i < ctx->get_total_parties() - 1; ++i) {
         bc_message_arr_.emplace_back();
         p2p_message_arr_.emplace_back();
@@ -31,7 +32,7 @@ void Round2::Init() {
 }
 
 bool Round2::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     SignKey &sign_key = ctx->sign_key_;
 
     int pos = sign_key.get_remote_party_pos(party_id);
@@ -40,13 +41,13 @@ bool Round2::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
         return false;
     }
 
-    bool ok = bc_message_arr_[pos].FromBase64(bc_msg);
+    bool ok = ctx->DecodeMessage(bc_msg, bc_message_arr_[pos]);
     if (!ok) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to deserialize from base64(bc)!");
         return false;
     }
 
-    ok = p2p_message_arr_[pos].FromBase64(p2p_msg);
+    ok = ctx->DecodeMessage(p2p_msg, p2p_message_arr_[pos]);
     if (!ok) {
         ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to deserialize from base64(p2p)!");
         return false;
@@ -58,9 +59,8 @@ bool Round2::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
 
 bool Round2::ReceiveVerify(const std::string &party_id) {
     bool ok = true;
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     SignKey &sign_key = ctx->sign_key_;
-    const Curve * curv = GetCurveParam(sign_key.X_.GetCurveType());
 
     int pos = sign_key.get_remote_party_pos(party_id);
     if (pos == -1) {
@@ -102,12 +102,6 @@ bool Round2::ReceiveVerify(const std::string &party_id) {
         return false;
     }
 
-    ok = safeheron::sss::vsss::VerifyShare(bc_message_arr_[pos].vs_, sign_key.threshold_, sign_key.local_party_.index_, p2p_message_arr_[pos].x_ij_, curv->g, curv->n);
-    if (!ok) {
-        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "safeheron::sss::vsss_secp256k1::VerifyShare(message_arr_[pos].vs_, sign_key.local_party_.index_, message_arr_[pos].x_ij_)");
-        return false;
-    }
-
     sign_key.remote_parties_[pos].N_tilde_ = bc_message_arr_[pos].N_tilde_;
     sign_key.remote_parties_[pos].h1_ = bc_message_arr_[pos].h1_;
     sign_key.remote_parties_[pos].h2_ = bc_message_arr_[pos].h2_;
@@ -137,10 +131,25 @@ bool Round2::ReceiveVerify(const std::string &party_id) {
 
 bool Round2::ComputeVerify() {
     bool ok = true;
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     SignKey &sign_key = ctx->sign_key_;
 
     const Curve * curv = GetCurveParam(sign_key.X_.GetCurveType());
+
+    // Check the shares of all the peers with one multi-scalar multiplication
+    safeheron::multi_party_ecdsa::common::VssBatchVerifier vss_verifier(sign_key.X_.GetCurveType(), (int)sign_key.threshold_, sign_key.local_party_.index_);
+    for (size_t i = 0; i < bc_message_arr_.size(); ++i) {
+        vss_verifier.Add(bc_message_arr_[i].vs_, p2p_message_arr_[i].x_ij_);
+    }
+    std::vector<size_t> failed_arr;
+    if (!vss_verifier.Verify(failed_arr)) {
+        for (size_t pos : failed_arr) {
+            ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed in VerifyShare for party " + sign_key.remote_parties_[pos].party_id_ + "!");
+        }
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to verify the shares!");
+        return false;
+    }
+
     ctx->local_party_.new_x_ = ctx->local_party_.x_ij_;
     for (size_t i = 0; i < sign_key.remote_parties_.size(); ++i) {
         ctx->local_party_.new_x_ = (ctx->local_party_.new_x_ + ctx->remote_parties_[i].x_ij_) % curv->n;
@@ -169,7 +178,7 @@ bool Round2::ComputeVerify() {
 
 bool Round2::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                          std::vector<std::string> &out_des_arr) const {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     SignKey &sign_key = ctx->sign_key_;
 
     out_p2p_msg_arr.clear();
@@ -186,9 +195,9 @@ bool Round2::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string
         message.pail_proof_ = ctx->local_party_.pail_proof_;
         message.nsf_proof_ = ctx->remote_parties_[i].nsf_proof_;
         string base64;
-        bool ok = message.ToBase64(base64);
+        bool ok = ctx->EncodeMessage(message, base64);
         if (!ok) {
-            ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to encode to base64!");
+            ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to encode the message!");
             return false;
         }
         out_p2p_msg_arr.push_back(base64);
@@ -7,6 +7,7 @@ using safeheron::curve::Curve;
 using safeheron::curve::CurvePoint;
 using safeheron::curve::CurveType;
 using safeheron::multi_party_ecdsa::gg18::SignKey;
+using safeheron::multi_party_ecdsa::gg18::SignKeyHandle;
 
 static BN POW2_256 = BN(1) << 256;
 
@@ -22,6 +23,7 @@ Context::Context(int total_parties): MPCContext(total_parties){
 Context::Context(const Context &ctx): MPCContext(ctx){
     // Assign all the member variables.
     sign_key_ = ctx.sign_key_;
+    quorum_ = ctx.quorum_;
 
     m_ = ctx.m_;
     V_ = ctx.V_;
@@ -58,6 +60,7 @@ Context &Context::operator=(const Context &ctx){
 
     // Assign all the member variables.
     sign_key_ = ctx.sign_key_;
+    quorum_ = ctx.quorum_;
 
     m_ = ctx.m_;
     V_ = ctx.V_;
@@ -103,6 +106,25 @@ bool Context::CreateContext(Context &ctx, const std::string &sign_key_base64, co
     return true;
 }
 
+bool Context::CreateContext(Context &ctx, const SignKeyHandle &sign_key_handle,
+                            const std::vector<std::string> &participant_id_arr, const safeheron::bignum::BN &m) {
+    bool ok = true;
+    ctx.m_ = m;
+
+    ok = sign_key_handle.Trim(ctx.sign_key_, participant_id_arr);
+    if (!ok) return false;
+    ok = ((int)ctx.sign_key_.n_parties_ == ctx.get_total_parties());
+    if (!ok) return false;
+    ctx.quorum_ = sign_key_handle.GetQuorum(ctx.sign_key_);
+    if (!ctx.quorum_) return false;
+
+    for (uint32_t i = 0; i < ctx.sign_key_.n_parties_ - 1; ++i) {
+        ctx.remote_parties_.emplace_back();
+    }
+
+    return true;
+}
+
 void Context::BindAllRounds() {
     RemoveAllRounds();
     AddRound(&round0_);//
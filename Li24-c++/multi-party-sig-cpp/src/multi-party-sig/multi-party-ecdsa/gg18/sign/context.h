@@ -2,11 +2,13 @@
 #ifndef SAFEHERON_MULTI_PARTY_ECDSA_GG18_SIGN_ONCE_CONTEXT_H
 #define SAFEHERON_MULTI_PARTY_ECDSA_GG18_SIGN_ONCE_CONTEXT_H
 
+#include <memory>
 #include <vector>
 #include "crypto-suites/crypto-curve/curve.h"
 #include "crypto-suites/crypto-bn/bn.h"
 #include "multi-party-sig/mpc-flow/mpc-parallel-v2/mpc_context.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/sign_key.h"
+#include "multi-party-sig/multi-party-ecdsa/gg18/sign_key_handle.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/sign/t_party.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/sign/round0.h"
 #include "multi-party-sig/multi-party-ecdsa/gg18/sign/round1.h"
@@ -46,8 +48,17 @@ public:
 
     static bool CreateContext(Context &ctx, const std::string &sign_key_base64, const safeheron::bignum::BN &m);
 
+    /**
+     * Same as above, but take the sign key from a handle, so that it is neither decoded nor trimmed from base64 again.
+     * @param participant_id_arr all the parties that take part in the signature.
+     */
+    static bool CreateContext(Context &ctx, const safeheron::multi_party_ecdsa::gg18::SignKeyHandle &sign_key_handle,
+                              const std::vector<std::string> &participant_id_arr, const safeheron::bignum::BN &m);
+
 public:
     safeheron::multi_party_ecdsa::gg18::SignKey sign_key_;
+    // Set by the sign key handle, or computed in round 0
+    std::shared_ptr<const safeheron::multi_party_ecdsa::gg18::Quorum> quorum_;
     safeheron::bignum::BN m_;
     safeheron::curve::CurvePoint V_;
 
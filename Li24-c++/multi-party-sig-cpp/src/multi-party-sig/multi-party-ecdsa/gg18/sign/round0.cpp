@@ -14,6 +14,7 @@ using safeheron::curve::CurvePoint;
 using safeheron::curve::Curve;
 using safeheron::sss::Polynomial;
 using safeheron::multi_party_ecdsa::gg18::SignKey;
+using safeheron::multi_party_ecdsa::gg18::Quorum;
 using safeheron::zkp::pail::PailEncRangeSetUp_V1;
 using safeheron::zkp::pail::PailEncRangeStatement_V1;
 using safeheron::zkp::pail::PailEncRangeProof_V1;
@@ -34,20 +35,24 @@ namespace sign{
 bool Round0::ComputeVerify() {
     bool ok = true;
     // Validate child private key share
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const Curve * curv = GetCurveParam(sign_key.X_.GetCurveType());
 
     // Compute w = x * lambda mod q
-    vector<BN> share_index_arr;
-    for (size_t i = 0; i < ctx->remote_parties_.size(); ++i) {
-        share_index_arr.push_back(sign_key.remote_parties_[i].index_);
+    // The quorum comes from the sign key handle, otherwise it is computed for this signature only
+    if (!ctx->quorum_) {
+        std::shared_ptr<Quorum> quorum = std::make_shared<Quorum>();
+        if (!quorum->Compute(sign_key)) {
+            ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed in quorum->Compute(sign_key)!");
+            return false;
+        }
+        ctx->quorum_ = quorum;
     }
-    share_index_arr.push_back(sign_key.local_party_.index_);
     vector<BN> &l_arr = ctx->local_party_.l_arr_;
-    Polynomial::GetLArray(l_arr, BN::ZERO, share_index_arr, curv->n);
-    ctx->local_party_.lambda_ = l_arr[share_index_arr.size()-1];
+    l_arr = ctx->quorum_->l_arr_;
+    ctx->local_party_.lambda_ = l_arr.back();
     for (size_t i = 0; i < ctx->remote_parties_.size(); ++i) {
         ctx->remote_parties_[i].lambda_ = l_arr[i];
     }
@@ -88,7 +93,7 @@ bool Round0::ComputeVerify() {
 
 bool Round0::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string &out_bc_msg,
                          std::vector<std::string> &out_des_arr) const {
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     out_p2p_msg_arr.clear();
@@ -103,9 +108,9 @@ bool Round0::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string
         Round0P2PMessage p2p_message;
         p2p_message.alice_proof_ = ctx->remote_parties_[i].alice_proof_;
         string base64;
-        bool ok = p2p_message.ToBase64(base64);
+        bool ok = ctx->EncodeMessage(p2p_message, base64);
         if (!ok) {
-            ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to encode to base64!");
+            ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to encode the message!");
             return false;
         }
         out_p2p_msg_arr.push_back(base64);
@@ -114,9 +119,9 @@ bool Round0::MakeMessage(std::vector<std::string> &out_p2p_msg_arr, std::string
     Round0BCMessage bc_message;
     bc_message.commitment_ = ctx->local_party_.commitment_Gamma_;
     bc_message.message_a_ = ctx->local_party_.message_a_;
-    bool ok = bc_message.ToBase64(out_bc_msg);
+    bool ok = ctx->EncodeMessage(bc_message, out_bc_msg);
     if (!ok) {
-        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed in bc_message.ToBase64(out_bc_msg)!");
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed in ctx->EncodeMessage(bc_message, out_bc_msg)!");
         return false;
     }
 
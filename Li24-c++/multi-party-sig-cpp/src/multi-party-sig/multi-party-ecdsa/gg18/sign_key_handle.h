@@ -0,0 +1,68 @@
+#ifndef SAFEHERON_MULTI_PARTY_ECDSA_GG18_SIGN_KEY_HANDLE_H
+#define SAFEHERON_MULTI_PARTY_ECDSA_GG18_SIGN_KEY_HANDLE_H
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "multi-party-sig/multi-party-ecdsa/gg18/sign_key.h"
+#include "multi-party-sig/multi-party-ecdsa/gg18/quorum.h"
+
+namespace safeheron {
+namespace multi_party_ecdsa{
+namespace gg18{
+
+/**
+ * A sign key which is parsed and validated once, then shared by all the contexts created from it.
+ *
+ * The handle is immutable, so one handle can be used by several threads at the same time. Every context takes its own
+ * copy of the key (trimmed to the signers), the handle itself is never serialized again.
+ *
+ * GG20 signs with GG18 keys, so the GG20 contexts are created from this handle too.
+ */
+class SignKeyHandle {
+public:
+    /**
+     * Parse and validate a sign key.
+     * @param sign_key_base64 sign key in base64
+     * @return the handle, or nullptr if the key is invalid.
+     */
+    static std::shared_ptr<const SignKeyHandle> FromBase64(const std::string &sign_key_base64);
+
+    /**
+     * Validate a sign key and take a copy of it.
+     * @return the handle, or nullptr if the key is invalid.
+     */
+    static std::shared_ptr<const SignKeyHandle> FromSignKey(const SignKey &sign_key);
+
+    const SignKey &sign_key() const { return sign_key_; }
+
+    /**
+     * Same as trim_sign_key(), without the base64 round trip.
+     * @param out_sign_key the key restricted to the participants.
+     * @param participant_id_arr all the parties that take part in the signature.
+     */
+    bool Trim(SignKey &out_sign_key, const std::vector<std::string> &participant_id_arr) const;
+
+    /**
+     * The quorum of a key returned by Trim(). It is computed on the first call for a set of signers and cached.
+     * @return the quorum, or nullptr if it could not be computed.
+     */
+    std::shared_ptr<const Quorum> GetQuorum(const SignKey &trimmed_sign_key) const;
+
+private:
+    explicit SignKeyHandle(const SignKey &sign_key): sign_key_(sign_key) {}
+
+    SignKey sign_key_;
+
+    // Keyed by the ids of the remote signers. The cache does not change the key, so the handle stays immutable.
+    mutable std::mutex mutex_;
+    mutable std::map<std::string, std::shared_ptr<const Quorum>> quorum_map_;
+};
+
+}
+}
+}
+
+#endif //SAFEHERON_MULTI_PARTY_ECDSA_GG18_SIGN_KEY_HANDLE_H
@@ -15,6 +15,15 @@ bool CheckIndexArr(const std::vector<safeheron::bignum::BN> &share_index_arr, co
 
 int find_party_id(std::string &party_id, const std::vector<std::string> &party_id_arr);
 
+class SignKey;
+
+/**
+ * Restrict the sign key to the participants, in place. Unlike the base64 version below, the key is not validated.
+ * @param sign_key
+ * @param party_id_arr. Specified all the parties that would participated in HD Ecdsa Protocol.
+ */
+bool trim_sign_key(SignKey &sign_key, const std::vector<std::string> &participant_id_arr);
+
 /**
  * In {t,n} HD Ecdsa Protocol, the hd_sign key should be pretreated in ahead if t < n.
  * @param out_sign_key_base64
@@ -20,7 +20,7 @@ namespace sign{
 
 void Round7::Init() {
 
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     for (int i = 0; i < ctx->get_total_parties() - 1; ++i) {
         bc_message_arr_.emplace_back();
     }
@@ -29,7 +29,7 @@ void Round7::Init() {
 
 bool Round7::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, const std::string &party_id) {
 
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
 //    const Curve * curv = GetCurveParam(sign_key.X_.GetCurveType());
@@ -40,9 +40,9 @@ bool Round7::ParseMsg(const std::string &p2p_msg, const std::string &bc_msg, con
         return false;
     }
 
-    bool ok = bc_message_arr_[pos].FromBase64(bc_msg);
+    bool ok = ctx->DecodeMessage(bc_msg, bc_message_arr_[pos]);
     if (!ok) {
-        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to deserialize from base64!");
+        ctx->PushErrorCode(1, __FILE__, __LINE__, __FUNCTION__, "Failed to deserialize the message!");
         return false;
     }
 
@@ -56,7 +56,7 @@ bool Round7::ComputeVerify() {
     std::chrono::high_resolution_clock::time_point begin_test = std::chrono::high_resolution_clock::now();
     bool ok = true;
     // Validate child private key share
-    Context *ctx = dynamic_cast<Context *>(this->get_mpc_context());
+    Context *ctx = this->get_context();
     const SignKey &sign_key = ctx->sign_key_;
 
     const Curve * curv = GetCurveParam(sign_key.X_.GetCurveType());
@@ -18,6 +18,7 @@ using safeheron::curve::CurvePoint;
 using safeheron::curve::CurveType;
 using safeheron::multi_party_ecdsa::Li24::key_gen::Context;
 using safeheron::multi_party_ecdsa::Li24::SignKey;
+using safeheron::multi_party_ecdsa::Li24::WireVersion;
 using safeheron::mpc_flow::mpc_parallel_v2::ErrorInfo;
 
 void print_context_stack_if_failed(Context *ctx) {
@@ -47,13 +48,14 @@ std::map<std::string, PartyMessageQue<Msg>> map_id_message_queue;
 #define N_PARTIES 4
 #define THRESHOLD 3
 
-bool key_gen(CurveType curve_type, std::string workspace_id, int threshold, int n_parties, std::string party_id, BN index, std::vector<std::string> remote_party_ids,std::vector<BN> remote_indexes ) {
+bool key_gen(CurveType curve_type, std::string workspace_id, int threshold, int n_parties, std::string party_id, BN index, std::vector<std::string> remote_party_ids,std::vector<BN> remote_indexes, WireVersion wire_version) {
     bool ok = true;
     std::string status;
 
     //create context (define in Li24/key_gen/context.h)
     Context ctx(n_parties);
-    ok = Context::CreateContext(ctx, curve_type, workspace_id, threshold, n_parties, party_id, index, remote_party_ids,remote_indexes);
+    ok = Context::CreateContext(ctx, curve_type, workspace_id, threshold, n_parties, party_id, index, remote_party_ids,remote_indexes,
+                                PRGType::HashChain, wire_version);
     if (!ok) return false;
 
     status = "<== Context of " + party_id + " was created\n";
@@ -110,6 +112,9 @@ bool key_gen(CurveType curve_type, std::string workspace_id, int threshold, int
         return false;
     }
 
+    ok = (ctx.sign_key_.wire_version_ == wire_version);
+    if (!ok) return false;
+
     print_sign_key_info(&ctx);
     return true;
 }
@@ -147,7 +152,7 @@ TEST(Li24, key_gen_mt) {
                 remote_indexes.push_back(indexes[j]);
             }
         }
-        res[i] = std::async(std::launch::async, key_gen, CurveType::SECP256K1, workspace_id, THRESHOLD, N_PARTIES, party_ids[i], indexes[i], remote_party_ids,remote_indexes);
+        res[i] = std::async(std::launch::async, key_gen, CurveType::SECP256K1, workspace_id, THRESHOLD, N_PARTIES, party_ids[i], indexes[i], remote_party_ids,remote_indexes, WireVersion::Hex);
     }
     for (int i = 0; i < N_PARTIES; ++i) {
         EXPECT_TRUE(res[i].get());
@@ -168,7 +173,7 @@ TEST(Li24, key_gen_mt) {
                 remote_indexes.push_back(indexes[j]);
             }
         }
-        res[i] = std::async(std::launch::async, key_gen, CurveType::P256, workspace_id, THRESHOLD, N_PARTIES, party_ids[i], indexes[i], remote_party_ids,remote_indexes);
+        res[i] = std::async(std::launch::async, key_gen, CurveType::P256, workspace_id, THRESHOLD, N_PARTIES, party_ids[i], indexes[i], remote_party_ids,remote_indexes, WireVersion::Hex);
     }
     for (int i = 0; i < N_PARTIES; ++i) {
         EXPECT_TRUE(res[i].get());
@@ -197,6 +202,46 @@ TEST(Li24, key_gen_mt) {
 
 }
 
+TEST(Li24, key_gen_wire_version) {
+    std::future<bool> res[N_PARTIES];
+    std::string workspace_id = "workspace 0";
+    std::string party_ids[N_PARTIES] = {
+            "co_signer1",
+            "co_signer2",
+            "co_signer3",
+            "co_signer4"
+    };
+    BN indexes[N_PARTIES] = {
+            BN(1),
+            BN(2),
+            BN(3),
+            BN(4)
+    };
+
+    // The parties agree on the bytes encoding, then one of them keeps hex
+    for (int mismatch = 0; mismatch < 2; ++mismatch) {
+        printf("Test Li24 key generation with the bytes wire encoding%s\n", mismatch ? " and a mismatch" : "");
+        for (int i = 0; i < N_PARTIES; ++i) {
+            map_id_message_queue[party_ids[i]] = PartyMessageQue<Msg>(ROUNDS);
+        }
+        for (int i = 0; i < N_PARTIES; ++i) {
+            std::vector<std::string> remote_party_ids;
+            std::vector<BN> remote_indexes;
+            for (int j = 0; j < N_PARTIES; ++j) {
+                if (j != i) {
+                    remote_party_ids.push_back(party_ids[j]);
+                    remote_indexes.push_back(indexes[j]);
+                }
+            }
+            WireVersion wire_version = (mismatch && i == 0) ? WireVersion::Hex : WireVersion::Bytes;
+            res[i] = std::async(std::launch::async, key_gen, CurveType::SECP256K1, workspace_id, THRESHOLD, N_PARTIES, party_ids[i], indexes[i], remote_party_ids,remote_indexes, wire_version);
+        }
+        for (int i = 0; i < N_PARTIES; ++i) {
+            EXPECT_EQ(res[i].get(), mismatch == 0);
+        }
+    }
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     int ret = RUN_ALL_TESTS();
@@ -0,0 +1,186 @@
+#include <future>
+#include <google/protobuf/stubs/common.h>
+#include "gtest/gtest.h"
+#include "crypto-suites/crypto-curve/curve.h"
+#include "crypto-suites/crypto-sss/polynomial.h"
+#include "crypto-suites/exception/located_exception.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/Li24.h"
+#include "../thread_safe_queue.h"
+#include "../message.h"
+#include "../party_message_queue.h"
+
+using std::string;
+using std::vector;
+using safeheron::bignum::BN;
+using safeheron::curve::Curve;
+using safeheron::curve::CurvePoint;
+using safeheron::curve::CurveType;
+using safeheron::sss::Polynomial;
+using safeheron::mpc_flow::mpc_parallel_v2::ErrorInfo;
+using safeheron::multi_party_ecdsa::Li24::key_refresh::Context;
+using safeheron::multi_party_ecdsa::Li24::SignKey;
+
+void print_context_stack_if_failed(Context *ctx) {
+    std::string err_info;
+    vector<ErrorInfo> error_stack;
+    ctx->get_error_stack(error_stack);
+    for(const auto &err: error_stack){
+        err_info += "error code ( " + std::to_string(err.code_) + " ) : " + err.info_ + "\n";
+    }
+    printf("%s", err_info.c_str());
+}
+
+std::map<std::string, PartyMessageQue<Msg>> map_id_message_queue;
+
+#define ROUNDS 2
+#define N_PARTIES 5
+#define THRESHOLD 4
+
+bool key_refresh(int n_parties, std::string sign_key_base64, std::string *out_sign_key_base64) {
+    bool ok = true;
+    std::string status;
+
+    //create context (define in Li24/key_refresh/context.h)
+    Context ctx(n_parties);
+    ok = Context::CreateContext(ctx, sign_key_base64);
+    if (!ok) return false;
+
+    status = "<== Context of " + ctx.sign_key_.local_party_.party_id_ + " was created\n";
+    printf("%s", status.c_str());
+
+    //perform 2 rounds of MPC
+    for (int round = 0; round < ROUNDS; ++round) {
+        if (round == 0) {
+            ok = ctx.PushMessage();
+            if (!ok) {
+                print_context_stack_if_failed(&ctx);
+                return false;
+            }
+        } else {
+            for(int k = 0; k < n_parties - 1; k++) {
+                Msg m;
+                ThreadSafeQueue<Msg> &in_queue = map_id_message_queue.at(ctx.sign_key_.local_party_.party_id_).get(round - 1);
+                in_queue.Pop(m);
+                ok = ctx.PushMessage(m.p2p_msg_, m.bc_msg_, m.src_, round - 1);
+                if (!ok) {
+                    print_context_stack_if_failed(&ctx);
+                    return false;
+                }
+            }
+        }
+
+        ok = ctx.IsCurRoundFinished();
+        if (!ok) {
+            print_context_stack_if_failed(&ctx);
+            return false;
+        }
+        status = "<== Round " + std::to_string(round) + ", " + ctx.sign_key_.local_party_.party_id_ + " \n";
+        printf("%s", status.c_str());
+
+        std::string out_bc_message;
+        vector<string> out_p2p_message_arr;
+        vector<string> out_des_arr;
+        ok = ctx.PopMessages(out_p2p_message_arr, out_bc_message, out_des_arr);
+        if (!ok) {
+            print_context_stack_if_failed(&ctx);
+            return false;
+        }
+
+        for (size_t j = 0; j < out_des_arr.size(); ++j) {
+            Msg m = {ctx.sign_key_.local_party_.party_id_, out_bc_message, out_p2p_message_arr.empty() ? "": out_p2p_message_arr[j]};
+            ThreadSafeQueue<Msg> &out_queue = map_id_message_queue.at(out_des_arr[j]).get(round);
+            out_queue.Push(m);
+        }
+    }
+
+    ok = ctx.IsFinished();
+    if (!ok) {
+        print_context_stack_if_failed(&ctx);
+        return false;
+    }
+
+    return ctx.sign_key_.ToBase64(*out_sign_key_base64);
+}
+
+TEST(Li24, key_refresh_mt) {
+    std::future<bool> res[N_PARTIES];
+
+    std::string party_ids[N_PARTIES] = {
+            "co_signer1",
+            "co_signer2",
+            "co_signer3",
+            "co_signer4",
+            "co_signer5"
+    };
+
+    //SECP256K1 sign key
+    std::string sign_key_base64_arr[N_PARTIES]={
+        "Cgt3b3Jrc3BhY2UgMBAEGAUq7AMKCmNvX3NpZ25lcjEaAjAxQkA2MjdBNkUxNUE2Qzk2RDZFM0FENzg5NDREMUFFRDY1N0ZBQUM4RTkzNDBFMUFFRTcyRjg4MTAyRDE1Nzk1RTYySo8BCkA2MjM5MTdFNjhGOTMwNDI3RDI5Q0E4MTJCNzEyQjM2QTE2QzgzOTUyRjJFRkJGM0NFNjZDQzg2MjEzMjI4RkFDEkBCNzZBOTM3RDJERTdCMzMzQzgzMTYwRTIzRUE1MTc1ODJBQjJFRDU4NkJCQjYxNDFBMDVENzZFRUJBRkYzNzBFGglzZWNwMjU2azFSQDIwNzhBQzUzMDZFNkNFQTc0RTg2Q0NCNTE1NjFEMjlCRTJFRkI0OUU0QzJDRDg5MTdGMzREODA2MUI5RTlEQThSQDZGMTU3MEYxRUZEMjZBMTlERDgyNzREMkU0MkM4Rjc0NUUzQ0MzMENBODQyNjUxQTBFRDJDMDE4MzVDNEFCOTFSQDM5Q0U0OEI4QjY2RDIyRjZCMTY5M0I5QTY1MTg4RkIzRDk4REUxODJENEZFMjhDNzFGRTE1MjgwNTMxOTcyM0NSQDc4Q0VDMUQzQ0ZCNkExRkMzN0Q3NTcyRTc1QzMwN0IzOEZGODRFRjE4QjM5Qjg1RDY2MzRGRjU1NzM0ODY3ODAyUgoKY29fc2lnbmVyMhoCMDJSQDczOTYyNUQ4Njc3QTc2MTA5N0NEMkY3RTNEODY4M0NBQTVBNkNDNkUxRTRCQjU1RUNCMTUyNDA4QjRDN0IxNjcyUgoKY29fc2lnbmVyMxoCMDNSQEJFQUEwMEY3N0FFMkJGMUIzRjE3RjgxMzE0N0MwNThCRjYyRjg0QzdDMDg5OTVEMDA3RUUyNzc0OTYxNTY0MjkyUgoKY29fc2lnbmVyNBoCMDRSQDNCNEQwN0VEOTEwNTRDMTJCODQyMTA3NkE1NUY1NDZGRDc1QkNDNzgwMzZBRjk5RjUyMjk4NUYwQzQyQjM3NjQyUgoKY29fc2lnbmVyNRoCMDVSQENFNDlGMjZCQkE5RkFDRkM2RDRCNDM2NEVFMzBGNkExNEU0NTExQjUzRTQ2RDIzMjFGQTdFOUZFOUUwQzU2OUM6jwEKQDU5MzRCOUNBRDNBQkU3NkM5MDEyMEI4MkM3ODkwNkQ0QjBGODMwOTk1NDM5QjhEMzFCOTFBMzQ2N0RDQjZGQzESQEFDRUIxQ0Q2OUY5QkMxNTY4MzczRUJFRjdENUY1NTdFQTUzNDFCQ0Y4QjFFNEY3MEM3RDI0OUExREYxMzdBOTgaCXNlY3AyNTZrMQ.",
+        "Cgt3b3Jrc3BhY2UgMBAEGAUq7AMKCmNvX3NpZ25lcjIaAjAyQkBDRTcyQ0VBQjY3NTYwQzM0QzkzNzFEMjBCQjMwRjUyMDZGMkM2OTBCMjA0MjA1MEE0NjVBMTk1REE1OERGMkNDSo8BCkBEREIzQkRCNEYwMTA2Rjk4NjNGQjc0OTk0NEQ1MDg5ODEyQjU2RjI5MjlBN0E4NDQxNEE0M0Q1RkQ1OEUwNzE3EkAyRUZDMzVGOUE2MUUxRTRCNkRFQkNEMzQ0NDVFQjQzMTMzNTBDMDBGOEYyMEY4ODEzNkRGRUQ2QzE2MEFEOUI4GglzZWNwMjU2azFSQDUzMUQ3OTg1NjA5M0E3Njk0OTQ2NjJDOTI4MjRCMTJFQzJCNzE3Q0ZEMjFFRENDRDRCRTA0QzAyOTkyOTEzQkZSQDFENUQ2OTk2OUYxQUJDMkFEQ0U4NUFBQkUyOTkxNEU4Mzk0OTY2MUYzRDhGNzQ4QzdDRTg1MUM2QTI5N0I1REVSQDBFQkQ2MzFGNzBDMTcxMzgwMzVGNTU3OTdCNTFFRTNDQ0JFMTExNkNEQTI5MDc0MjBENDVGMkM4N0I4M0M0NTVSQDExQUEzRjI5MTA0MDRFNUMyMEJBQTRBMjhBNkM0OURGNDg1QjExMEUyM0EyM0NFODgwRkY3Njg4MEMxNjc3MkYyUgoKY29fc2lnbmVyMRoCMDFSQDczOTYyNUQ4Njc3QTc2MTA5N0NEMkY3RTNEODY4M0NBQTVBNkNDNkUxRTRCQjU1RUNCMTUyNDA4QjRDN0IxNjcyUgoKY29fc2lnbmVyMxoCMDNSQDI4RDBBODY3QjYzNDQ4Q0E1QjUyRUFCOTVFRUYzRjM0MEE3ODY5MjZBQ0RDQjhDREZFOEJGMkZBQjg3ODAwNzQyUgoKY29fc2lnbmVyNBoCMDRSQDMwODIwMjYxNEIzNEI1RjRGNjE5NTI2OTNDNDk2QTdGOEQ3MUIxMUZCMERFMjdFQUNCNThCMThFNjdCMkM2OTIyUgoKY29fc2lnbmVyNRoCMDVSQDU4NDk5QjQ2MkE3RkRFNDU2NUIwOUU4MkUwRUFCMkJGNDUzM0FCODFEQzMyMzc2QUZEQTM2RjE3OEU5QjU2MTA6jwEKQDU5MzRCOUNBRDNBQkU3NkM5MDEyMEI4MkM3ODkwNkQ0QjBGODMwOTk1NDM5QjhEMzFCOTFBMzQ2N0RDQjZGQzESQEFDRUIxQ0Q2OUY5QkMxNTY4MzczRUJFRjdENUY1NTdFQTUzNDFCQ0Y4QjFFNEY3MEM3RDI0OUExREYxMzdBOTgaCXNlY3AyNTZrMQ.",
+        "Cgt3b3Jrc3BhY2UgMBAEGAUq7AMKCmNvX3NpZ25lcjMaAjAzQkAxQkEyQjg4MzBGODEzRDQwQjhDNEQ0REYzMDg3MkI2OUZBMzdFMDg5REM2OTA1REQxOTIzRDM5QUVFRTU2NDlESo8BCkAwQzA0NTlBNTE5RUMzODIxN0I3N0NGRTg0NEY5MzMzNzlFRTcxQ0RDRTcyNUEwQjk0MDM2Nzg5OUExM0QwNUVDEkBFREQwRkI0Mjc0NzM0ODhGQkRERTVENkFCOEQ2QzUyQUQ3ODhGQzJBMEIyNUNDNUU2MTA4ODIyRjBFNDM0QTg2GglzZWNwMjU2azFSQDRGOTQ5MDA1OEIxMDU1MDE2MTk1ODM0MDMwNEY3NjE3OTdGMkMxQkIxODQ3MzBCNUY5MUI2NzVDNjA1MEI4OThSQDBCNzMzRUQxMTcxOThDOUY3RTZBOTAwRDdDNTYyQTRCRDEyRjAzMDc2RjRENDQ0MTgxQTNBMTM0MTVFMDRBOTZSQDU4QjEwODhEREYwMTBEODFEMTlBRjQyNDhBMUQyMzVENDU2MDQ1MjNDODU5MkI0RDVCNUZBMkVBMUI0MjJBRTFSQDVGRDA4N0EwMEM1OERERTc0NjYyRTRDNjQ3NjBERTU1RDg3M0I3NTVGRTdBNzE0QTg4QTYwNDREMkQ3MTdCMzkyUgoKY29fc2lnbmVyMRoCMDFSQEJFQUEwMEY3N0FFMkJGMUIzRjE3RjgxMzE0N0MwNThCRjYyRjg0QzdDMDg5OTVEMDA3RUUyNzc0OTYxNTY0MjkyUgoKY29fc2lnbmVyMhoCMDJSQDI4RDBBODY3QjYzNDQ4Q0E1QjUyRUFCOTVFRUYzRjM0MEE3ODY5MjZBQ0RDQjhDREZFOEJGMkZBQjg3ODAwNzQyUgoKY29fc2lnbmVyNBoCMDRSQEE4MEQ2NDI5QzQ3M0Q5MDY2N0FCQzQ4REI2REE0NEI0RkJENEM1OUQ1MkZFNEQzNDg5RkJFOTYxMzQwQjMzNUQyUgoKY29fc2lnbmVyNRoCMDVSQEI1NUE2RjkyQkYwQ0EwQ0UxNDdDQTA5NDY1NUJEOEM3OUYxMjA4MzczOEQ2NzgwNkI2MjdFRkQ0QUQ2NzFCQUE6jwEKQDU5MzRCOUNBRDNBQkU3NkM5MDEyMEI4MkM3ODkwNkQ0QjBGODMwOTk1NDM5QjhEMzFCOTFBMzQ2N0RDQjZGQzESQEFDRUIxQ0Q2OUY5QkMxNTY4MzczRUJFRjdENUY1NTdFQTUzNDFCQ0Y4QjFFNEY3MEM3RDI0OUExREYxMzdBOTgaCXNlY3AyNTZrMQ.",
+        "Cgt3b3Jrc3BhY2UgMBAEGAUq7AMKCmNvX3NpZ25lcjQaAjA0QkAyNTc5Mjg1RjBBQTIxRUFBMkU4QzU1QTYzNUYwODZEOTZENjc0QjZFMThFMzM4OUQ1MTIwNkI3MjIzNkQ1NEVBSo8BCkBERjc0RjMzNUVGQkVDMkZCQ0E3RDBFMkVEMDYyMzQ5OEQ0MzBCMzgyRTAyQkI5REM0MDI1QUEzQ0Q2REExNkIyEkA1OUU2ODcyOTczNjhGMjZERjVCOEREMTY2RDkxQkY1NjFBNDM2NkU0RDI1MzE5OUNFNTNEQTdDMDMwQ0M4NThCGglzZWNwMjU2azFSQDAxN0VCRjM0REE5ODI5MUMwNkQ4RDREQzQwNDZDNEJCRkRDREVBRjUyRTZDRDBEODMyNDgzMzcwNzExMUM1MjhSQDIxQzQ5RjQxREE3MzQ0QkNGMkI5RkNFRkMwRjc3QzQyQzE5MDlGQjJENkI1MjBBOEJFMTJCRUM1RUMyRjAyM0RSQDRGNUM1QjlCRTU3MkNCODQ5NjEwRDA2OTJDQkQyMTU3QjY3NDgwNzk4QUE1MjFFNzJFOUM0Njc3MThDOTA4N0NSQDFBQkEyRTU1RUZDMUI2NjBDMzY1RUFDMjZBRDY4NURGQ0U5QTM2QkYxN0Q0OTQ5QTIxOEI0MTMwN0QwMEI0NzcyUgoKY29fc2lnbmVyMRoCMDFSQDNCNEQwN0VEOTEwNTRDMTJCODQyMTA3NkE1NUY1NDZGRDc1QkNDNzgwMzZBRjk5RjUyMjk4NUYwQzQyQjM3NjQyUgoKY29fc2lnbmVyMhoCMDJSQDMwODIwMjYxNEIzNEI1RjRGNjE5NTI2OTNDNDk2QTdGOEQ3MUIxMUZCMERFMjdFQUNCNThCMThFNjdCMkM2OTIyUgoKY29fc2lnbmVyMxoCMDNSQEE4MEQ2NDI5QzQ3M0Q5MDY2N0FCQzQ4REI2REE0NEI0RkJENEM1OUQ1MkZFNEQzNDg5RkJFOTYxMzQwQjMzNUQyUgoKY29fc2lnbmVyNRoCMDVSQDk3NjQyNzJFQkJBQzY5RDFGQkM3NEY4QjU1QTA4ODU5NzhEMUZCQ0FFOThEODBDOTY5ODcxMzQ2RTQ0MDlGNDI6jwEKQDU5MzRCOUNBRDNBQkU3NkM5MDEyMEI4MkM3ODkwNkQ0QjBGODMwOTk1NDM5QjhEMzFCOTFBMzQ2N0RDQjZGQzESQEFDRUIxQ0Q2OUY5QkMxNTY4MzczRUJFRjdENUY1NTdFQTUzNDFCQ0Y4QjFFNEY3MEM3RDI0OUExREYxMzdBOTgaCXNlY3AyNTZrMQ.",
+        "Cgt3b3Jrc3BhY2UgMBAEGAUq7AMKCmNvX3NpZ25lcjUaAjA1QkBDNzY1MUIwMUM0MEZDRTg5NEY5OTQ0OUJDRkFDMTUxNjI0RjU0NjQ5MUFBQkU0MTExN0U2NTA1NkQ0QTZFMjQ2So8BCkAzQzM2MzVBQjJBMjMyNUY5MjFBRjk3RkM4RTZBMTIzQ0QzNEYwQURDQ0ZBNkMyMjhFQ0ZCRUU1RjQ5MTZEODFFEkAwNTg0MTVGMTQ2MDcyNUFCNkMzMTc5NjZBOUZGMjVDNDRGNjY4OURENTExNTg0QTdBNEJEMEMyNTY2QzJFQjExGglzZWNwMjU2azFSQDU1N0IzMDk3RUFFOTBCMDAzNTczRUMzNjc4NkRFRUVEQkU0Q0MyQzNCMzBEMTlENEI5NzJFQUE5MkFDM0VGMUNSQDQ2OUY1QzFEMUEzRjhGRTk0NEY1RjlFMDU2N0U2OERGRkNEODlBNzNCODhGRkE4MjdDQTNGODhGODI4NERFRTFSQDU1ODlFN0YyQjJCM0MyRTZDRTE5QkJDRTFERkFGQTcxQzY5RTUwRTEzQTVDMDZCQzJEODFFQjg3N0ZGNUEwNzFSQDdDQTlGOEQ4Q0JFQUIzNzEzODYxNjRDOEVBQ0EwMjc5QUEzN0M1MEJEMUI4RUMyRjQ3RkJEMjE2NjczRkVBQ0IyUgoKY29fc2lnbmVyMRoCMDFSQENFNDlGMjZCQkE5RkFDRkM2RDRCNDM2NEVFMzBGNkExNEU0NTExQjUzRTQ2RDIzMjFGQTdFOUZFOUUwQzU2OUMyUgoKY29fc2lnbmVyMhoCMDJSQDU4NDk5QjQ2MkE3RkRFNDU2NUIwOUU4MkUwRUFCMkJGNDUzM0FCODFEQzMyMzc2QUZEQTM2RjE3OEU5QjU2MTAyUgoKY29fc2lnbmVyMxoCMDNSQEI1NUE2RjkyQkYwQ0EwQ0UxNDdDQTA5NDY1NUJEOEM3OUYxMjA4MzczOEQ2NzgwNkI2MjdFRkQ0QUQ2NzFCQUEyUgoKY29fc2lnbmVyNBoCMDRSQDk3NjQyNzJFQkJBQzY5RDFGQkM3NEY4QjU1QTA4ODU5NzhEMUZCQ0FFOThEODBDOTY5ODcxMzQ2RTQ0MDlGNDI6jwEKQDU5MzRCOUNBRDNBQkU3NkM5MDEyMEI4MkM3ODkwNkQ0QjBGODMwOTk1NDM5QjhEMzFCOTFBMzQ2N0RDQjZGQzESQEFDRUIxQ0Q2OUY5QkMxNTY4MzczRUJFRjdENUY1NTdFQTUzNDFCQ0Y4QjFFNEY3MEM3RDI0OUExREYxMzdBOTgaCXNlY3AyNTZrMQ."
+    };
+
+    std::string new_sign_key_base64_arr[N_PARTIES];
+
+    printf("Test Li24 key refresh with secp256k1 curve\n");
+    //Initialize the message queue
+    for (int i = 0; i < N_PARTIES; ++i) {
+        map_id_message_queue[party_ids[i]] = PartyMessageQue<Msg>(ROUNDS);
+    }
+    for (int i = 0; i < N_PARTIES; ++i) {
+        res[i] = std::async(std::launch::async, key_refresh, N_PARTIES, sign_key_base64_arr[i], &new_sign_key_base64_arr[i]);
+    }
+    for (int i = 0; i < N_PARTIES; ++i) {
+        EXPECT_TRUE(res[i].get());
+    }
+
+    SignKey old_sign_keys[N_PARTIES];
+    SignKey new_sign_keys[N_PARTIES];
+    for (int i = 0; i < N_PARTIES; ++i) {
+        ASSERT_TRUE(old_sign_keys[i].FromBase64(sign_key_base64_arr[i]));
+        ASSERT_TRUE(new_sign_keys[i].FromBase64(new_sign_key_base64_arr[i]));
+        EXPECT_TRUE(new_sign_keys[i].ValidityTest());
+        //Same public key, new share
+        EXPECT_TRUE(new_sign_keys[i].X_ == old_sign_keys[i].X_);
+        EXPECT_TRUE(new_sign_keys[i].local_party_.x_ != old_sign_keys[i].local_party_.x_);
+    }
+
+    //Both parties of a pair hold the same new seed
+    for (int i = 0; i < N_PARTIES; ++i) {
+        for (int j = 0; j < N_PARTIES; ++j) {
+            if (i == j) continue;
+            int pos_j = new_sign_keys[i].get_remote_party_pos(party_ids[j]);
+            int pos_i = new_sign_keys[j].get_remote_party_pos(party_ids[i]);
+            ASSERT_TRUE(pos_j != -1 && pos_i != -1);
+            EXPECT_TRUE(new_sign_keys[i].remote_parties_[pos_j].seed_ == new_sign_keys[j].remote_parties_[pos_i].seed_);
+            EXPECT_TRUE(new_sign_keys[i].remote_parties_[pos_j].seed_ != old_sign_keys[i].remote_parties_[pos_j].seed_);
+        }
+    }
+
+    //Any THRESHOLD new shares interpolate to the private key
+    const Curve *curv = safeheron::curve::GetCurveParam(new_sign_keys[0].X_.GetCurveType());
+    vector<BN> share_index_arr;
+    for (int i = 0; i < THRESHOLD; ++i) {
+        share_index_arr.push_back(new_sign_keys[i].local_party_.index_);
+    }
+    vector<BN> l_arr;
+    Polynomial::GetLArray(l_arr, BN::ZERO, share_index_arr, curv->n);
+    CurvePoint pub = new_sign_keys[0].local_party_.g_x_ * l_arr[0];
+    for (int i = 1; i < THRESHOLD; ++i) {
+        pub += new_sign_keys[i].local_party_.g_x_ * l_arr[i];
+    }
+    EXPECT_TRUE(pub == new_sign_keys[0].X_);
+
+    //A key cannot be refreshed by a subset of the parties
+    Context ctx(N_PARTIES - 1);
+    EXPECT_FALSE(Context::CreateContext(ctx, sign_key_base64_arr[0]));
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    int ret = RUN_ALL_TESTS();
+    google::protobuf::ShutdownProtobufLibrary();
+    return ret;
+}
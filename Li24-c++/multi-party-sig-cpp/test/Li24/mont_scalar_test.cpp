@@ -0,0 +1,111 @@
+#include <chrono>
+#include <vector>
+#include <google/protobuf/stubs/common.h>
+#include "gtest/gtest.h"
+#include "crypto-suites/crypto-bn/bn.h"
+#include "crypto-suites/crypto-bn/rand.h"
+#include "crypto-suites/crypto-curve/curve.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/mont_scalar.h"
+
+using safeheron::bignum::BN;
+using safeheron::curve::Curve;
+using safeheron::curve::CurveType;
+using safeheron::multi_party_ecdsa::Li24::MontField;
+using safeheron::multi_party_ecdsa::Li24::MontScalar;
+
+void check_field(CurveType curve_type) {
+    const Curve *curv = safeheron::curve::GetCurveParam(curve_type);
+    const MontField *field = MontField::Get(curve_type);
+    ASSERT_TRUE(field != nullptr);
+    ASSERT_EQ(field, MontField::Get(curve_type));
+
+    // Edge values around 0, n and 2^256
+    BN edge_arr[] = {BN(0), BN(1), BN(2), curv->n - BN(1), curv->n, curv->n + BN(1),
+                     (BN(1) << 256) - BN(1), BN(1) << 256, BN(1) << 300, BN(-1), BN(0) - curv->n - BN(5)};
+    for (const BN &value : edge_arr) {
+        BN expected = value % curv->n;
+        if (expected.IsNeg()) expected += curv->n;
+        EXPECT_TRUE(field->FromBN(value).ToBN() == expected);
+    }
+    EXPECT_TRUE(field->FromBN(BN(0)).IsZero());
+    EXPECT_TRUE(field->FromBN(curv->n) == field->Zero());
+    EXPECT_TRUE(field->Zero().Inv().IsZero());
+
+    for (int i = 0; i < 200; ++i) {
+        BN a = safeheron::rand::RandomBNLt(curv->n);
+        BN b = safeheron::rand::RandomBNLt(curv->n);
+        if (i == 0) a = curv->n - BN(1);
+        MontScalar ma = field->FromBN(a);
+        MontScalar mb = field->FromBN(b);
+        EXPECT_TRUE((ma + mb).ToBN() == (a + b) % curv->n);
+        EXPECT_TRUE((ma - mb).ToBN() == (a - b + curv->n) % curv->n);
+        EXPECT_TRUE((mb - ma).ToBN() == (b - a + curv->n) % curv->n);
+        EXPECT_TRUE((ma * mb).ToBN() == (a * b) % curv->n);
+        if (!a.IsZero()) {
+            EXPECT_TRUE(ma.Inv().ToBN() == a.InvM(curv->n));
+            EXPECT_TRUE((ma * ma.Inv()).ToBN() == BN(1));
+        }
+        MontScalar acc = ma;
+        acc += mb;
+        acc *= ma;
+        acc -= mb;
+        EXPECT_TRUE(acc.ToBN() == (((a + b) * a - b) % curv->n + curv->n) % curv->n);
+    }
+}
+
+TEST(MontScalar, Secp256k1) {
+    check_field(CurveType::SECP256K1);
+}
+
+TEST(MontScalar, P256) {
+    check_field(CurveType::P256);
+}
+
+TEST(MontScalar, Unsupported) {
+    EXPECT_TRUE(MontField::Get(CurveType::ED25519) == nullptr);
+}
+
+TEST(MontScalar, Time) {
+    // Round1 of a signature with 31 remote parties, the products reduced one by one as BN does
+    const Curve *curv = safeheron::curve::GetCurveParam(CurveType::SECP256K1);
+    const MontField *field = MontField::Get(CurveType::SECP256K1);
+    const int loops = 200;
+    const size_t peers = 31;
+    BN w = safeheron::rand::RandomBNLt(curv->n);
+    BN phi = safeheron::rand::RandomBNLt(curv->n);
+    std::vector<BN> phi_arr, w_arr;
+    for (size_t i = 0; i < peers; ++i) {
+        phi_arr.push_back(safeheron::rand::RandomBNLt(curv->n));
+        w_arr.push_back(safeheron::rand::RandomBNLt(curv->n));
+    }
+
+    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    BN u;
+    for (int loop = 0; loop < loops; ++loop) {
+        u = w * phi;
+        for (size_t i = 0; i < peers; ++i) u += (w * phi_arr[i] + phi * w_arr[i]) % curv->n;
+        u = u % curv->n;
+        u = u.InvM(curv->n);
+    }
+    std::chrono::steady_clock::time_point middle = std::chrono::steady_clock::now();
+    BN mont_u;
+    for (int loop = 0; loop < loops; ++loop) {
+        MontScalar mw = field->FromBN(w);
+        MontScalar mphi = field->FromBN(phi);
+        MontScalar acc = mw * mphi;
+        for (size_t i = 0; i < peers; ++i) acc += mw * field->FromBN(phi_arr[i]) + mphi * field->FromBN(w_arr[i]);
+        mont_u = acc.Inv().ToBN();
+    }
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    EXPECT_TRUE(u == mont_u);
+    printf("BN: %.1f us, MontScalar: %.1f us\n",
+           std::chrono::duration<double, std::micro>(middle - begin).count() / loops,
+           std::chrono::duration<double, std::micro>(end - middle).count() / loops);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    int ret = RUN_ALL_TESTS();
+    google::protobuf::ShutdownProtobufLibrary();
+    return ret;
+}
@@ -0,0 +1,175 @@
+#include <map>
+#include <memory>
+#include <set>
+#include <google/protobuf/stubs/common.h>
+#include "gtest/gtest.h"
+#include "crypto-suites/crypto-curve/curve.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/Li24.h"
+
+using std::string;
+using std::vector;
+using safeheron::bignum::BN;
+using safeheron::multi_party_ecdsa::Li24::SignKey;
+using safeheron::multi_party_ecdsa::Li24::SignKeyHandle;
+using safeheron::multi_party_ecdsa::Li24::sign::Context;
+using safeheron::multi_party_ecdsa::Li24::sign::PipelinedSigner;
+
+#define N_PARTIES 5
+#define N_SIGNATURES 12
+#define MAX_IN_FLIGHT 4
+
+std::string sign_key_base64_arr[N_PARTIES]={
+        "Cgt3b3Jrc3BhY2UgMBAEGAUq7AMKCmNvX3NpZ25lcjEaAjAxQkA2MjdBNkUxNUE2Qzk2RDZFM0FENzg5NDREMUFFRDY1N0ZBQUM4RTkzNDBFMUFFRTcyRjg4MTAyRDE1Nzk1RTYySo8BCkA2MjM5MTdFNjhGOTMwNDI3RDI5Q0E4MTJCNzEyQjM2QTE2QzgzOTUyRjJFRkJGM0NFNjZDQzg2MjEzMjI4RkFDEkBCNzZBOTM3RDJERTdCMzMzQzgzMTYwRTIzRUE1MTc1ODJBQjJFRDU4NkJCQjYxNDFBMDVENzZFRUJBRkYzNzBFGglzZWNwMjU2azFSQDIwNzhBQzUzMDZFNkNFQTc0RTg2Q0NCNTE1NjFEMjlCRTJFRkI0OUU0QzJDRDg5MTdGMzREODA2MUI5RTlEQThSQDZGMTU3MEYxRUZEMjZBMTlERDgyNzREMkU0MkM4Rjc0NUUzQ0MzMENBODQyNjUxQTBFRDJDMDE4MzVDNEFCOTFSQDM5Q0U0OEI4QjY2RDIyRjZCMTY5M0I5QTY1MTg4RkIzRDk4REUxODJENEZFMjhDNzFGRTE1MjgwNTMxOTcyM0NSQDc4Q0VDMUQzQ0ZCNkExRkMzN0Q3NTcyRTc1QzMwN0IzOEZGODRFRjE4QjM5Qjg1RDY2MzRGRjU1NzM0ODY3ODAyUgoKY29fc2lnbmVyMhoCMDJSQDczOTYyNUQ4Njc3QTc2MTA5N0NEMkY3RTNEODY4M0NBQTVBNkNDNkUxRTRCQjU1RUNCMTUyNDA4QjRDN0IxNjcyUgoKY29fc2lnbmVyMxoCMDNSQEJFQUEwMEY3N0FFMkJGMUIzRjE3RjgxMzE0N0MwNThCRjYyRjg0QzdDMDg5OTVEMDA3RUUyNzc0OTYxNTY0MjkyUgoKY29fc2lnbmVyNBoCMDRSQDNCNEQwN0VEOTEwNTRDMTJCODQyMTA3NkE1NUY1NDZGRDc1QkNDNzgwMzZBRjk5RjUyMjk4NUYwQzQyQjM3NjQyUgoKY29fc2lnbmVyNRoCMDVSQENFNDlGMjZCQkE5RkFDRkM2RDRCNDM2NEVFMzBGNkExNEU0NTExQjUzRTQ2RDIzMjFGQTdFOUZFOUUwQzU2OUM6jwEKQDU5MzRCOUNBRDNBQkU3NkM5MDEyMEI4MkM3ODkwNkQ0QjBGODMwOTk1NDM5QjhEMzFCOTFBMzQ2N0RDQjZGQzESQEFDRUIxQ0Q2OUY5QkMxNTY4MzczRUJFRjdENUY1NTdFQTUzNDFCQ0Y4QjFFNEY3MEM3RDI0OUExREYxMzdBOTgaCXNlY3AyNTZrMQ.",
+        "Cgt3b3Jrc3BhY2UgMBAEGAUq7AMKCmNvX3NpZ25lcjIaAjAyQkBDRTcyQ0VBQjY3NTYwQzM0QzkzNzFEMjBCQjMwRjUyMDZGMkM2OTBCMjA0MjA1MEE0NjVBMTk1REE1OERGMkNDSo8BCkBEREIzQkRCNEYwMTA2Rjk4NjNGQjc0OTk0NEQ1MDg5ODEyQjU2RjI5MjlBN0E4NDQxNEE0M0Q1RkQ1OEUwNzE3EkAyRUZDMzVGOUE2MUUxRTRCNkRFQkNEMzQ0NDVFQjQzMTMzNTBDMDBGOEYyMEY4ODEzNkRGRUQ2QzE2MEFEOUI4GglzZWNwMjU2azFSQDUzMUQ3OTg1NjA5M0E3Njk0OTQ2NjJDOTI4MjRCMTJFQzJCNzE3Q0ZEMjFFRENDRDRCRTA0QzAyOTkyOTEzQkZSQDFENUQ2OTk2OUYxQUJDMkFEQ0U4NUFBQkUyOTkxNEU4Mzk0OTY2MUYzRDhGNzQ4QzdDRTg1MUM2QTI5N0I1REVSQDBFQkQ2MzFGNzBDMTcxMzgwMzVGNTU3OTdCNTFFRTNDQ0JFMTExNkNEQTI5MDc0MjBENDVGMkM4N0I4M0M0NTVSQDExQUEzRjI5MTA0MDRFNUMyMEJBQTRBMjhBNkM0OURGNDg1QjExMEUyM0EyM0NFODgwRkY3Njg4MEMxNjc3MkYyUgoKY29fc2lnbmVyMRoCMDFSQDczOTYyNUQ4Njc3QTc2MTA5N0NEMkY3RTNEODY4M0NBQTVBNkNDNkUxRTRCQjU1RUNCMTUyNDA4QjRDN0IxNjcyUgoKY29fc2lnbmVyMxoCMDNSQDI4RDBBODY3QjYzNDQ4Q0E1QjUyRUFCOTVFRUYzRjM0MEE3ODY5MjZBQ0RDQjhDREZFOEJGMkZBQjg3ODAwNzQyUgoKY29fc2lnbmVyNBoCMDRSQDMwODIwMjYxNEIzNEI1RjRGNjE5NTI2OTNDNDk2QTdGOEQ3MUIxMUZCMERFMjdFQUNCNThCMThFNjdCMkM2OTIyUgoKY29fc2lnbmVyNRoCMDVSQDU4NDk5QjQ2MkE3RkRFNDU2NUIwOUU4MkUwRUFCMkJGNDUzM0FCODFEQzMyMzc2QUZEQTM2RjE3OEU5QjU2MTA6jwEKQDU5MzRCOUNBRDNBQkU3NkM5MDEyMEI4MkM3ODkwNkQ0QjBGODMwOTk1NDM5QjhEMzFCOTFBMzQ2N0RDQjZGQzESQEFDRUIxQ0Q2OUY5QkMxNTY4MzczRUJFRjdENUY1NTdFQTUzNDFCQ0Y4QjFFNEY3MEM3RDI0OUExREYxMzdBOTgaCXNlY3AyNTZrMQ.",
+        "Cgt3b3Jrc3BhY2UgMBAEGAUq7AMKCmNvX3NpZ25lcjMaAjAzQkAxQkEyQjg4MzBGODEzRDQwQjhDNEQ0REYzMDg3MkI2OUZBMzdFMDg5REM2OTA1REQxOTIzRDM5QUVFRTU2NDlESo8BCkAwQzA0NTlBNTE5RUMzODIxN0I3N0NGRTg0NEY5MzMzNzlFRTcxQ0RDRTcyNUEwQjk0MDM2Nzg5OUExM0QwNUVDEkBFREQwRkI0Mjc0NzM0ODhGQkRERTVENkFCOEQ2QzUyQUQ3ODhGQzJBMEIyNUNDNUU2MTA4ODIyRjBFNDM0QTg2GglzZWNwMjU2azFSQDRGOTQ5MDA1OEIxMDU1MDE2MTk1ODM0MDMwNEY3NjE3OTdGMkMxQkIxODQ3MzBCNUY5MUI2NzVDNjA1MEI4OThSQDBCNzMzRUQxMTcxOThDOUY3RTZBOTAwRDdDNTYyQTRCRDEyRjAzMDc2RjRENDQ0MTgxQTNBMTM0MTVFMDRBOTZSQDU4QjEwODhEREYwMTBEODFEMTlBRjQyNDhBMUQyMzVENDU2MDQ1MjNDODU5MkI0RDVCNUZBMkVBMUI0MjJBRTFSQDVGRDA4N0EwMEM1OERERTc0NjYyRTRDNjQ3NjBERTU1RDg3M0I3NTVGRTdBNzE0QTg4QTYwNDREMkQ3MTdCMzkyUgoKY29fc2lnbmVyMRoCMDFSQEJFQUEwMEY3N0FFMkJGMUIzRjE3RjgxMzE0N0MwNThCRjYyRjg0QzdDMDg5OTVEMDA3RUUyNzc0OTYxNTY0MjkyUgoKY29fc2lnbmVyMhoCMDJSQDI4RDBBODY3QjYzNDQ4Q0E1QjUyRUFCOTVFRUYzRjM0MEE3ODY5MjZBQ0RDQjhDREZFOEJGMkZBQjg3ODAwNzQyUgoKY29fc2lnbmVyNBoCMDRSQEE4MEQ2NDI5QzQ3M0Q5MDY2N0FCQzQ4REI2REE0NEI0RkJENEM1OUQ1MkZFNEQzNDg5RkJFOTYxMzQwQjMzNUQyUgoKY29fc2lnbmVyNRoCMDVSQEI1NUE2RjkyQkYwQ0EwQ0UxNDdDQTA5NDY1NUJEOEM3OUYxMjA4MzczOEQ2NzgwNkI2MjdFRkQ0QUQ2NzFCQUE6jwEKQDU5MzRCOUNBRDNBQkU3NkM5MDEyMEI4MkM3ODkwNkQ0QjBGODMwOTk1NDM5QjhEMzFCOTFBMzQ2N0RDQjZGQzESQEFDRUIxQ0Q2OUY5QkMxNTY4MzczRUJFRjdENUY1NTdFQTUzNDFCQ0Y4QjFFNEY3MEM3RDI0OUExREYxMzdBOTgaCXNlY3AyNTZrMQ.",
+        "Cgt3b3Jrc3BhY2UgMBAEGAUq7AMKCmNvX3NpZ25lcjQaAjA0QkAyNTc5Mjg1RjBBQTIxRUFBMkU4QzU1QTYzNUYwODZEOTZENjc0QjZFMThFMzM4OUQ1MTIwNkI3MjIzNkQ1NEVBSo8BCkBERjc0RjMzNUVGQkVDMkZCQ0E3RDBFMkVEMDYyMzQ5OEQ0MzBCMzgyRTAyQkI5REM0MDI1QUEzQ0Q2REExNkIyEkA1OUU2ODcyOTczNjhGMjZERjVCOEREMTY2RDkxQkY1NjFBNDM2NkU0RDI1MzE5OUNFNTNEQTdDMDMwQ0M4NThCGglzZWNwMjU2azFSQDAxN0VCRjM0REE5ODI5MUMwNkQ4RDREQzQwNDZDNEJCRkRDREVBRjUyRTZDRDBEODMyNDgzMzcwNzExMUM1MjhSQDIxQzQ5RjQxREE3MzQ0QkNGMkI5RkNFRkMwRjc3QzQyQzE5MDlGQjJENkI1MjBBOEJFMTJCRUM1RUMyRjAyM0RSQDRGNUM1QjlCRTU3MkNCODQ5NjEwRDA2OTJDQkQyMTU3QjY3NDgwNzk4QUE1MjFFNzJFOUM0Njc3MThDOTA4N0NSQDFBQkEyRTU1RUZDMUI2NjBDMzY1RUFDMjZBRDY4NURGQ0U5QTM2QkYxN0Q0OTQ5QTIxOEI0MTMwN0QwMEI0NzcyUgoKY29fc2lnbmVyMRoCMDFSQDNCNEQwN0VEOTEwNTRDMTJCODQyMTA3NkE1NUY1NDZGRDc1QkNDNzgwMzZBRjk5RjUyMjk4NUYwQzQyQjM3NjQyUgoKY29fc2lnbmVyMhoCMDJSQDMwODIwMjYxNEIzNEI1RjRGNjE5NTI2OTNDNDk2QTdGOEQ3MUIxMUZCMERFMjdFQUNCNThCMThFNjdCMkM2OTIyUgoKY29fc2lnbmVyMxoCMDNSQEE4MEQ2NDI5QzQ3M0Q5MDY2N0FCQzQ4REI2REE0NEI0RkJENEM1OUQ1MkZFNEQzNDg5RkJFOTYxMzQwQjMzNUQyUgoKY29fc2lnbmVyNRoCMDVSQDk3NjQyNzJFQkJBQzY5RDFGQkM3NEY4QjU1QTA4ODU5NzhEMUZCQ0FFOThEODBDOTY5ODcxMzQ2RTQ0MDlGNDI6jwEKQDU5MzRCOUNBRDNBQkU3NkM5MDEyMEI4MkM3ODkwNkQ0QjBGODMwOTk1NDM5QjhEMzFCOTFBMzQ2N0RDQjZGQzESQEFDRUIxQ0Q2OUY5QkMxNTY4MzczRUJFRjdENUY1NTdFQTUzNDFCQ0Y4QjFFNEY3MEM3RDI0OUExREYxMzdBOTgaCXNlY3AyNTZrMQ.",
+        "Cgt3b3Jrc3BhY2UgMBAEGAUq7AMKCmNvX3NpZ25lcjUaAjA1QkBDNzY1MUIwMUM0MEZDRTg5NEY5OTQ0OUJDRkFDMTUxNjI0RjU0NjQ5MUFBQkU0MTExN0U2NTA1NkQ0QTZFMjQ2So8BCkAzQzM2MzVBQjJBMjMyNUY5MjFBRjk3RkM4RTZBMTIzQ0QzNEYwQURDQ0ZBNkMyMjhFQ0ZCRUU1RjQ5MTZEODFFEkAwNTg0MTVGMTQ2MDcyNUFCNkMzMTc5NjZBOUZGMjVDNDRGNjY4OURENTExNTg0QTdBNEJEMEMyNTY2QzJFQjExGglzZWNwMjU2azFSQDU1N0IzMDk3RUFFOTBCMDAzNTczRUMzNjc4NkRFRUVEQkU0Q0MyQzNCMzBEMTlENEI5NzJFQUE5MkFDM0VGMUNSQDQ2OUY1QzFEMUEzRjhGRTk0NEY1RjlFMDU2N0U2OERGRkNEODlBNzNCODhGRkE4MjdDQTNGODhGODI4NERFRTFSQDU1ODlFN0YyQjJCM0MyRTZDRTE5QkJDRTFERkFGQTcxQzY5RTUwRTEzQTVDMDZCQzJEODFFQjg3N0ZGNUEwNzFSQDdDQTlGOEQ4Q0JFQUIzNzEzODYxNjRDOEVBQ0EwMjc5QUEzN0M1MEJEMUI4RUMyRjQ3RkJEMjE2NjczRkVBQ0IyUgoKY29fc2lnbmVyMRoCMDFSQENFNDlGMjZCQkE5RkFDRkM2RDRCNDM2NEVFMzBGNkExNEU0NTExQjUzRTQ2RDIzMjFGQTdFOUZFOUUwQzU2OUMyUgoKY29fc2lnbmVyMhoCMDJSQDU4NDk5QjQ2MkE3RkRFNDU2NUIwOUU4MkUwRUFCMkJGNDUzM0FCODFEQzMyMzc2QUZEQTM2RjE3OEU5QjU2MTAyUgoKY29fc2lnbmVyMxoCMDNSQEI1NUE2RjkyQkYwQ0EwQ0UxNDdDQTA5NDY1NUJEOEM3OUYxMjA4MzczOEQ2NzgwNkI2MjdFRkQ0QUQ2NzFCQUEyUgoKY29fc2lnbmVyNBoCMDRSQDk3NjQyNzJFQkJBQzY5RDFGQkM3NEY4QjU1QTA4ODU5NzhEMUZCQ0FFOThEODBDOTY5ODcxMzQ2RTQ0MDlGNDI6jwEKQDU5MzRCOUNBRDNBQkU3NkM5MDEyMEI4MkM3ODkwNkQ0QjBGODMwOTk1NDM5QjhEMzFCOTFBMzQ2N0RDQjZGQzESQEFDRUIxQ0Q2OUY5QkMxNTY4MzczRUJFRjdENUY1NTdFQTUzNDFCQ0Y4QjFFNEY3MEM3RDI0OUExREYxMzdBOTgaCXNlY3AyNTZrMQ."
+};
+
+struct SignResult {
+    bool ok_;
+    BN r_;
+    BN s_;
+};
+
+// Run N_SIGNATURES signatures on every participant, flushing all the signers once per tick. A new message to sign
+// comes in every tick, and is submitted as soon as the window allows. Returns the number of ticks, 0 on failure.
+int run_pipeline(const vector<std::shared_ptr<const SignKeyHandle>> &handle_arr, const vector<string> &participants,
+                 size_t max_in_flight, bool &rounds_overlapped) {
+    vector<std::unique_ptr<PipelinedSigner>> signer_arr;
+    vector<std::map<uint64_t, SignResult>> result_map_arr(participants.size());
+    for (size_t i = 0; i < participants.size(); ++i) {
+        std::map<uint64_t, SignResult> &result_map = result_map_arr[i];
+        signer_arr.emplace_back(new PipelinedSigner(handle_arr[i], participants, max_in_flight,
+                [&result_map](uint64_t seq, std::unique_ptr<Context> ctx, bool ok) {
+                    result_map[seq] = SignResult{ok, ctx->r_, ctx->s_};
+                }));
+    }
+
+    rounds_overlapped = false;
+    int tick = 0;
+    while (result_map_arr[0].size() < N_SIGNATURES) {
+        if (++tick > 10 * N_SIGNATURES) return 0;
+        for (size_t i = 0; i < participants.size(); ++i) {
+            PipelinedSigner &signer = *signer_arr[i];
+            if (signer.next_seq() < (uint64_t)tick && signer.next_seq() < N_SIGNATURES && signer.in_flight() < max_in_flight) {
+                uint64_t seq = 0;
+                BN m = BN(1000 + signer.next_seq());
+                EXPECT_TRUE(signer.Submit(m, seq));
+            }
+        }
+        // One flush per signer and tick, delivered newest first
+        std::map<string, std::map<string, vector<PipelinedSigner::TaggedMessage>>> batch_map;
+        for (size_t i = 0; i < participants.size(); ++i) {
+            signer_arr[i]->Flush(batch_map[participants[i]]);
+        }
+        for (auto &src : batch_map) {
+            for (auto &des : src.second) {
+                std::set<int> round_set;
+                for (const auto &msg : des.second) round_set.insert(msg.round_);
+                if (round_set.size() > 1) rounds_overlapped = true;
+
+                size_t dst = std::find(participants.begin(), participants.end(), des.first) - participants.begin();
+                if (dst == participants.size()) return 0;
+                for (auto iter = des.second.rbegin(); iter != des.second.rend(); ++iter) {
+                    if (!signer_arr[dst]->Deliver(src.first, std::move(*iter))) return 0;
+                }
+            }
+        }
+    }
+
+    for (size_t i = 0; i < participants.size(); ++i) {
+        if (result_map_arr[i].size() != N_SIGNATURES) return 0;
+        for (const auto &result : result_map_arr[i]) {
+            if (!result.second.ok_) return 0;
+            const SignResult &first = result_map_arr[0][result.first];
+            if (result.second.r_ != first.r_ || result.second.s_ != first.s_) return 0;
+        }
+    }
+    return tick;
+}
+
+bool make_handles(vector<std::shared_ptr<const SignKeyHandle>> &handle_arr, size_t n, PRGType prg_type) {
+    handle_arr.clear();
+    for (size_t i = 0; i < n; ++i) {
+        SignKey sign_key;
+        if (!sign_key.FromBase64(sign_key_base64_arr[i])) return false;
+        sign_key.prg_type_ = prg_type;
+        for (auto &remote_party : sign_key.remote_parties_) {
+            remote_party.prg.set_type(prg_type);
+            remote_party.prg.reset();
+            remote_party.prg.init(remote_party.seed_);
+        }
+        handle_arr.push_back(SignKeyHandle::FromSignKey(sign_key));
+        if (!handle_arr.back()) return false;
+    }
+    return true;
+}
+
+TEST(Li24, pipelined_sign) {
+    vector<string> participants = {"co_signer1", "co_signer2", "co_signer3", "co_signer4"};
+    PRGType types[2] = {PRGType::HashChain, PRGType::Counter};
+    for (PRGType type : types) {
+        vector<std::shared_ptr<const SignKeyHandle>> handle_arr;
+        ASSERT_TRUE(make_handles(handle_arr, participants.size(), type));
+
+        // One signature at a time takes a tick per round trip
+        bool rounds_overlapped = false;
+        int sequential_ticks = run_pipeline(handle_arr, participants, 1, rounds_overlapped);
+        EXPECT_GT(sequential_ticks, 0);
+        EXPECT_FALSE(rounds_overlapped);
+
+        int pipelined_ticks = run_pipeline(handle_arr, participants, MAX_IN_FLIGHT, rounds_overlapped);
+        EXPECT_GT(pipelined_ticks, 0);
+        EXPECT_TRUE(rounds_overlapped);
+        EXPECT_LT(pipelined_ticks, sequential_ticks);
+        printf("%d signatures: %d ticks one at a time, %d ticks with %d in flight\n",
+               N_SIGNATURES, sequential_ticks, pipelined_ticks, MAX_IN_FLIGHT);
+
+        // Every signature of both runs took its own PRG outputs from the handles, the non-signer's pairs kept theirs
+        for (size_t i = 0; i < participants.size(); ++i) {
+            SignKey sign_key;
+            handle_arr[i]->CurrentSignKey(sign_key);
+            for (const auto &remote_party : sign_key.remote_parties_) {
+                bool signer = std::find(participants.begin(), participants.end(), remote_party.party_id_) != participants.end();
+                EXPECT_EQ(remote_party.prg.position(), signer ? 2 * N_SIGNATURES * PRG_OUTPUTS_PER_SIGN : 0);
+            }
+        }
+    }
+}
+
+TEST(Li24, pipelined_sign_window) {
+    vector<string> participants = {"co_signer1", "co_signer2", "co_signer3", "co_signer4"};
+    vector<std::shared_ptr<const SignKeyHandle>> handle_arr;
+    ASSERT_TRUE(make_handles(handle_arr, participants.size(), PRGType::Counter));
+    PipelinedSigner signer(handle_arr[0], participants, 2, nullptr);
+    uint64_t seq = 0;
+    EXPECT_TRUE(signer.Submit(BN(1), seq));
+    EXPECT_EQ(seq, 0u);
+    EXPECT_TRUE(signer.Submit(BN(2), seq));
+    EXPECT_EQ(seq, 1u);
+    EXPECT_FALSE(signer.Submit(BN(3), seq));
+    EXPECT_EQ(signer.in_flight(), 2u);
+
+    // Messages of a signature not submitted yet are kept, within the window only
+    EXPECT_TRUE(signer.Deliver("co_signer2", PipelinedSigner::TaggedMessage{3, 0, "", ""}));
+    EXPECT_FALSE(signer.Deliver("co_signer2", PipelinedSigner::TaggedMessage{4, 0, "", ""}));
+
+    std::map<string, vector<PipelinedSigner::TaggedMessage>> msg_map;
+    signer.Flush(msg_map);
+    EXPECT_EQ(msg_map.size(), participants.size() - 1);
+    for (const auto &des : msg_map) {
+        ASSERT_EQ(des.second.size(), 2u);
+        EXPECT_EQ(des.second[0].seq_, 0u);
+        EXPECT_EQ(des.second[1].seq_, 1u);
+    }
+    signer.Flush(msg_map);
+    EXPECT_TRUE(msg_map.empty());
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    int ret = RUN_ALL_TESTS();
+    google::protobuf::ShutdownProtobufLibrary();
+    return ret;
+}
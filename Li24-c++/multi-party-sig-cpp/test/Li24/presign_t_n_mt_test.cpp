@@ -0,0 +1,294 @@
+#include <thread>
+#include <future>
+#include <vector>
+#include <google/protobuf/stubs/common.h>
+#include "crypto-suites/exception/located_exception.h"
+#include "gtest/gtest.h"
+#include "crypto-suites/crypto-curve/curve.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/Li24.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/util.h"
+#include "../thread_safe_queue.h"
+#include "../message.h"
+#include "../party_message_queue.h"
+
+
+using std::string;
+using std::vector;
+using safeheron::bignum::BN;
+using safeheron::curve::Curve;
+using safeheron::curve::CurvePoint;
+using safeheron::curve::CurveType;
+using safeheron::multi_party_ecdsa::Li24::presign::Presignature;
+using safeheron::multi_party_ecdsa::Li24::presign::PresignaturePool;
+using safeheron::mpc_flow::mpc_parallel_v2::MPCContext;
+using safeheron::mpc_flow::mpc_parallel_v2::ErrorInfo;
+namespace presign = safeheron::multi_party_ecdsa::Li24::presign;
+namespace online_sign = safeheron::multi_party_ecdsa::Li24::online_sign;
+
+void print_context_stack_if_failed(MPCContext *ctx) {
+    std::string err_info;
+    vector<ErrorInfo> error_stack;
+    ctx->get_error_stack(error_stack);
+    for(const auto &err: error_stack){
+        err_info += "error code ( " + std::to_string(err.code_) + " ) : " + err.info_ + "\n";
+    }
+    printf("%s", err_info.c_str());
+}
+void print_signature(online_sign::Context *ctx) {
+    std::string sign_info;
+    sign_info += ctx->sign_key_.local_party_.party_id_ + ": \n";
+    std::string str;
+    ctx->m_.ToHexStr(str);
+    sign_info += "    - digest: " + str + "\n";
+    ctx->r_.ToHexStr(str);
+    sign_info += "    - r: " + str + "\n";
+    ctx->s_.ToHexStr(str);
+    sign_info += "    - s: " + str + "\n";
+    sign_info += "    - v: " + std::to_string(ctx->v_) + "\n";
+    printf("%s", sign_info.c_str());
+}
+
+std::map<std::string, PartyMessageQue<Msg>> map_id_message_queue;
+std::map<std::string, PresignaturePool> map_id_presig_pool;
+
+#define PRESIGN_ROUNDS 3
+#define ONLINE_SIGN_ROUNDS 2
+#define N_PARTIES 5
+#define THRESHOLD 4
+#define POOL_CAPACITY 2
+
+template <typename Context>
+bool run_rounds(Context &ctx, const std::vector<std::string> &participants, int rounds) {
+    bool ok = true;
+    const std::string &party_id = ctx.sign_key_.local_party_.party_id_;
+    for (int round = 0; round < rounds; ++round) {
+        if (round == 0) {
+            ok = ctx.PushMessage();
+            if (!ok) {
+                print_context_stack_if_failed(&ctx);
+                return false;
+            }
+        } else {
+            for(size_t k = 0; k < participants.size() - 1; k++) {
+                Msg m;
+                ThreadSafeQueue<Msg> &in_queue = map_id_message_queue.at(party_id).get(round - 1);
+                in_queue.Pop(m);
+                ok = ctx.PushMessage(m.p2p_msg_, m.bc_msg_, m.src_, round - 1);
+                if (!ok) {
+                    print_context_stack_if_failed(&ctx);
+                    return false;
+                }
+            }
+        }
+
+        ok = ctx.IsCurRoundFinished();
+        if (!ok) {
+            print_context_stack_if_failed(&ctx);
+            return false;
+        }
+        std::string status = "<== Round " + std::to_string(round) + ", " + party_id + "\n";
+        printf("%s", status.c_str());
+
+        std::string out_bc_message;
+        vector<string> out_p2p_message_arr;
+        vector<string> out_des_arr;
+        ok = ctx.PopMessages(out_p2p_message_arr, out_bc_message, out_des_arr);
+        if (!ok) {
+            print_context_stack_if_failed(&ctx);
+            return false;
+        }
+
+        for (size_t j = 0; j < out_des_arr.size(); ++j) {
+            Msg m = {party_id, out_bc_message, out_p2p_message_arr.empty() ? "": out_p2p_message_arr[j]};
+            ThreadSafeQueue<Msg> &out_queue = map_id_message_queue.at(out_des_arr[j]).get(round);
+            out_queue.Push(m);
+        }
+    }
+
+    ok = ctx.IsFinished();
+    if (!ok) {
+        print_context_stack_if_failed(&ctx);
+        return false;
+    }
+    return true;
+}
+
+bool presign_to_pool(std::string sign_key_base64, std::vector<std::string> participants, size_t presig_count) {
+    //preprocess sign key to fit t-n threshold
+    std::string t_sign_key_base64;
+    bool ok = safeheron::multi_party_ecdsa::Li24::trim_sign_key(t_sign_key_base64, sign_key_base64, participants);
+    if (!ok) return false;
+
+    //create context (define in Li24/presign/context.h)
+    presign::Context ctx(participants.size());
+    ok = presign::Context::CreateContext(ctx, t_sign_key_base64, presig_count);
+    if (!ok) return false;
+
+    for (size_t i = 0; i < ctx.sign_key_.remote_parties_.size(); ++i) {
+        ctx.sign_key_.remote_parties_[i].prg.reset();
+        ctx.sign_key_.remote_parties_[i].prg.init(ctx.sign_key_.remote_parties_[i].seed_);
+    }
+
+    ok = run_rounds(ctx, participants, PRESIGN_ROUNDS);
+    if (!ok) return false;
+
+    PresignaturePool &pool = map_id_presig_pool.at(ctx.sign_key_.local_party_.party_id_);
+    for (const auto &presig : ctx.presig_arr_) {
+        ok = pool.Add(presig);
+        if (!ok) return false;
+    }
+    return ctx.presig_arr_.size() == presig_count;
+}
+
+bool sign_with_presig(std::string sign_key_base64, std::vector<std::string> participants, BN m) {
+    //preprocess sign key to fit t-n threshold
+    std::string t_sign_key_base64;
+    bool ok = safeheron::multi_party_ecdsa::Li24::trim_sign_key(t_sign_key_base64, sign_key_base64, participants);
+    if (!ok) return false;
+
+    std::string party_id;
+    {
+        safeheron::multi_party_ecdsa::Li24::SignKey sign_key;
+        ok = sign_key.FromBase64(t_sign_key_base64);
+        if (!ok) return false;
+        party_id = sign_key.local_party_.party_id_;
+    }
+
+    //create context (define in Li24/online_sign/context.h), the presignature is taken out of the pool
+    PresignaturePool &pool = map_id_presig_pool.at(party_id);
+    size_t pool_size = pool.size();
+    online_sign::Context ctx(participants.size());
+    ok = online_sign::Context::CreateContext(ctx, t_sign_key_base64, pool, m);
+    if (!ok) return false;
+    ok = (pool.size() == pool_size - 1);
+    if (!ok) return false;
+
+    ok = run_rounds(ctx, participants, ONLINE_SIGN_ROUNDS);
+    if (!ok) return false;
+
+    print_signature(&ctx);
+    return true;
+}
+
+void presign_and_sign(const std::string sign_key_base64_arr[N_PARTIES], const std::string party_ids[N_PARTIES],
+                      const std::vector<std::string> &participants, const std::vector<BN> &m_arr) {
+    std::vector<std::future<bool> >res;
+    res.resize(participants.size());
+
+    //Offline: fill the pools
+    for (int i = 0; i < N_PARTIES; ++i) {
+        map_id_message_queue[party_ids[i]] = PartyMessageQue<Msg>(PRESIGN_ROUNDS);
+        map_id_presig_pool.erase(party_ids[i]);
+        map_id_presig_pool.emplace(std::piecewise_construct, std::forward_as_tuple(party_ids[i]), std::forward_as_tuple(POOL_CAPACITY));
+    }
+    for (size_t i = 0; i < participants.size(); ++i) {
+        res[i] = std::async(std::launch::async, presign_to_pool, sign_key_base64_arr[i], participants, m_arr.size());
+    }
+    for (size_t i = 0; i < participants.size(); ++i) {
+        EXPECT_TRUE(res[i].get());
+    }
+
+    //Online: one broadcast per signature
+    for (const auto &m : m_arr) {
+        for (int i = 0; i < N_PARTIES; ++i) {
+            map_id_message_queue[party_ids[i]] = PartyMessageQue<Msg>(ONLINE_SIGN_ROUNDS);
+        }
+        for (size_t i = 0; i < participants.size(); ++i) {
+            res[i] = std::async(std::launch::async, sign_with_presig, sign_key_base64_arr[i], participants, m);
+        }
+        for (size_t i = 0; i < participants.size(); ++i) {
+            EXPECT_TRUE(res[i].get());
+        }
+    }
+
+    //Every presignature was used once, signing again finds none
+    for (size_t i = 0; i < participants.size(); ++i) {
+        EXPECT_EQ(map_id_presig_pool.at(participants[i]).size(), 0u);
+        EXPECT_FALSE(sign_with_presig(sign_key_base64_arr[i], participants, m_arr[0]));
+    }
+}
+
+TEST(Li24, presignature_pool) {
+    PresignaturePool pool(2);
+    Presignature presig;
+    presig.r_ = BN(1);
+    EXPECT_TRUE(pool.Add(presig));
+    // The same presignature can not be pooled twice
+    EXPECT_FALSE(pool.Add(presig));
+    presig.r_ = BN(2);
+    EXPECT_TRUE(pool.Add(presig));
+    // Bounded
+    presig.r_ = BN(3);
+    EXPECT_FALSE(pool.Add(presig));
+
+    Presignature out;
+    EXPECT_TRUE(pool.Take(BN(2), out));
+    EXPECT_TRUE(out.r_ == BN(2));
+    // Single use
+    EXPECT_FALSE(pool.Take(BN(2), out));
+    EXPECT_TRUE(pool.TakeFront(out));
+    EXPECT_TRUE(out.r_ == BN(1));
+    EXPECT_FALSE(pool.TakeFront(out));
+    EXPECT_EQ(pool.size(), 0u);
+    // A presignature which was taken can not come back
+    EXPECT_FALSE(pool.Add(out));
+    presig.r_ = BN(2);
+    EXPECT_FALSE(pool.Add(presig));
+    EXPECT_EQ(pool.size(), 0u);
+}
+
+TEST(Li24, presign_t_n_mt) {
+
+    //The common parameters for different curves.
+    std::string party_ids[N_PARTIES] = {
+            "co_signer1",
+            "co_signer2",
+            "co_signer3",
+            "co_signer4",
+            "co_signer5"
+    };
+    std::vector<BN> m_arr = {
+            BN("1234567812345678123456781234567812345678123456781234567812345678", 16),
+            BN("8765432187654321876543218765432187654321876543218765432187654321", 16)
+    };
+    std::vector<std::string> participants = {"co_signer1", "co_signer2","co_signer3","co_signer4"};
+
+
+    //SECP256K1 sample
+    printf("Test Li24 presign with secp256k1 curve\n");
+    //SECP256K1 sign key
+    std::string sign_key_base64_arr[N_PARTIES]={
+        "Cgt3b3Jrc3BhY2UgMBAEGAUq7AMKCmNvX3NpZ25lcjEaAjAxQkA2MjdBNkUxNUE2Qzk2RDZFM0FENzg5NDREMUFFRDY1N0ZBQUM4RTkzNDBFMUFFRTcyRjg4MTAyRDE1Nzk1RTYySo8BCkA2MjM5MTdFNjhGOTMwNDI3RDI5Q0E4MTJCNzEyQjM2QTE2QzgzOTUyRjJFRkJGM0NFNjZDQzg2MjEzMjI4RkFDEkBCNzZBOTM3RDJERTdCMzMzQzgzMTYwRTIzRUE1MTc1ODJBQjJFRDU4NkJCQjYxNDFBMDVENzZFRUJBRkYzNzBFGglzZWNwMjU2azFSQDIwNzhBQzUzMDZFNkNFQTc0RTg2Q0NCNTE1NjFEMjlCRTJFRkI0OUU0QzJDRDg5MTdGMzREODA2MUI5RTlEQThSQDZGMTU3MEYxRUZEMjZBMTlERDgyNzREMkU0MkM4Rjc0NUUzQ0MzMENBODQyNjUxQTBFRDJDMDE4MzVDNEFCOTFSQDM5Q0U0OEI4QjY2RDIyRjZCMTY5M0I5QTY1MTg4RkIzRDk4REUxODJENEZFMjhDNzFGRTE1MjgwNTMxOTcyM0NSQDc4Q0VDMUQzQ0ZCNkExRkMzN0Q3NTcyRTc1QzMwN0IzOEZGODRFRjE4QjM5Qjg1RDY2MzRGRjU1NzM0ODY3ODAyUgoKY29fc2lnbmVyMhoCMDJSQDczOTYyNUQ4Njc3QTc2MTA5N0NEMkY3RTNEODY4M0NBQTVBNkNDNkUxRTRCQjU1RUNCMTUyNDA4QjRDN0IxNjcyUgoKY29fc2lnbmVyMxoCMDNSQEJFQUEwMEY3N0FFMkJGMUIzRjE3RjgxMzE0N0MwNThCRjYyRjg0QzdDMDg5OTVEMDA3RUUyNzc0OTYxNTY0MjkyUgoKY29fc2lnbmVyNBoCMDRSQDNCNEQwN0VEOTEwNTRDMTJCODQyMTA3NkE1NUY1NDZGRDc1QkNDNzgwMzZBRjk5RjUyMjk4NUYwQzQyQjM3NjQyUgoKY29fc2lnbmVyNRoCMDVSQENFNDlGMjZCQkE5RkFDRkM2RDRCNDM2NEVFMzBGNkExNEU0NTExQjUzRTQ2RDIzMjFGQTdFOUZFOUUwQzU2OUM6jwEKQDU5MzRCOUNBRDNBQkU3NkM5MDEyMEI4MkM3ODkwNkQ0QjBGODMwOTk1NDM5QjhEMzFCOTFBMzQ2N0RDQjZGQzESQEFDRUIxQ0Q2OUY5QkMxNTY4MzczRUJFRjdENUY1NTdFQTUzNDFCQ0Y4QjFFNEY3MEM3RDI0OUExREYxMzdBOTgaCXNlY3AyNTZrMQ.",
+        "Cgt3b3Jrc3BhY2UgMBAEGAUq7AMKCmNvX3NpZ25lcjIaAjAyQkBDRTcyQ0VBQjY3NTYwQzM0QzkzNzFEMjBCQjMwRjUyMDZGMkM2OTBCMjA0MjA1MEE0NjVBMTk1REE1OERGMkNDSo8BCkBEREIzQkRCNEYwMTA2Rjk4NjNGQjc0OTk0NEQ1MDg5ODEyQjU2RjI5MjlBN0E4NDQxNEE0M0Q1RkQ1OEUwNzE3EkAyRUZDMzVGOUE2MUUxRTRCNkRFQkNEMzQ0NDVFQjQzMTMzNTBDMDBGOEYyMEY4ODEzNkRGRUQ2QzE2MEFEOUI4GglzZWNwMjU2azFSQDUzMUQ3OTg1NjA5M0E3Njk0OTQ2NjJDOTI4MjRCMTJFQzJCNzE3Q0ZEMjFFRENDRDRCRTA0QzAyOTkyOTEzQkZSQDFENUQ2OTk2OUYxQUJDMkFEQ0U4NUFBQkUyOTkxNEU4Mzk0OTY2MUYzRDhGNzQ4QzdDRTg1MUM2QTI5N0I1REVSQDBFQkQ2MzFGNzBDMTcxMzgwMzVGNTU3OTdCNTFFRTNDQ0JFMTExNkNEQTI5MDc0MjBENDVGMkM4N0I4M0M0NTVSQDExQUEzRjI5MTA0MDRFNUMyMEJBQTRBMjhBNkM0OURGNDg1QjExMEUyM0EyM0NFODgwRkY3Njg4MEMxNjc3MkYyUgoKY29fc2lnbmVyMRoCMDFSQDczOTYyNUQ4Njc3QTc2MTA5N0NEMkY3RTNEODY4M0NBQTVBNkNDNkUxRTRCQjU1RUNCMTUyNDA4QjRDN0IxNjcyUgoKY29fc2lnbmVyMxoCMDNSQDI4RDBBODY3QjYzNDQ4Q0E1QjUyRUFCOTVFRUYzRjM0MEE3ODY5MjZBQ0RDQjhDREZFOEJGMkZBQjg3ODAwNzQyUgoKY29fc2lnbmVyNBoCMDRSQDMwODIwMjYxNEIzNEI1RjRGNjE5NTI2OTNDNDk2QTdGOEQ3MUIxMUZCMERFMjdFQUNCNThCMThFNjdCMkM2OTIyUgoKY29fc2lnbmVyNRoCMDVSQDU4NDk5QjQ2MkE3RkRFNDU2NUIwOUU4MkUwRUFCMkJGNDUzM0FCODFEQzMyMzc2QUZEQTM2RjE3OEU5QjU2MTA6jwEKQDU5MzRCOUNBRDNBQkU3NkM5MDEyMEI4MkM3ODkwNkQ0QjBGODMwOTk1NDM5QjhEMzFCOTFBMzQ2N0RDQjZGQzESQEFDRUIxQ0Q2OUY5QkMxNTY4MzczRUJFRjdENUY1NTdFQTUzNDFCQ0Y4QjFFNEY3MEM3RDI0OUExREYxMzdBOTgaCXNlY3AyNTZrMQ.",
+        "Cgt3b3Jrc3BhY2UgMBAEGAUq7AMKCmNvX3NpZ25lcjMaAjAzQkAxQkEyQjg4MzBGODEzRDQwQjhDNEQ0REYzMDg3MkI2OUZBMzdFMDg5REM2OTA1REQxOTIzRDM5QUVFRTU2NDlESo8BCkAwQzA0NTlBNTE5RUMzODIxN0I3N0NGRTg0NEY5MzMzNzlFRTcxQ0RDRTcyNUEwQjk0MDM2Nzg5OUExM0QwNUVDEkBFREQwRkI0Mjc0NzM0ODhGQkRERTVENkFCOEQ2QzUyQUQ3ODhGQzJBMEIyNUNDNUU2MTA4ODIyRjBFNDM0QTg2GglzZWNwMjU2azFSQDRGOTQ5MDA1OEIxMDU1MDE2MTk1ODM0MDMwNEY3NjE3OTdGMkMxQkIxODQ3MzBCNUY5MUI2NzVDNjA1MEI4OThSQDBCNzMzRUQxMTcxOThDOUY3RTZBOTAwRDdDNTYyQTRCRDEyRjAzMDc2RjRENDQ0MTgxQTNBMTM0MTVFMDRBOTZSQDU4QjEwODhEREYwMTBEODFEMTlBRjQyNDhBMUQyMzVENDU2MDQ1MjNDODU5MkI0RDVCNUZBMkVBMUI0MjJBRTFSQDVGRDA4N0EwMEM1OERERTc0NjYyRTRDNjQ3NjBERTU1RDg3M0I3NTVGRTdBNzE0QTg4QTYwNDREMkQ3MTdCMzkyUgoKY29fc2lnbmVyMRoCMDFSQEJFQUEwMEY3N0FFMkJGMUIzRjE3RjgxMzE0N0MwNThCRjYyRjg0QzdDMDg5OTVEMDA3RUUyNzc0OTYxNTY0MjkyUgoKY29fc2lnbmVyMhoCMDJSQDI4RDBBODY3QjYzNDQ4Q0E1QjUyRUFCOTVFRUYzRjM0MEE3ODY5MjZBQ0RDQjhDREZFOEJGMkZBQjg3ODAwNzQyUgoKY29fc2lnbmVyNBoCMDRSQEE4MEQ2NDI5QzQ3M0Q5MDY2N0FCQzQ4REI2REE0NEI0RkJENEM1OUQ1MkZFNEQzNDg5RkJFOTYxMzQwQjMzNUQyUgoKY29fc2lnbmVyNRoCMDVSQEI1NUE2RjkyQkYwQ0EwQ0UxNDdDQTA5NDY1NUJEOEM3OUYxMjA4MzczOEQ2NzgwNkI2MjdFRkQ0QUQ2NzFCQUE6jwEKQDU5MzRCOUNBRDNBQkU3NkM5MDEyMEI4MkM3ODkwNkQ0QjBGODMwOTk1NDM5QjhEMzFCOTFBMzQ2N0RDQjZGQzESQEFDRUIxQ0Q2OUY5QkMxNTY4MzczRUJFRjdENUY1NTdFQTUzNDFCQ0Y4QjFFNEY3MEM3RDI0OUExREYxMzdBOTgaCXNlY3AyNTZrMQ.",
+        "Cgt3b3Jrc3BhY2UgMBAEGAUq7AMKCmNvX3NpZ25lcjQaAjA0QkAyNTc5Mjg1RjBBQTIxRUFBMkU4QzU1QTYzNUYwODZEOTZENjc0QjZFMThFMzM4OUQ1MTIwNkI3MjIzNkQ1NEVBSo8BCkBERjc0RjMzNUVGQkVDMkZCQ0E3RDBFMkVEMDYyMzQ5OEQ0MzBCMzgyRTAyQkI5REM0MDI1QUEzQ0Q2REExNkIyEkA1OUU2ODcyOTczNjhGMjZERjVCOEREMTY2RDkxQkY1NjFBNDM2NkU0RDI1MzE5OUNFNTNEQTdDMDMwQ0M4NThCGglzZWNwMjU2azFSQDAxN0VCRjM0REE5ODI5MUMwNkQ4RDREQzQwNDZDNEJCRkRDREVBRjUyRTZDRDBEODMyNDgzMzcwNzExMUM1MjhSQDIxQzQ5RjQxREE3MzQ0QkNGMkI5RkNFRkMwRjc3QzQyQzE5MDlGQjJENkI1MjBBOEJFMTJCRUM1RUMyRjAyM0RSQDRGNUM1QjlCRTU3MkNCODQ5NjEwRDA2OTJDQkQyMTU3QjY3NDgwNzk4QUE1MjFFNzJFOUM0Njc3MThDOTA4N0NSQDFBQkEyRTU1RUZDMUI2NjBDMzY1RUFDMjZBRDY4NURGQ0U5QTM2QkYxN0Q0OTQ5QTIxOEI0MTMwN0QwMEI0NzcyUgoKY29fc2lnbmVyMRoCMDFSQDNCNEQwN0VEOTEwNTRDMTJCODQyMTA3NkE1NUY1NDZGRDc1QkNDNzgwMzZBRjk5RjUyMjk4NUYwQzQyQjM3NjQyUgoKY29fc2lnbmVyMhoCMDJSQDMwODIwMjYxNEIzNEI1RjRGNjE5NTI2OTNDNDk2QTdGOEQ3MUIxMUZCMERFMjdFQUNCNThCMThFNjdCMkM2OTIyUgoKY29fc2lnbmVyMxoCMDNSQEE4MEQ2NDI5QzQ3M0Q5MDY2N0FCQzQ4REI2REE0NEI0RkJENEM1OUQ1MkZFNEQzNDg5RkJFOTYxMzQwQjMzNUQyUgoKY29fc2lnbmVyNRoCMDVSQDk3NjQyNzJFQkJBQzY5RDFGQkM3NEY4QjU1QTA4ODU5NzhEMUZCQ0FFOThEODBDOTY5ODcxMzQ2RTQ0MDlGNDI6jwEKQDU5MzRCOUNBRDNBQkU3NkM5MDEyMEI4MkM3ODkwNkQ0QjBGODMwOTk1NDM5QjhEMzFCOTFBMzQ2N0RDQjZGQzESQEFDRUIxQ0Q2OUY5QkMxNTY4MzczRUJFRjdENUY1NTdFQTUzNDFCQ0Y4QjFFNEY3MEM3RDI0OUExREYxMzdBOTgaCXNlY3AyNTZrMQ.",
+        "Cgt3b3Jrc3BhY2UgMBAEGAUq7AMKCmNvX3NpZ25lcjUaAjA1QkBDNzY1MUIwMUM0MEZDRTg5NEY5OTQ0OUJDRkFDMTUxNjI0RjU0NjQ5MUFBQkU0MTExN0U2NTA1NkQ0QTZFMjQ2So8BCkAzQzM2MzVBQjJBMjMyNUY5MjFBRjk3RkM4RTZBMTIzQ0QzNEYwQURDQ0ZBNkMyMjhFQ0ZCRUU1RjQ5MTZEODFFEkAwNTg0MTVGMTQ2MDcyNUFCNkMzMTc5NjZBOUZGMjVDNDRGNjY4OURENTExNTg0QTdBNEJEMEMyNTY2QzJFQjExGglzZWNwMjU2azFSQDU1N0IzMDk3RUFFOTBCMDAzNTczRUMzNjc4NkRFRUVEQkU0Q0MyQzNCMzBEMTlENEI5NzJFQUE5MkFDM0VGMUNSQDQ2OUY1QzFEMUEzRjhGRTk0NEY1RjlFMDU2N0U2OERGRkNEODlBNzNCODhGRkE4MjdDQTNGODhGODI4NERFRTFSQDU1ODlFN0YyQjJCM0MyRTZDRTE5QkJDRTFERkFGQTcxQzY5RTUwRTEzQTVDMDZCQzJEODFFQjg3N0ZGNUEwNzFSQDdDQTlGOEQ4Q0JFQUIzNzEzODYxNjRDOEVBQ0EwMjc5QUEzN0M1MEJEMUI4RUMyRjQ3RkJEMjE2NjczRkVBQ0IyUgoKY29fc2lnbmVyMRoCMDFSQENFNDlGMjZCQkE5RkFDRkM2RDRCNDM2NEVFMzBGNkExNEU0NTExQjUzRTQ2RDIzMjFGQTdFOUZFOUUwQzU2OUMyUgoKY29fc2lnbmVyMhoCMDJSQDU4NDk5QjQ2MkE3RkRFNDU2NUIwOUU4MkUwRUFCMkJGNDUzM0FCODFEQzMyMzc2QUZEQTM2RjE3OEU5QjU2MTAyUgoKY29fc2lnbmVyMxoCMDNSQEI1NUE2RjkyQkYwQ0EwQ0UxNDdDQTA5NDY1NUJEOEM3OUYxMjA4MzczOEQ2NzgwNkI2MjdFRkQ0QUQ2NzFCQUEyUgoKY29fc2lnbmVyNBoCMDRSQDk3NjQyNzJFQkJBQzY5RDFGQkM3NEY4QjU1QTA4ODU5NzhEMUZCQ0FFOThEODBDOTY5ODcxMzQ2RTQ0MDlGNDI6jwEKQDU5MzRCOUNBRDNBQkU3NkM5MDEyMEI4MkM3ODkwNkQ0QjBGODMwOTk1NDM5QjhEMzFCOTFBMzQ2N0RDQjZGQzESQEFDRUIxQ0Q2OUY5QkMxNTY4MzczRUJFRjdENUY1NTdFQTUzNDFCQ0Y4QjFFNEY3MEM3RDI0OUExREYxMzdBOTgaCXNlY3AyNTZrMQ."
+    };
+    presign_and_sign(sign_key_base64_arr, party_ids, participants, m_arr);
+
+
+    //P256 sample
+    printf("Test Li24 presign with p256 curve\n");
+    //P256 sign key
+    sign_key_base64_arr[0]="Cgt3b3Jrc3BhY2UgMBAEGAUq5wMKCmNvX3NpZ25lcjEaAjAxQkBGOTVFNUUwOUE1MDdFQ0VCRUU4MTlCNUI5MTk5QzNDOEE4MEUyQzNCRTRBNkNCMzlENkI5RkExNThGQzRBQjBDSooBCkA5QjFFNTdGRDk0NERCQzZFOUY0OUE0NTk3OERCMzA4QTM5NkUxODI1MkYwQTY1RUFBRERFMDE0OEUyOTI5Q0JBEkA2MDJFNTkyN0MwNkE2MzM1QjE5MENDQzZGOTc5N0VERjM5QzZDNEFBQTc5NDk0MDZDM0JEQzY4OUY3MjU2QTA4GgRwMjU2UkA1MzBDRjM1RjUxRjQ3RTRCNUQwN0FFMkVEMzI4MzczNjhGOENFREJFRDk3QTNCOTIzNkYzMkUyOTFEOTY0NDc5UkA2QUZCNjJEQUJFQjlGMTIzM0NFNUFEQUE4OTlCMThENzVBQkVBMTEwQzJEQUU2RDhGNEU2NDk3NDYwOUU1OUJBUkA0MjAxNzREM0VBNUQ5RTQxNTIxQTlGQ0YyNDVFMjBBMzRGQzVCRjE2RTkwQTM2OUExRDNEREVEMDhFRDgzNEQzUkA1NzNBM0IzM0ZBMjg2ODZCNUY1QjkyQjhBMzJBMTFFNzhGMDQ1MUJDRENFNTc3QjJFNzM2OTFBNkY4RDQ2NjM3MlIKCmNvX3NpZ25lcjIaAjAyUkBDQzc5NjBEMDkwRDk2OTQ1RUYxRTU4NjU2N0VEQkFEQzkyODRCRjc5RTM5MjY5QjU3RDExMUYyMDcyNTI0NDgwMlIKCmNvX3NpZ25lcjMaAjAzUkBEMTc4Qzg2NTJBRUI0MUNGQjQzOUYyOTQzMDM1QUZDOTE4QzkzMDFEQ0E3RDkzRDY4MkM0NzJCM0VEM0RBNUY5MlIKCmNvX3NpZ25lcjQaAjA0UkA5OTdBNEFDOUQ2Q0QxMTk5QTk3QkVBMEI3QTJBM0JCNzcxNTM3RERFQTM3QTRENUZFMTlGMUI0QzJFNDlEMEVDMlIKCmNvX3NpZ25lcjUaAjA1UkA5NTAwMjU1QjQ2NkE2NjFFREExN0JDNTYzM0Q1MjRFQzA3QzczNEVDQjkzNDk4MjkzRjk3NjFBMTI5MTVGRjg1OooBCkBDMTQ1RDFDQzYxQzJFMjkyREZERERDNUFGRUUxM0E4QjZCRjQ4NzI4QUVCNzI4MzA1QjgxMDNDNDAwM0FDMTJBEkAxNTFGQUUwM0E3MjkwMkIzMTcyOURBQURDODc0NEY3NzM4REE2NjY1RUZFMjAzRkQ0RDJDQ0VBRjYxNTM4RTlEGgRwMjU2";
+    sign_key_base64_arr[1]="Cgt3b3Jrc3BhY2UgMBAEGAUq5wMKCmNvX3NpZ25lcjIaAjAyQkA5MEMyMDUwNDFBRDkzOTU1NkY1NDk3Njc4MTdERjk3ODA1NjU1MjU2QzREMEZCNENCMjdDMEFBMUZBQ0FDQjY1SooBCkBGQTUzRDgyQzVCM0VBNzUzQUI2MDI2MUFBRjkzRkU4OThEMEMyNTBCOEZEN0I3MjU5QjQwOUMzQjlEMEQ5MDFCEkA3RDU0MEMxRDVCNzRBOEFCRjVBQjVBMERERkU0MkVBRDRBNzU0QTQzMzJENUNFOTZGODE4OURGMjI5REZBNzZEGgRwMjU2UkA3OTZDNkQ3MTNFRTRFQUZBOTIxNkFBMzY5NEM1ODNBNjAyRjdEMUJCMEExODJFMjM0NjFERjBGNzU0QkMwMDA3UkAxODRBRDgxN0FFN0E0RUY1MEI1MkMyNzlGMjU4QUU5QTUyQTA2Q0FBRDlDQTkyQThBOTgwQTlEQjM2RDA3Q0ZEUkA2QTgwRkI4Q0E1REJBNTI2NzJGNkQzMUVEM0IwM0NDNjQxRDdGMkYzQTJGQTUyNDBFNjZGQjkyMjQzODVBQzc5UkA2QTMzQzUzQTk5NTlENDBFNTY5MEIzNzE5NDE1ODAzOTFEMDg1NjExNkZCNjc2RDEwOTdGODM3QzBERkQ1QjBCMlIKCmNvX3NpZ25lcjEaAjAxUkBDQzc5NjBEMDkwRDk2OTQ1RUYxRTU4NjU2N0VEQkFEQzkyODRCRjc5RTM5MjY5QjU3RDExMUYyMDcyNTI0NDgwMlIKCmNvX3NpZ25lcjMaAjAzUkAzNzlBMzA5NTQ2RUQ4OTlEOEJGMTc5NjUwNzRFMzQ3REI3ODQ0Q0I1M0E3MzAyMzgxQzZGMEM2ODhDQUZDRTFDMlIKCmNvX3NpZ25lcjQaAjA0UkA3MzQ1OUMxMEJERDQyQTZENUI3NEM2M0ZFRDAyOEY0OEI4Q0RCQkU5MEQzNTQyMDcxMDJENjEzNjdGRkIyODUwMlIKCmNvX3NpZ25lcjUaAjA1UkBDQTc4MTBEOTdDMUQyRkZEREI5QjBGN0FFOTI2MDU0MTM3MjdENDkzMUM1QUJCNUU4QTYxMTE0MDBBMThCN0NCOooBCkBDMTQ1RDFDQzYxQzJFMjkyREZERERDNUFGRUUxM0E4QjZCRjQ4NzI4QUVCNzI4MzA1QjgxMDNDNDAwM0FDMTJBEkAxNTFGQUUwM0E3MjkwMkIzMTcyOURBQURDODc0NEY3NzM4REE2NjY1RUZFMjAzRkQ0RDJDQ0VBRjYxNTM4RTlEGgRwMjU2";
+    sign_key_base64_arr[2]="Cgt3b3Jrc3BhY2UgMBAEGAUq5wMKCmNvX3NpZ25lcjMaAjAzQkAzMjlFRDJBMUE0QkJBMDc2QURCODcyMDlFOEI1ODQ5MzUzMzg3RkVDM0YwMjM1QzkyRjM5QjEzNjQzMjdBNkY3SooBCkA2ODI5MjM4RUQwQ0I1MzFCOEJBQUJDMEZGQzczNEM5RkU4QTAxRjQ3MTQ0NzNGMDM3RUVBOUIwMUE1OTVGQzgwEkAzMTE0MDJDOTc2N0M5NUQ4RDVDQkI0QzU3MUVEQkJFNjhFRjU1MjFENTBCMjAwMEFCMkZGMUVEODFFNjJEQzlGGgRwMjU2UkA2NjdENjU4QTZDMzE1MEFDNzc1NDQ0RTlBNjlBOTZGMUJFMEE4RjBEMDdBMkFDRkQ4RERFMjkzRjhDOUY0QzNGUkAxRjRGNTg3RDk4NzMzQUE4ODA5RUI2RUIxNEY1ODVFMzY0RTNFMDBBNjBBODZGOEY3MkVFNjI4RDU1REY1MTFGUkA3ODU5QzdEMjVDQUVDMjBBOEQ3OEE4NUYyNkY5MkRERkVDMkUwQTE0NEM3NzM4RkExNjc3NjZGMTc3OThCNjE0UkAxRTgyMjM4NkM4MkYyNjgyRUU2Mjk3MEQ1QjBGRDNFMzhEOTg0QjgzNDI3Mzk0M0ZCNTU5RkU1QUI3RUQwNDlGMlIKCmNvX3NpZ25lcjEaAjAxUkBEMTc4Qzg2NTJBRUI0MUNGQjQzOUYyOTQzMDM1QUZDOTE4QzkzMDFEQ0E3RDkzRDY4MkM0NzJCM0VEM0RBNUY5MlIKCmNvX3NpZ25lcjIaAjAyUkAzNzlBMzA5NTQ2RUQ4OTlEOEJGMTc5NjUwNzRFMzQ3REI3ODQ0Q0I1M0E3MzAyMzgxQzZGMEM2ODhDQUZDRTFDMlIKCmNvX3NpZ25lcjQaAjA0UkA5ODlBMjU4OUQ0RTkxOEY5MDFBODk2QTFDM0ZFNzcwMEU0QjAxQkU3OENCMTlCMkVDMzc2ODk3OUZBMERBNzJBMlIKCmNvX3NpZ25lcjUaAjA1UkAzNUIxOUQxRUYzRDgwNDUwODBGNjAxOUUyQ0U5Q0Y3MUNFNjMxRkU2NkFBQkExRjQ2RUQyRjcxOTIyNDYxOTdDOooBCkBDMTQ1RDFDQzYxQzJFMjkyREZERERDNUFGRUUxM0E4QjZCRjQ4NzI4QUVCNzI4MzA1QjgxMDNDNDAwM0FDMTJBEkAxNTFGQUUwM0E3MjkwMkIzMTcyOURBQURDODc0NEY3NzM4REE2NjY1RUZFMjAzRkQ0RDJDQ0VBRjYxNTM4RTlEGgRwMjU2";
+    sign_key_base64_arr[3]="Cgt3b3Jrc3BhY2UgMBAEGAUq5QMKCmNvX3NpZ25lcjQaAjA0QkBCRTREMkQ3QTI1MzE5ODk2OUE5RTJFMjU4MTcxRjc1ODA0MDMwOEEzQTVBNkQzMDRCMTM2MkE2QTU4MUNCODA1SogBCkBGRDMxRkI3QzBDODc0NEVGQTU1QTU0RkFGMTk2RjQ1MDlGMjE0QUM3NDY2MzA4NjU3MDQyRDgwRTBFRUI2MDM4Ej5BRDc1MDI0Q0YzNjRFRDVGRUE2RjQ5MTIxRDMzMTlEREY2QThFQkRCMDY1RTM3NzM4N0IyNEMwQkRBMzE0NRoEcDI1NlJANTc3OEQ1RjVFQzZGNzM1ODU3NjE0QTNDNTVDQzFCMTQyMThEQkVDN0JBNzAxNkM1QzQ2MTNDN0I5RjcxOUMxOVJAMDhDNEEwODQxN0Y4ODU0NkU4N0RGMzIxMTk1MjUyODI3NkY1QzhGNTZBM0FFRkM2MjlCREE4MTQzQzc1N0JEN1JAMjA0MDVEQjc3ODNBNTZFRTc0MkZFRTQyOUQwNTQ5MjBGODgyMTFEMzQwM0E2MjM0QUNGRjIyODg4Mjc0RjExNlJAN0MzRTE1MTkwN0I3QjQ0M0UzNkZGQzk4QzI5OTQ4NEYyNTFFNDQ5NkQ3RUEyNDVDOEUxMkFBMjAyRjg1QUQ4NTJSCgpjb19zaWduZXIxGgIwMVJAOTk3QTRBQzlENkNEMTE5OUE5N0JFQTBCN0EyQTNCQjc3MTUzN0RERUEzN0E0RDVGRTE5RjFCNEMyRTQ5RDBFQzJSCgpjb19zaWduZXIyGgIwMlJANzM0NTlDMTBCREQ0MkE2RDVCNzRDNjNGRUQwMjhGNDhCOENEQkJFOTBEMzU0MjA3MTAyRDYxMzY3RkZCMjg1MDJSCgpjb19zaWduZXIzGgIwM1JAOTg5QTI1ODlENEU5MThGOTAxQTg5NkExQzNGRTc3MDBFNEIwMUJFNzhDQjE5QjJFQzM3Njg5NzlGQTBEQTcyQTJSCgpjb19zaWduZXI1GgIwNVJARTBEQzJGMzkxMzU4RUQyQkI5OTNDMTEwMzRFMjY0NTFENUEyQjFDQzVFMUY4RTMyQkU0MjFCREM2NkIwQjNGODqKAQpAQzE0NUQxQ0M2MUMyRTI5MkRGREREQzVBRkVFMTNBOEI2QkY0ODcyOEFFQjcyODMwNUI4MTAzQzQwMDNBQzEyQRJAMTUxRkFFMDNBNzI5MDJCMzE3MjlEQUFEQzg3NDRGNzczOERBNjY2NUVGRTIwM0ZENEQyQ0NFQUY2MTUzOEU5RBoEcDI1Ng..";
+    sign_key_base64_arr[4]="Cgt3b3Jrc3BhY2UgMBAEGAUq5wMKCmNvX3NpZ25lcjUaAjA1QkAxMzI1N0MyODdFQkQ5N0Y5MjZGNkNFOUQwNUU0RTQwNDUzOEI1MDFCNTVFNDRGQzVDMTg3NTI4RDMzQzIwOERGSooBCkA2RTE3OUI5QjUwQ0QxMENGQkU3ODFEOTU0M0Y4RjA4QkM1QTg1QkYzQjY4QzIwMkUxMkQyODdENTU1MjMwRUJFEkAzM0NCOTkxOERGN0MyOUZGMzA5MjhDODMyRDZDRDMyRjBDRDRGN0M1Mzg3QzNBOENGRDMzNDlFNUNDMjdFQzM1GgRwMjU2UkAzREM1RUEyNzRDNDFGREIzN0FCQzI5OUQ5MEFCMTMwNDc4QzJFMzJGREM0RjIwNzY1ODYwQ0ZGQTMwNDE5OTRFUkA2MDQ0NEI5RUUyQzM1QkVGODUwQTVDMDk1NTEwODUwODFBMUY3RTgxQUNBNDQ0OEQ4MEUxOERDM0ZDMUI1Q0MwUkAxNzJGNzk5ODJCQThERENEOTI5MzZBOTBEMUQ5RkI4RTQwQ0FENDYzMjgzODBEQjRCOTc4RjhCRTZBNTkxNEREUkA2NDlFMUEyMDBCQTEzOEU3RDYyM0M0Nzc3MjQ5MUMwMkIwODQ2RDM1ODYzNTY5RDYzMDJGNzFCQzM3MkIwNjczMlIKCmNvX3NpZ25lcjEaAjAxUkA5NTAwMjU1QjQ2NkE2NjFFREExN0JDNTYzM0Q1MjRFQzA3QzczNEVDQjkzNDk4MjkzRjk3NjFBMTI5MTVGRjg1MlIKCmNvX3NpZ25lcjIaAjAyUkBDQTc4MTBEOTdDMUQyRkZEREI5QjBGN0FFOTI2MDU0MTM3MjdENDkzMUM1QUJCNUU4QTYxMTE0MDBBMThCN0NCMlIKCmNvX3NpZ25lcjMaAjAzUkAzNUIxOUQxRUYzRDgwNDUwODBGNjAxOUUyQ0U5Q0Y3MUNFNjMxRkU2NkFBQkExRjQ2RUQyRjcxOTIyNDYxOTdDMlIKCmNvX3NpZ25lcjQaAjA0UkBFMERDMkYzOTEzNThFRDJCQjk5M0MxMTAzNEUyNjQ1MUQ1QTJCMUNDNUUxRjhFMzJCRTQyMUJEQzY2QjBCM0Y4OooBCkBDMTQ1RDFDQzYxQzJFMjkyREZERERDNUFGRUUxM0E4QjZCRjQ4NzI4QUVCNzI4MzA1QjgxMDNDNDAwM0FDMTJBEkAxNTFGQUUwM0E3MjkwMkIzMTcyOURBQURDODc0NEY3NzM4REE2NjY1RUZFMjAzRkQ0RDJDQ0VBRjYxNTM4RTlEGgRwMjU2";
+    presign_and_sign(sign_key_base64_arr, party_ids, participants, m_arr);
+
+    //P256 sample with the bytes wire encoding, Round0 sends no payload outside the window
+    printf("Test Li24 presign with p256 curve and bytes wire encoding\n");
+    for (int i = 0; i < N_PARTIES; ++i) {
+        ASSERT_TRUE(safeheron::multi_party_ecdsa::Li24::convert_sign_key(sign_key_base64_arr[i], sign_key_base64_arr[i],
+                                                                         safeheron::multi_party_ecdsa::Li24::WireVersion::Bytes));
+    }
+    presign_and_sign(sign_key_base64_arr, party_ids, participants, m_arr);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    int ret = RUN_ALL_TESTS();
+    google::protobuf::ShutdownProtobufLibrary();
+    return ret;
+}
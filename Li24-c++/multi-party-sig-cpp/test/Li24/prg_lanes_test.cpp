@@ -0,0 +1,123 @@
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include <google/protobuf/stubs/common.h>
+#include "gtest/gtest.h"
+#include "crypto-suites/crypto-bn/bn.h"
+#include "crypto-suites/crypto-bn/rand.h"
+#include "crypto-suites/crypto-hash/sha256.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/prg/prg.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/prg/sha256_lanes.h"
+
+using safeheron::bignum::BN;
+
+const SHA256LanesEngine ENGINE_ARR[] = {SHA256LanesEngine::Scalar, SHA256LanesEngine::AVX2, SHA256LanesEngine::SHANI};
+
+TEST(PRGLanes, SHA256Lanes) {
+    // 19 messages: two full groups of 8 AVX2 lanes and a partial one
+    const size_t count = 19;
+    std::vector<uint8_t> msg_buf(count * SHA256_LANES_MAX_MSG_LEN);
+    for (size_t i = 0; i < msg_buf.size(); ++i) msg_buf[i] = (uint8_t)(i * 131 + 7);
+    std::vector<const uint8_t *> msg_arr;
+    for (size_t i = 0; i < count; ++i) msg_arr.push_back(&msg_buf[i * SHA256_LANES_MAX_MSG_LEN]);
+
+    printf("default engine: %s\n", SHA256LanesEngineName(SHA256LanesDefaultEngine()));
+    for (size_t msg_len = 0; msg_len <= SHA256_LANES_MAX_MSG_LEN; ++msg_len) {
+        std::vector<uint8_t> expected(count * 32);
+        for (size_t i = 0; i < count; ++i) {
+            safeheron::hash::CSHA256 sha256;
+            sha256.Write(msg_arr[i], msg_len);
+            sha256.Finalize(&expected[i * 32]);
+        }
+        for (SHA256LanesEngine engine : ENGINE_ARR) {
+            if (!SHA256LanesSupported(engine)) continue;
+            for (size_t n = 1; n <= count; n += 6) {
+                std::vector<uint8_t> out(n * 32);
+                ASSERT_TRUE(SHA256Lanes(engine, msg_arr.data(), msg_len, n, out.data()));
+                EXPECT_TRUE(std::equal(out.begin(), out.end(), expected.begin()))
+                                    << SHA256LanesEngineName(engine) << " msg_len " << msg_len << " count " << n;
+            }
+        }
+    }
+    uint8_t out[32];
+    EXPECT_FALSE(SHA256Lanes(msg_arr.data(), SHA256_LANES_MAX_MSG_LEN + 1, 1, out));
+}
+
+// rand_lanes() must leave the PRGs exactly where 'count' calls of rand() would
+void check_rand_lanes(PRGType type) {
+    const size_t n_prg = 13;
+    const size_t count = 7;
+    std::vector<PRG> lanes_prg_arr(n_prg);
+    std::vector<PRG> prg_arr(n_prg);
+    for (size_t i = 0; i < n_prg; ++i) {
+        BN seed = safeheron::rand::RandomBN(256);
+        for (PRG *prg : {&lanes_prg_arr[i], &prg_arr[i]}) {
+            prg->set_type(type);
+            prg->init(seed);
+            prg->seek(i);
+        }
+    }
+
+    std::vector<PRG *> prg_ptr_arr;
+    for (PRG &prg : lanes_prg_arr) prg_ptr_arr.push_back(&prg);
+    std::vector<BN> out_arr;
+    for (int step = 0; step < 2; ++step) {
+        PRG::rand_lanes(prg_ptr_arr, count, out_arr);
+        ASSERT_EQ(out_arr.size(), n_prg * count);
+        for (size_t i = 0; i < n_prg; ++i) {
+            for (size_t j = 0; j < count; ++j) {
+                EXPECT_TRUE(out_arr[i * count + j] == prg_arr[i].rand());
+            }
+            EXPECT_EQ(lanes_prg_arr[i].position(), prg_arr[i].position());
+        }
+    }
+    // And rand() carries on from there
+    for (size_t i = 0; i < n_prg; ++i) {
+        EXPECT_TRUE(lanes_prg_arr[i].rand() == prg_arr[i].rand());
+    }
+}
+
+TEST(PRGLanes, HashChain) {
+    check_rand_lanes(PRGType::HashChain);
+}
+
+TEST(PRGLanes, Counter) {
+    check_rand_lanes(PRGType::Counter);
+}
+
+TEST(PRGLanes, Time) {
+    // The streams of Round0 for a quorum of 32: 31 remote parties, 3 outputs each. Only the counter mode is hashed
+    // side by side.
+    const size_t n_prg = 31;
+    const int loops = 200;
+    std::vector<PRG> prg_arr(n_prg);
+    std::vector<PRG *> prg_ptr_arr;
+    for (PRG &prg : prg_arr) {
+        prg.set_type(PRGType::Counter);
+        prg.init(safeheron::rand::RandomBN(256));
+        prg_ptr_arr.push_back(&prg);
+    }
+
+    std::chrono::steady_clock::time_point begin = std::chrono::steady_clock::now();
+    for (int loop = 0; loop < loops; ++loop) {
+        for (size_t j = 0; j < PRG_OUTPUTS_PER_SIGN; ++j) {
+            for (PRG &prg : prg_arr) prg.rand();
+        }
+    }
+    std::chrono::steady_clock::time_point middle = std::chrono::steady_clock::now();
+    std::vector<BN> out_arr;
+    for (int loop = 0; loop < loops; ++loop) {
+        PRG::rand_lanes(prg_ptr_arr, PRG_OUTPUTS_PER_SIGN, out_arr);
+    }
+    std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+    printf("rand(): %.1f us per signature, rand_lanes(): %.1f us per signature\n",
+           std::chrono::duration<double, std::micro>(middle - begin).count() / loops,
+           std::chrono::duration<double, std::micro>(end - middle).count() / loops);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    int ret = RUN_ALL_TESTS();
+    google::protobuf::ShutdownProtobufLibrary();
+    return ret;
+}
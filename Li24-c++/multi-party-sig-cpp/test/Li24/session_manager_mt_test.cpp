@@ -0,0 +1,196 @@
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <google/protobuf/stubs/common.h>
+#include "gtest/gtest.h"
+#include "crypto-suites/crypto-curve/curve.h"
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/session_manager.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/Li24.h"
+
+using std::string;
+using std::vector;
+using safeheron::bignum::BN;
+using safeheron::mpc_flow::mpc_parallel_v2::MPCContext;
+using safeheron::mpc_flow::mpc_parallel_v2::SessionManager;
+using safeheron::mpc_flow::mpc_parallel_v2::TaskGroup;
+using safeheron::mpc_flow::mpc_parallel_v2::ThreadPoolExecutor;
+using safeheron::multi_party_ecdsa::Li24::sign::Context;
+using safeheron::multi_party_ecdsa::Li24::SignKeyHandle;
+
+#define N_PARTIES 5
+#define N_SESSIONS 500
+
+std::string party_ids[N_PARTIES] = {
+        "co_signer1",
+        "co_signer2",
+        "co_signer3",
+        "co_signer4",
+        "co_signer5"
+};
+std::vector<std::string> participants = {"co_signer1", "co_signer2","co_signer3","co_signer4"};
+
+//SECP256K1 sign key
+std::string sign_key_base64_arr[N_PARTIES]={
+        "Cgt3b3Jrc3BhY2UgMBAEGAUq7AMKCmNvX3NpZ25lcjEaAjAxQkA2MjdBNkUxNUE2Qzk2RDZFM0FENzg5NDREMUFFRDY1N0ZBQUM4RTkzNDBFMUFFRTcyRjg4MTAyRDE1Nzk1RTYySo8BCkA2MjM5MTdFNjhGOTMwNDI3RDI5Q0E4MTJCNzEyQjM2QTE2QzgzOTUyRjJFRkJGM0NFNjZDQzg2MjEzMjI4RkFDEkBCNzZBOTM3RDJERTdCMzMzQzgzMTYwRTIzRUE1MTc1ODJBQjJFRDU4NkJCQjYxNDFBMDVENzZFRUJBRkYzNzBFGglzZWNwMjU2azFSQDIwNzhBQzUzMDZFNkNFQTc0RTg2Q0NCNTE1NjFEMjlCRTJFRkI0OUU0QzJDRDg5MTdGMzREODA2MUI5RTlEQThSQDZGMTU3MEYxRUZEMjZBMTlERDgyNzREMkU0MkM4Rjc0NUUzQ0MzMENBODQyNjUxQTBFRDJDMDE4MzVDNEFCOTFSQDM5Q0U0OEI4QjY2RDIyRjZCMTY5M0I5QTY1MTg4RkIzRDk4REUxODJENEZFMjhDNzFGRTE1MjgwNTMxOTcyM0NSQDc4Q0VDMUQzQ0ZCNkExRkMzN0Q3NTcyRTc1QzMwN0IzOEZGODRFRjE4QjM5Qjg1RDY2MzRGRjU1NzM0ODY3ODAyUgoKY29fc2lnbmVyMhoCMDJSQDczOTYyNUQ4Njc3QTc2MTA5N0NEMkY3RTNEODY4M0NBQTVBNkNDNkUxRTRCQjU1RUNCMTUyNDA4QjRDN0IxNjcyUgoKY29fc2lnbmVyMxoCMDNSQEJFQUEwMEY3N0FFMkJGMUIzRjE3RjgxMzE0N0MwNThCRjYyRjg0QzdDMDg5OTVEMDA3RUUyNzc0OTYxNTY0MjkyUgoKY29fc2lnbmVyNBoCMDRSQDNCNEQwN0VEOTEwNTRDMTJCODQyMTA3NkE1NUY1NDZGRDc1QkNDNzgwMzZBRjk5RjUyMjk4NUYwQzQyQjM3NjQyUgoKY29fc2lnbmVyNRoCMDVSQENFNDlGMjZCQkE5RkFDRkM2RDRCNDM2NEVFMzBGNkExNEU0NTExQjUzRTQ2RDIzMjFGQTdFOUZFOUUwQzU2OUM6jwEKQDU5MzRCOUNBRDNBQkU3NkM5MDEyMEI4MkM3ODkwNkQ0QjBGODMwOTk1NDM5QjhEMzFCOTFBMzQ2N0RDQjZGQzESQEFDRUIxQ0Q2OUY5QkMxNTY4MzczRUJFRjdENUY1NTdFQTUzNDFCQ0Y4QjFFNEY3MEM3RDI0OUExREYxMzdBOTgaCXNlY3AyNTZrMQ.",
+        "Cgt3b3Jrc3BhY2UgMBAEGAUq7AMKCmNvX3NpZ25lcjIaAjAyQkBDRTcyQ0VBQjY3NTYwQzM0QzkzNzFEMjBCQjMwRjUyMDZGMkM2OTBCMjA0MjA1MEE0NjVBMTk1REE1OERGMkNDSo8BCkBEREIzQkRCNEYwMTA2Rjk4NjNGQjc0OTk0NEQ1MDg5ODEyQjU2RjI5MjlBN0E4NDQxNEE0M0Q1RkQ1OEUwNzE3EkAyRUZDMzVGOUE2MUUxRTRCNkRFQkNEMzQ0NDVFQjQzMTMzNTBDMDBGOEYyMEY4ODEzNkRGRUQ2QzE2MEFEOUI4GglzZWNwMjU2azFSQDUzMUQ3OTg1NjA5M0E3Njk0OTQ2NjJDOTI4MjRCMTJFQzJCNzE3Q0ZEMjFFRENDRDRCRTA0QzAyOTkyOTEzQkZSQDFENUQ2OTk2OUYxQUJDMkFEQ0U4NUFBQkUyOTkxNEU4Mzk0OTY2MUYzRDhGNzQ4QzdDRTg1MUM2QTI5N0I1REVSQDBFQkQ2MzFGNzBDMTcxMzgwMzVGNTU3OTdCNTFFRTNDQ0JFMTExNkNEQTI5MDc0MjBENDVGMkM4N0I4M0M0NTVSQDExQUEzRjI5MTA0MDRFNUMyMEJBQTRBMjhBNkM0OURGNDg1QjExMEUyM0EyM0NFODgwRkY3Njg4MEMxNjc3MkYyUgoKY29fc2lnbmVyMRoCMDFSQDczOTYyNUQ4Njc3QTc2MTA5N0NEMkY3RTNEODY4M0NBQTVBNkNDNkUxRTRCQjU1RUNCMTUyNDA4QjRDN0IxNjcyUgoKY29fc2lnbmVyMxoCMDNSQDI4RDBBODY3QjYzNDQ4Q0E1QjUyRUFCOTVFRUYzRjM0MEE3ODY5MjZBQ0RDQjhDREZFOEJGMkZBQjg3ODAwNzQyUgoKY29fc2lnbmVyNBoCMDRSQDMwODIwMjYxNEIzNEI1RjRGNjE5NTI2OTNDNDk2QTdGOEQ3MUIxMUZCMERFMjdFQUNCNThCMThFNjdCMkM2OTIyUgoKY29fc2lnbmVyNRoCMDVSQDU4NDk5QjQ2MkE3RkRFNDU2NUIwOUU4MkUwRUFCMkJGNDUzM0FCODFEQzMyMzc2QUZEQTM2RjE3OEU5QjU2MTA6jwEKQDU5MzRCOUNBRDNBQkU3NkM5MDEyMEI4MkM3ODkwNkQ0QjBGODMwOTk1NDM5QjhEMzFCOTFBMzQ2N0RDQjZGQzESQEFDRUIxQ0Q2OUY5QkMxNTY4MzczRUJFRjdENUY1NTdFQTUzNDFCQ0Y4QjFFNEY3MEM3RDI0OUExREYxMzdBOTgaCXNlY3AyNTZrMQ.",
+        "Cgt3b3Jrc3BhY2UgMBAEGAUq7AMKCmNvX3NpZ25lcjMaAjAzQkAxQkEyQjg4MzBGODEzRDQwQjhDNEQ0REYzMDg3MkI2OUZBMzdFMDg5REM2OTA1REQxOTIzRDM5QUVFRTU2NDlESo8BCkAwQzA0NTlBNTE5RUMzODIxN0I3N0NGRTg0NEY5MzMzNzlFRTcxQ0RDRTcyNUEwQjk0MDM2Nzg5OUExM0QwNUVDEkBFREQwRkI0Mjc0NzM0ODhGQkRERTVENkFCOEQ2QzUyQUQ3ODhGQzJBMEIyNUNDNUU2MTA4ODIyRjBFNDM0QTg2GglzZWNwMjU2azFSQDRGOTQ5MDA1OEIxMDU1MDE2MTk1ODM0MDMwNEY3NjE3OTdGMkMxQkIxODQ3MzBCNUY5MUI2NzVDNjA1MEI4OThSQDBCNzMzRUQxMTcxOThDOUY3RTZBOTAwRDdDNTYyQTRCRDEyRjAzMDc2RjRENDQ0MTgxQTNBMTM0MTVFMDRBOTZSQDU4QjEwODhEREYwMTBEODFEMTlBRjQyNDhBMUQyMzVENDU2MDQ1MjNDODU5MkI0RDVCNUZBMkVBMUI0MjJBRTFSQDVGRDA4N0EwMEM1OERERTc0NjYyRTRDNjQ3NjBERTU1RDg3M0I3NTVGRTdBNzE0QTg4QTYwNDREMkQ3MTdCMzkyUgoKY29fc2lnbmVyMRoCMDFSQEJFQUEwMEY3N0FFMkJGMUIzRjE3RjgxMzE0N0MwNThCRjYyRjg0QzdDMDg5OTVEMDA3RUUyNzc0OTYxNTY0MjkyUgoKY29fc2lnbmVyMhoCMDJSQDI4RDBBODY3QjYzNDQ4Q0E1QjUyRUFCOTVFRUYzRjM0MEE3ODY5MjZBQ0RDQjhDREZFOEJGMkZBQjg3ODAwNzQyUgoKY29fc2lnbmVyNBoCMDRSQEE4MEQ2NDI5QzQ3M0Q5MDY2N0FCQzQ4REI2REE0NEI0RkJENEM1OUQ1MkZFNEQzNDg5RkJFOTYxMzQwQjMzNUQyUgoKY29fc2lnbmVyNRoCMDVSQEI1NUE2RjkyQkYwQ0EwQ0UxNDdDQTA5NDY1NUJEOEM3OUYxMjA4MzczOEQ2NzgwNkI2MjdFRkQ0QUQ2NzFCQUE6jwEKQDU5MzRCOUNBRDNBQkU3NkM5MDEyMEI4MkM3ODkwNkQ0QjBGODMwOTk1NDM5QjhEMzFCOTFBMzQ2N0RDQjZGQzESQEFDRUIxQ0Q2OUY5QkMxNTY4MzczRUJFRjdENUY1NTdFQTUzNDFCQ0Y4QjFFNEY3MEM3RDI0OUExREYxMzdBOTgaCXNlY3AyNTZrMQ.",
+        "Cgt3b3Jrc3BhY2UgMBAEGAUq7AMKCmNvX3NpZ25lcjQaAjA0QkAyNTc5Mjg1RjBBQTIxRUFBMkU4QzU1QTYzNUYwODZEOTZENjc0QjZFMThFMzM4OUQ1MTIwNkI3MjIzNkQ1NEVBSo8BCkBERjc0RjMzNUVGQkVDMkZCQ0E3RDBFMkVEMDYyMzQ5OEQ0MzBCMzgyRTAyQkI5REM0MDI1QUEzQ0Q2REExNkIyEkA1OUU2ODcyOTczNjhGMjZERjVCOEREMTY2RDkxQkY1NjFBNDM2NkU0RDI1MzE5OUNFNTNEQTdDMDMwQ0M4NThCGglzZWNwMjU2azFSQDAxN0VCRjM0REE5ODI5MUMwNkQ4RDREQzQwNDZDNEJCRkRDREVBRjUyRTZDRDBEODMyNDgzMzcwNzExMUM1MjhSQDIxQzQ5RjQxREE3MzQ0QkNGMkI5RkNFRkMwRjc3QzQyQzE5MDlGQjJENkI1MjBBOEJFMTJCRUM1RUMyRjAyM0RSQDRGNUM1QjlCRTU3MkNCODQ5NjEwRDA2OTJDQkQyMTU3QjY3NDgwNzk4QUE1MjFFNzJFOUM0Njc3MThDOTA4N0NSQDFBQkEyRTU1RUZDMUI2NjBDMzY1RUFDMjZBRDY4NURGQ0U5QTM2QkYxN0Q0OTQ5QTIxOEI0MTMwN0QwMEI0NzcyUgoKY29fc2lnbmVyMRoCMDFSQDNCNEQwN0VEOTEwNTRDMTJCODQyMTA3NkE1NUY1NDZGRDc1QkNDNzgwMzZBRjk5RjUyMjk4NUYwQzQyQjM3NjQyUgoKY29fc2lnbmVyMhoCMDJSQDMwODIwMjYxNEIzNEI1RjRGNjE5NTI2OTNDNDk2QTdGOEQ3MUIxMUZCMERFMjdFQUNCNThCMThFNjdCMkM2OTIyUgoKY29fc2lnbmVyMxoCMDNSQEE4MEQ2NDI5QzQ3M0Q5MDY2N0FCQzQ4REI2REE0NEI0RkJENEM1OUQ1MkZFNEQzNDg5RkJFOTYxMzQwQjMzNUQyUgoKY29fc2lnbmVyNRoCMDVSQDk3NjQyNzJFQkJBQzY5RDFGQkM3NEY4QjU1QTA4ODU5NzhEMUZCQ0FFOThEODBDOTY5ODcxMzQ2RTQ0MDlGNDI6jwEKQDU5MzRCOUNBRDNBQkU3NkM5MDEyMEI4MkM3ODkwNkQ0QjBGODMwOTk1NDM5QjhEMzFCOTFBMzQ2N0RDQjZGQzESQEFDRUIxQ0Q2OUY5QkMxNTY4MzczRUJFRjdENUY1NTdFQTUzNDFCQ0Y4QjFFNEY3MEM3RDI0OUExREYxMzdBOTgaCXNlY3AyNTZrMQ.",
+        "Cgt3b3Jrc3BhY2UgMBAEGAUq7AMKCmNvX3NpZ25lcjUaAjA1QkBDNzY1MUIwMUM0MEZDRTg5NEY5OTQ0OUJDRkFDMTUxNjI0RjU0NjQ5MUFBQkU0MTExN0U2NTA1NkQ0QTZFMjQ2So8BCkAzQzM2MzVBQjJBMjMyNUY5MjFBRjk3RkM4RTZBMTIzQ0QzNEYwQURDQ0ZBNkMyMjhFQ0ZCRUU1RjQ5MTZEODFFEkAwNTg0MTVGMTQ2MDcyNUFCNkMzMTc5NjZBOUZGMjVDNDRGNjY4OURENTExNTg0QTdBNEJEMEMyNTY2QzJFQjExGglzZWNwMjU2azFSQDU1N0IzMDk3RUFFOTBCMDAzNTczRUMzNjc4NkRFRUVEQkU0Q0MyQzNCMzBEMTlENEI5NzJFQUE5MkFDM0VGMUNSQDQ2OUY1QzFEMUEzRjhGRTk0NEY1RjlFMDU2N0U2OERGRkNEODlBNzNCODhGRkE4MjdDQTNGODhGODI4NERFRTFSQDU1ODlFN0YyQjJCM0MyRTZDRTE5QkJDRTFERkFGQTcxQzY5RTUwRTEzQTVDMDZCQzJEODFFQjg3N0ZGNUEwNzFSQDdDQTlGOEQ4Q0JFQUIzNzEzODYxNjRDOEVBQ0EwMjc5QUEzN0M1MEJEMUI4RUMyRjQ3RkJEMjE2NjczRkVBQ0IyUgoKY29fc2lnbmVyMRoCMDFSQENFNDlGMjZCQkE5RkFDRkM2RDRCNDM2NEVFMzBGNkExNEU0NTExQjUzRTQ2RDIzMjFGQTdFOUZFOUUwQzU2OUMyUgoKY29fc2lnbmVyMhoCMDJSQDU4NDk5QjQ2MkE3RkRFNDU2NUIwOUU4MkUwRUFCMkJGNDUzM0FCODFEQzMyMzc2QUZEQTM2RjE3OEU5QjU2MTAyUgoKY29fc2lnbmVyMxoCMDNSQEI1NUE2RjkyQkYwQ0EwQ0UxNDdDQTA5NDY1NUJEOEM3OUYxMjA4MzczOEQ2NzgwNkI2MjdFRkQ0QUQ2NzFCQUEyUgoKY29fc2lnbmVyNBoCMDRSQDk3NjQyNzJFQkJBQzY5RDFGQkM3NEY4QjU1QTA4ODU5NzhEMUZCQ0FFOThEODBDOTY5ODcxMzQ2RTQ0MDlGNDI6jwEKQDU5MzRCOUNBRDNBQkU3NkM5MDEyMEI4MkM3ODkwNkQ0QjBGODMwOTk1NDM5QjhEMzFCOTFBMzQ2N0RDQjZGQzESQEFDRUIxQ0Q2OUY5QkMxNTY4MzczRUJFRjdENUY1NTdFQTUzNDFCQ0Y4QjFFNEY3MEM3RDI0OUExREYxMzdBOTgaCXNlY3AyNTZrMQ."
+};
+
+// One manager per signer, as if every signer was a server of its own
+std::map<std::string, std::unique_ptr<SessionManager>> map_id_manager;
+
+std::mutex result_mutex;
+// Signature of every session, as computed by every signer
+std::map<std::string, vector<std::pair<BN, BN>>> map_session_signature;
+std::map<std::string, SessionManager::SessionState> map_session_state;
+
+std::unique_ptr<Context> create_context(const SignKeyHandle &handle, int session) {
+    BN m = BN(session + 1) * BN("1234567812345678123456781234567812345678", 16);
+    std::unique_ptr<Context> ctx(new Context(participants.size()));
+    if (!Context::CreateContext(*ctx, handle, participants, m)) return nullptr;
+    for (size_t j = 0; j < ctx->sign_key_.remote_parties_.size(); ++j) {
+        ctx->sign_key_.remote_parties_[j].prg.reset();
+        ctx->sign_key_.remote_parties_[j].prg.init(ctx->sign_key_.remote_parties_[j].seed_);
+    }
+    return ctx;
+}
+
+void create_managers(ThreadPoolExecutor *executor, const SessionManager::Options &options) {
+    map_id_manager.clear();
+    for (size_t i = 0; i < participants.size(); ++i) {
+        const std::string local_id = participants[i];
+        SessionManager::OutboundCallback on_outbound = [local_id](const std::string &session_id, int round,
+                                                                  const vector<string> &out_p2p_msg_arr,
+                                                                  const string &out_bc_msg,
+                                                                  const vector<string> &out_des_arr) {
+            for (size_t j = 0; j < out_des_arr.size(); ++j) {
+                map_id_manager.at(out_des_arr[j])->PostMessage(session_id, local_id, round,
+                                                               out_p2p_msg_arr.empty() ? "" : out_p2p_msg_arr[j],
+                                                               out_bc_msg);
+            }
+        };
+        SessionManager::CompletionCallback on_completion = [](const std::string &session_id,
+                                                              std::unique_ptr<MPCContext> mpc_ctx,
+                                                              SessionManager::SessionState state) {
+            std::lock_guard<std::mutex> lock(result_mutex);
+            map_session_state[session_id] = state;
+            if (state != SessionManager::SessionState::Finished) return;
+            Context *ctx = static_cast<Context *>(mpc_ctx.get());
+            map_session_signature[session_id].emplace_back(ctx->r_, ctx->s_);
+        };
+        map_id_manager[local_id].reset(new SessionManager(executor, options, on_outbound, on_completion));
+    }
+}
+
+void wait_until_idle() {
+    for (;;) {
+        size_t running = 0;
+        for (auto &item : map_id_manager) {
+            running += item.second->running_count();
+        }
+        if (running == 0) break;
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+}
+
+TEST(Li24, session_manager_mt) {
+    ThreadPoolExecutor executor(4);
+    create_managers(&executor, SessionManager::Options());
+
+    // Every signer adds the sessions in its own order, so that messages often come before their session
+    for (size_t i = 0; i < participants.size(); ++i) {
+        std::shared_ptr<const SignKeyHandle> handle = SignKeyHandle::FromBase64(sign_key_base64_arr[i]);
+        ASSERT_TRUE(handle != nullptr);
+        for (int k = 0; k < N_SESSIONS; ++k) {
+            int session = (i % 2 == 0) ? k : N_SESSIONS - 1 - k;
+            std::unique_ptr<Context> ctx = create_context(*handle, session);
+            ASSERT_TRUE(ctx != nullptr);
+            ASSERT_TRUE(map_id_manager[participants[i]]->AddSession("session " + std::to_string(session), std::move(ctx)));
+        }
+    }
+    wait_until_idle();
+
+    SessionManager::SessionInfo info;
+    ASSERT_TRUE(map_id_manager[participants[0]]->GetSessionInfo("session 0", info));
+    EXPECT_TRUE(info.state_ == SessionManager::SessionState::Finished);
+    // A session id is used once
+    std::shared_ptr<const SignKeyHandle> handle = SignKeyHandle::FromBase64(sign_key_base64_arr[0]);
+    EXPECT_FALSE(map_id_manager[participants[0]]->AddSession("session 0", create_context(*handle, 0)));
+    EXPECT_FALSE(map_id_manager[participants[0]]->PostMessage("session 0", participants[1], 0, "", ""));
+    map_id_manager.clear();
+
+    std::lock_guard<std::mutex> lock(result_mutex);
+    ASSERT_EQ(map_session_signature.size(), (size_t)N_SESSIONS);
+    for (const auto &item : map_session_signature) {
+        ASSERT_EQ(item.second.size(), participants.size());
+        for (size_t i = 1; i < item.second.size(); ++i) {
+            EXPECT_TRUE(item.second[i].first == item.second[0].first);
+            EXPECT_TRUE(item.second[i].second == item.second[0].second);
+        }
+    }
+}
+
+TEST(Li24, session_manager_limits) {
+    ThreadPoolExecutor executor(2);
+    SessionManager::Options options;
+    options.max_sessions_ = 2;
+    options.max_pending_bytes_ = 4096;
+    options.timeout_ = std::chrono::milliseconds(100);
+    options.retention_ = std::chrono::seconds(10);
+    create_managers(&executor, options);
+    map_session_state.clear();
+
+    std::shared_ptr<const SignKeyHandle> handle = SignKeyHandle::FromBase64(sign_key_base64_arr[0]);
+    SessionManager &manager = *map_id_manager[participants[0]];
+
+    // The other signers never join: the session times out
+    ASSERT_TRUE(manager.AddSession("lonely", create_context(*handle, 0)));
+    // Too many messages waiting: the session fails
+    ASSERT_TRUE(manager.AddSession("flooded", create_context(*handle, 1)));
+    EXPECT_FALSE(manager.AddSession("one too many", create_context(*handle, 2)));
+    EXPECT_FALSE(manager.PostMessage("flooded", participants[1], 1, std::string(8192, 'x'), ""));
+    // Messages of a session which is not added yet are kept within the same limits
+    EXPECT_TRUE(manager.PostMessage("later", participants[1], 0, std::string(1024, 'x'), ""));
+    EXPECT_FALSE(manager.PostMessage("later", participants[1], 0, std::string(4096, 'x'), ""));
+
+    wait_until_idle();
+    SessionManager::SessionInfo info;
+    ASSERT_TRUE(manager.GetSessionInfo("lonely", info));
+    EXPECT_TRUE(info.state_ == SessionManager::SessionState::TimedOut);
+    EXPECT_GE(info.age_.count(), 100);
+    ASSERT_TRUE(manager.GetSessionInfo("flooded", info));
+    EXPECT_TRUE(info.state_ == SessionManager::SessionState::Failed);
+    EXPECT_FALSE(manager.GetSessionInfo("later", info));
+
+    std::lock_guard<std::mutex> lock(result_mutex);
+    EXPECT_TRUE(map_session_state["lonely"] == SessionManager::SessionState::TimedOut);
+    EXPECT_TRUE(map_session_state["flooded"] == SessionManager::SessionState::Failed);
+    map_id_manager.clear();
+}
+
+TEST(Li24, task_group_exception) {
+    ThreadPoolExecutor executor(2);
+    TaskGroup group;
+    std::atomic<int> done(0);
+    // A throwing task is counted as done and does not take the worker down
+    group.Run(&executor, []() { throw std::runtime_error("task failed"); });
+    for (int i = 0; i < 4; ++i) {
+        group.Run(&executor, [&done]() { ++done; });
+    }
+    group.Wait();
+    EXPECT_EQ(done.load(), 4);
+    std::exception_ptr error = group.TakeError();
+    ASSERT_TRUE(error != nullptr);
+    EXPECT_THROW(std::rethrow_exception(error), std::runtime_error);
+    EXPECT_TRUE(group.TakeError() == nullptr);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    int ret = RUN_ALL_TESTS();
+    google::protobuf::ShutdownProtobufLibrary();
+    return ret;
+}
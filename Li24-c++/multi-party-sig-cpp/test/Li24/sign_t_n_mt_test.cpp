@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <cstring>
+#include <memory>
 #include <thread>
 #include <future>
 #include <vector>
@@ -7,6 +10,7 @@
 #include "crypto-suites/crypto-curve/curve.h"
 #include "multi-party-sig/multi-party-ecdsa/Li24/Li24.h"
 #include "multi-party-sig/multi-party-ecdsa/Li24/util.h"
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/local_transport.h"
 #include "../thread_safe_queue.h"
 #include "../message.h"
 #include "../party_message_queue.h"
@@ -20,6 +24,7 @@ using safeheron::curve::CurvePoint;
 using safeheron::curve::CurveType;
 using safeheron::multi_party_ecdsa::Li24::sign::Context;
 using safeheron::mpc_flow::mpc_parallel_v2::ErrorInfo;
+using safeheron::mpc_flow::mpc_parallel_v2::LocalMessage;
 
 void print_context_stack_if_failed(Context *ctx) {
     std::string err_info;
@@ -50,20 +55,88 @@ std::map<std::string, PartyMessageQue<Msg>> map_id_message_queue;
 #define N_PARTIES 5
 #define THRESHOLD 4
 
-bool sign(std::string sign_key_base64, std::vector<std::string> participants, BN m) {
-    //preprocess sign key to fit t-n threshold
-    std::string t_sign_key_base64;
-    bool ok = safeheron::multi_party_ecdsa::Li24::trim_sign_key(t_sign_key_base64, sign_key_base64, participants);
-    if (!ok) return false;
+std::string party_ids[N_PARTIES] = {
+        "co_signer1",
+        "co_signer2",
+        "co_signer3",
+        "co_signer4",
+        "co_signer5"
+};
+std::vector<std::string> participants = {"co_signer1", "co_signer2","co_signer3","co_signer4"};
+
+//SECP256K1 sign key
+std::string secp256k1_sign_key_base64_arr[N_PARTIES]={
+        "Cgt3b3Jrc3BhY2UgMBAEGAUq7AMKCmNvX3NpZ25lcjEaAjAxQkA2MjdBNkUxNUE2Qzk2RDZFM0FENzg5NDREMUFFRDY1N0ZBQUM4RTkzNDBFMUFFRTcyRjg4MTAyRDE1Nzk1RTYySo8BCkA2MjM5MTdFNjhGOTMwNDI3RDI5Q0E4MTJCNzEyQjM2QTE2QzgzOTUyRjJFRkJGM0NFNjZDQzg2MjEzMjI4RkFDEkBCNzZBOTM3RDJERTdCMzMzQzgzMTYwRTIzRUE1MTc1ODJBQjJFRDU4NkJCQjYxNDFBMDVENzZFRUJBRkYzNzBFGglzZWNwMjU2azFSQDIwNzhBQzUzMDZFNkNFQTc0RTg2Q0NCNTE1NjFEMjlCRTJFRkI0OUU0QzJDRDg5MTdGMzREODA2MUI5RTlEQThSQDZGMTU3MEYxRUZEMjZBMTlERDgyNzREMkU0MkM4Rjc0NUUzQ0MzMENBODQyNjUxQTBFRDJDMDE4MzVDNEFCOTFSQDM5Q0U0OEI4QjY2RDIyRjZCMTY5M0I5QTY1MTg4RkIzRDk4REUxODJENEZFMjhDNzFGRTE1MjgwNTMxOTcyM0NSQDc4Q0VDMUQzQ0ZCNkExRkMzN0Q3NTcyRTc1QzMwN0IzOEZGODRFRjE4QjM5Qjg1RDY2MzRGRjU1NzM0ODY3ODAyUgoKY29fc2lnbmVyMhoCMDJSQDczOTYyNUQ4Njc3QTc2MTA5N0NEMkY3RTNEODY4M0NBQTVBNkNDNkUxRTRCQjU1RUNCMTUyNDA4QjRDN0IxNjcyUgoKY29fc2lnbmVyMxoCMDNSQEJFQUEwMEY3N0FFMkJGMUIzRjE3RjgxMzE0N0MwNThCRjYyRjg0QzdDMDg5OTVEMDA3RUUyNzc0OTYxNTY0MjkyUgoKY29fc2lnbmVyNBoCMDRSQDNCNEQwN0VEOTEwNTRDMTJCODQyMTA3NkE1NUY1NDZGRDc1QkNDNzgwMzZBRjk5RjUyMjk4NUYwQzQyQjM3NjQyUgoKY29fc2lnbmVyNRoCMDVSQENFNDlGMjZCQkE5RkFDRkM2RDRCNDM2NEVFMzBGNkExNEU0NTExQjUzRTQ2RDIzMjFGQTdFOUZFOUUwQzU2OUM6jwEKQDU5MzRCOUNBRDNBQkU3NkM5MDEyMEI4MkM3ODkwNkQ0QjBGODMwOTk1NDM5QjhEMzFCOTFBMzQ2N0RDQjZGQzESQEFDRUIxQ0Q2OUY5QkMxNTY4MzczRUJFRjdENUY1NTdFQTUzNDFCQ0Y4QjFFNEY3MEM3RDI0OUExREYxMzdBOTgaCXNlY3AyNTZrMQ.",
+        "Cgt3b3Jrc3BhY2UgMBAEGAUq7AMKCmNvX3NpZ25lcjIaAjAyQkBDRTcyQ0VBQjY3NTYwQzM0QzkzNzFEMjBCQjMwRjUyMDZGMkM2OTBCMjA0MjA1MEE0NjVBMTk1REE1OERGMkNDSo8BCkBEREIzQkRCNEYwMTA2Rjk4NjNGQjc0OTk0NEQ1MDg5ODEyQjU2RjI5MjlBN0E4NDQxNEE0M0Q1RkQ1OEUwNzE3EkAyRUZDMzVGOUE2MUUxRTRCNkRFQkNEMzQ0NDVFQjQzMTMzNTBDMDBGOEYyMEY4ODEzNkRGRUQ2QzE2MEFEOUI4GglzZWNwMjU2azFSQDUzMUQ3OTg1NjA5M0E3Njk0OTQ2NjJDOTI4MjRCMTJFQzJCNzE3Q0ZEMjFFRENDRDRCRTA0QzAyOTkyOTEzQkZSQDFENUQ2OTk2OUYxQUJDMkFEQ0U4NUFBQkUyOTkxNEU4Mzk0OTY2MUYzRDhGNzQ4QzdDRTg1MUM2QTI5N0I1REVSQDBFQkQ2MzFGNzBDMTcxMzgwMzVGNTU3OTdCNTFFRTNDQ0JFMTExNkNEQTI5MDc0MjBENDVGMkM4N0I4M0M0NTVSQDExQUEzRjI5MTA0MDRFNUMyMEJBQTRBMjhBNkM0OURGNDg1QjExMEUyM0EyM0NFODgwRkY3Njg4MEMxNjc3MkYyUgoKY29fc2lnbmVyMRoCMDFSQDczOTYyNUQ4Njc3QTc2MTA5N0NEMkY3RTNEODY4M0NBQTVBNkNDNkUxRTRCQjU1RUNCMTUyNDA4QjRDN0IxNjcyUgoKY29fc2lnbmVyMxoCMDNSQDI4RDBBODY3QjYzNDQ4Q0E1QjUyRUFCOTVFRUYzRjM0MEE3ODY5MjZBQ0RDQjhDREZFOEJGMkZBQjg3ODAwNzQyUgoKY29fc2lnbmVyNBoCMDRSQDMwODIwMjYxNEIzNEI1RjRGNjE5NTI2OTNDNDk2QTdGOEQ3MUIxMUZCMERFMjdFQUNCNThCMThFNjdCMkM2OTIyUgoKY29fc2lnbmVyNRoCMDVSQDU4NDk5QjQ2MkE3RkRFNDU2NUIwOUU4MkUwRUFCMkJGNDUzM0FCODFEQzMyMzc2QUZEQTM2RjE3OEU5QjU2MTA6jwEKQDU5MzRCOUNBRDNBQkU3NkM5MDEyMEI4MkM3ODkwNkQ0QjBGODMwOTk1NDM5QjhEMzFCOTFBMzQ2N0RDQjZGQzESQEFDRUIxQ0Q2OUY5QkMxNTY4MzczRUJFRjdENUY1NTdFQTUzNDFCQ0Y4QjFFNEY3MEM3RDI0OUExREYxMzdBOTgaCXNlY3AyNTZrMQ.",
+        "Cgt3b3Jrc3BhY2UgMBAEGAUq7AMKCmNvX3NpZ25lcjMaAjAzQkAxQkEyQjg4MzBGODEzRDQwQjhDNEQ0REYzMDg3MkI2OUZBMzdFMDg5REM2OTA1REQxOTIzRDM5QUVFRTU2NDlESo8BCkAwQzA0NTlBNTE5RUMzODIxN0I3N0NGRTg0NEY5MzMzNzlFRTcxQ0RDRTcyNUEwQjk0MDM2Nzg5OUExM0QwNUVDEkBFREQwRkI0Mjc0NzM0ODhGQkRERTVENkFCOEQ2QzUyQUQ3ODhGQzJBMEIyNUNDNUU2MTA4ODIyRjBFNDM0QTg2GglzZWNwMjU2azFSQDRGOTQ5MDA1OEIxMDU1MDE2MTk1ODM0MDMwNEY3NjE3OTdGMkMxQkIxODQ3MzBCNUY5MUI2NzVDNjA1MEI4OThSQDBCNzMzRUQxMTcxOThDOUY3RTZBOTAwRDdDNTYyQTRCRDEyRjAzMDc2RjRENDQ0MTgxQTNBMTM0MTVFMDRBOTZSQDU4QjEwODhEREYwMTBEODFEMTlBRjQyNDhBMUQyMzVENDU2MDQ1MjNDODU5MkI0RDVCNUZBMkVBMUI0MjJBRTFSQDVGRDA4N0EwMEM1OERERTc0NjYyRTRDNjQ3NjBERTU1RDg3M0I3NTVGRTdBNzE0QTg4QTYwNDREMkQ3MTdCMzkyUgoKY29fc2lnbmVyMRoCMDFSQEJFQUEwMEY3N0FFMkJGMUIzRjE3RjgxMzE0N0MwNThCRjYyRjg0QzdDMDg5OTVEMDA3RUUyNzc0OTYxNTY0MjkyUgoKY29fc2lnbmVyMhoCMDJSQDI4RDBBODY3QjYzNDQ4Q0E1QjUyRUFCOTVFRUYzRjM0MEE3ODY5MjZBQ0RDQjhDREZFOEJGMkZBQjg3ODAwNzQyUgoKY29fc2lnbmVyNBoCMDRSQEE4MEQ2NDI5QzQ3M0Q5MDY2N0FCQzQ4REI2REE0NEI0RkJENEM1OUQ1MkZFNEQzNDg5RkJFOTYxMzQwQjMzNUQyUgoKY29fc2lnbmVyNRoCMDVSQEI1NUE2RjkyQkYwQ0EwQ0UxNDdDQTA5NDY1NUJEOEM3OUYxMjA4MzczOEQ2NzgwNkI2MjdFRkQ0QUQ2NzFCQUE6jwEKQDU5MzRCOUNBRDNBQkU3NkM5MDEyMEI4MkM3ODkwNkQ0QjBGODMwOTk1NDM5QjhEMzFCOTFBMzQ2N0RDQjZGQzESQEFDRUIxQ0Q2OUY5QkMxNTY4MzczRUJFRjdENUY1NTdFQTUzNDFCQ0Y4QjFFNEY3MEM3RDI0OUExREYxMzdBOTgaCXNlY3AyNTZrMQ.",
+        "Cgt3b3Jrc3BhY2UgMBAEGAUq7AMKCmNvX3NpZ25lcjQaAjA0QkAyNTc5Mjg1RjBBQTIxRUFBMkU4QzU1QTYzNUYwODZEOTZENjc0QjZFMThFMzM4OUQ1MTIwNkI3MjIzNkQ1NEVBSo8BCkBERjc0RjMzNUVGQkVDMkZCQ0E3RDBFMkVEMDYyMzQ5OEQ0MzBCMzgyRTAyQkI5REM0MDI1QUEzQ0Q2REExNkIyEkA1OUU2ODcyOTczNjhGMjZERjVCOEREMTY2RDkxQkY1NjFBNDM2NkU0RDI1MzE5OUNFNTNEQTdDMDMwQ0M4NThCGglzZWNwMjU2azFSQDAxN0VCRjM0REE5ODI5MUMwNkQ4RDREQzQwNDZDNEJCRkRDREVBRjUyRTZDRDBEODMyNDgzMzcwNzExMUM1MjhSQDIxQzQ5RjQxREE3MzQ0QkNGMkI5RkNFRkMwRjc3QzQyQzE5MDlGQjJENkI1MjBBOEJFMTJCRUM1RUMyRjAyM0RSQDRGNUM1QjlCRTU3MkNCODQ5NjEwRDA2OTJDQkQyMTU3QjY3NDgwNzk4QUE1MjFFNzJFOUM0Njc3MThDOTA4N0NSQDFBQkEyRTU1RUZDMUI2NjBDMzY1RUFDMjZBRDY4NURGQ0U5QTM2QkYxN0Q0OTQ5QTIxOEI0MTMwN0QwMEI0NzcyUgoKY29fc2lnbmVyMRoCMDFSQDNCNEQwN0VEOTEwNTRDMTJCODQyMTA3NkE1NUY1NDZGRDc1QkNDNzgwMzZBRjk5RjUyMjk4NUYwQzQyQjM3NjQyUgoKY29fc2lnbmVyMhoCMDJSQDMwODIwMjYxNEIzNEI1RjRGNjE5NTI2OTNDNDk2QTdGOEQ3MUIxMUZCMERFMjdFQUNCNThCMThFNjdCMkM2OTIyUgoKY29fc2lnbmVyMxoCMDNSQEE4MEQ2NDI5QzQ3M0Q5MDY2N0FCQzQ4REI2REE0NEI0RkJENEM1OUQ1MkZFNEQzNDg5RkJFOTYxMzQwQjMzNUQyUgoKY29fc2lnbmVyNRoCMDVSQDk3NjQyNzJFQkJBQzY5RDFGQkM3NEY4QjU1QTA4ODU5NzhEMUZCQ0FFOThEODBDOTY5ODcxMzQ2RTQ0MDlGNDI6jwEKQDU5MzRCOUNBRDNBQkU3NkM5MDEyMEI4MkM3ODkwNkQ0QjBGODMwOTk1NDM5QjhEMzFCOTFBMzQ2N0RDQjZGQzESQEFDRUIxQ0Q2OUY5QkMxNTY4MzczRUJFRjdENUY1NTdFQTUzNDFCQ0Y4QjFFNEY3MEM3RDI0OUExREYxMzdBOTgaCXNlY3AyNTZrMQ.",
+        "Cgt3b3Jrc3BhY2UgMBAEGAUq7AMKCmNvX3NpZ25lcjUaAjA1QkBDNzY1MUIwMUM0MEZDRTg5NEY5OTQ0OUJDRkFDMTUxNjI0RjU0NjQ5MUFBQkU0MTExN0U2NTA1NkQ0QTZFMjQ2So8BCkAzQzM2MzVBQjJBMjMyNUY5MjFBRjk3RkM4RTZBMTIzQ0QzNEYwQURDQ0ZBNkMyMjhFQ0ZCRUU1RjQ5MTZEODFFEkAwNTg0MTVGMTQ2MDcyNUFCNkMzMTc5NjZBOUZGMjVDNDRGNjY4OURENTExNTg0QTdBNEJEMEMyNTY2QzJFQjExGglzZWNwMjU2azFSQDU1N0IzMDk3RUFFOTBCMDAzNTczRUMzNjc4NkRFRUVEQkU0Q0MyQzNCMzBEMTlENEI5NzJFQUE5MkFDM0VGMUNSQDQ2OUY1QzFEMUEzRjhGRTk0NEY1RjlFMDU2N0U2OERGRkNEODlBNzNCODhGRkE4MjdDQTNGODhGODI4NERFRTFSQDU1ODlFN0YyQjJCM0MyRTZDRTE5QkJDRTFERkFGQTcxQzY5RTUwRTEzQTVDMDZCQzJEODFFQjg3N0ZGNUEwNzFSQDdDQTlGOEQ4Q0JFQUIzNzEzODYxNjRDOEVBQ0EwMjc5QUEzN0M1MEJEMUI4RUMyRjQ3RkJEMjE2NjczRkVBQ0IyUgoKY29fc2lnbmVyMRoCMDFSQENFNDlGMjZCQkE5RkFDRkM2RDRCNDM2NEVFMzBGNkExNEU0NTExQjUzRTQ2RDIzMjFGQTdFOUZFOUUwQzU2OUMyUgoKY29fc2lnbmVyMhoCMDJSQDU4NDk5QjQ2MkE3RkRFNDU2NUIwOUU4MkUwRUFCMkJGNDUzM0FCODFEQzMyMzc2QUZEQTM2RjE3OEU5QjU2MTAyUgoKY29fc2lnbmVyMxoCMDNSQEI1NUE2RjkyQkYwQ0EwQ0UxNDdDQTA5NDY1NUJEOEM3OUYxMjA4MzczOEQ2NzgwNkI2MjdFRkQ0QUQ2NzFCQUEyUgoKY29fc2lnbmVyNBoCMDRSQDk3NjQyNzJFQkJBQzY5RDFGQkM3NEY4QjU1QTA4ODU5NzhEMUZCQ0FFOThEODBDOTY5ODcxMzQ2RTQ0MDlGNDI6jwEKQDU5MzRCOUNBRDNBQkU3NkM5MDEyMEI4MkM3ODkwNkQ0QjBGODMwOTk1NDM5QjhEMzFCOTFBMzQ2N0RDQjZGQzESQEFDRUIxQ0Q2OUY5QkMxNTY4MzczRUJFRjdENUY1NTdFQTUzNDFCQ0Y4QjFFNEY3MEM3RDI0OUExREYxMzdBOTgaCXNlY3AyNTZrMQ."
+};
+
+//P256 sign key
+std::string p256_sign_key_base64_arr[N_PARTIES]={
+        "Cgt3b3Jrc3BhY2UgMBAEGAUq5wMKCmNvX3NpZ25lcjEaAjAxQkBGOTVFNUUwOUE1MDdFQ0VCRUU4MTlCNUI5MTk5QzNDOEE4MEUyQzNCRTRBNkNCMzlENkI5RkExNThGQzRBQjBDSooBCkA5QjFFNTdGRDk0NERCQzZFOUY0OUE0NTk3OERCMzA4QTM5NkUxODI1MkYwQTY1RUFBRERFMDE0OEUyOTI5Q0JBEkA2MDJFNTkyN0MwNkE2MzM1QjE5MENDQzZGOTc5N0VERjM5QzZDNEFBQTc5NDk0MDZDM0JEQzY4OUY3MjU2QTA4GgRwMjU2UkA1MzBDRjM1RjUxRjQ3RTRCNUQwN0FFMkVEMzI4MzczNjhGOENFREJFRDk3QTNCOTIzNkYzMkUyOTFEOTY0NDc5UkA2QUZCNjJEQUJFQjlGMTIzM0NFNUFEQUE4OTlCMThENzVBQkVBMTEwQzJEQUU2RDhGNEU2NDk3NDYwOUU1OUJBUkA0MjAxNzREM0VBNUQ5RTQxNTIxQTlGQ0YyNDVFMjBBMzRGQzVCRjE2RTkwQTM2OUExRDNEREVEMDhFRDgzNEQzUkA1NzNBM0IzM0ZBMjg2ODZCNUY1QjkyQjhBMzJBMTFFNzhGMDQ1MUJDRENFNTc3QjJFNzM2OTFBNkY4RDQ2NjM3MlIKCmNvX3NpZ25lcjIaAjAyUkBDQzc5NjBEMDkwRDk2OTQ1RUYxRTU4NjU2N0VEQkFEQzkyODRCRjc5RTM5MjY5QjU3RDExMUYyMDcyNTI0NDgwMlIKCmNvX3NpZ25lcjMaAjAzUkBEMTc4Qzg2NTJBRUI0MUNGQjQzOUYyOTQzMDM1QUZDOTE4QzkzMDFEQ0E3RDkzRDY4MkM0NzJCM0VEM0RBNUY5MlIKCmNvX3NpZ25lcjQaAjA0UkA5OTdBNEFDOUQ2Q0QxMTk5QTk3QkVBMEI3QTJBM0JCNzcxNTM3RERFQTM3QTRENUZFMTlGMUI0QzJFNDlEMEVDMlIKCmNvX3NpZ25lcjUaAjA1UkA5NTAwMjU1QjQ2NkE2NjFFREExN0JDNTYzM0Q1MjRFQzA3QzczNEVDQjkzNDk4MjkzRjk3NjFBMTI5MTVGRjg1OooBCkBDMTQ1RDFDQzYxQzJFMjkyREZERERDNUFGRUUxM0E4QjZCRjQ4NzI4QUVCNzI4MzA1QjgxMDNDNDAwM0FDMTJBEkAxNTFGQUUwM0E3MjkwMkIzMTcyOURBQURDODc0NEY3NzM4REE2NjY1RUZFMjAzRkQ0RDJDQ0VBRjYxNTM4RTlEGgRwMjU2",
+        "Cgt3b3Jrc3BhY2UgMBAEGAUq5wMKCmNvX3NpZ25lcjIaAjAyQkA5MEMyMDUwNDFBRDkzOTU1NkY1NDk3Njc4MTdERjk3ODA1NjU1MjU2QzREMEZCNENCMjdDMEFBMUZBQ0FDQjY1SooBCkBGQTUzRDgyQzVCM0VBNzUzQUI2MDI2MUFBRjkzRkU4OThEMEMyNTBCOEZEN0I3MjU5QjQwOUMzQjlEMEQ5MDFCEkA3RDU0MEMxRDVCNzRBOEFCRjVBQjVBMERERkU0MkVBRDRBNzU0QTQzMzJENUNFOTZGODE4OURGMjI5REZBNzZEGgRwMjU2UkA3OTZDNkQ3MTNFRTRFQUZBOTIxNkFBMzY5NEM1ODNBNjAyRjdEMUJCMEExODJFMjM0NjFERjBGNzU0QkMwMDA3UkAxODRBRDgxN0FFN0E0RUY1MEI1MkMyNzlGMjU4QUU5QTUyQTA2Q0FBRDlDQTkyQThBOTgwQTlEQjM2RDA3Q0ZEUkA2QTgwRkI4Q0E1REJBNTI2NzJGNkQzMUVEM0IwM0NDNjQxRDdGMkYzQTJGQTUyNDBFNjZGQjkyMjQzODVBQzc5UkA2QTMzQzUzQTk5NTlENDBFNTY5MEIzNzE5NDE1ODAzOTFEMDg1NjExNkZCNjc2RDEwOTdGODM3QzBERkQ1QjBCMlIKCmNvX3NpZ25lcjEaAjAxUkBDQzc5NjBEMDkwRDk2OTQ1RUYxRTU4NjU2N0VEQkFEQzkyODRCRjc5RTM5MjY5QjU3RDExMUYyMDcyNTI0NDgwMlIKCmNvX3NpZ25lcjMaAjAzUkAzNzlBMzA5NTQ2RUQ4OTlEOEJGMTc5NjUwNzRFMzQ3REI3ODQ0Q0I1M0E3MzAyMzgxQzZGMEM2ODhDQUZDRTFDMlIKCmNvX3NpZ25lcjQaAjA0UkA3MzQ1OUMxMEJERDQyQTZENUI3NEM2M0ZFRDAyOEY0OEI4Q0RCQkU5MEQzNTQyMDcxMDJENjEzNjdGRkIyODUwMlIKCmNvX3NpZ25lcjUaAjA1UkBDQTc4MTBEOTdDMUQyRkZEREI5QjBGN0FFOTI2MDU0MTM3MjdENDkzMUM1QUJCNUU4QTYxMTE0MDBBMThCN0NCOooBCkBDMTQ1RDFDQzYxQzJFMjkyREZERERDNUFGRUUxM0E4QjZCRjQ4NzI4QUVCNzI4MzA1QjgxMDNDNDAwM0FDMTJBEkAxNTFGQUUwM0E3MjkwMkIzMTcyOURBQURDODc0NEY3NzM4REE2NjY1RUZFMjAzRkQ0RDJDQ0VBRjYxNTM4RTlEGgRwMjU2",
+        "Cgt3b3Jrc3BhY2UgMBAEGAUq5wMKCmNvX3NpZ25lcjMaAjAzQkAzMjlFRDJBMUE0QkJBMDc2QURCODcyMDlFOEI1ODQ5MzUzMzg3RkVDM0YwMjM1QzkyRjM5QjEzNjQzMjdBNkY3SooBCkA2ODI5MjM4RUQwQ0I1MzFCOEJBQUJDMEZGQzczNEM5RkU4QTAxRjQ3MTQ0NzNGMDM3RUVBOUIwMUE1OTVGQzgwEkAzMTE0MDJDOTc2N0M5NUQ4RDVDQkI0QzU3MUVEQkJFNjhFRjU1MjFENTBCMjAwMEFCMkZGMUVEODFFNjJEQzlGGgRwMjU2UkA2NjdENjU4QTZDMzE1MEFDNzc1NDQ0RTlBNjlBOTZGMUJFMEE4RjBEMDdBMkFDRkQ4RERFMjkzRjhDOUY0QzNGUkAxRjRGNTg3RDk4NzMzQUE4ODA5RUI2RUIxNEY1ODVFMzY0RTNFMDBBNjBBODZGOEY3MkVFNjI4RDU1REY1MTFGUkA3ODU5QzdEMjVDQUVDMjBBOEQ3OEE4NUYyNkY5MkRERkVDMkUwQTE0NEM3NzM4RkExNjc3NjZGMTc3OThCNjE0UkAxRTgyMjM4NkM4MkYyNjgyRUU2Mjk3MEQ1QjBGRDNFMzhEOTg0QjgzNDI3Mzk0M0ZCNTU5RkU1QUI3RUQwNDlGMlIKCmNvX3NpZ25lcjEaAjAxUkBEMTc4Qzg2NTJBRUI0MUNGQjQzOUYyOTQzMDM1QUZDOTE4QzkzMDFEQ0E3RDkzRDY4MkM0NzJCM0VEM0RBNUY5MlIKCmNvX3NpZ25lcjIaAjAyUkAzNzlBMzA5NTQ2RUQ4OTlEOEJGMTc5NjUwNzRFMzQ3REI3ODQ0Q0I1M0E3MzAyMzgxQzZGMEM2ODhDQUZDRTFDMlIKCmNvX3NpZ25lcjQaAjA0UkA5ODlBMjU4OUQ0RTkxOEY5MDFBODk2QTFDM0ZFNzcwMEU0QjAxQkU3OENCMTlCMkVDMzc2ODk3OUZBMERBNzJBMlIKCmNvX3NpZ25lcjUaAjA1UkAzNUIxOUQxRUYzRDgwNDUwODBGNjAxOUUyQ0U5Q0Y3MUNFNjMxRkU2NkFBQkExRjQ2RUQyRjcxOTIyNDYxOTdDOooBCkBDMTQ1RDFDQzYxQzJFMjkyREZERERDNUFGRUUxM0E4QjZCRjQ4NzI4QUVCNzI4MzA1QjgxMDNDNDAwM0FDMTJBEkAxNTFGQUUwM0E3MjkwMkIzMTcyOURBQURDODc0NEY3NzM4REE2NjY1RUZFMjAzRkQ0RDJDQ0VBRjYxNTM4RTlEGgRwMjU2",
+        "Cgt3b3Jrc3BhY2UgMBAEGAUq5QMKCmNvX3NpZ25lcjQaAjA0QkBCRTREMkQ3QTI1MzE5ODk2OUE5RTJFMjU4MTcxRjc1ODA0MDMwOEEzQTVBNkQzMDRCMTM2MkE2QTU4MUNCODA1SogBCkBGRDMxRkI3QzBDODc0NEVGQTU1QTU0RkFGMTk2RjQ1MDlGMjE0QUM3NDY2MzA4NjU3MDQyRDgwRTBFRUI2MDM4Ej5BRDc1MDI0Q0YzNjRFRDVGRUE2RjQ5MTIxRDMzMTlEREY2QThFQkRCMDY1RTM3NzM4N0IyNEMwQkRBMzE0NRoEcDI1NlJANTc3OEQ1RjVFQzZGNzM1ODU3NjE0QTNDNTVDQzFCMTQyMThEQkVDN0JBNzAxNkM1QzQ2MTNDN0I5RjcxOUMxOVJAMDhDNEEwODQxN0Y4ODU0NkU4N0RGMzIxMTk1MjUyODI3NkY1QzhGNTZBM0FFRkM2MjlCREE4MTQzQzc1N0JEN1JAMjA0MDVEQjc3ODNBNTZFRTc0MkZFRTQyOUQwNTQ5MjBGODgyMTFEMzQwM0E2MjM0QUNGRjIyODg4Mjc0RjExNlJAN0MzRTE1MTkwN0I3QjQ0M0UzNkZGQzk4QzI5OTQ4NEYyNTFFNDQ5NkQ3RUEyNDVDOEUxMkFBMjAyRjg1QUQ4NTJSCgpjb19zaWduZXIxGgIwMVJAOTk3QTRBQzlENkNEMTE5OUE5N0JFQTBCN0EyQTNCQjc3MTUzN0RERUEzN0E0RDVGRTE5RjFCNEMyRTQ5RDBFQzJSCgpjb19zaWduZXIyGgIwMlJANzM0NTlDMTBCREQ0MkE2RDVCNzRDNjNGRUQwMjhGNDhCOENEQkJFOTBEMzU0MjA3MTAyRDYxMzY3RkZCMjg1MDJSCgpjb19zaWduZXIzGgIwM1JAOTg5QTI1ODlENEU5MThGOTAxQTg5NkExQzNGRTc3MDBFNEIwMUJFNzhDQjE5QjJFQzM3Njg5NzlGQTBEQTcyQTJSCgpjb19zaWduZXI1GgIwNVJARTBEQzJGMzkxMzU4RUQyQkI5OTNDMTEwMzRFMjY0NTFENUEyQjFDQzVFMUY4RTMyQkU0MjFCREM2NkIwQjNGODqKAQpAQzE0NUQxQ0M2MUMyRTI5MkRGREREQzVBRkVFMTNBOEI2QkY0ODcyOEFFQjcyODMwNUI4MTAzQzQwMDNBQzEyQRJAMTUxRkFFMDNBNzI5MDJCMzE3MjlEQUFEQzg3NDRGNzczOERBNjY2NUVGRTIwM0ZENEQyQ0NFQUY2MTUzOEU5RBoEcDI1Ng..",
+        "Cgt3b3Jrc3BhY2UgMBAEGAUq5wMKCmNvX3NpZ25lcjUaAjA1QkAxMzI1N0MyODdFQkQ5N0Y5MjZGNkNFOUQwNUU0RTQwNDUzOEI1MDFCNTVFNDRGQzVDMTg3NTI4RDMzQzIwOERGSooBCkA2RTE3OUI5QjUwQ0QxMENGQkU3ODFEOTU0M0Y4RjA4QkM1QTg1QkYzQjY4QzIwMkUxMkQyODdENTU1MjMwRUJFEkAzM0NCOTkxOERGN0MyOUZGMzA5MjhDODMyRDZDRDMyRjBDRDRGN0M1Mzg3QzNBOENGRDMzNDlFNUNDMjdFQzM1GgRwMjU2UkAzREM1RUEyNzRDNDFGREIzN0FCQzI5OUQ5MEFCMTMwNDc4QzJFMzJGREM0RjIwNzY1ODYwQ0ZGQTMwNDE5OTRFUkA2MDQ0NEI5RUUyQzM1QkVGODUwQTVDMDk1NTEwODUwODFBMUY3RTgxQUNBNDQ0OEQ4MEUxOERDM0ZDMUI1Q0MwUkAxNzJGNzk5ODJCQThERENEOTI5MzZBOTBEMUQ5RkI4RTQwQ0FENDYzMjgzODBEQjRCOTc4RjhCRTZBNTkxNEREUkA2NDlFMUEyMDBCQTEzOEU3RDYyM0M0Nzc3MjQ5MUMwMkIwODQ2RDM1ODYzNTY5RDYzMDJGNzFCQzM3MkIwNjczMlIKCmNvX3NpZ25lcjEaAjAxUkA5NTAwMjU1QjQ2NkE2NjFFREExN0JDNTYzM0Q1MjRFQzA3QzczNEVDQjkzNDk4MjkzRjk3NjFBMTI5MTVGRjg1MlIKCmNvX3NpZ25lcjIaAjAyUkBDQTc4MTBEOTdDMUQyRkZEREI5QjBGN0FFOTI2MDU0MTM3MjdENDkzMUM1QUJCNUU4QTYxMTE0MDBBMThCN0NCMlIKCmNvX3NpZ25lcjMaAjAzUkAzNUIxOUQxRUYzRDgwNDUwODBGNjAxOUUyQ0U5Q0Y3MUNFNjMxRkU2NkFBQkExRjQ2RUQyRjcxOTIyNDYxOTdDMlIKCmNvX3NpZ25lcjQaAjA0UkBFMERDMkYzOTEzNThFRDJCQjk5M0MxMTAzNEUyNjQ1MUQ1QTJCMUNDNUUxRjhFMzJCRTQyMUJEQzY2QjBCM0Y4OooBCkBDMTQ1RDFDQzYxQzJFMjkyREZERERDNUFGRUUxM0E4QjZCRjQ4NzI4QUVCNzI4MzA1QjgxMDNDNDAwM0FDMTJBEkAxNTFGQUUwM0E3MjkwMkIzMTcyOURBQURDODc0NEY3NzM4REE2NjY1RUZFMjAzRkQ0RDJDQ0VBRjYxNTM4RTlEGgRwMjU2"
+};
+
+#ifdef TEST_STARK_CURVE
+//STARK sign key, 2-3 threshold
+std::string stark_sign_key_base64_arr[3]={
+        "Cgt3b3Jrc3BhY2UgMBACGAMqp0YKCmNvX3NpZ25lcjEaAjAxMqckCoAEQzJDRjlDRDkyNTQxM0ZCM0U5QjVBNzUzNjc0RjUwNjk4RUIwQTI2MUJGMTU3OUYyOUJBN0MyNjhEMTc4M0Q3MTI4QThCMjZDMjcxRjI4NUNGNjUxRDZBMTUzQkQ3NzUyQkVGRUU3N0UzN0VFRTI5NUNBNTBDQjVBRTMyRTY3QzkzRUYxNDMwRkIxNzc4MkJBRUE3OENFMTAzM0IzNjIwMENBODE4OURBNDE0NkUwRThDQTFBMzAyRDE5RDc3OTc2QThDRjQwMzVBRTIzMjcxRDQyODZEQTY0NjQ0Q0I3RTFEMzE0MDVDREMzNjk3OTUwMjBGQjJGNjE1NkVCNTAyNjU4NzM0NDlBNzI3MTE3Nzk3NzlEODEyRTU1MTY1Mjc3RDQ3OUEyN0I1NkFBNTY4Njk4QzQyNzE2NkY0MEZBOTFDQTgxMkE3QkRFMUMxOUJBQkRGMkI3MzVFRjJDMEM1M0MzNkI4MUE0QkQ2M0U3ODg4RTgxODlDREI2MDhFRDFCRTY2RUNCRkI3RkI3MUUxMjExMUE5RTE2NTVDM0Q3MEYxQTk0NzlDNUFDNzU3MDc5OTYxMzAxMDVBN0MzOEYyNUFGMDBDMjBBNDIzRTYxNEYzNzU3RTVGMUI3OEM3NzExREZGODhFNUNDNkRBRDkxQTRCODIxMjFDNUJCNTJCREQSgARDMkNGOUNEOTI1NDEzRkIzRTlCNUE3NTM2NzRGNTA2OThFQjBBMjYxQkYxNTc5RjI5QkE3QzI2OEQxNzgzRDcxMjhBOEIyNkMyNzFGMjg1Q0Y2NTFENkExNTNCRDc3NTJCRUZFRTc3RTM3RUVFMjk1Q0E1MENCNUFFMzJFNjdDOTNFRjE0MzBGQjE3NzgyQkFFQTc4Q0UxMDMzQjM2MjAwQ0E4MTg5REE0MTQ2RTBFOENBMUEzMDJEMTlENzc5NzZBOENGNDAzNUFFMjMyNzFENDI4NkRBNjQ2NDRDQjdFMUQzMTQwNUNEQzM2OTc5NTAyMEZCMkY2MTU2RUI1MDI0OThEQTk1RUE5QzlGQ0YxMzlBQjE0MkY2RkQzMjFCOEU3RjZEOTMyQ0ZBRTlGNEI5NUFCRDc5M0VEQjEzOTA3NTc1RTc4MUVBMUNGNDNGMzBCMzNBRkJCQjBDMTY5Mjc3Njc3RTY5ODk5OTREM0UyNjM0OTYxRTcyQkE5NTQ5MTAxRDUwMTM3OEVCOTcxMTQ3Q0FBOUQ4MjUyRkM2MjM4RDM2RjgwMzZBQTFCMUZCMTRCMEI0MTJDRDdEMUIyQ0YxMkRFNjFCRTQ5MTAwNzczMjU4MkQzQTg5QTYxNTAyQUJEMTJFNTMzNEYzNDQ1Mjg5NzQ3MEUyMTIxODdERDg5QxqABDNDRTM0Q0NGNERGRkFCQzAwM0I5ODZBNjE1QTgzOENCOTZFQjI0OTEwNzA0MkQ2QTc3NEQ3NEUwNEUyODNEOUM0NUI0MjYwNTdBN0U5Nzg5M0VDQUYxQUYzNkQ2NzgxMjBCNjlBOUYwMjA2OThBM0Y1QjVENzE2MTE5NEY1ODhFRjg3QUJCRTdGMzUwN0FEOUJBRjdBRDc1RDZDRTA1OUYwOUEwQkI2NTdGQzRDMzMwNUMxNDVDQzFEQkNEQkNFMTcxQTFGMDYyREU1QThCNTY0NEQ0ODRENENEMTM5MUE4NkI1N0QzNEE5ODg3Mjg3NzdFRTJFODg0OTg3MTJCQzdFODc1NEMzOEM0MURDNzdCQjU4NDZFNzRDMkZGMDcwOUIzMTlFRDEzQjM0NzMzREIyRTA3RTFGOEI4QTMzQjZFNjA0MDEzNzI5QzJGMUQyNDM1NjkxQTNGMzYwQ0U2MTdBQ0E0NjkyOUM5QTgzQ0QwQ0JBRjcxMjczMTE2OERDMjUyMTYyNjhGQUMyNUU1QkM1MTI5NzU2MTQ5MzlFRkY2MDFEQTBBQkEyNzJBODRFNzc1NEFGQTNGQzExMERFNDNEOEFFRDg0MEEyNjc4RjVFMzlGMEUxNjY3NkNCQkQwNzE2QjJDRTY4ODM3RDM3QzFCQ0IzQzIzOEJGQkQ1RkNBIoACRUU2RDg0OUI2MjQ3OTA4QzY3M0ZBRTUzMDQ2OTY3ODU2MDQ1NjMzRkM3QTk2QUJCNjU3Q0REMTZDOTRFOURBMzkwNDA4QkZFMkY4NUYxNEIxM0ZFQ0VEMkMzMEUxN0IzRjBDMTk2NDU3NjQ0ODU4MTg1MjFFQzI0RjI3QTNGMzY0QUNGMTQzOTMyQ0YwMkQ0MDA0ODcwNzBEMjE4RjhFNTFBMTk3RERENzI4QkVBMDA2QTlFQ0Y1RUVCNTdERDdEQzI3QzA5M0ZBMUQ0OUY4NjQ4MkM1QTMxOTc1QTAwQUEzQjY2Qzg1NkIwRDgxQ0E5N0UwOTcxM0I1ODIzOTk2QiqAAkQxMkIyQTE0NzM4OUI3RDk3NUFDOEZFNDUzN0FDRjYzRjRDNkFDMEU5NDE2RjcxMUQ4ODlEMEMwQ0FERUNDNzhDNDU5MUM5MzkxQTFFOTNFRjZCOEVDQTgyMDA3NjIyODZCMkI4MUQ1QUREMjIzRTBENEM5N0YzNjA4Rjk2NEQ1N0U0RkE0NDk2MTUxMDlGNjQ2Mjg1NTgwNTNFNEJBOUNDOTgyRjg3RDk4Mzc4QjY0N0FDMDFFRDkzRjUwODRCNkJFOUU5Q0U2MEY2OTRBOTY5NkZFNTEzNjdBMUQ3M0JCRDM2MzcyRDEyMkJFNjlFNzU5MDdCRUNFRUIxM0I5RDcygARERTBGRDE2QjFCQkY1RDYwMUNGRjA3ODg4MDU0QkI0NTJEQ0Y2QTA2NDA3Q0JDOUU3QjhFRjkxMzIwMkRBQkYwNDZFNUJGMUNDMUZCQTUxMzAyRTIzOTI4Q0IwREFBRjA3QjY4MDVFRTI1NzhENEEyODIzMEUxMzFCNEE1NDk1NTU1QkQ1RTFFMURERDI4Qzc5MDgwMUM4Njc3MEMzMDA4ODJCNUQ1NEY0RjEwRUNDNEI4RUFDOUYxM0ZFNTQ0RjhENzM3REVDOUNGRkIwMEJBQURDQjRDQzA0RTJCRDM1ODdDNzg3RjBFOTUwRkRBQTZERTQzRTAzNEUwQjc1RjNFNDFCQjY3ODcwM0RENTc2REJFQzBBQUZBODMyMDE1ODE2MUMwMzA1NzIyMzNBQjdERThEREI2MzI2MDA1NUI5QThBQzM2Q0I4RjI0QzU5QzNCRkVGMUJGRUZCRjA0NjU4NkUyRDgzQUQxRThCQTBBRUYzQzc5Q0FFMUM1NDZBRkJENDVFRkI4ODY3RERERDkxRkEwRDI5MTZFRDAxNUE3NTk1NDI5RkNFQTI3MTk2MDFCRDlFMTE2QUM0NkE3MEI3NzU5MEJCMjk4RTg2RDlBQUE1RDUxMDJCOUMzQTY0MzJDRjg1QkE1QkMwMjRBNjVENDlCN0FCQkVERjMzMTJCOTqABEFBRTc4MUZDOEU3MDY2MDA0NzJFNjRDNUQzQjE5M0UyQzgzQjEzQUE0QkNEMzQyMzIxNjY1RDFGRjhFQjc0MzUyRTdFRERBREQyQ0Q1NUY1RDVBNTZFRDIyQTNFRTA4Q0RDMEU2MDcxRjNCMUEzNkUzQjEzNDFDQjFCRTdFOUE2NzYyNjlCRDg3QUI3ODM2QkJBOTVENkE3ODJBNTY0QTNCODdENUU0RDU4MTM2MEEwRjIwNTJGQkU0NUI1NEEzRThEMTRFRjI3MTQxQ0QxRkIwRkNDRDIxRDIwMzcxQ0E3NzE3RjA1NDU3M0YwNkYwMUU5MTkyMTM5RTc0N0Y5RUJENTUxODJCRDQyRjIxRTNGRTk1REMwMjZFNUYxMzAyMkMyNDUzNzUyRUFDQzhBQjkyODE5RUIwN0NBM0Q1N0M1MjUyQjdFRTE4RTk5Q0YzNUM2RjE2RUM1NkQxNzU2QjE0NTZEMDhGNUE0ODY0RTY1RjRDNzJBMjUwOUEwQkE5QjI3QUY0QzY2QzFDRjlGRUFERTQ0Rjk4MEJDRTlCQzlDRDRDNjA3M0I5RkRCMDZDMTMyMjY3ODRDRUEyODE1NjAyRTQxM0U1MTMwMjRFQzJBNzdFMkU3MUZGMTdFQTUzNUU1MEY5NERENDAyQzFFN0UxQjM5NzJCOUQ2RDI3MjkxQoACRUU2RDg0OUI2MjQ3OTA4QzY3M0ZBRTUzMDQ2OTY3ODU2MDQ1NjMzRkM3QTk2QUJCNjU3Q0REMTZDOTRFOURBMzkwNDA4QkZFMkY4NUYxNEIxM0ZFQ0VEMkMzMEUxN0IzRjBDMTk2NDU3NjQ0ODU4MTg1MjFFQzI0RjI3QTNGMzY0QUNGMTQzOTMyQ0YwMkQ0MDA0ODcwNzBEMjE4RjhFNTFBMTk3RERENzI4QkVBMDA2QTlFQ0Y1RUVCNTdERDdEQzI3QzA5M0ZBMUQ0OUY4NjQ4MkM1QTMxOTc1QTAwQUEzQjY2Qzg1NkIwRDgxQ0E5N0UwOTcxM0I1ODIzOTk2QUqAAkQxMkIyQTE0NzM4OUI3RDk3NUFDOEZFNDUzN0FDRjYzRjRDNkFDMEU5NDE2RjcxMUQ4ODlEMEMwQ0FERUNDNzhDNDU5MUM5MzkxQTFFOTNFRjZCOEVDQTgyMDA3NjIyODZCMkI4MUQ1QUREMjIzRTBENEM5N0YzNjA4Rjk2NEQ1N0U0RkE0NDk2MTUxMDlGNjQ2Mjg1NTgwNTNFNEJBOUNDOTgyRjg3RDk4Mzc4QjY0N0FDMDFFRDkzRjUwODRCNkJFOUU5Q0U2MEY2OTRBOTY5NkZFNTEzNjdBMUQ3M0JCRDM2MzcyRDEyMkJFNjlFNzU5MDdCRUNFRUIxM0I5RDZSgAJEQ0RFQzY2Rjk2QURDOTU0M0U3MDE4RjNCQzVFNzVEQzExQkI5N0ZEOTcyMzIyMTdGNDA3MEQ1RkQwMjlCRDdFMjk3Q0ZBMUU0RTVGNzE5MjcxNDI2QUM3MjMzMDBDNUExMkJDQzRFNTQ0M0IxMTBCRTk0NUNDMjlGRTBGNDI2MzI2NDBEOEU3M0JDNTQxQTNGMkFBNDQyOUUxRUQxODI2QTk5NUREQTkxNjg0QzU1NzA5ODlERjk5MkUxMUFFQUM2M0ZFRTUxMUMzNkZFMUEzRTU1NTAyNjQ5RThEMzNCNTdDOURFRjAyODZDMzhEMTMxQzUwNzMxNjE1MzQzQzdBWoACMEY2NzI5MUI2NkQ5MDFDOUJDQjFGNjAwQTlBQTBBQzE2MUI0NjgwNDE0M0YzQzNEOTIxQjdFMDhDMUIzRUM3NDU2Q0Q2MjdDRTBFM0Q5NDAzRUQxNEY3RThFMjIxN0Q4OEM0NTY2NTIyMDlBOEM2QzE2NkYyM0ZCNUJBQURBOTg2RjFBQUQ2REM2NzkzRTdGMDMxNDY4QkNGNDBFNTVDOTczOUYyRTJCNzEyM0YzNjU5NEI4NUEwRjYyQjNEODY3RTMxRDJCRjg5QThCMEE0NTkwNUE1QUZBQzUwNUY4QzFBNjg4QkExODgyODQ5ODZGMUU2MDM4RjY1NzE2NjFCMmKAAjExOEVCRTJCQ0I5OUM3MzgyOENGOTU1RjQ4MEFGMUE5NEU4OUNCNDIzMDg2NDhBMzcxNzVDRkI2RjkyNEUwMjU2NkMzOTFERkUxMjY3RkI4QTJCQzY0MEI5RkRFMEI1OURFMDREMTYwMzIwOTc0NzU5QkRDMUZGQUY0NkFGQ0QzMjQ4RTNCNTFGNzA5QzEzMDBEOUUyQzQ2RjAyQkUwQkU3MDgzQTAzNDVDMDcyNEE5NjExNEVGQzVCRDQ2MkVEMTVFN0QyNDJEREU2NEJERTI2MkQ3NTdDQ0Y4Q0NDQ0Y0QkVDOEQ5NTQyQTE0OEY5NjYxQjhGRTI1NDJFRjVDRjFqgAJDMUM0MDBGOTBDQjBCNjBGQjhGQTk5RTNBOUQwQzRBMjkzMTI0NDBBN0ZEN0JBRDQ0NjZFNTJCODA5MkFFMDA0NkQ4QkJBMTZCMEJFMEZGRUI3RTc5RDI5OTFFNTRBNEZERUU2MUI4MzhEMzc5Nzc0QkU1QTVCM0FBRDRFOEEzRDBGMzRGNkRCOUFEN0NCNzc0MzEzRUNDMzVGRDY2NEQzNTVFM0NBNTIyNzEzOTdGRUU2MDdDNEM5REM5Q0FDNEVEQjgxNzBFRDc0REU0MDUxMDZBM0Y2M0JCNTE3N0FGQTJDREFCOEI4QTAzOUQxNzgzQUE3ODVEODkzRkQ1ODI1OoYICoAEQzJDRjlDRDkyNTQxM0ZCM0U5QjVBNzUzNjc0RjUwNjk4RUIwQTI2MUJGMTU3OUYyOUJBN0MyNjhEMTc4M0Q3MTI4QThCMjZDMjcxRjI4NUNGNjUxRDZBMTUzQkQ3NzUyQkVGRUU3N0UzN0VFRTI5NUNBNTBDQjVBRTMyRTY3QzkzRUYxNDMwRkIxNzc4MkJBRUE3OENFMTAzM0IzNjIwMENBODE4OURBNDE0NkUwRThDQTFBMzAyRDE5RDc3OTc2QThDRjQwMzVBRTIzMjcxRDQyODZEQTY0NjQ0Q0I3RTFEMzE0MDVDREMzNjk3OTUwMjBGQjJGNjE1NkVCNTAyNjU4NzM0NDlBNzI3MTE3Nzk3NzlEODEyRTU1MTY1Mjc3RDQ3OUEyN0I1NkFBNTY4Njk4QzQyNzE2NkY0MEZBOTFDQTgxMkE3QkRFMUMxOUJBQkRGMkI3MzVFRjJDMEM1M0MzNkI4MUE0QkQ2M0U3ODg4RTgxODlDREI2MDhFRDFCRTY2RUNCRkI3RkI3MUUxMjExMUE5RTE2NTVDM0Q3MEYxQTk0NzlDNUFDNzU3MDc5OTYxMzAxMDVBN0MzOEYyNUFGMDBDMjBBNDIzRTYxNEYzNzU3RTVGMUI3OEM3NzExREZGODhFNUNDNkRBRDkxQTRCODIxMjFDNUJCNTJCREQSgARDMkNGOUNEOTI1NDEzRkIzRTlCNUE3NTM2NzRGNTA2OThFQjBBMjYxQkYxNTc5RjI5QkE3QzI2OEQxNzgzRDcxMjhBOEIyNkMyNzFGMjg1Q0Y2NTFENkExNTNCRDc3NTJCRUZFRTc3RTM3RUVFMjk1Q0E1MENCNUFFMzJFNjdDOTNFRjE0MzBGQjE3NzgyQkFFQTc4Q0UxMDMzQjM2MjAwQ0E4MTg5REE0MTQ2RTBFOENBMUEzMDJEMTlENzc5NzZBOENGNDAzNUFFMjMyNzFENDI4NkRBNjQ2NDRDQjdFMUQzMTQwNUNEQzM2OTc5NTAyMEZCMkY2MTU2RUI1MDI2NTg3MzQ0OUE3MjcxMTc3OTc3OUQ4MTJFNTUxNjUyNzdENDc5QTI3QjU2QUE1Njg2OThDNDI3MTY2RjQwRkE5MUNBODEyQTdCREUxQzE5QkFCREYyQjczNUVGMkMwQzUzQzM2QjgxQTRCRDYzRTc4ODhFODE4OUNEQjYwOEVEMUJFNjZFQ0JGQjdGQjcxRTEyMTExQTlFMTY1NUMzRDcwRjFBOTQ3OUM1QUM3NTcwNzk5NjEzMDEwNUE3QzM4RjI1QUYwMEMyMEE0MjNFNjE0RjM3NTdFNUYxQjc4Qzc3MTFERkY4OEU1Q0M2REFEOTFBNEI4MjEyMUM1QkI1MkJERUI-RTNGMjI1RDVEQjRCNTdEQzZCNTZDQzQzNEQxNUFCQkNENTdFOEIyNEYzOUI0MDJDMDMwQjZGQzM2NTc4NDBKiwEKQDAyMjYyOERBRTQwMTNDQTAzOEI4MkIzN0U4QzdENDMzQUJDNDIyOUYyNjJBMUI2NkI0RDRGNkVGN0RENkNDRUQSQDA1QTdFRkZCQjZCMjY3NDg0RTU2RDI3MjU2RUNCRDYzQTdBRkQ4MUJBRTEyNzg2REJGM0YwN0Q4NDA4RkY3QzQaBXN0YXJrUoAEQjhFNEQ0MDk5OUUwNDVENDZENzk5NTU2M0Y4QTlBMEE5RkQ0NEE0MjNEODE2MkQ4NkU3ODJGODRERTVDNEY4RUE3MUJEMjYzMjVBNTQyMDc2MTY1ODNFQ0E5MUMyRTVFM0E0RTM0MDRBNUIyOEEzRkVCMjM0QTMxRDEyRjE0NzJBMjdFMERGMjlCNEI0MzE1MUVEOUI3Q0FGMDQ5MEM1MUNFRkY2M0VBRDlGQzExM0E2QURDMEJDMDBFMTlCQjdCMjM4QTg0ODMxNTk0RjI5ODZCMEJEQzkwQjE2QzYxNjYwNjA5RTg4ODgzODFFMjIzOUVGRjAwNjFEQzg5QTZGMjI0NEJERjlEQTY1NTU4RDgwMDcyNDI5NTc1QzFGNjhBQUY0OEU3MzhENjgwQzQzNzg1NDFDMjYyMUQ1REE3OTNGRUQxOUUzRjE3QjAyRkFEODc5MTZBOUQ0MkNCRTFEQjQ1MDI1Q0RFRUZCMkEzQzJGQTk1MzQ5NzUwNkJFNjQ4QjMyNTY4MTNDRTk5QTVGRTZBNjU3M0FDMzhBREMyNEQzN0U5OUUxQTA5OEQxMkQzODg5RDk0MzRCQkRCM0IzMDA1ODQyNzZFMEIyMkUwRDI1NTdERjlGMzhCNUNENkNDQzFFRkRGMEU4QzUxQ0Q5QjdDOTlCQkJGOTY5M0VDRTFagAI2MzMyMTgxNjI3RjhDRTA0MTFGNDg0MDIzMjQ3MTk1MjQ3RDBDOUEzMTBCNjQ4MkJFNzkyNjRGQzE1MzIwNjJBREE4QTUyRTg0REY3MzhFMUYxQTIyODIxNEZBNUY4NUU3MjFDN0QxMjNFNjFBNjMxOUZBMzg2MkRDQUU4QjBEOUZGRTM2MEY3ODJCMjBDN0U1MkY1QjU5RjhEQjQ5NzFENDcxMTMyOEIwQUU2MDQ0ODZCNjA5NzI1M0VCMEQ1OEMyMDMzOTc0OEY3NTdDQkJCQTU4MzQxODhFRDFFOTMxQThBOEFDREM2MTVGRjkyNzFFMzU2OUM4NjA4Nzg0RTJGYoACNzc0QUEzNzIyRTBBNjI4MUVFNUVEOEVDRjkxNTUzQUQ4RUY5OEJFOTRBRDk5NjI3NTdFQTUxMTY1OEQ5MTk0MkI2MjE0MkM1QkVDMDUxMTlFODI3Qjg3NUUxNEEyNEU3Q0FCMzYxMjUzNERBRDM1QTlBMTU2NEJCMjAxOUJEM0JFNDhDRjNFRjNEMzc3ODI4QzA2NzE3OTRDRjUzNThGODBEQ0VEREQyMTIwNTFGOTUzOUE2RTU0NDQ5OEQxRkQxQzkwODM2MUZGMjE1RjlCQzlFQzEyRjZFNjgxMTVBMDVCN0VBRDhCQkMzRTg0MzZDRjA0NkYxNzJDODVCRkY1RmqABDhCMUYxMjY5QzU5MTA5RTJDOUE2RjEwMUU1OEJCNzBGQkQwQzk3QzEyQjU5NUJFMDZFQUUwRDUwREY1OUVDRjQxQ0YxRkY5MEU4NUUxRjdDMUU4REYwRjk0NzE4MEFGRDNEOTdEMjA0MEIxQ0QyNkU0NjMwRTNDQUI1OTVBM0UzOURCMUJDNjdDODQ4QkQ1REQyQTMwNTlFQzVFMDZCNTBCQkNBQ0JGMzYxQzdFMDYxMUFENzA3MTI5NzEwNjA0NUMwNjFBRDM1MjNDQjVDNzU4RTRFMjc3NjhEMURFNzk4QTAxRjM5NUQ5QTVENzBBN0U5QTE3MUZFREU1OUY0MEEwMUJFQTNBMDI1NzUwREVBMEJERUZFODk5Qjg1M0E1OTFGNUU0OTg4RTI5MDU1MjYzOUE5RjlFMDAzQTQwMjBCNjk3NzQyREU1MjkwMEZCMjMwNzhDNUYxQjRCNjQ1RTMyNUJCOTBFNkFDMTQwQ0Q2MTA0ODY0RTgxOTI5MDVCMDM0NzRBMjVCN0M5OTQ0OThFMTU5RDA0NTU1NzNCQzI5MUUwOEJERjEyQTFCM0RDMDJBMTdCNTA0OTc5NzdGQkQzQTdEMURCQzZGRjdDQTNCRTZDOTZEREMzQzQxMzUwQ0MxNEI4OTAwMDdGQTg0OTRCREFBOTVCOEFCREUxMDg3coAEN0NDNTU4RUIzNEFFMzk1QkE0MkZGNzk1QzlFMkI5NDUzNTc2ODg3MTQzNThGRUU0QzVDMEQ5QkY0NEY2QUVBNjVBOENCRTFCQkYyREFBQzgzMDMxMzgxQUJDNDM2RTAzNUY3QjcxNEVCOTk2NEQzMkQ1NEEzMzk2MDI2MUNBMUVFRjJDRjAwODZFREMxNkRBOUUzRjFDQkM0M0Q0RTBBMjYxMTMwOEY2RjRDMTM3MjQzMEI2QTMzRDgzRTQ5RDhGMUJBNDE2MkRCQTM0QjBFNTdCMzM1REM2NzA0ODQyQjU1ODYxNzA1NzUxNjM1N0M5QkY0OEMyMDUyOTRBMjI5MEUxQzQ5RjM0NjZCNUFCNTg3OTE3M0QwNTdEOTFFMjE5NjkyMzkwM0RCNzYzNDRGQjNBRDY0QUEwQjlBMzgwQzY1RTYwNTdGNjNCNEE4QkUwNzQ1MjlFNjJFQkQ0QkM0RDA2NjE1NjVDQUJCMEYyNTQ5Q0FFQTUzNDBBQ0Q2QkZFM0U3NTZGNjQ4QjI0MDQ1RURFODlCRDU1QjAyQkQxREYxN0VBQ0RCMTc5RkQ1OUVDNTk0RUI1NjQ1QzRFRTdDOUQyMjlGMjU0QjQ3RTk2ODY0MkY0NDA2OEIwREM5ODkwMjM3NTJEMkZFMkNCNjk0RTcwNEJCODI0RDczOTdGNTB6gAQ1NjBFMkQ0Mjc0QUNBNkZGMjY3OTM1RUU5MEM1OUU2RkI3MTM4QUE0MTUzMjU0NzU5OTJDRjgyN0VGODhGQTRDQzAxQTQ0RUFEOTg1MUVCOTRGMUI4MTc3NTFFRTJBRDgzRTlCMDU2QkQzRkJFODRGQzhFRTI2Q0JCOTY0RUMwNUU2QzQ5NjIyNTkwQzExRDczRTkyNkUwNzc1MjFGNzQ2NkJDNDRCNUEzNDMyOTRFQzVBMTI3NkQ2QTA3RjQ4QkFGNUVBMDhFREVDMEM0QUJFRjZDQzVFOUNGNTM0NUY2NDY5OENENzBDODU0ODgyNjM2MTdEOEI0QTg4RDI5MERGNjRGQzk2RThBMUYyMEVDODNCQ0ZGMDc1MDY4RENEMEIzRUVFRTExMjA0ODcyOUVEQjBEQjc2QzIzN0I1NTA3MkYwOTlDMjhENTZGMTVEOTU2Qjk3RkUwMDBFOEI1MDRFMUMyMTZENEM0OTcxMUE5MkZGQzcwMkY4QTFFNkY5NjUwNTQ5OEY0Q0Y4Nzc3M0M4QTk3RUMxNkJFQzczODU4MDY4NzQxNzVBNEExNTVDNDg2RDA5M0ZGMDU4ODhGRjk1QTFBNEFENTMzOUM1Rjg3QUJCMDU1MzhCREJFMkZCMTBCQURGRjk2QTlBMzBBQzgxNDU0RDEwNzBDNjVENDdBQYIBgAQyQzkzQUI0ODc5NDVFQ0E0QkVEODJBNjIzNEZEM0Q4NzU4MDk5NjA3OUMxQUVDQTc2ODc4MjNFNUUwOENBRTYyMzJBNTFEOTg5N0I2NjJFNzFFNzI4QzQxNTY4OEJBMjExNzc0NzBGNUU0NTY2OUJBOUNCQkU1MjBBMjE2M0VFODJBOUIxMkNDQTY4MzU1NzIzRDJFMkU4QjVBMTQ5QTE5Mzg2QzUxQTk0RjAzNTBEQUYwOUJBQUMyOTI3RUUzNDlCN0E2MDc5MDJBNTIxNjYyMzlENkIzODk0MTZCRjcwMzExNjlENTQ2RTkyN0IwOTc4QkEwMUNFNkJFMzJFNzQ5NjFGMTJGRjg4RTY5OEQxMUNCMzY4RDUyNkYzOTkzQjJFN0E4MzRCMzVDQzYwREY5RkM0MzI4NTFDRjZCNzA1NTQ0QUU0OUY2REQzQzlBODc2Mjk1N0MwQjYwNUYyNEJERjZBM0Q1Mzg0QzdGQUJDNjQ5MjNENUM4QzgyMkUyQ0QzODM2NDVGQzkwNzAzRjY4MUQwQjU2NzE3NTk2MjMyQzFEQjk4Mjc0MkEyM0U2MjcxMjdEMEM1OEIyQzY3RTQwNjBCRTg2MUQxNkIzRDk2OUU5NDVBNEVCQUU5RTU4RUI0QTgwMjNENDQ1OUQyMDBCMjZFODFBNTNEQTRGNkNBQTKwFQoKY29fc2lnbmVyMhoCMDI6hggKgAREOTk3RkM5QzE2MzFFRTcxMUYwQTEwRTlEMTAzMkRFQ0ZERjI4QTdDMDNCMUQwMDlGM0M1MUVBQTVFNDk5NTdBODI4QTA4MEIyOUIzMkZGRUE3RjZEQkJCOEFERjJBRTIyMkEzODY3MUVGRjkzNEU4N0UzNjg5QTg5MDRCMjExMkVDNkFEQTQwMjNCMjRFQTNFRjg2RkVCMjAxOEFEMDBCQUJGMkFGMkI3OUVDN0QyOUEzMzU0NjgwNzU5NERGRTgyRUM2RjlFQzM3OTY0RThGMEQyNzg4RkVGQTQ3NjdCQzg4MjVFQ0E0MTRBOEU2MDMxREREMkJBRkJBNTkwODdDQ0ExMjI0ODM3OTlCRjk5QkY2NDJBREY1NTJFRUFERTMwRTY3NkZCMDg3RUU4QzdCNzY1ODRGRjQwOEQwMzM3QzE2OEQyMzgxRjA4QjgzQzE4RUZDQjcwM0YwOEJGQkY5RTZFOTNCQTJCQTA4RTMyNDUyNDg2NDM1NTEwODY1OTBDRkFCNzdENENBMTBDQzVFQzJBOEE1Q0NENUYyMUM0MTM4Mjc5NEYwMjBBNTg4RUZBQzAyMTM1NTZDQzVGRUYyMzc3OERCQTdDNUJEMTRCODk3MDk1ODQxQzI1MjM2NUI5OTA0QTc5MjUxQkExOUFFMzQ3RTVBMEU5MDc5QUI2MRKABEQ5OTdGQzlDMTYzMUVFNzExRjBBMTBFOUQxMDMyREVDRkRGMjhBN0MwM0IxRDAwOUYzQzUxRUFBNUU0OTk1N0E4MjhBMDgwQjI5QjMyRkZFQTdGNkRCQkI4QURGMkFFMjIyQTM4NjcxRUZGOTM0RTg3RTM2ODlBODkwNEIyMTEyRUM2QURBNDAyM0IyNEVBM0VGODZGRUIyMDE4QUQwMEJBQkYyQUYyQjc5RUM3RDI5QTMzNTQ2ODA3NTk0REZFODJFQzZGOUVDMzc5NjRFOEYwRDI3ODhGRUZBNDc2N0JDODgyNUVDQTQxNEE4RTYwMzFEREQyQkFGQkE1OTA4N0NDQTEyMjQ4Mzc5OUJGOTlCRjY0MkFERjU1MkVFQURFMzBFNjc2RkIwODdFRThDN0I3NjU4NEZGNDA4RDAzMzdDMTY4RDIzODFGMDhCODNDMThFRkNCNzAzRjA4QkZCRjlFNkU5M0JBMkJBMDhFMzI0NTI0ODY0MzU1MTA4NjU5MENGQUI3N0Q0Q0ExMENDNUVDMkE4QTVDQ0Q1RjIxQzQxMzgyNzk0RjAyMEE1ODhFRkFDMDIxMzU1NkNDNUZFRjIzNzc4REJBN0M1QkQxNEI4OTcwOTU4NDFDMjUyMzY1Qjk5MDRBNzkyNTFCQTE5QUUzNDdFNUEwRTkwNzlBQjYySosBCkAwM0U3RTZCQ0M0MTQyMDRCM0JFODBFMzc3RTE0MTMzRjA4RTZBNjkyNDU5QUZDMUMyQUQ4M0IyNjQ4MzNERjI2EkAwNTMxNzJFN0I4N0RFQzMwODhFMjFDOTM3OTBEREI1Njc3RDQ4RkQ5NjZBMkI3NzNENzQzMEYyQTEwMzRFNDI3GgVzdGFya1KABEU3QUFDNjkxNDk1NDlCRDVEREVENThERENDMDZGQTBGM0Q5QzQ2NkU5RjI5QzlBRjExMDgyNjE4OUEyNTFEQzM0MDI3MThBQjI1NjRBQzY1MTVDQzdENjc2MDA5RUUzNEQ2OTc5ODg1REMwOEM2MTgzQ0QwRDY1QTk1MDY0ODRENkU5MUM4MzQzOUE2NEM1NkJDQzNCQzNCMjU1OTdFQUQ4RDk0N0U0QTY3RkZDOEJGMjlGMzFEQTQyQ0I0QTkzRjBDODgwNDNENzI0QTM4NjU5NENGMTkzRDBEMEI2MjgyREZENjVFNjJCREM0NkRFODAyMTQxQ0Q5NENCOTEzREVBQzhCM0REMTI4MTIyQzVEMzA0MDAxNDA1NkFDREIyNEVDNzFFMUY2MzNERkM2M0MzRDIxOTZGQTg3QjRGOEQ0MUIzOUJFNTY5QTc1RDA1MzNBREVERDIxNUY3RDZGQTQxRUQ5NjUyNTkwQjhGM0VFMjlCNzJENTQ5QzI3MDc4NjUwMDEwQzc1Njc4MTY1Nzg1MEUxOTNGODEyNDAyNzVDQzcyODI0RTJEM0Q2QjU1RjAzQkMyNTQ2QjU1OTY1QzkyOURFRTIzMDlBRjdGMjJGOTBBRTU5NTg0RDNFQ0U5NDRBNkZFRDM4M0EyMjhEQTNDMTlBNzZBOTI1OUM0MDU5aoAENjJBNkQzRTRDNEQ1ODY4REQzN0U4OUE5OTQ4MTc0NUE1OEEwRDZEQUQ0MThFQkM0MzI1Q0ZERDcwNkEwNkE0RkZBRDFBODMyMTczOTIyMkIwMjdDM0UzNzFCOTY5MTJBNUQ0RDMzRkY2REU4OEM1RTE2NzVCQ0Q0MTdEMjA0QTMyQzY1NTBCNkY4RUZBQTZBMERBNDk1MkZGQkI2NkUyMjVCMkJDM0U4QjBBRkM4MTY2RjZCMzFERjEzOEYzRUM5RTQ3QzU5RUU2QUQ3RjQ3MEZFMDA2NkMyMEIzODkwRTA1RTIxNjFCMzZCOUYwQjA3M0NFMkM3NEFCRjdCMjVBNUU1Q0Q4NDQyNTk1MkU3MTkzNUU5MUEwMzhGQzE0NDI0MTZFN0I1NERBQThFMEQ0OEJEMTE5RjI5RDExNkEyMUFDMDRENzA0RjkwNDE1MEMzQTBBNzAyMzgyRDM5NDY1RDE0OTUzRDVDMkJFNzk4OEVBNDlDMjRDMjIwRTQ4MjlDQ0RCNERGNUFDRkY4NzE1RDZFMzI4M0Q0QjdDRjA0MzZERTg3OTNFOUM5NjFDOTEyQTlDRjBENjFDODgwNzVBMTc0NTUxNkVFQUY5MkU0OEZEODI0QTMzRTcwMjQwQzE4RTQ0Qzc3OEYyOTM0RkE2REU3OTczQkMzN0I3QkEyQkVygAQ3REZCNDI0MzQ1ODk1QTk3MDY0Q0QzNTEwNkNFOTcyMDA0MkFDMDNCNEQxREE4OENFQURERjY2Q0Y2REUyMDQ3ODNBMkNGNkI1RTM3NDNBRDMwNTI1QTM2RUQxNEE0N0Y2NzdFQjYxODVERDEwRUY2ODgwNkZGODY1QTI1NkUyRjBCMDM0RTlBMTk3OTFBQ0Y2MzQxOTY5QjZEQUJCMjg3M0ZBNTQ4NzEzOTQ2MjcwQzA0NUVCN0RGRjQ0RDRBRTU0QjQzOUVGMEREMjY2RUQ3NkQ4RUIzRkNGRkVGODNDNjhBNjIyMjczMDQwNEMwNzVBNDYyNzNFMjQzQ0IxM0YzOUQwMEI2NjBCNDhGMDYzQTA3MjRGNUNENzI2MUExQTFFRDA1QzY3NTM3MTAwNEM1ODlGRDgzOURBNjI1MUQxREM5MDVFNkYyRkU5NDQ1MDU5MDYzQjA0Q0FBODFCNkVFRUZBMzVFNUExMEI2RDE5MTY0OEFCQjZGODdBNEUxREMzRDMxQTcwQjhDODIzQ0JDNUQxMEZFM0Y0OEFBODk4QTc2NTIxNjdBRTBBRTcwNkIzQTk4MEFBNzI4MkE5MzNFRTgyM0ZBNTFFNThBREQ0MUZENDYzQ0EzOTIyRDRFQkVGRTAxOTY2QTYyNTVEQUQ3OTdEMEUxNEM4NzNEQzQwMDKwFQoKY29fc2lnbmVyMxoCMDM6hggKgARCMTJEMDFFMzlGN0MwODkyMjExQTFERkY1RTNEOTYxQkM5MTM5N0M3NjAyMUFCN0VFQkZGMkNFNkFDOEUwREE3RTk2NjQyMjgyOUU1MTBFRTZBMTNERUM0QzIwMUNGRTMxM0M3MkYyOTgzRURBOEM3NjM0RDlBQTQ4MzcxMjRFQ0NCMkRGODEwQzA2MjBBQTlFNTBFRDdFMEJDQURCOThCRDZCREY2OUE4NzYwMUQ5OTRCODA4RUM1MDAzRDE2RUQ4NDgzMjdDOUQxRTc5NkU5MTIwQUNBRTA1ODgzOTgwREFENEU4QTVEMzg0MjA1QTAzMkZBNTlCMzJEMUExODhFNzQwMkU4QjBGRjAwNzNGOUIzMDg5OTgwMUJDNDRBQUFCNjVDM0M5RTBEQTBEQzEzRkRDQzlDNUE5REVGNjA5QTREODI1NUUzM0E0RjcyQzJCNDk4NzYzNkEyRTZERjFDQkE3MEJFNEJBQTg3NzcxODdCOUM2QTIzQzVFRTM4OEUzQ0REMzhFMDYwMDk4OTIwOENGREIxM0NEMjBEOTIyNkE0OTYxOEUwQTg1QzBEMzRCRUFFMDUxQzI0REY0NjdGRkI0RjM5MjEzQjEwRUIyRTA0NUEwMDQ0RjE0RDYyRTY5Q0M2MjhFQzc0MUNENjVGQ0RDNDNCMzQxNUFFN0JGRBKABEIxMkQwMUUzOUY3QzA4OTIyMTFBMURGRjVFM0Q5NjFCQzkxMzk3Qzc2MDIxQUI3RUVCRkYyQ0U2QUM4RTBEQTdFOTY2NDIyODI5RTUxMEVFNkExM0RFQzRDMjAxQ0ZFMzEzQzcyRjI5ODNFREE4Qzc2MzREOUFBNDgzNzEyNEVDQ0IyREY4MTBDMDYyMEFBOUU1MEVEN0UwQkNBREI5OEJENkJERjY5QTg3NjAxRDk5NEI4MDhFQzUwMDNEMTZFRDg0ODMyN0M5RDFFNzk2RTkxMjBBQ0FFMDU4ODM5ODBEQUQ0RThBNUQzODQyMDVBMDMyRkE1OUIzMkQxQTE4OEU3NDAyRThCMEZGMDA3M0Y5QjMwODk5ODAxQkM0NEFBQUI2NUMzQzlFMERBMERDMTNGRENDOUM1QTlERUY2MDlBNEQ4MjU1RTMzQTRGNzJDMkI0OTg3NjM2QTJFNkRGMUNCQTcwQkU0QkFBODc3NzE4N0I5QzZBMjNDNUVFMzg4RTNDREQzOEUwNjAwOTg5MjA4Q0ZEQjEzQ0QyMEQ5MjI2QTQ5NjE4RTBBODVDMEQzNEJFQUUwNTFDMjRERjQ2N0ZGQjRGMzkyMTNCMTBFQjJFMDQ1QTAwNDRGMTRENjJFNjlDQzYyOEVDNzQxQ0Q2NUZDREM0M0IzNDE1QUU3QkZFSosBCkAwNDRGNDEwQjEwNjM2NjY4OERBNjFDNzg2QUUzQjg4MDVFMDBGQzBGNDhDNTkzMTU4NjY4OEQxRTc1NEM5ODJDEkAwNUQxOENDMUQ5OTkxMkQwQTJBQzk2RTIxQjlDMUFBRUMwN0NDNUFCRkQ0RDk2MTIzNkNDNUU0QzAzMDhEODRGGgVzdGFya1KABEMxNDEwODQwNTJCRTRBNDY4RjQyRDQ5RTRGQUU3NjNGRTA3MEFCRDNGNzhFN0QyOUYzRUYwODc5NENFRUMzNTNFQ0U0Q0Y2QkI2MTg2NkQ3RjAzNDkzQzlBNDZDQzAyREQyNzY3QzkxMUIwMDhGQzBEQ0M2MTZBMzZEMDQxQzcyQUQwOEVGMjU0RDhFMkI5QzRCMENFMkEwRjY3QUFCOTg0N0I4MjY0REI2MjUzRkE5MjE1RUMzNzhCNzYwMTlEMUU5OEM5RUFGOUNCRjNCQjdCOTU5NTY5MkE1MkUwOUY3MTM0MjhGRDM0OEU3Q0VENzhFMjU3MzA0NDQyQkQ1MjBDMjI3RDFBMUM4MzIzNEZGQzgzMDBENzlCRkU5OEUyRkY4QTlCNjI2NTIzOUY4NDYwNUZFQjQ2RjdGNzg1MzFCM0MxRTQ1NjU3N0QxQTAwNTcyOTM0RTIxNjhENDZGODM0N0FBQkZDQzE0RkFFN0U4MEZDNjJDOTQ5MzBEOTNCM0JDNEM0RTVDMTQyQzRBMEIyMUZDOUY0RUFFQTk4QTg5RUUxMDNENjNGMzEyRkFFM0NEMjY1QURFRDAzODA5QUE5QUM5MzMxOENFQUVDRUQ4NEZGNEIyMDlBNzIyQzlCQjM4RjcyNTA2N0JCQzFENzQ0MkRFNzU0Q0Q5MEI0N0JEaoAENjQyQkMxQkRDNDU4MjdCMzY4MTFEQzBBQjQxOUJBRTI3RDI5Mjk5MzRDMTg4M0FENEMwRkFBOTRBQUM2QkY4MTM1RjFFOTUwNjM0OTY5NkNFRTFGQzYzQUU1OTY3RDBBQzc0OTYzQzY2OEY3RkRBQTY2N0Y2NjcwNDdBRDhEMTQ5MUVDRDQ4MUU4M0EzNUVBQUNFNDE3OEUwMUIxRDc1OTY0MERDN0ZGRDJFNUEyMDM0RkRFNTE3N0Y1NzBFNTc3RDkzNTRBNTlCM0NCRDI4MTM1RTU4NzUzNkNCNkI4Qzc1NzJCMjg5Nzg2RDQ3QzcyRDFCNEFDNzk1MTQ4NEJENTJEQUY5N0VFMDdCMUZDMEMyMzkwMUU0ODg1MTQ2REQ4ODI0NTkwOTBFMEI3MTNCMTg0Njg5NDYwMjEyRkYxMzkxNjJFRDRGNTgzQzYwNjZBOUI2RTEzQzA3QjNEM0Y4QTc1RTRBMDVGQjM3QzYwNTI1QTZGNUEyQ0Q4MUMwOTY4OEYzOEJFRUJCMDZDMzdFN0Y4ODYzRDY3MzY2OEJBMTQ1MTY1QkY0NzJGREE2MDlERkFGRkQ5QTk5RjU4NDM5QzM5ODE3RDU0Q0Y2OUU3RUUzRTRERkI3M0YxNDMzMDYwNDJCMTM3MTQ2MTQ1MjI1RTFCM0NDRUIzNjNFRDgxMTNygAQxMzJGNUUzM0M5NzYyQjUzNDBDQkNDNkNCNUZFNUEwNDNENjhEOTM1RUFGMEVFNUU0OEM0MDIwQzdCMjUwMDQzMTk1QjMyQzNFRjcyRjZBM0Q4N0YyMzdFNDI5NTY4NEJFNEUyOUE0RUNERTIzNDUzRkI0NUIwRDM3NkIzNjQ2RTE5MTdDQkQyOTU1NDJDQzcwMDUzODdERUMxQTJBQzUzN0ZGRkQyRUU3RUQwOUM2NDEzQjc3NTQxRjNEMjM1QzlFM0JFRkFGM0RFM0M0QjA0QTkzMDJGOTI1OEVGNkM1RTY1MjJERUZCNUE4NzY1QzQxODU3MDg3MzNGQzg1NkZDNzNFNTI1OUE1ODhFRUI0ODMyODE4OTQ5MTM3QUZDN0MzRDFDRTI4MkI4OTM2RDYyQjY1NjFCNzEzQkM2NTExNDAxN0E0NzAwQUMzMURBRjJFRjY0RUY3QkVDMEIwOENCQ0I4OENDRDIzNzBDODkxMzFGMjgxNDRFNzRCQkMwRDlEMDM1NDNERENCMUNBRjczRDNFNUM0M0E1RUU3MTU5NUY4RTYxQTNFODI3Nzc5RDIxQzJBMDJBNTJGMTc5NTdCNTBCRUU2MzBBRjAwQzVFQUU2MjE0ODVENDFEN0ZGRDZFRDgxNkY2NTBEOTUwNDVGRDIzMzdCNEM2OUM2N0VCOTqLAQpAMDJDRjNCRkY4NzlBM0Q0QzFDRjQxMUMwNjNFRkM5NkRBN0U3RDBEQTBEQUQyMjFFQUVFQzdBNDE1QzJFM0UyNxJAMDE2QjAxQkJCMTBDQzA2OTdFQzVGMDIwQ0VEQjg1N0Q3MjkyNzIwQkQ3QjQ5NDA2MjJCM0M2OTk0MTFEMjkzMBoFc3Rhcms.",
+        "Cgt3b3Jrc3BhY2UgMBACGAMqqUYKCmNvX3NpZ25lcjIaAjAyMqckCoAERDk5N0ZDOUMxNjMxRUU3MTFGMEExMEU5RDEwMzJERUNGREYyOEE3QzAzQjFEMDA5RjNDNTFFQUE1RTQ5OTU3QTgyOEEwODBCMjlCMzJGRkVBN0Y2REJCQjhBREYyQUUyMjJBMzg2NzFFRkY5MzRFODdFMzY4OUE4OTA0QjIxMTJFQzZBREE0MDIzQjI0RUEzRUY4NkZFQjIwMThBRDAwQkFCRjJBRjJCNzlFQzdEMjlBMzM1NDY4MDc1OTRERkU4MkVDNkY5RUMzNzk2NEU4RjBEMjc4OEZFRkE0NzY3QkM4ODI1RUNBNDE0QThFNjAzMURERDJCQUZCQTU5MDg3Q0NBMTIyNDgzNzk5QkY5OUJGNjQyQURGNTUyRUVBREUzMEU2NzZGQjA4N0VFOEM3Qjc2NTg0RkY0MDhEMDMzN0MxNjhEMjM4MUYwOEI4M0MxOEVGQ0I3MDNGMDhCRkJGOUU2RTkzQkEyQkEwOEUzMjQ1MjQ4NjQzNTUxMDg2NTkwQ0ZBQjc3RDRDQTEwQ0M1RUMyQThBNUNDRDVGMjFDNDEzODI3OTRGMDIwQTU4OEVGQUMwMjEzNTU2Q0M1RkVGMjM3NzhEQkE3QzVCRDE0Qjg5NzA5NTg0MUMyNTIzNjVCOTkwNEE3OTI1MUJBMTlBRTM0N0U1QTBFOTA3OUFCNjESgAREOTk3RkM5QzE2MzFFRTcxMUYwQTEwRTlEMTAzMkRFQ0ZERjI4QTdDMDNCMUQwMDlGM0M1MUVBQTVFNDk5NTdBODI4QTA4MEIyOUIzMkZGRUE3RjZEQkJCOEFERjJBRTIyMkEzODY3MUVGRjkzNEU4N0UzNjg5QTg5MDRCMjExMkVDNkFEQTQwMjNCMjRFQTNFRjg2RkVCMjAxOEFEMDBCQUJGMkFGMkI3OUVDN0QyOUEzMzU0NjgwNzU5NERGRTgyRUM2RjlFQzM3OTY0RThGMEQyNzg4RkVGQTQ3NjdCQzg4MjVFQ0E0MTRBOEU2MDMxREREMkJBRkJBNTkwODdBRjFDQkYwRDE0MEZDNkJDNjdGN0EyQUI0QzY2REFGNzJENTI0REU5NTMwMEM5MDg0NDA5ODVBMzEwNzI1OUNDMUEzMUIzQzg0RkIxQzIzNDgwNDAxQTNGQjE4QUIzOTQzNDg1NDFEOTVBNTk0NkMxMUI3Q0M0NENFRDhDRkFEMjU3MjY0NTNDQkQ5OEQ2NzUyQUIxOEZEQ0U2QzE4OTQ0MTc5QTUxMzIwQzA2QzZFQjMwNzA4Mzc1MkZDOEU2MkZDRjk3RkUxQzg1Qzc4OEZDNEQ3Q0I3MkZERjlGRTEwOUQ5MEJFNDU4RTlGOTkyNDUwMzNBMTlCM0Q0RDY3QUEwNBqABEM4QjU4RjIxNzMyNDk4QjBCOTFFNkQ3QjczNUEzQjAxNDM5NTQ2MzExQ0I5NDU3N0REQTZBRTAzRTNBQkFENTk2OEUxMzg4OTQxQzdFQUU4Njc2MkY2NjQ0MUI2MjRFOTgyN0FCNzQzQTE4NkQyNDNDQkM2NTBENTg1NkNDQUY3RjlEMEU4RUIxMDIyQTU2MUFDNkRBNzdFOUVFMDJEM0Y0NDc4NzFERjI5MjBENkFDNEEyOEQzQzExMDk3MkE5MTZBQkNBQUI0QzU1NUUyNDVENDc0QUYwMEEzRjdEMzI2NUE4MkY0Q0ZFMTU3N0FEQ0Q5RTI3QjEzMzc0ODg3NDIzNEI4MjdBMjA5RjdGNUI1NzY2NEM3MEE5RjEwQTIyOEMxMTUwRDNEQjc0Qjg1RkFDODBDOUE4OTE2NENBM0YzOUJCNzdDNUNGQTFGNzA3NkE3NDE0Nzc5NjM5MkFCMjZEMzI5NDg5Qjk0QTAzQkNDOUI0RUM3MTczMThDQzIwRTBCRjUwM0E3RTcyNTRDQUQ2NkVDNTZGMTUwQjg3QTE0QzQyMzM3MjA3MkE1ODdEMzRGREFFRUVDOEU4NjAyMDBFNjJCMEM5RDhGNDdCQzY4M0FBRjJDNjE1QTk4RUMwMUZCMTJBQTBFOEI0MjI0NTlEM0IxMUE5RERGRjk5Q0E2IoACRjNBQjlCMkQ5OUY4RTNCMjk0Nzg5REJEODBGNjA3RjE1NTUzMUQ5Mzk4QTBERTZENUNCMzZFQjBFNDY1NEI4MUIzOEM3NDBFOUFERDFFOTBFMjQ5RDBDQTFGRkQ4QjYzNkREREZEQUM2QTU3OEVDNjMyN0JFMURBNkZDMTAwOTY5M0RDMzlBMDhCQjA3MjY5OTA0NDM5NTk5NEI4QTcyODMyNkE2RTJCQ0YyOTRBOEIxNjlCNjdCRjEzMzRFQTYyRTMxNUY0NDhDMDMzQzQ5RTA1Q0Q5MzlFMDlGODY5NkQzNzdDNkJFMkE5RDZGRDUxOTk4RTBBMDUxMDZBQUM3NyqAAkU0OUE5ODg0OUVBNkFBMjJFMjRGRTU4MzBCOEFGNjdFRTNFRjczODdCRjQxMUQ4OUQ5MEM4NzEyMUQ0NTRCMzhCRkU1NzJFRTVBOTI0MUU4QThCMTQyM0VCN0UzMzc1MzMwQjcyMDYwQUExQ0U4NEM2ODAwM0Q4QzA4NzdCN0Q0Qzk2QUVBNjg2NEQyRjJBMjg3NEI2RUE0RDUyMEUwRDc4QzE4MTNBMzkxMEZDRkIxOEU1RTc0NDM1RDAyQjE5MjVBRTMwNTk2QTkxMEMwNTVCOTcwNTFBNUJFNUJCQzUwRDBDOUY2MjEwODQ5RjgwQzY3NEVCNENDMzJBNzU0RTcygARFN0VGM0JBMTNGNEE3MzU4MTg0NTEzNTAyOTY2NTBBQUUxNjVERUZCM0ZCQjdEN0VGMTUyQzk4QkIzMjFFMDdGN0RBNDhDNjMwOTI2ODU4QjU2QjBEMkRCRjgyOEE0QTI3NEMxRjU4RUNCNUIzNTZENkFGQTlBQTlFNDVDQ0IyNzFFNjg1OUNCOUZFRUE5MjMyNEQwODBEOEM5QjdENkNGRDAzMUNCNzQ2QTVFNzQ0MTEyMzdGMEZCOTFFQzhGODQ3QUYwMTg4NzAxQUMxRDlCMTJCNUY2N0I4NjE0RDMwQUQ3QzVFRjhBNUQxMUUyQUYzMEU5NDE3MUE0QzQ4QUJBQjIwNUNFNzNBQTlDNDQ0MzZENTIzMzcyOUMwQkM4MkYwOEExN0M5Q0ZDMzU5MkVGNEY0RjBFN0Y2MDYyOTY3NjhBQjgwQjZEQUEyNEVBQzM4ODk0MTdDOUEzMEU0MzI1MUE5QjhENTQ0MDFFOEQxNjU4MDkyM0FCMjBEMTk5M0YzRDVFQzlFMDVDNENFMkUzODBEMzZCQzE3REI2MkQ5MTU3NEY2OTUyMzVCQzc5MjAwNDJFQzYwRTYyNkI4QkU3NTAyQjE3RkY1QTkwMTJCNzJEODY1RUQzRjlENENCQUIxNUJCQjY5OURDRkE3NzJEOENCNThBQTgyNkJDMUY1MTqABENDMjNCRDA4MTUwNTgwQUNCRDUxQTAyREY2RDQyRjU5RUQwMDUwMzJGNzU5Q0M1QjMyNUNGQTk1Nzc2QkREMjM1MDdERDVGQjQ2M0E3ODRFQTNCNjFENERCMDUyNzY3RThFQUI2RDVERkJBM0VDQzY4QkRFRDE5NUYyNURFQ0I4NEMzNDIxMjBBQjM0QjRCREEwMTlFOENBQzMxQjg0MzBCQzFDM0UyNjVDRkMyOEQyRkUwODJFMDg1NUQxRTM1Mjc2M0ZENDU1RDI5OUM4QzUzN0VCNTI0MUI5MEZBQzlGQzcwNTNDNUVDMjY3QUI0OEQ5NkQ0QjdBQzZEQ0NEMjMyNTNDQUI4OTc3MzBFNTM4MDU2QTk5NDVERjQyOUU4RTg0NjhBMUEwRjMyQkY1QzA3MjQ0RkY0MDUwNzlENjg3MTM1OTcyQjA2Q0IyOEFDNjE4NTgxQzcwMUE2QkJEQTM1RjIyMzY0QUY2Q0UyMjQzMzEwOEFCMTlCQTA5Mzc0Mzc5M0U3RTcxQjc0NzhBQUI2MDUzRkJEQTY0RUUyMkIyQzI2RTE0NTEzRkEzNEFDODY0QzhFREI3RjJGMTFGMUMwNTM4QkJCQjM5Q0I5MTBBMUUwRjhDQ0E3QzFDQkEwQjkwMEEzMzQyQ0NDRUQ0MERCMkRERjJCMjFEOEE2ODcxQoACRjNBQjlCMkQ5OUY4RTNCMjk0Nzg5REJEODBGNjA3RjE1NTUzMUQ5Mzk4QTBERTZENUNCMzZFQjBFNDY1NEI4MUIzOEM3NDBFOUFERDFFOTBFMjQ5RDBDQTFGRkQ4QjYzNkREREZEQUM2QTU3OEVDNjMyN0JFMURBNkZDMTAwOTY5M0RDMzlBMDhCQjA3MjY5OTA0NDM5NTk5NEI4QTcyODMyNkE2RTJCQ0YyOTRBOEIxNjlCNjdCRjEzMzRFQTYyRTMxNUY0NDhDMDMzQzQ5RTA1Q0Q5MzlFMDlGODY5NkQzNzdDNkJFMkE5RDZGRDUxOTk4RTBBMDUxMDZBQUM3NkqAAkU0OUE5ODg0OUVBNkFBMjJFMjRGRTU4MzBCOEFGNjdFRTNFRjczODdCRjQxMUQ4OUQ5MEM4NzEyMUQ0NTRCMzhCRkU1NzJFRTVBOTI0MUU4QThCMTQyM0VCN0UzMzc1MzMwQjcyMDYwQUExQ0U4NEM2ODAwM0Q4QzA4NzdCN0Q0Qzk2QUVBNjg2NEQyRjJBMjg3NEI2RUE0RDUyMEUwRDc4QzE4MTNBMzkxMEZDRkIxOEU1RTc0NDM1RDAyQjE5MjVBRTMwNTk2QTkxMEMwNTVCOTcwNTFBNUJFNUJCQzUwRDBDOUY2MjEwODQ5RjgwQzY3NEVCNENDMzJBNzU0RTZSgAIxM0E5RjJCRjM1QzhGQkE4REZDNEFBNUU3RTk1NUU1RkQwMDBCQ0VFODM2MjUzNjdDMzc5Q0Q2RjNCRkY1ODA5M0QxNUM0RTFBMzhCNEVCNkRFOTlCMUJFRUY0N0Y4QzdDNDZCNzgxMjBDQkJFQjk5QzFEN0Q0QjNDOUEyMUJBODI3NTlBNTcxMDg1ODE4NTk3RkREOUE1OUMwNjI5MzZEMjA3NDA1ODg4MDMwRjNDMDcwNzJFMThFRTc3RURDMDgzOEQ2QzIwQTNGQzVBRjA1RDQ3MkQzODk0MDYwMjBDMEVEMjFFN0M2RDNGM0UwQzhGMjFEMTRBQ0U1RUFCQTZCWoACRDIyN0U3MjhCQzRDRDg4Q0VDNjlDMDAxNjgyNzhEQkY5OTBBNUNBMDgzNDc4NDU1MzQ1MDJBNDJENjFCODVCNjBCQkM0NkFFRjczQTVDODc4REIyODNDOEI1MDE3NkE2MkU0RjQwNzhFQkU2Njc1NDlCRjMxRDUxRTJBQUFCMDlCQThBOTVFRTcyNTE1NzJCNEFFMkQ0Rjg0MTE2OUY2RDgzOUQ4MEY5RkMxRTQzMEZGMjczOUY3RDg1MTZDRUYwQ0ZFRUFBMUEyODczMkIzMDk2NkE0MjgxMEY4ODU5MjgyMjVGQUJBQjY4RTI2RDE5QUMwOEMxOTM0Q0I4Rjk4NWKAAkUwMDFBODZFNjQyRkU4MDlCNEIzRjM1RjAyNjBBOTkxODU1MjYwQTUxNTNFOEIwNTk5MzlBMTQxQTg2NUYzNzg3Njc2QUYyQ0Y3NTFDRkRBMDNCMDFGMEIzMEI1OTI5QkE5NzI4NTlBNUQ5QkEzMkM3MEE0MEQyNkE2MUVFNEVFNkM4Mjk0MkY4MzU4NUExMDEwNjY5RUZGRDQ1NjEzQkIxMUY2NjhBMzRFRjg1NkNBQTYyODg2MzAyQkI2MEU1QUFBM0YzMjNFODA2RTE1OTgzMTVBQzAxNEM5OTg0OEFDNEE1QTg0MUJENUUzMUM4OEE3NzBGNTU4MkE3RkYyMENqgAIxMjcyQjE1QkUyNTlEMTk1RjVFNjI1ODFBMzYzNjhCRjRBRTUxNkU3M0JGOTk5MzRBNEJDNUNDRjQ3MjlDNTgyQjQyOTJDM0Y2MzU3RTU2MTFBRkVCRTc2MDJFMUMwQUQwMjY3REZFN0JFMzY4MEY3Q0MwRDIwM0EyNUNEMENDQjBFRTA1NDc5RjI4MTlCNzczQzY4OTlBQzk0MEE0MTZBMDg3QTkyQTk5NEYxOENBMTlCRUFENEM1RDdFQkUyQTE4QUY0NUI3QzgwOUQ5NTI1MjMwNjBGMjRBRUQzNjMyOEFFNkE0QTc1OUY2NzhBRjJCQjQ1RjMzOEU1RUU1QjYyOoYICoAERDk5N0ZDOUMxNjMxRUU3MTFGMEExMEU5RDEwMzJERUNGREYyOEE3QzAzQjFEMDA5RjNDNTFFQUE1RTQ5OTU3QTgyOEEwODBCMjlCMzJGRkVBN0Y2REJCQjhBREYyQUUyMjJBMzg2NzFFRkY5MzRFODdFMzY4OUE4OTA0QjIxMTJFQzZBREE0MDIzQjI0RUEzRUY4NkZFQjIwMThBRDAwQkFCRjJBRjJCNzlFQzdEMjlBMzM1NDY4MDc1OTRERkU4MkVDNkY5RUMzNzk2NEU4RjBEMjc4OEZFRkE0NzY3QkM4ODI1RUNBNDE0QThFNjAzMURERDJCQUZCQTU5MDg3Q0NBMTIyNDgzNzk5QkY5OUJGNjQyQURGNTUyRUVBREUzMEU2NzZGQjA4N0VFOEM3Qjc2NTg0RkY0MDhEMDMzN0MxNjhEMjM4MUYwOEI4M0MxOEVGQ0I3MDNGMDhCRkJGOUU2RTkzQkEyQkEwOEUzMjQ1MjQ4NjQzNTUxMDg2NTkwQ0ZBQjc3RDRDQTEwQ0M1RUMyQThBNUNDRDVGMjFDNDEzODI3OTRGMDIwQTU4OEVGQUMwMjEzNTU2Q0M1RkVGMjM3NzhEQkE3QzVCRDE0Qjg5NzA5NTg0MUMyNTIzNjVCOTkwNEE3OTI1MUJBMTlBRTM0N0U1QTBFOTA3OUFCNjESgAREOTk3RkM5QzE2MzFFRTcxMUYwQTEwRTlEMTAzMkRFQ0ZERjI4QTdDMDNCMUQwMDlGM0M1MUVBQTVFNDk5NTdBODI4QTA4MEIyOUIzMkZGRUE3RjZEQkJCOEFERjJBRTIyMkEzODY3MUVGRjkzNEU4N0UzNjg5QTg5MDRCMjExMkVDNkFEQTQwMjNCMjRFQTNFRjg2RkVCMjAxOEFEMDBCQUJGMkFGMkI3OUVDN0QyOUEzMzU0NjgwNzU5NERGRTgyRUM2RjlFQzM3OTY0RThGMEQyNzg4RkVGQTQ3NjdCQzg4MjVFQ0E0MTRBOEU2MDMxREREMkJBRkJBNTkwODdDQ0ExMjI0ODM3OTlCRjk5QkY2NDJBREY1NTJFRUFERTMwRTY3NkZCMDg3RUU4QzdCNzY1ODRGRjQwOEQwMzM3QzE2OEQyMzgxRjA4QjgzQzE4RUZDQjcwM0YwOEJGQkY5RTZFOTNCQTJCQTA4RTMyNDUyNDg2NDM1NTEwODY1OTBDRkFCNzdENENBMTBDQzVFQzJBOEE1Q0NENUYyMUM0MTM4Mjc5NEYwMjBBNTg4RUZBQzAyMTM1NTZDQzVGRUYyMzc3OERCQTdDNUJEMTRCODk3MDk1ODQxQzI1MjM2NUI5OTA0QTc5MjUxQkExOUFFMzQ3RTVBMEU5MDc5QUI2MkJAMDI2MEUzRDkxNjQxOUVCRjY2RkZERTc5OEM5MDFDRjRBMjQ1QzI1RDYxMzZBNDI1MDg1NDRGMjVBMDZDQTQxMkqLAQpAMDNFN0U2QkNDNDE0MjA0QjNCRTgwRTM3N0UxNDEzM0YwOEU2QTY5MjQ1OUFGQzFDMkFEODNCMjY0ODMzREYyNhJAMDUzMTcyRTdCODdERUMzMDg4RTIxQzkzNzkwRERCNTY3N0Q0OEZEOTY2QTJCNzczRDc0MzBGMkExMDM0RTQyNxoFc3RhcmtSgARFN0FBQzY5MTQ5NTQ5QkQ1RERFRDU4RERDQzA2RkEwRjNEOUM0NjZFOUYyOUM5QUYxMTA4MjYxODlBMjUxREMzNDAyNzE4QUIyNTY0QUM2NTE1Q0M3RDY3NjAwOUVFMzRENjk3OTg4NURDMDhDNjE4M0NEMEQ2NUE5NTA2NDg0RDZFOTFDODM0MzlBNjRDNTZCQ0MzQkMzQjI1NTk3RUFEOEQ5NDdFNEE2N0ZGQzhCRjI5RjMxREE0MkNCNEE5M0YwQzg4MDQzRDcyNEEzODY1OTRDRjE5M0QwRDBCNjI4MkRGRDY1RTYyQkRDNDZERTgwMjE0MUNEOTRDQjkxM0RFQUM4QjNERDEyODEyMkM1RDMwNDAwMTQwNTZBQ0RCMjRFQzcxRTFGNjMzREZDNjNDM0QyMTk2RkE4N0I0RjhENDFCMzlCRTU2OUE3NUQwNTMzQURFREQyMTVGN0Q2RkE0MUVEOTY1MjU5MEI4RjNFRTI5QjcyRDU0OUMyNzA3ODY1MDAxMEM3NTY3ODE2NTc4NTBFMTkzRjgxMjQwMjc1Q0M3MjgyNEUyRDNENkI1NUYwM0JDMjU0NkI1NTk2NUM5MjlERUUyMzA5QUY3RjIyRjkwQUU1OTU4NEQzRUNFOTQ0QTZGRUQzODNBMjI4REEzQzE5QTc2QTkyNTlDNDA1OVqAAjc4NzM0N0RFNEIxOEU0NjkyNERGNDk3OTk5MUZERkE5NTFGRTg4Q0MzQ0YyNTBFOEQ3ODY5MEVFMTU4NUY2MjRBQ0JDNTZFQUUxM0ZCMEY0QjU4RjRCMDk1MEYzRjdBMzgxMUE3MjZDNzFDMEU1Njg0RTU0OUI5QThCQTdBNDIwQjQ3NDkzMjA2MDI0QUU3Nzk0NTVFMzU0QUY3NUJBQzRCRkMyQTVBN0Q0NDAwMjFBRjYyQTBBMjQ4MzkzREQ5QjE1MzcyNTJFMUM0QUREMzcyQzc0RUQ5REMxQjU5QTkxMDc2NjJBM0ZDODYxMDhENUU5RTcxQ0QyM0IzMDU1MkZigAI3QjE4MDcwNTk1MkZGOUI2MUIzMUZDM0Q2QjA1RjQ5QzVDNjRDNDRFQ0FCMTcxRDVERkMxNTFCRjQ0NzlFREVBODE3QTQ5NDVEMkRENjhFNDRBMEQzRUE1MUIzRkU2MkE4NDcwOTc0NjdBNUMyOTEzQjA2RjgzQjAxQ0I3NTBBRjRCMDk4MDE5QkY0QUVGREU5NkI0MTRCQjgyNTNCNEZDNEM2MzYxMjZCNDI0NUM1RUFGOTAxQjdDMjlDM0JCQzE3NDUyOTdGM0ZGOUNCNTA1MEMwMzA0NDU4MDQzMkZFQ0Y1QzgyNzlFN0Y3RTMxQTVDMTAxRkNBNUI2Mjk4MDIzaoAENjJBNkQzRTRDNEQ1ODY4REQzN0U4OUE5OTQ4MTc0NUE1OEEwRDZEQUQ0MThFQkM0MzI1Q0ZERDcwNkEwNkE0RkZBRDFBODMyMTczOTIyMkIwMjdDM0UzNzFCOTY5MTJBNUQ0RDMzRkY2REU4OEM1RTE2NzVCQ0Q0MTdEMjA0QTMyQzY1NTBCNkY4RUZBQTZBMERBNDk1MkZGQkI2NkUyMjVCMkJDM0U4QjBBRkM4MTY2RjZCMzFERjEzOEYzRUM5RTQ3QzU5RUU2QUQ3RjQ3MEZFMDA2NkMyMEIzODkwRTA1RTIxNjFCMzZCOUYwQjA3M0NFMkM3NEFCRjdCMjVBNUU1Q0Q4NDQyNTk1MkU3MTkzNUU5MUEwMzhGQzE0NDI0MTZFN0I1NERBQThFMEQ0OEJEMTE5RjI5RDExNkEyMUFDMDRENzA0RjkwNDE1MEMzQTBBNzAyMzgyRDM5NDY1RDE0OTUzRDVDMkJFNzk4OEVBNDlDMjRDMjIwRTQ4MjlDQ0RCNERGNUFDRkY4NzE1RDZFMzI4M0Q0QjdDRjA0MzZERTg3OTNFOUM5NjFDOTEyQTlDRjBENjFDODgwNzVBMTc0NTUxNkVFQUY5MkU0OEZEODI0QTMzRTcwMjQwQzE4RTQ0Qzc3OEYyOTM0RkE2REU3OTczQkMzN0I3QkEyQkVygAQ3REZCNDI0MzQ1ODk1QTk3MDY0Q0QzNTEwNkNFOTcyMDA0MkFDMDNCNEQxREE4OENFQURERjY2Q0Y2REUyMDQ3ODNBMkNGNkI1RTM3NDNBRDMwNTI1QTM2RUQxNEE0N0Y2NzdFQjYxODVERDEwRUY2ODgwNkZGODY1QTI1NkUyRjBCMDM0RTlBMTk3OTFBQ0Y2MzQxOTY5QjZEQUJCMjg3M0ZBNTQ4NzEzOTQ2MjcwQzA0NUVCN0RGRjQ0RDRBRTU0QjQzOUVGMEREMjY2RUQ3NkQ4RUIzRkNGRkVGODNDNjhBNjIyMjczMDQwNEMwNzVBNDYyNzNFMjQzQ0IxM0YzOUQwMEI2NjBCNDhGMDYzQTA3MjRGNUNENzI2MUExQTFFRDA1QzY3NTM3MTAwNEM1ODlGRDgzOURBNjI1MUQxREM5MDVFNkYyRkU5NDQ1MDU5MDYzQjA0Q0FBODFCNkVFRUZBMzVFNUExMEI2RDE5MTY0OEFCQjZGODdBNEUxREMzRDMxQTcwQjhDODIzQ0JDNUQxMEZFM0Y0OEFBODk4QTc2NTIxNjdBRTBBRTcwNkIzQTk4MEFBNzI4MkE5MzNFRTgyM0ZBNTFFNThBREQ0MUZENDYzQ0EzOTIyRDRFQkVGRTAxOTY2QTYyNTVEQUQ3OTdEMEUxNEM4NzNEQzQwMHqABDkzQUIyMEY4NzMyRjVGRTY3OThERTYyNDg2QzA5NzA4RDI5MDQwMkZGRTQxMDBFMkRDMDE2NEU2N0RDRjBGMzg5RjBENDNCMzBCMDM0NjcyRjEwNTQwN0JDNjFEQjhCRkE0MUVGQ0UwMDlBQjQ1MTA3NEFBM0Y1QTU0MDA3RjI3QjI1QTUxRUJGMkMzMkM5NDEzOTA1OUZENTI5NDJEQkI4MzBDREYwQzRDMURDMTg1N0RGNDUwMzU5MEY1RUMyOEE4NjQ2OERFQjZDMTk5MkY3OUUxMTNCOUJEQTdEMDBGNDBFQjEyMEM0OEQ3QURBMDFBRTkxOEFDQzY3QzQzRDBENjkxNTQ5NUNGNDg5MjVBNTYzNTQ3MDc4RUI3RUQwMERBMDczMjFBOTc4N0EwRTgyRDEwRDYzNkVDNjZGRTU1M0E2NTU3QTdCRkZCMzg4MzhDNjBENTBEMzEwRDhCMEI4NjkyMzJDNzYwQUYxQzRENkQxRUFBMEZEREE4RjM0NEJERERDQTg0QkI2MUE1RTUwODJEQUE0RUY4RjlDRTdERDExMjRFMEI1Q0I2QTA2OEU1RUY4NUI3M0EwODYwNThGMDlBQkNEMEQ3N0JGOTJGNzgwRTY1NEM4OUM1QzlGNkMxNDdCMjc1NTExRTQ5QTg4NTEwMDYwRTY0MEI4NzM3ggGABDMxOEQzOUVBRjEyNzZDODU1NDFCNjE5QzNDNjc0NkJCMDZFNjUwQzQ0M0M4Mjc1MDI1NUVEOTU2Q0FBNUFEODEyM0VGOTk2QzczREZENEM0MjBGNTdBMjYyNUE3MzYyOUQ3ODhERjlGNjg5NkNENzU5MUM0Nzk3RjczNkFDNDAzREQ1QTRGNDczRUNFQUE5NjIzNzVBRjkxQjMyQzg2NTIyMDAwODc4RjI3Qjk2QTJCMENDNjUxM0M0RDBGOTJFMzBBMERFRDhBRDY2NzI4QTNDMUNCMTZBODM3N0I4MDY2NTM2MjcyMENEQUZGQjVFNUVCQkUyQjcwNTlEMzczRkFDOEExNzlFMTBGMURFNjVDQzM2QTY3NjAyQjJCRDdCN0I5ODYyNTdBMDQ4RThBQjBGNTUyMzI4NjI4ODRDMTg2NzVBRUNCRjEzNDUzNjcwRUI3NkY1RUE0NTMxNkYyRDgxRkI2QjIxRTYxQ0U3MjIzMjdBOTZBMDM4NzI5NzJGRTYzREZGREE3QTkzQzY2OTE4NTdGMzU2QjYyQTQ3NTc1Rjk1QUNERTM5Mjc3NDREMDRDRTkxMTEwRTM4M0VGOTIzMDQwOEE4ODVBNzEyQUVCNzQ1NkU4MzBFRDU0NDY1OTI5REY1MEFBMDE3M0FDQ0EyQzk0MkIxODgxRTgxOEEyMrAVCgpjb19zaWduZXIxGgIwMTqGCAqABEMyQ0Y5Q0Q5MjU0MTNGQjNFOUI1QTc1MzY3NEY1MDY5OEVCMEEyNjFCRjE1NzlGMjlCQTdDMjY4RDE3ODNENzEyOEE4QjI2QzI3MUYyODVDRjY1MUQ2QTE1M0JENzc1MkJFRkVFNzdFMzdFRUUyOTVDQTUwQ0I1QUUzMkU2N0M5M0VGMTQzMEZCMTc3ODJCQUVBNzhDRTEwMzNCMzYyMDBDQTgxODlEQTQxNDZFMEU4Q0ExQTMwMkQxOUQ3Nzk3NkE4Q0Y0MDM1QUUyMzI3MUQ0Mjg2REE2NDY0NENCN0UxRDMxNDA1Q0RDMzY5Nzk1MDIwRkIyRjYxNTZFQjUwMjY1ODczNDQ5QTcyNzExNzc5Nzc5RDgxMkU1NTE2NTI3N0Q0NzlBMjdCNTZBQTU2ODY5OEM0MjcxNjZGNDBGQTkxQ0E4MTJBN0JERTFDMTlCQUJERjJCNzM1RUYyQzBDNTNDMzZCODFBNEJENjNFNzg4OEU4MTg5Q0RCNjA4RUQxQkU2NkVDQkZCN0ZCNzFFMTIxMTFBOUUxNjU1QzNENzBGMUE5NDc5QzVBQzc1NzA3OTk2MTMwMTA1QTdDMzhGMjVBRjAwQzIwQTQyM0U2MTRGMzc1N0U1RjFCNzhDNzcxMURGRjg4RTVDQzZEQUQ5MUE0QjgyMTIxQzVCQjUyQkREEoAEQzJDRjlDRDkyNTQxM0ZCM0U5QjVBNzUzNjc0RjUwNjk4RUIwQTI2MUJGMTU3OUYyOUJBN0MyNjhEMTc4M0Q3MTI4QThCMjZDMjcxRjI4NUNGNjUxRDZBMTUzQkQ3NzUyQkVGRUU3N0UzN0VFRTI5NUNBNTBDQjVBRTMyRTY3QzkzRUYxNDMwRkIxNzc4MkJBRUE3OENFMTAzM0IzNjIwMENBODE4OURBNDE0NkUwRThDQTFBMzAyRDE5RDc3OTc2QThDRjQwMzVBRTIzMjcxRDQyODZEQTY0NjQ0Q0I3RTFEMzE0MDVDREMzNjk3OTUwMjBGQjJGNjE1NkVCNTAyNjU4NzM0NDlBNzI3MTE3Nzk3NzlEODEyRTU1MTY1Mjc3RDQ3OUEyN0I1NkFBNTY4Njk4QzQyNzE2NkY0MEZBOTFDQTgxMkE3QkRFMUMxOUJBQkRGMkI3MzVFRjJDMEM1M0MzNkI4MUE0QkQ2M0U3ODg4RTgxODlDREI2MDhFRDFCRTY2RUNCRkI3RkI3MUUxMjExMUE5RTE2NTVDM0Q3MEYxQTk0NzlDNUFDNzU3MDc5OTYxMzAxMDVBN0MzOEYyNUFGMDBDMjBBNDIzRTYxNEYzNzU3RTVGMUI3OEM3NzExREZGODhFNUNDNkRBRDkxQTRCODIxMjFDNUJCNTJCREVKiwEKQDAyMjYyOERBRTQwMTNDQTAzOEI4MkIzN0U4QzdENDMzQUJDNDIyOUYyNjJBMUI2NkI0RDRGNkVGN0RENkNDRUQSQDA1QTdFRkZCQjZCMjY3NDg0RTU2RDI3MjU2RUNCRDYzQTdBRkQ4MUJBRTEyNzg2REJGM0YwN0Q4NDA4RkY3QzQaBXN0YXJrUoAEQjhFNEQ0MDk5OUUwNDVENDZENzk5NTU2M0Y4QTlBMEE5RkQ0NEE0MjNEODE2MkQ4NkU3ODJGODRERTVDNEY4RUE3MUJEMjYzMjVBNTQyMDc2MTY1ODNFQ0E5MUMyRTVFM0E0RTM0MDRBNUIyOEEzRkVCMjM0QTMxRDEyRjE0NzJBMjdFMERGMjlCNEI0MzE1MUVEOUI3Q0FGMDQ5MEM1MUNFRkY2M0VBRDlGQzExM0E2QURDMEJDMDBFMTlCQjdCMjM4QTg0ODMxNTk0RjI5ODZCMEJEQzkwQjE2QzYxNjYwNjA5RTg4ODgzODFFMjIzOUVGRjAwNjFEQzg5QTZGMjI0NEJERjlEQTY1NTU4RDgwMDcyNDI5NTc1QzFGNjhBQUY0OEU3MzhENjgwQzQzNzg1NDFDMjYyMUQ1REE3OTNGRUQxOUUzRjE3QjAyRkFEODc5MTZBOUQ0MkNCRTFEQjQ1MDI1Q0RFRUZCMkEzQzJGQTk1MzQ5NzUwNkJFNjQ4QjMyNTY4MTNDRTk5QTVGRTZBNjU3M0FDMzhBREMyNEQzN0U5OUUxQTA5OEQxMkQzODg5RDk0MzRCQkRCM0IzMDA1ODQyNzZFMEIyMkUwRDI1NTdERjlGMzhCNUNENkNDQzFFRkRGMEU4QzUxQ0Q5QjdDOTlCQkJGOTY5M0VDRTFqgAQ4QjFGMTI2OUM1OTEwOUUyQzlBNkYxMDFFNThCQjcwRkJEMEM5N0MxMkI1OTVCRTA2RUFFMEQ1MERGNTlFQ0Y0MUNGMUZGOTBFODVFMUY3QzFFOERGMEY5NDcxODBBRkQzRDk3RDIwNDBCMUNEMjZFNDYzMEUzQ0FCNTk1QTNFMzlEQjFCQzY3Qzg0OEJENUREMkEzMDU5RUM1RTA2QjUwQkJDQUNCRjM2MUM3RTA2MTFBRDcwNzEyOTcxMDYwNDVDMDYxQUQzNTIzQ0I1Qzc1OEU0RTI3NzY4RDFERTc5OEEwMUYzOTVEOUE1RDcwQTdFOUExNzFGRURFNTlGNDBBMDFCRUEzQTAyNTc1MERFQTBCREVGRTg5OUI4NTNBNTkxRjVFNDk4OEUyOTA1NTI2MzlBOUY5RTAwM0E0MDIwQjY5Nzc0MkRFNTI5MDBGQjIzMDc4QzVGMUI0QjY0NUUzMjVCQjkwRTZBQzE0MENENjEwNDg2NEU4MTkyOTA1QjAzNDc0QTI1QjdDOTk0NDk4RTE1OUQwNDU1NTczQkMyOTFFMDhCREYxMkExQjNEQzAyQTE3QjUwNDk3OTc3RkJEM0E3RDFEQkM2RkY3Q0EzQkU2Qzk2RERDM0M0MTM1MENDMTRCODkwMDA3RkE4NDk0QkRBQTk1QjhBQkRFMTA4N3KABDdDQzU1OEVCMzRBRTM5NUJBNDJGRjc5NUM5RTJCOTQ1MzU3Njg4NzE0MzU4RkVFNEM1QzBEOUJGNDRGNkFFQTY1QThDQkUxQkJGMkRBQUM4MzAzMTM4MUFCQzQzNkUwMzVGN0I3MTRFQjk5NjREMzJENTRBMzM5NjAyNjFDQTFFRUYyQ0YwMDg2RURDMTZEQTlFM0YxQ0JDNDNENEUwQTI2MTEzMDhGNkY0QzEzNzI0MzBCNkEzM0Q4M0U0OUQ4RjFCQTQxNjJEQkEzNEIwRTU3QjMzNURDNjcwNDg0MkI1NTg2MTcwNTc1MTYzNTdDOUJGNDhDMjA1Mjk0QTIyOTBFMUM0OUYzNDY2QjVBQjU4NzkxNzNEMDU3RDkxRTIxOTY5MjM5MDNEQjc2MzQ0RkIzQUQ2NEFBMEI5QTM4MEM2NUU2MDU3RjYzQjRBOEJFMDc0NTI5RTYyRUJENEJDNEQwNjYxNTY1Q0FCQjBGMjU0OUNBRUE1MzQwQUNENkJGRTNFNzU2RjY0OEIyNDA0NUVERTg5QkQ1NUIwMkJEMURGMTdFQUNEQjE3OUZENTlFQzU5NEVCNTY0NUM0RUU3QzlEMjI5RjI1NEI0N0U5Njg2NDJGNDQwNjhCMERDOTg5MDIzNzUyRDJGRTJDQjY5NEU3MDRCQjgyNEQ3Mzk3RjUwMrAVCgpjb19zaWduZXIzGgIwMzqGCAqABEIxMkQwMUUzOUY3QzA4OTIyMTFBMURGRjVFM0Q5NjFCQzkxMzk3Qzc2MDIxQUI3RUVCRkYyQ0U2QUM4RTBEQTdFOTY2NDIyODI5RTUxMEVFNkExM0RFQzRDMjAxQ0ZFMzEzQzcyRjI5ODNFREE4Qzc2MzREOUFBNDgzNzEyNEVDQ0IyREY4MTBDMDYyMEFBOUU1MEVEN0UwQkNBREI5OEJENkJERjY5QTg3NjAxRDk5NEI4MDhFQzUwMDNEMTZFRDg0ODMyN0M5RDFFNzk2RTkxMjBBQ0FFMDU4ODM5ODBEQUQ0RThBNUQzODQyMDVBMDMyRkE1OUIzMkQxQTE4OEU3NDAyRThCMEZGMDA3M0Y5QjMwODk5ODAxQkM0NEFBQUI2NUMzQzlFMERBMERDMTNGRENDOUM1QTlERUY2MDlBNEQ4MjU1RTMzQTRGNzJDMkI0OTg3NjM2QTJFNkRGMUNCQTcwQkU0QkFBODc3NzE4N0I5QzZBMjNDNUVFMzg4RTNDREQzOEUwNjAwOTg5MjA4Q0ZEQjEzQ0QyMEQ5MjI2QTQ5NjE4RTBBODVDMEQzNEJFQUUwNTFDMjRERjQ2N0ZGQjRGMzkyMTNCMTBFQjJFMDQ1QTAwNDRGMTRENjJFNjlDQzYyOEVDNzQxQ0Q2NUZDREM0M0IzNDE1QUU3QkZEEoAEQjEyRDAxRTM5RjdDMDg5MjIxMUExREZGNUUzRDk2MUJDOTEzOTdDNzYwMjFBQjdFRUJGRjJDRTZBQzhFMERBN0U5NjY0MjI4MjlFNTEwRUU2QTEzREVDNEMyMDFDRkUzMTNDNzJGMjk4M0VEQThDNzYzNEQ5QUE0ODM3MTI0RUNDQjJERjgxMEMwNjIwQUE5RTUwRUQ3RTBCQ0FEQjk4QkQ2QkRGNjlBODc2MDFEOTk0QjgwOEVDNTAwM0QxNkVEODQ4MzI3QzlEMUU3OTZFOTEyMEFDQUUwNTg4Mzk4MERBRDRFOEE1RDM4NDIwNUEwMzJGQTU5QjMyRDFBMTg4RTc0MDJFOEIwRkYwMDczRjlCMzA4OTk4MDFCQzQ0QUFBQjY1QzNDOUUwREEwREMxM0ZEQ0M5QzVBOURFRjYwOUE0RDgyNTVFMzNBNEY3MkMyQjQ5ODc2MzZBMkU2REYxQ0JBNzBCRTRCQUE4Nzc3MTg3QjlDNkEyM0M1RUUzODhFM0NERDM4RTA2MDA5ODkyMDhDRkRCMTNDRDIwRDkyMjZBNDk2MThFMEE4NUMwRDM0QkVBRTA1MUMyNERGNDY3RkZCNEYzOTIxM0IxMEVCMkUwNDVBMDA0NEYxNEQ2MkU2OUNDNjI4RUM3NDFDRDY1RkNEQzQzQjM0MTVBRTdCRkVKiwEKQDA0NEY0MTBCMTA2MzY2Njg4REE2MUM3ODZBRTNCODgwNUUwMEZDMEY0OEM1OTMxNTg2Njg4RDFFNzU0Qzk4MkMSQDA1RDE4Q0MxRDk5OTEyRDBBMkFDOTZFMjFCOUMxQUFFQzA3Q0M1QUJGRDREOTYxMjM2Q0M1RTRDMDMwOEQ4NEYaBXN0YXJrUoAEQzE0MTA4NDA1MkJFNEE0NjhGNDJENDlFNEZBRTc2M0ZFMDcwQUJEM0Y3OEU3RDI5RjNFRjA4Nzk0Q0VFQzM1M0VDRTRDRjZCQjYxODY2RDdGMDM0OTNDOUE0NkNDMDJERDI3NjdDOTExQjAwOEZDMERDQzYxNkEzNkQwNDFDNzJBRDA4RUYyNTREOEUyQjlDNEIwQ0UyQTBGNjdBQUI5ODQ3QjgyNjREQjYyNTNGQTkyMTVFQzM3OEI3NjAxOUQxRTk4QzlFQUY5Q0JGM0JCN0I5NTk1NjkyQTUyRTA5RjcxMzQyOEZEMzQ4RTdDRUQ3OEUyNTczMDQ0NDJCRDUyMEMyMjdEMUExQzgzMjM0RkZDODMwMEQ3OUJGRTk4RTJGRjhBOUI2MjY1MjM5Rjg0NjA1RkVCNDZGN0Y3ODUzMUIzQzFFNDU2NTc3RDFBMDA1NzI5MzRFMjE2OEQ0NkY4MzQ3QUFCRkNDMTRGQUU3RTgwRkM2MkM5NDkzMEQ5M0IzQkM0QzRFNUMxNDJDNEEwQjIxRkM5RjRFQUVBOThBODlFRTEwM0Q2M0YzMTJGQUUzQ0QyNjVBREVEMDM4MDlBQTlBQzkzMzE4Q0VBRUNFRDg0RkY0QjIwOUE3MjJDOUJCMzhGNzI1MDY3QkJDMUQ3NDQyREU3NTRDRDkwQjQ3QkRqgAQ2NDJCQzFCREM0NTgyN0IzNjgxMURDMEFCNDE5QkFFMjdEMjkyOTkzNEMxODgzQUQ0QzBGQUE5NEFBQzZCRjgxMzVGMUU5NTA2MzQ5Njk2Q0VFMUZDNjNBRTU5NjdEMEFDNzQ5NjNDNjY4RjdGREFBNjY3RjY2NzA0N0FEOEQxNDkxRUNENDgxRTgzQTM1RUFBQ0U0MTc4RTAxQjFENzU5NjQwREM3RkZEMkU1QTIwMzRGREU1MTc3RjU3MEU1NzdEOTM1NEE1OUIzQ0JEMjgxMzVFNTg3NTM2Q0I2QjhDNzU3MkIyODk3ODZENDdDNzJEMUI0QUM3OTUxNDg0QkQ1MkRBRjk3RUUwN0IxRkMwQzIzOTAxRTQ4ODUxNDZERDg4MjQ1OTA5MEUwQjcxM0IxODQ2ODk0NjAyMTJGRjEzOTE2MkVENEY1ODNDNjA2NkE5QjZFMTNDMDdCM0QzRjhBNzVFNEEwNUZCMzdDNjA1MjVBNkY1QTJDRDgxQzA5Njg4RjM4QkVFQkIwNkMzN0U3Rjg4NjNENjczNjY4QkExNDUxNjVCRjQ3MkZEQTYwOURGQUZGRDlBOTlGNTg0MzlDMzk4MTdENTRDRjY5RTdFRTNFNERGQjczRjE0MzMwNjA0MkIxMzcxNDYxNDUyMjVFMUIzQ0NFQjM2M0VEODExM3KABDEzMkY1RTMzQzk3NjJCNTM0MENCQ0M2Q0I1RkU1QTA0M0Q2OEQ5MzVFQUYwRUU1RTQ4QzQwMjBDN0IyNTAwNDMxOTVCMzJDM0VGNzJGNkEzRDg3RjIzN0U0Mjk1Njg0QkU0RTI5QTRFQ0RFMjM0NTNGQjQ1QjBEMzc2QjM2NDZFMTkxN0NCRDI5NTU0MkNDNzAwNTM4N0RFQzFBMkFDNTM3RkZGRDJFRTdFRDA5QzY0MTNCNzc1NDFGM0QyMzVDOUUzQkVGQUYzREUzQzRCMDRBOTMwMkY5MjU4RUY2QzVFNjUyMkRFRkI1QTg3NjVDNDE4NTcwODczM0ZDODU2RkM3M0U1MjU5QTU4OEVFQjQ4MzI4MTg5NDkxMzdBRkM3QzNEMUNFMjgyQjg5MzZENjJCNjU2MUI3MTNCQzY1MTE0MDE3QTQ3MDBBQzMxREFGMkVGNjRFRjdCRUMwQjA4Q0JDQjg4Q0NEMjM3MEM4OTEzMUYyODE0NEU3NEJCQzBEOUQwMzU0M0REQ0IxQ0FGNzNEM0U1QzQzQTVFRTcxNTk1RjhFNjFBM0U4Mjc3NzlEMjFDMkEwMkE1MkYxNzk1N0I1MEJFRTYzMEFGMDBDNUVBRTYyMTQ4NUQ0MUQ3RkZENkVEODE2RjY1MEQ5NTA0NUZEMjMzN0I0QzY5QzY3RUI5OosBCkAwMkNGM0JGRjg3OUEzRDRDMUNGNDExQzA2M0VGQzk2REE3RTdEMERBMERBRDIyMUVBRUVDN0E0MTVDMkUzRTI3EkAwMTZCMDFCQkIxMENDMDY5N0VDNUYwMjBDRURCODU3RDcyOTI3MjBCRDdCNDk0MDYyMkIzQzY5OTQxMUQyOTMwGgVzdGFyaw..",
+        "Cgt3b3Jrc3BhY2UgMBACGAMqqUYKCmNvX3NpZ25lcjMaAjAzMqckCoAEQjEyRDAxRTM5RjdDMDg5MjIxMUExREZGNUUzRDk2MUJDOTEzOTdDNzYwMjFBQjdFRUJGRjJDRTZBQzhFMERBN0U5NjY0MjI4MjlFNTEwRUU2QTEzREVDNEMyMDFDRkUzMTNDNzJGMjk4M0VEQThDNzYzNEQ5QUE0ODM3MTI0RUNDQjJERjgxMEMwNjIwQUE5RTUwRUQ3RTBCQ0FEQjk4QkQ2QkRGNjlBODc2MDFEOTk0QjgwOEVDNTAwM0QxNkVEODQ4MzI3QzlEMUU3OTZFOTEyMEFDQUUwNTg4Mzk4MERBRDRFOEE1RDM4NDIwNUEwMzJGQTU5QjMyRDFBMTg4RTc0MDJFOEIwRkYwMDczRjlCMzA4OTk4MDFCQzQ0QUFBQjY1QzNDOUUwREEwREMxM0ZEQ0M5QzVBOURFRjYwOUE0RDgyNTVFMzNBNEY3MkMyQjQ5ODc2MzZBMkU2REYxQ0JBNzBCRTRCQUE4Nzc3MTg3QjlDNkEyM0M1RUUzODhFM0NERDM4RTA2MDA5ODkyMDhDRkRCMTNDRDIwRDkyMjZBNDk2MThFMEE4NUMwRDM0QkVBRTA1MUMyNERGNDY3RkZCNEYzOTIxM0IxMEVCMkUwNDVBMDA0NEYxNEQ2MkU2OUNDNjI4RUM3NDFDRDY1RkNEQzQzQjM0MTVBRTdCRkQSgARCMTJEMDFFMzlGN0MwODkyMjExQTFERkY1RTNEOTYxQkM5MTM5N0M3NjAyMUFCN0VFQkZGMkNFNkFDOEUwREE3RTk2NjQyMjgyOUU1MTBFRTZBMTNERUM0QzIwMUNGRTMxM0M3MkYyOTgzRURBOEM3NjM0RDlBQTQ4MzcxMjRFQ0NCMkRGODEwQzA2MjBBQTlFNTBFRDdFMEJDQURCOThCRDZCREY2OUE4NzYwMUQ5OTRCODA4RUM1MDAzRDE2RUQ4NDgzMjdDOUQxRTc5NkU5MTIwQUNBRTA1ODgzOTgwREFENEU4QTVEMzg0MjA1QTAzMkZBNTlCMzJEMUExODhDQzk3NUEzQkIyMjQxN0QyOTM3QkEwQjE4Q0RDQjlDNzEyRTg3RDk0MDI2Qzc2OUNDMDc4RUYxMEE0N0M5NUNBMzFGRjdCQzNBQ0UwMjJDOTAxMTYyMTA4ODVFQ0E1MTY0QjgzNDlGRjRERDRBNkZCMUIxOTAwMjczNUFGRUJCMTExREIzNjY0MUYwQUY2MjYwMUUzQTg1Njk1RUZCNDc5RTIyNjkzRTk4ODk4NUU5NEE4Q0M4QkMzNUYzN0NDNDEyMzdEOTU4NTVEQUQ3RTlBMkQ2OTJFMkEzNDlCQ0FGMEEyMTY5RUE4MzgwMUI5MkE2MjY0OEUyNDE4OUE2QURCQxqABDgxMERCNkFERjcxREE1MkQzMkI0MjlDREIyQjc1Q0EzMjZGN0I3NDA3MjBFRTVBRjBFOUNGNkNFOUFEMDFDOEY2RDU1RDM0RDU3OTlGNzg2M0JERTE1NTNBN0ZDQjc2NjFDRjQ4MThFRjgzNTBBRTIwRkRBQ0QzRUE5RTlGNDRCQzZCM0ZDRjU4NzhFMTg5RTNBODgwQTgxQTkzMDgyMzBBOEY4MUE0OTY0QTBDNTkyMjUxMUZERUE4QTM2M0ExMDNGNTU5N0EzMTJCRkVCQjM1ODlBRjNBODk1MTVGQzQ2MTdENEZCRjU4Mjc0QTUwQUU4MDhGMTVDQ0VBNkI4MjA4QTBFMjFDQTREMkYzRTgzNEIyNzk1MTA3MzYzQkFBQTc3ODZEMTM2QTc0NTkwNjlCNzQ4NTZEMTQyREUxOTY3RDQ5RTE2MEJGNzcxMzZFQTdFMzI0NzI5RDNDRTFFMkQxOTVBRTU3OUQzNDU2RkYxNzg2MTQ4NUUyM0YwNkI3NkZDMTAzMTRFRDc0QUVGQkRDMTY3NEIzQzREMUIwQTRBOEEyNEZGNjE5RUIyM0RFRDE3NjVFOUE1MERDN0YwMEREODBFQzlFRURFNDk3OEJGNUNCODA3OEE0RkFBMUE3MEEzMzNCM0M1NEEzNzlDOEFBQzMxM0U4MzZGMjFDMTg5IoACRTBBOTE4MUNGRUIwRUUxNEQwMUE4OTA3NzY4NzY4NDIxRkM0RUI5QkI0OEE3QkZFREJEOUYzQjZGRjc0NkM2MEQzM0U1RTJGNTQzMTc5MjcyQ0UwNDBFQjNCRTIzRUMyQTA3ODQ1NUQyM0UzNUExRTc5RUNGRjMyNDYyQTE5NDc0MzhFMUMwNTNBMzRFNEVFMzgwMDk0RkUxRUEyOEY0QkFEQzRBQTQ3RTk3RTlEQjJFMkM3N0I1RDkzMjkwRTI0NUY0ODZCN0MzQjZCNkFDMUIzM0FFREYwNDBENzdEQUQ0QUI0QTgwQjM1QTkxNDQ5RkZFMEY0M0ExRThFOEU3MyqAAkM5RTQyQ0Q4REUwRTA4QkJBQjM0MDU1RkQ3NzE0NUY3NjgwRjc3QzIzMjRFRjY0OTFBNjNCNzk5NTZCMTk3OTY1QTRDM0I3OTE4MUJDRDBCNzY1NjI0QzMwODNBNEVGNTYxQzNEOEY5QTk1OUFENDg1MDFGNjg3RTI0QzU2NDM1REI5QkI2OTkzNTI1NDFEMjM2QzI5NkQ1NTQ2RkJCM0NENDY4MzAwMDM1NTc4NjM3NEYxRENEODg5RTM5NzQ0OTY0MkQ3NTRGMjRDRDk2Qzk3QThDMkZCMTY2QjkzNjJGMzBBNzk2NURCRTU4MkY2RkE3OUE2NEI4NkQ3OTNGQ0YygARDNTI4NTlFMzk2NDM1OTQ4QTQ2NEMxMjIwMUM0NTYyMDZEQTNEQUM4OEIzQTNENzQ3QUVBMDFGMjYyNUNDNjVGRjNGMDQ4MUQ3OEQzQjYxMEIxMkZBNTE1MUY5MENEOTA2RkY1QjRGMDI3RThGQjE4NzU3ODBEQTE3QTU0ODkwQTM1MEZFQjZGNDcwRjQ3Mjg0MDlDRjMwQTY3OUM3ODg2QUZCMEJGRDhBMzg5MjBGMEI2OUNEQTY3RkZBMUZCNUZBODkwRDA0NEEwODExMTVBMzQ1RjBBODZBQjBCQTRFOTFFRkEzMkY0MjA5QzIyQkRCRkZGNkE3NDA1RUMwNDZCQzkwQ0E4NTE5OEU2MzNGNUEyQzY3Q0QzNzcyMTdDN0M4OTVEOTkwREY3RDVDOTQ5MUVBQ0NGMEZBNTIyMUM1REQzMTBFQTRCQzFGRDVFMTI4NjRBOTA4Rjg1MERCRjUyODREOTBBRkE5NEM1QURDRjdBMkUwNUJGOEFFNkJEQjQxRjQ5QTc0OUM0RDkxQkMwMzJBNjI5MzEwRjJBQTc0RjVFMDA1RkNBNkE4QkM2NkVCNzBEREMzRkIzQTE1RjQ5RkZBOTA3ODA2M0M0QTUwODRDRkZBQTgwMDE3QzFFREMyMjg4RDczOTdDRjk4NjQ5RkYwOTdDRTE0QUQ3QzdBOTqABDlGMzgxOUNDNzZEOEQ2QzI4QzZDM0M4RjRFNkFEQ0I3NDI0NTI5RDlGQzcyMTM4NzY3QzdERTlCMUZDMTk1RUNBMTg0NTI0NTk3OTFFMUVFQjAyNjRDOTgwMTY1RjAzNzMwQUQxMzlBQzhFNkI2NUQ3MTI3OEEzNkZERjJDOENENkJFNjRFNjg1MjlCNjBDOTFGRUE5RjQwODg5RkIzRTk4QUNBNEE4MDk1MEFEQjAxRkU0RjYzNjAyQUUzOURDNjk3MzcwRTY0NDRBMTY2MERDMzU2NUY4RjZFMEMyQkY1ODk3QTI2QTUwQjJBQkM5NzAxMDlFMjQzQjA5MEY2MEMxRjkzQUQwRjJCNzYyMTU4QTQyRTk4QTQ0OTg2ODgzQTIyNEEwMkEyNzA1NzdFOTg2NjE2NzdDQzRGQUEwNzExOERCNjUyNjM1NkNGREZCNjMwOTAxOUVEQUMzQzY0NDIyMjlGMkYyQjdFMjU3REQ3M0YyMzYwNUFCM0NCQjI5MTY3RjdCMDVEMzlDMzM1ODExOTc2OENGRUUxNzBEODQwRTVBRDUxQjU3OTI2REE1MjI4QzAyM0VCODQ0MTg2Mzc1RjMwQ0FBQzFFOTI0NTBGMjgzMEM1QzQyRUQ2RjQ0RUY4RDYwQjIwOEIzQkQ5MDcxRTAxRUI1M0E3OTU4OTYxQoACRTBBOTE4MUNGRUIwRUUxNEQwMUE4OTA3NzY4NzY4NDIxRkM0RUI5QkI0OEE3QkZFREJEOUYzQjZGRjc0NkM2MEQzM0U1RTJGNTQzMTc5MjcyQ0UwNDBFQjNCRTIzRUMyQTA3ODQ1NUQyM0UzNUExRTc5RUNGRjMyNDYyQTE5NDc0MzhFMUMwNTNBMzRFNEVFMzgwMDk0RkUxRUEyOEY0QkFEQzRBQTQ3RTk3RTlEQjJFMkM3N0I1RDkzMjkwRTI0NUY0ODZCN0MzQjZCNkFDMUIzM0FFREYwNDBENzdEQUQ0QUI0QTgwQjM1QTkxNDQ5RkZFMEY0M0ExRThFOEU3MkqAAkM5RTQyQ0Q4REUwRTA4QkJBQjM0MDU1RkQ3NzE0NUY3NjgwRjc3QzIzMjRFRjY0OTFBNjNCNzk5NTZCMTk3OTY1QTRDM0I3OTE4MUJDRDBCNzY1NjI0QzMwODNBNEVGNTYxQzNEOEY5QTk1OUFENDg1MDFGNjg3RTI0QzU2NDM1REI5QkI2OTkzNTI1NDFEMjM2QzI5NkQ1NTQ2RkJCM0NENDY4MzAwMDM1NTc4NjM3NEYxRENEODg5RTM5NzQ0OTY0MkQ3NTRGMjRDRDk2Qzk3QThDMkZCMTY2QjkzNjJGMzBBNzk2NURCRTU4MkY2RkE3OUE2NEI4NkQ3OTNGQ0VSgAJBNTk0MUM2NjRDMkJDN0UxOUQ1QUE0N0E4OTc2NjRDOTkyQkQxMkY3NEE3NkYzNEE1Q0EwRTk2NTJCOUU0MTg5NTk2RDRCQjdENEI4NEFGOUZDRDQ4QkRGRUIyMDQ4MjgzRTVGRTBEOURCMDZBMzI5QTcwMTk2RTczMkQ4MkRGRDk1MTdFNUE4NEREQkUxQjVBQTM3NjUyMDI5MTVBN0JFMzJEQkM3MURGRkVBRkIzNzkxOUUxMDFBQUZFRTk0NjVGNUM2QjQ3RUY0NzJEMEUxMkEwNUNENDU1OEEyNzZGMDA5M0RBQjBBQkEwNDZEMkU4Q0M3NjRDOENBRTc1NUIwWoACMzUxODEzMkNGQTc1MkE3NkQ0RjFDM0M1QzE4REIxMjgzRDE3Q0M0RTRBRENCRTFDNkZEMkU5RUNBOUI2MDYwQzYzRjNFQjYzODM5NzEzQTkxMjMxQzUxRUVGQzA4NTc2MTJDM0M0QkNBMDMxMThEODVBNTQxNzQzNDE2ODYxMkE0MEVERTg1NkRFQzQ1REI3RDc5QTJDMDVGNTlBRkExMjkwRjg3OURDOEI1MzFCNjlFQThDOTFBMkI1MUY1RjkxRUNDMzM4MTQ3QTAyODk5Rjg5MTA5QTBBM0ZDNkNDNzg0M0NEQTIyNDY3RUNCOUEwNURGNUExMDQzMTVEOUJBNGKAAjNCMTRGQkI2QjI4NTI2MzMzMkJGRTQ4Q0VEMTEwMzc4OEQwN0Q4QTQ2QTEzODhCNDdGMzkwQTUxRDNENjJBRDc3OUQxMTI3NzdGNzkyRTJEMzAwQkI1MEI1MEMxRjY5QTYyMTg2NDgzNDhEQ0I2RjREMkVCNjg0QjEzNTFFQjQ5QUU3NjM2NUNFQzU5MDMzODhEQzkyRkRERjU4Q0U3OEQ3QUU4RTMyOUU5OTNBMjdCNTEyOTZCNDJFMzNBNzlCRTY5ODFCNkZENDZGODk5RTA4OTM1MjBBQUU4MzUwNkJENDE3NkZEMDA3QkE0QTcxQjczMTk4RjcxNTNBNzM4QzNqgAI5NENDMTlBQkUzOThERTQ0RDY0MjQxOUExNUUzOTRDRjJBRjdBQjczRTc3MjM4MkNBQTkwQ0RBQ0FDRkI5MTg5RjY1ODUwMTU5NDg0Qjk2MjY0MjQ1RkE0MTg3OUM5N0Y0RjAwMTQzRDA5Mjg5NDZGRjVDQjUxM0FFMzVEMDMwQjlBQURDRTQyNTY2MEU0MUE1RjI4NkFDRjVFRDRDMTJBNDM2RkI2MjNBQTA0NkFDRDY0OTEzQkU1RTkxQTE0Qjc3NzZBM0QzQUFBQ0IwRDI5RjE3Qjk1QTcyNkYyNjlCNkVDRDlGNDM5NTY2Qjc1Q0Y0OUE0QzNCNDNDMUJBNDJCOoYICoAEQjEyRDAxRTM5RjdDMDg5MjIxMUExREZGNUUzRDk2MUJDOTEzOTdDNzYwMjFBQjdFRUJGRjJDRTZBQzhFMERBN0U5NjY0MjI4MjlFNTEwRUU2QTEzREVDNEMyMDFDRkUzMTNDNzJGMjk4M0VEQThDNzYzNEQ5QUE0ODM3MTI0RUNDQjJERjgxMEMwNjIwQUE5RTUwRUQ3RTBCQ0FEQjk4QkQ2QkRGNjlBODc2MDFEOTk0QjgwOEVDNTAwM0QxNkVEODQ4MzI3QzlEMUU3OTZFOTEyMEFDQUUwNTg4Mzk4MERBRDRFOEE1RDM4NDIwNUEwMzJGQTU5QjMyRDFBMTg4RTc0MDJFOEIwRkYwMDczRjlCMzA4OTk4MDFCQzQ0QUFBQjY1QzNDOUUwREEwREMxM0ZEQ0M5QzVBOURFRjYwOUE0RDgyNTVFMzNBNEY3MkMyQjQ5ODc2MzZBMkU2REYxQ0JBNzBCRTRCQUE4Nzc3MTg3QjlDNkEyM0M1RUUzODhFM0NERDM4RTA2MDA5ODkyMDhDRkRCMTNDRDIwRDkyMjZBNDk2MThFMEE4NUMwRDM0QkVBRTA1MUMyNERGNDY3RkZCNEYzOTIxM0IxMEVCMkUwNDVBMDA0NEYxNEQ2MkU2OUNDNjI4RUM3NDFDRDY1RkNEQzQzQjM0MTVBRTdCRkQSgARCMTJEMDFFMzlGN0MwODkyMjExQTFERkY1RTNEOTYxQkM5MTM5N0M3NjAyMUFCN0VFQkZGMkNFNkFDOEUwREE3RTk2NjQyMjgyOUU1MTBFRTZBMTNERUM0QzIwMUNGRTMxM0M3MkYyOTgzRURBOEM3NjM0RDlBQTQ4MzcxMjRFQ0NCMkRGODEwQzA2MjBBQTlFNTBFRDdFMEJDQURCOThCRDZCREY2OUE4NzYwMUQ5OTRCODA4RUM1MDAzRDE2RUQ4NDgzMjdDOUQxRTc5NkU5MTIwQUNBRTA1ODgzOTgwREFENEU4QTVEMzg0MjA1QTAzMkZBNTlCMzJEMUExODhFNzQwMkU4QjBGRjAwNzNGOUIzMDg5OTgwMUJDNDRBQUFCNjVDM0M5RTBEQTBEQzEzRkRDQzlDNUE5REVGNjA5QTREODI1NUUzM0E0RjcyQzJCNDk4NzYzNkEyRTZERjFDQkE3MEJFNEJBQTg3NzcxODdCOUM2QTIzQzVFRTM4OEUzQ0REMzhFMDYwMDk4OTIwOENGREIxM0NEMjBEOTIyNkE0OTYxOEUwQTg1QzBEMzRCRUFFMDUxQzI0REY0NjdGRkI0RjM5MjEzQjEwRUIyRTA0NUEwMDQ0RjE0RDYyRTY5Q0M2MjhFQzc0MUNENjVGQ0RDNDNCMzQxNUFFN0JGRUJAMDNEREQ1OEM1NkE3RjIyNkYxOTQ2NjI2RDVEMzI0M0Q4N0I2MDYyRjlENzlBRDA5RTRBNTkyREI3RDczQ0ZFNEqLAQpAMDQ0RjQxMEIxMDYzNjY2ODhEQTYxQzc4NkFFM0I4ODA1RTAwRkMwRjQ4QzU5MzE1ODY2ODhEMUU3NTRDOTgyQxJAMDVEMThDQzFEOTk5MTJEMEEyQUM5NkUyMUI5QzFBQUVDMDdDQzVBQkZENEQ5NjEyMzZDQzVFNEMwMzA4RDg0RhoFc3RhcmtSgARDMTQxMDg0MDUyQkU0QTQ2OEY0MkQ0OUU0RkFFNzYzRkUwNzBBQkQzRjc4RTdEMjlGM0VGMDg3OTRDRUVDMzUzRUNFNENGNkJCNjE4NjZEN0YwMzQ5M0M5QTQ2Q0MwMkREMjc2N0M5MTFCMDA4RkMwRENDNjE2QTM2RDA0MUM3MkFEMDhFRjI1NEQ4RTJCOUM0QjBDRTJBMEY2N0FBQjk4NDdCODI2NERCNjI1M0ZBOTIxNUVDMzc4Qjc2MDE5RDFFOThDOUVBRjlDQkYzQkI3Qjk1OTU2OTJBNTJFMDlGNzEzNDI4RkQzNDhFN0NFRDc4RTI1NzMwNDQ0MkJENTIwQzIyN0QxQTFDODMyMzRGRkM4MzAwRDc5QkZFOThFMkZGOEE5QjYyNjUyMzlGODQ2MDVGRUI0NkY3Rjc4NTMxQjNDMUU0NTY1NzdEMUEwMDU3MjkzNEUyMTY4RDQ2RjgzNDdBQUJGQ0MxNEZBRTdFODBGQzYyQzk0OTMwRDkzQjNCQzRDNEU1QzE0MkM0QTBCMjFGQzlGNEVBRUE5OEE4OUVFMTAzRDYzRjMxMkZBRTNDRDI2NUFERUQwMzgwOUFBOUFDOTMzMThDRUFFQ0VEODRGRjRCMjA5QTcyMkM5QkIzOEY3MjUwNjdCQkMxRDc0NDJERTc1NENEOTBCNDdCRFqAAjY1NTc3REU4NzhDQzhGQ0E0RjczM0VFMDhBQTQ3ODNGNTQxRjgyMTc3MEQyRjY3QzlERkNDQzRENTU5MDg5RjY5RkFEREJBN0NDRkFCQkEyM0REQ0E5MTFDNDYwNzFDMEU4Q0M4RTY1QTAyRjlBM0Q5MjFFRkUxNTYwNTVBOTcxQzlCQTY1MDU1QTc3RkMyQUE1MUNFQTRGNUI0M0RERjBFODYwNjREN0UyNkE1QzIxMkQ3ODhDQkU2QUZDNDk3RjM3MjFFMzg2OTYxRkQyQjJEMkI5RkE5RTBEN0Q2MUI1MDc1OUM0RDU2OUEyRkU3NzY5QTIzMkRGNjVFNjQxQTVigAI3QTBCODZBNDZBODkzQTc0ODQzRDEzMTdGMkRCMDQ4MjJCQTAzODkwMjUxQTA1Qjk3MjVDNjlGNUUwNDA1OTU3NDNFOTM0ODRBQ0ZDQjAxMkFERjA5NThCQkM3NTNFMjBGQTE0RkJBQTQyNTU5NDc2MDZEQUNCQzlFMTkyMUI5MjZGRDY5Qzc4OTc4REVCRDI5RkY1QjdERkMyQ0Q3NkM1MDRDRjdBQzc2NkI5QjZCODhCMzA3MjBCQzIwNjUxODUxODM2RUMwMTc2Q0E1QjA0N0RFRTg1MTcxRkQ4NjU5NjFBRkNGMzZCNDVGRDU1MkZBQjY2NEM4MEZDNEM3QTBCaoAENjQyQkMxQkRDNDU4MjdCMzY4MTFEQzBBQjQxOUJBRTI3RDI5Mjk5MzRDMTg4M0FENEMwRkFBOTRBQUM2QkY4MTM1RjFFOTUwNjM0OTY5NkNFRTFGQzYzQUU1OTY3RDBBQzc0OTYzQzY2OEY3RkRBQTY2N0Y2NjcwNDdBRDhEMTQ5MUVDRDQ4MUU4M0EzNUVBQUNFNDE3OEUwMUIxRDc1OTY0MERDN0ZGRDJFNUEyMDM0RkRFNTE3N0Y1NzBFNTc3RDkzNTRBNTlCM0NCRDI4MTM1RTU4NzUzNkNCNkI4Qzc1NzJCMjg5Nzg2RDQ3QzcyRDFCNEFDNzk1MTQ4NEJENTJEQUY5N0VFMDdCMUZDMEMyMzkwMUU0ODg1MTQ2REQ4ODI0NTkwOTBFMEI3MTNCMTg0Njg5NDYwMjEyRkYxMzkxNjJFRDRGNTgzQzYwNjZBOUI2RTEzQzA3QjNEM0Y4QTc1RTRBMDVGQjM3QzYwNTI1QTZGNUEyQ0Q4MUMwOTY4OEYzOEJFRUJCMDZDMzdFN0Y4ODYzRDY3MzY2OEJBMTQ1MTY1QkY0NzJGREE2MDlERkFGRkQ5QTk5RjU4NDM5QzM5ODE3RDU0Q0Y2OUU3RUUzRTRERkI3M0YxNDMzMDYwNDJCMTM3MTQ2MTQ1MjI1RTFCM0NDRUIzNjNFRDgxMTNygAQxMzJGNUUzM0M5NzYyQjUzNDBDQkNDNkNCNUZFNUEwNDNENjhEOTM1RUFGMEVFNUU0OEM0MDIwQzdCMjUwMDQzMTk1QjMyQzNFRjcyRjZBM0Q4N0YyMzdFNDI5NTY4NEJFNEUyOUE0RUNERTIzNDUzRkI0NUIwRDM3NkIzNjQ2RTE5MTdDQkQyOTU1NDJDQzcwMDUzODdERUMxQTJBQzUzN0ZGRkQyRUU3RUQwOUM2NDEzQjc3NTQxRjNEMjM1QzlFM0JFRkFGM0RFM0M0QjA0QTkzMDJGOTI1OEVGNkM1RTY1MjJERUZCNUE4NzY1QzQxODU3MDg3MzNGQzg1NkZDNzNFNTI1OUE1ODhFRUI0ODMyODE4OTQ5MTM3QUZDN0MzRDFDRTI4MkI4OTM2RDYyQjY1NjFCNzEzQkM2NTExNDAxN0E0NzAwQUMzMURBRjJFRjY0RUY3QkVDMEIwOENCQ0I4OENDRDIzNzBDODkxMzFGMjgxNDRFNzRCQkMwRDlEMDM1NDNERENCMUNBRjczRDNFNUM0M0E1RUU3MTU5NUY4RTYxQTNFODI3Nzc5RDIxQzJBMDJBNTJGMTc5NTdCNTBCRUU2MzBBRjAwQzVFQUU2MjE0ODVENDFEN0ZGRDZFRDgxNkY2NTBEOTUwNDVGRDIzMzdCNEM2OUM2N0VCOXqABDNCMTU0QTY5QThBRkY2RTI1QjMxNDI2OUUyN0FBNjE2NEZFMDY1MUNDQTlERDgxMUY3MEExMUE5NDIxODJCRjMyNkZGM0ZDNjBGMjY2OUNEQjYwMEE1QjIwQjY3RTVFRDVGQUFCNjgxMTE1MzVFNDM3MDgyQzA5NDI2RjgxMEUwMEVDNThEMDU4REE1QUQyNjU1MkQ4NTgzRTU3OUUxMEYyQTdBN0U4NzM0NzVERjk5QkIxRkNCMUJCRUE0MTA0ODBFNkI1QUQ2NEYzQUMzQkEyODhDQTQzNTI1RDMxRjMzQ0REQzE0OUFFQkQ1NTgwRTgyMkQ4NDA5RjMwQzM5MUZBODI0NkY1NkQyNkZFOTA4MEY2REJDQkIyRUE5RDRFNERCN0MyRTgzM0RFQTQ5NUY5Qjc4RjY4QkEzNUYwRTZFMjVGOTg0QjRDOThGMkFCQTAxQUNFNDVGQzhGNDQ2NzUwNUM5MTk1Qzc2NjU3NzkxQTU1NDZFRDU4NzE2MDZDMTVBNjYyMURCNkNDOTFDNTQzOEFGRUMyM0M0RjQ0QkY5QkU5RDFDREIzRTMxRTlEQzFFM0NGMDI0RDhCMjAzQjAxNEJGRDY0NzFDRUI3MTcxNDg5Q0EyQjg5MUM4RDM1QzM4MDFGQzU1NjJEMUNCMEM3QTk5QzVCMjE3QzUyMERFggGABDE3OUUyMEJDNzI3QTVCMEU5QUNEMkJFODNCNjM2OTlEMzI1NDY3RDEzOTY3N0YwMUNGNkM3MTg2OTkzMzk2Q0I4NzIwNzI2RDlDNjRDMjIwM0NGQjhGMjIzQ0I4QzJGRDU4QzMyRjQ3RjM2MDU4MjUzMDBENjQzM0I2MjY0NUEzODNGREI1QjRGQ0I2NkMyQUYwNTdGRTE3NDRCRDUxMTE0RDA0RkQ3RkNFNjRBOEZENjBERTBFOTMxNUJCN0ZGQTc3OEQ5OEUxRDI0QTI1ODY2NjY5NTRDOUFGODMxRDc4MUU3QjNGMzk3RjVFNTNENjRCREUwNENDQTk3Qzg1OTJBMDdCREE4N0ExMjkyMjY4MkJGRDRCMTUzOUU3MTFFNjA2OTM5M0M3QTQ4NUJDMTI5MDUzMEY3Q0MyOTgzN0M3OTlCMkEyRTNDRTE0NTA1RjQzNjY4QzQ5MUE2MUE1Q0UzQTEzNkY1MTM4MzcwQjRBRTRERjhCRjc1RDc5MUQ4Q0I5RUQ3N0NCQ0VDNERDQ0RGQkI0MDU3RDg5QjI2RTdFQkY1NjcyRjk4QUI1MUI2N0JCNDI3N0EzODdDMjY0OEI0QTRDQzRCMUM1NTIwMDM5QzMxQkEyRTcxNURCOUMyNTNBOTREQjRBNjc1OTY5NjYwN0NGNTdGQkY3MzgzMjYyMrAVCgpjb19zaWduZXIxGgIwMTqGCAqABEMyQ0Y5Q0Q5MjU0MTNGQjNFOUI1QTc1MzY3NEY1MDY5OEVCMEEyNjFCRjE1NzlGMjlCQTdDMjY4RDE3ODNENzEyOEE4QjI2QzI3MUYyODVDRjY1MUQ2QTE1M0JENzc1MkJFRkVFNzdFMzdFRUUyOTVDQTUwQ0I1QUUzMkU2N0M5M0VGMTQzMEZCMTc3ODJCQUVBNzhDRTEwMzNCMzYyMDBDQTgxODlEQTQxNDZFMEU4Q0ExQTMwMkQxOUQ3Nzk3NkE4Q0Y0MDM1QUUyMzI3MUQ0Mjg2REE2NDY0NENCN0UxRDMxNDA1Q0RDMzY5Nzk1MDIwRkIyRjYxNTZFQjUwMjY1ODczNDQ5QTcyNzExNzc5Nzc5RDgxMkU1NTE2NTI3N0Q0NzlBMjdCNTZBQTU2ODY5OEM0MjcxNjZGNDBGQTkxQ0E4MTJBN0JERTFDMTlCQUJERjJCNzM1RUYyQzBDNTNDMzZCODFBNEJENjNFNzg4OEU4MTg5Q0RCNjA4RUQxQkU2NkVDQkZCN0ZCNzFFMTIxMTFBOUUxNjU1QzNENzBGMUE5NDc5QzVBQzc1NzA3OTk2MTMwMTA1QTdDMzhGMjVBRjAwQzIwQTQyM0U2MTRGMzc1N0U1RjFCNzhDNzcxMURGRjg4RTVDQzZEQUQ5MUE0QjgyMTIxQzVCQjUyQkREEoAEQzJDRjlDRDkyNTQxM0ZCM0U5QjVBNzUzNjc0RjUwNjk4RUIwQTI2MUJGMTU3OUYyOUJBN0MyNjhEMTc4M0Q3MTI4QThCMjZDMjcxRjI4NUNGNjUxRDZBMTUzQkQ3NzUyQkVGRUU3N0UzN0VFRTI5NUNBNTBDQjVBRTMyRTY3QzkzRUYxNDMwRkIxNzc4MkJBRUE3OENFMTAzM0IzNjIwMENBODE4OURBNDE0NkUwRThDQTFBMzAyRDE5RDc3OTc2QThDRjQwMzVBRTIzMjcxRDQyODZEQTY0NjQ0Q0I3RTFEMzE0MDVDREMzNjk3OTUwMjBGQjJGNjE1NkVCNTAyNjU4NzM0NDlBNzI3MTE3Nzk3NzlEODEyRTU1MTY1Mjc3RDQ3OUEyN0I1NkFBNTY4Njk4QzQyNzE2NkY0MEZBOTFDQTgxMkE3QkRFMUMxOUJBQkRGMkI3MzVFRjJDMEM1M0MzNkI4MUE0QkQ2M0U3ODg4RTgxODlDREI2MDhFRDFCRTY2RUNCRkI3RkI3MUUxMjExMUE5RTE2NTVDM0Q3MEYxQTk0NzlDNUFDNzU3MDc5OTYxMzAxMDVBN0MzOEYyNUFGMDBDMjBBNDIzRTYxNEYzNzU3RTVGMUI3OEM3NzExREZGODhFNUNDNkRBRDkxQTRCODIxMjFDNUJCNTJCREVKiwEKQDAyMjYyOERBRTQwMTNDQTAzOEI4MkIzN0U4QzdENDMzQUJDNDIyOUYyNjJBMUI2NkI0RDRGNkVGN0RENkNDRUQSQDA1QTdFRkZCQjZCMjY3NDg0RTU2RDI3MjU2RUNCRDYzQTdBRkQ4MUJBRTEyNzg2REJGM0YwN0Q4NDA4RkY3QzQaBXN0YXJrUoAEQjhFNEQ0MDk5OUUwNDVENDZENzk5NTU2M0Y4QTlBMEE5RkQ0NEE0MjNEODE2MkQ4NkU3ODJGODRERTVDNEY4RUE3MUJEMjYzMjVBNTQyMDc2MTY1ODNFQ0E5MUMyRTVFM0E0RTM0MDRBNUIyOEEzRkVCMjM0QTMxRDEyRjE0NzJBMjdFMERGMjlCNEI0MzE1MUVEOUI3Q0FGMDQ5MEM1MUNFRkY2M0VBRDlGQzExM0E2QURDMEJDMDBFMTlCQjdCMjM4QTg0ODMxNTk0RjI5ODZCMEJEQzkwQjE2QzYxNjYwNjA5RTg4ODgzODFFMjIzOUVGRjAwNjFEQzg5QTZGMjI0NEJERjlEQTY1NTU4RDgwMDcyNDI5NTc1QzFGNjhBQUY0OEU3MzhENjgwQzQzNzg1NDFDMjYyMUQ1REE3OTNGRUQxOUUzRjE3QjAyRkFEODc5MTZBOUQ0MkNCRTFEQjQ1MDI1Q0RFRUZCMkEzQzJGQTk1MzQ5NzUwNkJFNjQ4QjMyNTY4MTNDRTk5QTVGRTZBNjU3M0FDMzhBREMyNEQzN0U5OUUxQTA5OEQxMkQzODg5RDk0MzRCQkRCM0IzMDA1ODQyNzZFMEIyMkUwRDI1NTdERjlGMzhCNUNENkNDQzFFRkRGMEU4QzUxQ0Q5QjdDOTlCQkJGOTY5M0VDRTFqgAQ4QjFGMTI2OUM1OTEwOUUyQzlBNkYxMDFFNThCQjcwRkJEMEM5N0MxMkI1OTVCRTA2RUFFMEQ1MERGNTlFQ0Y0MUNGMUZGOTBFODVFMUY3QzFFOERGMEY5NDcxODBBRkQzRDk3RDIwNDBCMUNEMjZFNDYzMEUzQ0FCNTk1QTNFMzlEQjFCQzY3Qzg0OEJENUREMkEzMDU5RUM1RTA2QjUwQkJDQUNCRjM2MUM3RTA2MTFBRDcwNzEyOTcxMDYwNDVDMDYxQUQzNTIzQ0I1Qzc1OEU0RTI3NzY4RDFERTc5OEEwMUYzOTVEOUE1RDcwQTdFOUExNzFGRURFNTlGNDBBMDFCRUEzQTAyNTc1MERFQTBCREVGRTg5OUI4NTNBNTkxRjVFNDk4OEUyOTA1NTI2MzlBOUY5RTAwM0E0MDIwQjY5Nzc0MkRFNTI5MDBGQjIzMDc4QzVGMUI0QjY0NUUzMjVCQjkwRTZBQzE0MENENjEwNDg2NEU4MTkyOTA1QjAzNDc0QTI1QjdDOTk0NDk4RTE1OUQwNDU1NTczQkMyOTFFMDhCREYxMkExQjNEQzAyQTE3QjUwNDk3OTc3RkJEM0E3RDFEQkM2RkY3Q0EzQkU2Qzk2RERDM0M0MTM1MENDMTRCODkwMDA3RkE4NDk0QkRBQTk1QjhBQkRFMTA4N3KABDdDQzU1OEVCMzRBRTM5NUJBNDJGRjc5NUM5RTJCOTQ1MzU3Njg4NzE0MzU4RkVFNEM1QzBEOUJGNDRGNkFFQTY1QThDQkUxQkJGMkRBQUM4MzAzMTM4MUFCQzQzNkUwMzVGN0I3MTRFQjk5NjREMzJENTRBMzM5NjAyNjFDQTFFRUYyQ0YwMDg2RURDMTZEQTlFM0YxQ0JDNDNENEUwQTI2MTEzMDhGNkY0QzEzNzI0MzBCNkEzM0Q4M0U0OUQ4RjFCQTQxNjJEQkEzNEIwRTU3QjMzNURDNjcwNDg0MkI1NTg2MTcwNTc1MTYzNTdDOUJGNDhDMjA1Mjk0QTIyOTBFMUM0OUYzNDY2QjVBQjU4NzkxNzNEMDU3RDkxRTIxOTY5MjM5MDNEQjc2MzQ0RkIzQUQ2NEFBMEI5QTM4MEM2NUU2MDU3RjYzQjRBOEJFMDc0NTI5RTYyRUJENEJDNEQwNjYxNTY1Q0FCQjBGMjU0OUNBRUE1MzQwQUNENkJGRTNFNzU2RjY0OEIyNDA0NUVERTg5QkQ1NUIwMkJEMURGMTdFQUNEQjE3OUZENTlFQzU5NEVCNTY0NUM0RUU3QzlEMjI5RjI1NEI0N0U5Njg2NDJGNDQwNjhCMERDOTg5MDIzNzUyRDJGRTJDQjY5NEU3MDRCQjgyNEQ3Mzk3RjUwMrAVCgpjb19zaWduZXIyGgIwMjqGCAqABEQ5OTdGQzlDMTYzMUVFNzExRjBBMTBFOUQxMDMyREVDRkRGMjhBN0MwM0IxRDAwOUYzQzUxRUFBNUU0OTk1N0E4MjhBMDgwQjI5QjMyRkZFQTdGNkRCQkI4QURGMkFFMjIyQTM4NjcxRUZGOTM0RTg3RTM2ODlBODkwNEIyMTEyRUM2QURBNDAyM0IyNEVBM0VGODZGRUIyMDE4QUQwMEJBQkYyQUYyQjc5RUM3RDI5QTMzNTQ2ODA3NTk0REZFODJFQzZGOUVDMzc5NjRFOEYwRDI3ODhGRUZBNDc2N0JDODgyNUVDQTQxNEE4RTYwMzFEREQyQkFGQkE1OTA4N0NDQTEyMjQ4Mzc5OUJGOTlCRjY0MkFERjU1MkVFQURFMzBFNjc2RkIwODdFRThDN0I3NjU4NEZGNDA4RDAzMzdDMTY4RDIzODFGMDhCODNDMThFRkNCNzAzRjA4QkZCRjlFNkU5M0JBMkJBMDhFMzI0NTI0ODY0MzU1MTA4NjU5MENGQUI3N0Q0Q0ExMENDNUVDMkE4QTVDQ0Q1RjIxQzQxMzgyNzk0RjAyMEE1ODhFRkFDMDIxMzU1NkNDNUZFRjIzNzc4REJBN0M1QkQxNEI4OTcwOTU4NDFDMjUyMzY1Qjk5MDRBNzkyNTFCQTE5QUUzNDdFNUEwRTkwNzlBQjYxEoAERDk5N0ZDOUMxNjMxRUU3MTFGMEExMEU5RDEwMzJERUNGREYyOEE3QzAzQjFEMDA5RjNDNTFFQUE1RTQ5OTU3QTgyOEEwODBCMjlCMzJGRkVBN0Y2REJCQjhBREYyQUUyMjJBMzg2NzFFRkY5MzRFODdFMzY4OUE4OTA0QjIxMTJFQzZBREE0MDIzQjI0RUEzRUY4NkZFQjIwMThBRDAwQkFCRjJBRjJCNzlFQzdEMjlBMzM1NDY4MDc1OTRERkU4MkVDNkY5RUMzNzk2NEU4RjBEMjc4OEZFRkE0NzY3QkM4ODI1RUNBNDE0QThFNjAzMURERDJCQUZCQTU5MDg3Q0NBMTIyNDgzNzk5QkY5OUJGNjQyQURGNTUyRUVBREUzMEU2NzZGQjA4N0VFOEM3Qjc2NTg0RkY0MDhEMDMzN0MxNjhEMjM4MUYwOEI4M0MxOEVGQ0I3MDNGMDhCRkJGOUU2RTkzQkEyQkEwOEUzMjQ1MjQ4NjQzNTUxMDg2NTkwQ0ZBQjc3RDRDQTEwQ0M1RUMyQThBNUNDRDVGMjFDNDEzODI3OTRGMDIwQTU4OEVGQUMwMjEzNTU2Q0M1RkVGMjM3NzhEQkE3QzVCRDE0Qjg5NzA5NTg0MUMyNTIzNjVCOTkwNEE3OTI1MUJBMTlBRTM0N0U1QTBFOTA3OUFCNjJKiwEKQDAzRTdFNkJDQzQxNDIwNEIzQkU4MEUzNzdFMTQxMzNGMDhFNkE2OTI0NTlBRkMxQzJBRDgzQjI2NDgzM0RGMjYSQDA1MzE3MkU3Qjg3REVDMzA4OEUyMUM5Mzc5MEREQjU2NzdENDhGRDk2NkEyQjc3M0Q3NDMwRjJBMTAzNEU0MjcaBXN0YXJrUoAERTdBQUM2OTE0OTU0OUJENURERUQ1OEREQ0MwNkZBMEYzRDlDNDY2RTlGMjlDOUFGMTEwODI2MTg5QTI1MURDMzQwMjcxOEFCMjU2NEFDNjUxNUNDN0Q2NzYwMDlFRTM0RDY5Nzk4ODVEQzA4QzYxODNDRDBENjVBOTUwNjQ4NEQ2RTkxQzgzNDM5QTY0QzU2QkNDM0JDM0IyNTU5N0VBRDhEOTQ3RTRBNjdGRkM4QkYyOUYzMURBNDJDQjRBOTNGMEM4ODA0M0Q3MjRBMzg2NTk0Q0YxOTNEMEQwQjYyODJERkQ2NUU2MkJEQzQ2REU4MDIxNDFDRDk0Q0I5MTNERUFDOEIzREQxMjgxMjJDNUQzMDQwMDE0MDU2QUNEQjI0RUM3MUUxRjYzM0RGQzYzQzNEMjE5NkZBODdCNEY4RDQxQjM5QkU1NjlBNzVEMDUzM0FERUREMjE1RjdENkZBNDFFRDk2NTI1OTBCOEYzRUUyOUI3MkQ1NDlDMjcwNzg2NTAwMTBDNzU2NzgxNjU3ODUwRTE5M0Y4MTI0MDI3NUNDNzI4MjRFMkQzRDZCNTVGMDNCQzI1NDZCNTU5NjVDOTI5REVFMjMwOUFGN0YyMkY5MEFFNTk1ODREM0VDRTk0NEE2RkVEMzgzQTIyOERBM0MxOUE3NkE5MjU5QzQwNTlqgAQ2MkE2RDNFNEM0RDU4NjhERDM3RTg5QTk5NDgxNzQ1QTU4QTBENkRBRDQxOEVCQzQzMjVDRkRENzA2QTA2QTRGRkFEMUE4MzIxNzM5MjIyQjAyN0MzRTM3MUI5NjkxMkE1RDREMzNGRjZERTg4QzVFMTY3NUJDRDQxN0QyMDRBMzJDNjU1MEI2RjhFRkFBNkEwREE0OTUyRkZCQjY2RTIyNUIyQkMzRThCMEFGQzgxNjZGNkIzMURGMTM4RjNFQzlFNDdDNTlFRTZBRDdGNDcwRkUwMDY2QzIwQjM4OTBFMDVFMjE2MUIzNkI5RjBCMDczQ0UyQzc0QUJGN0IyNUE1RTVDRDg0NDI1OTUyRTcxOTM1RTkxQTAzOEZDMTQ0MjQxNkU3QjU0REFBOEUwRDQ4QkQxMTlGMjlEMTE2QTIxQUMwNEQ3MDRGOTA0MTUwQzNBMEE3MDIzODJEMzk0NjVEMTQ5NTNENUMyQkU3OTg4RUE0OUMyNEMyMjBFNDgyOUNDREI0REY1QUNGRjg3MTVENkUzMjgzRDRCN0NGMDQzNkRFODc5M0U5Qzk2MUM5MTJBOUNGMEQ2MUM4ODA3NUExNzQ1NTE2RUVBRjkyRTQ4RkQ4MjRBMzNFNzAyNDBDMThFNDRDNzc4RjI5MzRGQTZERTc5NzNCQzM3QjdCQTJCRXKABDdERkI0MjQzNDU4OTVBOTcwNjRDRDM1MTA2Q0U5NzIwMDQyQUMwM0I0RDFEQTg4Q0VBRERGNjZDRjZERTIwNDc4M0EyQ0Y2QjVFMzc0M0FEMzA1MjVBMzZFRDE0QTQ3RjY3N0VCNjE4NUREMTBFRjY4ODA2RkY4NjVBMjU2RTJGMEIwMzRFOUExOTc5MUFDRjYzNDE5NjlCNkRBQkIyODczRkE1NDg3MTM5NDYyNzBDMDQ1RUI3REZGNDRENEFFNTRCNDM5RUYwREQyNjZFRDc2RDhFQjNGQ0ZGRUY4M0M2OEE2MjIyNzMwNDA0QzA3NUE0NjI3M0UyNDNDQjEzRjM5RDAwQjY2MEI0OEYwNjNBMDcyNEY1Q0Q3MjYxQTFBMUVEMDVDNjc1MzcxMDA0QzU4OUZEODM5REE2MjUxRDFEQzkwNUU2RjJGRTk0NDUwNTkwNjNCMDRDQUE4MUI2RUVFRkEzNUU1QTEwQjZEMTkxNjQ4QUJCNkY4N0E0RTFEQzNEMzFBNzBCOEM4MjNDQkM1RDEwRkUzRjQ4QUE4OThBNzY1MjE2N0FFMEFFNzA2QjNBOTgwQUE3MjgyQTkzM0VFODIzRkE1MUU1OEFERDQxRkQ0NjNDQTM5MjJENEVCRUZFMDE5NjZBNjI1NURBRDc5N0QwRTE0Qzg3M0RDNDAwOosBCkAwMkNGM0JGRjg3OUEzRDRDMUNGNDExQzA2M0VGQzk2REE3RTdEMERBMERBRDIyMUVBRUVDN0E0MTVDMkUzRTI3EkAwMTZCMDFCQkIxMENDMDY5N0VDNUYwMjBDRURCODU3RDcyOTI3MjBCRDdCNDk0MDYyMkIzQzY5OTQxMUQyOTMwGgVzdGFyaw.."
+};
+#endif
 
-    //create context (define in Li24/sign/context.h)
+// How a signer runs. The defaults exchange base64 messages through map_id_message_queue and verify the messages in
+// the calling thread.
+struct SignOptions {
+    // Executor shared by all the signers, nullptr to verify messages in the calling thread
+    safeheron::mpc_flow::mpc_parallel_v2::Executor *executor_;
+    // Encoding of the messages exchanged by the signers
+    safeheron::mpc_flow::mpc_parallel_v2::MessageEncoding message_encoding_;
+    // In-process transport between the signers, nullptr to go through map_id_message_queue
+    safeheron::mpc_flow::mpc_parallel_v2::LocalTransport *local_transport_;
+    // Sink of the measurements of the signers, nullptr to measure nothing
+    safeheron::mpc_flow::mpc_parallel_v2::InstrumentationSink *instrumentation_sink_;
+
+    SignOptions(): executor_(nullptr),
+                   message_encoding_(safeheron::mpc_flow::mpc_parallel_v2::MessageEncoding::Base64),
+                   local_transport_(nullptr),
+                   instrumentation_sink_(nullptr) {}
+};
+
+// A signer with a key handle creates the context from the handle, the others trim their sign key themselves.
+bool sign(std::string sign_key_base64, std::shared_ptr<const safeheron::multi_party_ecdsa::Li24::SignKeyHandle> key_handle,
+          std::vector<std::string> participants, BN m, SignOptions options) {
+    bool ok = true;
     Context ctx(participants.size());
-    ok = Context::CreateContext(ctx, t_sign_key_base64, m);
-    if (!ok) return false;
+    if (key_handle) {
+        //create context from the parsed sign key, trimmed to the participants
+        ok = Context::CreateContext(ctx, *key_handle, participants, m);
+        if (!ok) return false;
+    } else {
+        //preprocess sign key to fit t-n threshold
+        std::string t_sign_key_base64;
+        ok = safeheron::multi_party_ecdsa::Li24::trim_sign_key(t_sign_key_base64, sign_key_base64, participants);
+        if (!ok) return false;
 
-    for (size_t i = 0; i < ctx.sign_key_.remote_parties_.size(); ++i) {
-        ctx.sign_key_.remote_parties_[i].prg.reset();
-        ctx.sign_key_.remote_parties_[i].prg.init(ctx.sign_key_.remote_parties_[i].seed_);
+        //create context (define in Li24/sign/context.h)
+        ok = Context::CreateContext(ctx, t_sign_key_base64, m);
+        if (!ok) return false;
+    }
+    ctx.set_executor(options.executor_);
+    ctx.set_message_encoding(options.message_encoding_);
+    ctx.set_instrumentation_sink(options.instrumentation_sink_);
+
+    safeheron::mpc_flow::mpc_parallel_v2::LocalTransport *local_transport = options.local_transport_;
+    size_t local_index = 0;
+    if (local_transport) {
+        ok = local_transport->IndexOf(ctx.sign_key_.local_party_.party_id_, local_index);
+        if (!ok) return false;
     }
 
     std::string status = "<== Context of " + ctx.sign_key_.local_party_.party_id_ + " was created\n";
@@ -79,10 +152,17 @@ bool sign(std::string sign_key_base64, std::vector<std::string> participants, BN
             }
         } else {
             for(size_t k = 0; k < participants.size() - 1; k++) {
-                Msg m;
-                ThreadSafeQueue<Msg> &in_queue = map_id_message_queue.at(ctx.sign_key_.local_party_.party_id_).get(round - 1);
-                in_queue.Pop(m);
-                ok = ctx.PushMessage(m.p2p_msg_, m.bc_msg_, m.src_, round - 1);
+                if (local_transport) {
+                    LocalMessage m;
+                    ok = local_transport->Receive(local_index, round - 1, m);
+                    if (!ok) return false;
+                    ok = ctx.PushMessage(m.p2p_msg_, m.bc_msg_, local_transport->party_id(m.src_), round - 1);
+                } else {
+                    Msg m;
+                    ThreadSafeQueue<Msg> &in_queue = map_id_message_queue.at(ctx.sign_key_.local_party_.party_id_).get(round - 1);
+                    in_queue.Pop(m);
+                    ok = ctx.PushMessage(m.p2p_msg_, m.bc_msg_, m.src_, round - 1);
+                }
                 if (!ok) {
                     print_context_stack_if_failed(&ctx);
                     return false;
@@ -108,6 +188,15 @@ bool sign(std::string sign_key_base64, std::vector<std::string> participants, BN
         }
 
         for (size_t j = 0; j < out_des_arr.size(); ++j) {
+            if (local_transport) {
+                size_t dst = 0;
+                ok = local_transport->IndexOf(out_des_arr[j], dst) &&
+                     local_transport->Send(dst, LocalMessage(local_index, round,
+                                                             out_p2p_message_arr.empty() ? "" : out_p2p_message_arr[j],
+                                                             out_bc_message));
+                if (!ok) return false;
+                continue;
+            }
             Msg m = {ctx.sign_key_.local_party_.party_id_, out_bc_message, out_p2p_message_arr.empty() ? "": out_p2p_message_arr[j]};
             ThreadSafeQueue<Msg> &out_queue = map_id_message_queue.at(out_des_arr[j]).get(round);
             out_queue.Push(m);
@@ -124,81 +213,638 @@ bool sign(std::string sign_key_base64, std::vector<std::string> participants, BN
     return true;
 }
 
-TEST(Li24, sign_t_n_mt) {
+// Run every participant in a thread of its own, the i-th one with the i-th sign key (and key handle, if any).
+bool sign_all(const std::string sign_key_base64_arr[], const std::vector<std::string> &participants, const BN &m,
+              const SignOptions &options,
+              const std::vector<std::shared_ptr<const safeheron::multi_party_ecdsa::Li24::SignKeyHandle>> &key_handle_arr = {}) {
+    //Initialize the message queue
+    for (const std::string &party_id : participants) {
+        map_id_message_queue[party_id] = PartyMessageQue<Msg>(ROUNDS);
+    }
+    std::vector<std::future<bool> > res(participants.size());
+    for (size_t i = 0; i < participants.size(); ++i) {
+        std::shared_ptr<const safeheron::multi_party_ecdsa::Li24::SignKeyHandle> key_handle;
+        if (!key_handle_arr.empty()) key_handle = key_handle_arr[i];
+        res[i] = std::async(std::launch::async, sign, sign_key_base64_arr[i], key_handle, participants, m, options);
+    }
+    bool ok = true;
+    for (size_t i = 0; i < participants.size(); ++i) {
+        ok = res[i].get() && ok;
+    }
+    return ok;
+}
 
-    //The common parameters for different curves.
-    std::string party_ids[N_PARTIES] = {
-            "co_signer1",
-            "co_signer2",
-            "co_signer3",
-            "co_signer4",
-            "co_signer5"
-    };
-    safeheron::bignum::BN m = BN("1234567812345678123456781234567812345678123456781234567812345678", 16);
-    std::vector<std::string> participants = {"co_signer1", "co_signer2","co_signer3","co_signer4"};
-    std::vector<std::future<bool> >res;
-    res.resize(participants.size());
+bool set_prg_type(std::string &out_sign_key_base64, const std::string &in_sign_key_base64, PRGType prg_type) {
+    safeheron::multi_party_ecdsa::Li24::SignKey sign_key;
+    bool ok = sign_key.FromBase64(in_sign_key_base64);
+    if (!ok) return false;
+    sign_key.prg_type_ = prg_type;
+    return sign_key.ToBase64(out_sign_key_base64);
+}
 
+TEST(Li24, prg_counter_random_access) {
+    PRG prg;
+    prg.set_type(PRGType::Counter);
+    prg.reset();
+    prg.init(BN("1234567812345678123456781234567812345678123456781234567812345678", 16));
+    for (uint64_t i = 0; i < 16; ++i) {
+        EXPECT_TRUE(prg.rand() == prg.rand_at(i));
+    }
+    EXPECT_TRUE(prg.rand_at(3) != prg.rand_at(4));
+}
 
-    //SECP256K1 sample
-    printf("Test Li24 sign with secp256k1 curve\n");
-    //SECP256K1 sign key
-    std::string sign_key_base64_arr[N_PARTIES]={
-        "Cgt3b3Jrc3BhY2UgMBAEGAUq7AMKCmNvX3NpZ25lcjEaAjAxQkA2MjdBNkUxNUE2Qzk2RDZFM0FENzg5NDREMUFFRDY1N0ZBQUM4RTkzNDBFMUFFRTcyRjg4MTAyRDE1Nzk1RTYySo8BCkA2MjM5MTdFNjhGOTMwNDI3RDI5Q0E4MTJCNzEyQjM2QTE2QzgzOTUyRjJFRkJGM0NFNjZDQzg2MjEzMjI4RkFDEkBCNzZBOTM3RDJERTdCMzMzQzgzMTYwRTIzRUE1MTc1ODJBQjJFRDU4NkJCQjYxNDFBMDVENzZFRUJBRkYzNzBFGglzZWNwMjU2azFSQDIwNzhBQzUzMDZFNkNFQTc0RTg2Q0NCNTE1NjFEMjlCRTJFRkI0OUU0QzJDRDg5MTdGMzREODA2MUI5RTlEQThSQDZGMTU3MEYxRUZEMjZBMTlERDgyNzREMkU0MkM4Rjc0NUUzQ0MzMENBODQyNjUxQTBFRDJDMDE4MzVDNEFCOTFSQDM5Q0U0OEI4QjY2RDIyRjZCMTY5M0I5QTY1MTg4RkIzRDk4REUxODJENEZFMjhDNzFGRTE1MjgwNTMxOTcyM0NSQDc4Q0VDMUQzQ0ZCNkExRkMzN0Q3NTcyRTc1QzMwN0IzOEZGODRFRjE4QjM5Qjg1RDY2MzRGRjU1NzM0ODY3ODAyUgoKY29fc2lnbmVyMhoCMDJSQDczOTYyNUQ4Njc3QTc2MTA5N0NEMkY3RTNEODY4M0NBQTVBNkNDNkUxRTRCQjU1RUNCMTUyNDA4QjRDN0IxNjcyUgoKY29fc2lnbmVyMxoCMDNSQEJFQUEwMEY3N0FFMkJGMUIzRjE3RjgxMzE0N0MwNThCRjYyRjg0QzdDMDg5OTVEMDA3RUUyNzc0OTYxNTY0MjkyUgoKY29fc2lnbmVyNBoCMDRSQDNCNEQwN0VEOTEwNTRDMTJCODQyMTA3NkE1NUY1NDZGRDc1QkNDNzgwMzZBRjk5RjUyMjk4NUYwQzQyQjM3NjQyUgoKY29fc2lnbmVyNRoCMDVSQENFNDlGMjZCQkE5RkFDRkM2RDRCNDM2NEVFMzBGNkExNEU0NTExQjUzRTQ2RDIzMjFGQTdFOUZFOUUwQzU2OUM6jwEKQDU5MzRCOUNBRDNBQkU3NkM5MDEyMEI4MkM3ODkwNkQ0QjBGODMwOTk1NDM5QjhEMzFCOTFBMzQ2N0RDQjZGQzESQEFDRUIxQ0Q2OUY5QkMxNTY4MzczRUJFRjdENUY1NTdFQTUzNDFCQ0Y4QjFFNEY3MEM3RDI0OUExREYxMzdBOTgaCXNlY3AyNTZrMQ.",
-        "Cgt3b3Jrc3BhY2UgMBAEGAUq7AMKCmNvX3NpZ25lcjIaAjAyQkBDRTcyQ0VBQjY3NTYwQzM0QzkzNzFEMjBCQjMwRjUyMDZGMkM2OTBCMjA0MjA1MEE0NjVBMTk1REE1OERGMkNDSo8BCkBEREIzQkRCNEYwMTA2Rjk4NjNGQjc0OTk0NEQ1MDg5ODEyQjU2RjI5MjlBN0E4NDQxNEE0M0Q1RkQ1OEUwNzE3EkAyRUZDMzVGOUE2MUUxRTRCNkRFQkNEMzQ0NDVFQjQzMTMzNTBDMDBGOEYyMEY4ODEzNkRGRUQ2QzE2MEFEOUI4GglzZWNwMjU2azFSQDUzMUQ3OTg1NjA5M0E3Njk0OTQ2NjJDOTI4MjRCMTJFQzJCNzE3Q0ZEMjFFRENDRDRCRTA0QzAyOTkyOTEzQkZSQDFENUQ2OTk2OUYxQUJDMkFEQ0U4NUFBQkUyOTkxNEU4Mzk0OTY2MUYzRDhGNzQ4QzdDRTg1MUM2QTI5N0I1REVSQDBFQkQ2MzFGNzBDMTcxMzgwMzVGNTU3OTdCNTFFRTNDQ0JFMTExNkNEQTI5MDc0MjBENDVGMkM4N0I4M0M0NTVSQDExQUEzRjI5MTA0MDRFNUMyMEJBQTRBMjhBNkM0OURGNDg1QjExMEUyM0EyM0NFODgwRkY3Njg4MEMxNjc3MkYyUgoKY29fc2lnbmVyMRoCMDFSQDczOTYyNUQ4Njc3QTc2MTA5N0NEMkY3RTNEODY4M0NBQTVBNkNDNkUxRTRCQjU1RUNCMTUyNDA4QjRDN0IxNjcyUgoKY29fc2lnbmVyMxoCMDNSQDI4RDBBODY3QjYzNDQ4Q0E1QjUyRUFCOTVFRUYzRjM0MEE3ODY5MjZBQ0RDQjhDREZFOEJGMkZBQjg3ODAwNzQyUgoKY29fc2lnbmVyNBoCMDRSQDMwODIwMjYxNEIzNEI1RjRGNjE5NTI2OTNDNDk2QTdGOEQ3MUIxMUZCMERFMjdFQUNCNThCMThFNjdCMkM2OTIyUgoKY29fc2lnbmVyNRoCMDVSQDU4NDk5QjQ2MkE3RkRFNDU2NUIwOUU4MkUwRUFCMkJGNDUzM0FCODFEQzMyMzc2QUZEQTM2RjE3OEU5QjU2MTA6jwEKQDU5MzRCOUNBRDNBQkU3NkM5MDEyMEI4MkM3ODkwNkQ0QjBGODMwOTk1NDM5QjhEMzFCOTFBMzQ2N0RDQjZGQzESQEFDRUIxQ0Q2OUY5QkMxNTY4MzczRUJFRjdENUY1NTdFQTUzNDFCQ0Y4QjFFNEY3MEM3RDI0OUExREYxMzdBOTgaCXNlY3AyNTZrMQ.",
-        "Cgt3b3Jrc3BhY2UgMBAEGAUq7AMKCmNvX3NpZ25lcjMaAjAzQkAxQkEyQjg4MzBGODEzRDQwQjhDNEQ0REYzMDg3MkI2OUZBMzdFMDg5REM2OTA1REQxOTIzRDM5QUVFRTU2NDlESo8BCkAwQzA0NTlBNTE5RUMzODIxN0I3N0NGRTg0NEY5MzMzNzlFRTcxQ0RDRTcyNUEwQjk0MDM2Nzg5OUExM0QwNUVDEkBFREQwRkI0Mjc0NzM0ODhGQkRERTVENkFCOEQ2QzUyQUQ3ODhGQzJBMEIyNUNDNUU2MTA4ODIyRjBFNDM0QTg2GglzZWNwMjU2azFSQDRGOTQ5MDA1OEIxMDU1MDE2MTk1ODM0MDMwNEY3NjE3OTdGMkMxQkIxODQ3MzBCNUY5MUI2NzVDNjA1MEI4OThSQDBCNzMzRUQxMTcxOThDOUY3RTZBOTAwRDdDNTYyQTRCRDEyRjAzMDc2RjRENDQ0MTgxQTNBMTM0MTVFMDRBOTZSQDU4QjEwODhEREYwMTBEODFEMTlBRjQyNDhBMUQyMzVENDU2MDQ1MjNDODU5MkI0RDVCNUZBMkVBMUI0MjJBRTFSQDVGRDA4N0EwMEM1OERERTc0NjYyRTRDNjQ3NjBERTU1RDg3M0I3NTVGRTdBNzE0QTg4QTYwNDREMkQ3MTdCMzkyUgoKY29fc2lnbmVyMRoCMDFSQEJFQUEwMEY3N0FFMkJGMUIzRjE3RjgxMzE0N0MwNThCRjYyRjg0QzdDMDg5OTVEMDA3RUUyNzc0OTYxNTY0MjkyUgoKY29fc2lnbmVyMhoCMDJSQDI4RDBBODY3QjYzNDQ4Q0E1QjUyRUFCOTVFRUYzRjM0MEE3ODY5MjZBQ0RDQjhDREZFOEJGMkZBQjg3ODAwNzQyUgoKY29fc2lnbmVyNBoCMDRSQEE4MEQ2NDI5QzQ3M0Q5MDY2N0FCQzQ4REI2REE0NEI0RkJENEM1OUQ1MkZFNEQzNDg5RkJFOTYxMzQwQjMzNUQyUgoKY29fc2lnbmVyNRoCMDVSQEI1NUE2RjkyQkYwQ0EwQ0UxNDdDQTA5NDY1NUJEOEM3OUYxMjA4MzczOEQ2NzgwNkI2MjdFRkQ0QUQ2NzFCQUE6jwEKQDU5MzRCOUNBRDNBQkU3NkM5MDEyMEI4MkM3ODkwNkQ0QjBGODMwOTk1NDM5QjhEMzFCOTFBMzQ2N0RDQjZGQzESQEFDRUIxQ0Q2OUY5QkMxNTY4MzczRUJFRjdENUY1NTdFQTUzNDFCQ0Y4QjFFNEY3MEM3RDI0OUExREYxMzdBOTgaCXNlY3AyNTZrMQ.",
-        "Cgt3b3Jrc3BhY2UgMBAEGAUq7AMKCmNvX3NpZ25lcjQaAjA0QkAyNTc5Mjg1RjBBQTIxRUFBMkU4QzU1QTYzNUYwODZEOTZENjc0QjZFMThFMzM4OUQ1MTIwNkI3MjIzNkQ1NEVBSo8BCkBERjc0RjMzNUVGQkVDMkZCQ0E3RDBFMkVEMDYyMzQ5OEQ0MzBCMzgyRTAyQkI5REM0MDI1QUEzQ0Q2REExNkIyEkA1OUU2ODcyOTczNjhGMjZERjVCOEREMTY2RDkxQkY1NjFBNDM2NkU0RDI1MzE5OUNFNTNEQTdDMDMwQ0M4NThCGglzZWNwMjU2azFSQDAxN0VCRjM0REE5ODI5MUMwNkQ4RDREQzQwNDZDNEJCRkRDREVBRjUyRTZDRDBEODMyNDgzMzcwNzExMUM1MjhSQDIxQzQ5RjQxREE3MzQ0QkNGMkI5RkNFRkMwRjc3QzQyQzE5MDlGQjJENkI1MjBBOEJFMTJCRUM1RUMyRjAyM0RSQDRGNUM1QjlCRTU3MkNCODQ5NjEwRDA2OTJDQkQyMTU3QjY3NDgwNzk4QUE1MjFFNzJFOUM0Njc3MThDOTA4N0NSQDFBQkEyRTU1RUZDMUI2NjBDMzY1RUFDMjZBRDY4NURGQ0U5QTM2QkYxN0Q0OTQ5QTIxOEI0MTMwN0QwMEI0NzcyUgoKY29fc2lnbmVyMRoCMDFSQDNCNEQwN0VEOTEwNTRDMTJCODQyMTA3NkE1NUY1NDZGRDc1QkNDNzgwMzZBRjk5RjUyMjk4NUYwQzQyQjM3NjQyUgoKY29fc2lnbmVyMhoCMDJSQDMwODIwMjYxNEIzNEI1RjRGNjE5NTI2OTNDNDk2QTdGOEQ3MUIxMUZCMERFMjdFQUNCNThCMThFNjdCMkM2OTIyUgoKY29fc2lnbmVyMxoCMDNSQEE4MEQ2NDI5QzQ3M0Q5MDY2N0FCQzQ4REI2REE0NEI0RkJENEM1OUQ1MkZFNEQzNDg5RkJFOTYxMzQwQjMzNUQyUgoKY29fc2lnbmVyNRoCMDVSQDk3NjQyNzJFQkJBQzY5RDFGQkM3NEY4QjU1QTA4ODU5NzhEMUZCQ0FFOThEODBDOTY5ODcxMzQ2RTQ0MDlGNDI6jwEKQDU5MzRCOUNBRDNBQkU3NkM5MDEyMEI4MkM3ODkwNkQ0QjBGODMwOTk1NDM5QjhEMzFCOTFBMzQ2N0RDQjZGQzESQEFDRUIxQ0Q2OUY5QkMxNTY4MzczRUJFRjdENUY1NTdFQTUzNDFCQ0Y4QjFFNEY3MEM3RDI0OUExREYxMzdBOTgaCXNlY3AyNTZrMQ.",
-        "Cgt3b3Jrc3BhY2UgMBAEGAUq7AMKCmNvX3NpZ25lcjUaAjA1QkBDNzY1MUIwMUM0MEZDRTg5NEY5OTQ0OUJDRkFDMTUxNjI0RjU0NjQ5MUFBQkU0MTExN0U2NTA1NkQ0QTZFMjQ2So8BCkAzQzM2MzVBQjJBMjMyNUY5MjFBRjk3RkM4RTZBMTIzQ0QzNEYwQURDQ0ZBNkMyMjhFQ0ZCRUU1RjQ5MTZEODFFEkAwNTg0MTVGMTQ2MDcyNUFCNkMzMTc5NjZBOUZGMjVDNDRGNjY4OURENTExNTg0QTdBNEJEMEMyNTY2QzJFQjExGglzZWNwMjU2azFSQDU1N0IzMDk3RUFFOTBCMDAzNTczRUMzNjc4NkRFRUVEQkU0Q0MyQzNCMzBEMTlENEI5NzJFQUE5MkFDM0VGMUNSQDQ2OUY1QzFEMUEzRjhGRTk0NEY1RjlFMDU2N0U2OERGRkNEODlBNzNCODhGRkE4MjdDQTNGODhGODI4NERFRTFSQDU1ODlFN0YyQjJCM0MyRTZDRTE5QkJDRTFERkFGQTcxQzY5RTUwRTEzQTVDMDZCQzJEODFFQjg3N0ZGNUEwNzFSQDdDQTlGOEQ4Q0JFQUIzNzEzODYxNjRDOEVBQ0EwMjc5QUEzN0M1MEJEMUI4RUMyRjQ3RkJEMjE2NjczRkVBQ0IyUgoKY29fc2lnbmVyMRoCMDFSQENFNDlGMjZCQkE5RkFDRkM2RDRCNDM2NEVFMzBGNkExNEU0NTExQjUzRTQ2RDIzMjFGQTdFOUZFOUUwQzU2OUMyUgoKY29fc2lnbmVyMhoCMDJSQDU4NDk5QjQ2MkE3RkRFNDU2NUIwOUU4MkUwRUFCMkJGNDUzM0FCODFEQzMyMzc2QUZEQTM2RjE3OEU5QjU2MTAyUgoKY29fc2lnbmVyMxoCMDNSQEI1NUE2RjkyQkYwQ0EwQ0UxNDdDQTA5NDY1NUJEOEM3OUYxMjA4MzczOEQ2NzgwNkI2MjdFRkQ0QUQ2NzFCQUEyUgoKY29fc2lnbmVyNBoCMDRSQDk3NjQyNzJFQkJBQzY5RDFGQkM3NEY4QjU1QTA4ODU5NzhEMUZCQ0FFOThEODBDOTY5ODcxMzQ2RTQ0MDlGNDI6jwEKQDU5MzRCOUNBRDNBQkU3NkM5MDEyMEI4MkM3ODkwNkQ0QjBGODMwOTk1NDM5QjhEMzFCOTFBMzQ2N0RDQjZGQzESQEFDRUIxQ0Q2OUY5QkMxNTY4MzczRUJFRjdENUY1NTdFQTUzNDFCQ0Y4QjFFNEY3MEM3RDI0OUExREYxMzdBOTgaCXNlY3AyNTZrMQ."
-    };
-    //Initialize the message queue
+TEST(Li24, prg_seek) {
+    BN seed("1234567812345678123456781234567812345678123456781234567812345678", 16);
+    PRGType types[2] = {PRGType::HashChain, PRGType::Counter};
+    for (PRGType type : types) {
+        PRG sequential;
+        sequential.set_type(type);
+        sequential.reset();
+        sequential.init(seed);
+        vector<BN> out_arr;
+        for (int i = 0; i < 10; ++i) {
+            out_arr.push_back(sequential.rand());
+        }
+
+        PRG prg;
+        prg.set_type(type);
+        prg.reset();
+        prg.init(seed);
+        prg.seek(7);
+        EXPECT_EQ(prg.position(), 7u);
+        EXPECT_TRUE(prg.rand() == out_arr[7]);
+        prg.seek(2);
+        EXPECT_TRUE(prg.rand() == out_arr[2]);
+        prg.seek(9);
+        EXPECT_TRUE(prg.rand() == out_arr[9]);
+    }
+}
+
+// The hash chain keeps writing to the same CSHA256, whose Finalize() pads the stream without resetting it
+TEST(Li24, prg_hash_chain) {
+    BN seed("1234567812345678123456781234567812345678123456781234567812345678", 16);
+    PRG prg;
+    prg.set_type(PRGType::HashChain);
+    prg.reset();
+    prg.init(seed);
+    BN out1 = prg.rand();
+    BN out2 = prg.rand();
+
+    uint8_t stream[96] = {0};
+    uint8_t hash[32];
+    seed.ToBytes32LE(stream);
+    safeheron::hash::CSHA256 sha256;
+    sha256.Write(stream, 32);
+    sha256.Finalize(hash);
+    EXPECT_TRUE(out1 == BN::FromBytesLE(hash, 32));
+
+    // out_2 = SHA256(LE32(seed) || padding of 32 bytes || LE32(out_1)), not SHA256(LE32(out_1))
+    stream[32] = 0x80;
+    stream[62] = 0x01;
+    out1.ToBytes32LE(stream + 64);
+    sha256.Reset();
+    sha256.Write(stream, 96);
+    sha256.Finalize(hash);
+    EXPECT_TRUE(out2 == BN::FromBytesLE(hash, 32));
+}
+
+// A hash-chain key is replayed up to its cursors on load, so the cursors are bounded. A counter-mode key is not.
+TEST(Li24, prg_cursor_limit) {
+    safeheron::multi_party_ecdsa::Li24::SignKey sign_key;
+    ASSERT_TRUE(sign_key.FromBase64(secp256k1_sign_key_base64_arr[0]));
+    PRGType types[2] = {PRGType::HashChain, PRGType::Counter};
+    for (PRGType type : types) {
+        sign_key.prg_type_ = type;
+        safeheron::proto::multi_party_ecdsa::Li24::SignKey proto_sign_key;
+        ASSERT_TRUE(sign_key.ToProtoObject(proto_sign_key));
+        proto_sign_key.mutable_remote_parties(0)->mutable_prg_cursor()->set_position(PRG_MAX_CHAIN_POSITION);
+        safeheron::multi_party_ecdsa::Li24::SignKey loaded_sign_key;
+        EXPECT_TRUE(loaded_sign_key.FromProtoObject(proto_sign_key));
+
+        proto_sign_key.mutable_remote_parties(0)->mutable_prg_cursor()->set_position(PRG_MAX_CHAIN_POSITION + 1);
+        safeheron::multi_party_ecdsa::Li24::SignKey over_limit_sign_key;
+        EXPECT_EQ(over_limit_sign_key.FromProtoObject(proto_sign_key), type == PRGType::Counter);
+    }
+}
+
+// Consume one signature worth of outputs, save the key and check the reloaded key resumes at the same position.
+bool check_prg_cursor_resume(const std::string &sign_key_base64) {
+    safeheron::multi_party_ecdsa::Li24::SignKey sign_key;
+    bool ok = sign_key.FromBase64(sign_key_base64);
+    if (!ok) return false;
+    PRG &prg = sign_key.remote_parties_[0].prg;
+    for (uint64_t i = 0; i < PRG_OUTPUTS_PER_SIGN; ++i) {
+        prg.rand();
+    }
+
+    std::string resumed_sign_key_base64;
+    ok = sign_key.ToBase64(resumed_sign_key_base64);
+    if (!ok) return false;
+    safeheron::multi_party_ecdsa::Li24::SignKey resumed_sign_key;
+    ok = resumed_sign_key.FromBase64(resumed_sign_key_base64);
+    if (!ok) return false;
+    PRG &resumed_prg = resumed_sign_key.remote_parties_[0].prg;
+    ok = resumed_prg.position() == PRG_OUTPUTS_PER_SIGN;
+    if (!ok) return false;
+    return resumed_prg.rand() == prg.rand();
+}
+
+// Sign in one thread with the stored keys, as they are, then store every key again with the PRG cursors of its
+// finished context, as a signer which persists its key after each signature does.
+bool sign_and_persist(std::string sign_key_base64_arr[], const std::vector<std::string> &participants, const BN &m) {
+    std::vector<std::unique_ptr<Context>> ctx_arr;
+    for (size_t i = 0; i < participants.size(); ++i) {
+        std::string t_sign_key_base64;
+        if (!safeheron::multi_party_ecdsa::Li24::trim_sign_key(t_sign_key_base64, sign_key_base64_arr[i], participants)) return false;
+        ctx_arr.emplace_back(new Context(participants.size()));
+        if (!Context::CreateContext(*ctx_arr[i], t_sign_key_base64, m)) return false;
+    }
+
+    std::vector<std::vector<Msg>> inbox_arr(participants.size());
+    for (int round = 0; round < ROUNDS; ++round) {
+        std::vector<std::vector<Msg>> next_inbox_arr(participants.size());
+        for (size_t i = 0; i < participants.size(); ++i) {
+            Context &ctx = *ctx_arr[i];
+            bool ok = (round == 0) ? ctx.PushMessage() : true;
+            for (const Msg &msg : inbox_arr[i]) {
+                ok = ok && ctx.PushMessage(msg.p2p_msg_, msg.bc_msg_, msg.src_, round - 1);
+            }
+            std::string out_bc_message;
+            vector<string> out_p2p_message_arr;
+            vector<string> out_des_arr;
+            ok = ok && ctx.IsCurRoundFinished() && ctx.PopMessages(out_p2p_message_arr, out_bc_message, out_des_arr);
+            if (!ok) {
+                print_context_stack_if_failed(&ctx);
+                return false;
+            }
+            for (size_t j = 0; j < out_des_arr.size(); ++j) {
+                size_t dst = std::find(participants.begin(), participants.end(), out_des_arr[j]) - participants.begin();
+                if (dst == participants.size()) return false;
+                next_inbox_arr[dst].push_back(Msg{participants[i], out_bc_message,
+                                                  out_p2p_message_arr.empty() ? "" : out_p2p_message_arr[j]});
+            }
+        }
+        inbox_arr.swap(next_inbox_arr);
+    }
+
+    for (size_t i = 0; i < participants.size(); ++i) {
+        if (!ctx_arr[i]->IsFinished()) return false;
+        safeheron::multi_party_ecdsa::Li24::SignKey sign_key;
+        if (!sign_key.FromBase64(sign_key_base64_arr[i])) return false;
+        if (!sign_key.AdvanceCursors(ctx_arr[i]->sign_key_)) return false;
+        if (!sign_key.ToBase64(sign_key_base64_arr[i])) return false;
+    }
+    return true;
+}
+
+// Sign twice, saving and reloading the keys in between. The second signature must draw new PRG outputs, and only
+// the pairs which took part move forward. A signer which did not save its key is out of step with the others.
+bool check_sign_resume(const std::string sign_key_base64_arr[], const std::vector<std::string> &participants, const BN &m) {
+    std::string stored_sign_key_base64_arr[N_PARTIES];
     for (int i = 0; i < N_PARTIES; ++i) {
-        map_id_message_queue[party_ids[i]] = PartyMessageQue<Msg>(ROUNDS);
+        stored_sign_key_base64_arr[i] = sign_key_base64_arr[i];
+    }
+    for (int turn = 0; turn < 2; ++turn) {
+        if (!sign_and_persist(stored_sign_key_base64_arr, participants, m)) return false;
     }
+
+    safeheron::multi_party_ecdsa::Li24::SignKey sign_key;
+    if (!sign_key.FromBase64(stored_sign_key_base64_arr[0])) return false;
+    for (const auto &remote_party : sign_key.remote_parties_) {
+        bool signer = std::find(participants.begin(), participants.end(), remote_party.party_id_) != participants.end();
+        if (remote_party.prg.position() != (signer ? 2 * PRG_OUTPUTS_PER_SIGN : 0)) return false;
+    }
+
+    stored_sign_key_base64_arr[0] = sign_key_base64_arr[0];
+    return !sign_and_persist(stored_sign_key_base64_arr, participants, m);
+}
+
+// Run round 0 and hand the first signer its messages, with the shares of one sender which has to send them left out.
+// The empty payloads sent outside the windows are taken, the one left out is rejected.
+bool check_empty_p2p_rejected(const std::string sign_key_base64_arr[], const std::vector<std::string> &participants,
+                              const BN &m, size_t &out_sparse_count) {
+    std::vector<std::unique_ptr<Context>> ctx_arr;
+    std::vector<Msg> inbox;
     for (size_t i = 0; i < participants.size(); ++i) {
-        res[i] = std::async(std::launch::async, sign, sign_key_base64_arr[i], participants, m);
+        std::string t_sign_key_base64;
+        if (!safeheron::multi_party_ecdsa::Li24::trim_sign_key(t_sign_key_base64, sign_key_base64_arr[i], participants)) return false;
+        ctx_arr.emplace_back(new Context(participants.size()));
+        if (!Context::CreateContext(*ctx_arr[i], t_sign_key_base64, m)) return false;
+        std::string out_bc_message;
+        vector<string> out_p2p_message_arr;
+        vector<string> out_des_arr;
+        if (!ctx_arr[i]->PushMessage() || !ctx_arr[i]->PopMessages(out_p2p_message_arr, out_bc_message, out_des_arr)) return false;
+        for (size_t j = 0; j < out_des_arr.size(); ++j) {
+            if (out_des_arr[j] == participants[0]) {
+                inbox.push_back(Msg{participants[i], out_bc_message, out_p2p_message_arr[j]});
+            }
+        }
     }
+
+    out_sparse_count = 0;
+    auto iter = std::find_if(inbox.begin(), inbox.end(), [](const Msg &msg) { return !msg.p2p_msg_.empty(); });
+    if (iter == inbox.end()) return false;
+    Msg stripped = *iter;
+    stripped.p2p_msg_.clear();
+    inbox.erase(iter);
+    for (const Msg &msg : inbox) {
+        if (msg.p2p_msg_.empty()) ++out_sparse_count;
+        if (!ctx_arr[0]->PushMessage(msg.p2p_msg_, msg.bc_msg_, msg.src_, 0)) return false;
+    }
+    return !ctx_arr[0]->PushMessage(stripped.p2p_msg_, stripped.bc_msg_, stripped.src_, 0);
+}
+
+
+// Run round 0 and hand the first signer, which verifies the messages on the executor, one of them twice. The copy is
+// rejected before it is parsed over the message still being verified.
+bool check_duplicate_rejected(const std::string sign_key_base64_arr[], const std::vector<std::string> &participants,
+                              const BN &m, safeheron::mpc_flow::mpc_parallel_v2::Executor *executor) {
+    std::vector<std::unique_ptr<Context>> ctx_arr;
+    std::vector<Msg> inbox;
     for (size_t i = 0; i < participants.size(); ++i) {
-        EXPECT_TRUE(res[i].get());
+        std::string t_sign_key_base64;
+        if (!safeheron::multi_party_ecdsa::Li24::trim_sign_key(t_sign_key_base64, sign_key_base64_arr[i], participants)) return false;
+        ctx_arr.emplace_back(new Context(participants.size()));
+        if (!Context::CreateContext(*ctx_arr[i], t_sign_key_base64, m)) return false;
+        std::string out_bc_message;
+        vector<string> out_p2p_message_arr;
+        vector<string> out_des_arr;
+        if (!ctx_arr[i]->PushMessage() || !ctx_arr[i]->PopMessages(out_p2p_message_arr, out_bc_message, out_des_arr)) return false;
+        for (size_t j = 0; j < out_des_arr.size(); ++j) {
+            if (out_des_arr[j] == participants[0]) {
+                inbox.push_back(Msg{participants[i], out_bc_message, out_p2p_message_arr[j]});
+            }
+        }
     }
 
+    Context &ctx = *ctx_arr[0];
+    ctx.set_executor(executor);
+    if (inbox.size() < 2) return false;
+    if (!ctx.PushMessage(inbox[0].p2p_msg_, inbox[0].bc_msg_, inbox[0].src_, 0)) return false;
+    if (ctx.PushMessage(inbox[0].p2p_msg_, inbox[0].bc_msg_, inbox[0].src_, 0)) return false;
+    vector<ErrorInfo> error_stack;
+    ctx.get_error_stack(error_stack);
+    for (const auto &err : error_stack) {
+        if (err.info_.find("Duplicate message from party " + inbox[0].src_) != std::string::npos) return true;
+    }
+    return false;
+}
 
-    //P256 sample
+// Sign with the metrics sink and return the bytes sent in the two rounds.
+bool sign_and_count_bytes(const std::string sign_key_base64_arr[], const std::vector<std::string> &participants, const BN &m,
+                          uint64_t &out_bytes) {
+    safeheron::mpc_flow::mpc_parallel_v2::MetricsSink metrics_sink("Li24.sign");
+    SignOptions options;
+    options.instrumentation_sink_ = &metrics_sink;
+    bool ok = sign_all(sign_key_base64_arr, participants, m, options);
+    out_bytes = 0;
+    for (int round = 0; round < ROUNDS; ++round) {
+        out_bytes += metrics_sink.GetBytes(round, false);
+    }
+    return ok;
+}
 
-    printf("Test Li24 sign with p256 curve\n");
-    //P256 sign key
-    sign_key_base64_arr[0]="Cgt3b3Jrc3BhY2UgMBAEGAUq5wMKCmNvX3NpZ25lcjEaAjAxQkBGOTVFNUUwOUE1MDdFQ0VCRUU4MTlCNUI5MTk5QzNDOEE4MEUyQzNCRTRBNkNCMzlENkI5RkExNThGQzRBQjBDSooBCkA5QjFFNTdGRDk0NERCQzZFOUY0OUE0NTk3OERCMzA4QTM5NkUxODI1MkYwQTY1RUFBRERFMDE0OEUyOTI5Q0JBEkA2MDJFNTkyN0MwNkE2MzM1QjE5MENDQzZGOTc5N0VERjM5QzZDNEFBQTc5NDk0MDZDM0JEQzY4OUY3MjU2QTA4GgRwMjU2UkA1MzBDRjM1RjUxRjQ3RTRCNUQwN0FFMkVEMzI4MzczNjhGOENFREJFRDk3QTNCOTIzNkYzMkUyOTFEOTY0NDc5UkA2QUZCNjJEQUJFQjlGMTIzM0NFNUFEQUE4OTlCMThENzVBQkVBMTEwQzJEQUU2RDhGNEU2NDk3NDYwOUU1OUJBUkA0MjAxNzREM0VBNUQ5RTQxNTIxQTlGQ0YyNDVFMjBBMzRGQzVCRjE2RTkwQTM2OUExRDNEREVEMDhFRDgzNEQzUkA1NzNBM0IzM0ZBMjg2ODZCNUY1QjkyQjhBMzJBMTFFNzhGMDQ1MUJDRENFNTc3QjJFNzM2OTFBNkY4RDQ2NjM3MlIKCmNvX3NpZ25lcjIaAjAyUkBDQzc5NjBEMDkwRDk2OTQ1RUYxRTU4NjU2N0VEQkFEQzkyODRCRjc5RTM5MjY5QjU3RDExMUYyMDcyNTI0NDgwMlIKCmNvX3NpZ25lcjMaAjAzUkBEMTc4Qzg2NTJBRUI0MUNGQjQzOUYyOTQzMDM1QUZDOTE4QzkzMDFEQ0E3RDkzRDY4MkM0NzJCM0VEM0RBNUY5MlIKCmNvX3NpZ25lcjQaAjA0UkA5OTdBNEFDOUQ2Q0QxMTk5QTk3QkVBMEI3QTJBM0JCNzcxNTM3RERFQTM3QTRENUZFMTlGMUI0QzJFNDlEMEVDMlIKCmNvX3NpZ25lcjUaAjA1UkA5NTAwMjU1QjQ2NkE2NjFFREExN0JDNTYzM0Q1MjRFQzA3QzczNEVDQjkzNDk4MjkzRjk3NjFBMTI5MTVGRjg1OooBCkBDMTQ1RDFDQzYxQzJFMjkyREZERERDNUFGRUUxM0E4QjZCRjQ4NzI4QUVCNzI4MzA1QjgxMDNDNDAwM0FDMTJBEkAxNTFGQUUwM0E3MjkwMkIzMTcyOURBQURDODc0NEY3NzM4REE2NjY1RUZFMjAzRkQ0RDJDQ0VBRjYxNTM4RTlEGgRwMjU2";
-    sign_key_base64_arr[1]="Cgt3b3Jrc3BhY2UgMBAEGAUq5wMKCmNvX3NpZ25lcjIaAjAyQkA5MEMyMDUwNDFBRDkzOTU1NkY1NDk3Njc4MTdERjk3ODA1NjU1MjU2QzREMEZCNENCMjdDMEFBMUZBQ0FDQjY1SooBCkBGQTUzRDgyQzVCM0VBNzUzQUI2MDI2MUFBRjkzRkU4OThEMEMyNTBCOEZEN0I3MjU5QjQwOUMzQjlEMEQ5MDFCEkA3RDU0MEMxRDVCNzRBOEFCRjVBQjVBMERERkU0MkVBRDRBNzU0QTQzMzJENUNFOTZGODE4OURGMjI5REZBNzZEGgRwMjU2UkA3OTZDNkQ3MTNFRTRFQUZBOTIxNkFBMzY5NEM1ODNBNjAyRjdEMUJCMEExODJFMjM0NjFERjBGNzU0QkMwMDA3UkAxODRBRDgxN0FFN0E0RUY1MEI1MkMyNzlGMjU4QUU5QTUyQTA2Q0FBRDlDQTkyQThBOTgwQTlEQjM2RDA3Q0ZEUkA2QTgwRkI4Q0E1REJBNTI2NzJGNkQzMUVEM0IwM0NDNjQxRDdGMkYzQTJGQTUyNDBFNjZGQjkyMjQzODVBQzc5UkA2QTMzQzUzQTk5NTlENDBFNTY5MEIzNzE5NDE1ODAzOTFEMDg1NjExNkZCNjc2RDEwOTdGODM3QzBERkQ1QjBCMlIKCmNvX3NpZ25lcjEaAjAxUkBDQzc5NjBEMDkwRDk2OTQ1RUYxRTU4NjU2N0VEQkFEQzkyODRCRjc5RTM5MjY5QjU3RDExMUYyMDcyNTI0NDgwMlIKCmNvX3NpZ25lcjMaAjAzUkAzNzlBMzA5NTQ2RUQ4OTlEOEJGMTc5NjUwNzRFMzQ3REI3ODQ0Q0I1M0E3MzAyMzgxQzZGMEM2ODhDQUZDRTFDMlIKCmNvX3NpZ25lcjQaAjA0UkA3MzQ1OUMxMEJERDQyQTZENUI3NEM2M0ZFRDAyOEY0OEI4Q0RCQkU5MEQzNTQyMDcxMDJENjEzNjdGRkIyODUwMlIKCmNvX3NpZ25lcjUaAjA1UkBDQTc4MTBEOTdDMUQyRkZEREI5QjBGN0FFOTI2MDU0MTM3MjdENDkzMUM1QUJCNUU4QTYxMTE0MDBBMThCN0NCOooBCkBDMTQ1RDFDQzYxQzJFMjkyREZERERDNUFGRUUxM0E4QjZCRjQ4NzI4QUVCNzI4MzA1QjgxMDNDNDAwM0FDMTJBEkAxNTFGQUUwM0E3MjkwMkIzMTcyOURBQURDODc0NEY3NzM4REE2NjY1RUZFMjAzRkQ0RDJDQ0VBRjYxNTM4RTlEGgRwMjU2";
-    sign_key_base64_arr[2]="Cgt3b3Jrc3BhY2UgMBAEGAUq5wMKCmNvX3NpZ25lcjMaAjAzQkAzMjlFRDJBMUE0QkJBMDc2QURCODcyMDlFOEI1ODQ5MzUzMzg3RkVDM0YwMjM1QzkyRjM5QjEzNjQzMjdBNkY3SooBCkA2ODI5MjM4RUQwQ0I1MzFCOEJBQUJDMEZGQzczNEM5RkU4QTAxRjQ3MTQ0NzNGMDM3RUVBOUIwMUE1OTVGQzgwEkAzMTE0MDJDOTc2N0M5NUQ4RDVDQkI0QzU3MUVEQkJFNjhFRjU1MjFENTBCMjAwMEFCMkZGMUVEODFFNjJEQzlGGgRwMjU2UkA2NjdENjU4QTZDMzE1MEFDNzc1NDQ0RTlBNjlBOTZGMUJFMEE4RjBEMDdBMkFDRkQ4RERFMjkzRjhDOUY0QzNGUkAxRjRGNTg3RDk4NzMzQUE4ODA5RUI2RUIxNEY1ODVFMzY0RTNFMDBBNjBBODZGOEY3MkVFNjI4RDU1REY1MTFGUkA3ODU5QzdEMjVDQUVDMjBBOEQ3OEE4NUYyNkY5MkRERkVDMkUwQTE0NEM3NzM4RkExNjc3NjZGMTc3OThCNjE0UkAxRTgyMjM4NkM4MkYyNjgyRUU2Mjk3MEQ1QjBGRDNFMzhEOTg0QjgzNDI3Mzk0M0ZCNTU5RkU1QUI3RUQwNDlGMlIKCmNvX3NpZ25lcjEaAjAxUkBEMTc4Qzg2NTJBRUI0MUNGQjQzOUYyOTQzMDM1QUZDOTE4QzkzMDFEQ0E3RDkzRDY4MkM0NzJCM0VEM0RBNUY5MlIKCmNvX3NpZ25lcjIaAjAyUkAzNzlBMzA5NTQ2RUQ4OTlEOEJGMTc5NjUwNzRFMzQ3REI3ODQ0Q0I1M0E3MzAyMzgxQzZGMEM2ODhDQUZDRTFDMlIKCmNvX3NpZ25lcjQaAjA0UkA5ODlBMjU4OUQ0RTkxOEY5MDFBODk2QTFDM0ZFNzcwMEU0QjAxQkU3OENCMTlCMkVDMzc2ODk3OUZBMERBNzJBMlIKCmNvX3NpZ25lcjUaAjA1UkAzNUIxOUQxRUYzRDgwNDUwODBGNjAxOUUyQ0U5Q0Y3MUNFNjMxRkU2NkFBQkExRjQ2RUQyRjcxOTIyNDYxOTdDOooBCkBDMTQ1RDFDQzYxQzJFMjkyREZERERDNUFGRUUxM0E4QjZCRjQ4NzI4QUVCNzI4MzA1QjgxMDNDNDAwM0FDMTJBEkAxNTFGQUUwM0E3MjkwMkIzMTcyOURBQURDODc0NEY3NzM4REE2NjY1RUZFMjAzRkQ0RDJDQ0VBRjYxNTM4RTlEGgRwMjU2";
-    sign_key_base64_arr[3]="Cgt3b3Jrc3BhY2UgMBAEGAUq5QMKCmNvX3NpZ25lcjQaAjA0QkBCRTREMkQ3QTI1MzE5ODk2OUE5RTJFMjU4MTcxRjc1ODA0MDMwOEEzQTVBNkQzMDRCMTM2MkE2QTU4MUNCODA1SogBCkBGRDMxRkI3QzBDODc0NEVGQTU1QTU0RkFGMTk2RjQ1MDlGMjE0QUM3NDY2MzA4NjU3MDQyRDgwRTBFRUI2MDM4Ej5BRDc1MDI0Q0YzNjRFRDVGRUE2RjQ5MTIxRDMzMTlEREY2QThFQkRCMDY1RTM3NzM4N0IyNEMwQkRBMzE0NRoEcDI1NlJANTc3OEQ1RjVFQzZGNzM1ODU3NjE0QTNDNTVDQzFCMTQyMThEQkVDN0JBNzAxNkM1QzQ2MTNDN0I5RjcxOUMxOVJAMDhDNEEwODQxN0Y4ODU0NkU4N0RGMzIxMTk1MjUyODI3NkY1QzhGNTZBM0FFRkM2MjlCREE4MTQzQzc1N0JEN1JAMjA0MDVEQjc3ODNBNTZFRTc0MkZFRTQyOUQwNTQ5MjBGODgyMTFEMzQwM0E2MjM0QUNGRjIyODg4Mjc0RjExNlJAN0MzRTE1MTkwN0I3QjQ0M0UzNkZGQzk4QzI5OTQ4NEYyNTFFNDQ5NkQ3RUEyNDVDOEUxMkFBMjAyRjg1QUQ4NTJSCgpjb19zaWduZXIxGgIwMVJAOTk3QTRBQzlENkNEMTE5OUE5N0JFQTBCN0EyQTNCQjc3MTUzN0RERUEzN0E0RDVGRTE5RjFCNEMyRTQ5RDBFQzJSCgpjb19zaWduZXIyGgIwMlJANzM0NTlDMTBCREQ0MkE2RDVCNzRDNjNGRUQwMjhGNDhCOENEQkJFOTBEMzU0MjA3MTAyRDYxMzY3RkZCMjg1MDJSCgpjb19zaWduZXIzGgIwM1JAOTg5QTI1ODlENEU5MThGOTAxQTg5NkExQzNGRTc3MDBFNEIwMUJFNzhDQjE5QjJFQzM3Njg5NzlGQTBEQTcyQTJSCgpjb19zaWduZXI1GgIwNVJARTBEQzJGMzkxMzU4RUQyQkI5OTNDMTEwMzRFMjY0NTFENUEyQjFDQzVFMUY4RTMyQkU0MjFCREM2NkIwQjNGODqKAQpAQzE0NUQxQ0M2MUMyRTI5MkRGREREQzVBRkVFMTNBOEI2QkY0ODcyOEFFQjcyODMwNUI4MTAzQzQwMDNBQzEyQRJAMTUxRkFFMDNBNzI5MDJCMzE3MjlEQUFEQzg3NDRGNzczOERBNjY2NUVGRTIwM0ZENEQyQ0NFQUY2MTUzOEU5RBoEcDI1Ng..";
-    sign_key_base64_arr[4]="Cgt3b3Jrc3BhY2UgMBAEGAUq5wMKCmNvX3NpZ25lcjUaAjA1QkAxMzI1N0MyODdFQkQ5N0Y5MjZGNkNFOUQwNUU0RTQwNDUzOEI1MDFCNTVFNDRGQzVDMTg3NTI4RDMzQzIwOERGSooBCkA2RTE3OUI5QjUwQ0QxMENGQkU3ODFEOTU0M0Y4RjA4QkM1QTg1QkYzQjY4QzIwMkUxMkQyODdENTU1MjMwRUJFEkAzM0NCOTkxOERGN0MyOUZGMzA5MjhDODMyRDZDRDMyRjBDRDRGN0M1Mzg3QzNBOENGRDMzNDlFNUNDMjdFQzM1GgRwMjU2UkAzREM1RUEyNzRDNDFGREIzN0FCQzI5OUQ5MEFCMTMwNDc4QzJFMzJGREM0RjIwNzY1ODYwQ0ZGQTMwNDE5OTRFUkA2MDQ0NEI5RUUyQzM1QkVGODUwQTVDMDk1NTEwODUwODFBMUY3RTgxQUNBNDQ0OEQ4MEUxOERDM0ZDMUI1Q0MwUkAxNzJGNzk5ODJCQThERENEOTI5MzZBOTBEMUQ5RkI4RTQwQ0FENDYzMjgzODBEQjRCOTc4RjhCRTZBNTkxNEREUkA2NDlFMUEyMDBCQTEzOEU3RDYyM0M0Nzc3MjQ5MUMwMkIwODQ2RDM1ODYzNTY5RDYzMDJGNzFCQzM3MkIwNjczMlIKCmNvX3NpZ25lcjEaAjAxUkA5NTAwMjU1QjQ2NkE2NjFFREExN0JDNTYzM0Q1MjRFQzA3QzczNEVDQjkzNDk4MjkzRjk3NjFBMTI5MTVGRjg1MlIKCmNvX3NpZ25lcjIaAjAyUkBDQTc4MTBEOTdDMUQyRkZEREI5QjBGN0FFOTI2MDU0MTM3MjdENDkzMUM1QUJCNUU4QTYxMTE0MDBBMThCN0NCMlIKCmNvX3NpZ25lcjMaAjAzUkAzNUIxOUQxRUYzRDgwNDUwODBGNjAxOUUyQ0U5Q0Y3MUNFNjMxRkU2NkFBQkExRjQ2RUQyRjcxOTIyNDYxOTdDMlIKCmNvX3NpZ25lcjQaAjA0UkBFMERDMkYzOTEzNThFRDJCQjk5M0MxMTAzNEUyNjQ1MUQ1QTJCMUNDNUUxRjhFMzJCRTQyMUJEQzY2QjBCM0Y4OooBCkBDMTQ1RDFDQzYxQzJFMjkyREZERERDNUFGRUUxM0E4QjZCRjQ4NzI4QUVCNzI4MzA1QjgxMDNDNDAwM0FDMTJBEkAxNTFGQUUwM0E3MjkwMkIzMTcyOURBQURDODc0NEY3NzM4REE2NjY1RUZFMjAzRkQ0RDJDQ0VBRjYxNTM4RTlEGgRwMjU2";    for (int i = 0; i < N_PARTIES; ++i) {
-        map_id_message_queue[party_ids[i]] = PartyMessageQue<Msg>(ROUNDS);
+// Park messages of round 0 in contexts which have not run round 0 yet. A party out of the signature and a second
+// message of a party are turned away.
+bool check_parking_limited(const std::string sign_key_base64_arr[], const std::vector<std::string> &participants, const BN &m,
+                           const std::string &outsider_id) {
+    std::string t_sign_key_base64;
+    if (!safeheron::multi_party_ecdsa::Li24::trim_sign_key(t_sign_key_base64, sign_key_base64_arr[0], participants)) return false;
+    Context ctx(participants.size());
+    if (!Context::CreateContext(ctx, t_sign_key_base64, m)) return false;
+    for (size_t i = 1; i < participants.size(); ++i) {
+        if (!ctx.PushMessage("p2p", "bc", participants[i], 0)) return false;
+    }
+    if (ctx.get_parked_bytes() != 5 * (participants.size() - 1)) return false;
+
+    Context duplicate_ctx(participants.size());
+    if (!Context::CreateContext(duplicate_ctx, t_sign_key_base64, m)) return false;
+    if (!duplicate_ctx.PushMessage("p2p", "bc", participants[1], 0)) return false;
+    if (duplicate_ctx.PushMessage("p2p", "bc", participants[1], 0)) return false;
+
+    Context outsider_ctx(participants.size());
+    if (!Context::CreateContext(outsider_ctx, t_sign_key_base64, m)) return false;
+    return !outsider_ctx.PushMessage("p2p", "bc", outsider_id, 0) && outsider_ctx.get_parked_bytes() == 0;
+}
+
+// Run the signers in one thread, delivering the newest message first, so that messages often arrive before the
+// receiver has finished the previous round and are parked in its context.
+bool sign_out_of_order(const std::string sign_key_base64_arr[], const std::vector<std::string> &participants, const BN &m) {
+    struct PendingMsg {
+        size_t dst_;
+        std::string src_;
+        int round_;
+        std::string p2p_msg_;
+        std::string bc_msg_;
+    };
+    std::vector<std::unique_ptr<Context>> ctx_arr;
+    std::vector<int> popped_round_arr(participants.size(), -1);
+    std::vector<PendingMsg> pending_arr;
+    bool parked = false;
+
+    // Pop every round that is over, replaying the parked messages may finish more than one
+    auto complete_rounds = [&](size_t i) -> bool {
+        Context &ctx = *ctx_arr[i];
+        while (ctx.IsCurRoundFinished() && ctx.get_cur_round() > popped_round_arr[i]) {
+            int round = ctx.get_cur_round();
+            std::string out_bc_message;
+            vector<string> out_p2p_message_arr;
+            vector<string> out_des_arr;
+            if (!ctx.PopMessages(out_p2p_message_arr, out_bc_message, out_des_arr)) return false;
+            popped_round_arr[i] = round;
+            for (size_t j = 0; j < out_des_arr.size(); ++j) {
+                size_t dst = std::find(participants.begin(), participants.end(), out_des_arr[j]) - participants.begin();
+                if (dst == participants.size()) return false;
+                pending_arr.push_back(PendingMsg{dst, participants[i], round,
+                                                 out_p2p_message_arr.empty() ? "" : out_p2p_message_arr[j],
+                                                 out_bc_message});
+            }
+        }
+        return true;
+    };
+
+    for (size_t i = 0; i < participants.size(); ++i) {
+        std::string t_sign_key_base64;
+        if (!safeheron::multi_party_ecdsa::Li24::trim_sign_key(t_sign_key_base64, sign_key_base64_arr[i], participants)) return false;
+        ctx_arr.emplace_back(new Context(participants.size()));
+        if (!Context::CreateContext(*ctx_arr[i], t_sign_key_base64, m)) return false;
+        for (auto &remote_party : ctx_arr[i]->sign_key_.remote_parties_) {
+            remote_party.prg.reset();
+            remote_party.prg.init(remote_party.seed_);
+        }
     }
     for (size_t i = 0; i < participants.size(); ++i) {
-        res[i] = std::async(std::launch::async, sign, sign_key_base64_arr[i], participants, m);
+        if (!ctx_arr[i]->PushMessage() || !complete_rounds(i)) {
+            print_context_stack_if_failed(ctx_arr[i].get());
+            return false;
+        }
+    }
+    while (!pending_arr.empty()) {
+        PendingMsg msg = pending_arr.back();
+        pending_arr.pop_back();
+        Context &ctx = *ctx_arr[msg.dst_];
+        if (!ctx.PushMessage(msg.p2p_msg_, msg.bc_msg_, msg.src_, msg.round_) || !complete_rounds(msg.dst_)) {
+            print_context_stack_if_failed(&ctx);
+            return false;
+        }
+        if (ctx.get_parked_bytes() > 0) parked = true;
     }
+
     for (size_t i = 0; i < participants.size(); ++i) {
-        EXPECT_TRUE(res[i].get());
+        if (!ctx_arr[i]->IsFinished()) return false;
+        if (ctx_arr[i]->r_ != ctx_arr[0]->r_ || ctx_arr[i]->s_ != ctx_arr[0]->s_) return false;
     }
+    print_signature(ctx_arr[0].get());
+    // Make sure the messages were really reordered
+    return parked;
+}
+
+TEST(Li24, sign_t_n_mt) {
+    BN m = BN("1234567812345678123456781234567812345678123456781234567812345678", 16);
 
+    //SECP256K1 sample
+    printf("Test Li24 sign with secp256k1 curve\n");
+    EXPECT_TRUE(sign_all(secp256k1_sign_key_base64_arr, participants, m, SignOptions()));
+
+    //P256 sample
+    printf("Test Li24 sign with p256 curve\n");
+    EXPECT_TRUE(sign_all(p256_sign_key_base64_arr, participants, m, SignOptions()));
 
 #ifdef TEST_STARK_CURVE
     //STARK sample
     printf("Test Li24 sign with stark curve\n");
-    //STARK sign key
-    sign_key_base64_arr[0] = "Cgt3b3Jrc3BhY2UgMBACGAMqp0YKCmNvX3NpZ25lcjEaAjAxMqckCoAEQzJDRjlDRDkyNTQxM0ZCM0U5QjVBNzUzNjc0RjUwNjk4RUIwQTI2MUJGMTU3OUYyOUJBN0MyNjhEMTc4M0Q3MTI4QThCMjZDMjcxRjI4NUNGNjUxRDZBMTUzQkQ3NzUyQkVGRUU3N0UzN0VFRTI5NUNBNTBDQjVBRTMyRTY3QzkzRUYxNDMwRkIxNzc4MkJBRUE3OENFMTAzM0IzNjIwMENBODE4OURBNDE0NkUwRThDQTFBMzAyRDE5RDc3OTc2QThDRjQwMzVBRTIzMjcxRDQyODZEQTY0NjQ0Q0I3RTFEMzE0MDVDREMzNjk3OTUwMjBGQjJGNjE1NkVCNTAyNjU4NzM0NDlBNzI3MTE3Nzk3NzlEODEyRTU1MTY1Mjc3RDQ3OUEyN0I1NkFBNTY4Njk4QzQyNzE2NkY0MEZBOTFDQTgxMkE3QkRFMUMxOUJBQkRGMkI3MzVFRjJDMEM1M0MzNkI4MUE0QkQ2M0U3ODg4RTgxODlDREI2MDhFRDFCRTY2RUNCRkI3RkI3MUUxMjExMUE5RTE2NTVDM0Q3MEYxQTk0NzlDNUFDNzU3MDc5OTYxMzAxMDVBN0MzOEYyNUFGMDBDMjBBNDIzRTYxNEYzNzU3RTVGMUI3OEM3NzExREZGODhFNUNDNkRBRDkxQTRCODIxMjFDNUJCNTJCREQSgARDMkNGOUNEOTI1NDEzRkIzRTlCNUE3NTM2NzRGNTA2OThFQjBBMjYxQkYxNTc5RjI5QkE3QzI2OEQxNzgzRDcxMjhBOEIyNkMyNzFGMjg1Q0Y2NTFENkExNTNCRDc3NTJCRUZFRTc3RTM3RUVFMjk1Q0E1MENCNUFFMzJFNjdDOTNFRjE0MzBGQjE3NzgyQkFFQTc4Q0UxMDMzQjM2MjAwQ0E4MTg5REE0MTQ2RTBFOENBMUEzMDJEMTlENzc5NzZBOENGNDAzNUFFMjMyNzFENDI4NkRBNjQ2NDRDQjdFMUQzMTQwNUNEQzM2OTc5NTAyMEZCMkY2MTU2RUI1MDI0OThEQTk1RUE5QzlGQ0YxMzlBQjE0MkY2RkQzMjFCOEU3RjZEOTMyQ0ZBRTlGNEI5NUFCRDc5M0VEQjEzOTA3NTc1RTc4MUVBMUNGNDNGMzBCMzNBRkJCQjBDMTY5Mjc3Njc3RTY5ODk5OTREM0UyNjM0OTYxRTcyQkE5NTQ5MTAxRDUwMTM3OEVCOTcxMTQ3Q0FBOUQ4MjUyRkM2MjM4RDM2RjgwMzZBQTFCMUZCMTRCMEI0MTJDRDdEMUIyQ0YxMkRFNjFCRTQ5MTAwNzczMjU4MkQzQTg5QTYxNTAyQUJEMTJFNTMzNEYzNDQ1Mjg5NzQ3MEUyMTIxODdERDg5QxqABDNDRTM0Q0NGNERGRkFCQzAwM0I5ODZBNjE1QTgzOENCOTZFQjI0OTEwNzA0MkQ2QTc3NEQ3NEUwNEUyODNEOUM0NUI0MjYwNTdBN0U5Nzg5M0VDQUYxQUYzNkQ2NzgxMjBCNjlBOUYwMjA2OThBM0Y1QjVENzE2MTE5NEY1ODhFRjg3QUJCRTdGMzUwN0FEOUJBRjdBRDc1RDZDRTA1OUYwOUEwQkI2NTdGQzRDMzMwNUMxNDVDQzFEQkNEQkNFMTcxQTFGMDYyREU1QThCNTY0NEQ0ODRENENEMTM5MUE4NkI1N0QzNEE5ODg3Mjg3NzdFRTJFODg0OTg3MTJCQzdFODc1NEMzOEM0MURDNzdCQjU4NDZFNzRDMkZGMDcwOUIzMTlFRDEzQjM0NzMzREIyRTA3RTFGOEI4QTMzQjZFNjA0MDEzNzI5QzJGMUQyNDM1NjkxQTNGMzYwQ0U2MTdBQ0E0NjkyOUM5QTgzQ0QwQ0JBRjcxMjczMTE2OERDMjUyMTYyNjhGQUMyNUU1QkM1MTI5NzU2MTQ5MzlFRkY2MDFEQTBBQkEyNzJBODRFNzc1NEFGQTNGQzExMERFNDNEOEFFRDg0MEEyNjc4RjVFMzlGMEUxNjY3NkNCQkQwNzE2QjJDRTY4ODM3RDM3QzFCQ0IzQzIzOEJGQkQ1RkNBIoACRUU2RDg0OUI2MjQ3OTA4QzY3M0ZBRTUzMDQ2OTY3ODU2MDQ1NjMzRkM3QTk2QUJCNjU3Q0REMTZDOTRFOURBMzkwNDA4QkZFMkY4NUYxNEIxM0ZFQ0VEMkMzMEUxN0IzRjBDMTk2NDU3NjQ0ODU4MTg1MjFFQzI0RjI3QTNGMzY0QUNGMTQzOTMyQ0YwMkQ0MDA0ODcwNzBEMjE4RjhFNTFBMTk3RERENzI4QkVBMDA2QTlFQ0Y1RUVCNTdERDdEQzI3QzA5M0ZBMUQ0OUY4NjQ4MkM1QTMxOTc1QTAwQUEzQjY2Qzg1NkIwRDgxQ0E5N0UwOTcxM0I1ODIzOTk2QiqAAkQxMkIyQTE0NzM4OUI3RDk3NUFDOEZFNDUzN0FDRjYzRjRDNkFDMEU5NDE2RjcxMUQ4ODlEMEMwQ0FERUNDNzhDNDU5MUM5MzkxQTFFOTNFRjZCOEVDQTgyMDA3NjIyODZCMkI4MUQ1QUREMjIzRTBENEM5N0YzNjA4Rjk2NEQ1N0U0RkE0NDk2MTUxMDlGNjQ2Mjg1NTgwNTNFNEJBOUNDOTgyRjg3RDk4Mzc4QjY0N0FDMDFFRDkzRjUwODRCNkJFOUU5Q0U2MEY2OTRBOTY5NkZFNTEzNjdBMUQ3M0JCRDM2MzcyRDEyMkJFNjlFNzU5MDdCRUNFRUIxM0I5RDcygARERTBGRDE2QjFCQkY1RDYwMUNGRjA3ODg4MDU0QkI0NTJEQ0Y2QTA2NDA3Q0JDOUU3QjhFRjkxMzIwMkRBQkYwNDZFNUJGMUNDMUZCQTUxMzAyRTIzOTI4Q0IwREFBRjA3QjY4MDVFRTI1NzhENEEyODIzMEUxMzFCNEE1NDk1NTU1QkQ1RTFFMURERDI4Qzc5MDgwMUM4Njc3MEMzMDA4ODJCNUQ1NEY0RjEwRUNDNEI4RUFDOUYxM0ZFNTQ0RjhENzM3REVDOUNGRkIwMEJBQURDQjRDQzA0RTJCRDM1ODdDNzg3RjBFOTUwRkRBQTZERTQzRTAzNEUwQjc1RjNFNDFCQjY3ODcwM0RENTc2REJFQzBBQUZBODMyMDE1ODE2MUMwMzA1NzIyMzNBQjdERThEREI2MzI2MDA1NUI5QThBQzM2Q0I4RjI0QzU5QzNCRkVGMUJGRUZCRjA0NjU4NkUyRDgzQUQxRThCQTBBRUYzQzc5Q0FFMUM1NDZBRkJENDVFRkI4ODY3RERERDkxRkEwRDI5MTZFRDAxNUE3NTk1NDI5RkNFQTI3MTk2MDFCRDlFMTE2QUM0NkE3MEI3NzU5MEJCMjk4RTg2RDlBQUE1RDUxMDJCOUMzQTY0MzJDRjg1QkE1QkMwMjRBNjVENDlCN0FCQkVERjMzMTJCOTqABEFBRTc4MUZDOEU3MDY2MDA0NzJFNjRDNUQzQjE5M0UyQzgzQjEzQUE0QkNEMzQyMzIxNjY1RDFGRjhFQjc0MzUyRTdFRERBREQyQ0Q1NUY1RDVBNTZFRDIyQTNFRTA4Q0RDMEU2MDcxRjNCMUEzNkUzQjEzNDFDQjFCRTdFOUE2NzYyNjlCRDg3QUI3ODM2QkJBOTVENkE3ODJBNTY0QTNCODdENUU0RDU4MTM2MEEwRjIwNTJGQkU0NUI1NEEzRThEMTRFRjI3MTQxQ0QxRkIwRkNDRDIxRDIwMzcxQ0E3NzE3RjA1NDU3M0YwNkYwMUU5MTkyMTM5RTc0N0Y5RUJENTUxODJCRDQyRjIxRTNGRTk1REMwMjZFNUYxMzAyMkMyNDUzNzUyRUFDQzhBQjkyODE5RUIwN0NBM0Q1N0M1MjUyQjdFRTE4RTk5Q0YzNUM2RjE2RUM1NkQxNzU2QjE0NTZEMDhGNUE0ODY0RTY1RjRDNzJBMjUwOUEwQkE5QjI3QUY0QzY2QzFDRjlGRUFERTQ0Rjk4MEJDRTlCQzlDRDRDNjA3M0I5RkRCMDZDMTMyMjY3ODRDRUEyODE1NjAyRTQxM0U1MTMwMjRFQzJBNzdFMkU3MUZGMTdFQTUzNUU1MEY5NERENDAyQzFFN0UxQjM5NzJCOUQ2RDI3MjkxQoACRUU2RDg0OUI2MjQ3OTA4QzY3M0ZBRTUzMDQ2OTY3ODU2MDQ1NjMzRkM3QTk2QUJCNjU3Q0REMTZDOTRFOURBMzkwNDA4QkZFMkY4NUYxNEIxM0ZFQ0VEMkMzMEUxN0IzRjBDMTk2NDU3NjQ0ODU4MTg1MjFFQzI0RjI3QTNGMzY0QUNGMTQzOTMyQ0YwMkQ0MDA0ODcwNzBEMjE4RjhFNTFBMTk3RERENzI4QkVBMDA2QTlFQ0Y1RUVCNTdERDdEQzI3QzA5M0ZBMUQ0OUY4NjQ4MkM1QTMxOTc1QTAwQUEzQjY2Qzg1NkIwRDgxQ0E5N0UwOTcxM0I1ODIzOTk2QUqAAkQxMkIyQTE0NzM4OUI3RDk3NUFDOEZFNDUzN0FDRjYzRjRDNkFDMEU5NDE2RjcxMUQ4ODlEMEMwQ0FERUNDNzhDNDU5MUM5MzkxQTFFOTNFRjZCOEVDQTgyMDA3NjIyODZCMkI4MUQ1QUREMjIzRTBENEM5N0YzNjA4Rjk2NEQ1N0U0RkE0NDk2MTUxMDlGNjQ2Mjg1NTgwNTNFNEJBOUNDOTgyRjg3RDk4Mzc4QjY0N0FDMDFFRDkzRjUwODRCNkJFOUU5Q0U2MEY2OTRBOTY5NkZFNTEzNjdBMUQ3M0JCRDM2MzcyRDEyMkJFNjlFNzU5MDdCRUNFRUIxM0I5RDZSgAJEQ0RFQzY2Rjk2QURDOTU0M0U3MDE4RjNCQzVFNzVEQzExQkI5N0ZEOTcyMzIyMTdGNDA3MEQ1RkQwMjlCRDdFMjk3Q0ZBMUU0RTVGNzE5MjcxNDI2QUM3MjMzMDBDNUExMkJDQzRFNTQ0M0IxMTBCRTk0NUNDMjlGRTBGNDI2MzI2NDBEOEU3M0JDNTQxQTNGMkFBNDQyOUUxRUQxODI2QTk5NUREQTkxNjg0QzU1NzA5ODlERjk5MkUxMUFFQUM2M0ZFRTUxMUMzNkZFMUEzRTU1NTAyNjQ5RThEMzNCNTdDOURFRjAyODZDMzhEMTMxQzUwNzMxNjE1MzQzQzdBWoACMEY2NzI5MUI2NkQ5MDFDOUJDQjFGNjAwQTlBQTBBQzE2MUI0NjgwNDE0M0YzQzNEOTIxQjdFMDhDMUIzRUM3NDU2Q0Q2MjdDRTBFM0Q5NDAzRUQxNEY3RThFMjIxN0Q4OEM0NTY2NTIyMDlBOEM2QzE2NkYyM0ZCNUJBQURBOTg2RjFBQUQ2REM2NzkzRTdGMDMxNDY4QkNGNDBFNTVDOTczOUYyRTJCNzEyM0YzNjU5NEI4NUEwRjYyQjNEODY3RTMxRDJCRjg5QThCMEE0NTkwNUE1QUZBQzUwNUY4QzFBNjg4QkExODgyODQ5ODZGMUU2MDM4RjY1NzE2NjFCMmKAAjExOEVCRTJCQ0I5OUM3MzgyOENGOTU1RjQ4MEFGMUE5NEU4OUNCNDIzMDg2NDhBMzcxNzVDRkI2RjkyNEUwMjU2NkMzOTFERkUxMjY3RkI4QTJCQzY0MEI5RkRFMEI1OURFMDREMTYwMzIwOTc0NzU5QkRDMUZGQUY0NkFGQ0QzMjQ4RTNCNTFGNzA5QzEzMDBEOUUyQzQ2RjAyQkUwQkU3MDgzQTAzNDVDMDcyNEE5NjExNEVGQzVCRDQ2MkVEMTVFN0QyNDJEREU2NEJERTI2MkQ3NTdDQ0Y4Q0NDQ0Y0QkVDOEQ5NTQyQTE0OEY5NjYxQjhGRTI1NDJFRjVDRjFqgAJDMUM0MDBGOTBDQjBCNjBGQjhGQTk5RTNBOUQwQzRBMjkzMTI0NDBBN0ZEN0JBRDQ0NjZFNTJCODA5MkFFMDA0NkQ4QkJBMTZCMEJFMEZGRUI3RTc5RDI5OTFFNTRBNEZERUU2MUI4MzhEMzc5Nzc0QkU1QTVCM0FBRDRFOEEzRDBGMzRGNkRCOUFEN0NCNzc0MzEzRUNDMzVGRDY2NEQzNTVFM0NBNTIyNzEzOTdGRUU2MDdDNEM5REM5Q0FDNEVEQjgxNzBFRDc0REU0MDUxMDZBM0Y2M0JCNTE3N0FGQTJDREFCOEI4QTAzOUQxNzgzQUE3ODVEODkzRkQ1ODI1OoYICoAEQzJDRjlDRDkyNTQxM0ZCM0U5QjVBNzUzNjc0RjUwNjk4RUIwQTI2MUJGMTU3OUYyOUJBN0MyNjhEMTc4M0Q3MTI4QThCMjZDMjcxRjI4NUNGNjUxRDZBMTUzQkQ3NzUyQkVGRUU3N0UzN0VFRTI5NUNBNTBDQjVBRTMyRTY3QzkzRUYxNDMwRkIxNzc4MkJBRUE3OENFMTAzM0IzNjIwMENBODE4OURBNDE0NkUwRThDQTFBMzAyRDE5RDc3OTc2QThDRjQwMzVBRTIzMjcxRDQyODZEQTY0NjQ0Q0I3RTFEMzE0MDVDREMzNjk3OTUwMjBGQjJGNjE1NkVCNTAyNjU4NzM0NDlBNzI3MTE3Nzk3NzlEODEyRTU1MTY1Mjc3RDQ3OUEyN0I1NkFBNTY4Njk4QzQyNzE2NkY0MEZBOTFDQTgxMkE3QkRFMUMxOUJBQkRGMkI3MzVFRjJDMEM1M0MzNkI4MUE0QkQ2M0U3ODg4RTgxODlDREI2MDhFRDFCRTY2RUNCRkI3RkI3MUUxMjExMUE5RTE2NTVDM0Q3MEYxQTk0NzlDNUFDNzU3MDc5OTYxMzAxMDVBN0MzOEYyNUFGMDBDMjBBNDIzRTYxNEYzNzU3RTVGMUI3OEM3NzExREZGODhFNUNDNkRBRDkxQTRCODIxMjFDNUJCNTJCREQSgARDMkNGOUNEOTI1NDEzRkIzRTlCNUE3NTM2NzRGNTA2OThFQjBBMjYxQkYxNTc5RjI5QkE3QzI2OEQxNzgzRDcxMjhBOEIyNkMyNzFGMjg1Q0Y2NTFENkExNTNCRDc3NTJCRUZFRTc3RTM3RUVFMjk1Q0E1MENCNUFFMzJFNjdDOTNFRjE0MzBGQjE3NzgyQkFFQTc4Q0UxMDMzQjM2MjAwQ0E4MTg5REE0MTQ2RTBFOENBMUEzMDJEMTlENzc5NzZBOENGNDAzNUFFMjMyNzFENDI4NkRBNjQ2NDRDQjdFMUQzMTQwNUNEQzM2OTc5NTAyMEZCMkY2MTU2RUI1MDI2NTg3MzQ0OUE3MjcxMTc3OTc3OUQ4MTJFNTUxNjUyNzdENDc5QTI3QjU2QUE1Njg2OThDNDI3MTY2RjQwRkE5MUNBODEyQTdCREUxQzE5QkFCREYyQjczNUVGMkMwQzUzQzM2QjgxQTRCRDYzRTc4ODhFODE4OUNEQjYwOEVEMUJFNjZFQ0JGQjdGQjcxRTEyMTExQTlFMTY1NUMzRDcwRjFBOTQ3OUM1QUM3NTcwNzk5NjEzMDEwNUE3QzM4RjI1QUYwMEMyMEE0MjNFNjE0RjM3NTdFNUYxQjc4Qzc3MTFERkY4OEU1Q0M2REFEOTFBNEI4MjEyMUM1QkI1MkJERUI-RTNGMjI1RDVEQjRCNTdEQzZCNTZDQzQzNEQxNUFCQkNENTdFOEIyNEYzOUI0MDJDMDMwQjZGQzM2NTc4NDBKiwEKQDAyMjYyOERBRTQwMTNDQTAzOEI4MkIzN0U4QzdENDMzQUJDNDIyOUYyNjJBMUI2NkI0RDRGNkVGN0RENkNDRUQSQDA1QTdFRkZCQjZCMjY3NDg0RTU2RDI3MjU2RUNCRDYzQTdBRkQ4MUJBRTEyNzg2REJGM0YwN0Q4NDA4RkY3QzQaBXN0YXJrUoAEQjhFNEQ0MDk5OUUwNDVENDZENzk5NTU2M0Y4QTlBMEE5RkQ0NEE0MjNEODE2MkQ4NkU3ODJGODRERTVDNEY4RUE3MUJEMjYzMjVBNTQyMDc2MTY1ODNFQ0E5MUMyRTVFM0E0RTM0MDRBNUIyOEEzRkVCMjM0QTMxRDEyRjE0NzJBMjdFMERGMjlCNEI0MzE1MUVEOUI3Q0FGMDQ5MEM1MUNFRkY2M0VBRDlGQzExM0E2QURDMEJDMDBFMTlCQjdCMjM4QTg0ODMxNTk0RjI5ODZCMEJEQzkwQjE2QzYxNjYwNjA5RTg4ODgzODFFMjIzOUVGRjAwNjFEQzg5QTZGMjI0NEJERjlEQTY1NTU4RDgwMDcyNDI5NTc1QzFGNjhBQUY0OEU3MzhENjgwQzQzNzg1NDFDMjYyMUQ1REE3OTNGRUQxOUUzRjE3QjAyRkFEODc5MTZBOUQ0MkNCRTFEQjQ1MDI1Q0RFRUZCMkEzQzJGQTk1MzQ5NzUwNkJFNjQ4QjMyNTY4MTNDRTk5QTVGRTZBNjU3M0FDMzhBREMyNEQzN0U5OUUxQTA5OEQxMkQzODg5RDk0MzRCQkRCM0IzMDA1ODQyNzZFMEIyMkUwRDI1NTdERjlGMzhCNUNENkNDQzFFRkRGMEU4QzUxQ0Q5QjdDOTlCQkJGOTY5M0VDRTFagAI2MzMyMTgxNjI3RjhDRTA0MTFGNDg0MDIzMjQ3MTk1MjQ3RDBDOUEzMTBCNjQ4MkJFNzkyNjRGQzE1MzIwNjJBREE4QTUyRTg0REY3MzhFMUYxQTIyODIxNEZBNUY4NUU3MjFDN0QxMjNFNjFBNjMxOUZBMzg2MkRDQUU4QjBEOUZGRTM2MEY3ODJCMjBDN0U1MkY1QjU5RjhEQjQ5NzFENDcxMTMyOEIwQUU2MDQ0ODZCNjA5NzI1M0VCMEQ1OEMyMDMzOTc0OEY3NTdDQkJCQTU4MzQxODhFRDFFOTMxQThBOEFDREM2MTVGRjkyNzFFMzU2OUM4NjA4Nzg0RTJGYoACNzc0QUEzNzIyRTBBNjI4MUVFNUVEOEVDRjkxNTUzQUQ4RUY5OEJFOTRBRDk5NjI3NTdFQTUxMTY1OEQ5MTk0MkI2MjE0MkM1QkVDMDUxMTlFODI3Qjg3NUUxNEEyNEU3Q0FCMzYxMjUzNERBRDM1QTlBMTU2NEJCMjAxOUJEM0JFNDhDRjNFRjNEMzc3ODI4QzA2NzE3OTRDRjUzNThGODBEQ0VEREQyMTIwNTFGOTUzOUE2RTU0NDQ5OEQxRkQxQzkwODM2MUZGMjE1RjlCQzlFQzEyRjZFNjgxMTVBMDVCN0VBRDhCQkMzRTg0MzZDRjA0NkYxNzJDODVCRkY1RmqABDhCMUYxMjY5QzU5MTA5RTJDOUE2RjEwMUU1OEJCNzBGQkQwQzk3QzEyQjU5NUJFMDZFQUUwRDUwREY1OUVDRjQxQ0YxRkY5MEU4NUUxRjdDMUU4REYwRjk0NzE4MEFGRDNEOTdEMjA0MEIxQ0QyNkU0NjMwRTNDQUI1OTVBM0UzOURCMUJDNjdDODQ4QkQ1REQyQTMwNTlFQzVFMDZCNTBCQkNBQ0JGMzYxQzdFMDYxMUFENzA3MTI5NzEwNjA0NUMwNjFBRDM1MjNDQjVDNzU4RTRFMjc3NjhEMURFNzk4QTAxRjM5NUQ5QTVENzBBN0U5QTE3MUZFREU1OUY0MEEwMUJFQTNBMDI1NzUwREVBMEJERUZFODk5Qjg1M0E1OTFGNUU0OTg4RTI5MDU1MjYzOUE5RjlFMDAzQTQwMjBCNjk3NzQyREU1MjkwMEZCMjMwNzhDNUYxQjRCNjQ1RTMyNUJCOTBFNkFDMTQwQ0Q2MTA0ODY0RTgxOTI5MDVCMDM0NzRBMjVCN0M5OTQ0OThFMTU5RDA0NTU1NzNCQzI5MUUwOEJERjEyQTFCM0RDMDJBMTdCNTA0OTc5NzdGQkQzQTdEMURCQzZGRjdDQTNCRTZDOTZEREMzQzQxMzUwQ0MxNEI4OTAwMDdGQTg0OTRCREFBOTVCOEFCREUxMDg3coAEN0NDNTU4RUIzNEFFMzk1QkE0MkZGNzk1QzlFMkI5NDUzNTc2ODg3MTQzNThGRUU0QzVDMEQ5QkY0NEY2QUVBNjVBOENCRTFCQkYyREFBQzgzMDMxMzgxQUJDNDM2RTAzNUY3QjcxNEVCOTk2NEQzMkQ1NEEzMzk2MDI2MUNBMUVFRjJDRjAwODZFREMxNkRBOUUzRjFDQkM0M0Q0RTBBMjYxMTMwOEY2RjRDMTM3MjQzMEI2QTMzRDgzRTQ5RDhGMUJBNDE2MkRCQTM0QjBFNTdCMzM1REM2NzA0ODQyQjU1ODYxNzA1NzUxNjM1N0M5QkY0OEMyMDUyOTRBMjI5MEUxQzQ5RjM0NjZCNUFCNTg3OTE3M0QwNTdEOTFFMjE5NjkyMzkwM0RCNzYzNDRGQjNBRDY0QUEwQjlBMzgwQzY1RTYwNTdGNjNCNEE4QkUwNzQ1MjlFNjJFQkQ0QkM0RDA2NjE1NjVDQUJCMEYyNTQ5Q0FFQTUzNDBBQ0Q2QkZFM0U3NTZGNjQ4QjI0MDQ1RURFODlCRDU1QjAyQkQxREYxN0VBQ0RCMTc5RkQ1OUVDNTk0RUI1NjQ1QzRFRTdDOUQyMjlGMjU0QjQ3RTk2ODY0MkY0NDA2OEIwREM5ODkwMjM3NTJEMkZFMkNCNjk0RTcwNEJCODI0RDczOTdGNTB6gAQ1NjBFMkQ0Mjc0QUNBNkZGMjY3OTM1RUU5MEM1OUU2RkI3MTM4QUE0MTUzMjU0NzU5OTJDRjgyN0VGODhGQTRDQzAxQTQ0RUFEOTg1MUVCOTRGMUI4MTc3NTFFRTJBRDgzRTlCMDU2QkQzRkJFODRGQzhFRTI2Q0JCOTY0RUMwNUU2QzQ5NjIyNTkwQzExRDczRTkyNkUwNzc1MjFGNzQ2NkJDNDRCNUEzNDMyOTRFQzVBMTI3NkQ2QTA3RjQ4QkFGNUVBMDhFREVDMEM0QUJFRjZDQzVFOUNGNTM0NUY2NDY5OENENzBDODU0ODgyNjM2MTdEOEI0QTg4RDI5MERGNjRGQzk2RThBMUYyMEVDODNCQ0ZGMDc1MDY4RENEMEIzRUVFRTExMjA0ODcyOUVEQjBEQjc2QzIzN0I1NTA3MkYwOTlDMjhENTZGMTVEOTU2Qjk3RkUwMDBFOEI1MDRFMUMyMTZENEM0OTcxMUE5MkZGQzcwMkY4QTFFNkY5NjUwNTQ5OEY0Q0Y4Nzc3M0M4QTk3RUMxNkJFQzczODU4MDY4NzQxNzVBNEExNTVDNDg2RDA5M0ZGMDU4ODhGRjk1QTFBNEFENTMzOUM1Rjg3QUJCMDU1MzhCREJFMkZCMTBCQURGRjk2QTlBMzBBQzgxNDU0RDEwNzBDNjVENDdBQYIBgAQyQzkzQUI0ODc5NDVFQ0E0QkVEODJBNjIzNEZEM0Q4NzU4MDk5NjA3OUMxQUVDQTc2ODc4MjNFNUUwOENBRTYyMzJBNTFEOTg5N0I2NjJFNzFFNzI4QzQxNTY4OEJBMjExNzc0NzBGNUU0NTY2OUJBOUNCQkU1MjBBMjE2M0VFODJBOUIxMkNDQTY4MzU1NzIzRDJFMkU4QjVBMTQ5QTE5Mzg2QzUxQTk0RjAzNTBEQUYwOUJBQUMyOTI3RUUzNDlCN0E2MDc5MDJBNTIxNjYyMzlENkIzODk0MTZCRjcwMzExNjlENTQ2RTkyN0IwOTc4QkEwMUNFNkJFMzJFNzQ5NjFGMTJGRjg4RTY5OEQxMUNCMzY4RDUyNkYzOTkzQjJFN0E4MzRCMzVDQzYwREY5RkM0MzI4NTFDRjZCNzA1NTQ0QUU0OUY2REQzQzlBODc2Mjk1N0MwQjYwNUYyNEJERjZBM0Q1Mzg0QzdGQUJDNjQ5MjNENUM4QzgyMkUyQ0QzODM2NDVGQzkwNzAzRjY4MUQwQjU2NzE3NTk2MjMyQzFEQjk4Mjc0MkEyM0U2MjcxMjdEMEM1OEIyQzY3RTQwNjBCRTg2MUQxNkIzRDk2OUU5NDVBNEVCQUU5RTU4RUI0QTgwMjNENDQ1OUQyMDBCMjZFODFBNTNEQTRGNkNBQTKwFQoKY29fc2lnbmVyMhoCMDI6hggKgAREOTk3RkM5QzE2MzFFRTcxMUYwQTEwRTlEMTAzMkRFQ0ZERjI4QTdDMDNCMUQwMDlGM0M1MUVBQTVFNDk5NTdBODI4QTA4MEIyOUIzMkZGRUE3RjZEQkJCOEFERjJBRTIyMkEzODY3MUVGRjkzNEU4N0UzNjg5QTg5MDRCMjExMkVDNkFEQTQwMjNCMjRFQTNFRjg2RkVCMjAxOEFEMDBCQUJGMkFGMkI3OUVDN0QyOUEzMzU0NjgwNzU5NERGRTgyRUM2RjlFQzM3OTY0RThGMEQyNzg4RkVGQTQ3NjdCQzg4MjVFQ0E0MTRBOEU2MDMxREREMkJBRkJBNTkwODdDQ0ExMjI0ODM3OTlCRjk5QkY2NDJBREY1NTJFRUFERTMwRTY3NkZCMDg3RUU4QzdCNzY1ODRGRjQwOEQwMzM3QzE2OEQyMzgxRjA4QjgzQzE4RUZDQjcwM0YwOEJGQkY5RTZFOTNCQTJCQTA4RTMyNDUyNDg2NDM1NTEwODY1OTBDRkFCNzdENENBMTBDQzVFQzJBOEE1Q0NENUYyMUM0MTM4Mjc5NEYwMjBBNTg4RUZBQzAyMTM1NTZDQzVGRUYyMzc3OERCQTdDNUJEMTRCODk3MDk1ODQxQzI1MjM2NUI5OTA0QTc5MjUxQkExOUFFMzQ3RTVBMEU5MDc5QUI2MRKABEQ5OTdGQzlDMTYzMUVFNzExRjBBMTBFOUQxMDMyREVDRkRGMjhBN0MwM0IxRDAwOUYzQzUxRUFBNUU0OTk1N0E4MjhBMDgwQjI5QjMyRkZFQTdGNkRCQkI4QURGMkFFMjIyQTM4NjcxRUZGOTM0RTg3RTM2ODlBODkwNEIyMTEyRUM2QURBNDAyM0IyNEVBM0VGODZGRUIyMDE4QUQwMEJBQkYyQUYyQjc5RUM3RDI5QTMzNTQ2ODA3NTk0REZFODJFQzZGOUVDMzc5NjRFOEYwRDI3ODhGRUZBNDc2N0JDODgyNUVDQTQxNEE4RTYwMzFEREQyQkFGQkE1OTA4N0NDQTEyMjQ4Mzc5OUJGOTlCRjY0MkFERjU1MkVFQURFMzBFNjc2RkIwODdFRThDN0I3NjU4NEZGNDA4RDAzMzdDMTY4RDIzODFGMDhCODNDMThFRkNCNzAzRjA4QkZCRjlFNkU5M0JBMkJBMDhFMzI0NTI0ODY0MzU1MTA4NjU5MENGQUI3N0Q0Q0ExMENDNUVDMkE4QTVDQ0Q1RjIxQzQxMzgyNzk0RjAyMEE1ODhFRkFDMDIxMzU1NkNDNUZFRjIzNzc4REJBN0M1QkQxNEI4OTcwOTU4NDFDMjUyMzY1Qjk5MDRBNzkyNTFCQTE5QUUzNDdFNUEwRTkwNzlBQjYySosBCkAwM0U3RTZCQ0M0MTQyMDRCM0JFODBFMzc3RTE0MTMzRjA4RTZBNjkyNDU5QUZDMUMyQUQ4M0IyNjQ4MzNERjI2EkAwNTMxNzJFN0I4N0RFQzMwODhFMjFDOTM3OTBEREI1Njc3RDQ4RkQ5NjZBMkI3NzNENzQzMEYyQTEwMzRFNDI3GgVzdGFya1KABEU3QUFDNjkxNDk1NDlCRDVEREVENThERENDMDZGQTBGM0Q5QzQ2NkU5RjI5QzlBRjExMDgyNjE4OUEyNTFEQzM0MDI3MThBQjI1NjRBQzY1MTVDQzdENjc2MDA5RUUzNEQ2OTc5ODg1REMwOEM2MTgzQ0QwRDY1QTk1MDY0ODRENkU5MUM4MzQzOUE2NEM1NkJDQzNCQzNCMjU1OTdFQUQ4RDk0N0U0QTY3RkZDOEJGMjlGMzFEQTQyQ0I0QTkzRjBDODgwNDNENzI0QTM4NjU5NENGMTkzRDBEMEI2MjgyREZENjVFNjJCREM0NkRFODAyMTQxQ0Q5NENCOTEzREVBQzhCM0REMTI4MTIyQzVEMzA0MDAxNDA1NkFDREIyNEVDNzFFMUY2MzNERkM2M0MzRDIxOTZGQTg3QjRGOEQ0MUIzOUJFNTY5QTc1RDA1MzNBREVERDIxNUY3RDZGQTQxRUQ5NjUyNTkwQjhGM0VFMjlCNzJENTQ5QzI3MDc4NjUwMDEwQzc1Njc4MTY1Nzg1MEUxOTNGODEyNDAyNzVDQzcyODI0RTJEM0Q2QjU1RjAzQkMyNTQ2QjU1OTY1QzkyOURFRTIzMDlBRjdGMjJGOTBBRTU5NTg0RDNFQ0U5NDRBNkZFRDM4M0EyMjhEQTNDMTlBNzZBOTI1OUM0MDU5aoAENjJBNkQzRTRDNEQ1ODY4REQzN0U4OUE5OTQ4MTc0NUE1OEEwRDZEQUQ0MThFQkM0MzI1Q0ZERDcwNkEwNkE0RkZBRDFBODMyMTczOTIyMkIwMjdDM0UzNzFCOTY5MTJBNUQ0RDMzRkY2REU4OEM1RTE2NzVCQ0Q0MTdEMjA0QTMyQzY1NTBCNkY4RUZBQTZBMERBNDk1MkZGQkI2NkUyMjVCMkJDM0U4QjBBRkM4MTY2RjZCMzFERjEzOEYzRUM5RTQ3QzU5RUU2QUQ3RjQ3MEZFMDA2NkMyMEIzODkwRTA1RTIxNjFCMzZCOUYwQjA3M0NFMkM3NEFCRjdCMjVBNUU1Q0Q4NDQyNTk1MkU3MTkzNUU5MUEwMzhGQzE0NDI0MTZFN0I1NERBQThFMEQ0OEJEMTE5RjI5RDExNkEyMUFDMDRENzA0RjkwNDE1MEMzQTBBNzAyMzgyRDM5NDY1RDE0OTUzRDVDMkJFNzk4OEVBNDlDMjRDMjIwRTQ4MjlDQ0RCNERGNUFDRkY4NzE1RDZFMzI4M0Q0QjdDRjA0MzZERTg3OTNFOUM5NjFDOTEyQTlDRjBENjFDODgwNzVBMTc0NTUxNkVFQUY5MkU0OEZEODI0QTMzRTcwMjQwQzE4RTQ0Qzc3OEYyOTM0RkE2REU3OTczQkMzN0I3QkEyQkVygAQ3REZCNDI0MzQ1ODk1QTk3MDY0Q0QzNTEwNkNFOTcyMDA0MkFDMDNCNEQxREE4OENFQURERjY2Q0Y2REUyMDQ3ODNBMkNGNkI1RTM3NDNBRDMwNTI1QTM2RUQxNEE0N0Y2NzdFQjYxODVERDEwRUY2ODgwNkZGODY1QTI1NkUyRjBCMDM0RTlBMTk3OTFBQ0Y2MzQxOTY5QjZEQUJCMjg3M0ZBNTQ4NzEzOTQ2MjcwQzA0NUVCN0RGRjQ0RDRBRTU0QjQzOUVGMEREMjY2RUQ3NkQ4RUIzRkNGRkVGODNDNjhBNjIyMjczMDQwNEMwNzVBNDYyNzNFMjQzQ0IxM0YzOUQwMEI2NjBCNDhGMDYzQTA3MjRGNUNENzI2MUExQTFFRDA1QzY3NTM3MTAwNEM1ODlGRDgzOURBNjI1MUQxREM5MDVFNkYyRkU5NDQ1MDU5MDYzQjA0Q0FBODFCNkVFRUZBMzVFNUExMEI2RDE5MTY0OEFCQjZGODdBNEUxREMzRDMxQTcwQjhDODIzQ0JDNUQxMEZFM0Y0OEFBODk4QTc2NTIxNjdBRTBBRTcwNkIzQTk4MEFBNzI4MkE5MzNFRTgyM0ZBNTFFNThBREQ0MUZENDYzQ0EzOTIyRDRFQkVGRTAxOTY2QTYyNTVEQUQ3OTdEMEUxNEM4NzNEQzQwMDKwFQoKY29fc2lnbmVyMxoCMDM6hggKgARCMTJEMDFFMzlGN0MwODkyMjExQTFERkY1RTNEOTYxQkM5MTM5N0M3NjAyMUFCN0VFQkZGMkNFNkFDOEUwREE3RTk2NjQyMjgyOUU1MTBFRTZBMTNERUM0QzIwMUNGRTMxM0M3MkYyOTgzRURBOEM3NjM0RDlBQTQ4MzcxMjRFQ0NCMkRGODEwQzA2MjBBQTlFNTBFRDdFMEJDQURCOThCRDZCREY2OUE4NzYwMUQ5OTRCODA4RUM1MDAzRDE2RUQ4NDgzMjdDOUQxRTc5NkU5MTIwQUNBRTA1ODgzOTgwREFENEU4QTVEMzg0MjA1QTAzMkZBNTlCMzJEMUExODhFNzQwMkU4QjBGRjAwNzNGOUIzMDg5OTgwMUJDNDRBQUFCNjVDM0M5RTBEQTBEQzEzRkRDQzlDNUE5REVGNjA5QTREODI1NUUzM0E0RjcyQzJCNDk4NzYzNkEyRTZERjFDQkE3MEJFNEJBQTg3NzcxODdCOUM2QTIzQzVFRTM4OEUzQ0REMzhFMDYwMDk4OTIwOENGREIxM0NEMjBEOTIyNkE0OTYxOEUwQTg1QzBEMzRCRUFFMDUxQzI0REY0NjdGRkI0RjM5MjEzQjEwRUIyRTA0NUEwMDQ0RjE0RDYyRTY5Q0M2MjhFQzc0MUNENjVGQ0RDNDNCMzQxNUFFN0JGRBKABEIxMkQwMUUzOUY3QzA4OTIyMTFBMURGRjVFM0Q5NjFCQzkxMzk3Qzc2MDIxQUI3RUVCRkYyQ0U2QUM4RTBEQTdFOTY2NDIyODI5RTUxMEVFNkExM0RFQzRDMjAxQ0ZFMzEzQzcyRjI5ODNFREE4Qzc2MzREOUFBNDgzNzEyNEVDQ0IyREY4MTBDMDYyMEFBOUU1MEVEN0UwQkNBREI5OEJENkJERjY5QTg3NjAxRDk5NEI4MDhFQzUwMDNEMTZFRDg0ODMyN0M5RDFFNzk2RTkxMjBBQ0FFMDU4ODM5ODBEQUQ0RThBNUQzODQyMDVBMDMyRkE1OUIzMkQxQTE4OEU3NDAyRThCMEZGMDA3M0Y5QjMwODk5ODAxQkM0NEFBQUI2NUMzQzlFMERBMERDMTNGRENDOUM1QTlERUY2MDlBNEQ4MjU1RTMzQTRGNzJDMkI0OTg3NjM2QTJFNkRGMUNCQTcwQkU0QkFBODc3NzE4N0I5QzZBMjNDNUVFMzg4RTNDREQzOEUwNjAwOTg5MjA4Q0ZEQjEzQ0QyMEQ5MjI2QTQ5NjE4RTBBODVDMEQzNEJFQUUwNTFDMjRERjQ2N0ZGQjRGMzkyMTNCMTBFQjJFMDQ1QTAwNDRGMTRENjJFNjlDQzYyOEVDNzQxQ0Q2NUZDREM0M0IzNDE1QUU3QkZFSosBCkAwNDRGNDEwQjEwNjM2NjY4OERBNjFDNzg2QUUzQjg4MDVFMDBGQzBGNDhDNTkzMTU4NjY4OEQxRTc1NEM5ODJDEkAwNUQxOENDMUQ5OTkxMkQwQTJBQzk2RTIxQjlDMUFBRUMwN0NDNUFCRkQ0RDk2MTIzNkNDNUU0QzAzMDhEODRGGgVzdGFya1KABEMxNDEwODQwNTJCRTRBNDY4RjQyRDQ5RTRGQUU3NjNGRTA3MEFCRDNGNzhFN0QyOUYzRUYwODc5NENFRUMzNTNFQ0U0Q0Y2QkI2MTg2NkQ3RjAzNDkzQzlBNDZDQzAyREQyNzY3QzkxMUIwMDhGQzBEQ0M2MTZBMzZEMDQxQzcyQUQwOEVGMjU0RDhFMkI5QzRCMENFMkEwRjY3QUFCOTg0N0I4MjY0REI2MjUzRkE5MjE1RUMzNzhCNzYwMTlEMUU5OEM5RUFGOUNCRjNCQjdCOTU5NTY5MkE1MkUwOUY3MTM0MjhGRDM0OEU3Q0VENzhFMjU3MzA0NDQyQkQ1MjBDMjI3RDFBMUM4MzIzNEZGQzgzMDBENzlCRkU5OEUyRkY4QTlCNjI2NTIzOUY4NDYwNUZFQjQ2RjdGNzg1MzFCM0MxRTQ1NjU3N0QxQTAwNTcyOTM0RTIxNjhENDZGODM0N0FBQkZDQzE0RkFFN0U4MEZDNjJDOTQ5MzBEOTNCM0JDNEM0RTVDMTQyQzRBMEIyMUZDOUY0RUFFQTk4QTg5RUUxMDNENjNGMzEyRkFFM0NEMjY1QURFRDAzODA5QUE5QUM5MzMxOENFQUVDRUQ4NEZGNEIyMDlBNzIyQzlCQjM4RjcyNTA2N0JCQzFENzQ0MkRFNzU0Q0Q5MEI0N0JEaoAENjQyQkMxQkRDNDU4MjdCMzY4MTFEQzBBQjQxOUJBRTI3RDI5Mjk5MzRDMTg4M0FENEMwRkFBOTRBQUM2QkY4MTM1RjFFOTUwNjM0OTY5NkNFRTFGQzYzQUU1OTY3RDBBQzc0OTYzQzY2OEY3RkRBQTY2N0Y2NjcwNDdBRDhEMTQ5MUVDRDQ4MUU4M0EzNUVBQUNFNDE3OEUwMUIxRDc1OTY0MERDN0ZGRDJFNUEyMDM0RkRFNTE3N0Y1NzBFNTc3RDkzNTRBNTlCM0NCRDI4MTM1RTU4NzUzNkNCNkI4Qzc1NzJCMjg5Nzg2RDQ3QzcyRDFCNEFDNzk1MTQ4NEJENTJEQUY5N0VFMDdCMUZDMEMyMzkwMUU0ODg1MTQ2REQ4ODI0NTkwOTBFMEI3MTNCMTg0Njg5NDYwMjEyRkYxMzkxNjJFRDRGNTgzQzYwNjZBOUI2RTEzQzA3QjNEM0Y4QTc1RTRBMDVGQjM3QzYwNTI1QTZGNUEyQ0Q4MUMwOTY4OEYzOEJFRUJCMDZDMzdFN0Y4ODYzRDY3MzY2OEJBMTQ1MTY1QkY0NzJGREE2MDlERkFGRkQ5QTk5RjU4NDM5QzM5ODE3RDU0Q0Y2OUU3RUUzRTRERkI3M0YxNDMzMDYwNDJCMTM3MTQ2MTQ1MjI1RTFCM0NDRUIzNjNFRDgxMTNygAQxMzJGNUUzM0M5NzYyQjUzNDBDQkNDNkNCNUZFNUEwNDNENjhEOTM1RUFGMEVFNUU0OEM0MDIwQzdCMjUwMDQzMTk1QjMyQzNFRjcyRjZBM0Q4N0YyMzdFNDI5NTY4NEJFNEUyOUE0RUNERTIzNDUzRkI0NUIwRDM3NkIzNjQ2RTE5MTdDQkQyOTU1NDJDQzcwMDUzODdERUMxQTJBQzUzN0ZGRkQyRUU3RUQwOUM2NDEzQjc3NTQxRjNEMjM1QzlFM0JFRkFGM0RFM0M0QjA0QTkzMDJGOTI1OEVGNkM1RTY1MjJERUZCNUE4NzY1QzQxODU3MDg3MzNGQzg1NkZDNzNFNTI1OUE1ODhFRUI0ODMyODE4OTQ5MTM3QUZDN0MzRDFDRTI4MkI4OTM2RDYyQjY1NjFCNzEzQkM2NTExNDAxN0E0NzAwQUMzMURBRjJFRjY0RUY3QkVDMEIwOENCQ0I4OENDRDIzNzBDODkxMzFGMjgxNDRFNzRCQkMwRDlEMDM1NDNERENCMUNBRjczRDNFNUM0M0E1RUU3MTU5NUY4RTYxQTNFODI3Nzc5RDIxQzJBMDJBNTJGMTc5NTdCNTBCRUU2MzBBRjAwQzVFQUU2MjE0ODVENDFEN0ZGRDZFRDgxNkY2NTBEOTUwNDVGRDIzMzdCNEM2OUM2N0VCOTqLAQpAMDJDRjNCRkY4NzlBM0Q0QzFDRjQxMUMwNjNFRkM5NkRBN0U3RDBEQTBEQUQyMjFFQUVFQzdBNDE1QzJFM0UyNxJAMDE2QjAxQkJCMTBDQzA2OTdFQzVGMDIwQ0VEQjg1N0Q3MjkyNzIwQkQ3QjQ5NDA2MjJCM0M2OTk0MTFEMjkzMBoFc3Rhcms.";
-    sign_key_base64_arr[1] = "Cgt3b3Jrc3BhY2UgMBACGAMqqUYKCmNvX3NpZ25lcjIaAjAyMqckCoAERDk5N0ZDOUMxNjMxRUU3MTFGMEExMEU5RDEwMzJERUNGREYyOEE3QzAzQjFEMDA5RjNDNTFFQUE1RTQ5OTU3QTgyOEEwODBCMjlCMzJGRkVBN0Y2REJCQjhBREYyQUUyMjJBMzg2NzFFRkY5MzRFODdFMzY4OUE4OTA0QjIxMTJFQzZBREE0MDIzQjI0RUEzRUY4NkZFQjIwMThBRDAwQkFCRjJBRjJCNzlFQzdEMjlBMzM1NDY4MDc1OTRERkU4MkVDNkY5RUMzNzk2NEU4RjBEMjc4OEZFRkE0NzY3QkM4ODI1RUNBNDE0QThFNjAzMURERDJCQUZCQTU5MDg3Q0NBMTIyNDgzNzk5QkY5OUJGNjQyQURGNTUyRUVBREUzMEU2NzZGQjA4N0VFOEM3Qjc2NTg0RkY0MDhEMDMzN0MxNjhEMjM4MUYwOEI4M0MxOEVGQ0I3MDNGMDhCRkJGOUU2RTkzQkEyQkEwOEUzMjQ1MjQ4NjQzNTUxMDg2NTkwQ0ZBQjc3RDRDQTEwQ0M1RUMyQThBNUNDRDVGMjFDNDEzODI3OTRGMDIwQTU4OEVGQUMwMjEzNTU2Q0M1RkVGMjM3NzhEQkE3QzVCRDE0Qjg5NzA5NTg0MUMyNTIzNjVCOTkwNEE3OTI1MUJBMTlBRTM0N0U1QTBFOTA3OUFCNjESgAREOTk3RkM5QzE2MzFFRTcxMUYwQTEwRTlEMTAzMkRFQ0ZERjI4QTdDMDNCMUQwMDlGM0M1MUVBQTVFNDk5NTdBODI4QTA4MEIyOUIzMkZGRUE3RjZEQkJCOEFERjJBRTIyMkEzODY3MUVGRjkzNEU4N0UzNjg5QTg5MDRCMjExMkVDNkFEQTQwMjNCMjRFQTNFRjg2RkVCMjAxOEFEMDBCQUJGMkFGMkI3OUVDN0QyOUEzMzU0NjgwNzU5NERGRTgyRUM2RjlFQzM3OTY0RThGMEQyNzg4RkVGQTQ3NjdCQzg4MjVFQ0E0MTRBOEU2MDMxREREMkJBRkJBNTkwODdBRjFDQkYwRDE0MEZDNkJDNjdGN0EyQUI0QzY2REFGNzJENTI0REU5NTMwMEM5MDg0NDA5ODVBMzEwNzI1OUNDMUEzMUIzQzg0RkIxQzIzNDgwNDAxQTNGQjE4QUIzOTQzNDg1NDFEOTVBNTk0NkMxMUI3Q0M0NENFRDhDRkFEMjU3MjY0NTNDQkQ5OEQ2NzUyQUIxOEZEQ0U2QzE4OTQ0MTc5QTUxMzIwQzA2QzZFQjMwNzA4Mzc1MkZDOEU2MkZDRjk3RkUxQzg1Qzc4OEZDNEQ3Q0I3MkZERjlGRTEwOUQ5MEJFNDU4RTlGOTkyNDUwMzNBMTlCM0Q0RDY3QUEwNBqABEM4QjU4RjIxNzMyNDk4QjBCOTFFNkQ3QjczNUEzQjAxNDM5NTQ2MzExQ0I5NDU3N0REQTZBRTAzRTNBQkFENTk2OEUxMzg4OTQxQzdFQUU4Njc2MkY2NjQ0MUI2MjRFOTgyN0FCNzQzQTE4NkQyNDNDQkM2NTBENTg1NkNDQUY3RjlEMEU4RUIxMDIyQTU2MUFDNkRBNzdFOUVFMDJEM0Y0NDc4NzFERjI5MjBENkFDNEEyOEQzQzExMDk3MkE5MTZBQkNBQUI0QzU1NUUyNDVENDc0QUYwMEEzRjdEMzI2NUE4MkY0Q0ZFMTU3N0FEQ0Q5RTI3QjEzMzc0ODg3NDIzNEI4MjdBMjA5RjdGNUI1NzY2NEM3MEE5RjEwQTIyOEMxMTUwRDNEQjc0Qjg1RkFDODBDOUE4OTE2NENBM0YzOUJCNzdDNUNGQTFGNzA3NkE3NDE0Nzc5NjM5MkFCMjZEMzI5NDg5Qjk0QTAzQkNDOUI0RUM3MTczMThDQzIwRTBCRjUwM0E3RTcyNTRDQUQ2NkVDNTZGMTUwQjg3QTE0QzQyMzM3MjA3MkE1ODdEMzRGREFFRUVDOEU4NjAyMDBFNjJCMEM5RDhGNDdCQzY4M0FBRjJDNjE1QTk4RUMwMUZCMTJBQTBFOEI0MjI0NTlEM0IxMUE5RERGRjk5Q0E2IoACRjNBQjlCMkQ5OUY4RTNCMjk0Nzg5REJEODBGNjA3RjE1NTUzMUQ5Mzk4QTBERTZENUNCMzZFQjBFNDY1NEI4MUIzOEM3NDBFOUFERDFFOTBFMjQ5RDBDQTFGRkQ4QjYzNkREREZEQUM2QTU3OEVDNjMyN0JFMURBNkZDMTAwOTY5M0RDMzlBMDhCQjA3MjY5OTA0NDM5NTk5NEI4QTcyODMyNkE2RTJCQ0YyOTRBOEIxNjlCNjdCRjEzMzRFQTYyRTMxNUY0NDhDMDMzQzQ5RTA1Q0Q5MzlFMDlGODY5NkQzNzdDNkJFMkE5RDZGRDUxOTk4RTBBMDUxMDZBQUM3NyqAAkU0OUE5ODg0OUVBNkFBMjJFMjRGRTU4MzBCOEFGNjdFRTNFRjczODdCRjQxMUQ4OUQ5MEM4NzEyMUQ0NTRCMzhCRkU1NzJFRTVBOTI0MUU4QThCMTQyM0VCN0UzMzc1MzMwQjcyMDYwQUExQ0U4NEM2ODAwM0Q4QzA4NzdCN0Q0Qzk2QUVBNjg2NEQyRjJBMjg3NEI2RUE0RDUyMEUwRDc4QzE4MTNBMzkxMEZDRkIxOEU1RTc0NDM1RDAyQjE5MjVBRTMwNTk2QTkxMEMwNTVCOTcwNTFBNUJFNUJCQzUwRDBDOUY2MjEwODQ5RjgwQzY3NEVCNENDMzJBNzU0RTcygARFN0VGM0JBMTNGNEE3MzU4MTg0NTEzNTAyOTY2NTBBQUUxNjVERUZCM0ZCQjdEN0VGMTUyQzk4QkIzMjFFMDdGN0RBNDhDNjMwOTI2ODU4QjU2QjBEMkRCRjgyOEE0QTI3NEMxRjU4RUNCNUIzNTZENkFGQTlBQTlFNDVDQ0IyNzFFNjg1OUNCOUZFRUE5MjMyNEQwODBEOEM5QjdENkNGRDAzMUNCNzQ2QTVFNzQ0MTEyMzdGMEZCOTFFQzhGODQ3QUYwMTg4NzAxQUMxRDlCMTJCNUY2N0I4NjE0RDMwQUQ3QzVFRjhBNUQxMUUyQUYzMEU5NDE3MUE0QzQ4QUJBQjIwNUNFNzNBQTlDNDQ0MzZENTIzMzcyOUMwQkM4MkYwOEExN0M5Q0ZDMzU5MkVGNEY0RjBFN0Y2MDYyOTY3NjhBQjgwQjZEQUEyNEVBQzM4ODk0MTdDOUEzMEU0MzI1MUE5QjhENTQ0MDFFOEQxNjU4MDkyM0FCMjBEMTk5M0YzRDVFQzlFMDVDNENFMkUzODBEMzZCQzE3REI2MkQ5MTU3NEY2OTUyMzVCQzc5MjAwNDJFQzYwRTYyNkI4QkU3NTAyQjE3RkY1QTkwMTJCNzJEODY1RUQzRjlENENCQUIxNUJCQjY5OURDRkE3NzJEOENCNThBQTgyNkJDMUY1MTqABENDMjNCRDA4MTUwNTgwQUNCRDUxQTAyREY2RDQyRjU5RUQwMDUwMzJGNzU5Q0M1QjMyNUNGQTk1Nzc2QkREMjM1MDdERDVGQjQ2M0E3ODRFQTNCNjFENERCMDUyNzY3RThFQUI2RDVERkJBM0VDQzY4QkRFRDE5NUYyNURFQ0I4NEMzNDIxMjBBQjM0QjRCREEwMTlFOENBQzMxQjg0MzBCQzFDM0UyNjVDRkMyOEQyRkUwODJFMDg1NUQxRTM1Mjc2M0ZENDU1RDI5OUM4QzUzN0VCNTI0MUI5MEZBQzlGQzcwNTNDNUVDMjY3QUI0OEQ5NkQ0QjdBQzZEQ0NEMjMyNTNDQUI4OTc3MzBFNTM4MDU2QTk5NDVERjQyOUU4RTg0NjhBMUEwRjMyQkY1QzA3MjQ0RkY0MDUwNzlENjg3MTM1OTcyQjA2Q0IyOEFDNjE4NTgxQzcwMUE2QkJEQTM1RjIyMzY0QUY2Q0UyMjQzMzEwOEFCMTlCQTA5Mzc0Mzc5M0U3RTcxQjc0NzhBQUI2MDUzRkJEQTY0RUUyMkIyQzI2RTE0NTEzRkEzNEFDODY0QzhFREI3RjJGMTFGMUMwNTM4QkJCQjM5Q0I5MTBBMUUwRjhDQ0E3QzFDQkEwQjkwMEEzMzQyQ0NDRUQ0MERCMkRERjJCMjFEOEE2ODcxQoACRjNBQjlCMkQ5OUY4RTNCMjk0Nzg5REJEODBGNjA3RjE1NTUzMUQ5Mzk4QTBERTZENUNCMzZFQjBFNDY1NEI4MUIzOEM3NDBFOUFERDFFOTBFMjQ5RDBDQTFGRkQ4QjYzNkREREZEQUM2QTU3OEVDNjMyN0JFMURBNkZDMTAwOTY5M0RDMzlBMDhCQjA3MjY5OTA0NDM5NTk5NEI4QTcyODMyNkE2RTJCQ0YyOTRBOEIxNjlCNjdCRjEzMzRFQTYyRTMxNUY0NDhDMDMzQzQ5RTA1Q0Q5MzlFMDlGODY5NkQzNzdDNkJFMkE5RDZGRDUxOTk4RTBBMDUxMDZBQUM3NkqAAkU0OUE5ODg0OUVBNkFBMjJFMjRGRTU4MzBCOEFGNjdFRTNFRjczODdCRjQxMUQ4OUQ5MEM4NzEyMUQ0NTRCMzhCRkU1NzJFRTVBOTI0MUU4QThCMTQyM0VCN0UzMzc1MzMwQjcyMDYwQUExQ0U4NEM2ODAwM0Q4QzA4NzdCN0Q0Qzk2QUVBNjg2NEQyRjJBMjg3NEI2RUE0RDUyMEUwRDc4QzE4MTNBMzkxMEZDRkIxOEU1RTc0NDM1RDAyQjE5MjVBRTMwNTk2QTkxMEMwNTVCOTcwNTFBNUJFNUJCQzUwRDBDOUY2MjEwODQ5RjgwQzY3NEVCNENDMzJBNzU0RTZSgAIxM0E5RjJCRjM1QzhGQkE4REZDNEFBNUU3RTk1NUU1RkQwMDBCQ0VFODM2MjUzNjdDMzc5Q0Q2RjNCRkY1ODA5M0QxNUM0RTFBMzhCNEVCNkRFOTlCMUJFRUY0N0Y4QzdDNDZCNzgxMjBDQkJFQjk5QzFEN0Q0QjNDOUEyMUJBODI3NTlBNTcxMDg1ODE4NTk3RkREOUE1OUMwNjI5MzZEMjA3NDA1ODg4MDMwRjNDMDcwNzJFMThFRTc3RURDMDgzOEQ2QzIwQTNGQzVBRjA1RDQ3MkQzODk0MDYwMjBDMEVEMjFFN0M2RDNGM0UwQzhGMjFEMTRBQ0U1RUFCQTZCWoACRDIyN0U3MjhCQzRDRDg4Q0VDNjlDMDAxNjgyNzhEQkY5OTBBNUNBMDgzNDc4NDU1MzQ1MDJBNDJENjFCODVCNjBCQkM0NkFFRjczQTVDODc4REIyODNDOEI1MDE3NkE2MkU0RjQwNzhFQkU2Njc1NDlCRjMxRDUxRTJBQUFCMDlCQThBOTVFRTcyNTE1NzJCNEFFMkQ0Rjg0MTE2OUY2RDgzOUQ4MEY5RkMxRTQzMEZGMjczOUY3RDg1MTZDRUYwQ0ZFRUFBMUEyODczMkIzMDk2NkE0MjgxMEY4ODU5MjgyMjVGQUJBQjY4RTI2RDE5QUMwOEMxOTM0Q0I4Rjk4NWKAAkUwMDFBODZFNjQyRkU4MDlCNEIzRjM1RjAyNjBBOTkxODU1MjYwQTUxNTNFOEIwNTk5MzlBMTQxQTg2NUYzNzg3Njc2QUYyQ0Y3NTFDRkRBMDNCMDFGMEIzMEI1OTI5QkE5NzI4NTlBNUQ5QkEzMkM3MEE0MEQyNkE2MUVFNEVFNkM4Mjk0MkY4MzU4NUExMDEwNjY5RUZGRDQ1NjEzQkIxMUY2NjhBMzRFRjg1NkNBQTYyODg2MzAyQkI2MEU1QUFBM0YzMjNFODA2RTE1OTgzMTVBQzAxNEM5OTg0OEFDNEE1QTg0MUJENUUzMUM4OEE3NzBGNTU4MkE3RkYyMENqgAIxMjcyQjE1QkUyNTlEMTk1RjVFNjI1ODFBMzYzNjhCRjRBRTUxNkU3M0JGOTk5MzRBNEJDNUNDRjQ3MjlDNTgyQjQyOTJDM0Y2MzU3RTU2MTFBRkVCRTc2MDJFMUMwQUQwMjY3REZFN0JFMzY4MEY3Q0MwRDIwM0EyNUNEMENDQjBFRTA1NDc5RjI4MTlCNzczQzY4OTlBQzk0MEE0MTZBMDg3QTkyQTk5NEYxOENBMTlCRUFENEM1RDdFQkUyQTE4QUY0NUI3QzgwOUQ5NTI1MjMwNjBGMjRBRUQzNjMyOEFFNkE0QTc1OUY2NzhBRjJCQjQ1RjMzOEU1RUU1QjYyOoYICoAERDk5N0ZDOUMxNjMxRUU3MTFGMEExMEU5RDEwMzJERUNGREYyOEE3QzAzQjFEMDA5RjNDNTFFQUE1RTQ5OTU3QTgyOEEwODBCMjlCMzJGRkVBN0Y2REJCQjhBREYyQUUyMjJBMzg2NzFFRkY5MzRFODdFMzY4OUE4OTA0QjIxMTJFQzZBREE0MDIzQjI0RUEzRUY4NkZFQjIwMThBRDAwQkFCRjJBRjJCNzlFQzdEMjlBMzM1NDY4MDc1OTRERkU4MkVDNkY5RUMzNzk2NEU4RjBEMjc4OEZFRkE0NzY3QkM4ODI1RUNBNDE0QThFNjAzMURERDJCQUZCQTU5MDg3Q0NBMTIyNDgzNzk5QkY5OUJGNjQyQURGNTUyRUVBREUzMEU2NzZGQjA4N0VFOEM3Qjc2NTg0RkY0MDhEMDMzN0MxNjhEMjM4MUYwOEI4M0MxOEVGQ0I3MDNGMDhCRkJGOUU2RTkzQkEyQkEwOEUzMjQ1MjQ4NjQzNTUxMDg2NTkwQ0ZBQjc3RDRDQTEwQ0M1RUMyQThBNUNDRDVGMjFDNDEzODI3OTRGMDIwQTU4OEVGQUMwMjEzNTU2Q0M1RkVGMjM3NzhEQkE3QzVCRDE0Qjg5NzA5NTg0MUMyNTIzNjVCOTkwNEE3OTI1MUJBMTlBRTM0N0U1QTBFOTA3OUFCNjESgAREOTk3RkM5QzE2MzFFRTcxMUYwQTEwRTlEMTAzMkRFQ0ZERjI4QTdDMDNCMUQwMDlGM0M1MUVBQTVFNDk5NTdBODI4QTA4MEIyOUIzMkZGRUE3RjZEQkJCOEFERjJBRTIyMkEzODY3MUVGRjkzNEU4N0UzNjg5QTg5MDRCMjExMkVDNkFEQTQwMjNCMjRFQTNFRjg2RkVCMjAxOEFEMDBCQUJGMkFGMkI3OUVDN0QyOUEzMzU0NjgwNzU5NERGRTgyRUM2RjlFQzM3OTY0RThGMEQyNzg4RkVGQTQ3NjdCQzg4MjVFQ0E0MTRBOEU2MDMxREREMkJBRkJBNTkwODdDQ0ExMjI0ODM3OTlCRjk5QkY2NDJBREY1NTJFRUFERTMwRTY3NkZCMDg3RUU4QzdCNzY1ODRGRjQwOEQwMzM3QzE2OEQyMzgxRjA4QjgzQzE4RUZDQjcwM0YwOEJGQkY5RTZFOTNCQTJCQTA4RTMyNDUyNDg2NDM1NTEwODY1OTBDRkFCNzdENENBMTBDQzVFQzJBOEE1Q0NENUYyMUM0MTM4Mjc5NEYwMjBBNTg4RUZBQzAyMTM1NTZDQzVGRUYyMzc3OERCQTdDNUJEMTRCODk3MDk1ODQxQzI1MjM2NUI5OTA0QTc5MjUxQkExOUFFMzQ3RTVBMEU5MDc5QUI2MkJAMDI2MEUzRDkxNjQxOUVCRjY2RkZERTc5OEM5MDFDRjRBMjQ1QzI1RDYxMzZBNDI1MDg1NDRGMjVBMDZDQTQxMkqLAQpAMDNFN0U2QkNDNDE0MjA0QjNCRTgwRTM3N0UxNDEzM0YwOEU2QTY5MjQ1OUFGQzFDMkFEODNCMjY0ODMzREYyNhJAMDUzMTcyRTdCODdERUMzMDg4RTIxQzkzNzkwRERCNTY3N0Q0OEZEOTY2QTJCNzczRDc0MzBGMkExMDM0RTQyNxoFc3RhcmtSgARFN0FBQzY5MTQ5NTQ5QkQ1RERFRDU4RERDQzA2RkEwRjNEOUM0NjZFOUYyOUM5QUYxMTA4MjYxODlBMjUxREMzNDAyNzE4QUIyNTY0QUM2NTE1Q0M3RDY3NjAwOUVFMzRENjk3OTg4NURDMDhDNjE4M0NEMEQ2NUE5NTA2NDg0RDZFOTFDODM0MzlBNjRDNTZCQ0MzQkMzQjI1NTk3RUFEOEQ5NDdFNEE2N0ZGQzhCRjI5RjMxREE0MkNCNEE5M0YwQzg4MDQzRDcyNEEzODY1OTRDRjE5M0QwRDBCNjI4MkRGRDY1RTYyQkRDNDZERTgwMjE0MUNEOTRDQjkxM0RFQUM4QjNERDEyODEyMkM1RDMwNDAwMTQwNTZBQ0RCMjRFQzcxRTFGNjMzREZDNjNDM0QyMTk2RkE4N0I0RjhENDFCMzlCRTU2OUE3NUQwNTMzQURFREQyMTVGN0Q2RkE0MUVEOTY1MjU5MEI4RjNFRTI5QjcyRDU0OUMyNzA3ODY1MDAxMEM3NTY3ODE2NTc4NTBFMTkzRjgxMjQwMjc1Q0M3MjgyNEUyRDNENkI1NUYwM0JDMjU0NkI1NTk2NUM5MjlERUUyMzA5QUY3RjIyRjkwQUU1OTU4NEQzRUNFOTQ0QTZGRUQzODNBMjI4REEzQzE5QTc2QTkyNTlDNDA1OVqAAjc4NzM0N0RFNEIxOEU0NjkyNERGNDk3OTk5MUZERkE5NTFGRTg4Q0MzQ0YyNTBFOEQ3ODY5MEVFMTU4NUY2MjRBQ0JDNTZFQUUxM0ZCMEY0QjU4RjRCMDk1MEYzRjdBMzgxMUE3MjZDNzFDMEU1Njg0RTU0OUI5QThCQTdBNDIwQjQ3NDkzMjA2MDI0QUU3Nzk0NTVFMzU0QUY3NUJBQzRCRkMyQTVBN0Q0NDAwMjFBRjYyQTBBMjQ4MzkzREQ5QjE1MzcyNTJFMUM0QUREMzcyQzc0RUQ5REMxQjU5QTkxMDc2NjJBM0ZDODYxMDhENUU5RTcxQ0QyM0IzMDU1MkZigAI3QjE4MDcwNTk1MkZGOUI2MUIzMUZDM0Q2QjA1RjQ5QzVDNjRDNDRFQ0FCMTcxRDVERkMxNTFCRjQ0NzlFREVBODE3QTQ5NDVEMkRENjhFNDRBMEQzRUE1MUIzRkU2MkE4NDcwOTc0NjdBNUMyOTEzQjA2RjgzQjAxQ0I3NTBBRjRCMDk4MDE5QkY0QUVGREU5NkI0MTRCQjgyNTNCNEZDNEM2MzYxMjZCNDI0NUM1RUFGOTAxQjdDMjlDM0JCQzE3NDUyOTdGM0ZGOUNCNTA1MEMwMzA0NDU4MDQzMkZFQ0Y1QzgyNzlFN0Y3RTMxQTVDMTAxRkNBNUI2Mjk4MDIzaoAENjJBNkQzRTRDNEQ1ODY4REQzN0U4OUE5OTQ4MTc0NUE1OEEwRDZEQUQ0MThFQkM0MzI1Q0ZERDcwNkEwNkE0RkZBRDFBODMyMTczOTIyMkIwMjdDM0UzNzFCOTY5MTJBNUQ0RDMzRkY2REU4OEM1RTE2NzVCQ0Q0MTdEMjA0QTMyQzY1NTBCNkY4RUZBQTZBMERBNDk1MkZGQkI2NkUyMjVCMkJDM0U4QjBBRkM4MTY2RjZCMzFERjEzOEYzRUM5RTQ3QzU5RUU2QUQ3RjQ3MEZFMDA2NkMyMEIzODkwRTA1RTIxNjFCMzZCOUYwQjA3M0NFMkM3NEFCRjdCMjVBNUU1Q0Q4NDQyNTk1MkU3MTkzNUU5MUEwMzhGQzE0NDI0MTZFN0I1NERBQThFMEQ0OEJEMTE5RjI5RDExNkEyMUFDMDRENzA0RjkwNDE1MEMzQTBBNzAyMzgyRDM5NDY1RDE0OTUzRDVDMkJFNzk4OEVBNDlDMjRDMjIwRTQ4MjlDQ0RCNERGNUFDRkY4NzE1RDZFMzI4M0Q0QjdDRjA0MzZERTg3OTNFOUM5NjFDOTEyQTlDRjBENjFDODgwNzVBMTc0NTUxNkVFQUY5MkU0OEZEODI0QTMzRTcwMjQwQzE4RTQ0Qzc3OEYyOTM0RkE2REU3OTczQkMzN0I3QkEyQkVygAQ3REZCNDI0MzQ1ODk1QTk3MDY0Q0QzNTEwNkNFOTcyMDA0MkFDMDNCNEQxREE4OENFQURERjY2Q0Y2REUyMDQ3ODNBMkNGNkI1RTM3NDNBRDMwNTI1QTM2RUQxNEE0N0Y2NzdFQjYxODVERDEwRUY2ODgwNkZGODY1QTI1NkUyRjBCMDM0RTlBMTk3OTFBQ0Y2MzQxOTY5QjZEQUJCMjg3M0ZBNTQ4NzEzOTQ2MjcwQzA0NUVCN0RGRjQ0RDRBRTU0QjQzOUVGMEREMjY2RUQ3NkQ4RUIzRkNGRkVGODNDNjhBNjIyMjczMDQwNEMwNzVBNDYyNzNFMjQzQ0IxM0YzOUQwMEI2NjBCNDhGMDYzQTA3MjRGNUNENzI2MUExQTFFRDA1QzY3NTM3MTAwNEM1ODlGRDgzOURBNjI1MUQxREM5MDVFNkYyRkU5NDQ1MDU5MDYzQjA0Q0FBODFCNkVFRUZBMzVFNUExMEI2RDE5MTY0OEFCQjZGODdBNEUxREMzRDMxQTcwQjhDODIzQ0JDNUQxMEZFM0Y0OEFBODk4QTc2NTIxNjdBRTBBRTcwNkIzQTk4MEFBNzI4MkE5MzNFRTgyM0ZBNTFFNThBREQ0MUZENDYzQ0EzOTIyRDRFQkVGRTAxOTY2QTYyNTVEQUQ3OTdEMEUxNEM4NzNEQzQwMHqABDkzQUIyMEY4NzMyRjVGRTY3OThERTYyNDg2QzA5NzA4RDI5MDQwMkZGRTQxMDBFMkRDMDE2NEU2N0RDRjBGMzg5RjBENDNCMzBCMDM0NjcyRjEwNTQwN0JDNjFEQjhCRkE0MUVGQ0UwMDlBQjQ1MTA3NEFBM0Y1QTU0MDA3RjI3QjI1QTUxRUJGMkMzMkM5NDEzOTA1OUZENTI5NDJEQkI4MzBDREYwQzRDMURDMTg1N0RGNDUwMzU5MEY1RUMyOEE4NjQ2OERFQjZDMTk5MkY3OUUxMTNCOUJEQTdEMDBGNDBFQjEyMEM0OEQ3QURBMDFBRTkxOEFDQzY3QzQzRDBENjkxNTQ5NUNGNDg5MjVBNTYzNTQ3MDc4RUI3RUQwMERBMDczMjFBOTc4N0EwRTgyRDEwRDYzNkVDNjZGRTU1M0E2NTU3QTdCRkZCMzg4MzhDNjBENTBEMzEwRDhCMEI4NjkyMzJDNzYwQUYxQzRENkQxRUFBMEZEREE4RjM0NEJERERDQTg0QkI2MUE1RTUwODJEQUE0RUY4RjlDRTdERDExMjRFMEI1Q0I2QTA2OEU1RUY4NUI3M0EwODYwNThGMDlBQkNEMEQ3N0JGOTJGNzgwRTY1NEM4OUM1QzlGNkMxNDdCMjc1NTExRTQ5QTg4NTEwMDYwRTY0MEI4NzM3ggGABDMxOEQzOUVBRjEyNzZDODU1NDFCNjE5QzNDNjc0NkJCMDZFNjUwQzQ0M0M4Mjc1MDI1NUVEOTU2Q0FBNUFEODEyM0VGOTk2QzczREZENEM0MjBGNTdBMjYyNUE3MzYyOUQ3ODhERjlGNjg5NkNENzU5MUM0Nzk3RjczNkFDNDAzREQ1QTRGNDczRUNFQUE5NjIzNzVBRjkxQjMyQzg2NTIyMDAwODc4RjI3Qjk2QTJCMENDNjUxM0M0RDBGOTJFMzBBMERFRDhBRDY2NzI4QTNDMUNCMTZBODM3N0I4MDY2NTM2MjcyMENEQUZGQjVFNUVCQkUyQjcwNTlEMzczRkFDOEExNzlFMTBGMURFNjVDQzM2QTY3NjAyQjJCRDdCN0I5ODYyNTdBMDQ4RThBQjBGNTUyMzI4NjI4ODRDMTg2NzVBRUNCRjEzNDUzNjcwRUI3NkY1RUE0NTMxNkYyRDgxRkI2QjIxRTYxQ0U3MjIzMjdBOTZBMDM4NzI5NzJGRTYzREZGREE3QTkzQzY2OTE4NTdGMzU2QjYyQTQ3NTc1Rjk1QUNERTM5Mjc3NDREMDRDRTkxMTEwRTM4M0VGOTIzMDQwOEE4ODVBNzEyQUVCNzQ1NkU4MzBFRDU0NDY1OTI5REY1MEFBMDE3M0FDQ0EyQzk0MkIxODgxRTgxOEEyMrAVCgpjb19zaWduZXIxGgIwMTqGCAqABEMyQ0Y5Q0Q5MjU0MTNGQjNFOUI1QTc1MzY3NEY1MDY5OEVCMEEyNjFCRjE1NzlGMjlCQTdDMjY4RDE3ODNENzEyOEE4QjI2QzI3MUYyODVDRjY1MUQ2QTE1M0JENzc1MkJFRkVFNzdFMzdFRUUyOTVDQTUwQ0I1QUUzMkU2N0M5M0VGMTQzMEZCMTc3ODJCQUVBNzhDRTEwMzNCMzYyMDBDQTgxODlEQTQxNDZFMEU4Q0ExQTMwMkQxOUQ3Nzk3NkE4Q0Y0MDM1QUUyMzI3MUQ0Mjg2REE2NDY0NENCN0UxRDMxNDA1Q0RDMzY5Nzk1MDIwRkIyRjYxNTZFQjUwMjY1ODczNDQ5QTcyNzExNzc5Nzc5RDgxMkU1NTE2NTI3N0Q0NzlBMjdCNTZBQTU2ODY5OEM0MjcxNjZGNDBGQTkxQ0E4MTJBN0JERTFDMTlCQUJERjJCNzM1RUYyQzBDNTNDMzZCODFBNEJENjNFNzg4OEU4MTg5Q0RCNjA4RUQxQkU2NkVDQkZCN0ZCNzFFMTIxMTFBOUUxNjU1QzNENzBGMUE5NDc5QzVBQzc1NzA3OTk2MTMwMTA1QTdDMzhGMjVBRjAwQzIwQTQyM0U2MTRGMzc1N0U1RjFCNzhDNzcxMURGRjg4RTVDQzZEQUQ5MUE0QjgyMTIxQzVCQjUyQkREEoAEQzJDRjlDRDkyNTQxM0ZCM0U5QjVBNzUzNjc0RjUwNjk4RUIwQTI2MUJGMTU3OUYyOUJBN0MyNjhEMTc4M0Q3MTI4QThCMjZDMjcxRjI4NUNGNjUxRDZBMTUzQkQ3NzUyQkVGRUU3N0UzN0VFRTI5NUNBNTBDQjVBRTMyRTY3QzkzRUYxNDMwRkIxNzc4MkJBRUE3OENFMTAzM0IzNjIwMENBODE4OURBNDE0NkUwRThDQTFBMzAyRDE5RDc3OTc2QThDRjQwMzVBRTIzMjcxRDQyODZEQTY0NjQ0Q0I3RTFEMzE0MDVDREMzNjk3OTUwMjBGQjJGNjE1NkVCNTAyNjU4NzM0NDlBNzI3MTE3Nzk3NzlEODEyRTU1MTY1Mjc3RDQ3OUEyN0I1NkFBNTY4Njk4QzQyNzE2NkY0MEZBOTFDQTgxMkE3QkRFMUMxOUJBQkRGMkI3MzVFRjJDMEM1M0MzNkI4MUE0QkQ2M0U3ODg4RTgxODlDREI2MDhFRDFCRTY2RUNCRkI3RkI3MUUxMjExMUE5RTE2NTVDM0Q3MEYxQTk0NzlDNUFDNzU3MDc5OTYxMzAxMDVBN0MzOEYyNUFGMDBDMjBBNDIzRTYxNEYzNzU3RTVGMUI3OEM3NzExREZGODhFNUNDNkRBRDkxQTRCODIxMjFDNUJCNTJCREVKiwEKQDAyMjYyOERBRTQwMTNDQTAzOEI4MkIzN0U4QzdENDMzQUJDNDIyOUYyNjJBMUI2NkI0RDRGNkVGN0RENkNDRUQSQDA1QTdFRkZCQjZCMjY3NDg0RTU2RDI3MjU2RUNCRDYzQTdBRkQ4MUJBRTEyNzg2REJGM0YwN0Q4NDA4RkY3QzQaBXN0YXJrUoAEQjhFNEQ0MDk5OUUwNDVENDZENzk5NTU2M0Y4QTlBMEE5RkQ0NEE0MjNEODE2MkQ4NkU3ODJGODRERTVDNEY4RUE3MUJEMjYzMjVBNTQyMDc2MTY1ODNFQ0E5MUMyRTVFM0E0RTM0MDRBNUIyOEEzRkVCMjM0QTMxRDEyRjE0NzJBMjdFMERGMjlCNEI0MzE1MUVEOUI3Q0FGMDQ5MEM1MUNFRkY2M0VBRDlGQzExM0E2QURDMEJDMDBFMTlCQjdCMjM4QTg0ODMxNTk0RjI5ODZCMEJEQzkwQjE2QzYxNjYwNjA5RTg4ODgzODFFMjIzOUVGRjAwNjFEQzg5QTZGMjI0NEJERjlEQTY1NTU4RDgwMDcyNDI5NTc1QzFGNjhBQUY0OEU3MzhENjgwQzQzNzg1NDFDMjYyMUQ1REE3OTNGRUQxOUUzRjE3QjAyRkFEODc5MTZBOUQ0MkNCRTFEQjQ1MDI1Q0RFRUZCMkEzQzJGQTk1MzQ5NzUwNkJFNjQ4QjMyNTY4MTNDRTk5QTVGRTZBNjU3M0FDMzhBREMyNEQzN0U5OUUxQTA5OEQxMkQzODg5RDk0MzRCQkRCM0IzMDA1ODQyNzZFMEIyMkUwRDI1NTdERjlGMzhCNUNENkNDQzFFRkRGMEU4QzUxQ0Q5QjdDOTlCQkJGOTY5M0VDRTFqgAQ4QjFGMTI2OUM1OTEwOUUyQzlBNkYxMDFFNThCQjcwRkJEMEM5N0MxMkI1OTVCRTA2RUFFMEQ1MERGNTlFQ0Y0MUNGMUZGOTBFODVFMUY3QzFFOERGMEY5NDcxODBBRkQzRDk3RDIwNDBCMUNEMjZFNDYzMEUzQ0FCNTk1QTNFMzlEQjFCQzY3Qzg0OEJENUREMkEzMDU5RUM1RTA2QjUwQkJDQUNCRjM2MUM3RTA2MTFBRDcwNzEyOTcxMDYwNDVDMDYxQUQzNTIzQ0I1Qzc1OEU0RTI3NzY4RDFERTc5OEEwMUYzOTVEOUE1RDcwQTdFOUExNzFGRURFNTlGNDBBMDFCRUEzQTAyNTc1MERFQTBCREVGRTg5OUI4NTNBNTkxRjVFNDk4OEUyOTA1NTI2MzlBOUY5RTAwM0E0MDIwQjY5Nzc0MkRFNTI5MDBGQjIzMDc4QzVGMUI0QjY0NUUzMjVCQjkwRTZBQzE0MENENjEwNDg2NEU4MTkyOTA1QjAzNDc0QTI1QjdDOTk0NDk4RTE1OUQwNDU1NTczQkMyOTFFMDhCREYxMkExQjNEQzAyQTE3QjUwNDk3OTc3RkJEM0E3RDFEQkM2RkY3Q0EzQkU2Qzk2RERDM0M0MTM1MENDMTRCODkwMDA3RkE4NDk0QkRBQTk1QjhBQkRFMTA4N3KABDdDQzU1OEVCMzRBRTM5NUJBNDJGRjc5NUM5RTJCOTQ1MzU3Njg4NzE0MzU4RkVFNEM1QzBEOUJGNDRGNkFFQTY1QThDQkUxQkJGMkRBQUM4MzAzMTM4MUFCQzQzNkUwMzVGN0I3MTRFQjk5NjREMzJENTRBMzM5NjAyNjFDQTFFRUYyQ0YwMDg2RURDMTZEQTlFM0YxQ0JDNDNENEUwQTI2MTEzMDhGNkY0QzEzNzI0MzBCNkEzM0Q4M0U0OUQ4RjFCQTQxNjJEQkEzNEIwRTU3QjMzNURDNjcwNDg0MkI1NTg2MTcwNTc1MTYzNTdDOUJGNDhDMjA1Mjk0QTIyOTBFMUM0OUYzNDY2QjVBQjU4NzkxNzNEMDU3RDkxRTIxOTY5MjM5MDNEQjc2MzQ0RkIzQUQ2NEFBMEI5QTM4MEM2NUU2MDU3RjYzQjRBOEJFMDc0NTI5RTYyRUJENEJDNEQwNjYxNTY1Q0FCQjBGMjU0OUNBRUE1MzQwQUNENkJGRTNFNzU2RjY0OEIyNDA0NUVERTg5QkQ1NUIwMkJEMURGMTdFQUNEQjE3OUZENTlFQzU5NEVCNTY0NUM0RUU3QzlEMjI5RjI1NEI0N0U5Njg2NDJGNDQwNjhCMERDOTg5MDIzNzUyRDJGRTJDQjY5NEU3MDRCQjgyNEQ3Mzk3RjUwMrAVCgpjb19zaWduZXIzGgIwMzqGCAqABEIxMkQwMUUzOUY3QzA4OTIyMTFBMURGRjVFM0Q5NjFCQzkxMzk3Qzc2MDIxQUI3RUVCRkYyQ0U2QUM4RTBEQTdFOTY2NDIyODI5RTUxMEVFNkExM0RFQzRDMjAxQ0ZFMzEzQzcyRjI5ODNFREE4Qzc2MzREOUFBNDgzNzEyNEVDQ0IyREY4MTBDMDYyMEFBOUU1MEVEN0UwQkNBREI5OEJENkJERjY5QTg3NjAxRDk5NEI4MDhFQzUwMDNEMTZFRDg0ODMyN0M5RDFFNzk2RTkxMjBBQ0FFMDU4ODM5ODBEQUQ0RThBNUQzODQyMDVBMDMyRkE1OUIzMkQxQTE4OEU3NDAyRThCMEZGMDA3M0Y5QjMwODk5ODAxQkM0NEFBQUI2NUMzQzlFMERBMERDMTNGRENDOUM1QTlERUY2MDlBNEQ4MjU1RTMzQTRGNzJDMkI0OTg3NjM2QTJFNkRGMUNCQTcwQkU0QkFBODc3NzE4N0I5QzZBMjNDNUVFMzg4RTNDREQzOEUwNjAwOTg5MjA4Q0ZEQjEzQ0QyMEQ5MjI2QTQ5NjE4RTBBODVDMEQzNEJFQUUwNTFDMjRERjQ2N0ZGQjRGMzkyMTNCMTBFQjJFMDQ1QTAwNDRGMTRENjJFNjlDQzYyOEVDNzQxQ0Q2NUZDREM0M0IzNDE1QUU3QkZEEoAEQjEyRDAxRTM5RjdDMDg5MjIxMUExREZGNUUzRDk2MUJDOTEzOTdDNzYwMjFBQjdFRUJGRjJDRTZBQzhFMERBN0U5NjY0MjI4MjlFNTEwRUU2QTEzREVDNEMyMDFDRkUzMTNDNzJGMjk4M0VEQThDNzYzNEQ5QUE0ODM3MTI0RUNDQjJERjgxMEMwNjIwQUE5RTUwRUQ3RTBCQ0FEQjk4QkQ2QkRGNjlBODc2MDFEOTk0QjgwOEVDNTAwM0QxNkVEODQ4MzI3QzlEMUU3OTZFOTEyMEFDQUUwNTg4Mzk4MERBRDRFOEE1RDM4NDIwNUEwMzJGQTU5QjMyRDFBMTg4RTc0MDJFOEIwRkYwMDczRjlCMzA4OTk4MDFCQzQ0QUFBQjY1QzNDOUUwREEwREMxM0ZEQ0M5QzVBOURFRjYwOUE0RDgyNTVFMzNBNEY3MkMyQjQ5ODc2MzZBMkU2REYxQ0JBNzBCRTRCQUE4Nzc3MTg3QjlDNkEyM0M1RUUzODhFM0NERDM4RTA2MDA5ODkyMDhDRkRCMTNDRDIwRDkyMjZBNDk2MThFMEE4NUMwRDM0QkVBRTA1MUMyNERGNDY3RkZCNEYzOTIxM0IxMEVCMkUwNDVBMDA0NEYxNEQ2MkU2OUNDNjI4RUM3NDFDRDY1RkNEQzQzQjM0MTVBRTdCRkVKiwEKQDA0NEY0MTBCMTA2MzY2Njg4REE2MUM3ODZBRTNCODgwNUUwMEZDMEY0OEM1OTMxNTg2Njg4RDFFNzU0Qzk4MkMSQDA1RDE4Q0MxRDk5OTEyRDBBMkFDOTZFMjFCOUMxQUFFQzA3Q0M1QUJGRDREOTYxMjM2Q0M1RTRDMDMwOEQ4NEYaBXN0YXJrUoAEQzE0MTA4NDA1MkJFNEE0NjhGNDJENDlFNEZBRTc2M0ZFMDcwQUJEM0Y3OEU3RDI5RjNFRjA4Nzk0Q0VFQzM1M0VDRTRDRjZCQjYxODY2RDdGMDM0OTNDOUE0NkNDMDJERDI3NjdDOTExQjAwOEZDMERDQzYxNkEzNkQwNDFDNzJBRDA4RUYyNTREOEUyQjlDNEIwQ0UyQTBGNjdBQUI5ODQ3QjgyNjREQjYyNTNGQTkyMTVFQzM3OEI3NjAxOUQxRTk4QzlFQUY5Q0JGM0JCN0I5NTk1NjkyQTUyRTA5RjcxMzQyOEZEMzQ4RTdDRUQ3OEUyNTczMDQ0NDJCRDUyMEMyMjdEMUExQzgzMjM0RkZDODMwMEQ3OUJGRTk4RTJGRjhBOUI2MjY1MjM5Rjg0NjA1RkVCNDZGN0Y3ODUzMUIzQzFFNDU2NTc3RDFBMDA1NzI5MzRFMjE2OEQ0NkY4MzQ3QUFCRkNDMTRGQUU3RTgwRkM2MkM5NDkzMEQ5M0IzQkM0QzRFNUMxNDJDNEEwQjIxRkM5RjRFQUVBOThBODlFRTEwM0Q2M0YzMTJGQUUzQ0QyNjVBREVEMDM4MDlBQTlBQzkzMzE4Q0VBRUNFRDg0RkY0QjIwOUE3MjJDOUJCMzhGNzI1MDY3QkJDMUQ3NDQyREU3NTRDRDkwQjQ3QkRqgAQ2NDJCQzFCREM0NTgyN0IzNjgxMURDMEFCNDE5QkFFMjdEMjkyOTkzNEMxODgzQUQ0QzBGQUE5NEFBQzZCRjgxMzVGMUU5NTA2MzQ5Njk2Q0VFMUZDNjNBRTU5NjdEMEFDNzQ5NjNDNjY4RjdGREFBNjY3RjY2NzA0N0FEOEQxNDkxRUNENDgxRTgzQTM1RUFBQ0U0MTc4RTAxQjFENzU5NjQwREM3RkZEMkU1QTIwMzRGREU1MTc3RjU3MEU1NzdEOTM1NEE1OUIzQ0JEMjgxMzVFNTg3NTM2Q0I2QjhDNzU3MkIyODk3ODZENDdDNzJEMUI0QUM3OTUxNDg0QkQ1MkRBRjk3RUUwN0IxRkMwQzIzOTAxRTQ4ODUxNDZERDg4MjQ1OTA5MEUwQjcxM0IxODQ2ODk0NjAyMTJGRjEzOTE2MkVENEY1ODNDNjA2NkE5QjZFMTNDMDdCM0QzRjhBNzVFNEEwNUZCMzdDNjA1MjVBNkY1QTJDRDgxQzA5Njg4RjM4QkVFQkIwNkMzN0U3Rjg4NjNENjczNjY4QkExNDUxNjVCRjQ3MkZEQTYwOURGQUZGRDlBOTlGNTg0MzlDMzk4MTdENTRDRjY5RTdFRTNFNERGQjczRjE0MzMwNjA0MkIxMzcxNDYxNDUyMjVFMUIzQ0NFQjM2M0VEODExM3KABDEzMkY1RTMzQzk3NjJCNTM0MENCQ0M2Q0I1RkU1QTA0M0Q2OEQ5MzVFQUYwRUU1RTQ4QzQwMjBDN0IyNTAwNDMxOTVCMzJDM0VGNzJGNkEzRDg3RjIzN0U0Mjk1Njg0QkU0RTI5QTRFQ0RFMjM0NTNGQjQ1QjBEMzc2QjM2NDZFMTkxN0NCRDI5NTU0MkNDNzAwNTM4N0RFQzFBMkFDNTM3RkZGRDJFRTdFRDA5QzY0MTNCNzc1NDFGM0QyMzVDOUUzQkVGQUYzREUzQzRCMDRBOTMwMkY5MjU4RUY2QzVFNjUyMkRFRkI1QTg3NjVDNDE4NTcwODczM0ZDODU2RkM3M0U1MjU5QTU4OEVFQjQ4MzI4MTg5NDkxMzdBRkM3QzNEMUNFMjgyQjg5MzZENjJCNjU2MUI3MTNCQzY1MTE0MDE3QTQ3MDBBQzMxREFGMkVGNjRFRjdCRUMwQjA4Q0JDQjg4Q0NEMjM3MEM4OTEzMUYyODE0NEU3NEJCQzBEOUQwMzU0M0REQ0IxQ0FGNzNEM0U1QzQzQTVFRTcxNTk1RjhFNjFBM0U4Mjc3NzlEMjFDMkEwMkE1MkYxNzk1N0I1MEJFRTYzMEFGMDBDNUVBRTYyMTQ4NUQ0MUQ3RkZENkVEODE2RjY1MEQ5NTA0NUZEMjMzN0I0QzY5QzY3RUI5OosBCkAwMkNGM0JGRjg3OUEzRDRDMUNGNDExQzA2M0VGQzk2REE3RTdEMERBMERBRDIyMUVBRUVDN0E0MTVDMkUzRTI3EkAwMTZCMDFCQkIxMENDMDY5N0VDNUYwMjBDRURCODU3RDcyOTI3MjBCRDdCNDk0MDYyMkIzQzY5OTQxMUQyOTMwGgVzdGFyaw..";
-    sign_key_base64_arr[2] = "Cgt3b3Jrc3BhY2UgMBACGAMqqUYKCmNvX3NpZ25lcjMaAjAzMqckCoAEQjEyRDAxRTM5RjdDMDg5MjIxMUExREZGNUUzRDk2MUJDOTEzOTdDNzYwMjFBQjdFRUJGRjJDRTZBQzhFMERBN0U5NjY0MjI4MjlFNTEwRUU2QTEzREVDNEMyMDFDRkUzMTNDNzJGMjk4M0VEQThDNzYzNEQ5QUE0ODM3MTI0RUNDQjJERjgxMEMwNjIwQUE5RTUwRUQ3RTBCQ0FEQjk4QkQ2QkRGNjlBODc2MDFEOTk0QjgwOEVDNTAwM0QxNkVEODQ4MzI3QzlEMUU3OTZFOTEyMEFDQUUwNTg4Mzk4MERBRDRFOEE1RDM4NDIwNUEwMzJGQTU5QjMyRDFBMTg4RTc0MDJFOEIwRkYwMDczRjlCMzA4OTk4MDFCQzQ0QUFBQjY1QzNDOUUwREEwREMxM0ZEQ0M5QzVBOURFRjYwOUE0RDgyNTVFMzNBNEY3MkMyQjQ5ODc2MzZBMkU2REYxQ0JBNzBCRTRCQUE4Nzc3MTg3QjlDNkEyM0M1RUUzODhFM0NERDM4RTA2MDA5ODkyMDhDRkRCMTNDRDIwRDkyMjZBNDk2MThFMEE4NUMwRDM0QkVBRTA1MUMyNERGNDY3RkZCNEYzOTIxM0IxMEVCMkUwNDVBMDA0NEYxNEQ2MkU2OUNDNjI4RUM3NDFDRDY1RkNEQzQzQjM0MTVBRTdCRkQSgARCMTJEMDFFMzlGN0MwODkyMjExQTFERkY1RTNEOTYxQkM5MTM5N0M3NjAyMUFCN0VFQkZGMkNFNkFDOEUwREE3RTk2NjQyMjgyOUU1MTBFRTZBMTNERUM0QzIwMUNGRTMxM0M3MkYyOTgzRURBOEM3NjM0RDlBQTQ4MzcxMjRFQ0NCMkRGODEwQzA2MjBBQTlFNTBFRDdFMEJDQURCOThCRDZCREY2OUE4NzYwMUQ5OTRCODA4RUM1MDAzRDE2RUQ4NDgzMjdDOUQxRTc5NkU5MTIwQUNBRTA1ODgzOTgwREFENEU4QTVEMzg0MjA1QTAzMkZBNTlCMzJEMUExODhDQzk3NUEzQkIyMjQxN0QyOTM3QkEwQjE4Q0RDQjlDNzEyRTg3RDk0MDI2Qzc2OUNDMDc4RUYxMEE0N0M5NUNBMzFGRjdCQzNBQ0UwMjJDOTAxMTYyMTA4ODVFQ0E1MTY0QjgzNDlGRjRERDRBNkZCMUIxOTAwMjczNUFGRUJCMTExREIzNjY0MUYwQUY2MjYwMUUzQTg1Njk1RUZCNDc5RTIyNjkzRTk4ODk4NUU5NEE4Q0M4QkMzNUYzN0NDNDEyMzdEOTU4NTVEQUQ3RTlBMkQ2OTJFMkEzNDlCQ0FGMEEyMTY5RUE4MzgwMUI5MkE2MjY0OEUyNDE4OUE2QURCQxqABDgxMERCNkFERjcxREE1MkQzMkI0MjlDREIyQjc1Q0EzMjZGN0I3NDA3MjBFRTVBRjBFOUNGNkNFOUFEMDFDOEY2RDU1RDM0RDU3OTlGNzg2M0JERTE1NTNBN0ZDQjc2NjFDRjQ4MThFRjgzNTBBRTIwRkRBQ0QzRUE5RTlGNDRCQzZCM0ZDRjU4NzhFMTg5RTNBODgwQTgxQTkzMDgyMzBBOEY4MUE0OTY0QTBDNTkyMjUxMUZERUE4QTM2M0ExMDNGNTU5N0EzMTJCRkVCQjM1ODlBRjNBODk1MTVGQzQ2MTdENEZCRjU4Mjc0QTUwQUU4MDhGMTVDQ0VBNkI4MjA4QTBFMjFDQTREMkYzRTgzNEIyNzk1MTA3MzYzQkFBQTc3ODZEMTM2QTc0NTkwNjlCNzQ4NTZEMTQyREUxOTY3RDQ5RTE2MEJGNzcxMzZFQTdFMzI0NzI5RDNDRTFFMkQxOTVBRTU3OUQzNDU2RkYxNzg2MTQ4NUUyM0YwNkI3NkZDMTAzMTRFRDc0QUVGQkRDMTY3NEIzQzREMUIwQTRBOEEyNEZGNjE5RUIyM0RFRDE3NjVFOUE1MERDN0YwMEREODBFQzlFRURFNDk3OEJGNUNCODA3OEE0RkFBMUE3MEEzMzNCM0M1NEEzNzlDOEFBQzMxM0U4MzZGMjFDMTg5IoACRTBBOTE4MUNGRUIwRUUxNEQwMUE4OTA3NzY4NzY4NDIxRkM0RUI5QkI0OEE3QkZFREJEOUYzQjZGRjc0NkM2MEQzM0U1RTJGNTQzMTc5MjcyQ0UwNDBFQjNCRTIzRUMyQTA3ODQ1NUQyM0UzNUExRTc5RUNGRjMyNDYyQTE5NDc0MzhFMUMwNTNBMzRFNEVFMzgwMDk0RkUxRUEyOEY0QkFEQzRBQTQ3RTk3RTlEQjJFMkM3N0I1RDkzMjkwRTI0NUY0ODZCN0MzQjZCNkFDMUIzM0FFREYwNDBENzdEQUQ0QUI0QTgwQjM1QTkxNDQ5RkZFMEY0M0ExRThFOEU3MyqAAkM5RTQyQ0Q4REUwRTA4QkJBQjM0MDU1RkQ3NzE0NUY3NjgwRjc3QzIzMjRFRjY0OTFBNjNCNzk5NTZCMTk3OTY1QTRDM0I3OTE4MUJDRDBCNzY1NjI0QzMwODNBNEVGNTYxQzNEOEY5QTk1OUFENDg1MDFGNjg3RTI0QzU2NDM1REI5QkI2OTkzNTI1NDFEMjM2QzI5NkQ1NTQ2RkJCM0NENDY4MzAwMDM1NTc4NjM3NEYxRENEODg5RTM5NzQ0OTY0MkQ3NTRGMjRDRDk2Qzk3QThDMkZCMTY2QjkzNjJGMzBBNzk2NURCRTU4MkY2RkE3OUE2NEI4NkQ3OTNGQ0YygARDNTI4NTlFMzk2NDM1OTQ4QTQ2NEMxMjIwMUM0NTYyMDZEQTNEQUM4OEIzQTNENzQ3QUVBMDFGMjYyNUNDNjVGRjNGMDQ4MUQ3OEQzQjYxMEIxMkZBNTE1MUY5MENEOTA2RkY1QjRGMDI3RThGQjE4NzU3ODBEQTE3QTU0ODkwQTM1MEZFQjZGNDcwRjQ3Mjg0MDlDRjMwQTY3OUM3ODg2QUZCMEJGRDhBMzg5MjBGMEI2OUNEQTY3RkZBMUZCNUZBODkwRDA0NEEwODExMTVBMzQ1RjBBODZBQjBCQTRFOTFFRkEzMkY0MjA5QzIyQkRCRkZGNkE3NDA1RUMwNDZCQzkwQ0E4NTE5OEU2MzNGNUEyQzY3Q0QzNzcyMTdDN0M4OTVEOTkwREY3RDVDOTQ5MUVBQ0NGMEZBNTIyMUM1REQzMTBFQTRCQzFGRDVFMTI4NjRBOTA4Rjg1MERCRjUyODREOTBBRkE5NEM1QURDRjdBMkUwNUJGOEFFNkJEQjQxRjQ5QTc0OUM0RDkxQkMwMzJBNjI5MzEwRjJBQTc0RjVFMDA1RkNBNkE4QkM2NkVCNzBEREMzRkIzQTE1RjQ5RkZBOTA3ODA2M0M0QTUwODRDRkZBQTgwMDE3QzFFREMyMjg4RDczOTdDRjk4NjQ5RkYwOTdDRTE0QUQ3QzdBOTqABDlGMzgxOUNDNzZEOEQ2QzI4QzZDM0M4RjRFNkFEQ0I3NDI0NTI5RDlGQzcyMTM4NzY3QzdERTlCMUZDMTk1RUNBMTg0NTI0NTk3OTFFMUVFQjAyNjRDOTgwMTY1RjAzNzMwQUQxMzlBQzhFNkI2NUQ3MTI3OEEzNkZERjJDOENENkJFNjRFNjg1MjlCNjBDOTFGRUE5RjQwODg5RkIzRTk4QUNBNEE4MDk1MEFEQjAxRkU0RjYzNjAyQUUzOURDNjk3MzcwRTY0NDRBMTY2MERDMzU2NUY4RjZFMEMyQkY1ODk3QTI2QTUwQjJBQkM5NzAxMDlFMjQzQjA5MEY2MEMxRjkzQUQwRjJCNzYyMTU4QTQyRTk4QTQ0OTg2ODgzQTIyNEEwMkEyNzA1NzdFOTg2NjE2NzdDQzRGQUEwNzExOERCNjUyNjM1NkNGREZCNjMwOTAxOUVEQUMzQzY0NDIyMjlGMkYyQjdFMjU3REQ3M0YyMzYwNUFCM0NCQjI5MTY3RjdCMDVEMzlDMzM1ODExOTc2OENGRUUxNzBEODQwRTVBRDUxQjU3OTI2REE1MjI4QzAyM0VCODQ0MTg2Mzc1RjMwQ0FBQzFFOTI0NTBGMjgzMEM1QzQyRUQ2RjQ0RUY4RDYwQjIwOEIzQkQ5MDcxRTAxRUI1M0E3OTU4OTYxQoACRTBBOTE4MUNGRUIwRUUxNEQwMUE4OTA3NzY4NzY4NDIxRkM0RUI5QkI0OEE3QkZFREJEOUYzQjZGRjc0NkM2MEQzM0U1RTJGNTQzMTc5MjcyQ0UwNDBFQjNCRTIzRUMyQTA3ODQ1NUQyM0UzNUExRTc5RUNGRjMyNDYyQTE5NDc0MzhFMUMwNTNBMzRFNEVFMzgwMDk0RkUxRUEyOEY0QkFEQzRBQTQ3RTk3RTlEQjJFMkM3N0I1RDkzMjkwRTI0NUY0ODZCN0MzQjZCNkFDMUIzM0FFREYwNDBENzdEQUQ0QUI0QTgwQjM1QTkxNDQ5RkZFMEY0M0ExRThFOEU3MkqAAkM5RTQyQ0Q4REUwRTA4QkJBQjM0MDU1RkQ3NzE0NUY3NjgwRjc3QzIzMjRFRjY0OTFBNjNCNzk5NTZCMTk3OTY1QTRDM0I3OTE4MUJDRDBCNzY1NjI0QzMwODNBNEVGNTYxQzNEOEY5QTk1OUFENDg1MDFGNjg3RTI0QzU2NDM1REI5QkI2OTkzNTI1NDFEMjM2QzI5NkQ1NTQ2RkJCM0NENDY4MzAwMDM1NTc4NjM3NEYxRENEODg5RTM5NzQ0OTY0MkQ3NTRGMjRDRDk2Qzk3QThDMkZCMTY2QjkzNjJGMzBBNzk2NURCRTU4MkY2RkE3OUE2NEI4NkQ3OTNGQ0VSgAJBNTk0MUM2NjRDMkJDN0UxOUQ1QUE0N0E4OTc2NjRDOTkyQkQxMkY3NEE3NkYzNEE1Q0EwRTk2NTJCOUU0MTg5NTk2RDRCQjdENEI4NEFGOUZDRDQ4QkRGRUIyMDQ4MjgzRTVGRTBEOURCMDZBMzI5QTcwMTk2RTczMkQ4MkRGRDk1MTdFNUE4NEREQkUxQjVBQTM3NjUyMDI5MTVBN0JFMzJEQkM3MURGRkVBRkIzNzkxOUUxMDFBQUZFRTk0NjVGNUM2QjQ3RUY0NzJEMEUxMkEwNUNENDU1OEEyNzZGMDA5M0RBQjBBQkEwNDZEMkU4Q0M3NjRDOENBRTc1NUIwWoACMzUxODEzMkNGQTc1MkE3NkQ0RjFDM0M1QzE4REIxMjgzRDE3Q0M0RTRBRENCRTFDNkZEMkU5RUNBOUI2MDYwQzYzRjNFQjYzODM5NzEzQTkxMjMxQzUxRUVGQzA4NTc2MTJDM0M0QkNBMDMxMThEODVBNTQxNzQzNDE2ODYxMkE0MEVERTg1NkRFQzQ1REI3RDc5QTJDMDVGNTlBRkExMjkwRjg3OURDOEI1MzFCNjlFQThDOTFBMkI1MUY1RjkxRUNDMzM4MTQ3QTAyODk5Rjg5MTA5QTBBM0ZDNkNDNzg0M0NEQTIyNDY3RUNCOUEwNURGNUExMDQzMTVEOUJBNGKAAjNCMTRGQkI2QjI4NTI2MzMzMkJGRTQ4Q0VEMTEwMzc4OEQwN0Q4QTQ2QTEzODhCNDdGMzkwQTUxRDNENjJBRDc3OUQxMTI3NzdGNzkyRTJEMzAwQkI1MEI1MEMxRjY5QTYyMTg2NDgzNDhEQ0I2RjREMkVCNjg0QjEzNTFFQjQ5QUU3NjM2NUNFQzU5MDMzODhEQzkyRkRERjU4Q0U3OEQ3QUU4RTMyOUU5OTNBMjdCNTEyOTZCNDJFMzNBNzlCRTY5ODFCNkZENDZGODk5RTA4OTM1MjBBQUU4MzUwNkJENDE3NkZEMDA3QkE0QTcxQjczMTk4RjcxNTNBNzM4QzNqgAI5NENDMTlBQkUzOThERTQ0RDY0MjQxOUExNUUzOTRDRjJBRjdBQjczRTc3MjM4MkNBQTkwQ0RBQ0FDRkI5MTg5RjY1ODUwMTU5NDg0Qjk2MjY0MjQ1RkE0MTg3OUM5N0Y0RjAwMTQzRDA5Mjg5NDZGRjVDQjUxM0FFMzVEMDMwQjlBQURDRTQyNTY2MEU0MUE1RjI4NkFDRjVFRDRDMTJBNDM2RkI2MjNBQTA0NkFDRDY0OTEzQkU1RTkxQTE0Qjc3NzZBM0QzQUFBQ0IwRDI5RjE3Qjk1QTcyNkYyNjlCNkVDRDlGNDM5NTY2Qjc1Q0Y0OUE0QzNCNDNDMUJBNDJCOoYICoAEQjEyRDAxRTM5RjdDMDg5MjIxMUExREZGNUUzRDk2MUJDOTEzOTdDNzYwMjFBQjdFRUJGRjJDRTZBQzhFMERBN0U5NjY0MjI4MjlFNTEwRUU2QTEzREVDNEMyMDFDRkUzMTNDNzJGMjk4M0VEQThDNzYzNEQ5QUE0ODM3MTI0RUNDQjJERjgxMEMwNjIwQUE5RTUwRUQ3RTBCQ0FEQjk4QkQ2QkRGNjlBODc2MDFEOTk0QjgwOEVDNTAwM0QxNkVEODQ4MzI3QzlEMUU3OTZFOTEyMEFDQUUwNTg4Mzk4MERBRDRFOEE1RDM4NDIwNUEwMzJGQTU5QjMyRDFBMTg4RTc0MDJFOEIwRkYwMDczRjlCMzA4OTk4MDFCQzQ0QUFBQjY1QzNDOUUwREEwREMxM0ZEQ0M5QzVBOURFRjYwOUE0RDgyNTVFMzNBNEY3MkMyQjQ5ODc2MzZBMkU2REYxQ0JBNzBCRTRCQUE4Nzc3MTg3QjlDNkEyM0M1RUUzODhFM0NERDM4RTA2MDA5ODkyMDhDRkRCMTNDRDIwRDkyMjZBNDk2MThFMEE4NUMwRDM0QkVBRTA1MUMyNERGNDY3RkZCNEYzOTIxM0IxMEVCMkUwNDVBMDA0NEYxNEQ2MkU2OUNDNjI4RUM3NDFDRDY1RkNEQzQzQjM0MTVBRTdCRkQSgARCMTJEMDFFMzlGN0MwODkyMjExQTFERkY1RTNEOTYxQkM5MTM5N0M3NjAyMUFCN0VFQkZGMkNFNkFDOEUwREE3RTk2NjQyMjgyOUU1MTBFRTZBMTNERUM0QzIwMUNGRTMxM0M3MkYyOTgzRURBOEM3NjM0RDlBQTQ4MzcxMjRFQ0NCMkRGODEwQzA2MjBBQTlFNTBFRDdFMEJDQURCOThCRDZCREY2OUE4NzYwMUQ5OTRCODA4RUM1MDAzRDE2RUQ4NDgzMjdDOUQxRTc5NkU5MTIwQUNBRTA1ODgzOTgwREFENEU4QTVEMzg0MjA1QTAzMkZBNTlCMzJEMUExODhFNzQwMkU4QjBGRjAwNzNGOUIzMDg5OTgwMUJDNDRBQUFCNjVDM0M5RTBEQTBEQzEzRkRDQzlDNUE5REVGNjA5QTREODI1NUUzM0E0RjcyQzJCNDk4NzYzNkEyRTZERjFDQkE3MEJFNEJBQTg3NzcxODdCOUM2QTIzQzVFRTM4OEUzQ0REMzhFMDYwMDk4OTIwOENGREIxM0NEMjBEOTIyNkE0OTYxOEUwQTg1QzBEMzRCRUFFMDUxQzI0REY0NjdGRkI0RjM5MjEzQjEwRUIyRTA0NUEwMDQ0RjE0RDYyRTY5Q0M2MjhFQzc0MUNENjVGQ0RDNDNCMzQxNUFFN0JGRUJAMDNEREQ1OEM1NkE3RjIyNkYxOTQ2NjI2RDVEMzI0M0Q4N0I2MDYyRjlENzlBRDA5RTRBNTkyREI3RDczQ0ZFNEqLAQpAMDQ0RjQxMEIxMDYzNjY2ODhEQTYxQzc4NkFFM0I4ODA1RTAwRkMwRjQ4QzU5MzE1ODY2ODhEMUU3NTRDOTgyQxJAMDVEMThDQzFEOTk5MTJEMEEyQUM5NkUyMUI5QzFBQUVDMDdDQzVBQkZENEQ5NjEyMzZDQzVFNEMwMzA4RDg0RhoFc3RhcmtSgARDMTQxMDg0MDUyQkU0QTQ2OEY0MkQ0OUU0RkFFNzYzRkUwNzBBQkQzRjc4RTdEMjlGM0VGMDg3OTRDRUVDMzUzRUNFNENGNkJCNjE4NjZEN0YwMzQ5M0M5QTQ2Q0MwMkREMjc2N0M5MTFCMDA4RkMwRENDNjE2QTM2RDA0MUM3MkFEMDhFRjI1NEQ4RTJCOUM0QjBDRTJBMEY2N0FBQjk4NDdCODI2NERCNjI1M0ZBOTIxNUVDMzc4Qjc2MDE5RDFFOThDOUVBRjlDQkYzQkI3Qjk1OTU2OTJBNTJFMDlGNzEzNDI4RkQzNDhFN0NFRDc4RTI1NzMwNDQ0MkJENTIwQzIyN0QxQTFDODMyMzRGRkM4MzAwRDc5QkZFOThFMkZGOEE5QjYyNjUyMzlGODQ2MDVGRUI0NkY3Rjc4NTMxQjNDMUU0NTY1NzdEMUEwMDU3MjkzNEUyMTY4RDQ2RjgzNDdBQUJGQ0MxNEZBRTdFODBGQzYyQzk0OTMwRDkzQjNCQzRDNEU1QzE0MkM0QTBCMjFGQzlGNEVBRUE5OEE4OUVFMTAzRDYzRjMxMkZBRTNDRDI2NUFERUQwMzgwOUFBOUFDOTMzMThDRUFFQ0VEODRGRjRCMjA5QTcyMkM5QkIzOEY3MjUwNjdCQkMxRDc0NDJERTc1NENEOTBCNDdCRFqAAjY1NTc3REU4NzhDQzhGQ0E0RjczM0VFMDhBQTQ3ODNGNTQxRjgyMTc3MEQyRjY3QzlERkNDQzRENTU5MDg5RjY5RkFEREJBN0NDRkFCQkEyM0REQ0E5MTFDNDYwNzFDMEU4Q0M4RTY1QTAyRjlBM0Q5MjFFRkUxNTYwNTVBOTcxQzlCQTY1MDU1QTc3RkMyQUE1MUNFQTRGNUI0M0RERjBFODYwNjREN0UyNkE1QzIxMkQ3ODhDQkU2QUZDNDk3RjM3MjFFMzg2OTYxRkQyQjJEMkI5RkE5RTBEN0Q2MUI1MDc1OUM0RDU2OUEyRkU3NzY5QTIzMkRGNjVFNjQxQTVigAI3QTBCODZBNDZBODkzQTc0ODQzRDEzMTdGMkRCMDQ4MjJCQTAzODkwMjUxQTA1Qjk3MjVDNjlGNUUwNDA1OTU3NDNFOTM0ODRBQ0ZDQjAxMkFERjA5NThCQkM3NTNFMjBGQTE0RkJBQTQyNTU5NDc2MDZEQUNCQzlFMTkyMUI5MjZGRDY5Qzc4OTc4REVCRDI5RkY1QjdERkMyQ0Q3NkM1MDRDRjdBQzc2NkI5QjZCODhCMzA3MjBCQzIwNjUxODUxODM2RUMwMTc2Q0E1QjA0N0RFRTg1MTcxRkQ4NjU5NjFBRkNGMzZCNDVGRDU1MkZBQjY2NEM4MEZDNEM3QTBCaoAENjQyQkMxQkRDNDU4MjdCMzY4MTFEQzBBQjQxOUJBRTI3RDI5Mjk5MzRDMTg4M0FENEMwRkFBOTRBQUM2QkY4MTM1RjFFOTUwNjM0OTY5NkNFRTFGQzYzQUU1OTY3RDBBQzc0OTYzQzY2OEY3RkRBQTY2N0Y2NjcwNDdBRDhEMTQ5MUVDRDQ4MUU4M0EzNUVBQUNFNDE3OEUwMUIxRDc1OTY0MERDN0ZGRDJFNUEyMDM0RkRFNTE3N0Y1NzBFNTc3RDkzNTRBNTlCM0NCRDI4MTM1RTU4NzUzNkNCNkI4Qzc1NzJCMjg5Nzg2RDQ3QzcyRDFCNEFDNzk1MTQ4NEJENTJEQUY5N0VFMDdCMUZDMEMyMzkwMUU0ODg1MTQ2REQ4ODI0NTkwOTBFMEI3MTNCMTg0Njg5NDYwMjEyRkYxMzkxNjJFRDRGNTgzQzYwNjZBOUI2RTEzQzA3QjNEM0Y4QTc1RTRBMDVGQjM3QzYwNTI1QTZGNUEyQ0Q4MUMwOTY4OEYzOEJFRUJCMDZDMzdFN0Y4ODYzRDY3MzY2OEJBMTQ1MTY1QkY0NzJGREE2MDlERkFGRkQ5QTk5RjU4NDM5QzM5ODE3RDU0Q0Y2OUU3RUUzRTRERkI3M0YxNDMzMDYwNDJCMTM3MTQ2MTQ1MjI1RTFCM0NDRUIzNjNFRDgxMTNygAQxMzJGNUUzM0M5NzYyQjUzNDBDQkNDNkNCNUZFNUEwNDNENjhEOTM1RUFGMEVFNUU0OEM0MDIwQzdCMjUwMDQzMTk1QjMyQzNFRjcyRjZBM0Q4N0YyMzdFNDI5NTY4NEJFNEUyOUE0RUNERTIzNDUzRkI0NUIwRDM3NkIzNjQ2RTE5MTdDQkQyOTU1NDJDQzcwMDUzODdERUMxQTJBQzUzN0ZGRkQyRUU3RUQwOUM2NDEzQjc3NTQxRjNEMjM1QzlFM0JFRkFGM0RFM0M0QjA0QTkzMDJGOTI1OEVGNkM1RTY1MjJERUZCNUE4NzY1QzQxODU3MDg3MzNGQzg1NkZDNzNFNTI1OUE1ODhFRUI0ODMyODE4OTQ5MTM3QUZDN0MzRDFDRTI4MkI4OTM2RDYyQjY1NjFCNzEzQkM2NTExNDAxN0E0NzAwQUMzMURBRjJFRjY0RUY3QkVDMEIwOENCQ0I4OENDRDIzNzBDODkxMzFGMjgxNDRFNzRCQkMwRDlEMDM1NDNERENCMUNBRjczRDNFNUM0M0E1RUU3MTU5NUY4RTYxQTNFODI3Nzc5RDIxQzJBMDJBNTJGMTc5NTdCNTBCRUU2MzBBRjAwQzVFQUU2MjE0ODVENDFEN0ZGRDZFRDgxNkY2NTBEOTUwNDVGRDIzMzdCNEM2OUM2N0VCOXqABDNCMTU0QTY5QThBRkY2RTI1QjMxNDI2OUUyN0FBNjE2NEZFMDY1MUNDQTlERDgxMUY3MEExMUE5NDIxODJCRjMyNkZGM0ZDNjBGMjY2OUNEQjYwMEE1QjIwQjY3RTVFRDVGQUFCNjgxMTE1MzVFNDM3MDgyQzA5NDI2RjgxMEUwMEVDNThEMDU4REE1QUQyNjU1MkQ4NTgzRTU3OUUxMEYyQTdBN0U4NzM0NzVERjk5QkIxRkNCMUJCRUE0MTA0ODBFNkI1QUQ2NEYzQUMzQkEyODhDQTQzNTI1RDMxRjMzQ0REQzE0OUFFQkQ1NTgwRTgyMkQ4NDA5RjMwQzM5MUZBODI0NkY1NkQyNkZFOTA4MEY2REJDQkIyRUE5RDRFNERCN0MyRTgzM0RFQTQ5NUY5Qjc4RjY4QkEzNUYwRTZFMjVGOTg0QjRDOThGMkFCQTAxQUNFNDVGQzhGNDQ2NzUwNUM5MTk1Qzc2NjU3NzkxQTU1NDZFRDU4NzE2MDZDMTVBNjYyMURCNkNDOTFDNTQzOEFGRUMyM0M0RjQ0QkY5QkU5RDFDREIzRTMxRTlEQzFFM0NGMDI0RDhCMjAzQjAxNEJGRDY0NzFDRUI3MTcxNDg5Q0EyQjg5MUM4RDM1QzM4MDFGQzU1NjJEMUNCMEM3QTk5QzVCMjE3QzUyMERFggGABDE3OUUyMEJDNzI3QTVCMEU5QUNEMkJFODNCNjM2OTlEMzI1NDY3RDEzOTY3N0YwMUNGNkM3MTg2OTkzMzk2Q0I4NzIwNzI2RDlDNjRDMjIwM0NGQjhGMjIzQ0I4QzJGRDU4QzMyRjQ3RjM2MDU4MjUzMDBENjQzM0I2MjY0NUEzODNGREI1QjRGQ0I2NkMyQUYwNTdGRTE3NDRCRDUxMTE0RDA0RkQ3RkNFNjRBOEZENjBERTBFOTMxNUJCN0ZGQTc3OEQ5OEUxRDI0QTI1ODY2NjY5NTRDOUFGODMxRDc4MUU3QjNGMzk3RjVFNTNENjRCREUwNENDQTk3Qzg1OTJBMDdCREE4N0ExMjkyMjY4MkJGRDRCMTUzOUU3MTFFNjA2OTM5M0M3QTQ4NUJDMTI5MDUzMEY3Q0MyOTgzN0M3OTlCMkEyRTNDRTE0NTA1RjQzNjY4QzQ5MUE2MUE1Q0UzQTEzNkY1MTM4MzcwQjRBRTRERjhCRjc1RDc5MUQ4Q0I5RUQ3N0NCQ0VDNERDQ0RGQkI0MDU3RDg5QjI2RTdFQkY1NjcyRjk4QUI1MUI2N0JCNDI3N0EzODdDMjY0OEI0QTRDQzRCMUM1NTIwMDM5QzMxQkEyRTcxNURCOUMyNTNBOTREQjRBNjc1OTY5NjYwN0NGNTdGQkY3MzgzMjYyMrAVCgpjb19zaWduZXIxGgIwMTqGCAqABEMyQ0Y5Q0Q5MjU0MTNGQjNFOUI1QTc1MzY3NEY1MDY5OEVCMEEyNjFCRjE1NzlGMjlCQTdDMjY4RDE3ODNENzEyOEE4QjI2QzI3MUYyODVDRjY1MUQ2QTE1M0JENzc1MkJFRkVFNzdFMzdFRUUyOTVDQTUwQ0I1QUUzMkU2N0M5M0VGMTQzMEZCMTc3ODJCQUVBNzhDRTEwMzNCMzYyMDBDQTgxODlEQTQxNDZFMEU4Q0ExQTMwMkQxOUQ3Nzk3NkE4Q0Y0MDM1QUUyMzI3MUQ0Mjg2REE2NDY0NENCN0UxRDMxNDA1Q0RDMzY5Nzk1MDIwRkIyRjYxNTZFQjUwMjY1ODczNDQ5QTcyNzExNzc5Nzc5RDgxMkU1NTE2NTI3N0Q0NzlBMjdCNTZBQTU2ODY5OEM0MjcxNjZGNDBGQTkxQ0E4MTJBN0JERTFDMTlCQUJERjJCNzM1RUYyQzBDNTNDMzZCODFBNEJENjNFNzg4OEU4MTg5Q0RCNjA4RUQxQkU2NkVDQkZCN0ZCNzFFMTIxMTFBOUUxNjU1QzNENzBGMUE5NDc5QzVBQzc1NzA3OTk2MTMwMTA1QTdDMzhGMjVBRjAwQzIwQTQyM0U2MTRGMzc1N0U1RjFCNzhDNzcxMURGRjg4RTVDQzZEQUQ5MUE0QjgyMTIxQzVCQjUyQkREEoAEQzJDRjlDRDkyNTQxM0ZCM0U5QjVBNzUzNjc0RjUwNjk4RUIwQTI2MUJGMTU3OUYyOUJBN0MyNjhEMTc4M0Q3MTI4QThCMjZDMjcxRjI4NUNGNjUxRDZBMTUzQkQ3NzUyQkVGRUU3N0UzN0VFRTI5NUNBNTBDQjVBRTMyRTY3QzkzRUYxNDMwRkIxNzc4MkJBRUE3OENFMTAzM0IzNjIwMENBODE4OURBNDE0NkUwRThDQTFBMzAyRDE5RDc3OTc2QThDRjQwMzVBRTIzMjcxRDQyODZEQTY0NjQ0Q0I3RTFEMzE0MDVDREMzNjk3OTUwMjBGQjJGNjE1NkVCNTAyNjU4NzM0NDlBNzI3MTE3Nzk3NzlEODEyRTU1MTY1Mjc3RDQ3OUEyN0I1NkFBNTY4Njk4QzQyNzE2NkY0MEZBOTFDQTgxMkE3QkRFMUMxOUJBQkRGMkI3MzVFRjJDMEM1M0MzNkI4MUE0QkQ2M0U3ODg4RTgxODlDREI2MDhFRDFCRTY2RUNCRkI3RkI3MUUxMjExMUE5RTE2NTVDM0Q3MEYxQTk0NzlDNUFDNzU3MDc5OTYxMzAxMDVBN0MzOEYyNUFGMDBDMjBBNDIzRTYxNEYzNzU3RTVGMUI3OEM3NzExREZGODhFNUNDNkRBRDkxQTRCODIxMjFDNUJCNTJCREVKiwEKQDAyMjYyOERBRTQwMTNDQTAzOEI4MkIzN0U4QzdENDMzQUJDNDIyOUYyNjJBMUI2NkI0RDRGNkVGN0RENkNDRUQSQDA1QTdFRkZCQjZCMjY3NDg0RTU2RDI3MjU2RUNCRDYzQTdBRkQ4MUJBRTEyNzg2REJGM0YwN0Q4NDA4RkY3QzQaBXN0YXJrUoAEQjhFNEQ0MDk5OUUwNDVENDZENzk5NTU2M0Y4QTlBMEE5RkQ0NEE0MjNEODE2MkQ4NkU3ODJGODRERTVDNEY4RUE3MUJEMjYzMjVBNTQyMDc2MTY1ODNFQ0E5MUMyRTVFM0E0RTM0MDRBNUIyOEEzRkVCMjM0QTMxRDEyRjE0NzJBMjdFMERGMjlCNEI0MzE1MUVEOUI3Q0FGMDQ5MEM1MUNFRkY2M0VBRDlGQzExM0E2QURDMEJDMDBFMTlCQjdCMjM4QTg0ODMxNTk0RjI5ODZCMEJEQzkwQjE2QzYxNjYwNjA5RTg4ODgzODFFMjIzOUVGRjAwNjFEQzg5QTZGMjI0NEJERjlEQTY1NTU4RDgwMDcyNDI5NTc1QzFGNjhBQUY0OEU3MzhENjgwQzQzNzg1NDFDMjYyMUQ1REE3OTNGRUQxOUUzRjE3QjAyRkFEODc5MTZBOUQ0MkNCRTFEQjQ1MDI1Q0RFRUZCMkEzQzJGQTk1MzQ5NzUwNkJFNjQ4QjMyNTY4MTNDRTk5QTVGRTZBNjU3M0FDMzhBREMyNEQzN0U5OUUxQTA5OEQxMkQzODg5RDk0MzRCQkRCM0IzMDA1ODQyNzZFMEIyMkUwRDI1NTdERjlGMzhCNUNENkNDQzFFRkRGMEU4QzUxQ0Q5QjdDOTlCQkJGOTY5M0VDRTFqgAQ4QjFGMTI2OUM1OTEwOUUyQzlBNkYxMDFFNThCQjcwRkJEMEM5N0MxMkI1OTVCRTA2RUFFMEQ1MERGNTlFQ0Y0MUNGMUZGOTBFODVFMUY3QzFFOERGMEY5NDcxODBBRkQzRDk3RDIwNDBCMUNEMjZFNDYzMEUzQ0FCNTk1QTNFMzlEQjFCQzY3Qzg0OEJENUREMkEzMDU5RUM1RTA2QjUwQkJDQUNCRjM2MUM3RTA2MTFBRDcwNzEyOTcxMDYwNDVDMDYxQUQzNTIzQ0I1Qzc1OEU0RTI3NzY4RDFERTc5OEEwMUYzOTVEOUE1RDcwQTdFOUExNzFGRURFNTlGNDBBMDFCRUEzQTAyNTc1MERFQTBCREVGRTg5OUI4NTNBNTkxRjVFNDk4OEUyOTA1NTI2MzlBOUY5RTAwM0E0MDIwQjY5Nzc0MkRFNTI5MDBGQjIzMDc4QzVGMUI0QjY0NUUzMjVCQjkwRTZBQzE0MENENjEwNDg2NEU4MTkyOTA1QjAzNDc0QTI1QjdDOTk0NDk4RTE1OUQwNDU1NTczQkMyOTFFMDhCREYxMkExQjNEQzAyQTE3QjUwNDk3OTc3RkJEM0E3RDFEQkM2RkY3Q0EzQkU2Qzk2RERDM0M0MTM1MENDMTRCODkwMDA3RkE4NDk0QkRBQTk1QjhBQkRFMTA4N3KABDdDQzU1OEVCMzRBRTM5NUJBNDJGRjc5NUM5RTJCOTQ1MzU3Njg4NzE0MzU4RkVFNEM1QzBEOUJGNDRGNkFFQTY1QThDQkUxQkJGMkRBQUM4MzAzMTM4MUFCQzQzNkUwMzVGN0I3MTRFQjk5NjREMzJENTRBMzM5NjAyNjFDQTFFRUYyQ0YwMDg2RURDMTZEQTlFM0YxQ0JDNDNENEUwQTI2MTEzMDhGNkY0QzEzNzI0MzBCNkEzM0Q4M0U0OUQ4RjFCQTQxNjJEQkEzNEIwRTU3QjMzNURDNjcwNDg0MkI1NTg2MTcwNTc1MTYzNTdDOUJGNDhDMjA1Mjk0QTIyOTBFMUM0OUYzNDY2QjVBQjU4NzkxNzNEMDU3RDkxRTIxOTY5MjM5MDNEQjc2MzQ0RkIzQUQ2NEFBMEI5QTM4MEM2NUU2MDU3RjYzQjRBOEJFMDc0NTI5RTYyRUJENEJDNEQwNjYxNTY1Q0FCQjBGMjU0OUNBRUE1MzQwQUNENkJGRTNFNzU2RjY0OEIyNDA0NUVERTg5QkQ1NUIwMkJEMURGMTdFQUNEQjE3OUZENTlFQzU5NEVCNTY0NUM0RUU3QzlEMjI5RjI1NEI0N0U5Njg2NDJGNDQwNjhCMERDOTg5MDIzNzUyRDJGRTJDQjY5NEU3MDRCQjgyNEQ3Mzk3RjUwMrAVCgpjb19zaWduZXIyGgIwMjqGCAqABEQ5OTdGQzlDMTYzMUVFNzExRjBBMTBFOUQxMDMyREVDRkRGMjhBN0MwM0IxRDAwOUYzQzUxRUFBNUU0OTk1N0E4MjhBMDgwQjI5QjMyRkZFQTdGNkRCQkI4QURGMkFFMjIyQTM4NjcxRUZGOTM0RTg3RTM2ODlBODkwNEIyMTEyRUM2QURBNDAyM0IyNEVBM0VGODZGRUIyMDE4QUQwMEJBQkYyQUYyQjc5RUM3RDI5QTMzNTQ2ODA3NTk0REZFODJFQzZGOUVDMzc5NjRFOEYwRDI3ODhGRUZBNDc2N0JDODgyNUVDQTQxNEE4RTYwMzFEREQyQkFGQkE1OTA4N0NDQTEyMjQ4Mzc5OUJGOTlCRjY0MkFERjU1MkVFQURFMzBFNjc2RkIwODdFRThDN0I3NjU4NEZGNDA4RDAzMzdDMTY4RDIzODFGMDhCODNDMThFRkNCNzAzRjA4QkZCRjlFNkU5M0JBMkJBMDhFMzI0NTI0ODY0MzU1MTA4NjU5MENGQUI3N0Q0Q0ExMENDNUVDMkE4QTVDQ0Q1RjIxQzQxMzgyNzk0RjAyMEE1ODhFRkFDMDIxMzU1NkNDNUZFRjIzNzc4REJBN0M1QkQxNEI4OTcwOTU4NDFDMjUyMzY1Qjk5MDRBNzkyNTFCQTE5QUUzNDdFNUEwRTkwNzlBQjYxEoAERDk5N0ZDOUMxNjMxRUU3MTFGMEExMEU5RDEwMzJERUNGREYyOEE3QzAzQjFEMDA5RjNDNTFFQUE1RTQ5OTU3QTgyOEEwODBCMjlCMzJGRkVBN0Y2REJCQjhBREYyQUUyMjJBMzg2NzFFRkY5MzRFODdFMzY4OUE4OTA0QjIxMTJFQzZBREE0MDIzQjI0RUEzRUY4NkZFQjIwMThBRDAwQkFCRjJBRjJCNzlFQzdEMjlBMzM1NDY4MDc1OTRERkU4MkVDNkY5RUMzNzk2NEU4RjBEMjc4OEZFRkE0NzY3QkM4ODI1RUNBNDE0QThFNjAzMURERDJCQUZCQTU5MDg3Q0NBMTIyNDgzNzk5QkY5OUJGNjQyQURGNTUyRUVBREUzMEU2NzZGQjA4N0VFOEM3Qjc2NTg0RkY0MDhEMDMzN0MxNjhEMjM4MUYwOEI4M0MxOEVGQ0I3MDNGMDhCRkJGOUU2RTkzQkEyQkEwOEUzMjQ1MjQ4NjQzNTUxMDg2NTkwQ0ZBQjc3RDRDQTEwQ0M1RUMyQThBNUNDRDVGMjFDNDEzODI3OTRGMDIwQTU4OEVGQUMwMjEzNTU2Q0M1RkVGMjM3NzhEQkE3QzVCRDE0Qjg5NzA5NTg0MUMyNTIzNjVCOTkwNEE3OTI1MUJBMTlBRTM0N0U1QTBFOTA3OUFCNjJKiwEKQDAzRTdFNkJDQzQxNDIwNEIzQkU4MEUzNzdFMTQxMzNGMDhFNkE2OTI0NTlBRkMxQzJBRDgzQjI2NDgzM0RGMjYSQDA1MzE3MkU3Qjg3REVDMzA4OEUyMUM5Mzc5MEREQjU2NzdENDhGRDk2NkEyQjc3M0Q3NDMwRjJBMTAzNEU0MjcaBXN0YXJrUoAERTdBQUM2OTE0OTU0OUJENURERUQ1OEREQ0MwNkZBMEYzRDlDNDY2RTlGMjlDOUFGMTEwODI2MTg5QTI1MURDMzQwMjcxOEFCMjU2NEFDNjUxNUNDN0Q2NzYwMDlFRTM0RDY5Nzk4ODVEQzA4QzYxODNDRDBENjVBOTUwNjQ4NEQ2RTkxQzgzNDM5QTY0QzU2QkNDM0JDM0IyNTU5N0VBRDhEOTQ3RTRBNjdGRkM4QkYyOUYzMURBNDJDQjRBOTNGMEM4ODA0M0Q3MjRBMzg2NTk0Q0YxOTNEMEQwQjYyODJERkQ2NUU2MkJEQzQ2REU4MDIxNDFDRDk0Q0I5MTNERUFDOEIzREQxMjgxMjJDNUQzMDQwMDE0MDU2QUNEQjI0RUM3MUUxRjYzM0RGQzYzQzNEMjE5NkZBODdCNEY4RDQxQjM5QkU1NjlBNzVEMDUzM0FERUREMjE1RjdENkZBNDFFRDk2NTI1OTBCOEYzRUUyOUI3MkQ1NDlDMjcwNzg2NTAwMTBDNzU2NzgxNjU3ODUwRTE5M0Y4MTI0MDI3NUNDNzI4MjRFMkQzRDZCNTVGMDNCQzI1NDZCNTU5NjVDOTI5REVFMjMwOUFGN0YyMkY5MEFFNTk1ODREM0VDRTk0NEE2RkVEMzgzQTIyOERBM0MxOUE3NkE5MjU5QzQwNTlqgAQ2MkE2RDNFNEM0RDU4NjhERDM3RTg5QTk5NDgxNzQ1QTU4QTBENkRBRDQxOEVCQzQzMjVDRkRENzA2QTA2QTRGRkFEMUE4MzIxNzM5MjIyQjAyN0MzRTM3MUI5NjkxMkE1RDREMzNGRjZERTg4QzVFMTY3NUJDRDQxN0QyMDRBMzJDNjU1MEI2RjhFRkFBNkEwREE0OTUyRkZCQjY2RTIyNUIyQkMzRThCMEFGQzgxNjZGNkIzMURGMTM4RjNFQzlFNDdDNTlFRTZBRDdGNDcwRkUwMDY2QzIwQjM4OTBFMDVFMjE2MUIzNkI5RjBCMDczQ0UyQzc0QUJGN0IyNUE1RTVDRDg0NDI1OTUyRTcxOTM1RTkxQTAzOEZDMTQ0MjQxNkU3QjU0REFBOEUwRDQ4QkQxMTlGMjlEMTE2QTIxQUMwNEQ3MDRGOTA0MTUwQzNBMEE3MDIzODJEMzk0NjVEMTQ5NTNENUMyQkU3OTg4RUE0OUMyNEMyMjBFNDgyOUNDREI0REY1QUNGRjg3MTVENkUzMjgzRDRCN0NGMDQzNkRFODc5M0U5Qzk2MUM5MTJBOUNGMEQ2MUM4ODA3NUExNzQ1NTE2RUVBRjkyRTQ4RkQ4MjRBMzNFNzAyNDBDMThFNDRDNzc4RjI5MzRGQTZERTc5NzNCQzM3QjdCQTJCRXKABDdERkI0MjQzNDU4OTVBOTcwNjRDRDM1MTA2Q0U5NzIwMDQyQUMwM0I0RDFEQTg4Q0VBRERGNjZDRjZERTIwNDc4M0EyQ0Y2QjVFMzc0M0FEMzA1MjVBMzZFRDE0QTQ3RjY3N0VCNjE4NUREMTBFRjY4ODA2RkY4NjVBMjU2RTJGMEIwMzRFOUExOTc5MUFDRjYzNDE5NjlCNkRBQkIyODczRkE1NDg3MTM5NDYyNzBDMDQ1RUI3REZGNDRENEFFNTRCNDM5RUYwREQyNjZFRDc2RDhFQjNGQ0ZGRUY4M0M2OEE2MjIyNzMwNDA0QzA3NUE0NjI3M0UyNDNDQjEzRjM5RDAwQjY2MEI0OEYwNjNBMDcyNEY1Q0Q3MjYxQTFBMUVEMDVDNjc1MzcxMDA0QzU4OUZEODM5REE2MjUxRDFEQzkwNUU2RjJGRTk0NDUwNTkwNjNCMDRDQUE4MUI2RUVFRkEzNUU1QTEwQjZEMTkxNjQ4QUJCNkY4N0E0RTFEQzNEMzFBNzBCOEM4MjNDQkM1RDEwRkUzRjQ4QUE4OThBNzY1MjE2N0FFMEFFNzA2QjNBOTgwQUE3MjgyQTkzM0VFODIzRkE1MUU1OEFERDQxRkQ0NjNDQTM5MjJENEVCRUZFMDE5NjZBNjI1NURBRDc5N0QwRTE0Qzg3M0RDNDAwOosBCkAwMkNGM0JGRjg3OUEzRDRDMUNGNDExQzA2M0VGQzk2REE3RTdEMERBMERBRDIyMUVBRUVDN0E0MTVDMkUzRTI3EkAwMTZCMDFCQkIxMENDMDY5N0VDNUYwMjBDRURCODU3RDcyOTI3MjBCRDdCNDk0MDYyMkIzQzY5OTQxMUQyOTMwGgVzdGFyaw..";
-    //Initialize the message queue
+    std::vector<std::string> stark_participants = {"co_signer1", "co_signer2"};
+    EXPECT_TRUE(sign_all(stark_sign_key_base64_arr, stark_participants, m, SignOptions()));
+#endif
+}
+
+TEST(Li24, sign_counter_prg) {
+    BN m = BN("1234567812345678123456781234567812345678123456781234567812345678", 16);
+    printf("Test Li24 sign with secp256k1 curve and counter-mode PRG\n");
+    std::string counter_sign_key_base64_arr[N_PARTIES];
     for (int i = 0; i < N_PARTIES; ++i) {
-        map_id_message_queue[party_ids[i]] = PartyMessageQue<Msg>(ROUNDS);
+        ASSERT_TRUE(set_prg_type(counter_sign_key_base64_arr[i], secp256k1_sign_key_base64_arr[i], PRGType::Counter));
     }
-    for (size_t i = 0; i < participants.size(); ++i) {
-        res[i] = std::async(std::launch::async, sign, sign_key_base64_arr[i], participants, m);
+    EXPECT_TRUE(check_prg_cursor_resume(secp256k1_sign_key_base64_arr[0]));
+    EXPECT_TRUE(check_prg_cursor_resume(counter_sign_key_base64_arr[0]));
+    EXPECT_TRUE(check_sign_resume(secp256k1_sign_key_base64_arr, participants, m));
+    EXPECT_TRUE(check_sign_resume(counter_sign_key_base64_arr, participants, m));
+    EXPECT_TRUE(sign_all(counter_sign_key_base64_arr, participants, m, SignOptions()));
+}
+
+TEST(Li24, sign_executor) {
+    BN m = BN("1234567812345678123456781234567812345678123456781234567812345678", 16);
+    printf("Test Li24 sign with secp256k1 curve and executor\n");
+    safeheron::mpc_flow::mpc_parallel_v2::ThreadPoolExecutor thread_pool(4);
+    SignOptions options;
+    options.executor_ = &thread_pool;
+    EXPECT_TRUE(sign_all(secp256k1_sign_key_base64_arr, participants, m, options));
+    //A second message of a sender is rejected
+    EXPECT_TRUE(check_duplicate_rejected(secp256k1_sign_key_base64_arr, participants, m, &thread_pool));
+}
+
+TEST(Li24, parallel_for_in_pool_task) {
+    //A task of a single worker pool runs a loop on the same pool, its helper tasks only start after it returns
+    safeheron::mpc_flow::mpc_parallel_v2::ThreadPoolExecutor thread_pool(1);
+    std::vector<size_t> slot_arr(16, 0);
+    std::promise<void> done;
+    thread_pool.Execute([&]() {
+        safeheron::mpc_flow::mpc_parallel_v2::ParallelFor(&thread_pool, slot_arr.size(), [&](size_t i) {
+            slot_arr[i] = i + 1;
+        });
+        done.set_value();
+    });
+    std::future<void> done_future = done.get_future();
+    ASSERT_EQ(done_future.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+    for (size_t i = 0; i < slot_arr.size(); ++i) {
+        EXPECT_EQ(slot_arr[i], i + 1);
     }
+}
+
+TEST(Li24, sign_instrumentation) {
+    BN m = BN("1234567812345678123456781234567812345678123456781234567812345678", 16);
+    printf("Test Li24 sign with secp256k1 curve and instrumentation\n");
+    safeheron::mpc_flow::mpc_parallel_v2::ThreadPoolExecutor thread_pool(4);
+    safeheron::mpc_flow::mpc_parallel_v2::MetricsSink metrics_sink("Li24.sign");
+    SignOptions options;
+    options.executor_ = &thread_pool;
+    options.instrumentation_sink_ = &metrics_sink;
+    EXPECT_TRUE(sign_all(secp256k1_sign_key_base64_arr, participants, m, options));
+
+    using safeheron::mpc_flow::mpc_parallel_v2::Stage;
+    uint64_t count = 0;
+    std::chrono::nanoseconds total(0);
+    size_t n_messages = participants.size() * (participants.size() - 1);
+    for (int round = 0; round < ROUNDS; ++round) {
+        metrics_sink.GetStage(round, Stage::ComputeVerify, count, total);
+        EXPECT_EQ(count, participants.size());
+        EXPECT_GT(total.count(), 0);
+        metrics_sink.GetStage(round, Stage::MakeMessage, count, total);
+        EXPECT_EQ(count, participants.size());
+        if (round == 0) continue;
+        metrics_sink.GetStage(round, Stage::ParseMsg, count, total);
+        EXPECT_EQ(count, n_messages);
+        metrics_sink.GetStage(round, Stage::ReceiveVerify, count, total);
+        EXPECT_EQ(count, n_messages);
+    }
+    // A message received in round r + 1 was sent in round r
+    for (int round = 0; round < ROUNDS - 1; ++round) {
+        EXPECT_GT(metrics_sink.GetBytes(round, false), 0u);
+        EXPECT_EQ(metrics_sink.GetBytes(round, true), metrics_sink.GetBytes(round, false));
+    }
+    metrics_sink.GetStage(0, Stage::Serialization, count, total);
+    EXPECT_GT(count, 0u);
+    metrics_sink.GetStage(1, Stage::Serialization, count, total);
+    EXPECT_GT(count, 0u);
+    std::string text = metrics_sink.ToPrometheusText();
+    EXPECT_NE(text.find("mpc_stage_duration_seconds_bucket{protocol=\"Li24.sign\",round=\"1\",stage=\"parse_msg\",peer=\"co_signer2\",le=\"+Inf\"} 3"), std::string::npos);
+    EXPECT_NE(text.find("mpc_message_bytes_total{protocol=\"Li24.sign\",round=\"0\",peer=\"co_signer1\",direction=\"in\"}"), std::string::npos);
+}
+
+TEST(Li24, sign_binary_messages) {
+    BN m = BN("1234567812345678123456781234567812345678123456781234567812345678", 16);
+    printf("Test Li24 sign with secp256k1 curve and binary messages\n");
+    SignOptions options;
+    options.message_encoding_ = safeheron::mpc_flow::mpc_parallel_v2::MessageEncoding::Binary;
+    EXPECT_TRUE(sign_all(secp256k1_sign_key_base64_arr, participants, m, options));
+}
+
+TEST(Li24, sign_bytes_wire_encoding) {
+    BN m = BN("1234567812345678123456781234567812345678123456781234567812345678", 16);
+    printf("Test Li24 sign with secp256k1 curve and bytes wire encoding\n");
+    using safeheron::multi_party_ecdsa::Li24::WireVersion;
+    std::string bytes_sign_key_base64_arr[N_PARTIES];
+    for (int i = 0; i < N_PARTIES; ++i) {
+        std::string hex_sign_key_base64, back_sign_key_base64;
+        ASSERT_TRUE(safeheron::multi_party_ecdsa::Li24::convert_sign_key(hex_sign_key_base64, secp256k1_sign_key_base64_arr[i], WireVersion::Hex));
+        ASSERT_TRUE(safeheron::multi_party_ecdsa::Li24::convert_sign_key(bytes_sign_key_base64_arr[i], secp256k1_sign_key_base64_arr[i], WireVersion::Bytes));
+        ASSERT_TRUE(safeheron::multi_party_ecdsa::Li24::convert_sign_key(back_sign_key_base64, bytes_sign_key_base64_arr[i], WireVersion::Hex));
+        EXPECT_EQ(back_sign_key_base64, hex_sign_key_base64);
+        EXPECT_LT(bytes_sign_key_base64_arr[i].size(), hex_sign_key_base64.size());
+        if (i == 0) {
+            printf("sign key: %zu bytes in hex, %zu bytes in bytes\n", hex_sign_key_base64.size(), bytes_sign_key_base64_arr[i].size());
+        }
+    }
+    EXPECT_TRUE(check_prg_cursor_resume(bytes_sign_key_base64_arr[0]));
+
+    uint64_t hex_bytes = 0, bytes_bytes = 0;
+    EXPECT_TRUE(sign_and_count_bytes(secp256k1_sign_key_base64_arr, participants, m, hex_bytes));
+    EXPECT_TRUE(sign_and_count_bytes(bytes_sign_key_base64_arr, participants, m, bytes_bytes));
+    printf("messages: %llu bytes in hex, %llu bytes in bytes\n", (unsigned long long)hex_bytes, (unsigned long long)bytes_bytes);
+    EXPECT_LT(bytes_bytes, hex_bytes);
+
+    // An empty payload stands for zeros only from a sender of a bytes key whose window leaves the receiver out
+    size_t sparse_count = 0;
+    EXPECT_TRUE(check_empty_p2p_rejected(secp256k1_sign_key_base64_arr, participants, m, sparse_count));
+    EXPECT_EQ(sparse_count, 0u);
+    EXPECT_TRUE(check_empty_p2p_rejected(bytes_sign_key_base64_arr, participants, m, sparse_count));
+    EXPECT_GT(sparse_count, 0u);
+
+    // The curve points keep their own encoding, the scalars alone take about half the space
+    safeheron::multi_party_ecdsa::Li24::sign::Round0P2PMessage p2p_message;
+    p2p_message.k_ = m;
+    p2p_message.w_ = m + 1;
+    p2p_message.phi_ = m + 2;
+    std::string hex_b64, bytes_b64;
+    ASSERT_TRUE(p2p_message.ToBase64(hex_b64));
+    p2p_message.wire_version_ = WireVersion::Bytes;
+    ASSERT_TRUE(p2p_message.ToBase64(bytes_b64));
+    EXPECT_LT(bytes_b64.size() * 10, hex_b64.size() * 6);
+    safeheron::multi_party_ecdsa::Li24::sign::Round0P2PMessage parsed_message;
+    ASSERT_TRUE(parsed_message.FromBase64(bytes_b64));
+    EXPECT_TRUE(parsed_message.k_ == p2p_message.k_ && parsed_message.w_ == p2p_message.w_ && parsed_message.phi_ == p2p_message.phi_);
+    ASSERT_TRUE(parsed_message.FromBase64(hex_b64));
+    EXPECT_TRUE(parsed_message.k_ == p2p_message.k_ && parsed_message.w_ == p2p_message.w_ && parsed_message.phi_ == p2p_message.phi_);
+}
+
+TEST(Li24, sign_local_transport) {
+    BN m = BN("1234567812345678123456781234567812345678123456781234567812345678", 16);
+    printf("Test Li24 sign with secp256k1 curve and local transport\n");
+    safeheron::mpc_flow::mpc_parallel_v2::LocalTransport transport(participants, 64);
+    SignOptions options;
+    options.local_transport_ = &transport;
+    EXPECT_TRUE(sign_all(secp256k1_sign_key_base64_arr, participants, m, options));
+}
+
+TEST(Li24, sign_out_of_order) {
+    BN m = BN("1234567812345678123456781234567812345678123456781234567812345678", 16);
+    printf("Test Li24 sign with secp256k1 curve and out-of-order messages\n");
+    EXPECT_TRUE(sign_out_of_order(secp256k1_sign_key_base64_arr, participants, m));
+    EXPECT_TRUE(check_parking_limited(secp256k1_sign_key_base64_arr, participants, m, party_ids[N_PARTIES - 1]));
+}
+
+TEST(Li24, sign_key_handle) {
+    BN m = BN("1234567812345678123456781234567812345678123456781234567812345678", 16);
+    printf("Test Li24 sign with secp256k1 curve and sign key handles\n");
+    EXPECT_TRUE(safeheron::multi_party_ecdsa::Li24::SignKeyHandle::FromBase64("invalid") == nullptr);
+    std::vector<std::shared_ptr<const safeheron::multi_party_ecdsa::Li24::SignKeyHandle>> key_handle_arr;
+    for (int i = 0; i < N_PARTIES; ++i) {
+        key_handle_arr.push_back(safeheron::multi_party_ecdsa::Li24::SignKeyHandle::FromBase64(secp256k1_sign_key_base64_arr[i]));
+        ASSERT_TRUE(key_handle_arr[i] != nullptr);
+    }
+    {
+        //The local party must be one of the participants
+        safeheron::multi_party_ecdsa::Li24::SignKey trimmed_sign_key;
+        EXPECT_FALSE(key_handle_arr[N_PARTIES - 1]->Trim(trimmed_sign_key, participants));
+        //The quorum of a set of signers is computed once. A handle of its own, the signing handles stay in step.
+        auto handle = safeheron::multi_party_ecdsa::Li24::SignKeyHandle::FromBase64(secp256k1_sign_key_base64_arr[0]);
+        ASSERT_TRUE(handle->Trim(trimmed_sign_key, participants));
+        auto quorum = handle->GetQuorum(trimmed_sign_key);
+        ASSERT_TRUE(quorum != nullptr);
+        EXPECT_TRUE(quorum == handle->GetQuorum(trimmed_sign_key));
+        EXPECT_EQ(quorum->l_arr_.size(), participants.size());
+        //Every context gets fresh PRG outputs
+        safeheron::multi_party_ecdsa::Li24::SignKey next_trimmed_sign_key;
+        ASSERT_TRUE(handle->Trim(next_trimmed_sign_key, participants));
+        for (size_t i = 0; i < trimmed_sign_key.remote_parties_.size(); ++i) {
+            EXPECT_EQ(trimmed_sign_key.remote_parties_[i].prg.position(), 0u);
+            EXPECT_EQ(next_trimmed_sign_key.remote_parties_[i].prg.position(), PRG_OUTPUTS_PER_SIGN);
+        }
+        //Contexts created side by side still get the reserved outputs, each one exactly once
+        const int n_threads = 4;
+        const int n_trims = 8;
+        std::string remote_party_id = trimmed_sign_key.remote_parties_[0].party_id_;
+        std::vector<std::future<std::vector<BN>>> res;
+        for (int t = 0; t < n_threads; ++t) {
+            res.push_back(std::async(std::launch::async, [&]() {
+                std::vector<BN> out_arr;
+                for (int j = 0; j < n_trims; ++j) {
+                    safeheron::multi_party_ecdsa::Li24::SignKey racing_sign_key;
+                    if (!handle->Trim(racing_sign_key, participants)) break;
+                    int pos = racing_sign_key.get_remote_party_pos(remote_party_id);
+                    out_arr.push_back(racing_sign_key.remote_parties_[pos].prg.rand());
+                }
+                return out_arr;
+            }));
+        }
+        std::vector<BN> racing_out_arr;
+        for (auto &r : res) {
+            std::vector<BN> out_arr = r.get();
+            racing_out_arr.insert(racing_out_arr.end(), out_arr.begin(), out_arr.end());
+        }
+        PRG prg = handle->sign_key().remote_parties_[handle->sign_key().get_remote_party_pos(remote_party_id)].prg;
+        std::vector<BN> expected_out_arr;
+        for (int k = 2; k < 2 + n_threads * n_trims; ++k) {
+            prg.seek(k * PRG_OUTPUTS_PER_SIGN);
+            expected_out_arr.push_back(prg.rand());
+        }
+        std::sort(racing_out_arr.begin(), racing_out_arr.end());
+        std::sort(expected_out_arr.begin(), expected_out_arr.end());
+        EXPECT_TRUE(racing_out_arr == expected_out_arr);
+    }
+    //Each key is parsed once and signs twice
+    for (int turn = 0; turn < 2; ++turn) {
+        EXPECT_TRUE(sign_all(secp256k1_sign_key_base64_arr, participants, m, SignOptions(), key_handle_arr));
+    }
+    //The two signatures took consecutive PRG outputs of the signing pairs, the key to save carries them
     for (size_t i = 0; i < participants.size(); ++i) {
-        EXPECT_TRUE(res[i].get());
+        safeheron::multi_party_ecdsa::Li24::SignKey current_sign_key;
+        key_handle_arr[i]->CurrentSignKey(current_sign_key);
+        for (const auto &remote_party : current_sign_key.remote_parties_) {
+            bool signer = std::find(participants.begin(), participants.end(), remote_party.party_id_) != participants.end();
+            EXPECT_EQ(remote_party.prg.position(), signer ? 2 * PRG_OUTPUTS_PER_SIGN : 0);
+        }
     }
-#endif
 }
 
 int main(int argc, char **argv) {
@@ -1,3 +1,4 @@
+#include <memory>
 #include <thread>
 #include <future>
 #include <vector>
@@ -19,6 +20,8 @@ using safeheron::curve::CurvePoint;
 using safeheron::curve::CurveType;
 using safeheron::multi_party_ecdsa::cmp::sign::Context;
 using safeheron::mpc_flow::mpc_parallel_v2::ErrorInfo;
+using safeheron::multi_party_ecdsa::cmp::SignKey;
+using safeheron::multi_party_ecdsa::cmp::PailPrecompute;
 
 void print_context_stack_if_failed(Context *ctx) {
     std::string err_info;
@@ -44,6 +47,8 @@ void print_signature(Context *ctx) {
 }
 
 std::map<std::string, PartyMessageQue<Msg>> map_id_message_queue;
+// Paillier precomputation shared by the signatures of each party, if any
+std::map<std::string, std::shared_ptr<PailPrecompute>> map_id_pail_precompute;
 
 #define ROUNDS 5
 #define N_PARTIES 3
@@ -57,7 +62,15 @@ bool sign(std::string sign_key_base64, std::vector<std::string> participants, BN
 
     //create context (define in cmp/sign/context.h)
     Context ctx(participants.size());
-    ok = Context::CreateContext(ctx, t_sign_key_base64, m, ssid);
+    SignKey sign_key;
+    ok = sign_key.FromBase64(sign_key_base64);
+    if (!ok) return false;
+    auto iter = map_id_pail_precompute.find(sign_key.local_party_.party_id_);
+    if (iter != map_id_pail_precompute.end()) {
+        ok = Context::CreateContext(ctx, t_sign_key_base64, m, ssid, iter->second);
+    } else {
+        ok = Context::CreateContext(ctx, t_sign_key_base64, m, ssid);
+    }
     if (!ok) return false;
 
     std::string status = "<== Context of " + ctx.sign_key_.local_party_.party_id_ + " was created\n";
@@ -169,6 +182,28 @@ TEST(cmp, sign_t_n_mt) {
         EXPECT_TRUE(res[i].get());
     }
 
+    //SECP256K1 sample with the Paillier precomputation shared by two signatures
+    printf("Test cmp sign with secp256k1 curve and Paillier precomputation\n");
+    for (size_t i = 0; i < participants.size(); ++i) {
+        SignKey sign_key;
+        EXPECT_TRUE(sign_key.FromBase64(sign_key_base64_arr_1[i]));
+        std::shared_ptr<PailPrecompute> pail_precompute = std::make_shared<PailPrecompute>(sign_key);
+        pail_precompute->StartBackgroundFill(8);
+        map_id_pail_precompute[sign_key.local_party_.party_id_] = pail_precompute;
+    }
+    for (int turn = 0; turn < 2; ++turn) {
+        for (int i = 0; i < N_PARTIES; ++i) {
+            map_id_message_queue[party_ids[i]] = PartyMessageQue<Msg>(ROUNDS);
+        }
+        for (size_t i = 0; i < participants.size(); ++i) {
+            res[i] = std::async(std::launch::async, sign, sign_key_base64_arr_1[i], participants, m, ssid);
+        }
+        for (size_t i = 0; i < participants.size(); ++i) {
+            EXPECT_TRUE(res[i].get());
+        }
+    }
+    map_id_pail_precompute.clear();
+
 #ifdef TEST_STARK_CURVE
     //STARK sample
     printf("Test cmp sign with stark curve\n");
@@ -0,0 +1,93 @@
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <google/protobuf/stubs/common.h>
+#include "gtest/gtest.h"
+#include "crypto-suites/crypto-bn/bn.h"
+#include "multi-party-sig/multi-party-ecdsa/common/key_material_pool.h"
+
+using safeheron::bignum::BN;
+using safeheron::multi_party_ecdsa::common::KeyMaterialPool;
+using safeheron::multi_party_ecdsa::common::NTildeMaterial;
+using safeheron::multi_party_ecdsa::common::PailMaterial;
+
+static const char *POOL_FILE = "key_material_pool_test.bin";
+
+void wait_until_full(const KeyMaterialPool &pool) {
+    while (pool.n_tilde_count() < pool.capacity() || pool.pail_count() < pool.capacity()) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    }
+}
+
+TEST(KeyMaterialPool, FillAndTake) {
+    KeyMaterialPool pool(2, 1);
+    NTildeMaterial n_tilde;
+    PailMaterial pail;
+    EXPECT_FALSE(pool.TakeNTilde(n_tilde));
+    EXPECT_FALSE(pool.TakePail(pail));
+
+    pool.Start();
+    wait_until_full(pool);
+
+    EXPECT_TRUE(pool.TakeNTilde(n_tilde));
+    EXPECT_TRUE(n_tilde.N_tilde_ == (n_tilde.p_ * 2 + 1) * (n_tilde.q_ * 2 + 1));
+    EXPECT_TRUE(pool.TakePail(pail));
+    BN m(123456789);
+    EXPECT_TRUE(pail.pail_priv_.Decrypt(pail.pail_pub_.Encrypt(m)) == m);
+
+    // Still above the low-water mark: nothing is refilled
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    EXPECT_EQ(pool.n_tilde_count(), 1u);
+
+    // Below it: refilled up to the capacity
+    NTildeMaterial n_tilde2;
+    EXPECT_TRUE(pool.TakeNTilde(n_tilde2));
+    EXPECT_TRUE(n_tilde2.N_tilde_ != n_tilde.N_tilde_);
+    wait_until_full(pool);
+    pool.Stop();
+}
+
+TEST(KeyMaterialPool, SaveAndLoad) {
+    KeyMaterialPool pool(1, 1);
+    pool.Start();
+    wait_until_full(pool);
+    pool.Stop();
+
+    // A failed save keeps the items in the pool
+    EXPECT_FALSE(pool.SaveToFile("no_such_dir/key_material_pool_test.bin", "passphrase"));
+    EXPECT_EQ(pool.n_tilde_count(), 1u);
+    EXPECT_EQ(pool.pail_count(), 1u);
+
+    // The items move to the file: the pool cannot hand them out any more
+    ASSERT_TRUE(pool.SaveToFile(POOL_FILE, "passphrase"));
+    EXPECT_EQ(pool.n_tilde_count(), 0u);
+    EXPECT_EQ(pool.pail_count(), 0u);
+    NTildeMaterial n_tilde;
+    PailMaterial pail;
+    EXPECT_FALSE(pool.TakeNTilde(n_tilde));
+    EXPECT_FALSE(pool.TakePail(pail));
+
+    KeyMaterialPool restored(1, 1);
+    EXPECT_FALSE(restored.LoadFromFile(POOL_FILE, "wrong passphrase"));
+    EXPECT_EQ(restored.n_tilde_count(), 0u);
+    ASSERT_TRUE(restored.LoadFromFile(POOL_FILE, "passphrase"));
+    EXPECT_EQ(restored.n_tilde_count(), 1u);
+    EXPECT_EQ(restored.pail_count(), 1u);
+
+    EXPECT_TRUE(restored.TakeNTilde(n_tilde));
+    EXPECT_TRUE(n_tilde.N_tilde_ == (n_tilde.p_ * 2 + 1) * (n_tilde.q_ * 2 + 1));
+    EXPECT_TRUE(restored.TakePail(pail));
+    BN m(123456789);
+    EXPECT_TRUE(pail.pail_priv_.Decrypt(pail.pail_pub_.Encrypt(m)) == m);
+
+    // The file is consumed by the load
+    EXPECT_FALSE(restored.LoadFromFile(POOL_FILE, "passphrase"));
+    std::remove(POOL_FILE);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    int ret = RUN_ALL_TESTS();
+    google::protobuf::ShutdownProtobufLibrary();
+    return ret;
+}
@@ -0,0 +1,105 @@
+#include <vector>
+#include <google/protobuf/stubs/common.h>
+#include "gtest/gtest.h"
+#include "crypto-suites/crypto-bn/bn.h"
+#include "crypto-suites/crypto-bn/rand.h"
+#include "crypto-suites/crypto-curve/curve.h"
+#include "multi-party-sig/multi-party-ecdsa/common/vss_batch_verifier.h"
+
+using safeheron::bignum::BN;
+using safeheron::curve::Curve;
+using safeheron::curve::CurvePoint;
+using safeheron::curve::CurveType;
+using safeheron::multi_party_ecdsa::common::MultiScalarMul;
+using safeheron::multi_party_ecdsa::common::VssBatchVerifier;
+
+// Commitments of a random polynomial of degree threshold - 1, and its value at index
+void make_share(std::vector<CurvePoint> &commits, BN &share, CurveType curve_type, int threshold, const BN &index) {
+    const Curve *curv = safeheron::curve::GetCurveParam(curve_type);
+    commits.clear();
+    share = BN(0);
+    BN power(1);
+    for (int k = 0; k < threshold; ++k) {
+        BN coe = safeheron::rand::RandomBNLt(curv->n);
+        commits.push_back(curv->g * coe);
+        share = (share + coe * power) % curv->n;
+        power = (power * index) % curv->n;
+    }
+}
+
+TEST(VssBatchVerifier, MultiScalarMul) {
+    CurveType curve_types[2] = {CurveType::SECP256K1, CurveType::P256};
+    for (CurveType curve_type : curve_types) {
+        const Curve *curv = safeheron::curve::GetCurveParam(curve_type);
+        EXPECT_TRUE(MultiScalarMul({}, {}, curve_type).IsInfinity());
+
+        std::vector<CurvePoint> point_arr;
+        std::vector<BN> scalar_arr;
+        CurvePoint expected(curve_type);
+        for (int i = 0; i < 20; ++i) {
+            point_arr.push_back(curv->g * safeheron::rand::RandomBNLt(curv->n));
+            // Small, zero and full size scalars
+            BN scalar = (i % 5 == 0) ? BN(i) : safeheron::rand::RandomBNLt(curv->n);
+            scalar_arr.push_back(scalar);
+            expected += point_arr.back() * scalar;
+        }
+        EXPECT_TRUE(MultiScalarMul(point_arr, scalar_arr, curve_type) == expected);
+
+        // P - P
+        point_arr = {curv->g, curv->g};
+        scalar_arr = {BN(1), curv->n - BN(1)};
+        EXPECT_TRUE(MultiScalarMul(point_arr, scalar_arr, curve_type).IsInfinity());
+    }
+}
+
+TEST(VssBatchVerifier, Verify) {
+    const int threshold = 14;
+    const size_t n_peers = 19;
+    BN index(7);
+    CurveType curve_type = CurveType::SECP256K1;
+    const Curve *curv = safeheron::curve::GetCurveParam(curve_type);
+
+    std::vector<std::vector<CurvePoint>> commits_arr(n_peers);
+    std::vector<BN> share_arr(n_peers);
+    for (size_t i = 0; i < n_peers; ++i) {
+        make_share(commits_arr[i], share_arr[i], curve_type, threshold, index);
+    }
+
+    std::vector<size_t> failed_arr;
+    {
+        VssBatchVerifier verifier(curve_type, threshold, index);
+        for (size_t i = 0; i < n_peers; ++i) verifier.Add(commits_arr[i], share_arr[i]);
+        EXPECT_TRUE(verifier.Verify(failed_arr));
+        EXPECT_TRUE(failed_arr.empty());
+    }
+
+    // Bad shares are named
+    share_arr[3] = (share_arr[3] + BN(1)) % curv->n;
+    commits_arr[11][threshold - 1] = commits_arr[11][threshold - 1] + curv->g;
+    {
+        VssBatchVerifier verifier(curve_type, threshold, index);
+        for (size_t i = 0; i < n_peers; ++i) verifier.Add(commits_arr[i], share_arr[i]);
+        EXPECT_FALSE(verifier.Verify(failed_arr));
+        ASSERT_EQ(failed_arr.size(), 2u);
+        EXPECT_EQ(failed_arr[0], 3u);
+        EXPECT_EQ(failed_arr[1], 11u);
+    }
+
+    // So are the commitments of a wrong size
+    make_share(commits_arr[3], share_arr[3], curve_type, threshold, index);
+    commits_arr[11].pop_back();
+    {
+        VssBatchVerifier verifier(curve_type, threshold, index);
+        for (size_t i = 0; i < n_peers; ++i) verifier.Add(commits_arr[i], share_arr[i]);
+        EXPECT_FALSE(verifier.Verify(failed_arr));
+        ASSERT_EQ(failed_arr.size(), 1u);
+        EXPECT_EQ(failed_arr[0], 11u);
+    }
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    int ret = RUN_ALL_TESTS();
+    google::protobuf::ShutdownProtobufLibrary();
+    return ret;
+}
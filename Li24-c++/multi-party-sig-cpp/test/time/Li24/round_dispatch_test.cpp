@@ -0,0 +1,47 @@
+#include <chrono>
+#include <google/protobuf/stubs/common.h>
+#include "gtest/gtest.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/Li24.h"
+#include "multi-party-sig/multi-party-ecdsa/cmp/cmp.h"
+
+#define ITERATIONS 10000000
+
+// Sink for the context pointers, keeps the compiler from dropping the loops
+void * volatile sink = nullptr;
+
+template<class Ctx, class Round>
+void bench_dispatch(const char *name, const Round &round) {
+    std::chrono::high_resolution_clock::time_point begin = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < ITERATIONS; ++i) {
+        sink = dynamic_cast<Ctx *>(round.get_mpc_context());
+    }
+    std::chrono::high_resolution_clock::time_point middle = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < ITERATIONS; ++i) {
+        sink = round.get_context();
+    }
+    std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+
+    std::chrono::duration<double, std::nano> dynamic_time = middle - begin;
+    std::chrono::duration<double, std::nano> static_time = end - middle;
+    std::cout << name << ":" << std::endl;
+    std::cout << "    dynamic_cast: " << dynamic_time.count() / ITERATIONS << " ns per call" << std::endl;
+    std::cout << "    get_context:  " << static_time.count() / ITERATIONS << " ns per call" << std::endl;
+
+    EXPECT_EQ(dynamic_cast<Ctx *>(round.get_mpc_context()), round.get_context());
+}
+
+TEST(Round, Dispatch)
+{
+    safeheron::multi_party_ecdsa::Li24::sign::Context Li24_ctx(3);
+    bench_dispatch<safeheron::multi_party_ecdsa::Li24::sign::Context>("Li24 sign", Li24_ctx.round1_);
+
+    safeheron::multi_party_ecdsa::cmp::sign::Context cmp_ctx(3);
+    bench_dispatch<safeheron::multi_party_ecdsa::cmp::sign::Context>("cmp sign", cmp_ctx.round1_);
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    int ret = RUN_ALL_TESTS();
+    google::protobuf::ShutdownProtobufLibrary();
+    return ret;
+}
@@ -0,0 +1,137 @@
+#include <chrono>
+#include <future>
+#include <map>
+#include <thread>
+#include <google/protobuf/stubs/common.h>
+#include "gtest/gtest.h"
+#include "multi-party-sig/mpc-flow/mpc-parallel-v2/local_transport.h"
+#include "../thread_safe_queue.h"
+#include "../message.h"
+#include "../party_message_queue.h"
+
+using std::string;
+using std::vector;
+using safeheron::mpc_flow::mpc_parallel_v2::LocalMessage;
+using safeheron::mpc_flow::mpc_parallel_v2::LocalTransport;
+using safeheron::mpc_flow::mpc_parallel_v2::MpscRing;
+using safeheron::mpc_flow::mpc_parallel_v2::SpscRing;
+
+// Messaging only: every party sends one message per round to every other party, no cryptography involved.
+#define N_PARTIES 5
+#define ROUNDS 1000
+#define PAYLOAD_SIZE 512
+
+std::map<std::string, PartyMessageQue<Msg>> map_id_message_queue;
+
+bool run_party_queue(const vector<string> &party_ids, size_t local) {
+    string payload(PAYLOAD_SIZE, 'x');
+    for (int round = 0; round < ROUNDS; ++round) {
+        for (size_t j = 0; j < party_ids.size(); ++j) {
+            if (j == local) continue;
+            Msg m = {party_ids[local], payload, payload};
+            map_id_message_queue.at(party_ids[j]).get(round).Push(m);
+        }
+        for (size_t k = 0; k < party_ids.size() - 1; ++k) {
+            Msg m;
+            map_id_message_queue.at(party_ids[local]).get(round).Pop(m);
+            if (m.bc_msg_.size() != PAYLOAD_SIZE) return false;
+        }
+    }
+    return true;
+}
+
+bool run_local_transport(LocalTransport *transport, size_t local) {
+    string payload(PAYLOAD_SIZE, 'x');
+    for (int round = 0; round < ROUNDS; ++round) {
+        for (size_t j = 0; j < transport->n_parties(); ++j) {
+            if (j == local) continue;
+            if (!transport->Send(j, LocalMessage(local, round, payload, payload))) return false;
+        }
+        for (size_t k = 0; k < transport->n_parties() - 1; ++k) {
+            LocalMessage m;
+            if (!transport->Receive(local, round, m)) return false;
+            if (m.bc_msg_.size() != PAYLOAD_SIZE) return false;
+        }
+    }
+    return true;
+}
+
+template<class F>
+double measure_us_per_round(F party) {
+    std::future<bool> res[N_PARTIES];
+    std::chrono::high_resolution_clock::time_point begin = std::chrono::high_resolution_clock::now();
+    for (size_t i = 0; i < N_PARTIES; ++i) {
+        res[i] = std::async(std::launch::async, party, i);
+    }
+    for (size_t i = 0; i < N_PARTIES; ++i) {
+        EXPECT_TRUE(res[i].get());
+    }
+    std::chrono::high_resolution_clock::time_point end = std::chrono::high_resolution_clock::now();
+    std::chrono::duration<double, std::micro> elapsed = end - begin;
+    return elapsed.count() / ROUNDS;
+}
+
+TEST(LocalTransport, RingOrder)
+{
+    SpscRing<std::unique_ptr<int>> spsc(3);
+    EXPECT_EQ(spsc.capacity(), 4u);
+    std::thread producer([&spsc] {
+        for (int i = 0; i < 100000; ++i) {
+            std::unique_ptr<int> value(new int(i));
+            while (!spsc.TryPush(std::move(value))) std::this_thread::yield();
+        }
+    });
+    for (int i = 0; i < 100000; ++i) {
+        std::unique_ptr<int> value;
+        while (!spsc.TryPop(value)) std::this_thread::yield();
+        ASSERT_EQ(*value, i);
+    }
+    producer.join();
+
+    // Each producer's messages stay in order
+    MpscRing<std::pair<int, int>> mpsc(16);
+    vector<std::thread> producer_arr;
+    for (int p = 0; p < 4; ++p) {
+        producer_arr.emplace_back([&mpsc, p] {
+            for (int i = 0; i < 100000; ++i) {
+                while (!mpsc.TryPush(std::make_pair(p, i))) std::this_thread::yield();
+            }
+        });
+    }
+    int next[4] = {0, 0, 0, 0};
+    for (int i = 0; i < 400000; ++i) {
+        std::pair<int, int> value;
+        while (!mpsc.TryPop(value)) std::this_thread::yield();
+        ASSERT_EQ(value.second, next[value.first]++);
+    }
+    for (auto &producer_thread : producer_arr) producer_thread.join();
+}
+
+TEST(LocalTransport, Overhead)
+{
+    vector<string> party_ids;
+    for (int i = 0; i < N_PARTIES; ++i) {
+        party_ids.push_back("co_signer" + std::to_string(i + 1));
+        map_id_message_queue[party_ids[i]] = PartyMessageQue<Msg>(ROUNDS);
+    }
+    double queue_time = measure_us_per_round([&party_ids](size_t i) { return run_party_queue(party_ids, i); });
+
+    LocalTransport transport(party_ids, 64);
+    double transport_time = measure_us_per_round([&transport](size_t i) { return run_local_transport(&transport, i); });
+
+    std::cout << N_PARTIES << " parties, " << PAYLOAD_SIZE << " bytes per payload:" << std::endl;
+    std::cout << "    ThreadSafeQueue: " << queue_time << " us per round" << std::endl;
+    std::cout << "    LocalTransport:  " << transport_time << " us per round" << std::endl;
+
+    // A closed transport releases the waiting receivers
+    transport.Close();
+    LocalMessage m;
+    EXPECT_FALSE(transport.Receive(0, ROUNDS, m));
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    int ret = RUN_ALL_TESTS();
+    google::protobuf::ShutdownProtobufLibrary();
+    return ret;
+}
@@ -0,0 +1,433 @@
+/*
+ * End-to-end signing benchmark for Li24 / CMP / GG18 / GG20.
+ *
+ * The parties run in their own threads and exchange the messages through in-memory queues. For every round of every
+ * party the time spent in the protocol (compute phase) is measured apart from the time spent waiting for the messages
+ * of the other parties (wait phase), in wall time and in CPU time of the party thread.
+ *
+ * Usage:
+ *   time.sign_bench [--protocol=Li24|cmp|gg18|gg20] [--curve=secp256k1|p256] [--t=5] [--n=5]
+ *                   [--iterations=20] [--warmup=2] [--key-file=<file>] [--key-min-n=5] [--json=<file>]
+ *
+ * The sign keys are read from the files used by the other time tests, e.g. "secp256k1_Li24_nn.txt": one key per line,
+ * grouped by the number of parties from key-min-n upwards. The report is printed as JSON, to stdout by default.
+ */
+#include <time.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <future>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+#include <google/protobuf/stubs/common.h>
+#include "crypto-suites/exception/located_exception.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/Li24.h"
+#include "multi-party-sig/multi-party-ecdsa/Li24/util.h"
+#include "multi-party-sig/multi-party-ecdsa/cmp/cmp.h"
+#include "multi-party-sig/multi-party-ecdsa/gg18/gg18.h"
+#include "multi-party-sig/multi-party-ecdsa/gg18/util.h"
+#include "multi-party-sig/multi-party-ecdsa/gg20/gg20.h"
+#include "../thread_safe_queue.h"
+#include "../message.h"
+#include "../party_message_queue.h"
+
+using std::string;
+using std::vector;
+using safeheron::bignum::BN;
+using safeheron::mpc_flow::mpc_parallel_v2::ErrorInfo;
+
+#define MAX_ROUNDS 16
+
+struct Params {
+    string protocol_ = "Li24";
+    string curve_ = "secp256k1";
+    int t_ = 5;
+    int n_ = 5;
+    int iterations_ = 20;
+    int warmup_ = 2;
+    int key_min_n_ = 5;
+    string key_file_;
+    string json_file_;
+};
+
+/**
+ * Times of one party in one signature, in seconds.
+ */
+struct RoundTime {
+    double compute_wall_ = 0;
+    double compute_cpu_ = 0;
+    double wait_wall_ = 0;
+};
+
+struct PartyTime {
+    double create_wall_ = 0;
+    double create_cpu_ = 0;
+    vector<RoundTime> round_arr_;
+};
+
+static double wall_now() {
+    std::chrono::steady_clock::duration d = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration<double>(d).count();
+}
+
+static double thread_cpu_now() {
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+struct Li24Protocol {
+    typedef safeheron::multi_party_ecdsa::Li24::sign::Context Context;
+
+    static bool Trim(string &out, const string &in, const vector<string> &participants) {
+        return safeheron::multi_party_ecdsa::Li24::trim_sign_key(out, in, participants);
+    }
+
+    static bool Create(Context &ctx, const string &sign_key_base64, const BN &m) {
+        if (!Context::CreateContext(ctx, sign_key_base64, m)) return false;
+        for (size_t i = 0; i < ctx.sign_key_.remote_parties_.size(); ++i) {
+            ctx.sign_key_.remote_parties_[i].prg.reset();
+            ctx.sign_key_.remote_parties_[i].prg.init(ctx.sign_key_.remote_parties_[i].seed_);
+        }
+        return true;
+    }
+};
+
+struct CMPProtocol {
+    typedef safeheron::multi_party_ecdsa::cmp::sign::Context Context;
+
+    static bool Trim(string &out, const string &in, const vector<string> &participants) {
+        return safeheron::multi_party_ecdsa::cmp::trim_sign_key(out, in, participants);
+    }
+
+    static bool Create(Context &ctx, const string &sign_key_base64, const BN &m) {
+        return Context::CreateContext(ctx, sign_key_base64, m, "ssid");
+    }
+};
+
+struct GG18Protocol {
+    typedef safeheron::multi_party_ecdsa::gg18::sign::Context Context;
+
+    static bool Trim(string &out, const string &in, const vector<string> &participants) {
+        return safeheron::multi_party_ecdsa::gg18::trim_sign_key(out, in, participants);
+    }
+
+    static bool Create(Context &ctx, const string &sign_key_base64, const BN &m) {
+        return Context::CreateContext(ctx, sign_key_base64, m);
+    }
+};
+
+struct GG20Protocol {
+    typedef safeheron::multi_party_ecdsa::gg20::sign::Context Context;
+
+    // GG20 shares the sign key format of GG18
+    static bool Trim(string &out, const string &in, const vector<string> &participants) {
+        return safeheron::multi_party_ecdsa::gg18::trim_sign_key(out, in, participants);
+    }
+
+    static bool Create(Context &ctx, const string &sign_key_base64, const BN &m) {
+        return Context::CreateContext(ctx, sign_key_base64, m);
+    }
+};
+
+template<class Ctx>
+static void print_context_stack_if_failed(Ctx *ctx) {
+    std::string err_info;
+    vector<ErrorInfo> error_stack;
+    ctx->get_error_stack(error_stack);
+    for (const auto &err: error_stack) {
+        err_info += "error code ( " + std::to_string(err.code_) + " ) : " + err.info_ + "\n";
+    }
+    fprintf(stderr, "%s", err_info.c_str());
+}
+
+template<class Protocol>
+static bool sign(const string &sign_key_base64, const vector<string> &participants, const BN &m,
+                 std::map<string, PartyMessageQue<Msg>> &map_id_queue, PartyTime &party_time, string &r) {
+    typedef typename Protocol::Context Context;
+
+    double wall = wall_now();
+    double cpu = thread_cpu_now();
+    string t_sign_key_base64;
+    if (!Protocol::Trim(t_sign_key_base64, sign_key_base64, participants)) {
+        fprintf(stderr, "Failed to trim the sign key, is its threshold t?\n");
+        return false;
+    }
+    Context ctx((int)participants.size());
+    if (!Protocol::Create(ctx, t_sign_key_base64, m)) {
+        print_context_stack_if_failed(&ctx);
+        return false;
+    }
+    party_time.create_wall_ = wall_now() - wall;
+    party_time.create_cpu_ = thread_cpu_now() - cpu;
+
+    const string &party_id = ctx.sign_key_.local_party_.party_id_;
+    party_time.round_arr_.resize(ctx.get_total_rounds());
+    for (int round = 0; round < ctx.get_total_rounds(); ++round) {
+        RoundTime &round_time = party_time.round_arr_[round];
+        bool ok = true;
+        if (round == 0) {
+            wall = wall_now();
+            cpu = thread_cpu_now();
+            ok = ctx.PushMessage();
+        } else {
+            for (size_t k = 0; ok && k < participants.size() - 1; ++k) {
+                Msg msg;
+                double wait = wall_now();
+                map_id_queue.at(party_id).get(round - 1).Pop(msg);
+                wait = wall_now() - wait;
+                round_time.wait_wall_ += wait;
+
+                // The compute phase starts with the first message, the waits for the later ones are not counted
+                if (k == 0) {
+                    wall = wall_now();
+                    cpu = thread_cpu_now();
+                } else {
+                    wall += wait;
+                }
+                ok = ctx.PushMessage(msg.p2p_msg_, msg.bc_msg_, msg.src_, round - 1);
+            }
+        }
+        if (!ok || !ctx.IsCurRoundFinished()) {
+            print_context_stack_if_failed(&ctx);
+            return false;
+        }
+
+        string out_bc_message;
+        vector<string> out_p2p_message_arr;
+        vector<string> out_des_arr;
+        if (!ctx.PopMessages(out_p2p_message_arr, out_bc_message, out_des_arr)) {
+            print_context_stack_if_failed(&ctx);
+            return false;
+        }
+        for (size_t j = 0; j < out_des_arr.size(); ++j) {
+            Msg msg = {party_id, out_bc_message, out_p2p_message_arr.empty() ? "" : out_p2p_message_arr[j]};
+            map_id_queue.at(out_des_arr[j]).get(round).Push(msg);
+        }
+        round_time.compute_wall_ = wall_now() - wall;
+        round_time.compute_cpu_ = thread_cpu_now() - cpu;
+    }
+
+    if (!ctx.IsFinished()) {
+        print_context_stack_if_failed(&ctx);
+        return false;
+    }
+    ctx.r_.ToHexStr(r);
+    return true;
+}
+
+/**
+ * Summary of a set of samples, reported in milliseconds.
+ */
+struct Stats {
+    double mean_ = 0;
+    double min_ = 0;
+    double p50_ = 0;
+    double p90_ = 0;
+    double p99_ = 0;
+    double max_ = 0;
+};
+
+// Nearest-rank percentile of sorted samples
+static double percentile(const vector<double> &sorted, double p) {
+    size_t rank = (size_t)(p / 100.0 * sorted.size() + 0.999999);
+    if (rank < 1) rank = 1;
+    if (rank > sorted.size()) rank = sorted.size();
+    return sorted[rank - 1];
+}
+
+static Stats make_stats(vector<double> samples) {
+    Stats stats;
+    if (samples.empty()) return stats;
+    std::sort(samples.begin(), samples.end());
+    double sum = 0;
+    for (double v: samples) sum += v;
+    stats.mean_ = sum / samples.size() * 1000;
+    stats.min_ = samples.front() * 1000;
+    stats.p50_ = percentile(samples, 50) * 1000;
+    stats.p90_ = percentile(samples, 90) * 1000;
+    stats.p99_ = percentile(samples, 99) * 1000;
+    stats.max_ = samples.back() * 1000;
+    return stats;
+}
+
+static string stats_json(const Stats &stats) {
+    char buf[256];
+    snprintf(buf, sizeof(buf),
+             "{\"mean\": %.6f, \"min\": %.6f, \"p50\": %.6f, \"p90\": %.6f, \"p99\": %.6f, \"max\": %.6f}",
+             stats.mean_, stats.min_, stats.p50_, stats.p90_, stats.p99_, stats.max_);
+    return buf;
+}
+
+static bool load_sign_keys(const Params &params, vector<string> &sign_key_base64_arr) {
+    string file_name = params.key_file_;
+    if (file_name.empty()) {
+        // GG20 signs with the keys of GG18
+        string key_protocol = params.protocol_ == "gg20" ? "gg18" : params.protocol_;
+        file_name = params.curve_ + "_" + key_protocol + (params.t_ == params.n_ ? "_nn" : "") + ".txt";
+    }
+    std::ifstream file(file_name);
+    if (!file.is_open()) {
+        fprintf(stderr, "Failed to open the key file %s\n", file_name.c_str());
+        return false;
+    }
+
+    // Skip the keys of the smaller groups
+    int skip = 0;
+    for (int i = params.key_min_n_; i < params.n_; ++i) skip += i;
+    string line;
+    for (int i = 0; i < skip && getline(file, line); ++i) {}
+    for (int i = 0; i < params.n_ && getline(file, line); ++i) sign_key_base64_arr.push_back(line);
+    if ((int)sign_key_base64_arr.size() != params.n_) {
+        fprintf(stderr, "Not enough sign keys in %s for n = %d\n", file_name.c_str(), params.n_);
+        return false;
+    }
+    return true;
+}
+
+template<class Protocol>
+static bool run(const Params &params) {
+    vector<string> sign_key_base64_arr;
+    if (!load_sign_keys(params, sign_key_base64_arr)) return false;
+
+    vector<string> participants;
+    for (int i = 1; i <= params.t_; ++i) participants.push_back("co_signer" + std::to_string(i));
+    BN m = BN("1234567812345678123456781234567812345678123456781234567812345678", 16);
+
+    vector<double> sign_wall_arr;
+    vector<double> sign_cpu_arr;
+    vector<double> create_wall_arr;
+    vector<double> create_cpu_arr;
+    vector<vector<double>> round_compute_wall_arr;
+    vector<vector<double>> round_compute_cpu_arr;
+    vector<vector<double>> round_wait_wall_arr;
+    double total_wall = 0;
+
+    for (int iter = 0; iter < params.warmup_ + params.iterations_; ++iter) {
+        vector<PartyTime> party_time_arr(params.t_);
+        vector<string> r_arr(params.t_);
+        std::map<string, PartyMessageQue<Msg>> map_id_queue;
+        for (const auto &party_id: participants) map_id_queue[party_id] = PartyMessageQue<Msg>(MAX_ROUNDS);
+
+        double begin = wall_now();
+        vector<std::future<bool>> res(params.t_);
+        for (int i = 0; i < params.t_; ++i) {
+            res[i] = std::async(std::launch::async, sign<Protocol>, std::cref(sign_key_base64_arr[i]),
+                                std::cref(participants), std::cref(m), std::ref(map_id_queue),
+                                std::ref(party_time_arr[i]), std::ref(r_arr[i]));
+        }
+        bool ok = true;
+        for (int i = 0; i < params.t_; ++i) {
+            try {
+                ok = res[i].get() && ok;
+            } catch (const safeheron::exception::LocatedException &e) {
+                fprintf(stderr, "%s\n", e.what());
+                ok = false;
+            }
+        }
+        double sign_wall = wall_now() - begin;
+        for (int i = 1; ok && i < params.t_; ++i) ok = r_arr[i] == r_arr[0];
+        if (!ok) {
+            fprintf(stderr, "Signing failed in iteration %d\n", iter);
+            return false;
+        }
+        if (iter < params.warmup_) continue;
+
+        total_wall += sign_wall;
+        sign_wall_arr.push_back(sign_wall);
+        double sign_cpu = 0;
+        for (const auto &party_time: party_time_arr) {
+            create_wall_arr.push_back(party_time.create_wall_);
+            create_cpu_arr.push_back(party_time.create_cpu_);
+            sign_cpu += party_time.create_cpu_;
+            round_compute_wall_arr.resize(party_time.round_arr_.size());
+            round_compute_cpu_arr.resize(party_time.round_arr_.size());
+            round_wait_wall_arr.resize(party_time.round_arr_.size());
+            for (size_t k = 0; k < party_time.round_arr_.size(); ++k) {
+                round_compute_wall_arr[k].push_back(party_time.round_arr_[k].compute_wall_);
+                round_compute_cpu_arr[k].push_back(party_time.round_arr_[k].compute_cpu_);
+                round_wait_wall_arr[k].push_back(party_time.round_arr_[k].wait_wall_);
+                sign_cpu += party_time.round_arr_[k].compute_cpu_;
+            }
+        }
+        sign_cpu_arr.push_back(sign_cpu);
+    }
+
+    string json;
+    json += "{\n";
+    json += "  \"protocol\": \"" + params.protocol_ + "\",\n";
+    json += "  \"curve\": \"" + params.curve_ + "\",\n";
+    json += "  \"t\": " + std::to_string(params.t_) + ",\n";
+    json += "  \"n\": " + std::to_string(params.n_) + ",\n";
+    json += "  \"iterations\": " + std::to_string(params.iterations_) + ",\n";
+    json += "  \"warmup\": " + std::to_string(params.warmup_) + ",\n";
+    json += "  \"unit\": \"ms\",\n";
+    json += "  \"throughput_sig_per_s\": " + std::to_string(total_wall > 0 ? params.iterations_ / total_wall : 0) + ",\n";
+    json += "  \"sign_wall\": " + stats_json(make_stats(sign_wall_arr)) + ",\n";
+    json += "  \"sign_cpu_all_parties\": " + stats_json(make_stats(sign_cpu_arr)) + ",\n";
+    json += "  \"create_context_wall\": " + stats_json(make_stats(create_wall_arr)) + ",\n";
+    json += "  \"create_context_cpu\": " + stats_json(make_stats(create_cpu_arr)) + ",\n";
+    json += "  \"rounds\": [\n";
+    for (size_t k = 0; k < round_compute_wall_arr.size(); ++k) {
+        json += "    {\"round\": " + std::to_string(k) + ",\n";
+        json += "     \"compute_wall\": " + stats_json(make_stats(round_compute_wall_arr[k])) + ",\n";
+        json += "     \"compute_cpu\": " + stats_json(make_stats(round_compute_cpu_arr[k])) + ",\n";
+        json += "     \"wait_wall\": " + stats_json(make_stats(round_wait_wall_arr[k])) + "}";
+        json += (k + 1 < round_compute_wall_arr.size()) ? ",\n" : "\n";
+    }
+    json += "  ]\n";
+    json += "}\n";
+
+    if (params.json_file_.empty()) {
+        std::cout << json;
+    } else {
+        std::ofstream out(params.json_file_);
+        out << json;
+    }
+    return true;
+}
+
+static bool parse_args(int argc, char **argv, Params &params) {
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        size_t pos = arg.find('=');
+        if (arg.compare(0, 2, "--") != 0 || pos == string::npos) return false;
+        string key = arg.substr(2, pos - 2);
+        string value = arg.substr(pos + 1);
+        if (key == "protocol") params.protocol_ = value;
+        else if (key == "curve") params.curve_ = value;
+        else if (key == "t") params.t_ = atoi(value.c_str());
+        else if (key == "n") params.n_ = atoi(value.c_str());
+        else if (key == "iterations") params.iterations_ = atoi(value.c_str());
+        else if (key == "warmup") params.warmup_ = atoi(value.c_str());
+        else if (key == "key-min-n") params.key_min_n_ = atoi(value.c_str());
+        else if (key == "key-file") params.key_file_ = value;
+        else if (key == "json") params.json_file_ = value;
+        else return false;
+    }
+    return params.t_ >= 2 && params.t_ <= params.n_ && params.iterations_ > 0 && params.warmup_ >= 0;
+}
+
+int main(int argc, char **argv) {
+    Params params;
+    if (!parse_args(argc, argv, params)) {
+        fprintf(stderr, "Usage: %s [--protocol=Li24|cmp|gg18|gg20] [--curve=secp256k1|p256] [--t=5] [--n=5] "
+                        "[--iterations=20] [--warmup=2] [--key-file=<file>] [--key-min-n=5] [--json=<file>]\n", argv[0]);
+        return 2;
+    }
+
+    bool ok = false;
+    if (params.protocol_ == "Li24") ok = run<Li24Protocol>(params);
+    else if (params.protocol_ == "cmp") ok = run<CMPProtocol>(params);
+    else if (params.protocol_ == "gg18") ok = run<GG18Protocol>(params);
+    else if (params.protocol_ == "gg20") ok = run<GG20Protocol>(params);
+    else fprintf(stderr, "Unknown protocol %s\n", params.protocol_.c_str());
+
+    google::protobuf::ShutdownProtobufLibrary();
+    return ok ? 0 : 1;
+}